@@ -86,9 +86,6 @@ endif()
 if (onnxruntime_USE_MIMALLOC_STL_ALLOCATOR OR onnxruntime_USE_MIMALLOC_ARENA_ALLOCATOR)
     if(onnxruntime_USE_CUDA OR onnxruntime_USE_OPENVINO)
         message(WARNING "Ignoring directive to use mimalloc on unimplemented targets")
-    elseif (${CMAKE_CXX_COMPILER_ID} MATCHES "GNU")
-        # Some of the non-windows targets see strange runtime failures
-        message(WARNING "Ignoring request to link to mimalloc - only windows supported")
     else()
         include(external/mimalloc.cmake)
         list(APPEND onnxruntime_EXTERNAL_LIBRARIES mimalloc-static)
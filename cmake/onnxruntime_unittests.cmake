@@ -762,6 +762,26 @@ if(onnxruntime_BUILD_BENCHMARKS)
   target_link_libraries(onnxruntime_benchmark PRIVATE onnx_test_runner_common benchmark::benchmark ${onnx_test_libs})
   add_dependencies(onnxruntime_benchmark ${onnxruntime_EXTERNAL_DEPENDENCIES})
   set_target_properties(onnxruntime_benchmark PROPERTIES FOLDER "ONNXRuntimeTest")
+
+  onnxruntime_add_executable(onnxruntime_mlas_benchmark ${TEST_SRC_DIR}/mlas/benchmark.cpp)
+  target_include_directories(onnxruntime_mlas_benchmark PRIVATE ${ONNXRUNTIME_ROOT}/core/mlas/inc ${ONNXRUNTIME_ROOT}
+          ${CMAKE_CURRENT_BINARY_DIR})
+  set(onnxruntime_mlas_benchmark_libs onnxruntime_mlas onnxruntime_common benchmark::benchmark)
+  if(NOT WIN32)
+    list(APPEND onnxruntime_mlas_benchmark_libs nsync_cpp ${CMAKE_DL_LIBS})
+  endif()
+  if (onnxruntime_USE_OPENMP)
+    list(APPEND onnxruntime_mlas_benchmark_libs OpenMP::OpenMP_CXX)
+  endif()
+  list(APPEND onnxruntime_mlas_benchmark_libs Threads::Threads)
+  target_link_libraries(onnxruntime_mlas_benchmark PRIVATE ${onnxruntime_mlas_benchmark_libs})
+  if(WIN32)
+    target_link_libraries(onnxruntime_mlas_benchmark PRIVATE debug Dbghelp Advapi32)
+  endif()
+  if (onnxruntime_LINK_LIBATOMIC)
+    target_link_libraries(onnxruntime_mlas_benchmark PRIVATE atomic)
+  endif()
+  set_target_properties(onnxruntime_mlas_benchmark PROPERTIES FOLDER "ONNXRuntimeTest")
 endif()
 
 if(WIN32)
@@ -850,6 +870,45 @@ if (onnxruntime_USE_TVM)
   endif()
 endif()
 
+#continuous regression benchmark over a declared model corpus
+set(onnxruntime_model_bench_src_dir ${TEST_SRC_DIR}/modelbench)
+file(GLOB onnxruntime_model_bench_src CONFIGURE_DEPENDS
+  "${onnxruntime_model_bench_src_dir}/*.cc"
+  "${onnxruntime_model_bench_src_dir}/*.h"
+  )
+onnxruntime_add_executable(onnxruntime_model_bench ${onnxruntime_model_bench_src} ${ONNXRUNTIME_ROOT}/core/platform/path_lib.cc)
+if(MSVC)
+  target_compile_options(onnxruntime_model_bench PRIVATE "$<$<COMPILE_LANGUAGE:CUDA>:SHELL:--compiler-options /utf-8>"
+          "$<$<NOT:$<COMPILE_LANGUAGE:CUDA>>:/utf-8>")
+endif()
+target_include_directories(onnxruntime_model_bench PRIVATE ${ONNXRUNTIME_ROOT} ${CMAKE_CURRENT_BINARY_DIR})
+if (WIN32)
+  target_compile_options(onnxruntime_model_bench PRIVATE ${disabled_warnings})
+  if (NOT DEFINED SYS_PATH_LIB)
+    set(SYS_PATH_LIB shlwapi)
+  endif()
+endif()
+
+if (onnxruntime_BUILD_SHARED_LIB)
+  set(onnxruntime_model_bench_libs
+          onnxruntime_test_utils onnxruntime_common onnxruntime
+          ${onnxruntime_EXTERNAL_LIBRARIES}
+          ${GETOPT_LIB_WIDE} ${SYS_PATH_LIB} ${CMAKE_DL_LIBS})
+  if(NOT WIN32)
+    list(APPEND onnxruntime_model_bench_libs nsync_cpp)
+  endif()
+  if (CMAKE_SYSTEM_NAME STREQUAL "Android")
+    list(APPEND onnxruntime_model_bench_libs ${android_shared_libs})
+  endif()
+  target_link_libraries(onnxruntime_model_bench PRIVATE ${onnxruntime_model_bench_libs} Threads::Threads)
+  if(WIN32)
+    target_link_libraries(onnxruntime_model_bench PRIVATE debug dbghelp advapi32)
+  endif()
+else()
+  target_link_libraries(onnxruntime_model_bench PRIVATE ${GETOPT_LIB_WIDE} ${onnx_test_libs})
+endif()
+set_target_properties(onnxruntime_model_bench PROPERTIES FOLDER "ONNXRuntimeTest")
+
 # shared lib
 if (onnxruntime_BUILD_SHARED_LIB)
   add_library(onnxruntime_mocked_allocator ${ONNXRUNTIME_ROOT}/test/util/test_allocator.cc)
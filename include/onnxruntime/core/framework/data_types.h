@@ -150,6 +150,18 @@ using CreateFunc = void* (*)();
  */
 class DataTypeImpl {
  public:
+  // Compact integer identifier for the general category of a type. Each DataTypeImpl singleton
+  // carries one, so the category checks on the hot run paths are plain integer compares with no
+  // virtual dispatch.
+  enum class GeneralType : uint8_t {
+    kInvalid = 0,
+    kNonTensor = 1,
+    kTensor = 2,
+    kTensorSequence = 3,
+    kSparseTensor = 4,
+    kPrimitive = 5,
+  };
+
   virtual ~DataTypeImpl() = default;
 
   /**
@@ -173,16 +185,20 @@ class DataTypeImpl {
    */
   virtual const ONNX_NAMESPACE::TypeProto* GetTypeProto() const = 0;
 
-  virtual bool IsTensorType() const {
-    return false;
+  GeneralType type() const noexcept {
+    return type_;
   }
 
-  virtual bool IsTensorSequenceType() const {
-    return false;
+  bool IsTensorType() const noexcept {
+    return type_ == GeneralType::kTensor;
   }
 
-  virtual bool IsSparseTensorType() const {
-    return false;
+  bool IsTensorSequenceType() const noexcept {
+    return type_ == GeneralType::kTensorSequence;
+  }
+
+  bool IsSparseTensorType() const noexcept {
+    return type_ == GeneralType::kSparseTensor;
   }
 
   // Returns this if this is of tensor-type and null otherwise
@@ -255,6 +271,12 @@ class DataTypeImpl {
   static const std::vector<MLDataType>& AllIEEEFloatTensorExceptHalfTypes();
   static const std::vector<MLDataType>& AllTensorAndSequenceTensorTypes();
   static const std::vector<MLDataType>& AllFixedSizeTensorAndSequenceTensorTypes();
+
+ protected:
+  explicit DataTypeImpl(GeneralType type) : type_(type) {}
+
+ private:
+  const GeneralType type_;
 };
 
 std::ostream& operator<<(std::ostream& out, MLDataType data_type);
@@ -455,10 +477,6 @@ class TensorTypeBase : public DataTypeImpl {
   /// where TypeProto was created ad-hoc and not queried from MLDataType
   bool IsCompatible(const ONNX_NAMESPACE::TypeProto& type_proto) const override;
 
-  bool IsTensorType() const override {
-    return true;
-  }
-
   const TensorTypeBase* AsTensorType() const override {
     return this;
   }
@@ -526,10 +544,6 @@ class SparseTensorTypeBase : public DataTypeImpl {
  public:
   static MLDataType Type();
 
-  bool IsSparseTensorType() const override {
-    return true;
-  }
-
   const SparseTensorTypeBase* AsSparseTensorType() const override {
     return this;
   }
@@ -750,10 +764,6 @@ class SequenceTensorTypeBase : public DataTypeImpl {
 
   bool IsCompatible(const ONNX_NAMESPACE::TypeProto& type_proto) const override;
 
-  bool IsTensorSequenceType() const override {
-    return true;
-  }
-
   const SequenceTensorTypeBase* AsSequenceTensorBase() const override {
     return this;
   }
@@ -872,7 +882,7 @@ class PrimitiveDataTypeBase : public DataTypeImpl {
   }
 
  protected:
-  PrimitiveDataTypeBase() = default;
+  PrimitiveDataTypeBase() : DataTypeImpl(GeneralType::kPrimitive) {}
 
   void SetDataType(int32_t data_type) {
     data_type_ = data_type;
@@ -158,6 +158,24 @@ class IExecutionProvider {
   */
   virtual common::Status OnRunEnd() { return Status::OK(); }
 
+  /**
+     Indicate whether the graph capturing mode (e.g., cuda graph) is enabled for
+     the provider. Currently only CUDA execution provider supports it.
+   */
+  virtual bool IsGraphCaptureEnabled() const { return false; }
+
+  /**
+     Indicate whether the graph has been captured and instantiated. Currently
+     only CUDA execution provider supports it.
+   */
+  virtual bool IsGraphCaptured() const { return false; }
+
+  /**
+     Run the instantiated graph. Currently only CUDA execution provider supports
+     it.
+   */
+  virtual common::Status ReplayGraph() { return Status::OK(); }
+
   /**
      Called when session creation is complete
      This provides an opportunity for execution providers to optionally synchronize and
@@ -236,6 +254,16 @@ class IExecutionProvider {
     return FusionStyle::Function;
   }
 
+  /**
+  Returns true if Compile may be invoked concurrently from multiple threads for disjoint sets of
+  fused nodes, allowing independent subgraphs to be compiled in parallel during session
+  initialization. An EP that opts in must synchronize access to any state its Compile
+  implementation shares across calls. Defaults to false (one batched Compile call).
+  */
+  virtual bool ConcurrentCompileSupported() const {
+    return false;
+  }
+
   void SetLogger(const logging::Logger* logger) {
     logger_ = logger;
   }
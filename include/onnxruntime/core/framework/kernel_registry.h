@@ -88,8 +88,26 @@ class KernelRegistry {
   static std::string GetMapKey(const KernelDef& kernel_def) {
     return GetMapKey(kernel_def.OpName(), kernel_def.Domain(), kernel_def.Provider());
   }
-  // Kernel create function map from op name to kernel creation info.
-  // key is opname+domain_name+provider_name
+
+  // Folds op name, domain and provider into one 64-bit key so registration and lookup probe
+  // the map without materializing the concatenated string key. Collisions are possible, so
+  // probe hits must still be checked against the kernel def (see MatchKernelDefKey).
+  static uint64_t GetMapKeyHash(const std::string& op_name, const std::string& domain,
+                                const std::string& provider) {
+    std::hash<std::string> hasher;
+    uint64_t key = hasher(op_name);
+    key = key * 0x9E3779B97F4A7C15ULL + hasher(domain.empty() ? kOnnxDomainAlias : domain);
+    key = key * 0x9E3779B97F4A7C15ULL + hasher(provider);
+    return key;
+  }
+
+  static uint64_t GetMapKeyHash(const KernelDef& kernel_def) {
+    return GetMapKeyHash(kernel_def.OpName(), kernel_def.Domain(), kernel_def.Provider());
+  }
+
+  // Kernel create function map keyed by GetMapKeyHash of opname+domain_name+provider_name.
+  // Registration and lookup both probe by the integer key; probe hits are validated against
+  // the kernel def (see MatchKernelDefKey) to weed out fold collisions.
   KernelCreateMap kernel_creator_fn_map_;
 };
 }  // namespace onnxruntime
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <functional>
+#include <unordered_map>
 
 #include "boost/mp11.hpp"
 
@@ -306,7 +307,10 @@ struct KernelCreateInfo {
   KernelCreateInfo() = default;
 };
 
-using KernelCreateMap = std::multimap<std::string, KernelCreateInfo>;
+// Map from the 64-bit fold of opname+domain+provider (KernelRegistry::GetMapKeyHash) to the
+// kernel creation info. Hash collisions are possible, so consumers matching on the key must
+// re-check the kernel def itself.
+using KernelCreateMap = std::unordered_multimap<uint64_t, KernelCreateInfo>;
 
 // Forward declarations for the non-specialized BuildKernelCreateInfo method.
 template <typename T>
@@ -22,6 +22,12 @@ struct OrtRunOptions {
   // be forced to terminate with an error status.
   bool terminate = false;
 
+  // Maximum wall clock time in milliseconds the Run() call may take, measured from its start.
+  // Once exceeded the run is cooperatively cancelled: parallel loops inside kernels stop
+  // claiming work and the run fails with the same error as the terminate flag at the next
+  // node boundary. 0 (the default) means no limit.
+  int64_t timeout_in_ms = 0;
+
   // Set to 'true' to run only the nodes from feeds to required fetches.
   // So it is possible that only some of the nodes are executed.
   bool only_execute_path_to_fetches = false;
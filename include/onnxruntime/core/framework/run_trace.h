@@ -0,0 +1,58 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <functional>
+#include <string>
+
+namespace onnxruntime {
+
+// Kind of a completed run lifecycle span reported to a callback registered via
+// InferenceSession::RegisterRunTraceCallback.
+enum class RunTraceSpanKind {
+  kRun = 0,    // the whole Run call, from validation through fetch copies
+  kFeedCopy,   // copying feeds to the devices the graph expects
+  kExecute,    // graph execution between the device copies
+  kFetchCopy,  // copying fetches back from device memory
+};
+
+// One completed span of a Run call. Timestamps come from the steady clock so consumers can
+// compute durations or re-base the span onto an external trace timeline.
+struct RunTraceSpan {
+  RunTraceSpanKind kind;
+  std::chrono::steady_clock::time_point start;
+  std::chrono::steady_clock::time_point end;
+  // bytes moved for kFeedCopy / kFetchCopy spans, 0 for the others
+  size_t bytes = 0;
+  // run_tag from the RunOptions of the Run call the span belongs to; empty if none was set
+  std::string run_tag;
+};
+
+// Invoked synchronously on the thread the span completed on, which can differ between concurrent
+// Run calls. Implementations must be thread safe and cheap: they sit directly on the run path.
+using RunTraceCallback = std::function<void(const RunTraceSpan&)>;
+
+// Bundles the registered callback with the Run call's tag so the graph execution layer can emit
+// spans without knowing about the session. Only passed down when a callback is registered, so
+// the unregistered case stays a single null check.
+struct RunTraceContext {
+  const RunTraceCallback* callback = nullptr;
+  const std::string* run_tag = nullptr;
+
+  void Emit(RunTraceSpanKind kind, std::chrono::steady_clock::time_point start,
+            std::chrono::steady_clock::time_point end, size_t bytes = 0) const {
+    RunTraceSpan span;
+    span.kind = kind;
+    span.start = start;
+    span.end = end;
+    span.bytes = bytes;
+    if (run_tag != nullptr) {
+      span.run_tag = *run_tag;
+    }
+    (*callback)(span);
+  }
+};
+
+}  // namespace onnxruntime
@@ -9,10 +9,20 @@
 
 namespace onnxruntime {
 
+// Layout of the indices of a SparseTensor.
+enum class SparseFormat {
+  // "indices" is a [NNZ, dims] tensor holding the coordinates of the non-zero values
+  kCoo,
+  // 2-D tensors only: "inner indices" is a [NNZ] tensor of column ids and "outer indices" is a
+  // [rows + 1] tensor of offsets into it, so the non-zeros of row i are the entries
+  // [outer[i], outer[i + 1])
+  kCsr,
+};
+
 /**
- * @brief This class implements SparseTensor. 
+ * @brief This class implements SparseTensor.
  * We represent a SparseTensor as a triple <values, indices, shape>. "values" and "indices" themselves
- * are implemented as Tensors. 
+ * are implemented as Tensors.
  * We follow the Tensor design for memory ownership/management: a sparse-tensor does not own the "value"
  * or "indices" tensors.
  */
@@ -31,6 +41,22 @@ class SparseTensor final {
                size_t nnz,
                std::shared_ptr<IAllocator> allocator);
 
+  // Constructs a CSR sparse tensor over user supplied buffers. shape must be 2-dimensional.
+  SparseTensor(MLDataType elt_type,
+               const TensorShape& shape,
+               size_t nnz,
+               void* values_data,
+               void* inner_indices_data,
+               void* outer_indices_data,
+               const OrtMemoryInfo& memory_info);
+
+  // Allocates buffers for nnz non-zero values in the given format.
+  SparseTensor(MLDataType elt_type,
+               const TensorShape& shape,
+               size_t nnz,
+               std::shared_ptr<IAllocator> allocator,
+               SparseFormat format);
+
   ~SparseTensor() = default;
 
   // For now, disallow all copy, assignment, and move.
@@ -39,14 +65,32 @@ class SparseTensor final {
   // Returns the number of entries in the values tensor (aka "NNZ" or "number of nonzero values")
   size_t NumValues() const { return static_cast<size_t>(values_.Shape().Size()); }
 
+  SparseFormat Format() const {
+    return format_;
+  }
+
   const Tensor& Values() const {
     return values_;
   }
 
+  // COO format only
   const Tensor& Indices() const {
+    ORT_ENFORCE(format_ == SparseFormat::kCoo, "Indices() is only valid for a COO format sparse tensor");
+    return indices_;
+  }
+
+  // CSR format only
+  const Tensor& InnerIndices() const {
+    ORT_ENFORCE(format_ == SparseFormat::kCsr, "InnerIndices() is only valid for a CSR format sparse tensor");
     return indices_;
   }
 
+  // CSR format only
+  const Tensor& OuterIndices() const {
+    ORT_ENFORCE(format_ == SparseFormat::kCsr, "OuterIndices() is only valid for a CSR format sparse tensor");
+    return outer_indices_;
+  }
+
   const TensorShape& Shape() const {
     return shape_;
   }
@@ -56,17 +100,32 @@ class SparseTensor final {
   }
 
   Tensor& MutableIndices() {
+    ORT_ENFORCE(format_ == SparseFormat::kCoo, "MutableIndices() is only valid for a COO format sparse tensor");
+    return indices_;
+  }
+
+  Tensor& MutableInnerIndices() {
+    ORT_ENFORCE(format_ == SparseFormat::kCsr, "MutableInnerIndices() is only valid for a CSR format sparse tensor");
     return indices_;
   }
 
+  Tensor& MutableOuterIndices() {
+    ORT_ENFORCE(format_ == SparseFormat::kCsr, "MutableOuterIndices() is only valid for a CSR format sparse tensor");
+    return outer_indices_;
+  }
+
   //TensorShape& MutableShape() {
   //  return shape_;
   //}
 
  private:
   Tensor values_;
+  // COO: [NNZ, dims] coordinates. CSR: [NNZ] inner (column) indices.
   Tensor indices_;
+  // CSR: [rows + 1] outer indices. Empty for COO.
+  Tensor outer_indices_;
   TensorShape shape_;  // The shape of corresponding dense-tensor.
+  SparseFormat format_ = SparseFormat::kCoo;
 };
 
 }  // namespace onnxruntime
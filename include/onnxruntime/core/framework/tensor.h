@@ -195,6 +195,21 @@ class Tensor final {
     shape_ = new_shape;
   }
 
+  /**
+   * Changes the shape of the tensor as long as the new shape fits within the capacity of the
+   * underlying buffer. The element count may differ from the current shape, which allows a
+   * buffer sized for the maximum expected shape to be reused across runs with varying shapes.
+   * Not supported for string tensors as the number of constructed strings is fixed.
+   * @warning this function is NOT thread-safe.
+   */
+  common::Status SetShapeWithinCapacity(const TensorShape& new_shape);
+
+  /**
+   * The capacity in bytes of the underlying buffer, as determined by the shape the tensor was
+   * created with. Remains constant across SetShapeWithinCapacity calls.
+   */
+  size_t CapacityInBytes() const noexcept { return capacity_bytes_; }
+
   /**
    * Get the byte offset with respect to the p_data
    * @warning this is a temporary solution for reusing the buffer bigger than needed.
@@ -239,6 +254,7 @@ class Tensor final {
   const PrimitiveDataTypeBase* dtype_;
   OrtMemoryInfo alloc_info_;
   ptrdiff_t byte_offset_;
+  size_t capacity_bytes_;
 };
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <atomic>
 #include <iosfwd>
 #include <vector>
 #include <algorithm>
@@ -16,45 +17,56 @@ namespace onnxruntime {
 #pragma GCC diagnostic ignored "-Wnull-dereference"
 #endif
 #endif
-class TensorShape : private std::vector<int64_t> {
-  // TODO - Use a custom STL allocator to avoid heap allocations in the common case.
+class TensorShape {
   // We use negative numbers for unknown symbolic dimension. Each negative
   // number represents a unique symbolic dimension.
-  // Private inheritance is used to prevent ambiguity of element versus dimension size
+  //
+  // Shapes of rank <= kInlineDimCapacity are stored inline so constructing them never touches the
+  // heap, which covers effectively all real tensors. A std::vector representation is materialized
+  // the first time a caller asks for one (GetDims) and is the authoritative storage from then on;
+  // shapes of larger rank are materialized at construction.
  public:
+  // number of dimensions that can be held without a heap allocation
+  static constexpr size_t kInlineDimCapacity = 5;
+
   TensorShape() = default;
 
-  TensorShape(const TensorShape& /*other*/) = default;
-  TensorShape& operator=(const TensorShape& /*other*/) = default;
+  TensorShape(const TensorShape& other) { Assign(other.Data(), other.NumDimensions()); }
+  TensorShape& operator=(const TensorShape& other);
 
-  TensorShape(TensorShape&& /*other*/) = default;
-  TensorShape& operator=(TensorShape&& /*other*/) = default;
+  TensorShape(TensorShape&& other) noexcept;
+  TensorShape& operator=(TensorShape&& other) noexcept;
 
-  TensorShape(const std::vector<int64_t>& dims) : std::vector<int64_t>(dims) {}
+  TensorShape(const std::vector<int64_t>& dims) { Assign(dims.data(), dims.size()); }
 
-  TensorShape(std::vector<int64_t>&& dims) : std::vector<int64_t>(std::move(dims)) {}
+  // adopts the vector, so no copy is made regardless of rank
+  TensorShape(std::vector<int64_t>&& dims) : dims_vec_(std::move(dims)), materialized_(true) {}
 
-  TensorShape(const std::initializer_list<int64_t>& dims) : std::vector<int64_t>(dims) {}
+  TensorShape(const std::initializer_list<int64_t>& dims) { Assign(dims.begin(), dims.size()); }
 
-  TensorShape(const int64_t* dimension_sizes, size_t dimension_count);
+  TensorShape(const int64_t* dimension_sizes, size_t dimension_count) {
+    Assign(dimension_sizes, dimension_count);
+  }
 
-  TensorShape(const std::vector<int64_t>& dims, size_t start, size_t end);
+  TensorShape(const std::vector<int64_t>& dims, size_t start, size_t end) {
+    Assign(dims.data() + start, end - start);
+  }
 
   /**
      Return the dimension specified by <idx>.
   */
-  const int64_t& operator[](size_t idx) const {
-    return std::vector<int64_t>::operator[](static_cast<int>(idx));
-  }
+  const int64_t& operator[](size_t idx) const { return Data()[idx]; }
 
+  // writes go to whichever representation is active, so in-place dimension updates on an inline
+  // shape stay heap-free
   int64_t& operator[](size_t idx) {
-    return std::vector<int64_t>::operator[](static_cast<int>(idx));
+    return materialized_.load(std::memory_order_acquire) ? dims_vec_[idx] : inline_dims_[idx];
   }
 
   bool operator==(const TensorShape& other) const noexcept {
-    auto thisVector = static_cast<const std::vector<int64_t>*>(this);
-    auto otherVector = static_cast<const std::vector<int64_t>*>(&other);
-    return *thisVector == *otherVector;
+    size_t num_dims = NumDimensions();
+    return num_dims == other.NumDimensions() &&
+           (num_dims == 0 || memcmp(Data(), other.Data(), sizeof(int64_t) * num_dims) == 0);
   }
 
   bool operator!=(const TensorShape& other) const noexcept {
@@ -62,20 +74,24 @@ class TensorShape : private std::vector<int64_t> {
   }
 
   size_t NumDimensions() const noexcept {
-    return size();
+    return materialized_.load(std::memory_order_acquire) ? dims_vec_.size() : inline_size_;
   }
 
   /**
      Copy dims into an array with given size
   */
   void CopyDims(int64_t* dims, size_t num_dims) const {
-    memcpy(dims, data(), sizeof(value_type) * std::min(num_dims, NumDimensions()));
+    memcpy(dims, Data(), sizeof(int64_t) * std::min(num_dims, NumDimensions()));
   }
 
   /**
-     Return underlying vector representation.
+     Return underlying vector representation. Materializes (and caches) the vector for shapes that
+     are stored inline; the reference stays valid for the lifetime of this TensorShape.
   */
-  const std::vector<int64_t>& GetDims() const { return *this; }
+  const std::vector<int64_t>& GetDims() const {
+    if (!materialized_.load(std::memory_order_acquire)) Materialize();
+    return dims_vec_;
+  }
 
   /**
    * Return the total number of elements. Returns 1 for an empty (rank 0) TensorShape.
@@ -125,14 +141,33 @@ class TensorShape : private std::vector<int64_t> {
      empty shape or 1D shape (1) is regarded as scalar tensor
   */
   bool IsScalar() const {
-    size_t len = size();
+    size_t len = NumDimensions();
     return len == 0 || (len == 1 && operator[](0) == 1);
   }
 
-  static const TensorShape& ReinterpretBaseType(const std::vector<int64_t>& dimensions) {
-    static_assert(sizeof(TensorShape) == sizeof(std::vector<int64_t>), "Size of TensorShape prevents safe casting from vector");
-    return *static_cast<const TensorShape*>(&dimensions);
+  // Historically reinterpreted a std::vector as a TensorShape, which the inline-storage layout no
+  // longer permits. Now builds a shape, which stays heap-free for rank <= kInlineDimCapacity.
+  static TensorShape ReinterpretBaseType(const std::vector<int64_t>& dimensions) {
+    return TensorShape(dimensions);
   }
+
+ private:
+  // pointer to the active dimension storage
+  const int64_t* Data() const noexcept {
+    return materialized_.load(std::memory_order_acquire) ? dims_vec_.data() : inline_dims_;
+  }
+
+  // replace the dimensions, storing inline when they fit and this shape was never materialized.
+  // once materialized a shape stays materialized so references from GetDims remain valid.
+  void Assign(const int64_t* dims, size_t count);
+
+  // thread-safe one-time copy of the inline dims into dims_vec_
+  void Materialize() const;
+
+  int64_t inline_dims_[kInlineDimCapacity]{};
+  mutable std::vector<int64_t> dims_vec_;
+  size_t inline_size_{0};
+  mutable std::atomic<bool> materialized_{false};
 };
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <limits>
 #include <memory>
 #include <string>
@@ -43,6 +44,20 @@ struct NodeEdge;
 }  // namespace fbs
 }  // namespace experimental
 
+/** Hash/equality functors for containers keyed by pointers to name strings owned elsewhere
+(the single copy a NodeArg owns, or an interned copy in the Model's string pool), so name-keyed
+lookups store an 8 byte handle instead of duplicating the string. Equality compares contents,
+so lookups work with a pointer to any string holding the name, e.g. a caller's local. */
+struct StringPtrHash {
+  size_t operator()(const std::string* str) const noexcept { return std::hash<std::string>()(*str); }
+};
+
+struct StringPtrEqual {
+  bool operator()(const std::string* lhs, const std::string* rhs) const noexcept {
+    return lhs == rhs || *lhs == *rhs;
+  }
+};
+
 /**
 @class Node
 Class representing a node in the graph.
@@ -407,7 +422,7 @@ class Node {
 
 #if defined(ENABLE_ORT_FORMAT_LOAD)
   static Status LoadFromOrtFormat(const onnxruntime::experimental::fbs::Node& fbs_node, Graph& graph,
-                                  const logging::Logger& logger, std::unique_ptr<Node>& node);
+                                  const logging::Logger& logger, NodePtr& node);
 
   Status LoadFromOrtFormat(const onnxruntime::experimental::fbs::Node& fbs_node, const logging::Logger& logger);
   Status LoadEdgesFromOrtFormat(const onnxruntime::experimental::fbs::NodeEdge& fbs_node_edgs, const Graph& graph);
@@ -734,7 +749,7 @@ class Graph {
   /** Gets the mutable NodeArg with the provided name.
   @returns Pointer to NodeArg if found, nullptr if not. */
   NodeArg* GetNodeArg(const std::string& name) {
-    auto iter = node_args_.find(name);
+    auto iter = node_args_.find(&name);
     if (iter != node_args_.end()) {
       return iter->second.get();
     }
@@ -756,12 +771,15 @@ class Graph {
   @returns NodeArg reference.
   */
   NodeArg& GetOrCreateNodeArg(const std::string& name, const ONNX_NAMESPACE::TypeProto* p_arg_type) {
-    auto iter = node_args_.find(name);
+    auto iter = node_args_.find(&name);
     if (iter != node_args_.end()) {
       return *(iter->second);
     }
-    auto result = node_args_.insert(std::make_pair(name, onnxruntime::make_unique<NodeArg>(name, p_arg_type)));
-    return *(result.first->second);
+    auto new_arg = onnxruntime::make_unique<NodeArg>(name, p_arg_type);
+    NodeArg& node_arg = *new_arg;
+    // the NodeArg owns the only copy of the name; the map keys it by pointer
+    node_args_.insert(std::make_pair(&node_arg.Name(), std::move(new_arg)));
+    return node_arg;
   }
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -838,9 +856,21 @@ class Graph {
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
   /** Mark the Graph as needing Resolve() to be called.
-  This should be done after modifying any aspect of the Graph that changes the Nodes or relationships between them. */
+  This should be done after modifying any aspect of the Graph that changes the Nodes or relationships between them.
+  As there is no information about which nodes were affected, the next Resolve re-runs type/shape
+  inferencing for the whole graph. */
   Graph& SetGraphResolveNeeded() noexcept {
     graph_resolve_needed_ = true;
+    full_resolve_needed_ = true;
+    return *this;
+  }
+
+  /** Mark the Graph as needing Resolve() to be called due to a change to the given node.
+  The next Resolve only re-runs type/shape inferencing for the changed nodes and their downstream
+  consumers, provided no untracked (graph level) change forced a full resolve. */
+  Graph& SetGraphResolveNeeded(const Node& node) noexcept {
+    graph_resolve_needed_ = true;
+    nodes_needing_inference_.insert(node.Index());
     return *this;
   }
 
@@ -1090,13 +1120,17 @@ class Graph {
   virtual ~Graph();
 
 #if defined(ENABLE_ORT_FORMAT_LOAD)
+  // can_use_flatbuffer_for_initializers: initializers reference their payload in the flatbuffer
+  // directly instead of copying it, where the payload is suitably aligned. the caller must keep
+  // the flatbuffer bytes alive for the lifetime of the Graph.
   static common::Status LoadFromOrtFormat(
       const onnxruntime::experimental::fbs::Graph& fbs_graph, const Model& owning_model,
       const std::unordered_map<std::string, int>& domain_to_version,
 #if !defined(ORT_MINIMAL_BUILD)
       IOnnxRuntimeOpSchemaCollectionPtr schema_registry,
 #endif
-      const logging::Logger& logger, std::unique_ptr<Graph>& graph);
+      const logging::Logger& logger, std::unique_ptr<Graph>& graph,
+      bool can_use_flatbuffer_for_initializers = false);
 
   // deserialize a subgraph
   static Status LoadFromOrtFormat(const onnxruntime::experimental::fbs::Graph& fbs_graph,
@@ -1110,6 +1144,14 @@ class Graph {
   // Graph::LoadGraph All other access should be via the public API.
   friend class Model;
 
+  // This friendship relationship should only be used to read and populate the cached
+  // topological orderings. All other access should be via the public API.
+  friend class GraphViewer;
+
+  // This friendship relationship should only be used to invalidate the cached topological
+  // orderings and to allocate Node storage from the node arena.
+  friend class Node;
+
   Graph() = delete;
 
   // Create empty Graph instance to re-create from ORT format serialized data.
@@ -1160,6 +1202,14 @@ class Graph {
 
   Graph& GraphResolveNeeded(bool needed) noexcept {
     graph_resolve_needed_ = needed;
+    if (needed) {
+      // no information about what changed, so the next Resolve must be a full one
+      full_resolve_needed_ = true;
+    } else {
+      // Resolve completed: all tracked changes have been processed
+      full_resolve_needed_ = false;
+      nodes_needing_inference_.clear();
+    }
     return *this;
   }
 
@@ -1168,6 +1218,12 @@ class Graph {
     return *this;
   }
 
+  // Discard the cached topological orderings. Must be called whenever the node or edge
+  // structure changes, or when a node's execution priority is updated.
+  void InvalidateTopologicalOrderCache() const noexcept {
+    topological_order_cache_.valid = false;
+  }
+
   // During the Resolve of a Graph it is necessary to recursively descend into subgraphs (created from GraphProto
   // Node attributes in the Graph) if present.
   // The ResolveContext holds the collection of values for the current Graph instance, be it the main graph
@@ -1176,10 +1232,14 @@ class Graph {
   struct ResolveContext {
     ResolveContext() = default;
 
-    std::unordered_map<std::string, std::pair<Node*, int>> output_args;
-    std::unordered_set<std::string> inputs_and_initializers;
+    // keyed by pointers to strings the graph keeps alive (NodeArg-owned names, or names interned
+    // in the Model's string pool for owners that can be removed mid-resolve), so repeated
+    // Resolve calls index tens of thousands of names without copying any of them.
+    std::unordered_map<const std::string*, std::pair<Node*, int>, StringPtrHash, StringPtrEqual> output_args;
+    std::unordered_set<const std::string*, StringPtrHash, StringPtrEqual> inputs_and_initializers;
+    // owning, as the values are handed across graph boundaries to subgraphs
     std::unordered_set<std::string> outer_scope_node_args;
-    std::unordered_map<std::string, NodeIndex> node_name_to_index;
+    std::unordered_map<const std::string*, NodeIndex, StringPtrHash, StringPtrEqual> node_name_to_index;
     std::unordered_set<Node*> nodes_with_subgraphs;
 
     void Clear() {
@@ -1194,6 +1254,11 @@ class Graph {
     ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ResolveContext);
   };
 
+  // Intern a name into the owning model's string pool. The returned pointer stays valid for the
+  // life of the model, so it is safe to key resolve bookkeeping with even when the original
+  // owner of the name (an initializer, a node) is removed mid-resolve.
+  const std::string* InternString(const std::string& str) const;
+
   // Initialize all the graph inputs, initializers and outputs
   common::Status InitInputsInitializersOutputs();
 
@@ -1313,6 +1378,13 @@ class Graph {
   // GraphProto that provides storage for the ONNX proto types deserialized from a flexbuffer/flatbuffer
   ONNX_NAMESPACE::GraphProto deserialized_proto_data_;
 
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+  // initializers deserialized from an ORT format model may reference their payload in the
+  // flatbuffer directly instead of copying it. set before LoadFromOrtFormat populates the graph
+  // and inherited by subgraphs.
+  bool can_use_flatbuffer_for_initializers_ = false;
+#endif
+
   InitializedTensorSet name_to_initial_tensor_;
 
   std::unordered_set<std::reference_wrapper<const std::string>,
@@ -1325,9 +1397,26 @@ class Graph {
   std::vector<std::unique_ptr<onnxruntime::Function>> function_container_;
 #endif
 
+  // Backing storage for the graph's Node objects. Nodes are placement-new'd into contiguous
+  // fixed-size blocks, in creation order, so traversal touches adjacent memory instead of
+  // individually heap-allocated objects. Storage is only released when the graph is
+  // destroyed; the slots of removed nodes are not reused.
+  // Declared before <nodes_> so the storage outlives the owning pointers during destruction.
+  class NodeArena {
+   public:
+    // returns suitably aligned uninitialized storage for one Node
+    void* Allocate();
+
+   private:
+    static constexpr size_t kNodesPerBlock = 64;
+    std::vector<std::unique_ptr<uint8_t[]>> blocks_;
+    size_t used_in_last_block_ = kNodesPerBlock;
+  };
+  NodeArena node_arena_;
+
   // Graph nodes.
   // Element in <nodes_> may be nullptr due to graph optimization.
-  std::vector<std::unique_ptr<Node>> nodes_;
+  std::vector<NodePtr> nodes_;
 
   // Wrapper of Graph nodes to provide iteration services that hide nullptr entries
   GraphNodes iterable_nodes_{nodes_};
@@ -1341,11 +1430,34 @@ class Graph {
   // A flag indicates whether <*this> graph needs to be resolved.
   bool graph_resolve_needed_ = false;
 
+  // Whether the next Resolve must re-run type/shape inferencing for all nodes. Set by changes
+  // that have no node context; cleared when a Resolve completes. Starts as true so the initial
+  // Resolve after loading is always a full one.
+  bool full_resolve_needed_ = true;
+
+  // Nodes changed since the last Resolve. When only tracked (node level) changes occurred,
+  // Resolve limits type/shape inferencing to these nodes and their downstream consumers.
+  std::unordered_set<NodeIndex> nodes_needing_inference_;
+
   bool graph_proto_sync_needed_ = false;
 
   // The topological order of node index used to do node and op match verification temporarily.
   std::vector<NodeIndex> nodes_in_topological_order_;
 
+  // Cached results of the topological sorts a GraphViewer performs on construction.
+  // GraphViewer instances are created repeatedly over an unchanged graph during partitioning
+  // and transformer passes, so the orderings are computed once and re-used until the node or
+  // edge structure changes. Mutable as GraphViewer populates the cache via a const Graph.
+  struct TopologicalOrderCache {
+    bool valid = false;
+    std::vector<NodeIndex> nodes_in_topological_order;
+#if !defined(ORT_MINIMAL_BUILD)
+    std::vector<NodeIndex> nodes_in_topological_order_with_priority;
+#endif
+    std::vector<NodeIndex> root_nodes;
+  };
+  mutable TopologicalOrderCache topological_order_cache_;
+
   // Full list of graph inputs. Matches number and order of inputs in the GraphProto.
   std::vector<const NodeArg*> graph_inputs_including_initializers_;
   bool graph_inputs_manually_set_ = false;
@@ -1365,7 +1477,9 @@ class Graph {
   std::vector<const NodeArg*> value_info_;
 
   // All node args owned by <*this> graph. Key is node arg name.
-  std::unordered_map<std::string, std::unique_ptr<NodeArg>> node_args_;
+  // keyed by a pointer to the name the mapped NodeArg itself owns (see StringPtrHash), so each
+  // NodeArg name is stored once instead of once in the NodeArg and once in the map key.
+  std::unordered_map<const std::string*, std::unique_ptr<NodeArg>, StringPtrHash, StringPtrEqual> node_args_;
 
 #if !defined(ORT_MINIMAL_BUILD)
   int name_generator_ = 0;
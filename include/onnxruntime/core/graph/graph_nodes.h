@@ -11,6 +11,17 @@ namespace onnxruntime {
 
 class Node;
 
+/**
+Destroys a Node that was placement-new'd into the owning Graph's node arena. Only the
+destructor runs here; the arena releases the underlying storage when the Graph is destroyed.
+*/
+struct NodeArenaDeleter {
+  void operator()(Node* node) const noexcept;
+};
+
+/** Owning handle to a Node whose storage lives in the owning Graph's node arena. */
+using NodePtr = std::unique_ptr<Node, NodeArenaDeleter>;
+
 /**
 Class to filter out null entries from either a vector of unique_ptr<Node> or a vector of [const] Node* and
 provide an iterator interface that returns [const] Node& for the valid entries.
@@ -161,19 +172,19 @@ class ValidNodes {
 /**
 Class that provides iteration over all valid nodes in the Graph.
 */
-class GraphNodes : public ValidNodes<std::vector<std::unique_ptr<Node>>> {
+class GraphNodes : public ValidNodes<std::vector<NodePtr>> {
  public:
-  GraphNodes(std::vector<std::unique_ptr<Node>>& nodes) : ValidNodes(nodes) {
+  GraphNodes(std::vector<NodePtr>& nodes) : ValidNodes(nodes) {
   }
 };
 
 // Variant that only ever allows const access to nodes and optionally allows filtering of the nodes.
-class ConstGraphNodes : public ValidNodes<const std::vector<std::unique_ptr<Node>>> {
+class ConstGraphNodes : public ValidNodes<const std::vector<NodePtr>> {
  public:
-  ConstGraphNodes(const std::vector<std::unique_ptr<Node>>& nodes) : ValidNodes(nodes) {
+  ConstGraphNodes(const std::vector<NodePtr>& nodes) : ValidNodes(nodes) {
   }
 
-  ConstGraphNodes(const std::vector<std::unique_ptr<Node>>& nodes,
+  ConstGraphNodes(const std::vector<NodePtr>& nodes,
                   GraphNodes::NodeFilterFunc&& filter_func)
       : ValidNodes(nodes, std::move(filter_func)) {
   }
@@ -7,6 +7,8 @@
 #include "core/common/status.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/platform/ort_mutex.h"
+#include <atomic>
+#include <functional>
 #include <mutex>
 #include <deque>
 #include "sstream"
@@ -124,6 +126,19 @@ class SchemaRegistryManager : public onnxruntime::IOnnxRuntimeOpSchemaCollection
   */
   void RegisterRegistry(std::shared_ptr<IOnnxRuntimeOpSchemaCollection> registry);
 
+  /**
+  Sets a callback that performs the full op schema registration the first time schemas are
+  actually looked up.
+  @remarks Materializing every built-in and contributed schema is expensive, and sessions that
+  only load ORT format models never consult them. Deferring the registration keeps process
+  startup cheap for such sessions while ONNX model loading transparently triggers it on the
+  first schema query.
+  */
+  static void SetDeferredRegistrationFn(std::function<void()> fn);
+
+  /** Runs the deferred schema registration callback if one was set and has not run yet. */
+  static void EnsureDeferredRegistration();
+
   /** Gets the latest opset versions.
   @param is_onnx_only If true, return the latest ONNX schemas. If false, return the latest schemas for all domains.
   */
@@ -167,8 +167,14 @@ class ExtendedThreadPoolInterface : public Eigen::ThreadPoolInterface {
   // Start/end a parallel section, within which calls to
   // RunInParallelSection may be made.  Parallel sections are
   // non-nesting.
+  //
+  // A section started with high_priority==true has its tasks pushed
+  // to the workers' high-priority queues, which are drained ahead of
+  // the regular queues.  This lets a latency-critical caller's loop
+  // shards overtake shards from normal-priority callers that are
+  // queued but not yet running on a shared pool.
   virtual std::unique_ptr<ThreadPoolParallelSection, void(*)(ThreadPoolParallelSection*)> AllocateParallelSection() = 0;
-  virtual void StartParallelSection(ThreadPoolParallelSection &ps) = 0;
+  virtual void StartParallelSection(ThreadPoolParallelSection &ps, bool high_priority) = 0;
   virtual void EndParallelSection(ThreadPoolParallelSection &ps) = 0;
 
   // Run fn with up to n degree-of-parallelism enlisting the thread
@@ -200,7 +206,7 @@ class ExtendedThreadPoolInterface : public Eigen::ThreadPoolInterface {
   // [ Note that this 20% overhead is more than paid for when we have
   // two loops execute in series in a parallel section. ]
   virtual void RunInParallel(std::function<void(unsigned idx)> fn,
-                             unsigned n) = 0;
+                             unsigned n, bool high_priority) = 0;
 };
 
 
@@ -213,6 +219,11 @@ class ThreadPoolParallelSection {
   // maximum degree of parallelism that the section will support.
   std::vector<std::pair<int,unsigned>> tasks;
 
+  // Whether the section was started by a high-priority caller.  Its
+  // tasks are pushed to the workers' high-priority queues, and revoked
+  // from there on exit.
+  bool high_priority{false};
+
   // State shared between the main thread and worker threads
   // -------------------------------------------------------
 
@@ -598,6 +609,13 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
 
   typedef std::function<void()> Task;
   typedef RunQueue<Task, Tag, 1024> Queue;
+
+  // Per-worker queue for tasks from high-priority parallel sections.  Workers drain this
+  // queue (and steal from it) ahead of the regular queue, so shards from a high-priority
+  // caller overtake queued shards from normal-priority callers sharing the pool.  It is
+  // smaller than the regular queue: only the strict-priority class uses it, and overflow
+  // simply falls back to running the shard in the submitting thread.
+  typedef RunQueue<Task, Tag, 256> HighPriorityQueue;
 #ifdef _WIN32
   using CHAR_TYPE = wchar_t;
 #else
@@ -608,6 +626,7 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
       : env_(env),
         num_threads_(num_threads),
         allow_spinning_(allow_spinning),
+        spin_loop_iterations_(thread_options.spin_loop_iterations),
         set_denormal_as_zero_(thread_options.set_denormal_as_zero),
         worker_data_(num_threads),
         all_coprimes_(num_threads),
@@ -651,6 +670,7 @@ class ThreadPoolTempl : public onnxruntime::concurrency::ExtendedThreadPoolInter
       // Since we were cancelled, there might be entries in the queues.
       // Empty them to prevent their destructor from asserting.
       for (size_t i = 0; i < worker_data_.size(); i++) {
+        worker_data_[i].hp_queue.Flush();
         worker_data_[i].queue.Flush();
       }
     }
@@ -774,19 +794,21 @@ std::unique_ptr<ThreadPoolParallelSection, void(*)(ThreadPoolParallelSection*)>
 // section, being re-used over subsequent loops.
 
 void StartParallelSectionInternal(PerThread &pt,
-                                  ThreadPoolParallelSection &ps) {
+                                  ThreadPoolParallelSection &ps,
+                                  bool high_priority) {
   assert((!pt.leading_par_section) && "Nested parallelism not supported");
   assert((!ps.active) && "Starting parallel section, but active already");
   pt.leading_par_section = true;
   if (!pt.tag.Get()) {
     pt.tag = Tag::GetNext();
   }
+  ps.high_priority = high_priority;
   ps.active = true;
 }
 
-void StartParallelSection(ThreadPoolParallelSection &ps) override {
+void StartParallelSection(ThreadPoolParallelSection &ps, bool high_priority) override {
   PerThread* pt = GetPerThread();
-  StartParallelSectionInternal(*pt, ps);
+  StartParallelSectionInternal(*pt, ps, high_priority);
 }
 
 // End a parallel section, waiting for all worker threads to exit from
@@ -808,8 +830,10 @@ void EndParallelSectionInternal(PerThread &pt,
   unsigned tasks_revoked = 0;
   while (!ps.tasks.empty()) {
     const auto& item = ps.tasks.back();
-    Queue& q = worker_data_[item.first].queue;
-    if (q.RevokeWithTag(pt.tag, item.second)) {
+    WorkerData& td = worker_data_[item.first];
+    bool revoked = ps.high_priority ? td.hp_queue.RevokeWithTag(pt.tag, item.second)
+                                    : td.queue.RevokeWithTag(pt.tag, item.second);
+    if (revoked) {
       tasks_revoked++;
     }
     ps.tasks.pop_back();
@@ -907,9 +931,12 @@ void SummonWorkers(PerThread &pt,
       // in a parallel loop we will always be running work on the
       // main thread, providing progress.
       WorkerData& td = worker_data_[q_idx];
-      Queue& q = td.queue;
       unsigned w_idx;
-      t = q.PushBackWithTag(call_worker_fn, pt.tag, w_idx);
+      if (ps.high_priority) {
+        t = td.hp_queue.PushBackWithTag(call_worker_fn, pt.tag, w_idx);
+      } else {
+        t = td.queue.PushBackWithTag(call_worker_fn, pt.tag, w_idx);
+      }
       if (!t) {
         ps.tasks.push_back({q_idx, w_idx});
         td.EnsureAwake();
@@ -969,10 +996,10 @@ void RunInParallelSection(ThreadPoolParallelSection &ps,
 // special case of RunInParallelSection, avoiding code paths for
 // handing off multiple loops to the pool of workers.
 
-void RunInParallel(std::function<void(unsigned idx)> fn, unsigned n) override {
+void RunInParallel(std::function<void(unsigned idx)> fn, unsigned n, bool high_priority) override {
   PerThread *pt = GetPerThread();
   ThreadPoolParallelSection ps;
-  StartParallelSectionInternal(*pt, ps);
+  StartParallelSectionInternal(*pt, ps, high_priority);
 
   // Summon workers to run the function (n is the desired maximum
   // degree of parallelism, including the main thread).  Unlike the
@@ -1019,6 +1046,24 @@ int CurrentThreadId() const EIGEN_FINAL {
   return -1;
 }
 
+// Sums of the cumulative per-worker activity counters: work items run by the workers (for
+// a parallel loop each worker's participation in the loop is one work item; work run
+// inline on the thread entering the loop is not included), work items successfully stolen
+// from another worker's queue, and the number of times a worker gave up spinning and
+// blocked waiting for work.  Differencing two snapshots gives the pool activity
+// attributable to the region between them.
+void GetStats(uint64_t& tasks_executed, uint64_t& steals, uint64_t& blocks) const {
+  tasks_executed = 0;
+  steals = 0;
+  blocks = 0;
+  for (size_t i = 0; i < worker_data_.size(); ++i) {
+    const WorkerData& td = worker_data_[i];
+    tasks_executed += td.num_tasks.load(std::memory_order_relaxed);
+    steals += td.num_steals.load(std::memory_order_relaxed);
+    blocks += td.num_blocks.load(std::memory_order_relaxed);
+  }
+}
+
  private:
 
 #ifdef NDEBUG
@@ -1077,10 +1122,18 @@ int CurrentThreadId() const EIGEN_FINAL {
                 "Per-thread state should be trivially destructible");
 
   struct WorkerData {
-    constexpr WorkerData() : thread(), queue() {
+    constexpr WorkerData() : thread(), queue(), hp_queue() {
     }
     std::unique_ptr<Thread> thread;
     Queue queue;
+    HighPriorityQueue hp_queue;
+
+    // Cumulative activity counters, updated only by the owning worker.  Relaxed atomics
+    // let GetStats read them from other threads without locking; the reads are racy with
+    // respect to running workers by design as the totals are for reporting only.
+    std::atomic<uint64_t> num_tasks{0};
+    std::atomic<uint64_t> num_steals{0};
+    std::atomic<uint64_t> num_blocks{0};
 
     // Each thread has a status, available read-only without locking, and protected
     // by the mutex field below for updates.  The status is used for three
@@ -1171,6 +1224,7 @@ int CurrentThreadId() const EIGEN_FINAL {
   Environment& env_;
   const int num_threads_;
   const bool allow_spinning_;
+  const int spin_loop_iterations_;
   const bool set_denormal_as_zero_;
   Eigen::MaxSizeVector<WorkerData> worker_data_;
   Eigen::MaxSizeVector<Eigen::MaxSizeVector<unsigned>> all_coprimes_;
@@ -1201,10 +1255,19 @@ int CurrentThreadId() const EIGEN_FINAL {
   }
 
   // Main worker thread loop.
+  // Pop work from a worker's own queues, draining the high-priority queue ahead of the
+  // regular one so queued normal-priority shards wait behind high-priority shards.
+  Task PopLocal(WorkerData& td) {
+    Task t = td.hp_queue.PopFront();
+    if (!t) {
+      t = td.queue.PopFront();
+    }
+    return t;
+  }
+
   void WorkerLoop(int thread_id) {
     PerThread* pt = GetPerThread();
     WorkerData& td = worker_data_[thread_id];
-    Queue& q = td.queue;
     bool should_exit = false;
     pt->pool = this;
     pt->rand = GlobalThreadIdHash();
@@ -1214,13 +1277,16 @@ int CurrentThreadId() const EIGEN_FINAL {
     SetGoodWorkerHint(thread_id, true /* Is good */);
 
     const int log2_spin = 20;
-    const int spin_count = allow_spinning_ ? (1ull<<log2_spin) : 0;
-    const int steal_count = spin_count/100;
+    const int default_spin = 1ull << log2_spin;
+    const int configured_spin = spin_loop_iterations_ >= 0 ? spin_loop_iterations_ : default_spin;
+    const int spin_count = allow_spinning_ ? configured_spin : 0;
+    // keep the steal interval non-zero for small configured spin bounds
+    const int steal_count = spin_count < 100 ? 1 : spin_count / 100;
 
     SetDenormalAsZero(set_denormal_as_zero_);
 
     while (!cancelled_ && !should_exit) {
-        Task t = q.PopFront();
+        Task t = PopLocal(td);
         if (!t) {
           // Spin waiting for work.  We indicate, via SetGOodWorkerHint that we are
           // spinning.  This will bias other threads toward pushing work to our queue.
@@ -1229,7 +1295,7 @@ int CurrentThreadId() const EIGEN_FINAL {
 
           SetGoodWorkerHint(thread_id, true);
           for (int i = 0; i < spin_count && !t && !cancelled_ && !done_; i++) {
-            t = ((i+1)%steal_count == 0) ? TrySteal() : q.PopFront();
+            t = ((i+1)%steal_count == 0) ? TrySteal() : PopLocal(td);
             onnxruntime::concurrency::SpinPause();
           }
           SetGoodWorkerHint(thread_id, false);
@@ -1251,7 +1317,10 @@ int CurrentThreadId() const EIGEN_FINAL {
                     if (victim != -1) {
                       should_block = false;
                       if (!cancelled_) {
-                        t = worker_data_[victim].queue.PopBack();
+                        t = worker_data_[victim].hp_queue.PopBack();
+                        if (!t) {
+                          t = worker_data_[victim].queue.PopBack();
+                        }
                       }
                     }
                     // Number of blocked threads is used as termination condition.
@@ -1284,6 +1353,7 @@ int CurrentThreadId() const EIGEN_FINAL {
                   // Post-block update (executed only if we blocked)
                   [&]() {
                     blocked_--;
+                    td.num_blocks.fetch_add(1, std::memory_order_relaxed);
                   });
             }
           }
@@ -1291,6 +1361,7 @@ int CurrentThreadId() const EIGEN_FINAL {
         if (t) {
           td.SetActive();
           t();
+          td.num_tasks.fetch_add(1, std::memory_order_relaxed);
           td.SetSpinning();
         }
       }
@@ -1327,8 +1398,13 @@ int CurrentThreadId() const EIGEN_FINAL {
         assert(victim < size);
         if (round == 1 ||
             worker_data_[victim].GetStatus() == WorkerData::ThreadStatus::Active) {
-          Task t = worker_data_[victim].queue.PopBack();
+          Task t = worker_data_[victim].hp_queue.PopBack();
+          if (!t) {
+            t = worker_data_[victim].queue.PopBack();
+          }
           if (t) {
+            // Steal is only called from workers of this pool, so thread_id is valid here
+            worker_data_[pt->thread_id].num_steals.fetch_add(1, std::memory_order_relaxed);
             return t;
           }
         }
@@ -1356,7 +1432,8 @@ int CurrentThreadId() const EIGEN_FINAL {
     unsigned inc = all_coprimes_[size - 1][r % all_coprimes_[size - 1].size()];
     unsigned victim = r % size;
     for (unsigned i = 0; i < size; i++) {
-      if (!worker_data_[victim].queue.Empty()) {
+      if (!worker_data_[victim].hp_queue.Empty() ||
+          !worker_data_[victim].queue.Empty()) {
         return victim;
       }
       victim += inc;
@@ -16,6 +16,7 @@ limitations under the License.
 /* Modifications Copyright (c) Microsoft. */
 
 #pragma once
+#include <chrono>
 #include <string>
 #include <vector>
 #include <functional>
@@ -134,6 +135,7 @@ template <typename Environment>
 class ThreadPoolTempl;
 
 class ExtendedThreadPoolInterface;
+class LoopCostCalibrator;
 class LoopCounter;
 class ThreadPoolParallelSection;
 
@@ -163,6 +165,80 @@ class ThreadPool {
   // set of threads.
   ~ThreadPool();
 
+  // Enable runtime calibration of loop costs for this pool. Calibrated loops record their
+  // measured per-iteration cost, keyed by the kernel's static TensorOpCost estimate and a
+  // power-of-two bucket of the iteration count. Once a loop signature has been measured a few
+  // times, the measurement replaces the static guess when deciding whether the loop is worth
+  // parallelizing at all and how coarsely to shard it. Must be called before the pool is used
+  // to run loops; it is not safe to enable concurrently with running work.
+  void EnableCostCalibration();
+
+  // Cumulative activity counters for the pool's worker threads.
+  struct PoolStats {
+    // work items run by the workers. For a parallel loop each worker's participation in the
+    // loop counts as one work item; work run inline on the thread entering the loop is not
+    // included.
+    uint64_t tasks_executed{0};
+    // work items successfully stolen from another worker's queue
+    uint64_t steals{0};
+    // times a worker gave up spinning and blocked waiting for work
+    uint64_t blocks{0};
+  };
+
+  // Snapshot of the cumulative activity counters. Taking a snapshot before and after a region
+  // and differencing the two gives the pool activity attributable to that region. Returns
+  // zeroed stats for a null pool or one wrapping a user-provided implementation. The counters
+  // are read without locking, so a snapshot taken while workers are running is approximate.
+  static PoolStats GetStats(const ThreadPool* tp);
+
+  // Cooperative cancellation of parallel loops. A run that should stop consuming cores once
+  // it is abandoned installs a checkpoint on the thread that invokes its kernels. Parallel
+  // loops snapshot the checkpoint of the thread that starts them, and the block-claiming
+  // loops consult it so that both the initiating thread and the workers helping it stop
+  // claiming further blocks once the terminate flag is raised or the deadline passes. The
+  // loop then finishes early with incomplete results; the caller is expected to discard the
+  // run's output, which the executors do by reporting the run as terminated at the next node
+  // boundary. The terminate flag is checked per block; for single-iteration blocks the
+  // deadline is only checked every kBlocksPerDeadlineCheck blocks to keep clock reads out
+  // of fine-grained loops.
+  struct CancellationCheckpoint {
+    const bool* terminate = nullptr;  // typically points at RunOptions.terminate
+    std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max();
+
+    bool Cancelled() const {
+      return (terminate != nullptr && *terminate) ||
+             (deadline != std::chrono::steady_clock::time_point::max() &&
+              std::chrono::steady_clock::now() >= deadline);
+    }
+  };
+
+  static constexpr unsigned kBlocksPerDeadlineCheck = 64;
+
+  // Install the cancellation checkpoint for the calling thread, returning the previously
+  // installed one so nested scopes (e.g. subgraph execution) can restore it on exit.
+  static CancellationCheckpoint SetThreadCancellationCheckpoint(const CancellationCheckpoint& checkpoint);
+
+  // The cancellation checkpoint installed on the calling thread, default-constructed if none.
+  static const CancellationCheckpoint& GetThreadCancellationCheckpoint();
+
+  // Scheduling priority class for work submitted by the calling thread. This matters when
+  // several sessions share one intra-op thread pool (pools created via Env::CreateThreadPool):
+  // parallel loops started under kHigh push their shards to the workers' high-priority queues,
+  // which are drained ahead of the regular queues. A latency-critical session therefore waits
+  // only for shards that are already running, not for every batch shard queued ahead of it.
+  // Priority is strict at shard granularity; running shards are never interrupted.
+  enum class SchedulingPriority : uint8_t {
+    kNormal = 0,
+    kHigh = 1,
+  };
+
+  // Install the scheduling priority for the calling thread, returning the previously installed
+  // one so nested scopes (e.g. subgraph execution) can restore it on exit.
+  static SchedulingPriority SetThreadSchedulingPriority(SchedulingPriority priority);
+
+  // The scheduling priority installed on the calling thread, kNormal if none.
+  static SchedulingPriority GetThreadSchedulingPriority();
+
   // Start and end a multi-loop parallel section.  Parallel loops can
   // be executed directly (without using this API), but entering a
   // parallel section allows the runtime system to amortize loop
@@ -421,6 +497,12 @@ class ThreadPool {
   void ParallelFor(std::ptrdiff_t total, const TensorOpCost& cost_per_unit,
                    const std::function<void(std::ptrdiff_t first, std::ptrdiff_t)>& fn);
 
+  // ParallelFor body used when cost calibration is enabled: consults the calibrator for a
+  // measured per-iteration cost and falls back to the static-cost policy (while measuring)
+  // until the loop signature has been calibrated.
+  void ParallelForCalibrated(std::ptrdiff_t total, const TensorOpCost& cost_per_unit,
+                             const std::function<void(std::ptrdiff_t first, std::ptrdiff_t)>& fn);
+
   void SimpleParallelFor(std::ptrdiff_t total, const std::function<void(std::ptrdiff_t)>& fn);
 
   void Schedule(std::function<void()> fn);
@@ -435,6 +517,9 @@ class ThreadPool {
 
   // If used, underlying_threadpool_ is instantiated and owned by the ThreadPool.
   std::unique_ptr<ThreadPoolTempl<Env> > extended_eigen_threadpool_;
+
+  // Non-null iff EnableCostCalibration has been called; see ParallelForCalibrated.
+  std::unique_ptr<LoopCostCalibrator> cost_calibrator_;
 };
 
 }  // namespace concurrency
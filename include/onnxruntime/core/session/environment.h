@@ -13,6 +13,7 @@
 
 struct OrtThreadingOptions;
 namespace onnxruntime {
+class SharedWeightCache;
 /** TODO: remove this class
    Provides the runtime environment for onnxruntime.
    Create one instance for the duration of execution.
@@ -74,6 +75,15 @@ class Environment {
     return shared_allocators_;
   }
 
+  /**
+   * Returns the store of initialized tensors shared between sessions created for the same model.
+  */
+  SharedWeightCache& GetSharedWeightCache() const {
+    return *shared_weight_cache_;
+  }
+
+  ~Environment();
+
  private:
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(Environment);
 
@@ -87,5 +97,6 @@ class Environment {
   std::unique_ptr<onnxruntime::concurrency::ThreadPool> inter_op_thread_pool_;
   bool create_global_thread_pools_{false};
   std::vector<AllocatorPtr> shared_allocators_;
+  std::unique_ptr<SharedWeightCache> shared_weight_cache_;
 };
 }  // namespace onnxruntime
@@ -170,6 +170,7 @@ ORT_RUNTIME_CLASS(ModelMetadata);
 ORT_RUNTIME_CLASS(ThreadPoolParams);
 ORT_RUNTIME_CLASS(ThreadingOptions);
 ORT_RUNTIME_CLASS(ArenaCfg);
+ORT_RUNTIME_CLASS(ValuePool);
 
 #ifdef _WIN32
 typedef _Return_type_success_(return == 0) OrtStatus* OrtStatusPtr;
@@ -206,6 +207,12 @@ typedef void(ORT_API_CALL* OrtLoggingFunction)(
     void* param, OrtLoggingLevel severity, const char* category, const char* logid, const char* code_location,
     const char* message);
 
+// Callback for RunAsync. Invoked from an inter-op pool thread when the run completes.
+// 'outputs' is the array passed to RunAsync with the fetched values filled in on success,
+// 'status' is nullptr on success, otherwise an OrtStatus the callback must release.
+typedef void(ORT_API_CALL* RunAsyncCallbackFn)(void* user_data, OrtValue** outputs, size_t num_outputs,
+                                               OrtStatusPtr status);
+
 // Set Graph optimization level.
 // Refer https://github.com/microsoft/onnxruntime/blob/master/docs/ONNX_Runtime_Graph_Optimizations.md
 // for in-depth undersrtanding of Graph Optimizations in ORT
@@ -350,6 +357,12 @@ struct OrtApi {
   ORT_API2_STATUS(CreateSessionFromArray, _In_ const OrtEnv* env, _In_ const void* model_data, size_t model_data_length,
                   _In_ const OrtSessionOptions* options, _Outptr_ OrtSession** out);
 
+  /**
+   * \param output entries may be nullptr, in which case ORT allocates the output and returns a
+   * new OrtValue, or pre-created tensor OrtValues (e.g. from CreateTensorWithDataAsOrtValue
+   * over caller-owned buffers) that are filled in place, avoiding output allocation on the
+   * plain Run path without needing IoBinding.
+   */
   ORT_API2_STATUS(Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
                   _In_reads_(input_len) const char* const* input_names,
                   _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
@@ -1179,6 +1192,78 @@ struct OrtApi {
    * Get the current device id of the GPU execution provider (cuda/tensorrt/rocm).
    */
   ORT_API2_STATUS(GetCurrentGpuDeviceId, _In_ int* device_id);
+
+  /**
+   * Release memory that the arena based allocators of the session's execution providers are
+   * holding but no longer using, e.g. arena regions grown while serving an unusually large
+   * request. Intended to be called between traffic peaks in long-running services.
+   * Safe to call concurrently with Run, which may grow the arenas again.
+   * \param session the session whose memory arenas should be shrunk
+   */
+  ORT_API2_STATUS(ShrinkSessionMemoryArenas, _Inout_ OrtSession* session);
+
+  /**
+   * Run the model asynchronously. The run is enqueued onto the session's inter-op thread pool
+   * and 'run_async_callback' is invoked from a pool thread when it completes, so callers do not
+   * need to block a thread per in-flight request. The input/output name and value arrays must
+   * stay valid until the callback fires. Fails if no inter-op thread pool with more than one
+   * thread is available (see SetIntraOpNumThreads/SetGlobalInterOpNumThreads).
+   * \param output entries may be nullptr (ORT allocates) or pre-created OrtValues to be filled in
+   */
+  ORT_API2_STATUS(RunAsync, _Inout_ OrtSession* session, _In_opt_ const OrtRunOptions* run_options,
+                  _In_reads_(input_len) const char* const* input_names,
+                  _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                  _In_reads_(output_names_len) const char* const* output_names, size_t output_names_len,
+                  _Inout_updates_all_(output_names_len) OrtValue** output,
+                  _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data);
+
+  /**
+   * Create a pool that recycles OrtValue tensor wrappers. The pool only manages the wrapper
+   * objects; it never owns or touches the underlying data buffers. Thread-safe.
+   */
+  ORT_API2_STATUS(CreateValuePool, _Outptr_ OrtValuePool** out);
+
+  /**
+   * Same as CreateTensorWithDataAsOrtValue, but re-uses a wrapper previously handed back via
+   * ReleaseValueToPool when one is available, so a steady-state request performs no heap
+   * allocation for the wrapper. The returned value is released with either ReleaseValueToPool
+   * (to enable re-use) or ReleaseValue, and must not be used after the pool is released if it
+   * was handed back.
+   */
+  ORT_API2_STATUS(CreateTensorWithDataAsPooledOrtValue, _Inout_ OrtValuePool* pool,
+                  _In_ const OrtMemoryInfo* info, _Inout_ void* p_data, size_t p_data_len,
+                  _In_ const int64_t* shape, size_t shape_len, ONNXTensorElementDataType type,
+                  _Outptr_ OrtValue** out);
+
+  /**
+   * Hand a tensor OrtValue back to the pool for re-use instead of freeing it. Accepts any
+   * tensor OrtValue, including outputs returned by Run; whatever buffer the tensor references
+   * stays alive until the wrapper is re-used or the pool is released.
+   */
+  ORT_API2_STATUS(ReleaseValueToPool, _Inout_ OrtValuePool* pool, _In_ OrtValue* value);
+
+  ORT_CLASS_RELEASE(ValuePool);
+
+  /**
+   * Set the maximum wall clock time in milliseconds a Run using these options may take,
+   * measured from the start of the Run call. Once exceeded the run is cooperatively
+   * cancelled: parallel loops inside kernels stop claiming work and the run fails at the
+   * next node boundary, like a run stopped via RunOptionsSetTerminate. Pass 0 (the default)
+   * for no limit.
+   */
+  ORT_API2_STATUS(RunOptionsSetTimeout, _Inout_ OrtRunOptions* options, int64_t timeout_in_ms);
+
+  /**
+   * Get the sampled per-node timing counters as a CSV report, one row per node:
+   * node_name,op_type,provider,sampled_runs,cumulative_ns. Requires the session config entry
+   * "session.node_timing_sample_interval" to have been set to a value >= 1 when the session was
+   * created; with an interval of N, one in every N Run calls is timed, so the counters can stay
+   * enabled in production, unlike full profiling.
+   * \param out a null terminated string of the report. The caller is responsible for freeing it
+   * using the given allocator.
+   */
+  ORT_API2_STATUS(SessionGetNodeTimingStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                  _Outptr_ char** out);
 };
 
 /*
@@ -46,3 +46,155 @@ static const char* const kOrtSessionOptionsConfigSetDenormalAsZero = "session.se
 // "1": enable. ORT does fusion logic for QDQ format.
 // Its default value is "1"
 static const char* const kOrtSessionOptionsEnableQuantQDQ = "session.enable_quant_qdq";
+
+// If the config value is set to "1", initializers stored in external data files are memory-mapped
+// into the process instead of being copied into buffers owned by the session, provided the
+// initializer is planned on CPU. The mapping is page-cache backed, so identical models loaded in
+// multiple processes share the physical pages and session creation avoids reading the whole file.
+// The default is "0" (read into session-owned buffers).
+static const char* const kOrtSessionOptionsUseMmapExternalData = "session.use_mmap_external_data";
+
+// If the config value is set to "1", constant initializers planned on CPU are published to (and
+// looked up from) an Environment level cache keyed by the model path, so multiple sessions created
+// for the same model in one process share a single copy of the weights. The cached tensors stay
+// alive for the lifetime of the environment. The default is "0".
+static const char* const kOrtSessionOptionsCrossSessionWeightSharing = "session.cross_session_weight_sharing";
+
+// Set to "1" to use the ORT format model bytes passed to CreateSessionFromArray directly instead of copying them.
+// The caller must guarantee the bytes stay valid until session initialization is complete. The default is "0".
+static const char* const kOrtSessionOptionsConfigUseORTModelBytesDirectly = "session.use_ort_model_bytes_directly";
+
+// If the config value is set to "1", initializers in an ORT format model whose payload is
+// 64-byte aligned in the flatbuffer (guaranteed for models serialized by this ORT version) are
+// used in place from the model buffer instead of being copied into session-owned memory, making
+// session creation for a memory-mapped ORT format model essentially copy-free. The model bytes
+// are kept alive for the session's lifetime; when combined with
+// "session.use_ort_model_bytes_directly" the caller must extend that guarantee to the lifetime
+// of the session. The default is "0".
+static const char* const kOrtSessionOptionsUseOrtModelBytesForInitializers = "session.use_ort_model_bytes_for_initializers";
+
+// Directory used to cache the optimized graph between process starts. On the first load of a model
+// the optimized graph is serialized in ORT format to this directory; later sessions whose model
+// file, execution providers, optimization level and ORT version match deserialize it instead of
+// re-running the graph transformers. Unset (the default) disables the cache. The directory must
+// already exist and the process must be able to write to it.
+static const char* const kOrtSessionOptionsOptimizedModelCacheDir = "session.optimized_model_cache_dir";
+
+// NUMA node to pin this session's per-session thread pools to. When set to a node id, every
+// intra-op and inter-op thread is bound to the node's processors, so arena pages the threads
+// first touch are placed on the same node and remote-memory accesses are avoided. Only applies
+// when per-session thread pools are used, and is ignored on platforms without NUMA topology
+// information. The default is "-1" (no node binding).
+static const char* const kOrtSessionOptionsSessionNumaNode = "session.numa_node";
+
+// Bucket size for the memory pattern cache key when inputs have dynamic shapes. When set to a
+// value N > 1, input dimensions are rounded up to the next multiple of N for cache lookups, and a
+// cached pattern block may serve any allocation that fits in it, so recurring shape buckets (e.g.
+// variable sequence lengths) hit one precomputed single-allocation plan instead of each exact
+// shape needing its own first run. Within a bucket the cached pattern is upgraded whenever a run
+// traces larger allocations. "0" (the default) keys the cache on exact shapes.
+static const char* const kOrtSessionOptionsMemoryPatternShapeBucketSize = "session.memory_pattern_shape_bucket_size";
+
+// Number of runs a given input-shape key (after any bucketing, see
+// "session.memory_pattern_shape_bucket_size") must be seen before a memory pattern is traced and
+// cached for it. Runs whose shape has not yet recurred that often use the generic allocation path,
+// so dynamic-shape deployments only specialize for shapes that prove stable instead of tracing and
+// caching a pattern for every one-off shape. "1" (the default) traces on the first run with each
+// shape.
+static const char* const kOrtSessionOptionsMemoryPatternMinStableRuns = "session.memory_pattern_min_stable_runs";
+
+// If the config value is set to "1", temporary tensors the allocation plan proves do not outlive
+// a single Run call are served from a run-scoped bump-pointer arena that is reclaimed wholesale
+// when the Run completes, instead of going through the general allocator chunk by chunk.
+// Values that are fetched, fenced, or whose buffer is reused by such a value keep the default
+// allocation path. The default is "0".
+static const char* const kOrtSessionOptionsUseRunScopedScratchArena = "session.use_run_scoped_scratch_arena";
+
+// If the config value is set to "1", parallel loops run for this session are queued in the
+// strict high-priority class of the intra-op thread pool. On a thread pool shared between
+// sessions (pools created via CreateEnvWithGlobalThreadPools), this session's loop shards are
+// then drained ahead of queued shards from normal-priority sessions, so a latency-critical
+// session is not stuck behind a backlog of batch work. Shards that are already running are
+// never interrupted. The setting has no effect in OpenMP builds, and is a no-op (all work is
+// one class) when the pool is not shared. The default is "0".
+static const char* const kOrtSessionOptionsUseHighPriorityScheduling = "session.use_high_priority_scheduling";
+
+// Selects the arena implementation backing the default CPU execution provider's allocator.
+// In builds with onnxruntime_USE_MIMALLOC_ARENA_ALLOCATOR the default is "1" (mimalloc
+// per-thread heaps); set to "0" to fall back to BFCArena so both arenas can be compared in the
+// same binary. Ignored in builds without mimalloc, where BFCArena is always used.
+static const char* const kOrtSessionOptionsUseMimallocArena = "session.use_mimalloc_arena";
+
+// If the config value is set to "1", initializers get individual allocations that the tensor owns
+// instead of being packed into one planner block allocation. Individually owned initializers can
+// actually be released when they are dropped, e.g. once PrePack has replaced a weight with its
+// packed copy, which lowers steady-state memory for models with many pre-packable weights.
+// The default is "0" (planner block allocation).
+static const char* const kOrtSessionOptionsUseDeviceAllocatorForInitializers = "session.use_device_allocator_for_initializers";
+
+// If the config value is set to "1", the session's intra-op thread pool measures the real
+// per-iteration cost of parallel loops during the first few runs, keyed per static cost estimate
+// and iteration-count bucket, and uses the measurements instead of the kernels' static cost
+// guesses thereafter. Loops that measure in the microsecond range then run sequentially rather
+// than waking the pool, and larger loops are sharded so each shard does a meaningful amount of
+// work. Only applies to per-session thread pools. The default is "0".
+static const char* const kOrtSessionOptionsLoopCostCalibration = "session.enable_loop_cost_calibration";
+
+// Upper bound on the number of spin iterations a per-session pool worker performs while waiting
+// for work before blocking. "0" disables spin-waiting entirely, which matters on shared hosts
+// where spinning workers steal cycles from co-located services. The default is "-1", which keeps
+// the implementation default (~1M iterations). Applies to both intra-op and inter-op pools.
+static const char* const kOrtSessionOptionsThreadSpinLoopIterations = "session.thread_pool_spin_loop_iterations";
+
+// If the config value is set to "1" and the CPU is hybrid, the per-session intra-op pool is
+// pinned to the performance cores (when the platform exposes core-type information), so
+// latency-sensitive kernels do not land on efficiency cores. An explicit affinity list or NUMA
+// node binding takes precedence. The default is "0".
+static const char* const kOrtSessionOptionsPreferPerformanceCores = "session.prefer_performance_cores";
+
+// If the config value is set to "1" and the CPU is hybrid, the per-session intra-op pool is
+// pinned to the efficiency (LITTLE) cores instead, for background sessions that should stay off
+// the performance cores. Ignored when "session.prefer_performance_cores" is also set. The
+// default is "0".
+static const char* const kOrtSessionOptionsPreferEfficiencyCores = "session.prefer_efficiency_cores";
+
+// If the config value is set to "1", the CPU memory arena advises the kernel to back its regions
+// with huge pages (transparent huge pages via madvise on Linux), which cuts dTLB misses on large
+// weight working sets. Best effort: where the facility is unavailable the arena silently stays on
+// regular pages. Only applies when the default CPU execution provider is created by the session.
+// The default is "0".
+static const char* const kOrtSessionOptionsArenaUseHugePages = "session.arena_use_huge_pages";
+
+// Explicit processor binding for the per-session intra-op pool, as a semicolon-separated list of
+// logical processor ids, e.g. "0;2;4;6". Thread i of the pool is pinned to the i-th id, and the
+// pool is sized to the list. Takes precedence over NUMA node and performance-core placement.
+// Unset (the default) applies no explicit binding.
+static const char* const kOrtSessionOptionsIntraOpThreadAffinities = "session.intra_op_thread_affinities";
+
+// If the config value is set to "1", eligible float32 subgraphs assigned to the CUDA execution
+// provider are rewritten to float16 at load: numerically safe ops run through the
+// half-precision (tensor core) kernels, their constant initializers are converted once, and
+// Cast nodes are inserted at the precision boundaries. Numerically sensitive ops such as
+// Softmax, reductions and normalizations stay float32. Halves weight/activation memory on
+// those subgraphs without an offline model conversion. The default is "0".
+static const char* const kOrtSessionOptionsEnableFp16Execution = "session.enable_fp16_execution";
+
+// Maximum number of fused subgraphs an execution provider compiles concurrently during session
+// initialization. Only applies to execution providers that declare concurrent compilation safe
+// (e.g. TensorRT); the compile calls are issued from the inter-op thread pool, so the effective
+// parallelism is also bounded by that pool's size. Cuts initialization time for models that
+// partition into many independent subgraphs. The default is "1" (compile serially).
+static const char* const kOrtSessionOptionsCompileParallelism = "session.compile_parallelism";
+
+// If the config value is set to "1", the profiler writes events to the profile file
+// incrementally as they accumulate instead of holding every event in memory until profiling
+// ends, which bounds the profiler's memory use on long-running sessions. Only applies when
+// profiling is enabled. The default is "0".
+static const char* const kOrtSessionOptionsProfilerStreamingMode = "session.profiler_streaming_mode";
+
+// Sample interval for always-available node timing. When set to a value N >= 1, one in every N
+// Run calls accumulates per-node wall clock time into lock-free counters that can be queried at
+// any point through the SessionGetNodeTimingStats C API. Unsampled runs only pay for a single
+// flag check, so this can stay enabled in production, unlike full profiling. "0" (the default)
+// disables the sampling.
+static const char* const kOrtSessionOptionsNodeTimingSampleInterval = "session.node_timing_sample_interval";
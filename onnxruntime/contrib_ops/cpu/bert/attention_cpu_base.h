@@ -9,6 +9,11 @@
 #include "core/common/common.h"
 #include "core/common/safeint.h"
 #include "core/framework/op_kernel.h"
+#include "core/mlas/inc/mlas.h"
+
+#include <cmath>
+#include <limits>
+#include <vector>
 
 namespace onnxruntime {
 namespace contrib {
@@ -40,13 +45,7 @@ class AttentionCPUBase : public AttentionBase {
     // Total sequence length including that of past state: S* = S' + S
     const int all_sequence_length = past_sequence_length + sequence_length;
 
-    // Compute the attention score. It does 2 things:
-    //         I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
-    //                                           1 x mask_data(B, N, S, S*)
-    //         II.attention_probs(B, N, S, S*) = Softmax(attention_probs)
     size_t attention_probs_bytes = SafeInt<size_t>(batch_size) * num_heads_ * sequence_length * all_sequence_length * sizeof(T);
-    auto attention_probs = allocator->Alloc(attention_probs_bytes);
-    BufferUniquePtr scratch_buffer(attention_probs, BufferDeleter(allocator));
 
     void* mask_data = nullptr;
     if (mask_index != nullptr || (is_unidirectional_ && sequence_length > 1)) {
@@ -61,17 +60,37 @@ class AttentionCPUBase : public AttentionBase {
     const T* past_data = past != nullptr ? past->template Data<T>() : nullptr;
     T* present_data = present != nullptr ? present->template MutableData<T>() : nullptr;
 
+    // At long sequence lengths the full (B, N, S, S*) probability matrix costs gigabytes
+    // and every byte of it misses cache. Once it would exceed a cache-sized threshold,
+    // stream over blocks of keys with a running softmax instead of materializing it -
+    // the streaming path only keeps a few block-sized scratch buffers per thread.
+    constexpr size_t kMaxMaterializedProbsBytes = static_cast<size_t>(1) << 24;  // 16 MB
+    if (attention_probs_bytes > kMaxMaterializedProbsBytes) {
+      if (mask_data != nullptr) {
+        PrepareMask(mask_index_data, mask_index_dims, static_cast<T*>(mask_data),
+                    is_unidirectional_, batch_size, sequence_length, past_sequence_length);
+      }
+
+      ComputeTiledAttention<T>(output->template MutableData<T>(), Q, K, V, static_cast<T*>(mask_data),
+                               batch_size, sequence_length, past_sequence_length, head_size,
+                               past_data, present_data, tp);
+      return Status::OK();
+    }
+
+    // Compute the attention score. It does 2 things:
+    //         I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
+    //                                           1 x mask_data(B, N, S, S*)
+    //         II.attention_probs(B, N, S, S*) = Softmax(attention_probs)
+    auto attention_probs = allocator->Alloc(attention_probs_bytes);
+    BufferUniquePtr scratch_buffer(attention_probs, BufferDeleter(allocator));
+
     ComputeAttentionProbs<T>(static_cast<T*>(attention_probs), Q, K,
                              mask_index_data, mask_index_dims, static_cast<T*>(mask_data),
                              batch_size, sequence_length, past_sequence_length, head_size,
                              past_data, present_data, tp);
 
-    // Compute the attentionScore * Value. It does: out_tmp(B, N, S, H) = attention_probs(B, N, S, S*) x V(B, N, S*, H)
-    auto out_tmp_data =
-        allocator->Alloc(SafeInt<size_t>(batch_size) * num_heads_ * sequence_length * head_size * sizeof(T));
-    BufferUniquePtr out_tmp_buffer(out_tmp_data, BufferDeleter(allocator));
-
-    ComputeVxAttentionScore(output->template MutableData<T>(), static_cast<T*>(out_tmp_data), static_cast<T*>(attention_probs), V,
+    // Compute the attentionScore * Value. It does: output(B, S, N, H) = attention_probs(B, N, S, S*) x V(B, N, S*, H)
+    ComputeVxAttentionScore(output->template MutableData<T>(), static_cast<T*>(attention_probs), V,
                             batch_size, sequence_length, past_sequence_length, head_size, hidden_size,
                             past_data, present_data, tp);
 
@@ -79,6 +98,146 @@ class AttentionCPUBase : public AttentionBase {
   }
 
  private:
+  // Streaming alternative to ComputeAttentionProbs + ComputeVxAttentionScore used for
+  // long sequences. The attention probabilities are produced one
+  // (query block x key block) tile at a time and folded straight into the output with a
+  // running row max/sum, so only a few block-sized scratch buffers exist per thread
+  // instead of the full (B, N, S, S*) matrix. The math is the same as the materialized
+  // path: scaled QK' plus the additive mask, max-stabilized softmax, then weighting of V.
+  template <typename T>
+  void ComputeTiledAttention(T* output,            // buffer for the result with size BxSxNxH
+                             const T* Q,           // Q data. Its size is BxNxSxH
+                             const T* K,           // K data. Its size is BxNxSxH
+                             const T* V,           // V data. Its size is BxNxSxH
+                             const T* mask_data,   // additive mask with shape BxSxS*. nullptr if no mask
+                             int batch_size,       // batch size
+                             int sequence_length,  // sequence length
+                             int past_sequence_length,  // sequence length of past state
+                             int head_size,             // head size
+                             const T* past,             // past state
+                             T* present,                // present state
+                             ThreadPool* tp) const {
+    const int all_sequence_length = past_sequence_length + sequence_length;                  // S* = S' + S
+    const size_t past_chunk_length = static_cast<size_t>(past_sequence_length) * head_size;  // S' x H
+    const size_t input_chunk_length = static_cast<size_t>(sequence_length) * head_size;      // S x H
+    const size_t present_chunk_length = past_chunk_length + input_chunk_length;              // S* x H
+
+    const int loop_len = batch_size * num_heads_;
+    const float alpha = 1.0f / sqrt(static_cast<float>(head_size));
+
+    // Concatenate past K/V and K/V into present K/V up front so that the tiled jobs
+    // below can read the key/value chunks without coordinating writes
+    const T* present_v = nullptr;
+    if (nullptr != present) {
+      T* present_v_mutable = present + static_cast<size_t>(loop_len) * present_chunk_length;
+      const T* past_v = (nullptr != past) ? past + static_cast<size_t>(loop_len) * past_chunk_length : nullptr;
+      ThreadPool::TrySimpleParallelFor(tp, loop_len, [&](std::ptrdiff_t i) {
+        ConcatStateChunk(past, K + input_chunk_length * i, present, past_chunk_length, present_chunk_length, i);
+        ConcatStateChunk(past_v, V + input_chunk_length * i, present_v_mutable, past_chunk_length, present_chunk_length, i);
+      });
+      present_v = present_v_mutable;
+    }
+
+    // The scores tile (query rows x key block) and the key/value blocks it touches are
+    // sized to stay cache resident
+    constexpr int query_block_size = 32;
+    constexpr int key_block_size = 512;
+
+    const int num_query_blocks = (sequence_length + query_block_size - 1) / query_block_size;
+    const std::ptrdiff_t num_jobs = static_cast<std::ptrdiff_t>(loop_len) * num_query_blocks;
+
+    ThreadPool::TrySimpleParallelFor(tp, num_jobs, [&](std::ptrdiff_t job) {
+      const std::ptrdiff_t i = job / num_query_blocks;
+      const int query_start = static_cast<int>(job % num_query_blocks) * query_block_size;
+      const int query_rows = std::min(query_block_size, sequence_length - query_start);
+      const int batch_index = static_cast<int>(i / num_heads_);
+      const int head_index = static_cast<int>(i % num_heads_);
+
+      const T* q = Q + input_chunk_length * i + static_cast<size_t>(query_start) * head_size;
+      const T* k = (nullptr != present) ? present + present_chunk_length * i : K + input_chunk_length * i;
+      const T* v = (nullptr != present) ? present_v + present_chunk_length * i : V + input_chunk_length * i;
+
+      std::vector<T> scores(static_cast<size_t>(query_rows) * key_block_size);
+      std::vector<T> accumulator(static_cast<size_t>(query_rows) * head_size, T{});
+      std::vector<T> running_max(query_rows, -std::numeric_limits<T>::infinity());
+      std::vector<T> running_sum(query_rows, T{});
+
+      const T* mask_base =
+          (nullptr != mask_data)
+              ? mask_data + (static_cast<size_t>(batch_index) * sequence_length + query_start) * all_sequence_length
+              : nullptr;
+
+      for (int key_start = 0; key_start < all_sequence_length; key_start += key_block_size) {
+        const int key_cols = std::min(key_block_size, all_sequence_length - key_start);
+
+        // scores(query_rows, key_cols) = 1/sqrt(H) x q x k' + 1 x mask
+        T beta = T{};
+        if (nullptr != mask_base) {
+          for (int r = 0; r < query_rows; ++r) {
+            memcpy(scores.data() + static_cast<size_t>(r) * key_cols,
+                   mask_base + static_cast<size_t>(r) * all_sequence_length + key_start,
+                   key_cols * sizeof(T));
+          }
+          beta = static_cast<T>(1.0f);
+        }
+
+        math::Gemm<T, ThreadPool>(CblasNoTrans, CblasTrans, query_rows, key_cols, head_size, alpha,
+                                  q, k + static_cast<size_t>(key_start) * head_size, beta,
+                                  scores.data(), nullptr);
+
+        // Fold the tile into the running max-stabilized softmax state
+        for (int r = 0; r < query_rows; ++r) {
+          T* row = scores.data() + static_cast<size_t>(r) * key_cols;
+
+          T block_max = row[0];
+          for (int c = 1; c < key_cols; ++c) {
+            if (block_max < row[c]) {
+              block_max = row[c];
+            }
+          }
+
+          // On the first tile running_max is -inf, making the correction factor zero
+          const T new_max = std::max(running_max[r], block_max);
+          const T correction = std::exp(running_max[r] - new_max);
+
+          T block_sum = T{};
+          for (int c = 0; c < key_cols; ++c) {
+            row[c] = std::exp(row[c] - new_max);
+            block_sum += row[c];
+          }
+
+          running_sum[r] = running_sum[r] * correction + block_sum;
+          running_max[r] = new_max;
+
+          if (correction != static_cast<T>(1.0f)) {
+            T* acc_row = accumulator.data() + static_cast<size_t>(r) * head_size;
+            for (int h = 0; h < head_size; ++h) {
+              acc_row[h] *= correction;
+            }
+          }
+        }
+
+        // accumulator(query_rows, H) += scores(query_rows, key_cols) x v_block(key_cols, H)
+        math::Gemm<T, ThreadPool>(CblasNoTrans, CblasNoTrans, query_rows, head_size, key_cols, 1.0f,
+                                  scores.data(), v + static_cast<size_t>(key_start) * head_size, 1.0f,
+                                  accumulator.data(), nullptr);
+      }
+
+      // Normalize by the running sum and write transposed: out(B, S, N, H)
+      for (int r = 0; r < query_rows; ++r) {
+        // the row of the maximum score contributes exp(0) to the sum, so it is never zero
+        const T inv_sum = static_cast<T>(1.0f) / running_sum[r];
+        const T* acc_row = accumulator.data() + static_cast<size_t>(r) * head_size;
+        T* dest = output +
+                  ((static_cast<size_t>(batch_index) * sequence_length + query_start + r) * num_heads_ + head_index) *
+                      head_size;
+        for (int h = 0; h < head_size; ++h) {
+          dest[h] = acc_row[h] * inv_sum;
+        }
+      }
+    });
+  }
+
   // Helper function to compute the attention probs. It does 2 things:
   //  I. attention_probs(B, N, S, S*) = 1/sqrt(H) x Q(B, N, S, H) x K'(B, N, S*, H -> B, N, H, S*) +
   //                                    1 x mask_data(B, N, S, S*)
@@ -112,36 +271,52 @@ class AttentionCPUBase : public AttentionBase {
       const int loop_len = batch_size * num_heads_;
       const float alpha = 1.0f / sqrt(static_cast<float>(head_size));
 
-      // The cost of Gemm
-      const double cost = static_cast<double>(head_size) * sequence_length * all_sequence_length;
-
-      ThreadPool::TryParallelFor(tp, loop_len, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
-        for (std::ptrdiff_t i = begin; i != end; ++i) {
+      // broadcast mask data: (Bx)SxS* -> (BxNx)SxS*
+      if (mask_data != nullptr) {
+        for (std::ptrdiff_t i = 0; i < loop_len; ++i) {
           const std::ptrdiff_t batch_index = i / num_heads_;
-
-          // broadcast mask data: (Bx)SxS* -> (BxNx)SxS*
-          if (mask_data != nullptr) {
-            const T* broadcast_data_src = reinterpret_cast<T*>(mask_data) + batch_index * sequence_length * all_sequence_length;
-            T* broadcast_data_dest = reinterpret_cast<T*>(attention_probs) + sequence_length * all_sequence_length * i;
-            memcpy(broadcast_data_dest, broadcast_data_src, sequence_length * all_sequence_length * sizeof(T));
-          }
-
-          const T* k = K + input_chunk_length * i;
-          if (nullptr != present) {
-            // concatenate past_K and K : (BxNx)S'xH, (BxNx)SxH -> (BxNx)S*xH
-            k = ConcatStateChunk(past, k, present, past_chunk_length, present_chunk_length, i);
-          }
-
-          // gemm
-          //                     original                 transposed             each iteration
-          // A: Q                (B x N x) S x H          (B x N x) S x H        S x H
-          // B: K'               (B x N x) S* x H         (B x N x) H x S*       H x S*
-          // C: attention_probs  (B x N x) S x S*         (B x N x) S x S*       S x S*
-          math::Gemm<T, ThreadPool>(CblasNoTrans, CblasTrans, sequence_length, all_sequence_length, head_size, alpha,
-                                    Q + input_chunk_length * i, k, 1.0,
-                                    reinterpret_cast<T*>(attention_probs) + sequence_length * all_sequence_length * i, nullptr);
+          const T* broadcast_data_src = reinterpret_cast<T*>(mask_data) + batch_index * sequence_length * all_sequence_length;
+          T* broadcast_data_dest = reinterpret_cast<T*>(attention_probs) + sequence_length * all_sequence_length * i;
+          memcpy(broadcast_data_dest, broadcast_data_src, sequence_length * all_sequence_length * sizeof(T));
         }
-      });
+      }
+
+      // gemm
+      //                     original                 transposed             each iteration
+      // A: Q                (B x N x) S x H          (B x N x) S x H        S x H
+      // B: K'               (B x N x) S* x H         (B x N x) H x S*       H x S*
+      // C: attention_probs  (B x N x) S x S*         (B x N x) S x S*       S x S*
+      if (nullptr == present) {
+        // the (B.N) chunks of Q, K and attention_probs are uniformly strided, so all of the
+        // products can be issued as a single batched GEMM that is partitioned in one pass
+        // over the thread pool
+        MlasGemmBatch(CblasNoTrans, CblasTrans,
+                      sequence_length, all_sequence_length, head_size, alpha,
+                      Q, head_size, input_chunk_length,
+                      K, head_size, input_chunk_length,
+                      1.0f,
+                      reinterpret_cast<T*>(attention_probs), all_sequence_length,
+                      static_cast<size_t>(sequence_length) * all_sequence_length,
+                      static_cast<size_t>(loop_len), tp);
+      } else {
+        // concatenate past_K and K : (BxNx)S'xH, (BxNx)SxH -> (BxNx)S*xH
+        ThreadPool::TrySimpleParallelFor(tp, loop_len, [&](std::ptrdiff_t i) {
+          ConcatStateChunk(past, K + input_chunk_length * i, present,
+                           past_chunk_length, present_chunk_length, i);
+        });
+
+        // the present K chunks are uniformly strided, so as above the products can go
+        // out as one batched GEMM. This matters most for cached decoding, where S == 1
+        // makes the per-head products far too small to keep the threads busy on their own.
+        MlasGemmBatch(CblasNoTrans, CblasTrans,
+                      sequence_length, all_sequence_length, head_size, alpha,
+                      Q, head_size, input_chunk_length,
+                      present, head_size, present_chunk_length,
+                      1.0f,
+                      reinterpret_cast<T*>(attention_probs), all_sequence_length,
+                      static_cast<size_t>(sequence_length) * all_sequence_length,
+                      static_cast<size_t>(loop_len), tp);
+      }
     }
 
     //  attention_probs(B, N, S, S*) = Softmax(attention_probs)
@@ -154,7 +329,6 @@ class AttentionCPUBase : public AttentionBase {
 
   template <typename T>
   void ComputeVxAttentionScore(T* output,                 // buffer for the result with size BxSxNxH
-                               T* tmp_buffer,             // buffer for temp use with size is BxNxSxH
                                const T* attention_probs,  // Attention probs with size BxNxSxS*
                                const T* V,                // V value with size BxNxSxH
                                int batch_size,            // batch size
@@ -189,22 +363,20 @@ class AttentionCPUBase : public AttentionBase {
           v = ConcatStateChunk(past, v, present, past_chunk_length, present_chunk_length, i);
         }
 
-        T* current_tmp_data = reinterpret_cast<T*>(tmp_buffer) + input_chunk_length * i;
-        math::MatMul<T>(sequence_length, head_size, all_sequence_length,
-                        attention_probs + sequence_length * all_sequence_length * i,
-                        v, current_tmp_data, nullptr);
-
-        // transpose: out(B, S, N, H) = transpose out_tmp(B, N, S, H)
+        // write the (S x H) chunk straight into its strided location in out(B, S, N, H)
+        // via the output leading dimension - no staging buffer or transpose copy needed
         const int batch_index = static_cast<int>(i / num_heads_);
         const int head_index = static_cast<int>(i % num_heads_);
-        T* src = current_tmp_data;
         T* dest = output + (batch_index * sequence_length * num_heads_ + head_index) * head_size;
-        const auto bytes_to_copy = SafeInt<size_t>(head_size) * sizeof(T);
-        for (int j = 0; j < sequence_length; j++) {
-          memcpy(dest, src, bytes_to_copy);
-          src += head_size;
-          dest += hidden_size;
-        }
+        math::GemmEx<T, ThreadPool>(CblasNoTrans, CblasNoTrans,
+                                    sequence_length, head_size, all_sequence_length,
+                                    1.0f,
+                                    attention_probs + sequence_length * all_sequence_length * i,
+                                    all_sequence_length,
+                                    v, head_size,
+                                    0.0f,
+                                    dest, hidden_size,
+                                    nullptr);
       }
     });
   }
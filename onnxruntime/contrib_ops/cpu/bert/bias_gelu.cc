@@ -74,12 +74,6 @@ Status BiasGelu<T, use_approximation>::Compute(OpKernelContext* context) const {
   const T* bias_data = bias->template Data<T>();
   int64_t bias_len = bias->Shape().Size();
 
-  AllocatorPtr alloc;
-  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
-  BufferUniquePtr buffer = BufferUniquePtr(alloc->Alloc(SafeInt<size_t>(sizeof(T)) * elem_count),
-                                           BufferDeleter(alloc));
-  T* tmp_data = static_cast<T*>(buffer.get());
-
   int64_t task_count = elem_count / bias_len;
 
   concurrency::ThreadPool::TryBatchParallelFor(
@@ -87,9 +81,8 @@ Status BiasGelu<T, use_approximation>::Compute(OpKernelContext* context) const {
       [&](ptrdiff_t task_idx) {
         const T* p_input = input_data + task_idx * bias_len;
         T* p_output = output_data + task_idx * bias_len;
-        T* p_tmp = tmp_data + task_idx * bias_len;
 
-        AddBiasGelu(p_input, bias_data, p_tmp, p_output, bias_len);
+        AddBiasGelu(p_input, bias_data, p_output, bias_len);
       },
       0);
 
@@ -98,31 +91,42 @@ Status BiasGelu<T, use_approximation>::Compute(OpKernelContext* context) const {
 
 template <typename T, bool use_approximation>
 void BiasGelu<T, use_approximation>::AddBiasGelu(
-    const T* input, const T* bias, T* temp, T* output, int64_t count) const {
-  if (use_approximation) {
-    for (int64_t i = 0; i < count; i++) {
-      T value = input[i] + bias[i];
-      output[i] = value * (static_cast<T>(C) * value * value + static_cast<T>(B));
-      temp[i] = value * 0.5f;
-    }
+    const T* input, const T* bias, T* output, int64_t count) const {
+  // Process in fixed-size blocks so the half-value scratch lives on the stack and
+  // the blocks stay cache-resident between the two passes around the MLAS call,
+  // instead of allocating an elem_count-sized temporary per Compute.
+  constexpr int64_t kElementsPerBlock = 2048;
+  T temp[kElementsPerBlock];
 
-    MlasComputeTanh(output, output, count);
+  while (count > 0) {
+    int64_t block_count = std::min(count, kElementsPerBlock);
 
-    for (int64_t i = 0; i < count; i++) {
-      output[i] = temp[i] * (output[i] + 1.0f);
-    }
-  } else {  // BiasGelu
-    for (int64_t i = 0; i < count; i++) {
-      T value = input[i] + bias[i];
-      output[i] = value * static_cast<T>(M_SQRT1_2);
-      temp[i] = value * 0.5f;
+    if (use_approximation) {
+      for (int64_t i = 0; i < block_count; i++) {
+        T value = input[i] + bias[i];
+        output[i] = value * (static_cast<T>(C) * value * value + static_cast<T>(B));
+        temp[i] = value * 0.5f;
+      }
+
+      MlasComputeTanh(output, output, block_count);
+    } else {  // BiasGelu
+      for (int64_t i = 0; i < block_count; i++) {
+        T value = input[i] + bias[i];
+        output[i] = value * static_cast<T>(M_SQRT1_2);
+        temp[i] = value * 0.5f;
+      }
+
+      MlasComputeErf(output, output, block_count);
     }
 
-    MlasComputeErf(output, output, count);
-
-    for (int64_t i = 0; i < count; i++) {
+    for (int64_t i = 0; i < block_count; i++) {
       output[i] = temp[i] * (output[i] + 1.0f);
     }
+
+    input += block_count;
+    bias += block_count;
+    output += block_count;
+    count -= block_count;
   }
 }
 
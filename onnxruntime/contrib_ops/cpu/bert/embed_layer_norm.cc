@@ -97,13 +97,20 @@ Status EmbedLayerNorm<T>::Compute(OpKernelContext* context) const {
       const T* input_position_embedding = position_embedding_data + position_col_index * hidden_size;
       const T* input_segment_embedding = (nullptr == segment_embedding_data) ? nullptr : segment_embedding_data + segment_col_index * hidden_size;
 
+      // keep the segment check out of the element loop so both variants vectorize
       T sum = static_cast<T>(0);
-      for (int i = 0; i < hidden_size; i++) {
-        T subtotal = input_word_embedding[i] + input_position_embedding[i];
-        if (nullptr != segment_embedding_data)
-          subtotal += input_segment_embedding[i];
-        y[i] = subtotal;
-        sum += subtotal;
+      if (nullptr != segment_embedding_data) {
+        for (int i = 0; i < hidden_size; i++) {
+          T subtotal = input_word_embedding[i] + input_position_embedding[i] + input_segment_embedding[i];
+          y[i] = subtotal;
+          sum += subtotal;
+        }
+      } else {
+        for (int i = 0; i < hidden_size; i++) {
+          T subtotal = input_word_embedding[i] + input_position_embedding[i];
+          y[i] = subtotal;
+          sum += subtotal;
+        }
       }
       T mean = sum / hidden_size;
       sum = 0;
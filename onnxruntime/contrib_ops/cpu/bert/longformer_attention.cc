@@ -0,0 +1,369 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "longformer_attention_base.h"
+#include "core/framework/op_kernel.h"
+#include "core/util/math.h"
+#include "core/util/math_cpuonly.h"
+#include "core/common/safeint.h"
+#include "core/platform/threadpool.h"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using onnxruntime::concurrency::ThreadPool;
+
+namespace onnxruntime {
+namespace contrib {
+
+// CPU kernel for Longformer sliding-window attention. Only the nonzero score blocks
+// are computed: each block of W query rows (W is the one-sided window) attends to a
+// band of at most 3W key rows plus the global tokens, so cost grows linearly with
+// sequence length instead of quadratically. Semantics match the CUDA kernel:
+//   - a local query attends to keys in [i - W, i + W] plus all global tokens,
+//   - a global query attends to every key using the global Q/K/V projections,
+//   - fully masked query rows produce zero output (consistent with Huggingface).
+template <typename T>
+class LongformerAttention : public OpKernel, public LongformerAttentionBase {
+ public:
+  explicit LongformerAttention(const OpKernelInfo& info);
+
+  Status Compute(OpKernelContext* context) const override;
+};
+
+// These ops are internal-only, so register outside of onnx
+ONNX_OPERATOR_TYPED_KERNEL_EX(
+    LongformerAttention,
+    kMSDomain,
+    1,
+    float,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
+    LongformerAttention<float>);
+
+template <typename T>
+LongformerAttention<T>::LongformerAttention(const OpKernelInfo& info)
+    : OpKernel(info), LongformerAttentionBase(info) {}
+
+template <typename T>
+Status LongformerAttention<T>::Compute(OpKernelContext* context) const {
+  const Tensor* input = context->Input<Tensor>(0);
+  const Tensor* weights = context->Input<Tensor>(1);
+  const Tensor* bias = context->Input<Tensor>(2);
+  const Tensor* mask = context->Input<Tensor>(3);
+  const Tensor* global_weights = context->Input<Tensor>(4);
+  const Tensor* global_bias = context->Input<Tensor>(5);
+  const Tensor* global_attention = context->Input<Tensor>(6);
+
+  ORT_RETURN_IF_ERROR(CheckInputs(input->Shape(), weights->Shape(), bias->Shape(), mask->Shape(),
+                                  global_weights->Shape(), global_bias->Shape(), global_attention->Shape()));
+
+  const auto& shape = input->Shape();
+  const int batch_size = static_cast<int>(shape[0]);
+  const int sequence_length = static_cast<int>(shape[1]);
+  const int hidden_size = static_cast<int>(shape[2]);
+  const int head_size = hidden_size / num_heads_;
+
+  Tensor* output = context->Output(0, shape);
+
+  constexpr size_t element_size = sizeof(T);
+
+  AllocatorPtr allocator;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&allocator));
+
+  auto* tp = context->GetOperatorThreadPool();
+
+  const auto* mask_data = mask->template Data<T>();
+  const auto* global_flags = global_attention->template Data<int32_t>();
+
+  // Gather the global token positions per batch.
+  std::vector<std::vector<int>> global_indices(batch_size);
+  size_t max_num_global = 0;
+  for (int b = 0; b < batch_size; b++) {
+    const int32_t* batch_flags = global_flags + static_cast<size_t>(b) * sequence_length;
+    for (int s = 0; s < sequence_length; s++) {
+      if (batch_flags[s] != 0) {
+        global_indices[b].push_back(s);
+      }
+    }
+    max_num_global = std::max(max_num_global, global_indices[b].size());
+  }
+
+  // Compute Q, K, V into (3, B, N, S, H) the same way the dense Attention kernel does:
+  // gemm_data(BS, 3NH) = input(BS, NH) x weights(NH, 3NH) + bias(3NH), transposed per head.
+  const size_t qkv_bytes = SafeInt<size_t>(batch_size) * sequence_length * 3 * hidden_size * element_size;
+  auto gemm_data = allocator->Alloc(qkv_bytes);
+  BufferUniquePtr gemm_buffer(gemm_data, BufferDeleter(allocator));
+
+  // The global projections are only needed when a batch contains global tokens.
+  void* global_gemm_data = nullptr;
+  if (max_num_global > 0) {
+    global_gemm_data = allocator->Alloc(qkv_bytes);
+  }
+  BufferUniquePtr global_gemm_buffer(global_gemm_data, BufferDeleter(allocator));
+
+  auto compute_qkv = [&](const T* weights_data, const T* bias_data, T* qkv_data) {
+    T* Q = qkv_data;
+    T* K = Q + static_cast<size_t>(batch_size) * sequence_length * hidden_size;
+    T* V = K + static_cast<size_t>(batch_size) * sequence_length * hidden_size;
+    T* QKV[3] = {Q, K, V};
+
+    const int loop_len = 3 * batch_size * num_heads_;
+    const auto* input_data = input->template Data<T>();
+
+    const double cost =
+        static_cast<double>(sequence_length) * static_cast<double>(head_size) * static_cast<double>(hidden_size);
+    ThreadPool::TryParallelFor(tp, loop_len, cost, [&](std::ptrdiff_t begin, std::ptrdiff_t end) {
+      for (std::ptrdiff_t i = begin; i != end; ++i) {
+        const int batch_index = static_cast<int>((i / 3) / num_heads_);
+        const int head_index = static_cast<int>((i / 3) % num_heads_);
+        const int qkv_index = static_cast<int>(i % 3);
+
+        int input_offset = batch_index * sequence_length * hidden_size;
+        int weights_offset = qkv_index * hidden_size + head_index * head_size;
+        T* qkv_dest = QKV[qkv_index];
+        int qkv_offset = (batch_index * num_heads_ + head_index) * (sequence_length * head_size);
+
+        // broadcast 3NH -> (3.B.N.S.H)
+        const T* broadcast_data_src = bias_data + weights_offset;
+        T* broadcast_data_dest = qkv_dest + qkv_offset;
+        for (int seq_index = 0; seq_index < sequence_length; seq_index++) {
+          memcpy(broadcast_data_dest, broadcast_data_src, head_size * sizeof(T));
+          broadcast_data_dest += head_size;
+        }
+
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans,
+                                        sequence_length, head_size, hidden_size, 1.0f,
+                                        input_data + input_offset, hidden_size,
+                                        weights_data + weights_offset, 3 * hidden_size, 1.0f,
+                                        qkv_dest + qkv_offset, head_size, nullptr);
+      }
+    });
+  };
+
+  compute_qkv(weights->template Data<T>(), bias->template Data<T>(), reinterpret_cast<T*>(gemm_data));
+  if (max_num_global > 0) {
+    compute_qkv(global_weights->template Data<T>(), global_bias->template Data<T>(),
+                reinterpret_cast<T*>(global_gemm_data));
+  }
+
+  const T* Q = reinterpret_cast<const T*>(gemm_data);
+  const T* K = Q + static_cast<size_t>(batch_size) * sequence_length * hidden_size;
+  const T* V = K + static_cast<size_t>(batch_size) * sequence_length * hidden_size;
+  const T* global_Q = reinterpret_cast<const T*>(global_gemm_data);
+  const T* global_K = (max_num_global > 0) ? global_Q + static_cast<size_t>(batch_size) * sequence_length * hidden_size : nullptr;
+  const T* global_V = (max_num_global > 0) ? global_K + static_cast<size_t>(batch_size) * sequence_length * hidden_size : nullptr;
+
+  T* output_data = output->template MutableData<T>();
+
+  const float scale = 1.0f / sqrt(static_cast<float>(head_size));
+  const int w = window_;
+  const int num_blocks = sequence_length / w;  // CheckInputs guarantees S % 2W == 0
+  const int loop_len = batch_size * num_heads_;
+  const size_t chunk_length = static_cast<size_t>(sequence_length) * head_size;
+
+  ThreadPool::TrySimpleParallelFor(tp, loop_len, [&](std::ptrdiff_t i) {
+    const int batch_index = static_cast<int>(i / num_heads_);
+    const int head_index = static_cast<int>(i % num_heads_);
+
+    const T* q = Q + chunk_length * i;
+    const T* k = K + chunk_length * i;
+    const T* v = V + chunk_length * i;
+
+    const T* batch_mask = mask_data + static_cast<size_t>(batch_index) * sequence_length;
+    const int32_t* batch_flags = global_flags + static_cast<size_t>(batch_index) * sequence_length;
+    const auto& batch_global = global_indices[batch_index];
+    const int num_global = static_cast<int>(batch_global.size());
+
+    std::vector<float> scores(static_cast<size_t>(w) * 3 * w);                 // banded score block
+    std::vector<float> global_scores(static_cast<size_t>(w) * num_global);     // out-of-band global columns
+    std::vector<float> row_scores(sequence_length);                            // full row for global queries
+
+    auto output_row = [&](int row) {
+      return output_data + (static_cast<size_t>(batch_index) * sequence_length + row) * num_heads_ * head_size +
+             static_cast<size_t>(head_index) * head_size;
+    };
+
+    for (int block = 0; block < num_blocks; ++block) {
+      const int row_start = block * w;
+      const int band_start = std::max(row_start - w, 0);
+      const int band_end = std::min(row_start + 2 * w, sequence_length);
+      const int band_len = band_end - band_start;
+
+      // scores(W, band_len) = q rows x k' band - the only nonzero block of this row group
+      math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans,
+                                      w, band_len, head_size, 1.0f,
+                                      q + static_cast<size_t>(row_start) * head_size, head_size,
+                                      k + static_cast<size_t>(band_start) * head_size, head_size, 0.0f,
+                                      scores.data(), band_len, nullptr);
+
+      // Scores against global tokens that fall outside the band
+      for (int r = 0; r < w; ++r) {
+        const T* q_row = q + static_cast<size_t>(row_start + r) * head_size;
+        for (int g = 0; g < num_global; ++g) {
+          const int col = batch_global[g];
+          if (col >= band_start && col < band_end) {
+            continue;
+          }
+          const T* k_row = k + static_cast<size_t>(col) * head_size;
+          float sum = 0.f;
+          for (int h = 0; h < head_size; ++h) {
+            sum += q_row[h] * k_row[h];
+          }
+          global_scores[static_cast<size_t>(r) * num_global + g] = sum;
+        }
+      }
+
+      // Per-row softmax over the window plus the global columns. Normalized
+      // probabilities are written back into the score block (entries outside the
+      // attended set are zeroed) so the block can feed a single banded GEMM with V.
+      for (int r = 0; r < w; ++r) {
+        const int row = row_start + r;
+        float* score_row = scores.data() + static_cast<size_t>(r) * band_len;
+        float* global_score_row = global_scores.data() + static_cast<size_t>(r) * num_global;
+
+        // Masked and global query rows do not use the banded path - zero their
+        // probabilities so the block GEMM leaves (or writes) zeros for them.
+        if (static_cast<float>(batch_mask[row]) < 0.0f || batch_flags[row] != 0) {
+          std::fill_n(score_row, band_len, 0.f);
+          std::fill_n(global_score_row, num_global, 0.f);
+          continue;
+        }
+
+        const int col_start = std::max(row - w, 0);
+        const int col_end = std::min(row + w + 1, sequence_length);
+
+        float max_score = -std::numeric_limits<float>::infinity();
+        for (int col = col_start; col < col_end; ++col) {
+          const float x = score_row[col - band_start] * scale + static_cast<float>(batch_mask[col]);
+          max_score = std::max(max_score, x);
+        }
+        for (int g = 0; g < num_global; ++g) {
+          const int col = batch_global[g];
+          if (col >= col_start && col < col_end) {
+            continue;
+          }
+          const float raw = (col >= band_start && col < band_end) ? score_row[col - band_start]
+                                                                  : global_score_row[g];
+          const float x = raw * scale + static_cast<float>(batch_mask[col]);
+          max_score = std::max(max_score, x);
+        }
+
+        float sum = 0.f;
+        for (int col = col_start; col < col_end; ++col) {
+          const float x = std::exp(score_row[col - band_start] * scale + static_cast<float>(batch_mask[col]) - max_score);
+          score_row[col - band_start] = x;
+          sum += x;
+        }
+        for (int g = 0; g < num_global; ++g) {
+          const int col = batch_global[g];
+          if (col >= col_start && col < col_end) {
+            global_score_row[g] = 0.f;
+            continue;
+          }
+          float& slot = (col >= band_start && col < band_end) ? score_row[col - band_start]
+                                                              : global_score_row[g];
+          const float x = std::exp(slot * scale + static_cast<float>(batch_mask[col]) - max_score);
+          slot = x;
+          sum += x;
+          if (col >= band_start && col < band_end) {
+            global_score_row[g] = 0.f;
+          }
+        }
+
+        const float recip_sum = 1.f / sum;
+        for (int col = band_start; col < band_end; ++col) {
+          const bool in_window = (col >= col_start && col < col_end);
+          const bool is_global = (batch_flags[col] != 0);
+          if (in_window || is_global) {
+            score_row[col - band_start] *= recip_sum;
+          } else {
+            score_row[col - band_start] = 0.f;
+          }
+        }
+        for (int g = 0; g < num_global; ++g) {
+          global_score_row[g] *= recip_sum;
+        }
+      }
+
+      // out(W, H) = probs(W, band_len) x v band, written straight into the
+      // (B, S, N, H) output with a strided leading dimension
+      math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans,
+                                      w, head_size, band_len, 1.0f,
+                                      scores.data(), band_len,
+                                      v + static_cast<size_t>(band_start) * head_size, head_size, 0.0f,
+                                      output_row(row_start), hidden_size, nullptr);
+
+      // Add the contributions of global tokens outside the band
+      for (int r = 0; r < w; ++r) {
+        const int row = row_start + r;
+        if (static_cast<float>(batch_mask[row]) < 0.0f || batch_flags[row] != 0) {
+          continue;
+        }
+        T* out_row = output_row(row);
+        for (int g = 0; g < num_global; ++g) {
+          const float p = global_scores[static_cast<size_t>(r) * num_global + g];
+          if (p == 0.f) {
+            continue;
+          }
+          const T* v_row = v + static_cast<size_t>(batch_global[g]) * head_size;
+          for (int h = 0; h < head_size; ++h) {
+            out_row[h] += p * v_row[h];
+          }
+        }
+      }
+    }
+
+    // Global query rows attend to the full sequence with the global projections
+    if (num_global > 0) {
+      const T* gq = global_Q + chunk_length * i;
+      const T* gk = global_K + chunk_length * i;
+      const T* gv = global_V + chunk_length * i;
+
+      for (int g = 0; g < num_global; ++g) {
+        const int row = batch_global[g];
+        T* out_row = output_row(row);
+        if (static_cast<float>(batch_mask[row]) < 0.0f) {
+          memset(out_row, 0, head_size * sizeof(T));
+          continue;
+        }
+
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasTrans,
+                                        1, sequence_length, head_size, 1.0f,
+                                        gq + static_cast<size_t>(row) * head_size, head_size,
+                                        gk, head_size, 0.0f,
+                                        row_scores.data(), sequence_length, nullptr);
+
+        float max_score = -std::numeric_limits<float>::infinity();
+        for (int col = 0; col < sequence_length; ++col) {
+          const float x = row_scores[col] * scale + static_cast<float>(batch_mask[col]);
+          max_score = std::max(max_score, x);
+        }
+        float sum = 0.f;
+        for (int col = 0; col < sequence_length; ++col) {
+          const float x = std::exp(row_scores[col] * scale + static_cast<float>(batch_mask[col]) - max_score);
+          row_scores[col] = x;
+          sum += x;
+        }
+        const float recip_sum = 1.f / sum;
+        for (int col = 0; col < sequence_length; ++col) {
+          row_scores[col] *= recip_sum;
+        }
+
+        math::GemmEx<float, ThreadPool>(CblasNoTrans, CblasNoTrans,
+                                        1, head_size, sequence_length, 1.0f,
+                                        row_scores.data(), sequence_length,
+                                        gv, head_size, 0.0f,
+                                        out_row, head_size, nullptr);
+      }
+    }
+  });
+
+  return Status::OK();
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
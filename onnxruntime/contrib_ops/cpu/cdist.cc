@@ -4,6 +4,7 @@
 #include "cdist.h"
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 #include "core/mlas/inc/mlas.h"
@@ -17,6 +18,91 @@ namespace contrib {
 DEFINE_KERNEL(float);
 DEFINE_KERNEL(double);
 
+// Adds sum_k(Xik**2) and sum_k(Yjk**2) to every element of the {m, n} output,
+// sharded over rows.
+template <typename T>
+static void AddNormsToOutput(const T* a_ss, const T* b_ss, T* c_data, int64_t m, int64_t n,
+                             concurrency::ThreadPool* threadpool) {
+  concurrency::ThreadPool::TryParallelFor(
+      threadpool, static_cast<std::ptrdiff_t>(m), static_cast<double>(n) * sizeof(T),
+      [=](std::ptrdiff_t row_begin, std::ptrdiff_t row_end) {
+        for (auto i = row_begin; i < row_end; ++i) {
+          const T a_val = a_ss[i];
+          T* cur_out = c_data + i * n;
+          for (int64_t j = 0; j < n; ++j) {
+            cur_out[j] = (cur_out[j] + a_val) + b_ss[j];
+          }
+        }
+      });
+}
+
+#if defined(_M_AMD64) || defined(__x86_64__)
+namespace {
+// Adds the row and column squared norms to each finished GEMM output tile while
+// it is still hot in the cache, completing sum_k(Xik**2) + sum_k(Yjk**2) -
+// 2*sum_k(Xik*Yjk) without a second pass over the {m, n} output.
+class CDistNormEpilogue : public MLAS_SGEMM_OUTPUT_PROCESSOR {
+ public:
+  CDistNormEpilogue(const float* a_ss, const float* b_ss) : a_ss_(a_ss), b_ss_(b_ss) {}
+
+  void Process(float* C, size_t StartM, size_t StartN, size_t CountM, size_t CountN,
+               size_t ldc) const override {
+    for (size_t i = 0; i < CountM; ++i) {
+      const float a_val = a_ss_[StartM + i];
+      float* row = C + i * ldc;
+      for (size_t j = 0; j < CountN; ++j) {
+        row[j] = (row[j] + a_val) + b_ss_[StartN + j];
+      }
+    }
+  }
+
+ private:
+  const float* a_ss_;
+  const float* b_ss_;
+};
+}  // namespace
+
+// Use GEMM of A and B^T with -2 as alpha to calculate -2*sum_k(Xik*Yjk), with the
+// norm additions fused into the GEMM output tiles.
+static void ComputeSqeuclidean(const float* a_data, const float* b_data, float* c_data,
+                               const float* a_ss, const float* b_ss,
+                               int64_t m, int64_t n, int64_t k, concurrency::ThreadPool* threadpool) {
+  const CDistNormEpilogue epilogue(a_ss, b_ss);
+  MlasGemm(CblasNoTrans, CblasTrans,
+           static_cast<size_t>(m), static_cast<size_t>(n), static_cast<size_t>(k),
+           -2.0f, a_data, static_cast<size_t>(k), b_data, static_cast<size_t>(k),
+           0.0f, c_data, static_cast<size_t>(n), threadpool, &epilogue);
+}
+
+// The MLAS output processors are single precision only, so the double variant runs
+// the norm additions as a separate parallel pass after the GEMM.
+static void ComputeSqeuclidean(const double* a_data, const double* b_data, double* c_data,
+                               const double* a_ss, const double* b_ss,
+                               int64_t m, int64_t n, int64_t k, concurrency::ThreadPool* threadpool) {
+  math::Gemm<double>(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
+                     m, n, k,
+                     -2., a_data, b_data, 0.,
+                     c_data,
+                     threadpool);
+  AddNormsToOutput(a_ss, b_ss, c_data, m, n, threadpool);
+}
+#else
+// the performance of this isn't great as the eigen matmul is single threaded by default
+// if you're on x86 and care about performance try MKL first. if there's a good enough argument for optimising this
+// we can look into it in the future.
+template <typename T>
+static void ComputeSqeuclidean(const T* a_data, const T* b_data, T* c_data,
+                               const T* a_ss, const T* b_ss,
+                               int64_t m, int64_t n, int64_t k, concurrency::ThreadPool* threadpool) {
+  // https://eigen.tuxfamily.org/dox/TopicWritingEfficientProductExpression.html
+  auto out_map = EigenMatrixMapRowMajor<T>(c_data, m, n);
+  out_map.noalias() = static_cast<T>(-2.) *
+                      (ConstEigenMatrixMapRowMajor<T>(a_data, m, k) *
+                       ConstEigenMatrixMapRowMajor<T>(b_data, n, k).transpose());
+  AddNormsToOutput(a_ss, b_ss, c_data, m, n, threadpool);
+}
+#endif
+
 template <typename T>
 static void CalculateSqeuclidean(const Tensor& a, const Tensor& b, Tensor& c, concurrency::ThreadPool* threadpool) {
   // input shapes have already been validated
@@ -33,60 +119,34 @@ static void CalculateSqeuclidean(const Tensor& a, const Tensor& b, Tensor& c, co
   const auto* b_data = b.Data<T>();
   auto* c_data = c.MutableData<T>();
 
-  // ReduceSumSquare for A
+  // ReduceSumSquare for A and B, sharded over rows
   std::vector<T> a_ss;
   a_ss.resize(m);
-  const auto* cur_a = a_data;
-  for (int64_t i = 0; i < m; ++i) {
-    a_ss[i] = ConstEigenVectorMap<T>(cur_a, k).squaredNorm();
-    cur_a += k;
-  }
+  T* a_ss_data = a_ss.data();
+  concurrency::ThreadPool::TryParallelFor(
+      threadpool, static_cast<std::ptrdiff_t>(m), static_cast<double>(k) * sizeof(T),
+      [=](std::ptrdiff_t row_begin, std::ptrdiff_t row_end) {
+        for (auto i = row_begin; i < row_end; ++i) {
+          a_ss_data[i] = ConstEigenVectorMap<T>(a_data + i * k, k).squaredNorm();
+        }
+      });
 
-  // ReduceSumSquare for B
   std::vector<T> b_ss;
   b_ss.resize(n);
-  const auto* cur_b = b_data;
-  for (int64_t i = 0; i < n; ++i) {
-    b_ss[i] = ConstEigenVectorMap<T>(cur_b, k).squaredNorm();
-    cur_b += k;
-  }
+  T* b_ss_data = b_ss.data();
+  concurrency::ThreadPool::TryParallelFor(
+      threadpool, static_cast<std::ptrdiff_t>(n), static_cast<double>(k) * sizeof(T),
+      [=](std::ptrdiff_t row_begin, std::ptrdiff_t row_end) {
+        for (auto i = row_begin; i < row_end; ++i) {
+          b_ss_data[i] = ConstEigenVectorMap<T>(b_data + i * k, k).squaredNorm();
+        }
+      });
 
   // NOTE: We want to avoid subtracting two numbers that are very close to each other as that can lead to
   // 'catastrophic cancellation'. (sum_k(Xik**2) + sum_k(Yjk**2)) would be close to 2*sum_k(Xik*Yjk) if the values
   // in Xij and Yjk are very similar, so subtracting can be problematic.
   // Due to that we calculate -2*sum_k(Xik*Yjk) using GEMM, add sum_k(Xik**2) next, and add sum_k(Yjk**2) last.
-
-// use MLAS on 64-bit (no 32-bit dgemm)
-#if defined(_M_AMD64) || defined(__x86_64__)
-  // Use GEMM of A and B^T with -2 as alpha to calculate -2*sum_k(Xik*Yjk)
-  math::Gemm<T>(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
-                m, n, k,
-                static_cast<T>(-2.), a_data, b_data, static_cast<T>(0.),
-                c_data,
-                threadpool);
-#else
-  // the performance of this isn't great as the eigen matmul is single threaded by default
-  // if you're on x86 and care about performance try MKL first. if there's a good enough argument for optimising this
-  // we can look into it in the future.
-  ORT_UNUSED_PARAMETER(threadpool);
-
-  // https://eigen.tuxfamily.org/dox/TopicWritingEfficientProductExpression.html
-  auto out_map = EigenMatrixMapRowMajor<T>(c_data, m, n);
-  out_map.noalias() = static_cast<T>(-2.) *
-                      (ConstEigenMatrixMapRowMajor<T>(a_data, m, k) *
-                       ConstEigenMatrixMapRowMajor<T>(b_data, n, k).transpose());
-#endif
-
-  // add a_ss and b_ss, with broadcast
-  // output shape is {m, n}
-  auto* cur_out = c_data;
-  for (int64_t i = 0; i < m; ++i) {
-    T a_val = a_ss[i];
-    for (int64_t j = 0; j < n; ++j) {
-      *cur_out = (*cur_out + a_val) + b_ss[j];
-      ++cur_out;
-    }
-  }
+  ComputeSqeuclidean(a_data, b_data, c_data, a_ss_data, b_ss_data, m, n, k, threadpool);
 }
 
 template <typename T>
@@ -114,15 +174,20 @@ common::Status CDist<T>::Compute(OpKernelContext* context) const {
   T* output = C->MutableData<T>();
 
   CalculateSqeuclidean<T>(*A, *B, *C, tp);
-  auto map_out = EigenVectorArrayMap<T>(output, output_shape.Size());
 
   // because we use GEMM in CalculateSqeuclidean there's a slight chance a number extremely close to zero
   // could be negative, so we need to run abs() to avoid NaN's in the results.
-  if (mode_ == Mode::EUCLIDEAN) {
-    map_out = map_out.abs().sqrt();  // do both abs and sqrt in one call so Eigen has a chance to combine
-  } else if (mode_ == Mode::SQEUCLIDEAN) {
-    map_out = map_out.abs();
-  }
+  const Mode mode = mode_;
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(output_shape.Size()), 2.0 * sizeof(T),
+      [output, mode](std::ptrdiff_t begin, std::ptrdiff_t end) {
+        auto map_out = EigenVectorArrayMap<T>(output + begin, end - begin);
+        if (mode == Mode::EUCLIDEAN) {
+          map_out = map_out.abs().sqrt();  // do both abs and sqrt in one call so Eigen has a chance to combine
+        } else if (mode == Mode::SQEUCLIDEAN) {
+          map_out = map_out.abs();
+        }
+      });
 
   return Status::OK();
 }
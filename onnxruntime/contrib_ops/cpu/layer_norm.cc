@@ -5,6 +5,7 @@
 
 #include "core/common/safeint.h"
 #include "core/framework/tensor.h"
+#include "core/mlas/inc/mlas.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/util/math_cpuonly.h"
@@ -12,6 +13,29 @@
 namespace onnxruntime {
 namespace contrib {
 
+namespace {
+
+// Routes the float case to the fused MLAS layer normalization primitive,
+// which reduces and normalizes each row in a single pass with vectorized
+// kernels. Returns false for other types so the generic path runs.
+bool TryMlasComputeLayerNorm(const float* X_data, const float* scale_data, const float* bias_data,
+                             float* Y_data, float* mean_data, float* inv_std_var_data,
+                             int64_t norm_count, int64_t norm_size, float epsilon, bool simplified,
+                             concurrency::ThreadPool* thread_pool) {
+  MlasComputeLayerNorm(X_data, scale_data, bias_data, Y_data, mean_data, inv_std_var_data,
+                       static_cast<size_t>(norm_count), static_cast<size_t>(norm_size),
+                       epsilon, simplified, thread_pool);
+  return true;
+}
+
+template <typename T>
+bool TryMlasComputeLayerNorm(const T*, const T*, const T*, T*, T*, T*,
+                             int64_t, int64_t, float, bool, concurrency::ThreadPool*) {
+  return false;
+}
+
+}  // namespace
+
 #define REGISTER_KERNEL_TYPED(T)                                  \
   ONNX_OPERATOR_TYPED_KERNEL_EX(                                  \
       LayerNormalization,                                         \
@@ -101,6 +125,12 @@ Status LayerNorm<T, simplified>::Compute(OpKernelContext* p_ctx) const {
     inv_std_var_data = static_cast<T*>(inv_std_var_data_buf_ptr.get());
   }
 
+  if (TryMlasComputeLayerNorm(X_data, scale_data, bias_data, Y_data, mean_data, inv_std_var_data,
+                              norm_count, norm_size, epsilon_, simplified,
+                              p_ctx->GetOperatorThreadPool())) {
+    return Status::OK();
+  }
+
   concurrency::ThreadPool::TryBatchParallelFor(p_ctx->GetOperatorThreadPool(), static_cast<int32_t>(norm_count),
                                                [&](ptrdiff_t task_idx) {
                                                  const T* p_input = X_data + task_idx * norm_size;
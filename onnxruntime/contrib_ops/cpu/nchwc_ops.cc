@@ -82,7 +82,8 @@ Status ReorderInput::Compute(OpKernelContext* context) const {
   ORT_ENFORCE((X_shape[1] % MlasNchwcGetBlockSize()) == 0);
 
   auto* Y = context->Output(0, X_shape);
-  MlasReorderInput(X_shape.GetDims().data(), X->template Data<float>(), Y->template MutableData<float>());
+  MlasReorderInput(X_shape.GetDims().data(), X->template Data<float>(), Y->template MutableData<float>(),
+                   context->GetOperatorThreadPool());
 
   return Status::OK();
 }
@@ -109,7 +110,7 @@ Status ReorderOutput::Compute(OpKernelContext* context) const {
   if (channels_last_) {
     MlasReorderOutputNhwc(Y_shape.data(), x_data, y_data);
   } else {
-    MlasReorderOutputNchw(Y_shape.data(), x_data, y_data);
+    MlasReorderOutputNchw(Y_shape.data(), x_data, y_data, context->GetOperatorThreadPool());
   }
 
   return Status::OK();
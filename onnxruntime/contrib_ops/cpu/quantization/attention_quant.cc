@@ -28,6 +28,15 @@ class QAttention : public OpKernel, public AttentionCPUBase {
 #endif
 
  private:
+  // int8 attention core used when no past/present state is involved: quantizes the
+  // projected Q/K/V per head and runs both the QK' and probabilities x V products
+  // through the int8 GEMM, requantizing the softmax output in between
+  Status ComputeQuantizedAttention(const float* Q, const float* K, const float* V,
+                                   const Tensor* mask_index, Tensor* output,
+                                   int batch_size, int sequence_length,
+                                   int head_size, int hidden_size,
+                                   AllocatorPtr allocator, OpKernelContext* context) const;
+
   BufferUniquePtr packed_weights_;
   size_t packed_weights_size_;
   TensorShape weight_shape_;
@@ -249,11 +258,119 @@ Status QAttention<T>::Compute(OpKernelContext* context) const {
     });
   }
 
-  // Compute the attention score and apply the score to V
+  // Compute the attention score and apply the score to V.
+  // Without past/present state to carry in float, the attention core can stay in int8
+  // end-to-end - fall back to the shared float implementation otherwise.
+  if (nullptr == past_tensor) {
+    std::vector<int64_t> present_dims{2, batch_size, num_heads_, sequence_length, head_size};
+    if (nullptr == context->Output(1, TensorShape(present_dims))) {
+      return ComputeQuantizedAttention(Q, K, V, mask_index, output,
+                                       batch_size, sequence_length, head_size, hidden_size,
+                                       allocator, context);
+    }
+  }
+
   return ApplyAttention(Q, K, V, mask_index, past_tensor, output,
                         batch_size, sequence_length,
                         head_size, hidden_size, context);
 }
 
+template <typename T>
+Status QAttention<T>::ComputeQuantizedAttention(const float* Q, const float* K, const float* V,
+                                                const Tensor* mask_index, Tensor* output,
+                                                int batch_size, int sequence_length,
+                                                int head_size, int hidden_size,
+                                                AllocatorPtr allocator, OpKernelContext* context) const {
+  auto* tp = context->GetOperatorThreadPool();
+
+  // Prepare the additive mask the same way the float path does (shape BxSxS)
+  void* mask_data = nullptr;
+  if (mask_index != nullptr || (is_unidirectional_ && sequence_length > 1)) {
+    size_t mask_data_bytes = SafeInt<size_t>(batch_size) * sequence_length * sequence_length * sizeof(float);
+    mask_data = allocator->Alloc(mask_data_bytes);
+    memset(mask_data, 0, mask_data_bytes);
+    PrepareMask(mask_index != nullptr ? mask_index->template Data<int32_t>() : nullptr,
+                mask_index != nullptr ? &(mask_index->Shape().GetDims()) : nullptr,
+                static_cast<float*>(mask_data), is_unidirectional_, batch_size, sequence_length, 0);
+  }
+  BufferUniquePtr mask_data_buffer(mask_data, BufferDeleter(allocator));
+
+  const float alpha = 1.0f / sqrt(static_cast<float>(head_size));
+  const int loop_len = batch_size * num_heads_;
+  const size_t chunk_length = static_cast<size_t>(sequence_length) * head_size;   // S x H
+  const size_t scores_length = static_cast<size_t>(sequence_length) * sequence_length;  // S x S
+
+  // Softmax output lies in [0, 1], so the probabilities requantize with a fixed scale
+  constexpr float probability_scale = 1.0f / 255.0f;
+
+  float* output_data = output->template MutableData<float>();
+
+  ThreadPool::TrySimpleParallelFor(tp, loop_len, [&](std::ptrdiff_t i) {
+    const int batch_index = static_cast<int>(i / num_heads_);
+    const int head_index = static_cast<int>(i % num_heads_);
+
+    const float* q = Q + chunk_length * i;
+    const float* k = K + chunk_length * i;
+    const float* v = V + chunk_length * i;
+
+    std::vector<uint8_t> q_quant(chunk_length);
+    std::vector<uint8_t> k_quant(chunk_length);
+    std::vector<uint8_t> k_transposed(chunk_length);
+    std::vector<uint8_t> v_quant(chunk_length);
+    std::vector<float> scores(scores_length);
+    std::vector<uint8_t> prob_quant(scores_length);
+    std::vector<int32_t> out_buffer(chunk_length);
+
+    // Dynamic per-head quantization of the projected Q/K/V chunks
+    float q_scale, k_scale, v_scale;
+    uint8_t q_zero_point, k_zero_point, v_zero_point;
+    GetQuantizationParameter<uint8_t>(q, static_cast<int64_t>(chunk_length), q_scale, q_zero_point);
+    GetQuantizationParameter<uint8_t>(k, static_cast<int64_t>(chunk_length), k_scale, k_zero_point);
+    GetQuantizationParameter<uint8_t>(v, static_cast<int64_t>(chunk_length), v_scale, v_zero_point);
+    MlasQuantizeLinear(q, q_quant.data(), chunk_length, q_scale, q_zero_point);
+    MlasQuantizeLinear(k, k_quant.data(), chunk_length, k_scale, k_zero_point);
+    MlasQuantizeLinear(v, v_quant.data(), chunk_length, v_scale, v_zero_point);
+
+    // The int8 GEMM multiplies A x B with B untransposed, so transpose K: SxH -> HxS
+    MlasTranspose(k_quant.data(), k_transposed.data(), sequence_length, head_size);
+
+    // scores(S, S) = 1/sqrt(H) x q x k' - dequantized straight into the float buffer
+    const float score_scale = q_scale * k_scale * alpha;
+    MLAS_QGEMM_SCALE_BIAS_OUTPUT_PROCESSOR score_processor(scores.data(), sequence_length,
+                                                           &score_scale, nullptr);
+    MlasGemm(sequence_length, sequence_length, head_size,
+             q_quant.data(), head_size, q_zero_point,
+             k_transposed.data(), sequence_length, k_zero_point, false,
+             reinterpret_cast<int32_t*>(scores.data()), sequence_length,
+             nullptr, &score_processor);
+
+    // Mask and softmax stay in float
+    if (nullptr != mask_data) {
+      const float* mask_base = static_cast<const float*>(mask_data) +
+                               static_cast<size_t>(batch_index) * scores_length;
+      for (size_t j = 0; j < scores_length; ++j) {
+        scores[j] += mask_base[j];
+      }
+    }
+    MlasComputeSoftmax(scores.data(), scores.data(), sequence_length, sequence_length, false, nullptr);
+
+    // Requantize the probabilities and aggregate V, writing each head chunk straight
+    // into its strided location in out(B, S, N, H)
+    MlasQuantizeLinear(scores.data(), prob_quant.data(), scores_length, probability_scale,
+                       static_cast<uint8_t>(0));
+
+    const float out_scale = probability_scale * v_scale;
+    float* dest = output_data + (static_cast<size_t>(batch_index) * sequence_length * num_heads_ + head_index) * head_size;
+    MLAS_QGEMM_SCALE_BIAS_OUTPUT_PROCESSOR out_processor(dest, hidden_size, &out_scale, nullptr);
+    MlasGemm(sequence_length, head_size, sequence_length,
+             prob_quant.data(), sequence_length, static_cast<uint8_t>(0),
+             v_quant.data(), head_size, v_zero_point, false,
+             out_buffer.data(), head_size,
+             nullptr, &out_processor);
+  });
+
+  return Status::OK();
+}
+
 }  // namespace contrib
 }  // namespace onnxruntime
@@ -130,16 +130,18 @@ Status DynamicQuantizeMatMul::Compute(OpKernelContext* ctx) const {
   const float* a_data = a->template Data<float>();
   int64_t num_of_elements = a->Shape().Size();
 
+  concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
+
   float a_scale;
   uint8_t a_zero_point;
-  GetQuantizationParameter(a_data, num_of_elements, a_scale, a_zero_point);
+  GetQuantizationParameter(a_data, num_of_elements, a_scale, a_zero_point, thread_pool);
 
   AllocatorPtr allocator;
   ORT_RETURN_IF_ERROR(ctx->GetTempSpaceAllocator(&allocator));
   uint8_t* a_data_quant = static_cast<uint8_t*>(allocator->Alloc(SafeInt<size_t>(num_of_elements) * sizeof(uint8_t)));
   BufferUniquePtr a_buffer_quant_holder(a_data_quant, BufferDeleter(allocator));
   // quantize the data
-  MlasQuantizeLinear(a_data, a_data_quant, num_of_elements, a_scale, a_zero_point);
+  MlasQuantizeLinear(a_data, a_data_quant, num_of_elements, a_scale, a_zero_point, thread_pool);
 
   return ComputeCommon(ctx,
                        a_data_quant,
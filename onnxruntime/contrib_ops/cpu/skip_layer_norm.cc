@@ -107,23 +107,32 @@ Status SkipLayerNorm<T>::Compute(OpKernelContext* p_ctx) const {
                                                  T mean = 0;
                                                  T mean_square = 0;
 
-                                                 for (int64_t h = 0; h < hidden_size; h++) {
-                                                   T value = p_input[h] + p_skip[h];
-                                                   if (nullptr != bias_data) {
-                                                     value += bias_data[h];
+                                                 // keep the bias check out of the element loop so both variants vectorize
+                                                 if (nullptr != bias_data) {
+                                                   for (int64_t h = 0; h < hidden_size; h++) {
+                                                     T value = p_input[h] + p_skip[h] + bias_data[h];
+                                                     p_output[h] = value;
+                                                     mean += value;
+                                                     mean_square += value * value;
+                                                   }
+                                                 } else {
+                                                   for (int64_t h = 0; h < hidden_size; h++) {
+                                                     T value = p_input[h] + p_skip[h];
+                                                     p_output[h] = value;
+                                                     mean += value;
+                                                     mean_square += value * value;
                                                    }
-                                                   p_output[h] = value;
-                                                   mean += value;
-                                                   mean_square += value * value;
                                                  }
 
                                                  mean = mean / hidden_size;
                                                  mean_square = sqrt(mean_square / hidden_size - mean * mean + epsilon_);
 
-                                                 for (int64_t h = 0; h < hidden_size; h++) {
-                                                   if (nullptr == beta_data) {
+                                                 if (nullptr == beta_data) {
+                                                   for (int64_t h = 0; h < hidden_size; h++) {
                                                      p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h];
-                                                   } else {
+                                                   }
+                                                 } else {
+                                                   for (int64_t h = 0; h < hidden_size; h++) {
                                                      p_output[h] = (p_output[h] - mean) / mean_square * gamma_data[h] + beta_data[h];
                                                    }
                                                  }
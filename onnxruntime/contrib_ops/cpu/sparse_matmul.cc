@@ -0,0 +1,144 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/common.h"
+#include "core/framework/op_kernel.h"
+#include "core/framework/sparse_tensor.h"
+#include "core/platform/threadpool.h"
+#include "core/util/math_cpuonly.h"
+
+#include <vector>
+
+namespace onnxruntime {
+namespace contrib {
+
+// Multiplies a 2-D sparse matrix A (COO or CSR format) with a 2-D dense matrix B without
+// materializing A densely. The work is parallelized over the rows of A, and each non-zero
+// contributes a vectorized row-scaled accumulation into the output row.
+class SparseMatMul final : public OpKernel {
+ public:
+  explicit SparseMatMul(const OpKernelInfo& info) : OpKernel(info) {}
+  Status Compute(OpKernelContext* ctx) const override;
+
+ private:
+  template <typename T>
+  static Status ComputeImpl(const SparseTensor& A, const Tensor& B, Tensor& Y,
+                            concurrency::ThreadPool* thread_pool);
+};
+
+ONNX_OPERATOR_KERNEL_EX(
+    SparseMatMul,
+    kMSDomain,
+    1,
+    kCpuExecutionProvider,
+    KernelDefBuilder()
+        .TypeConstraint("T1", std::vector<MLDataType>{DataTypeImpl::GetSparseTensorType<float>(),
+                                                      DataTypeImpl::GetSparseTensorType<double>()})
+        .TypeConstraint("T", std::vector<MLDataType>{DataTypeImpl::GetTensorType<float>(),
+                                                     DataTypeImpl::GetTensorType<double>()}),
+    SparseMatMul);
+
+template <typename T>
+Status SparseMatMul::ComputeImpl(const SparseTensor& A, const Tensor& B, Tensor& Y,
+                                 concurrency::ThreadPool* thread_pool) {
+  const auto& a_shape = A.Shape();
+  const int64_t M = a_shape[0];
+  const int64_t K = a_shape[1];
+  const int64_t N = B.Shape()[1];
+  const int64_t nnz = static_cast<int64_t>(A.NumValues());
+
+  const T* a_values = A.Values().Data<T>();
+  const T* b_data = B.Data<T>();
+  T* y_data = Y.MutableData<T>();
+
+  // bring COO input into CSR form so the multiply can be partitioned by output row. the counting
+  // sort is stable and costs O(NNZ), which is negligible against the multiply itself.
+  const int64_t* inner_indices = nullptr;
+  const int64_t* outer_indices = nullptr;
+  std::vector<int64_t> converted_inner;
+  std::vector<int64_t> converted_outer;
+  std::vector<T> converted_values;
+  if (A.Format() == SparseFormat::kCsr) {
+    inner_indices = A.InnerIndices().Data<int64_t>();
+    outer_indices = A.OuterIndices().Data<int64_t>();
+    ORT_RETURN_IF_NOT(A.OuterIndices().Shape().Size() == M + 1,
+                      "Outer indices must have [rows + 1] entries. Got: ", A.OuterIndices().Shape());
+    ORT_RETURN_IF_NOT(outer_indices[0] == 0 && outer_indices[M] == nnz,
+                      "Outer indices must start at 0 and end at NNZ.");
+    for (int64_t i = 0; i < M; ++i) {
+      ORT_RETURN_IF_NOT(outer_indices[i] <= outer_indices[i + 1], "Outer indices must be non-decreasing.");
+    }
+    for (int64_t i = 0; i < nnz; ++i) {
+      ORT_RETURN_IF_NOT(inner_indices[i] >= 0 && inner_indices[i] < K,
+                        "Inner index out of range: ", inner_indices[i]);
+    }
+  } else {
+    const int64_t* coo_indices = A.Indices().Data<int64_t>();
+    converted_outer.assign(M + 1, 0);
+    converted_inner.resize(nnz);
+    converted_values.resize(nnz);
+    for (int64_t i = 0; i < nnz; ++i) {
+      const int64_t row = coo_indices[i * 2];
+      const int64_t col = coo_indices[i * 2 + 1];
+      ORT_RETURN_IF_NOT(row >= 0 && row < M && col >= 0 && col < K,
+                        "COO index out of range: (", row, ", ", col, ")");
+      ++converted_outer[row + 1];
+    }
+    for (int64_t i = 0; i < M; ++i) {
+      converted_outer[i + 1] += converted_outer[i];
+    }
+    std::vector<int64_t> cursor(converted_outer.begin(), converted_outer.end() - 1);
+    for (int64_t i = 0; i < nnz; ++i) {
+      const int64_t pos = cursor[coo_indices[i * 2]]++;
+      converted_inner[pos] = coo_indices[i * 2 + 1];
+      converted_values[pos] = a_values[i];
+    }
+    inner_indices = converted_inner.data();
+    outer_indices = converted_outer.data();
+    a_values = converted_values.data();
+  }
+
+  // per output row: read the B rows of the row's non-zeros, write the output row once
+  const double avg_nnz_per_row = M > 0 ? static_cast<double>(nnz) / M : 0.0;
+  concurrency::ThreadPool::TryParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(M),
+      {avg_nnz_per_row * N * sizeof(T), static_cast<double>(N * sizeof(T)), avg_nnz_per_row * N * 2.0},
+      [y_data, b_data, a_values, inner_indices, outer_indices, N](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t row = first; row < last; ++row) {
+          EigenVectorArrayMap<T> y_row(y_data + row * N, N);
+          y_row.setZero();
+          for (int64_t idx = outer_indices[row]; idx < outer_indices[row + 1]; ++idx) {
+            ConstEigenVectorArrayMap<T> b_row(b_data + inner_indices[idx] * N, N);
+            y_row += a_values[idx] * b_row;
+          }
+        }
+      });
+
+  return Status::OK();
+}
+
+Status SparseMatMul::Compute(OpKernelContext* ctx) const {
+  const SparseTensor& A = *ctx->Input<SparseTensor>(0);
+  const Tensor& B = *ctx->Input<Tensor>(1);
+
+  const auto& a_shape = A.Shape();
+  const auto& b_shape = B.Shape();
+  ORT_RETURN_IF_NOT(a_shape.NumDimensions() == 2, "A must be a 2-dimensional sparse matrix. Got: ", a_shape);
+  ORT_RETURN_IF_NOT(b_shape.NumDimensions() == 2, "B must be a 2-dimensional matrix. Got: ", b_shape);
+  ORT_RETURN_IF_NOT(a_shape[1] == b_shape[0],
+                    "Inner dimensions must match. Got A: ", a_shape, " B: ", b_shape);
+
+  Tensor* Y = ctx->Output(0, {a_shape[0], b_shape[1]});
+
+  if (A.Values().IsDataType<float>()) {
+    return ComputeImpl<float>(A, B, *Y, ctx->GetOperatorThreadPool());
+  }
+  if (A.Values().IsDataType<double>()) {
+    return ComputeImpl<double>(A, B, *Y, ctx->GetOperatorThreadPool());
+  }
+  return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                         "Unsupported element type: ", DataTypeImpl::ToString(A.Values().DataType()));
+}
+
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -217,6 +217,76 @@ __device__ inline void SoftmaxWithRawMaskSmall(const int all_sequence_length,
   }
 }
 
+template <typename T, unsigned TPB>
+__device__ inline void SoftmaxWithRawMask(const int all_sequence_length,
+                                          const int sequence_length,
+                                          const int* attention_mask,  // 2D or 3D attention mask
+                                          const T* input,
+                                          T* output,
+                                          const bool is_unidirectional,
+                                          const float scalar,
+                                          const int mask_dimension) {
+  // Strided fallback of SoftmaxWithRawMaskSmall for all_sequence_length > TPB. The masked and
+  // scaled score is recomputed in each pass instead of staged through global memory.
+  using BlockReduce = cub::BlockReduce<float, TPB>;
+  __shared__ typename BlockReduce::TempStorage tmp_storage;
+
+  __shared__ float sum_reverse_block;
+  __shared__ float max_block;
+
+  // Input dimension is BxNxSxS*; blockIdx.y is batch index b; gridDim.x=N*S;  blockIdx.x is index within N*S;
+  const int offset = (blockIdx.y * gridDim.x + blockIdx.x) * all_sequence_length;
+  const int batch_index = blockIdx.y;
+  const int sequence_index = blockIdx.x % sequence_length;
+  const int mask_offset = (mask_dimension == 2) ? batch_index * all_sequence_length : batch_index * sequence_length * all_sequence_length + sequence_index * all_sequence_length;
+  const int from_index = all_sequence_length - sequence_length + sequence_index;  // offset of from token in all sequence length.
+
+  float thread_data_max(-CUDART_INF_F);
+  for (int i = threadIdx.x; i < all_sequence_length; i += TPB) {
+    float mask_value = attention_mask[mask_offset + i] > 0 ? 0.0f : -10000.0f;
+    if (is_unidirectional && i > from_index) {
+      mask_value += -10000.0f;
+    }
+    const float val = float(input[offset + i]) * scalar + mask_value;
+    if (thread_data_max < val) {
+      thread_data_max = val;
+    }
+  }
+
+  const auto max = BlockReduce(tmp_storage).Reduce(thread_data_max, cub::Max());
+
+  // Store max value
+  if (threadIdx.x == 0) {
+    max_block = max;
+  }
+  __syncthreads();
+
+  float thread_data_sum(0.f);
+  for (int i = threadIdx.x; i < all_sequence_length; i += TPB) {
+    float mask_value = attention_mask[mask_offset + i] > 0 ? 0.0f : -10000.0f;
+    if (is_unidirectional && i > from_index) {
+      mask_value += -10000.0f;
+    }
+    const float val = float(input[offset + i]) * scalar + mask_value;
+    thread_data_sum += expf(val - max_block);
+  }
+
+  const auto sum = BlockReduce(tmp_storage).Reduce(thread_data_sum, cub::Sum());
+  if (threadIdx.x == 0) {
+    sum_reverse_block = 1.f / sum;
+  }
+  __syncthreads();
+
+  for (int i = threadIdx.x; i < all_sequence_length; i += TPB) {
+    float mask_value = attention_mask[mask_offset + i] > 0 ? 0.0f : -10000.0f;
+    if (is_unidirectional && i > from_index) {
+      mask_value += -10000.0f;
+    }
+    const float val = float(input[offset + i]) * scalar + mask_value;
+    output[offset + i] = T(expf(val - max_block) * sum_reverse_block);
+  }
+}
+
 template <typename T, unsigned TPB>
 __global__ void SoftmaxKernelSmall(const int all_sequence_length, const int sequence_length, const T* input, T* output, bool is_unidirectional) {
   SoftmaxSmall<T, TPB>(all_sequence_length, sequence_length, all_sequence_length, 0, input, output, is_unidirectional);
@@ -307,6 +377,11 @@ __global__ void SoftmaxWithRawMaskSmallKernel(const int all_sequence_length, con
   SoftmaxWithRawMaskSmall<T, TPB>(all_sequence_length, sequence_length, attention_mask, input, output, is_unidirectional, scalar, mask_dimension);
 }
 
+template <typename T, unsigned TPB>
+__global__ void SoftmaxWithRawMaskKernel(const int all_sequence_length, const int sequence_length, const int* attention_mask, const T* input, T* output, const bool is_unidirectional, const float scalar, const int mask_dimension) {
+  SoftmaxWithRawMask<T, TPB>(all_sequence_length, sequence_length, attention_mask, input, output, is_unidirectional, scalar, mask_dimension);
+}
+
 template <typename T>
 bool ComputeSoftmaxWithMask1D(cudaStream_t stream, const int all_sequence_length, const int sequence_length, const int batch_size, const int num_heads,
                               const int* mask_index, const int* mask_start, const T* input, T* output, const bool is_unidirectional) {
@@ -378,7 +453,9 @@ bool ComputeSoftmaxWithRawMask(cudaStream_t stream, const int all_sequence_lengt
     SoftmaxWithRawMaskSmallKernel<T, blockSize>
         <<<grid, blockSize, 0, stream>>>(all_sequence_length, sequence_length, attention_mask, input, output, is_unidirectional, scalar, mask_dimension);
   } else {
-    ORT_THROW("Attention CUDA operator does not supported 2D attention mask with total sequence length > 1024.");
+    const int blockSize = 1024;
+    SoftmaxWithRawMaskKernel<T, blockSize>
+        <<<grid, blockSize, 0, stream>>>(all_sequence_length, sequence_length, attention_mask, input, output, is_unidirectional, scalar, mask_dimension);
   }
 
   return CUDA_CALL(cudaPeekAtLastError());
@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cuda/math/fused_elementwise.h"
+
+#include <algorithm>
+
+#include "core/framework/data_types_internal.h"
+
+using namespace onnxruntime;
+using namespace onnxruntime::cuda;
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+ONNX_OPERATOR_KERNEL_EX(
+    FusedElementwise,
+    kMSDomain,
+    1,
+    kCudaExecutionProvider,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::AllIEEEFloatTensorTypes()),
+    FusedElementwise);
+
+namespace {
+
+// maps the original op type plus the reversed flag to the kernel op code.
+// returns -1 for op types the kernel does not interpret.
+int32_t OpCodeFromOpType(const std::string& op_type, bool reversed) {
+  if (op_type == "Add") return static_cast<int32_t>(FusedElementwiseOpCode::Add);
+  if (op_type == "Sub") return static_cast<int32_t>(reversed ? FusedElementwiseOpCode::SubReversed : FusedElementwiseOpCode::Sub);
+  if (op_type == "Mul") return static_cast<int32_t>(FusedElementwiseOpCode::Mul);
+  if (op_type == "Div") return static_cast<int32_t>(reversed ? FusedElementwiseOpCode::DivReversed : FusedElementwiseOpCode::Div);
+  if (op_type == "Sigmoid") return static_cast<int32_t>(FusedElementwiseOpCode::Sigmoid);
+  if (op_type == "Tanh") return static_cast<int32_t>(FusedElementwiseOpCode::Tanh);
+  if (op_type == "Relu") return static_cast<int32_t>(FusedElementwiseOpCode::Relu);
+  if (op_type == "Exp") return static_cast<int32_t>(FusedElementwiseOpCode::Exp);
+  if (op_type == "Sqrt") return static_cast<int32_t>(FusedElementwiseOpCode::Sqrt);
+  if (op_type == "Neg") return static_cast<int32_t>(FusedElementwiseOpCode::Neg);
+  if (op_type == "Abs") return static_cast<int32_t>(FusedElementwiseOpCode::Abs);
+  return -1;
+}
+
+bool IsBinaryOpType(const std::string& op_type) {
+  return op_type == "Add" || op_type == "Sub" || op_type == "Mul" || op_type == "Div";
+}
+
+template <typename T>
+struct DispatchFusedElementwise {
+  void operator()(
+      cudaStream_t stream,
+      OpKernelContext* ctx,
+      const std::vector<int32_t>& op_codes,
+      const std::vector<bool>& has_operand) {
+    typedef typename onnxruntime::cuda::ToCudaType<T>::MappedType CudaT;
+
+    const Tensor* X = ctx->Input<Tensor>(0);
+    Tensor* Y = ctx->Output(0, X->Shape());
+
+    FusedElementwiseProgram<CudaT> program{};
+    program.num_ops = static_cast<int32_t>(op_codes.size());
+
+    int operand_input = 1;
+    for (size_t i = 0; i < op_codes.size(); i++) {
+      program.op_codes[i] = op_codes[i];
+      if (has_operand[i]) {
+        const Tensor* operand = ctx->Input<Tensor>(operand_input++);
+        const bool is_scalar = operand->Shape().Size() == 1;
+        ORT_ENFORCE(is_scalar || operand->Shape().Size() == X->Shape().Size(),
+                    "FusedElementwise operand must be a scalar or match the chain input element count.");
+        program.operands[i] = reinterpret_cast<const CudaT*>(operand->template Data<T>());
+        program.operand_is_scalar[i] = is_scalar ? 1 : 0;
+      }
+    }
+
+    FusedElementwiseImpl<CudaT>(
+        stream,
+        reinterpret_cast<const CudaT*>(X->template Data<T>()),
+        reinterpret_cast<CudaT*>(Y->template MutableData<T>()),
+        program,
+        X->Shape().Size());
+  }
+};
+
+}  // namespace
+
+FusedElementwise::FusedElementwise(const OpKernelInfo& info) : CudaKernel{info} {
+  std::vector<std::string> ops;
+  ORT_ENFORCE(info.GetAttrs<std::string>("ops", ops).IsOK(), "FusedElementwise requires the 'ops' attribute.");
+  ORT_ENFORCE(!ops.empty() && ops.size() <= static_cast<size_t>(kMaxFusedElementwiseOps),
+              "FusedElementwise supports 1 to ", kMaxFusedElementwiseOps, " ops, got ", ops.size(), ".");
+
+  std::vector<int64_t> reversed = info.GetAttrsOrDefault<int64_t>("reversed");
+  ORT_ENFORCE(reversed.empty() || reversed.size() == ops.size(),
+              "FusedElementwise 'reversed' attribute must match 'ops' in length.");
+
+  op_codes_.reserve(ops.size());
+  has_operand_.reserve(ops.size());
+  for (size_t i = 0; i < ops.size(); i++) {
+    const bool is_reversed = !reversed.empty() && reversed[i] != 0;
+    const int32_t op_code = OpCodeFromOpType(ops[i], is_reversed);
+    ORT_ENFORCE(op_code >= 0, "FusedElementwise does not support op type '", ops[i], "'.");
+    op_codes_.push_back(op_code);
+    has_operand_.push_back(IsBinaryOpType(ops[i]));
+  }
+}
+
+Status FusedElementwise::ComputeInternal(OpKernelContext* ctx) const {
+  const size_t binary_op_count = static_cast<size_t>(std::count(has_operand_.begin(), has_operand_.end(), true));
+  ORT_RETURN_IF_NOT(static_cast<size_t>(ctx->InputCount()) == 1 + binary_op_count,
+                    "FusedElementwise expects one input per binary op plus the chain input.");
+
+  const Tensor* X = ctx->Input<Tensor>(0);
+  utils::MLTypeCallDispatcher<double, float, MLFloat16> t_disp(X->GetElementType());
+  t_disp.Invoke<DispatchFusedElementwise>(Stream(), ctx, op_codes_, has_operand_);
+
+  return Status::OK();
+}
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,34 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <vector>
+
+#include "core/providers/cuda/cuda_kernel.h"
+#include "contrib_ops/cuda/math/fused_elementwise_impl.h"
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+// Evaluates a chain of pointwise ops in a single kernel launch, reading the
+// chain input and binary operands once and writing only the final output.
+// Nodes of this type are created by the ElementwiseChainFusion graph
+// transformer from adjacent Add/Sub/Mul/Div/activation nodes.
+class FusedElementwise final : public onnxruntime::cuda::CudaKernel {
+ public:
+  FusedElementwise(const OpKernelInfo& info);
+
+  Status ComputeInternal(OpKernelContext* context) const override;
+
+ private:
+  // one entry per fused step; has_operand_[i] marks the binary steps that
+  // consume the next variadic input in order
+  std::vector<int32_t> op_codes_;
+  std::vector<bool> has_operand_;
+};
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -0,0 +1,124 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "contrib_ops/cuda/math/fused_elementwise_impl.h"
+
+#include "core/providers/cuda/cu_inc/common.cuh"
+
+using namespace onnxruntime;
+using namespace onnxruntime::cuda;
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+// half is widened to float for the arithmetic; double stays double
+template <typename T>
+struct FusedElementwiseComputeType {
+  using type = float;
+};
+
+template <>
+struct FusedElementwiseComputeType<double> {
+  using type = double;
+};
+
+template <typename ComputeT>
+__device__ __forceinline__ ComputeT _ApplyFusedElementwiseOp(int32_t op_code, ComputeT value, ComputeT operand) {
+  switch (static_cast<FusedElementwiseOpCode>(op_code)) {
+    case FusedElementwiseOpCode::Add:
+      return value + operand;
+    case FusedElementwiseOpCode::Sub:
+      return value - operand;
+    case FusedElementwiseOpCode::SubReversed:
+      return operand - value;
+    case FusedElementwiseOpCode::Mul:
+      return value * operand;
+    case FusedElementwiseOpCode::Div:
+      return value / operand;
+    case FusedElementwiseOpCode::DivReversed:
+      return operand / value;
+    case FusedElementwiseOpCode::Sigmoid:
+      return ComputeT(1) / (ComputeT(1) + _Exp(-value));
+    case FusedElementwiseOpCode::Tanh:
+      return _Tanh(value);
+    case FusedElementwiseOpCode::Relu:
+      return value > ComputeT(0) ? value : ComputeT(0);
+    case FusedElementwiseOpCode::Exp:
+      return _Exp(value);
+    case FusedElementwiseOpCode::Sqrt:
+      return _Sqrt(value);
+    case FusedElementwiseOpCode::Neg:
+      return -value;
+    case FusedElementwiseOpCode::Abs:
+      return _Abs(value);
+    default:
+      return value;
+  }
+}
+
+template <typename T, int NumThreadsPerBlock, int NumElementsPerThread>
+__global__ void _FusedElementwise(
+    const T* input_data,
+    T* output_data,
+    const FusedElementwiseProgram<T> program,
+    CUDA_LONG N) {
+  using ComputeT = typename FusedElementwiseComputeType<T>::type;
+
+  CUDA_LONG start = NumElementsPerThread * NumThreadsPerBlock * blockIdx.x + threadIdx.x;
+
+  CUDA_LONG id = start;
+  #pragma unroll
+  for (int i = 0; i < NumElementsPerThread; i++) {
+    if (id < N) {
+      ComputeT value = static_cast<ComputeT>(input_data[id]);
+      for (int32_t j = 0; j < program.num_ops; j++) {
+        ComputeT operand = ComputeT(0);
+        if (program.operands[j] != nullptr) {
+          operand = static_cast<ComputeT>(program.operands[j][program.operand_is_scalar[j] ? 0 : id]);
+        }
+        value = _ApplyFusedElementwiseOp(program.op_codes[j], value, operand);
+      }
+      output_data[id] = static_cast<T>(value);
+      id += NumThreadsPerBlock;
+    }
+  }
+}
+
+template <typename T>
+void FusedElementwiseImpl(
+    cudaStream_t stream,
+    const T* input_data,
+    T* output_data,
+    const FusedElementwiseProgram<T>& program,
+    size_t count) {
+  if (count == 0)  // special case where there's a dim value of 0 in the shape
+    return;
+
+  int blocksPerGrid = static_cast<int>(CeilDiv(count, GridDim::maxThreadsPerBlock * GridDim::maxElementsPerThread));
+  CUDA_LONG N = static_cast<CUDA_LONG>(count);
+  _FusedElementwise<T, GridDim::maxThreadsPerBlock, GridDim::maxElementsPerThread>
+      <<<blocksPerGrid, GridDim::maxThreadsPerBlock, 0, stream>>>(
+          input_data,
+          output_data,
+          program,
+          N);
+}
+
+#define SPECIALIZED_FUSED_ELEMENTWISE_IMPL(T)  \
+  template void FusedElementwiseImpl<T>(       \
+      cudaStream_t stream,                     \
+      const T* input_data,                     \
+      T* output_data,                          \
+      const FusedElementwiseProgram<T>& program, \
+      size_t count);
+
+SPECIALIZED_FUSED_ELEMENTWISE_IMPL(half)
+SPECIALIZED_FUSED_ELEMENTWISE_IMPL(float)
+SPECIALIZED_FUSED_ELEMENTWISE_IMPL(double)
+
+#undef SPECIALIZED_FUSED_ELEMENTWISE_IMPL
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
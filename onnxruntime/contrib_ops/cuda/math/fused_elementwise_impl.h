@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+
+#include "core/providers/cuda/shared_inc/cuda_utils.h"
+
+namespace onnxruntime {
+namespace contrib {
+namespace cuda {
+
+// capacity of one fused program; the graph transformer splits longer chains
+constexpr int kMaxFusedElementwiseOps = 16;
+
+// op codes interpreted per element by the fused kernel. Reversed variants
+// exist for the non-commutative ops where the running value is the second
+// operand (e.g. operand - value).
+enum class FusedElementwiseOpCode : int32_t {
+  Add = 0,
+  Sub,
+  SubReversed,
+  Mul,
+  Div,
+  DivReversed,
+  Sigmoid,
+  Tanh,
+  Relu,
+  Exp,
+  Sqrt,
+  Neg,
+  Abs,
+};
+
+// small per-element program passed to the kernel by value. operands[i] is
+// nullptr for unary steps; scalar operands are read once and broadcast.
+template <typename T>
+struct FusedElementwiseProgram {
+  const T* operands[kMaxFusedElementwiseOps];
+  int32_t op_codes[kMaxFusedElementwiseOps];
+  int32_t operand_is_scalar[kMaxFusedElementwiseOps];
+  int32_t num_ops;
+};
+
+template <typename T>
+void FusedElementwiseImpl(
+    cudaStream_t stream,
+    const T* input_data,
+    T* output_data,
+    const FusedElementwiseProgram<T>& program,
+    size_t count);
+
+}  // namespace cuda
+}  // namespace contrib
+}  // namespace onnxruntime
@@ -16,6 +16,11 @@
 #endif
 #endif
 
+#if defined(__linux__) && (defined(__arm__) || defined(__aarch64__))
+#include <fstream>
+#include <sstream>
+#endif
+
 #include "core/common/cpuid_info.h"
 
 namespace onnxruntime {
@@ -72,6 +77,25 @@ CPUIDInfo::CPUIDInfo() noexcept {
       }
     }
   }
+#elif defined(__linux__) && (defined(__arm__) || defined(__aarch64__))
+  // On ARM big.LITTLE systems the kernel rates each core's relative throughput
+  // as its cpu_capacity; differing ratings mean a hybrid part.
+  long first_capacity = -1;
+  for (int cpu = 0;; ++cpu) {
+    std::ostringstream path;
+    path << "/sys/devices/system/cpu/cpu" << cpu << "/cpu_capacity";
+    std::ifstream capacity_file(path.str());
+    long capacity = -1;
+    if (!capacity_file || !(capacity_file >> capacity)) {
+      break;
+    }
+    if (cpu == 0) {
+      first_capacity = capacity;
+    } else if (capacity != first_capacity) {
+      is_hybrid_ = true;
+      break;
+    }
+  }
 #endif
 }
 
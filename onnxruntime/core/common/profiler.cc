@@ -3,6 +3,9 @@
 
 #include "profiler.h"
 
+#include <algorithm>
+#include <iterator>
+
 namespace onnxruntime {
 namespace profiling {
 using namespace std::chrono;
@@ -50,6 +53,11 @@ void Profiler::StartProfiling(const std::basic_string<T>& file_name) {
   enabled_ = true;
   profile_stream_.open(file_name, std::ios::out | std::ios::trunc);
   profile_stream_file_ = ToMBString(file_name);
+  if (streaming_) {
+    // in streaming mode records are appended as the buffers fill, so the array has to be
+    // opened up front.
+    profile_stream_ << "[\n";
+  }
   profiling_start_time_ = StartTime();
 }
 
@@ -70,21 +78,59 @@ void Profiler::EndTimeAndRecordEvent(EventCategory category,
                     logging::GetThreadId(), event_name, ts, dur, {event_args.begin(), event_args.end()});
   if (profile_with_logger_) {
     custom_logger_->SendProfileEvent(event);
-  } else {
-    //TODO: sync_gpu if needed.
-    std::lock_guard<OrtMutex> lock(mutex_);
-    if (events_.size() < max_num_events_) {
-      events_.emplace_back(event);
-    } else {
-      if (session_logger_ && !max_events_reached) {
-        LOGS(*session_logger_, ERROR)
-            << "Maximum number of events reached, could not record profile event.";
-        max_events_reached = true;
-      }
+    return;
+  }
+
+  //TODO: sync_gpu if needed.
+  if (num_events_.fetch_add(1, std::memory_order_relaxed) >= max_num_events_) {
+    if (session_logger_ && !max_events_reached.exchange(true)) {
+      LOGS(*session_logger_, ERROR)
+          << "Maximum number of events reached, could not record profile event.";
+    }
+    return;
+  }
+
+  EventBuffer& buffer = event_buffers_[static_cast<size_t>(event.tid) % kNumEventBuffers];
+  std::vector<EventRecord> full_buffer;
+  {
+    std::lock_guard<OrtMutex> lock(buffer.mutex);
+    buffer.events.emplace_back(std::move(event));
+    if (streaming_ && buffer.events.size() >= kStreamingFlushSize) {
+      // take the buffer's contents and write them outside its lock, so recording threads that
+      // hash to this buffer are never blocked on file I/O.
+      full_buffer.swap(buffer.events);
+    }
+  }
+  if (!full_buffer.empty()) {
+    std::lock_guard<OrtMutex> lock(stream_mutex_);
+    for (const auto& rec : full_buffer) {
+      WriteEventRecord(rec);
     }
   }
 }
 
+void Profiler::WriteEventRecord(const EventRecord& rec) {
+  if (wrote_event_) {
+    profile_stream_ << ",\n";
+  }
+  wrote_event_ = true;
+  profile_stream_ << R"({"cat" : ")" << event_categor_names_[rec.cat] << "\",";
+  profile_stream_ << "\"pid\" :" << rec.pid << ",";
+  profile_stream_ << "\"tid\" :" << rec.tid << ",";
+  profile_stream_ << "\"dur\" :" << rec.dur << ",";
+  profile_stream_ << "\"ts\" :" << rec.ts << ",";
+  profile_stream_ << R"("ph" : "X",)";
+  profile_stream_ << R"("name" :")" << rec.name << "\",";
+  profile_stream_ << "\"args\" : {";
+  bool is_first_arg = true;
+  for (const std::pair<const std::string, std::string>& event_arg : rec.args) {
+    if (!is_first_arg) profile_stream_ << ",";
+    profile_stream_ << "\"" << event_arg.first << "\" : \"" << event_arg.second << "\"";
+    is_first_arg = false;
+  }
+  profile_stream_ << "}}";
+}
+
 std::string Profiler::EndProfiling() {
   if (!enabled_) {
     return std::string();
@@ -98,33 +144,28 @@ std::string Profiler::EndProfiling() {
     LOGS(*session_logger_, INFO) << "Writing profiler data to file " << profile_stream_file_;
   }
 
-  std::lock_guard<OrtMutex> lock(mutex_);
-  profile_stream_ << "[\n";
-
-  for (size_t i = 0; i < events_.size(); ++i) {
-    auto& rec = events_[i];
-    profile_stream_ << R"({"cat" : ")" << event_categor_names_[rec.cat] << "\",";
-    profile_stream_ << "\"pid\" :" << rec.pid << ",";
-    profile_stream_ << "\"tid\" :" << rec.tid << ",";
-    profile_stream_ << "\"dur\" :" << rec.dur << ",";
-    profile_stream_ << "\"ts\" :" << rec.ts << ",";
-    profile_stream_ << R"("ph" : "X",)";
-    profile_stream_ << R"("name" :")" << rec.name << "\",";
-    profile_stream_ << "\"args\" : {";
-    bool is_first_arg = true;
-    for (std::pair<std::string, std::string> event_arg : rec.args) {
-      if (!is_first_arg) profile_stream_ << ",";
-      profile_stream_ << "\"" << event_arg.first << "\" : \"" << event_arg.second << "\"";
-      is_first_arg = false;
-    }
-    profile_stream_ << "}";
-    if (i == events_.size() - 1) {
-      profile_stream_ << "}\n";
-    } else {
-      profile_stream_ << "},\n";
-    }
+  // drain the per-thread buffers. in streaming mode this is just the tail that has not hit
+  // the flush threshold yet; everything else is already in the file.
+  std::vector<EventRecord> events;
+  for (auto& buffer : event_buffers_) {
+    std::lock_guard<OrtMutex> lock(buffer.mutex);
+    events.insert(events.end(), std::make_move_iterator(buffer.events.begin()),
+                  std::make_move_iterator(buffer.events.end()));
+    buffer.events.clear();
+  }
+  // merging the buffers loses the global recording order, so restore it by timestamp. events
+  // already streamed out keep their flush order, which the chrome tracing format allows.
+  std::stable_sort(events.begin(), events.end(),
+                   [](const EventRecord& a, const EventRecord& b) { return a.ts < b.ts; });
+
+  std::lock_guard<OrtMutex> lock(stream_mutex_);
+  if (!streaming_) {
+    profile_stream_ << "[\n";
+  }
+  for (const auto& rec : events) {
+    WriteEventRecord(rec);
   }
-  profile_stream_ << "]\n";
+  profile_stream_ << (wrote_event_ ? "\n]\n" : "]\n");
   profile_stream_.close();
   enabled_ = false;  // will not collect profile after writing.
   return profile_stream_file_;
@@ -8,6 +8,7 @@
 #include <initializer_list>
 #include <iostream>
 #include <tuple>
+#include <vector>
 
 #include "core/common/logging/logging.h"
 #include "core/platform/ort_mutex.h"
@@ -84,6 +85,15 @@ class Profiler {
   */
   std::string EndProfiling();
 
+  /*
+  Selects streaming mode. In streaming mode events are appended to the profile file
+  incrementally as the buffers fill instead of being held in memory until EndProfiling,
+  which bounds the profiler's memory use on long runs. Must be called before StartProfiling.
+  */
+  void SetStreamingMode(bool streaming) {
+    streaming_ = streaming;
+  }
+
   static Profiler& Instance() {
 #ifdef ENABLE_STATIC_PROFILER_INSTANCE
     ORT_ENFORCE(instance_ != nullptr);
@@ -118,16 +128,37 @@ class Profiler {
    */
   static std::atomic<size_t> global_max_num_events_;
 
-  // Mutex controlling access to profiler data
-  OrtMutex mutex_;
+  // Number of event buffers that recording threads are spread over by thread id. Only threads
+  // that hash to the same buffer contend with each other, so the count just needs to be large
+  // enough to make contention negligible on wide parallel runs.
+  static constexpr size_t kNumEventBuffers = 32;
+
+  // Number of buffered events in one buffer that triggers an incremental write in streaming mode.
+  static constexpr size_t kStreamingFlushSize = 1024;
+
+  struct EventBuffer {
+    OrtMutex mutex;
+    std::vector<EventRecord> events;
+  };
+
+  // Writes one event as a chrome tracing "complete event", including the separating comma
+  // between consecutive records. stream_mutex_ must be held.
+  void WriteEventRecord(const EventRecord& record);
+
+  // Mutex controlling access to the profile stream
+  OrtMutex stream_mutex_;
   bool enabled_{false};
+  bool streaming_{false};
+  // whether a record has been written yet, for comma placement. Guarded by stream_mutex_.
+  bool wrote_event_{false};
   std::ofstream profile_stream_;
   std::string profile_stream_file_;
   const logging::Logger* session_logger_{nullptr};
   const logging::Logger* custom_logger_{nullptr};
   TimePoint profiling_start_time_;
-  std::vector<EventRecord> events_;
-  bool max_events_reached{false};
+  EventBuffer event_buffers_[kNumEventBuffers];
+  std::atomic<size_t> num_events_{0};
+  std::atomic<bool> max_events_reached{false};
   bool profile_with_logger_{false};
   const size_t max_num_events_{global_max_num_events_.load()};
 
@@ -13,10 +13,15 @@ See the License for the specific language governing permissions and
 limitations under the License.
 ==============================================================================*/
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <memory>
+#include <unordered_map>
 
 #include "core/platform/threadpool.h"
 #include "core/common/common.h"
+#include "core/common/make_unique.h"
 #include "core/common/cpuid_info.h"
 #include "core/common/eigen_common_wrapper.h"
 #include "core/platform/EigenNonBlockingThreadPool.h"
@@ -180,6 +185,32 @@ ThreadPool::ThreadPool(Env* env,
 
 ThreadPool::~ThreadPool() = default;
 
+static thread_local ThreadPool::CancellationCheckpoint current_cancellation_checkpoint;
+
+ThreadPool::CancellationCheckpoint ThreadPool::SetThreadCancellationCheckpoint(
+    const CancellationCheckpoint& checkpoint) {
+  CancellationCheckpoint previous = current_cancellation_checkpoint;
+  current_cancellation_checkpoint = checkpoint;
+  return previous;
+}
+
+const ThreadPool::CancellationCheckpoint& ThreadPool::GetThreadCancellationCheckpoint() {
+  return current_cancellation_checkpoint;
+}
+
+static thread_local ThreadPool::SchedulingPriority current_scheduling_priority{
+    ThreadPool::SchedulingPriority::kNormal};
+
+ThreadPool::SchedulingPriority ThreadPool::SetThreadSchedulingPriority(SchedulingPriority priority) {
+  SchedulingPriority previous = current_scheduling_priority;
+  current_scheduling_priority = priority;
+  return previous;
+}
+
+ThreadPool::SchedulingPriority ThreadPool::GetThreadSchedulingPriority() {
+  return current_scheduling_priority;
+}
+
 // Base case for parallel loops, running iterations 0..total, divided into blocks
 // of block_size iterations, and calling into a function that takes a start..end
 // range of indices to run.
@@ -201,12 +232,31 @@ void ThreadPool::ParallelForFixedBlockSizeScheduling(const std::ptrdiff_t total,
   int num_work_items = static_cast<int>(std::min(static_cast<std::ptrdiff_t>(d_of_p), num_blocks));
   assert(num_work_items > 0);
 
+  // Snapshot the cancellation checkpoint of the thread starting the loop so that the worker
+  // threads helping with it observe the same state. Cancellation leaves the remaining blocks
+  // unprocessed; see the CancellationCheckpoint documentation for the contract.
+  const CancellationCheckpoint cancellation = GetThreadCancellationCheckpoint();
+  // blocks from cost-based sharding are coarse enough for a clock read each; only the
+  // single-iteration blocks of SimpleParallelFor need the deadline check rate-limited
+  const unsigned deadline_check_interval = block_size == 1 ? kBlocksPerDeadlineCheck : 1;
+
   LoopCounter lc(total, d_of_p, block_size);
   std::function<void(unsigned)> run_work = [&](unsigned idx) {
     unsigned my_home_shard = lc.GetHomeShard(idx);
     unsigned my_shard = my_home_shard;
     uint64_t my_iter_start, my_iter_end;
+    unsigned blocks_since_deadline_check = 0;
     while (lc.ClaimIterations(my_home_shard, my_shard, my_iter_start, my_iter_end)) {
+      if (cancellation.terminate != nullptr && *cancellation.terminate) {
+        break;
+      }
+      if (cancellation.deadline != std::chrono::steady_clock::time_point::max() &&
+          ++blocks_since_deadline_check >= deadline_check_interval) {
+        blocks_since_deadline_check = 0;
+        if (std::chrono::steady_clock::now() >= cancellation.deadline) {
+          break;
+        }
+      }
       fn(static_cast<std::ptrdiff_t>(my_iter_start),
          static_cast<std::ptrdiff_t>(my_iter_end));
     }
@@ -246,7 +296,8 @@ ThreadPool::ParallelSection::ParallelSection(ThreadPool *tp) {
   tp_ = tp;
   if (tp && tp->underlying_threadpool_) {
     ps_ = tp->underlying_threadpool_->AllocateParallelSection();
-    tp_->underlying_threadpool_->StartParallelSection(*ps_.get());
+    tp_->underlying_threadpool_->StartParallelSection(
+        *ps_.get(), GetThreadSchedulingPriority() == SchedulingPriority::kHigh);
     current_parallel_section = this;
   }
 #endif
@@ -272,7 +323,8 @@ void ThreadPool::RunInParallel(std::function<void(unsigned idx)> fn, unsigned n)
                                                    n);
     } else {
       underlying_threadpool_->RunInParallel(std::move(fn),
-                                            n);
+                                            n,
+                                            GetThreadSchedulingPriority() == SchedulingPriority::kHigh);
     }
   } else {
     fn(0);
@@ -300,6 +352,70 @@ bool ThreadPool::ShouldParallelizeLoop(const std::ptrdiff_t num_iterations,
 
 using CostModel = Eigen::TensorCostModel<Eigen::ThreadPoolDevice>;
 
+// Measured per-iteration costs of parallel loops, keyed by the loop's static TensorOpCost
+// estimate and a power-of-two bucket of its iteration count. Kernels' static cost guesses are
+// often wildly off, waking many threads for loops that finish in a few microseconds; after a few
+// warmup measurements the recorded cost replaces the guess when deciding whether a loop is worth
+// parallelizing at all and how coarsely to shard it.
+class LoopCostCalibrator {
+ public:
+  // measurements per loop signature before the calibration is considered settled
+  static constexpr uint32_t kWarmupSamples = 3;
+  // loops measured cheaper than this run sequentially in the caller thread
+  static constexpr double kSequentialThresholdNs = 25000.0;
+  // shards are sized to cost at least this much so per-shard overheads stay amortized
+  static constexpr double kMinShardNs = 10000.0;
+
+  static uint64_t Key(const TensorOpCost& cost, std::ptrdiff_t total) {
+    // FNV-1a over the static estimate plus the log2 bucket of the iteration count
+    uint64_t h = 14695981039346656037ULL;
+    auto mix = [&h](uint64_t v) { h = (h ^ v) * 1099511628211ULL; };
+    mix(static_cast<uint64_t>(cost.bytes_loaded));
+    mix(static_cast<uint64_t>(cost.bytes_stored));
+    mix(static_cast<uint64_t>(cost.compute_cycles));
+    uint64_t bucket = 0;
+    for (uint64_t n = static_cast<uint64_t>(total); n > 1; n >>= 1) {
+      ++bucket;
+    }
+    mix(bucket);
+    return h;
+  }
+
+  // Returns the calibrated per-iteration cost in nanoseconds, or -1 while still warming up.
+  double Lookup(uint64_t key) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto it = entries_.find(key);
+    if (it == entries_.end() || it->second.samples < kWarmupSamples) {
+      return -1.0;
+    }
+    return it->second.ns_per_unit;
+  }
+
+  void Record(uint64_t key, double ns, std::ptrdiff_t units) {
+    if (units <= 0 || ns <= 0.0) {
+      return;
+    }
+    const double ns_per_unit = ns / static_cast<double>(units);
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto& entry = entries_[key];
+    if (entry.samples >= kWarmupSamples) {
+      return;
+    }
+    // keep the fastest observation; slower warmup runs include cold caches and page faults
+    entry.ns_per_unit = entry.samples == 0 ? ns_per_unit : std::min(entry.ns_per_unit, ns_per_unit);
+    ++entry.samples;
+  }
+
+ private:
+  struct Entry {
+    double ns_per_unit{0};
+    uint32_t samples{0};
+  };
+
+  OrtMutex mutex_;
+  std::unordered_map<uint64_t, Entry> entries_;
+};
+
 // Calculates block size based on (1) the iteration cost and (2) parallel
 // efficiency. We want blocks to be not too small to mitigate parallelization
 // overheads; not too large to mitigate tail effect and potential load
@@ -359,9 +475,77 @@ static ptrdiff_t CalculateParallelForBlock(const ptrdiff_t n, const Eigen::Tenso
   return block_size;
 }
 
+void ThreadPool::EnableCostCalibration() {
+  if (!cost_calibrator_) {
+    cost_calibrator_ = onnxruntime::make_unique<LoopCostCalibrator>();
+  }
+}
+
+ThreadPool::PoolStats ThreadPool::GetStats(const ThreadPool* tp) {
+  PoolStats stats;
+  if (tp && tp->extended_eigen_threadpool_) {
+    tp->extended_eigen_threadpool_->GetStats(stats.tasks_executed, stats.steals, stats.blocks);
+  }
+  return stats;
+}
+
+void ThreadPool::ParallelForCalibrated(std::ptrdiff_t n, const TensorOpCost& c,
+                                       const std::function<void(std::ptrdiff_t first, std::ptrdiff_t)>& f) {
+  const uint64_t key = LoopCostCalibrator::Key(c, n);
+  const double ns_per_unit = cost_calibrator_->Lookup(key);
+
+  if (ns_per_unit >= 0.0) {
+    const double total_ns = ns_per_unit * static_cast<double>(n);
+    if (total_ns < LoopCostCalibrator::kSequentialThresholdNs || !ShouldParallelizeLoop(n)) {
+      f(0, n);
+      return;
+    }
+
+    const int d_of_p = DegreeOfParallelism(this);
+    const ptrdiff_t min_block = static_cast<ptrdiff_t>(LoopCostCalibrator::kMinShardNs / ns_per_unit) + 1;
+    const ptrdiff_t block = std::max<ptrdiff_t>(Eigen::divup<ptrdiff_t>(n, d_of_p), min_block);
+    if (block >= n) {
+      f(0, n);
+      return;
+    }
+    ParallelForFixedBlockSizeScheduling(n, block, f);
+    return;
+  }
+
+  // still warming up: run with the static-cost policy, measuring the loop body as it executes.
+  // per-shard timing is accumulated so the recorded cost reflects work done, not wall time
+  // across threads.
+  Eigen::TensorOpCost cost{c.bytes_loaded, c.bytes_stored, c.compute_cycles};
+  const int d_of_p = DegreeOfParallelism(this);
+  if ((!ShouldParallelizeLoop(n)) ||
+      CostModel::numThreads(static_cast<double>(n), cost, d_of_p) == 1) {
+    const auto start = std::chrono::steady_clock::now();
+    f(0, n);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    cost_calibrator_->Record(
+        key, static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()), n);
+    return;
+  }
+
+  const ptrdiff_t block = CalculateParallelForBlock(n, cost, nullptr, d_of_p);
+  std::atomic<uint64_t> total_ns{0};
+  ParallelForFixedBlockSizeScheduling(n, block, [&f, &total_ns](std::ptrdiff_t first, std::ptrdiff_t last) {
+    const auto start = std::chrono::steady_clock::now();
+    f(first, last);
+    const auto elapsed = std::chrono::steady_clock::now() - start;
+    total_ns.fetch_add(static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count()),
+                       std::memory_order_relaxed);
+  });
+  cost_calibrator_->Record(key, static_cast<double>(total_ns.load(std::memory_order_relaxed)), n);
+}
+
 void ThreadPool::ParallelFor(std::ptrdiff_t n, const TensorOpCost& c,
                              const std::function<void(std::ptrdiff_t first, std::ptrdiff_t)>& f) {
   ORT_ENFORCE(n >= 0);
+  if (cost_calibrator_) {
+    ParallelForCalibrated(n, c, f);
+    return;
+  }
   Eigen::TensorOpCost cost{c.bytes_loaded, c.bytes_stored, c.compute_cycles};
   auto d_of_p = DegreeOfParallelism(this);
   // Compute small problems directly in the caller thread.
@@ -35,6 +35,30 @@ class TensorSeq {
     tensors_ = std::move(tensors);
   }
 
+  // Same as above, but additionally takes ownership of a single allocation that backs all of the
+  // tensors. The caller guarantees the tensors view `storage` in sequence order with their data
+  // tightly packed, which lets consumers treat the whole sequence as one contiguous block.
+  void SetElements(std::vector<Tensor>&& tensors, BufferUniquePtr&& storage) {
+    SetElements(std::move(tensors));
+    storage_ = std::move(storage);
+  }
+
+  // True if all tensors in the seq are tightly packed, in order, in a single allocation owned by
+  // the seq.
+  bool IsContiguous() const noexcept { return storage_ != nullptr; }
+
+  // Reserves capacity for the given number of tensors to avoid reallocation while appending.
+  void Reserve(size_t capacity) {
+    tensors_.reserve(capacity);
+  }
+
+  // Appends a tensor to the seq without copying its data.
+  // The caller of this method ensures that `elem_type` is set and matches the tensor's data type.
+  void Add(Tensor&& tensor) {
+    assert(IsSameDataType(tensor));
+    tensors_.push_back(std::move(tensor));
+  }
+
   MLDataType DataType() const noexcept { return elem_type_; }
 
   bool IsSameDataType(const TensorSeq& o) const noexcept {
@@ -73,6 +97,9 @@ class TensorSeq {
   // TODO: optimization opportunity - if all tensors in the seq are scalars, we can potentially represent them
   // as vector<primitive type>
   std::vector<Tensor> tensors_;
+
+  // Optional single allocation backing all of the tensors. See the two-argument SetElements.
+  BufferUniquePtr storage_;
 };
 
 }  // namespace onnxruntime
@@ -313,6 +313,63 @@ class PlannerImpl {
     return false;
   }
 
+  // Operators whose kernels compute each output element purely from the input elements at the
+  // same index, so the output may alias a same-sized input even though the kernel never declared
+  // MayInplace. Broadcasting variants are covered because a candidate input must match the output
+  // shape exactly; broadcast inputs fail that test and are skipped.
+  static bool IsAliasSafeElementwiseOp(const onnxruntime::Node& node) {
+    const auto& domain = node.Domain();
+    if (domain == kOnnxDomain || domain == kOnnxDomainAlias) {
+      static const std::unordered_set<std::string> onnx_ops{
+          "Abs", "Add", "Ceil", "Clip", "Cos", "Div", "Elu", "Erf", "Exp", "Floor", "HardSigmoid",
+          "LeakyRelu", "Log", "Max", "Min", "Mul", "Neg", "PRelu", "Reciprocal", "Relu", "Round",
+          "Selu", "Sigmoid", "Sin", "Softplus", "Softsign", "Sqrt", "Sub", "Sum", "Tanh",
+          "ThresholdedRelu"};
+      return onnx_ops.count(node.OpType()) > 0;
+    }
+    if (domain == kMSDomain) {
+      static const std::unordered_set<std::string> contrib_ops{"Gelu", "FastGelu", "BiasGelu"};
+      return contrib_ops.count(node.OpType()) > 0;
+    }
+    return false;
+  }
+
+  // Find an input an alias-safe elementwise node may overwrite: the input must die at this node,
+  // own its buffer (rather than borrowing a user-provided or pre-existing one), live in the same
+  // location, and match the output in size and type. This catches the long chains of elementwise
+  // ops whose kernels carry no in-place annotations and would otherwise each get a fresh buffer.
+  bool FindElementwiseReusableInput(const onnxruntime::Node& node, int output_arg_num,
+                                    OrtValueIndex* reusable_input) {
+    // all the listed ops produce a single output
+    if (output_arg_num != 0) return false;
+
+    auto p_output_arg = node.OutputDefs()[0];
+    if (HasFence(p_output_arg)) return false;
+    if (!IsAliasSafeElementwiseOp(node)) return false;
+
+    // restrict to EPs whose elementwise kernels are known to tolerate aliased input/output buffers
+    const auto& ep_type = node.GetExecutionProviderType();
+    if (ep_type != kCpuExecutionProvider && ep_type != kCudaExecutionProvider) return false;
+
+    const auto& output_location = AllocPlan(p_output_arg->Name()).location;
+    for (auto p_input_arg : node.InputDefs()) {
+      if (!p_input_arg->Exists()) continue;
+      if (HasFence(p_input_arg)) continue;
+      auto input_arg_index = Index(p_input_arg->Name());
+      auto original = Buffer(input_arg_index);
+      if (1 != UseCount(original)) continue;
+      // never write over buffers the graph does not own (feeds, initializers) or that are
+      // fetched by the caller
+      if (AllocPlan(original).alloc_kind != AllocKind::kAllocate) continue;
+      if (!(AllocPlan(original).location == output_location)) continue;
+      if (!SameSize(*p_input_arg, *p_output_arg)) continue;
+
+      *reusable_input = input_arg_index;
+      return true;
+    }
+    return false;
+  }
+
   static bool SameShape(const TensorShapeProto& shape1, const TensorShapeProto& shape2) {
     // TODO: This should probably be defined to be the equality operator on TensorShapeProto.
     namespace on = ONNX_NAMESPACE;
@@ -711,6 +768,13 @@ class PlannerImpl {
           Reuse(reused, current, AllocKind::kReuse);
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
           InplaceReuse(reused, current);
+#endif
+        } else if (FindElementwiseReusableInput(*pnode, static_cast<int>(output_arg_def_index), &reused)) {
+          // The kernel carries no in-place annotation, but the op is index-wise elementwise and the
+          // input dies here, so overwriting it is safe and saves an activation buffer.
+          Reuse(reused, current, AllocKind::kReuse);
+#if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
+          InplaceReuse(reused, current);
 #endif
         } else if (!context_.IsParallelExecutionEnabled() &&
                    FindReusableTensor(*node_output, &reused)) {
@@ -45,17 +45,20 @@ AllocatorPtr CreateAllocator(const AllocatorCreationInfo& info) {
         return nullptr;
     }
 
-#ifdef USE_MIMALLOC
-    return std::shared_ptr<IArenaAllocator>(
-        onnxruntime::make_unique<MiMallocArena>(std::move(device_allocator), max_mem));
-#else
+#if defined(USE_MIMALLOC_ARENA_ALLOCATOR)
+    if (info.use_mimalloc_arena) {
+      return std::shared_ptr<IArenaAllocator>(
+          onnxruntime::make_unique<MiMallocArena>(std::move(device_allocator), max_mem));
+    }
+#endif
     return std::shared_ptr<IArenaAllocator>(
         onnxruntime::make_unique<BFCArena>(std::move(device_allocator),
                                            max_mem,
                                            arena_extend_str,
                                            initial_chunk_size_bytes,
-                                           max_dead_bytes_per_chunk));
-#endif
+                                           max_dead_bytes_per_chunk,
+                                           info.use_arena_thread_cache,
+                                           info.use_huge_pages));
   }
 
   return AllocatorPtr(std::move(device_allocator));
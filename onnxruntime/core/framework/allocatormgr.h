@@ -22,17 +22,32 @@ struct AllocatorCreationInfo {
   AllocatorCreationInfo(AllocatorFactory device_alloc_factory0,
                         OrtDevice::DeviceId device_id0 = 0,
                         bool use_arena0 = true,
-                        OrtArenaCfg arena_cfg0 = {0, -1, -1, -1})
+                        OrtArenaCfg arena_cfg0 = {0, -1, -1, -1},
+                        bool use_arena_thread_cache0 = false,
+                        bool use_mimalloc_arena0 = false,
+                        bool use_huge_pages0 = false)
       : device_alloc_factory(device_alloc_factory0),
         device_id(device_id0),
         use_arena(use_arena0),
-        arena_cfg(arena_cfg0) {
+        arena_cfg(arena_cfg0),
+        use_arena_thread_cache(use_arena_thread_cache0),
+        use_mimalloc_arena(use_mimalloc_arena0),
+        use_huge_pages(use_huge_pages0) {
   }
 
   AllocatorFactory device_alloc_factory;
   OrtDevice::DeviceId device_id;
   bool use_arena;
   OrtArenaCfg arena_cfg;
+  // enables the BFCArena small-chunk thread cache. only appropriate for allocators whose memory
+  // is allocated and freed on host threads, e.g. the CPU EP arena.
+  bool use_arena_thread_cache;
+  // back the arena with mimalloc per-thread heaps instead of BFCArena. only honored in builds
+  // with onnxruntime_USE_MIMALLOC_ARENA_ALLOCATOR; ignored otherwise.
+  bool use_mimalloc_arena;
+  // advise the kernel to back arena regions with huge pages. only appropriate for host-memory
+  // arenas; best effort, ignored where the platform has no such facility.
+  bool use_huge_pages;
 };
 
 // Returns an allocator based on the creation info provided.
@@ -27,6 +27,12 @@ class IArenaAllocator : public IAllocator {
   void Free(void* p) override = 0;
   virtual size_t Used() const = 0;
   virtual size_t Max() const = 0;
+  // Return memory the arena is holding but no longer using to the device allocator,
+  // e.g. regions grown while serving an unusually large request.
+  // Shrink call need to be thread safe.
+  virtual common::Status Shrink() {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, NOT_IMPLEMENTED, "Shrink is not supported by this arena allocator.");
+  }
   // allocate host pinned memory?
 };
 
@@ -2,14 +2,58 @@
 // Licensed under the MIT License.
 
 #include "core/framework/bfc_arena.h"
+#include <atomic>
 #include <type_traits>
 
+#if defined(__linux__)
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
 namespace onnxruntime {
+
+namespace {
+
+// Advises the kernel to back the page-aligned interior of [p, p + size) with transparent huge
+// pages. Best effort: failures (and platforms without the facility) are silently ignored and
+// the region stays on regular pages.
+void AdviseHugePages(void* p, size_t size) {
+#if defined(__linux__) && defined(MADV_HUGEPAGE)
+  const uintptr_t page_size = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+  const uintptr_t begin = (reinterpret_cast<uintptr_t>(p) + page_size - 1) & ~(page_size - 1);
+  const uintptr_t end = (reinterpret_cast<uintptr_t>(p) + size) & ~(page_size - 1);
+  if (end > begin) {
+    madvise(reinterpret_cast<void*>(begin), end - begin, MADV_HUGEPAGE);
+  }
+#else
+  ORT_UNUSED_PARAMETER(p);
+  ORT_UNUSED_PARAMETER(size);
+#endif
+}
+// Registry of live arenas, so a thread cache being destroyed on thread exit can return its
+// chunks to the arena that owns them if (and only if) that arena still exists. Intentionally
+// leaked: thread exit can run during static destruction, after namespace scope objects in this
+// translation unit would have been destroyed.
+OrtMutex& ArenaRegistryMutex() {
+  static OrtMutex* mutex = new OrtMutex();
+  return *mutex;
+}
+
+std::unordered_map<uint64_t, BFCArena*>& ArenaRegistry() {  // GUARDED_BY(ArenaRegistryMutex())
+  static auto* registry = new std::unordered_map<uint64_t, BFCArena*>();
+  return *registry;
+}
+
+std::atomic<uint64_t> next_arena_id{0};
+}  // namespace
+
 BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
                    size_t total_memory,
                    ArenaExtendStrategy arena_extend_strategy,
                    int initial_chunk_size_bytes,
-                   int max_dead_bytes_per_chunk)
+                   int max_dead_bytes_per_chunk,
+                   bool use_small_chunk_thread_cache,
+                   bool use_huge_pages)
     : IArenaAllocator(OrtMemoryInfo(resource_allocator->Info().name,
                                     OrtAllocatorType::OrtArenaAllocator,
                                     resource_allocator->Info().device,
@@ -19,7 +63,15 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
       free_chunks_list_(kInvalidChunkHandle),
       next_allocation_id_(1),
       initial_chunk_size_bytes_(initial_chunk_size_bytes),
-      max_dead_bytes_per_chunk_(max_dead_bytes_per_chunk) {
+      max_dead_bytes_per_chunk_(max_dead_bytes_per_chunk),
+      use_thread_cache_(use_small_chunk_thread_cache),
+      use_huge_pages_(use_huge_pages),
+      arena_id_(++next_arena_id) {
+  {
+    std::lock_guard<OrtMutex> registry_lock(ArenaRegistryMutex());
+    ArenaRegistry().emplace(arena_id_, this);
+  }
+
   LOGS_DEFAULT(INFO) << "Creating BFCArena for " << device_allocator_->Info().name
                      << " with following configs: initial_chunk_size_bytes: " << initial_chunk_size_bytes_
                      << " max_dead_bytes_per_chunk: " << max_dead_bytes_per_chunk_
@@ -53,6 +105,11 @@ BFCArena::BFCArena(std::unique_ptr<IAllocator> resource_allocator,
 }
 
 BFCArena::~BFCArena() {
+  {
+    std::lock_guard<OrtMutex> registry_lock(ArenaRegistryMutex());
+    ArenaRegistry().erase(arena_id_);
+  }
+
   for (const auto& region : region_manager_.regions()) {
     device_allocator_->Free(region.ptr());
   }
@@ -162,6 +219,10 @@ Status BFCArena::Extend(size_t rounded_bytes) {
                            "Failed to allocate memory for requested buffer of size ", rounded_bytes);
   }
 
+  if (use_huge_pages_) {
+    AdviseHugePages(mem_addr, bytes);
+  }
+
   LOGS_DEFAULT(INFO) << "Extended allocation by " << bytes << " bytes.";
 
   stats_.total_allocated_bytes += bytes;
@@ -221,8 +282,63 @@ size_t BFCArena::RoundedBytes(size_t bytes) {
   return rounded_bytes;
 }
 
+BFCArena::ThreadCache& BFCArena::GetThreadCache() {
+  // one cache per arena per thread. keyed by arena id rather than arena address so an entry left
+  // behind by a destroyed arena can never be matched to a new arena at the same address.
+  static thread_local std::unordered_map<uint64_t, ThreadCache> caches;
+  ThreadCache& cache = caches[arena_id_];
+  cache.arena_id = arena_id_;
+  return cache;
+}
+
+BFCArena::ThreadCache::~ThreadCache() {
+  std::lock_guard<OrtMutex> registry_lock(ArenaRegistryMutex());
+  auto registry_it = ArenaRegistry().find(arena_id);
+  if (registry_it == ArenaRegistry().end()) {
+    // the arena was destroyed first and released the regions the cached chunks pointed into
+    return;
+  }
+
+  BFCArena& arena = *registry_it->second;
+  std::lock_guard<OrtMutex> lock(arena.lock_);
+  for (auto& free_list : free_lists) {
+    for (void* p : free_list) {
+      arena.DeallocateRawInternal(p);
+    }
+  }
+
+  // allocations still outstanding were handed to callers. clear their owner links so a later
+  // free does not touch this cache after it is gone.
+  for (const auto& entry : outstanding) {
+    ChunkHandle h = arena.region_manager_.get_handle(entry.first);
+    if (h != kInvalidChunkHandle) {
+      arena.ChunkFromHandle(h)->owner_cache = nullptr;
+    }
+  }
+}
+
 void* BFCArena::Alloc(size_t size) {
-  return AllocateRawInternal(size, false);
+  size_t rounded_bytes = RoundedBytes(size);
+  if (!use_thread_cache_ || size == 0 || rounded_bytes > kMaxCachedChunkSize) {
+    return AllocateRawInternal(size, false, nullptr);
+  }
+
+  ThreadCache& cache = GetThreadCache();
+  auto& free_list = cache.free_lists[SizeClassFromRoundedBytes(rounded_bytes)];
+  void* p = nullptr;
+  if (!free_list.empty()) {
+    p = free_list.back();
+    free_list.pop_back();
+  } else {
+    p = AllocateRawInternal(size, false, &cache);
+  }
+
+  if (p != nullptr) {
+    std::lock_guard<OrtMutex> cache_lock(cache.outstanding_mutex);
+    cache.outstanding.emplace(p, rounded_bytes);
+  }
+
+  return p;
 }
 
 void* BFCArena::Reserve(size_t size) {
@@ -241,6 +357,57 @@ void* BFCArena::Reserve(size_t size) {
   return ptr;
 }
 
+Status BFCArena::Shrink() {
+  std::lock_guard<OrtMutex> lock(lock_);
+
+  // Collect the releasable regions first: removing one mutates the region list.
+  // A region can only be released when a single free chunk spans all of it; chunks parked in
+  // thread caches count as in use, so memory is never pulled out from under a caller.
+  std::vector<void*> regions_to_release;
+  std::vector<size_t> region_sizes;
+  const size_t baseline_region_bytes =
+      RoundedBytes(std::min(memory_limit_, static_cast<size_t>(initial_chunk_size_bytes_)));
+  for (const auto& region : region_manager_.regions()) {
+    // keep initial-chunk sized regions around as the steady-state pool
+    if (region.memory_size() <= baseline_region_bytes) {
+      continue;
+    }
+
+    ChunkHandle h = region_manager_.get_handle(region.ptr());
+    if (h == kInvalidChunkHandle) {
+      continue;
+    }
+
+    const Chunk* c = ChunkFromHandle(h);
+    if (!c->in_use() && c->size == region.memory_size()) {
+      regions_to_release.push_back(region.ptr());
+      region_sizes.push_back(region.memory_size());
+    }
+  }
+
+  for (size_t i = 0; i < regions_to_release.size(); ++i) {
+    void* ptr = regions_to_release[i];
+    ChunkHandle h = region_manager_.get_handle(ptr);
+    RemoveFreeChunkFromBin(h);
+    DeleteChunk(h);
+    region_manager_.RemoveAllocationRegion(ptr);
+    device_allocator_->Free(ptr);
+    stats_.total_allocated_bytes -= static_cast<int64_t>(region_sizes[i]);
+
+    LOGS_DEFAULT(INFO) << "BFCArena for " << device_allocator_->Info().name << " released a region of "
+                       << region_sizes[i] << " bytes back to the device allocator.";
+  }
+
+  // reset the growth state so the next extension starts from the initial chunk size again
+  // instead of repeating the last power-of-two jump
+  if (!regions_to_release.empty() && arena_extend_strategy_ == ArenaExtendStrategy::kNextPowerOfTwo) {
+    curr_region_allocation_bytes_ =
+        RoundedBytes(std::min(memory_limit_, static_cast<size_t>(initial_chunk_size_bytes_)));
+  }
+
+  return Status::OK();
+}
+
 size_t BFCArena::RequestedSize(const void* ptr) {
   std::lock_guard<OrtMutex> lock(lock_);
   BFCArena::ChunkHandle h = region_manager_.get_handle(ptr);
@@ -258,7 +425,8 @@ size_t BFCArena::AllocatedSize(const void* ptr) {
 }
 
 void* BFCArena::AllocateRawInternal(size_t num_bytes,
-                                    bool dump_log_on_failure) {
+                                    bool dump_log_on_failure,
+                                    ThreadCache* owner_cache) {
   if (num_bytes == 0) {
     LOGS_DEFAULT(VERBOSE) << "tried to allocate 0 bytes";
     return nullptr;
@@ -272,7 +440,7 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
   BinNum bin_num = BinNumForSize(rounded_bytes);
 
   std::lock_guard<OrtMutex> lock(lock_);
-  void* ptr = FindChunkPtr(bin_num, rounded_bytes, num_bytes);
+  void* ptr = FindChunkPtr(bin_num, rounded_bytes, num_bytes, owner_cache);
   if (ptr != nullptr) {
     return ptr;
   }
@@ -283,7 +451,7 @@ void* BFCArena::AllocateRawInternal(size_t num_bytes,
   // Try to extend
   auto status = Extend(rounded_bytes);
   if (status.IsOK()) {
-    ptr = FindChunkPtr(bin_num, rounded_bytes, num_bytes);
+    ptr = FindChunkPtr(bin_num, rounded_bytes, num_bytes, owner_cache);
     if (ptr != nullptr) {
       return ptr;
     } else {
@@ -311,7 +479,7 @@ void BFCArena::GetStats(AllocatorStats* stats) {
 }
 
 void* BFCArena::FindChunkPtr(BinNum bin_num, size_t rounded_bytes,
-                             size_t num_bytes) {
+                             size_t num_bytes, ThreadCache* owner_cache) {
   // First identify the first bin that could satisfy rounded_bytes.
   for (; bin_num < kNumBins; bin_num++) {
     // Start searching from the first bin for the smallest chunk that fits
@@ -342,6 +510,7 @@ void* BFCArena::FindChunkPtr(BinNum bin_num, size_t rounded_bytes,
         // Assign a unique id and increment the id counter, marking the
         // chunk as being in use.
         chunk->allocation_id = next_allocation_id_++;
+        chunk->owner_cache = owner_cache;
         // Update stats.
         ++stats_.num_allocs;
         stats_.bytes_in_use += chunk->size;
@@ -395,6 +564,28 @@ void BFCArena::Free(void* p) {
   if (p == nullptr) {
     return;
   }
+
+  if (use_thread_cache_) {
+    ThreadCache& cache = GetThreadCache();
+    size_t rounded_bytes = 0;
+    {
+      std::lock_guard<OrtMutex> cache_lock(cache.outstanding_mutex);
+      auto it = cache.outstanding.find(p);
+      if (it != cache.outstanding.end()) {
+        rounded_bytes = it->second;
+        cache.outstanding.erase(it);
+      }
+    }
+
+    if (rounded_bytes != 0) {
+      auto& free_list = cache.free_lists[SizeClassFromRoundedBytes(rounded_bytes)];
+      if (free_list.size() < kMaxCachedChunksPerClass) {
+        free_list.push_back(p);
+        return;
+      }
+    }
+  }
+
   std::lock_guard<OrtMutex> lock(lock_);
   auto it = reserved_chunks_.find(p);
   if (it != reserved_chunks_.end()) {
@@ -412,6 +603,14 @@ void BFCArena::DeallocateRawInternal(void* ptr) {
   BFCArena::ChunkHandle h = region_manager_.get_handle(ptr);
   ORT_ENFORCE(h != kInvalidChunkHandle);
 
+  // If the pointer was allocated through a thread cache, drop that cache's record of it so a
+  // stale entry can not misclassify a future allocation handed out at this address.
+  Chunk* c = ChunkFromHandle(h);
+  if (c->owner_cache != nullptr) {
+    std::lock_guard<OrtMutex> cache_lock(c->owner_cache->outstanding_mutex);
+    c->owner_cache->outstanding.erase(ptr);
+  }
+
   // Consider coalescing it.
   FreeAndMaybeCoalesce(h);
 }
@@ -488,6 +687,7 @@ void BFCArena::FreeAndMaybeCoalesce(BFCArena::ChunkHandle h) {
 
   // Mark the chunk as no longer in use
   c->allocation_id = -1;
+  c->owner_cache = nullptr;
 
   // Updates the stats.
   stats_.bytes_in_use -= c->size;
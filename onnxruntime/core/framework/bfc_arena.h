@@ -61,7 +61,9 @@ class BFCArena : public IArenaAllocator {
            size_t total_memory,
            ArenaExtendStrategy arena_extend_strategy = DEFAULT_ARENA_EXTEND_STRATEGY,
            int initial_chunk_size_bytes = DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
-           int max_dead_bytes_per_chunk = DEFAULT_MAX_DEAD_BYTES_PER_CHUNK);
+           int max_dead_bytes_per_chunk = DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
+           bool use_small_chunk_thread_cache = false,
+           bool use_huge_pages = false);
 
   ~BFCArena() override;
 
@@ -75,6 +77,11 @@ class BFCArena : public IArenaAllocator {
 
   void* Reserve(size_t size) override;
 
+  // Releases fully-free regions back to the device allocator and resets the region growth state,
+  // so a single large request no longer inflates memory usage for the process lifetime.
+  // Regions no larger than the initial chunk size are kept as the steady-state pool.
+  Status Shrink() override;
+
   size_t Used() const override {
     return static_cast<size_t>(stats_.bytes_in_use);
   }
@@ -95,7 +102,7 @@ class BFCArena : public IArenaAllocator {
   size_t AllocatedSize(const void* ptr);
 
  private:
-  void* AllocateRawInternal(size_t num_bytes, bool dump_log_on_failure);
+  void* AllocateRawInternal(size_t num_bytes, bool dump_log_on_failure, ThreadCache* owner_cache);
   void DeallocateRawInternal(void* ptr);
 
   // A ChunkHandle is an index into the chunks_ vector in BFCAllocator
@@ -107,6 +114,8 @@ class BFCArena : public IArenaAllocator {
   static const int kInvalidBinNum = -1;
   static const int kNumBins = 21;
 
+  struct ThreadCache;
+
   // Chunks point to memory.  Their prev/next pointers form a
   // doubly-linked list of addresses sorted by base address that
   // must be contiguous.  Chunks contain information about whether
@@ -141,6 +150,10 @@ class BFCArena : public IArenaAllocator {
     // What bin are we in?
     BinNum bin_num = kInvalidBinNum;
 
+    // Thread cache this chunk was allocated through, if any. Maintained under lock_ so that a
+    // free from another thread can drop the cache's record of the pointer.
+    ThreadCache* owner_cache = nullptr;
+
     bool in_use() const { return allocation_id != -1; }
 
     std::string DebugString(BFCArena* a, bool recurse) {
@@ -289,6 +302,12 @@ class BFCArena : public IArenaAllocator {
     }
     void erase(const void* p) { return MutableRegionFor(p)->erase(p); }
 
+    void RemoveAllocationRegion(void* ptr) {
+      auto entry = std::upper_bound(regions_.begin(), regions_.end(), ptr, &Comparator);
+      ORT_ENFORCE(entry != regions_.end() && entry->ptr() == ptr, "Could not find Region for ", ptr);
+      regions_.erase(entry);
+    }
+
     const std::vector<AllocationRegion>& regions() const { return regions_; }
 
    private:
@@ -326,8 +345,9 @@ class BFCArena : public IArenaAllocator {
   Status Extend(size_t rounded_bytes);
 
   // Returns a pointer to an underlying allocated chunk of size
-  // 'rounded_bytes'.
-  void* FindChunkPtr(BinNum bin_num, size_t rounded_bytes, size_t num_bytes);
+  // 'rounded_bytes'. 'owner_cache' is recorded on the chunk when the allocation was made through
+  // a thread cache.
+  void* FindChunkPtr(BinNum bin_num, size_t rounded_bytes, size_t num_bytes, ThreadCache* owner_cache);
 
   // Splits the chunk specified by 'h' into two chunks, one at least
   // of size 'num_bytes'.
@@ -373,6 +393,40 @@ class BFCArena : public IArenaAllocator {
   // Computes and returns a BinDebugInfo for each Bin.
   std::array<BinDebugInfo, kNumBins> get_bin_debug_info();
 
+  // Small-chunk thread cache.
+  //
+  // When enabled, each thread keeps a bounded per-size-class cache of small chunks it has freed
+  // and hands them back for later allocations of the same class without taking lock_, so the
+  // common small-tensor alloc/free path does not contend on the arena mutex under concurrent Run
+  // calls. Cached chunks stay marked as in use in the backend, so they are never split or
+  // coalesced while cached; a thread returns its cached chunks when it exits. Frees of pointers
+  // that were allocated on another thread fall back to the locked path.
+  static const size_t kMaxCachedChunkSize = 4096;
+  static const size_t kNumSmallSizeClasses = kMaxCachedChunkSize >> kMinAllocationBits;
+  static const size_t kMaxCachedChunksPerClass = 16;
+
+  struct ThreadCache {
+    ~ThreadCache();
+
+    // per size class free lists. only touched by the owning thread.
+    std::array<std::vector<void*>, kNumSmallSizeClasses> free_lists;
+
+    // rounded size of each live small allocation made through this cache, so Free can classify a
+    // pointer without looking up chunk metadata under lock_. the locked free path erases entries
+    // for pointers freed by other threads, hence the mutex.
+    OrtMutex outstanding_mutex;
+    std::unordered_map<void*, size_t> outstanding;  // GUARDED_BY(outstanding_mutex)
+
+    uint64_t arena_id = 0;
+  };
+
+  // Returns the calling thread's cache for this arena, creating it on first use.
+  ThreadCache& GetThreadCache();
+
+  static size_t SizeClassFromRoundedBytes(size_t rounded_bytes) {
+    return (rounded_bytes >> kMinAllocationBits) - 1;
+  }
+
   // Structures immutable after construction
   size_t memory_limit_ = 0;
   ArenaExtendStrategy arena_extend_strategy_ = ArenaExtendStrategy::kNextPowerOfTwo;
@@ -451,6 +505,17 @@ class BFCArena : public IArenaAllocator {
   const int initial_chunk_size_bytes_;
   const int max_dead_bytes_per_chunk_;
 
+  const bool use_thread_cache_;
+
+  // Advise the kernel to back new regions with huge pages, cutting dTLB misses on large
+  // weight/activation working sets. Only meaningful for host-memory arenas; a no-op on
+  // platforms without the facility.
+  const bool use_huge_pages_;
+
+  // Identifies this arena in the per-thread cache map and the live arena registry. Never reused,
+  // so a cache entry left behind by a destroyed arena can not match a new arena.
+  const uint64_t arena_id_;
+
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(BFCArena);
 };
 #ifdef __GNUC__
@@ -3,6 +3,8 @@
 
 #include "core/framework/data_transfer_manager.h"
 
+#include <algorithm>
+
 namespace onnxruntime {
 using namespace common;
 
@@ -87,15 +89,52 @@ common::Status DataTransferManager::CopyTensors(const std::vector<IDataTransfer:
     return first_dt->CopyTensors(src_dst_pairs);
   }
 
-  // there are a mix of devices requiring copies. we don't expect this to happen, so just iterate the pairs
-  // copying one at a time. if this becomes expected we could create a list for each IDataTransfer instance so we
-  // batch as much as possible.
+  // there is a mix of devices requiring copies. group the pairs by (src device, dst device),
+  // preserving order within a group, so each direction still goes out as one batch.
+  struct DirectionBatch {
+    OrtDevice src_device;
+    OrtDevice dst_device;
+    IDataTransfer* data_transfer;
+    std::vector<IDataTransfer::SrcDstPair> pairs;
+  };
+
+  std::vector<DirectionBatch> batches;
+  for (const auto& pair : src_dst_pairs) {
+    const auto& cur_src_device = pair.src.get().Location().device;
+    const auto& cur_dst_device = pair.dst.get().Location().device;
+
+    auto batch_iter = std::find_if(batches.begin(), batches.end(),
+                                   [&cur_src_device, &cur_dst_device](const DirectionBatch& batch) {
+                                     return batch.src_device == cur_src_device &&
+                                            batch.dst_device == cur_dst_device;
+                                   });
+    if (batch_iter == batches.end()) {
+      IDataTransfer* dt = nullptr;
+      for (auto& data_transfer : datatransfers_) {
+        if (data_transfer->CanCopy(cur_src_device, cur_dst_device)) {
+          dt = data_transfer.get();
+          break;
+        }
+      }
+
+      if (dt == nullptr) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME,
+                               FAIL,
+                               "There's no data transfer registered for copying tensors from ",
+                               cur_src_device.ToString(),
+                               " to ",
+                               cur_dst_device.ToString());
+      }
+
+      batches.push_back({cur_src_device, cur_dst_device, dt, {}});
+      batch_iter = batches.end() - 1;
+    }
 
-  // copy the first one as we already did the IDataTransfer lookup
-  ORT_RETURN_IF_ERROR(first_dt->CopyTensor(first_pair.src.get(), first_pair.dst.get(), first_pair.exec_queue_id));
+    batch_iter->pairs.push_back(pair);
+  }
 
-  for (auto cur_pair = src_dst_pairs.cbegin() + 1, end_pair = src_dst_pairs.cend(); cur_pair != end_pair; ++cur_pair) {
-    ORT_RETURN_IF_ERROR(CopyTensor(cur_pair->src, cur_pair->dst, cur_pair->exec_queue_id));
+  for (const auto& batch : batches) {
+    ORT_RETURN_IF_ERROR(batch.data_transfer->CopyTensors(batch.pairs));
   }
 
   return Status::OK();
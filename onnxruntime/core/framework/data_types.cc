@@ -321,7 +321,7 @@ const ONNX_NAMESPACE::TypeProto* TensorTypeBase::GetTypeProto() const {
   return impl_->GetProto();
 }
 
-TensorTypeBase::TensorTypeBase() : impl_(new Impl()) {}
+TensorTypeBase::TensorTypeBase() : DataTypeImpl(GeneralType::kTensor), impl_(new Impl()) {}
 TensorTypeBase::~TensorTypeBase() {
   delete impl_;
 }
@@ -369,7 +369,7 @@ MLDataType TensorTypeBase::Type() {
 struct SparseTensorTypeBase::Impl : public data_types_internal::TypeProtoImpl {
 };
 
-SparseTensorTypeBase::SparseTensorTypeBase() : impl_(new Impl()) {}
+SparseTensorTypeBase::SparseTensorTypeBase() : DataTypeImpl(GeneralType::kSparseTensor), impl_(new Impl()) {}
 SparseTensorTypeBase::~SparseTensorTypeBase() {
   delete impl_;
 }
@@ -415,7 +415,7 @@ MLDataType SparseTensorTypeBase::Type() {
 struct SequenceTensorTypeBase::Impl : public data_types_internal::TypeProtoImpl {
 };
 
-SequenceTensorTypeBase::SequenceTensorTypeBase() : impl_(new Impl()) {}
+SequenceTensorTypeBase::SequenceTensorTypeBase() : DataTypeImpl(GeneralType::kTensorSequence), impl_(new Impl()) {}
 
 SequenceTensorTypeBase::~SequenceTensorTypeBase() {
   delete impl_;
@@ -460,7 +460,7 @@ MLDataType SequenceTensorTypeBase::Type() {
 /// NoTensorTypeBase
 struct NonTensorTypeBase::Impl : public data_types_internal::TypeProtoImpl {};
 
-NonTensorTypeBase::NonTensorTypeBase() : impl_(new Impl()) {
+NonTensorTypeBase::NonTensorTypeBase() : DataTypeImpl(GeneralType::kNonTensor), impl_(new Impl()) {
 }
 
 NonTensorTypeBase::~NonTensorTypeBase() {
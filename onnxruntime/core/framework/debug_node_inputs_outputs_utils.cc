@@ -5,13 +5,17 @@
 
 #include "core/framework/debug_node_inputs_outputs_utils.h"
 
-#include <iomanip>
 #include <cctype>
+#include <cmath>
+#include <iomanip>
+#include <limits>
+#include <unordered_map>
 
 #include "core/common/path_utils.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/platform/env.h"
 #include "core/platform/env_var_utils.h"
+#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 namespace utils {
@@ -91,6 +95,125 @@ void DumpTensorToStdOut(const Tensor& tensor) {
   std::cout << std::endl;
 }
 
+// running statistics for one tensor, accumulated across (sampled) runs
+struct TensorStatistics {
+  double minimum{std::numeric_limits<double>::infinity()};
+  double maximum{-std::numeric_limits<double>::infinity()};
+  double mean{0};
+  // sampled elements folded into the statistics so far
+  size_t sampled_count{0};
+  size_t nan_count{0};
+  // times this tensor was seen, for run-level sampling
+  size_t observations{0};
+};
+
+TensorStatistics& GetTensorStatistics(const std::string& tensor_name) {
+  static OrtMutex mutex;
+  static std::unordered_map<std::string, TensorStatistics> statistics_registry;
+  std::lock_guard<OrtMutex> lock(mutex);
+  return statistics_registry[tensor_name];
+}
+
+template <typename T>
+double ToStatisticsValue(const T& value) {
+  return static_cast<double>(value);
+}
+
+double ToStatisticsValue(const BFloat16& value) {
+  return static_cast<double>(value.ToFloat());
+}
+
+double ToStatisticsValue(const MLFloat16& value) {
+  return static_cast<double>(static_cast<float>(value));
+}
+
+double ToStatisticsValue(const std::string&) {
+  return 0;
+}
+
+template <typename T>
+void AccumulateTensorStatistics(const Tensor& tensor, const std::string& tensor_name,
+                                const NodeDumpOptions& dump_options) {
+  if (std::is_same<T, std::string>::value) {
+    std::cout << "Statistics for '" << tensor_name << "': unsupported element type\n";
+    return;
+  }
+
+  auto& statistics = GetTensorStatistics(tensor_name);
+  ++statistics.observations;
+  const size_t run_sample_rate = std::max<size_t>(dump_options.statistics_run_sample_rate, 1);
+  if ((statistics.observations - 1) % run_sample_rate != 0) {
+    return;
+  }
+
+  auto data = tensor.DataAsSpan<T>();
+  const size_t num_items = static_cast<size_t>(data.size());
+  const size_t stride = std::max<size_t>(dump_options.statistics_sample_stride, 1);
+
+  double local_min = std::numeric_limits<double>::infinity();
+  double local_max = -std::numeric_limits<double>::infinity();
+  double local_sum = 0;
+  size_t local_nan = 0;
+  size_t sampled = 0;
+  if (stride == 1) {
+    // contiguous loop so the compiler can vectorize it
+    for (size_t i = 0; i < num_items; ++i) {
+      const double value = ToStatisticsValue(data[i]);
+      if (std::isnan(value)) {
+        ++local_nan;
+        continue;
+      }
+      local_min = std::min(local_min, value);
+      local_max = std::max(local_max, value);
+      local_sum += value;
+    }
+    sampled = num_items - local_nan;
+  } else {
+    for (size_t i = 0; i < num_items; i += stride) {
+      const double value = ToStatisticsValue(data[i]);
+      if (std::isnan(value)) {
+        ++local_nan;
+        continue;
+      }
+      local_min = std::min(local_min, value);
+      local_max = std::max(local_max, value);
+      local_sum += value;
+      ++sampled;
+    }
+  }
+
+  statistics.nan_count += local_nan;
+  if (sampled > 0) {
+    statistics.minimum = std::min(statistics.minimum, local_min);
+    statistics.maximum = std::max(statistics.maximum, local_max);
+    statistics.mean = (statistics.mean * statistics.sampled_count + local_sum) /
+                      (statistics.sampled_count + sampled);
+    statistics.sampled_count += sampled;
+  }
+
+  std::cout << "Statistics for '" << tensor_name << "': min " << statistics.minimum
+            << " max " << statistics.maximum << " mean " << statistics.mean
+            << " nan_count " << statistics.nan_count
+            << " (sampled " << statistics.sampled_count << " elements over "
+            << (statistics.observations + run_sample_rate - 1) / run_sample_rate << " of "
+            << statistics.observations << " runs)\n";
+}
+
+void DumpTensorStatistics(
+    const NodeDumpOptions& dump_options,
+    const Tensor& tensor, const std::string& tensor_name) {
+  // statistics are meant to be cheap enough for production use, so unlike full data
+  // dumping there is no device-to-host copy; only CPU-accessible tensors are sampled
+  auto& tensor_location = tensor.Location();
+  if (tensor_location.device.Type() == OrtDevice::CPU ||
+      tensor_location.mem_type == OrtMemTypeCPUInput ||
+      tensor_location.mem_type == OrtMemTypeCPUOutput) {
+    DispatchOnTensorType(tensor.DataType(), AccumulateTensorStatistics, tensor, tensor_name, dump_options);
+  } else {
+    std::cout << "Statistics for '" << tensor_name << "': skipped, tensor is on " << tensor_location << "\n";
+  }
+}
+
 PathString MakeTensorFileName(const std::string& tensor_name, const NodeDumpOptions& dump_options) {
   auto make_valid_name = [](std::string name) {
     std::replace_if(
@@ -191,6 +314,13 @@ const NodeDumpOptions& NodeDumpOptionsFromEnvironmentVariables() {
     if (ParseEnvironmentVariableWithDefault<bool>(env_vars::kDumpOutputData, false)) {
       opts.dump_flags |= NodeDumpOptions::DumpFlags::OutputData;
     }
+    if (ParseEnvironmentVariableWithDefault<bool>(env_vars::kDumpStatisticsData, false)) {
+      opts.dump_flags |= NodeDumpOptions::DumpFlags::StatisticsData;
+    }
+    opts.statistics_sample_stride =
+        ParseEnvironmentVariableWithDefault<size_t>(env_vars::kStatisticsSampleStride, 1);
+    opts.statistics_run_sample_rate =
+        ParseEnvironmentVariableWithDefault<size_t>(env_vars::kStatisticsRunSampleRate, 1);
 
     opts.filter.name_pattern = Env::Default().GetEnvironmentVar(env_vars::kNameFilter);
     opts.filter.op_type_pattern = Env::Default().GetEnvironmentVar(env_vars::kOpTypeFilter);
@@ -272,6 +402,9 @@ void DumpNodeInputs(
           if ((dump_options.dump_flags & NodeDumpOptions::DumpFlags::InputData) != 0) {
             DumpTensor(dump_options, tensor, input_defs[i]->Name(), session_state);
           }
+          if ((dump_options.dump_flags & NodeDumpOptions::DumpFlags::StatisticsData) != 0) {
+            DumpTensorStatistics(dump_options, tensor, input_defs[i]->Name());
+          }
         } else {
           std::cout << " is non-tensor type.\n";
         }
@@ -317,6 +450,9 @@ void DumpNodeOutputs(const NodeDumpOptions& dump_options, OpKernelContext& conte
           if ((dump_options.dump_flags & NodeDumpOptions::DumpFlags::OutputData) != 0) {
             DumpTensor(dump_options, tensor, output_defs[i]->Name(), session_state);
           }
+          if ((dump_options.dump_flags & NodeDumpOptions::DumpFlags::StatisticsData) != 0) {
+            DumpTensorStatistics(dump_options, tensor, output_defs[i]->Name());
+          }
         } else {
           std::cout << " is non-tensor type.\n";
         }
@@ -26,6 +26,13 @@ constexpr const char* kDumpShapeData = "ORT_DEBUG_NODE_IO_DUMP_SHAPE_DATA";
 constexpr const char* kDumpInputData = "ORT_DEBUG_NODE_IO_DUMP_INPUT_DATA";
 // set to non-zero to dump node output data
 constexpr const char* kDumpOutputData = "ORT_DEBUG_NODE_IO_DUMP_OUTPUT_DATA";
+// set to non-zero to print running min/max/mean/NaN-count statistics instead of full tensor data.
+// cheap enough for production debugging when combined with the sampling variables below.
+constexpr const char* kDumpStatisticsData = "ORT_DEBUG_NODE_IO_DUMP_STATISTICS_DATA";
+// sample every Nth element when computing statistics. Default: 1 (every element).
+constexpr const char* kStatisticsSampleStride = "ORT_DEBUG_NODE_IO_STATISTICS_SAMPLE_STRIDE";
+// fold statistics in for only 1 out of every N observations of a tensor. Default: 1 (every run).
+constexpr const char* kStatisticsRunSampleRate = "ORT_DEBUG_NODE_IO_STATISTICS_RUN_SAMPLE_RATE";
 // specify a node name filter to limit the nodes that are dumped
 // see NodeDumpOptions::FilterOptions
 constexpr const char* kNameFilter = "ORT_DEBUG_NODE_IO_NAME_FILTER";
@@ -51,6 +58,7 @@ struct NodeDumpOptions {
     Shape = 1 << 0,
     InputData = 1 << 1,
     OutputData = 1 << 2,
+    StatisticsData = 1 << 3,
     AllData = Shape | InputData | OutputData,
   };
 
@@ -85,6 +93,12 @@ struct NodeDumpOptions {
   std::string file_suffix;
   // the output directory for dumped data files
   Path output_dir;
+
+  // sampling controls for DumpFlags::StatisticsData
+  // sample every Nth element of a tensor
+  size_t statistics_sample_stride{1};
+  // fold statistics in for only 1 out of every N observations of a tensor
+  size_t statistics_run_sample_rate{1};
 };
 
 // gets NodeDumpOptions instance configured from environment variable values
@@ -12,6 +12,7 @@
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/node_index_info.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/scratch_buffer_arena.h"
 #include "core/framework/session_state.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/utils.h"
@@ -35,6 +36,17 @@ IExecutionFrame::IExecutionFrame(const OrtValueNameIdxMap& ort_value_idx_map,
 
 IExecutionFrame::~IExecutionFrame() = default;
 
+void IExecutionFrame::AdoptValueStorage(std::vector<OrtValue>&& storage) {
+  ORT_ENFORCE(all_values_.empty(), "Value storage can only be adopted before Init.");
+  storage.clear();
+  all_values_ = std::move(storage);
+}
+
+std::vector<OrtValue> IExecutionFrame::ReleaseValueStorage() {
+  all_values_.clear();
+  return std::move(all_values_);
+}
+
 // Return nullptr if index map to an value that is an unused optional input/output
 const OrtValue* IExecutionFrame::GetNodeInputOrOutputMLValue(int index) const {
   int ort_value_idx = GetNodeIdxToMLValueIdx(index);
@@ -61,12 +73,21 @@ Status IExecutionFrame::GetOrCreateNodeOutputMLValue(int index, const TensorShap
     p_ort_value = &all_values_[ort_value_idx];
 
     if (p_ort_value->IsAllocated()) {
-      // already allocated. verify shape matches if tensor.
+      // already allocated. if tensor, verify the shape matches, or morph the value to the requested
+      // shape when it fits within the buffer's capacity so pre-allocated outputs sized for the
+      // maximum expected shape can be reused across runs with varying shapes.
       if (p_ort_value->IsTensor()) {
-        const Tensor& tensor = p_ort_value->Get<Tensor>();
-        ORT_ENFORCE(shape && tensor.Shape() == *shape,
-                    "OrtValue shape verification failed. Current shape:", tensor.Shape(),
-                    " Requested shape:", shape ? shape->ToString() : "null");
+        Tensor& tensor = *p_ort_value->GetMutable<Tensor>();
+        ORT_ENFORCE(shape, "OrtValue shape verification failed. Current shape:", tensor.Shape(),
+                    " Requested shape: null");
+        if (tensor.Shape() != *shape) {
+          auto morph_status = tensor.SetShapeWithinCapacity(*shape);
+          if (!morph_status.IsOK()) {
+            return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                                   "OrtValue shape verification failed. Current shape:", tensor.Shape(),
+                                   " Requested shape:", shape->ToString(), " Error:", morph_status.ErrorMessage());
+          }
+        }
       }
     } else {
       status = CreateNodeOutputMLValueImpl(*p_ort_value, ort_value_idx, shape, nnz);
@@ -212,6 +233,8 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
       session_state_(session_state),
       mem_patterns_(nullptr),
       planner_(nullptr) {
+  // reuse the OrtValue vector a previous Run released rather than growing a fresh one
+  AdoptValueStorage(session_state.AcquireFrameValueStorage());
   Init(feed_mlvalue_idxs, feeds, session_state.GetInitializedTensors(), fetches);
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::IncreaseIteration();
@@ -229,6 +252,38 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
     }
   }
 
+  // When the run-scoped scratch arena is enabled, work out up front which values the allocation
+  // plan proves die inside this Run. A value qualifies if it is a plain kAllocate that is neither
+  // fetched nor fenced, and no fetched or fenced value reuses its buffer later in the plan.
+  if (session_state.GetUseScratchArena() && session_state.GetExecutionPlan()) {
+    const auto& alloc_plan = session_state.GetExecutionPlan()->allocation_plan;
+    scratch_eligible_.resize(alloc_plan.size(), false);
+    for (size_t i = 0; i < alloc_plan.size(); ++i) {
+      const auto& per_alloc_plan = alloc_plan[i];
+      scratch_eligible_[i] = per_alloc_plan.alloc_kind == AllocKind::kAllocate &&
+                             !per_alloc_plan.create_fence_if_async &&
+                             !IsOutput(static_cast<int>(i));
+    }
+
+    for (size_t i = 0; i < alloc_plan.size(); ++i) {
+      const auto& per_alloc_plan = alloc_plan[i];
+      if (per_alloc_plan.alloc_kind != AllocKind::kReuse && per_alloc_plan.alloc_kind != AllocKind::kShare) {
+        continue;
+      }
+      if (!IsOutput(static_cast<int>(i)) && !per_alloc_plan.create_fence_if_async) {
+        continue;
+      }
+
+      // walk the reuse chain to the value that owns the buffer and pin it to the general allocator
+      int reused = per_alloc_plan.reused_buffer;
+      while (alloc_plan[reused].alloc_kind == AllocKind::kReuse ||
+             alloc_plan[reused].alloc_kind == AllocKind::kShare) {
+        reused = alloc_plan[reused].reused_buffer;
+      }
+      scratch_eligible_[reused] = false;
+    }
+  }
+
   // If the session enable memory pattern optimization
   // and we have execution plan generated, try to setup
   // memory pattern optimization.
@@ -249,9 +304,12 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
     //if there are some traditional ml value type in inputs disable the memory pattern optimization.
     if (all_tensors) {
       mem_patterns_ = session_state.GetMemoryPatternGroup(input_shapes, feed_mlvalue_idxs, inferred_shapes_);
-      // if no existing patterns, generate one in this executionframe
+      // if no existing patterns, generate one in this executionframe once the shape has
+      // recurred enough times to be worth specializing for
       if (!mem_patterns_) {
-        planner_ = onnxruntime::make_unique<OrtValuePatternPlanner>(*session_state.GetExecutionPlan());
+        if (session_state.ShouldGenerateMemoryPattern(input_shapes)) {
+          planner_ = onnxruntime::make_unique<OrtValuePatternPlanner>(*session_state.GetExecutionPlan());
+        }
       } else {
         // pre-allocate the big chunk requested in memory pattern.
         // all the internal kernel's input/output tensors will be allocated on these buffer.
@@ -278,12 +336,24 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
               // static_activation_memory_in_bytes_ is max virtual memory size the planner computes.
               // Memory dynamically allocated when executing kernels is not recorded using this field.
               static_activation_memory_sizes_in_byte_[location.name] = peak_size;
-              buffer = alloc->Alloc(peak_size);
-              // handle allocator that doesn't throw
-              if (buffer == nullptr) {
-                // INFO level as this may fire on every run and there may not be much a user can do
-                LOGS(session_state_.Logger(), INFO) << "Allocation of memory pattern buffer for "
-                                                    << location.ToString() << " returned nullptr";
+              // a previous execution with this pattern may have returned its chunk to the
+              // session (e.g. the preceding Loop iteration), in which case skip the allocator
+              BufferUniquePtr recycled = session_state.AcquirePatternBuffer(location, peak_size);
+              if (recycled != nullptr) {
+                buffer = recycled.get();
+                buffers_[location] = std::move(recycled);
+              } else {
+                buffer = alloc->Alloc(peak_size);
+                // handle allocator that doesn't throw
+                if (buffer == nullptr) {
+                  // INFO level as this may fire on every run and there may not be much a user can do
+                  LOGS(session_state_.Logger(), INFO) << "Allocation of memory pattern buffer for "
+                                                      << location.ToString() << " returned nullptr";
+                }
+              }
+
+              if (buffer != nullptr) {
+                pattern_buffer_sizes_[location] = peak_size;
               }
             }
             ORT_CATCH(const OnnxRuntimeException& ex) {
@@ -293,7 +363,7 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
               });
             }
 
-            if (buffer != nullptr) {
+            if (buffer != nullptr && buffers_.find(location) == buffers_.end()) {
               buffers_[location] = BufferUniquePtr(buffer, alloc);
             }
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
@@ -314,7 +384,20 @@ ExecutionFrame::ExecutionFrame(const std::vector<int>& feed_mlvalue_idxs, const
   }
 }
 
-ExecutionFrame::~ExecutionFrame() = default;
+ExecutionFrame::~ExecutionFrame() {
+  // the values themselves are released here; the vector's allocation goes back to the session
+  // for the next Run.
+  session_state_.RecycleFrameValueStorage(ReleaseValueStorage());
+
+  // hand the memory-pattern chunks back so the next execution with the same cached pattern
+  // (e.g. the next Loop iteration) can reuse them without touching the allocator
+  for (auto& entry : buffers_) {
+    auto size_it = pattern_buffer_sizes_.find(entry.first);
+    if (size_it != pattern_buffer_sizes_.end()) {
+      session_state_.RecyclePatternBuffer(entry.first, size_it->second, std::move(entry.second));
+    }
+  }
+}
 
 Status ExecutionFrame::CopyTensor(const Tensor& src, Tensor& dest) const {
   return session_state_.GetDataTransferMgr().CopyTensor(src, dest);
@@ -372,8 +455,11 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
       if (block) {
         auto it = buffers_.find(location);
         if (it != buffers_.end()) {
-          // if the block is not correct, log message then fall back to default behavior
-          if (block->size_ == size) {
+          // if the block is not correct, log message then fall back to default behavior.
+          // with bucketed patterns the cached block was traced from the largest shape in the
+          // bucket, so any allocation that fits inside it may use it.
+          if (block->size_ == size ||
+              (session_state_.GetMemPatternBucketSize() > 1 && block->size_ >= size)) {
             void* buffer = it->second.get();
             auto status = AllocateTensorWithPreAllocateBufferHelper(
                 ort_value, static_cast<void*>(static_cast<char*>(buffer) + block->offset_), element_type, location,
@@ -396,12 +482,26 @@ Status ExecutionFrame::AllocateMLValueTensorSelfOwnBufferHelper(OrtValue& ort_va
   }
 
   //no memory pattern, or the pattern is not correct.
-  if (!alloc) alloc = GetAllocator(location);
-  std::unique_ptr<Tensor> p_tensor = onnxruntime::make_unique<Tensor>(element_type, shape, alloc);
+  // if the plan proved the value is run-local, bump-allocate it from the scratch arena; the
+  // buffer is reclaimed wholesale when the frame is destroyed. string tensors need per-element
+  // construction so they always keep a self-owned buffer.
+  void* scratch_buffer = nullptr;
+  if (static_cast<size_t>(ort_value_index) < scratch_eligible_.size() && scratch_eligible_[ort_value_index] &&
+      !utils::IsDataTypeString(element_type)) {
+    scratch_buffer = GetScratchBuffer(location, size);
+  }
 
-  {
-    auto ml_tensor = DataTypeImpl::GetType<Tensor>();
-    ort_value.Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+  if (scratch_buffer != nullptr) {
+    ORT_RETURN_IF_ERROR(
+        AllocateTensorWithPreAllocateBufferHelper(ort_value, scratch_buffer, element_type, location, shape));
+  } else {
+    if (!alloc) alloc = GetAllocator(location);
+    std::unique_ptr<Tensor> p_tensor = onnxruntime::make_unique<Tensor>(element_type, shape, alloc);
+
+    {
+      auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+      ort_value.Init(p_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+    }
   }
 
   // trace the memory allocation.
@@ -602,6 +702,26 @@ AllocatorPtr ExecutionFrame::GetAllocatorImpl(const OrtMemoryInfo& info) const {
   return session_state_.GetAllocator(info);
 }
 
+void* ExecutionFrame::GetScratchBuffer(const OrtMemoryInfo& location, size_t size) {
+  ScratchBufferArena* arena = nullptr;
+  {
+    // lazily create the per-location arena. the arena's own Alloc is thread safe, so the frame
+    // mutex only guards the map.
+    std::unique_lock<std::mutex> lock(mtx_);
+    auto it = scratch_arenas_.find(location);
+    if (it == scratch_arenas_.end()) {
+      AllocatorPtr upstream = GetAllocator(location);
+      if (!upstream) {
+        return nullptr;
+      }
+      it = scratch_arenas_.emplace(location, onnxruntime::make_unique<ScratchBufferArena>(std::move(upstream))).first;
+    }
+    arena = it->second.get();
+  }
+
+  return arena->Alloc(size);
+}
+
 // This method is not thread safe!
 // Return S_OK and nullptr if index map to an value that is an unused optional input/output
 Status ExecutionFrame::CreateNodeOutputMLValueImpl(OrtValue& ort_value, int ort_value_idx,
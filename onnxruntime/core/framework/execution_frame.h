@@ -24,6 +24,7 @@ class OrtValueNameIdxMap;
 class OrtValuePatternPlanner;
 struct MemoryPatternGroup;
 class NodeIndexInfo;
+class ScratchBufferArena;
 
 class IExecutionFrame {
  protected:
@@ -37,6 +38,13 @@ class IExecutionFrame {
             const std::unordered_map<int, OrtValue>& initializers,
             const std::vector<OrtValue>& fetches);
 
+  // Adopt a value vector recycled from an earlier frame so Init can resize it without
+  // reallocating. Must be called before Init.
+  void AdoptValueStorage(std::vector<OrtValue>&& storage);
+
+  // Hand back the value vector (cleared, capacity retained) for reuse by a later frame.
+  std::vector<OrtValue> ReleaseValueStorage();
+
  public:
   virtual ~IExecutionFrame();
 
@@ -180,6 +188,10 @@ class ExecutionFrame final : public IExecutionFrame {
   void TraceAllocate(int ort_value_idx, size_t size);
   void TraceFree(int ort_value_idx);
 
+  // bump-allocate from the run-scoped scratch arena for 'location', creating it on first use.
+  // returns nullptr if no allocator is registered for the location or the arena is exhausted.
+  void* GetScratchBuffer(const OrtMemoryInfo& location, size_t size);
+
   const AllocPlanPerValue& GetAllocationPlan(int ort_value_idx);
 
   const SessionState& session_state_;
@@ -199,6 +211,19 @@ class ExecutionFrame final : public IExecutionFrame {
   // Big chunks on different locations that will be used by mem_pattern.
   std::map<OrtMemoryInfo, BufferUniquePtr> buffers_;
 
+  // Sizes of the entries in buffers_, so the chunks can be returned to the session's
+  // pattern-buffer pool when the frame is destroyed.
+  std::map<OrtMemoryInfo, size_t> pattern_buffer_sizes_;
+
+  // Run-scoped bump-pointer arenas, one per location, created lazily. Values the allocation
+  // plan proves do not outlive this Run are allocated here and reclaimed wholesale when the
+  // frame is destroyed. Empty unless the session enables the scratch arena.
+  std::map<OrtMemoryInfo, std::unique_ptr<ScratchBufferArena>> scratch_arenas_;
+
+  // Per ort_value index flag saying whether the value's buffer may come from the scratch arena.
+  // Left empty when the scratch arena is disabled.
+  std::vector<bool> scratch_eligible_;
+
   // Given the input shapes of the executed graph, ExecutionFrame tries inferring
   // all symbolic shapes. inferred_shapes_[i] is the shape of OrtValue indexed
   // by i, if the key i exists.
@@ -4,7 +4,12 @@
 #if !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
 #include "core/framework/graph_partitioner.h"
+
+#include <atomic>
+#include <unordered_set>
+
 #include "core/framework/kernel_registry_manager.h"
+#include "core/framework/tensorprotoutils.h"
 #include "core/graph/function.h"
 #include "core/graph/graph_viewer.h"
 #include "core/framework/compute_capability.h"
@@ -12,6 +17,7 @@
 #include "core/framework/execution_providers.h"
 #include "core/framework/kernel_registry.h"
 #include "core/framework/func_kernel.h"
+#include "core/platform/threadpool.h"
 
 // uncomment this line to count non-CUDA ops in ONNX domain
 //#define COUNT_NON_CUDA_OPS
@@ -158,6 +164,45 @@ static Node* PlaceNode(Graph& graph, const IndexedSubGraph& capability,
   return result;
 }
 
+// issues one Compile call per fused node from thread pool workers so independent subgraphs are
+// compiled concurrently, and merges the results back in node order. only called for EPs whose
+// ConcurrentCompileSupported() returns true.
+static Status CompileNodesConcurrently(IExecutionProvider& current_ep,
+                                       const std::vector<Node*>& nodes_to_compile,
+                                       std::vector<NodeComputeInfo>& node_compute_funcs,
+                                       concurrency::ThreadPool* compile_pool,
+                                       int max_compile_parallelism) {
+  const size_t num_nodes = nodes_to_compile.size();
+  std::vector<std::vector<NodeComputeInfo>> per_node_funcs(num_nodes);
+  std::vector<Status> per_node_status(num_nodes);
+
+  // each worker pulls the next unclaimed node, so long-building subgraphs don't stall a
+  // statically assigned shard
+  std::atomic<size_t> next_node{0};
+  int num_workers = static_cast<int>(std::min(static_cast<size_t>(max_compile_parallelism), num_nodes));
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      compile_pool, num_workers,
+      [&current_ep, &nodes_to_compile, &per_node_funcs, &per_node_status, &next_node, num_nodes](std::ptrdiff_t) {
+        for (size_t i = next_node.fetch_add(1); i < num_nodes; i = next_node.fetch_add(1)) {
+          std::vector<Node*> single_node{nodes_to_compile[i]};
+          per_node_status[i] = current_ep.Compile(single_node, per_node_funcs[i]);
+        }
+      });
+
+  for (size_t i = 0; i < num_nodes; ++i) {
+    ORT_RETURN_IF_ERROR(per_node_status[i]);
+
+    if (per_node_funcs[i].size() != 1) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, current_ep.Type(),
+                             " did not return correct number of compiled functions");
+    }
+
+    node_compute_funcs.push_back(std::move(per_node_funcs[i][0]));
+  }
+
+  return Status::OK();
+}
+
 // for the current EP, recursively iterate through the Graph and any nested subgraphs (recursion is bottom-up).
 // assign any nodes to the EP that are currently unassigned, and that the EP can handle.
 static Status PartitionOnnxFormatModelImpl(Graph& graph, bool export_dll, FuncManager& func_mgr,
@@ -165,7 +210,9 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, bool export_dll, FuncMa
                                            KernelRegistry& fused_kernel_registry,
                                            IExecutionProvider& current_ep,
                                            GraphPartitioner::Mode mode,
-                                           int& fused_node_unique_id) {
+                                           int& fused_node_unique_id,
+                                           concurrency::ThreadPool* compile_pool,
+                                           int max_compile_parallelism) {
   // handle testing edge case where optimizers or constant lifting results in graph with no nodes.
   // doing it here saves all providers checking for this in GetCapability
   if (graph.NumberOfNodes() == 0) {
@@ -178,7 +225,8 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, bool export_dll, FuncMa
       Graph* subgraph = entry.second;
       // we pass through the export_dll value and FuncManager from the top level graph
       ORT_RETURN_IF_ERROR(PartitionOnnxFormatModelImpl(*subgraph, export_dll, func_mgr, kernel_registry_mgr,
-                                                       fused_kernel_registry, current_ep, mode, fused_node_unique_id));
+                                                       fused_kernel_registry, current_ep, mode, fused_node_unique_id,
+                                                       compile_pool, max_compile_parallelism));
     }
   }
 
@@ -242,7 +290,13 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, bool export_dll, FuncMa
           ORT_RETURN_IF_ERROR(func_mgr.AddFuncInfo(node->Name(), dll_path));
         }
       } else {
-        ORT_RETURN_IF_ERROR(current_ep.Compile(nodes_to_compile, node_compute_funcs));
+        if (compile_pool != nullptr && max_compile_parallelism > 1 && nodes_to_compile.size() > 1 &&
+            current_ep.ConcurrentCompileSupported()) {
+          ORT_RETURN_IF_ERROR(CompileNodesConcurrently(current_ep, nodes_to_compile, node_compute_funcs,
+                                                       compile_pool, max_compile_parallelism));
+        } else {
+          ORT_RETURN_IF_ERROR(current_ep.Compile(nodes_to_compile, node_compute_funcs));
+        }
 
         if (node_compute_funcs.size() != nodes_to_compile.size()) {
           return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, type, " did not return correct number of compiled functions");
@@ -333,6 +387,176 @@ static Status PartitionOnnxFormatModelImpl(Graph& graph, bool export_dll, FuncMa
   return Status::OK();
 }
 
+namespace {
+// Rough constants for weighing a cross-provider boundary copy against the device-side gain of
+// keeping a node on the provider that claimed it. Deliberately coarse: they only need to
+// separate a light memory-bound node wedged between two regions of another provider from
+// genuinely compute-heavy work.
+constexpr double kTransferBytesPerSecond = 8.0e9;         // conservative PCIe gen3-class link
+constexpr double kTransferLatencySeconds = 10.0e-6;       // per-copy submission overhead
+constexpr double kLightOpGainSecondsPerElement = 1.0e-9;  // upper bound on what a memory-bound op saves per element
+
+// compute-bound ops are assumed to be worth the boundary copies regardless of tensor sizes
+bool IsComputeHeavyOp(const std::string& op_type) {
+  static const std::unordered_set<std::string> heavy_ops = {
+      "Conv", "ConvInteger", "ConvTranspose", "Einsum", "GRU", "Gemm", "LSTM", "MatMul",
+      "MatMulInteger", "QLinearConv", "QLinearMatMul", "RNN"};
+  return heavy_ops.count(op_type) != 0;
+}
+
+// byte width of the element type, or 0 when it is not a fixed-size tensor type
+int64_t ElementSizeInBytes(const NodeArg& arg) {
+  const ONNX_NAMESPACE::TypeProto* type = arg.TypeAsProto();
+  if (type == nullptr || type->value_case() != ONNX_NAMESPACE::TypeProto::kTensorType) {
+    return 0;
+  }
+  switch (type->tensor_type().elem_type()) {
+    case ONNX_NAMESPACE::TensorProto_DataType_BOOL:
+    case ONNX_NAMESPACE::TensorProto_DataType_INT8:
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT8:
+      return 1;
+    case ONNX_NAMESPACE::TensorProto_DataType_BFLOAT16:
+    case ONNX_NAMESPACE::TensorProto_DataType_FLOAT16:
+    case ONNX_NAMESPACE::TensorProto_DataType_INT16:
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT16:
+      return 2;
+    case ONNX_NAMESPACE::TensorProto_DataType_FLOAT:
+    case ONNX_NAMESPACE::TensorProto_DataType_INT32:
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT32:
+      return 4;
+    case ONNX_NAMESPACE::TensorProto_DataType_DOUBLE:
+    case ONNX_NAMESPACE::TensorProto_DataType_INT64:
+    case ONNX_NAMESPACE::TensorProto_DataType_UINT64:
+      return 8;
+    default:
+      return 0;
+  }
+}
+
+// statically known element count, or -1 when the shape is not fully known
+int64_t ElementCount(const NodeArg& arg) {
+  const ONNX_NAMESPACE::TensorShapeProto* shape = arg.Shape();
+  if (shape == nullptr) {
+    return -1;
+  }
+  int64_t elements = 1;
+  for (const auto& dim : shape->dim()) {
+    if (!utils::HasDimValue(dim)) {
+      return -1;
+    }
+    elements *= dim.dim_value();
+  }
+  return elements;
+}
+}  // namespace
+
+// After provider-priority assignment, a single node claimed by one provider in the middle of
+// another provider's region forces a boundary copy for every tensor crossing into and out of it.
+// For light (memory-bound) ops those copies routinely cost more than running the op on the
+// claiming provider saves, so weigh the two and hand uneconomical single-node islands to the
+// surrounding provider when it has a kernel for them.
+static void ReassignUneconomicalIslands(Graph& graph, const KernelRegistryManager& kernel_registry_mgr) {
+  // recurse into nested graphs first, matching the bottom-up partitioning order
+  for (auto& node : graph.Nodes()) {
+    for (auto& entry : node.GetAttributeNameToMutableSubgraphMap()) {
+      ReassignUneconomicalIslands(*entry.second, kernel_registry_mgr);
+    }
+  }
+
+  for (auto& node : graph.Nodes()) {
+    const std::string original_provider = node.GetExecutionProviderType();
+    if (original_provider.empty() || IsComputeHeavyOp(node.OpType()) || node.ContainsSubgraph()) {
+      continue;
+    }
+
+    // the node is a singleton island only if every adjacent assigned node belongs to one other
+    // provider. a neighbor on the same provider means it is part of a larger region, which this
+    // pass does not try to evaluate.
+    std::string surrounding_provider;
+    bool is_island = true;
+    auto consider_neighbor = [&](const Node& adjacent) {
+      const std::string& neighbor_provider = adjacent.GetExecutionProviderType();
+      if (neighbor_provider.empty() || neighbor_provider == original_provider) {
+        is_island = false;
+      } else if (surrounding_provider.empty()) {
+        surrounding_provider = neighbor_provider;
+      } else if (surrounding_provider != neighbor_provider) {
+        is_island = false;
+      }
+    };
+    for (auto it = node.InputNodesBegin(); is_island && it != node.InputNodesEnd(); ++it) {
+      consider_neighbor(*it);
+    }
+    for (auto it = node.OutputNodesBegin(); is_island && it != node.OutputNodesEnd(); ++it) {
+      consider_neighbor(*it);
+    }
+    if (!is_island || surrounding_provider.empty()) {
+      continue;
+    }
+
+    // tally the boundary traffic the island causes. initializers and graph inputs are excluded:
+    // they get placed wherever the node runs and are not recurring per-Run copies. bail out if
+    // any crossing tensor has no static size, since the trade-off can't be evaluated.
+    double boundary_bytes = 0.0;
+    int boundary_tensors = 0;
+    int64_t island_elements = 0;
+    bool measurable = true;
+    for (const NodeArg* def : node.InputDefs()) {
+      if (!def->Exists() || graph.GetProducerNode(def->Name()) == nullptr) {
+        continue;
+      }
+      int64_t elements = ElementCount(*def);
+      int64_t element_size = ElementSizeInBytes(*def);
+      if (elements < 0 || element_size == 0) {
+        measurable = false;
+        break;
+      }
+      boundary_bytes += static_cast<double>(elements * element_size);
+      ++boundary_tensors;
+    }
+    for (const NodeArg* def : node.OutputDefs()) {
+      if (!measurable) {
+        break;
+      }
+      if (!def->Exists()) {
+        continue;
+      }
+      int64_t elements = ElementCount(*def);
+      int64_t element_size = ElementSizeInBytes(*def);
+      if (elements < 0 || element_size == 0) {
+        measurable = false;
+        break;
+      }
+      island_elements += elements;
+      if (!graph.GetConsumerNodes(def->Name()).empty()) {
+        boundary_bytes += static_cast<double>(elements * element_size);
+        ++boundary_tensors;
+      }
+    }
+    if (!measurable || boundary_tensors == 0) {
+      continue;
+    }
+
+    double copy_cost = boundary_tensors * kTransferLatencySeconds + boundary_bytes / kTransferBytesPerSecond;
+    double device_gain = static_cast<double>(island_elements) * kLightOpGainSecondsPerElement;
+    if (copy_cost <= device_gain) {
+      continue;
+    }
+
+    // uneconomical: move the node to the surrounding provider if it can actually run it.
+    // the provider has to be set first since kernel lookup matches against the node's provider.
+    node.SetExecutionProviderType(surrounding_provider);
+    if (!KernelRegistryManager::HasImplementationOf(kernel_registry_mgr, node, surrounding_provider)) {
+      node.SetExecutionProviderType(original_provider);
+      continue;
+    }
+
+    LOGS_DEFAULT(INFO) << "Reassigning node " << node.Name() << " (" << node.OpType() << ") from "
+                       << original_provider << " to " << surrounding_provider
+                       << " to avoid partition-induced copies.";
+  }
+}
+
 // expand any nodes that have an ONNX function definition but no matching ORT kernel
 static Status InlineNodes(Graph& graph, bool& modified_graph) {
   // recurse into nested graphs first so we process from bottom up
@@ -371,7 +595,8 @@ Status GraphPartitioner::PartitionOnnxFormatModel(Graph& graph, bool export_dll,
     // process full graph with each EP
     for (const auto& ep : providers_) {
       ORT_RETURN_IF_ERROR(PartitionOnnxFormatModelImpl(graph, export_dll, func_mgr, kernel_registry_mgr_,
-                                                       fused_kernel_registry, *ep, mode, fused_node_unique_id));
+                                                       fused_kernel_registry, *ep, mode, fused_node_unique_id,
+                                                       compile_thread_pool_, max_compile_parallelism_));
     }
 
     // expand any nodes that have an ONNX function definition but no matching ORT kernel.
@@ -384,6 +609,13 @@ Status GraphPartitioner::PartitionOnnxFormatModel(Graph& graph, bool export_dll,
     }
   } while (modified_graph);
 
+  // with all claims settled, hand back single-node islands whose boundary copies would cost more
+  // than the claiming provider saves. kAssignOnly keeps the raw claims since they record which
+  // nodes compiling EPs may take at runtime.
+  if (mode == Mode::kNormal) {
+    ReassignUneconomicalIslands(graph, kernel_registry_mgr_);
+  }
+
   return Status::OK();
 }
 
@@ -16,6 +16,10 @@ class ExecutionProviders;
 class KernelRegistry;
 class KernelRegistryManager;
 
+namespace concurrency {
+class ThreadPool;
+}
+
 class GraphPartitioner {
  public:
   enum class Mode {
@@ -25,9 +29,16 @@ class GraphPartitioner {
   };
 
   //The order of providers represents the user preference.
-  GraphPartitioner(KernelRegistryManager& kernel_registry_mgr, const ExecutionProviders& providers)
+  // compile_thread_pool and max_compile_parallelism control how many fused subgraphs an EP that
+  // declares ConcurrentCompileSupported() compiles at once. A null pool or a value <= 1 keeps the
+  // single batched Compile call per EP.
+  GraphPartitioner(KernelRegistryManager& kernel_registry_mgr, const ExecutionProviders& providers,
+                   concurrency::ThreadPool* compile_thread_pool = nullptr,
+                   int max_compile_parallelism = 1)
       : kernel_registry_mgr_(kernel_registry_mgr),
-        providers_(providers) {
+        providers_(providers),
+        compile_thread_pool_(compile_thread_pool),
+        max_compile_parallelism_(max_compile_parallelism) {
   }
 
   // Run partitioning. Provide compiled_kernel_hashes if mode is kOrtFormatLoad.
@@ -49,6 +60,8 @@ class GraphPartitioner {
 
   KernelRegistryManager& kernel_registry_mgr_;
   const ExecutionProviders& providers_;
+  concurrency::ThreadPool* compile_thread_pool_;
+  int max_compile_parallelism_;
 };
 }  // namespace onnxruntime
 
@@ -3,12 +3,16 @@
 
 #pragma once
 
+#include <algorithm>
+#include <chrono>
 #include <string>
 #include <vector>
 
+#include "core/common/common.h"
 #include "core/common/status.h"
 #include "core/framework/framework_common.h"
 #include "core/framework/ml_value.h"
+#include "core/platform/threadpool.h"
 
 struct OrtValue;
 namespace onnxruntime {
@@ -45,4 +49,52 @@ class IExecutor {
                                  const std::unordered_map<size_t, CustomAllocator>& fetch_allocators,
                                  const logging::Logger& logger) = 0;
 };
+
+// Installs a run's cancellation checkpoint on the executing thread for the lifetime of the
+// guard so that parallel loops inside kernels observe the run's terminate flag and deadline.
+// The deadline is merged with any checkpoint already installed on the thread, so subgraph
+// execution inherits the parent run's deadline. The previous state is restored on destruction.
+class ScopedCancellationCheckpoint {
+ public:
+  ScopedCancellationCheckpoint(const bool& terminate_flag, std::chrono::steady_clock::time_point deadline) {
+    concurrency::ThreadPool::CancellationCheckpoint checkpoint;
+    checkpoint.terminate = &terminate_flag;
+    checkpoint.deadline = std::min(deadline, concurrency::ThreadPool::GetThreadCancellationCheckpoint().deadline);
+    previous_ = concurrency::ThreadPool::SetThreadCancellationCheckpoint(checkpoint);
+    deadline_ = checkpoint.deadline;
+  }
+
+  ~ScopedCancellationCheckpoint() {
+    concurrency::ThreadPool::SetThreadCancellationCheckpoint(previous_);
+  }
+
+  // the deadline in effect for this execution, including any inherited from an enclosing run
+  std::chrono::steady_clock::time_point EffectiveDeadline() const { return deadline_; }
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScopedCancellationCheckpoint);
+  concurrency::ThreadPool::CancellationCheckpoint previous_;
+  std::chrono::steady_clock::time_point deadline_;
+};
+
+// Installs the session's thread pool scheduling priority on the executing thread for the
+// lifetime of the guard, so parallel loops inside kernels are queued in the session's priority
+// class when the intra-op pool is shared between sessions. The previous state is restored on
+// destruction so subgraph executions and nested runs compose.
+class ScopedSchedulingPriority {
+ public:
+  explicit ScopedSchedulingPriority(bool high_priority) {
+    previous_ = concurrency::ThreadPool::SetThreadSchedulingPriority(
+        high_priority ? concurrency::ThreadPool::SchedulingPriority::kHigh
+                      : concurrency::ThreadPool::SchedulingPriority::kNormal);
+  }
+
+  ~ScopedSchedulingPriority() {
+    concurrency::ThreadPool::SetThreadSchedulingPriority(previous_);
+  }
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScopedSchedulingPriority);
+  concurrency::ThreadPool::SchedulingPriority previous_;
+};
 }  // namespace onnxruntime
@@ -239,6 +239,15 @@ Status KernelRegistry::TryFindKernel(const onnxruntime::Node& node,
 // if this function is called before graph partition, then node.provider is not set.
 // In this case, the kernel's provider must equal to exec_provider
 // otherwise, kernel_def.provider must equal to node.provider. exec_provider is ignored.
+// Checks that a hash index probe hit is a true key match and not a 64-bit fold collision.
+static bool MatchKernelDefKey(const KernelDef& kernel_def, const std::string& op_type,
+                              const std::string& domain, const std::string& provider) {
+  const std::string& kernel_domain = kernel_def.Domain();
+  return kernel_def.OpName() == op_type && kernel_def.Provider() == provider &&
+         (kernel_domain.empty() ? kOnnxDomainAlias : kernel_domain) ==
+             (domain.empty() ? kOnnxDomainAlias : domain);
+}
+
 Status KernelRegistry::TryFindKernel(const onnxruntime::Node& node,
                                      onnxruntime::ProviderType exec_provider,
                                      uint64_t kernel_def_hash,
@@ -246,7 +255,8 @@ Status KernelRegistry::TryFindKernel(const onnxruntime::Node& node,
   const auto& node_provider = node.GetExecutionProviderType();
   const auto& expected_provider = (node_provider.empty() ? exec_provider : node_provider);
 
-  auto range = kernel_creator_fn_map_.equal_range(GetMapKey(node.OpType(), node.Domain(), expected_provider));
+  auto range = kernel_creator_fn_map_.equal_range(
+      GetMapKeyHash(node.OpType(), node.Domain(), expected_provider));
   *out = nullptr;
 
   // if we have a hash (ORT format model) use only that.
@@ -271,6 +281,9 @@ Status KernelRegistry::TryFindKernel(const onnxruntime::Node& node,
     std::vector<std::string> verify_kernel_def_error_strs;
 
     for (auto i = range.first; i != range.second; ++i) {
+      if (!MatchKernelDefKey(*i->second.kernel_def, node.OpType(), node.Domain(), expected_provider)) {
+        continue;  // hash collision with a different op/domain/provider
+      }
       std::string error_str;
       if (VerifyKernelDef(node, *i->second.kernel_def, error_str)) {
         *out = &i->second;
@@ -305,21 +318,24 @@ Status KernelRegistry::Register(KernelCreateInfo&& create_info) {
   if (!create_info.kernel_def) {
     return Status(ONNXRUNTIME, FAIL, "kernel def can't be NULL");
   }
-  std::string key = GetMapKey(*create_info.kernel_def);
-  // Check op version conflicts.
-  auto range = kernel_creator_fn_map_.equal_range(key);
+  const KernelDef& kernel_def = *create_info.kernel_def;
+  uint64_t key_hash = GetMapKeyHash(kernel_def);
+  // Check op version conflicts within the same opname+domain+provider key. IsConflict does not
+  // compare domains, so a fold collision must be weeded out before it runs.
+  auto range = kernel_creator_fn_map_.equal_range(key_hash);
   for (auto i = range.first; i != range.second; ++i) {
     if (i->second.kernel_def &&
-        i->second.kernel_def->IsConflict(*create_info.kernel_def)) {
+        MatchKernelDefKey(*i->second.kernel_def, kernel_def.OpName(), kernel_def.Domain(), kernel_def.Provider()) &&
+        i->second.kernel_def->IsConflict(kernel_def)) {
       return Status(ONNXRUNTIME, FAIL,
-                    "Failed to add kernel for " + key +
+                    "Failed to add kernel for " + GetMapKey(kernel_def) +
                         ": Conflicting with a registered kernel with op versions.");
     }
   }
 
   // Register the kernel.
   // Ownership of the KernelDef is transferred to the map.
-  kernel_creator_fn_map_.emplace(key, std::move(create_info));
+  kernel_creator_fn_map_.emplace(key_hash, std::move(create_info));
   return Status::OK();
 }
 
@@ -9,6 +9,7 @@
 
 namespace onnxruntime {
 size_t MemoryInfo::iteration_ = 0;
+std::vector<std::string> MemoryInfo::node_names_in_execution_order_;
 size_t MemoryInfo::num_node_size_ = 0;
 int MemoryInfo::local_rank_ = 0;
 std::map<OrtMemoryInfo, std::map<MemoryInfo::MapType, MemoryInfoMap> > MemoryInfo::tensors_memory_info_map_;
@@ -45,6 +46,12 @@ void MemoryInfo::GenerateTensorMap(const SequentialExecutionPlan* execution_plan
   return;
 }
 
+void MemoryInfo::RecordNodeExecutionOrder(std::vector<std::string>&& node_names) {
+  if (node_names_in_execution_order_.empty()) {
+    node_names_in_execution_order_ = std::move(node_names);
+  }
+}
+
 //Record the planned memory information
 void MemoryInfo::RecordMemoryPatternInfo(const MemoryPatternGroup& mem_patterns, MapType type) {
   for (const auto& location : mem_patterns.locations) {
@@ -355,6 +362,64 @@ void MemoryInfo::MemoryInfoProfile::CreateEvents(const std::string& p_name, cons
   }
 }
 
+//CSV-escape a node name so commas/quotes in names don't break the timeline format
+static std::string CsvQuote(const std::string& name) {
+  std::string quoted = "\"";
+  for (char c : name) {
+    if (c == '"') quoted += '"';
+    quoted += c;
+  }
+  quoted += '"';
+  return quoted;
+}
+
+void MemoryInfo::GenerateNodeMemoryTimeline() {
+  if (num_node_size_ == 0) return;
+  std::ofstream timeline("memory_timeline_" + std::to_string(local_rank_) + ".csv", std::ios::trunc);
+  timeline << "location,step,node_name,live_bytes,allocated_bytes,freed_bytes,live_tensors\n";
+
+  for (const auto& location_map : tensors_memory_info_map_) {
+    const auto& location = location_map.first;
+    std::vector<size_t> live_bytes(num_node_size_, 0);
+    std::vector<size_t> allocated_bytes(num_node_size_, 0);
+    std::vector<size_t> freed_bytes(num_node_size_, 0);
+    std::vector<size_t> live_tensors(num_node_size_, 0);
+
+    for (const auto& item : tensor_alloc_info_map_) {
+      const auto& info = item.second;
+      if (!(info.location == location)) continue;
+      //reused buffers are accounted for by the tensor that owns the allocation
+      if (info.inplace_reuse || info.alloc_kind == AllocKind::kReuse) continue;
+
+      //prefer the actually allocated size; fall back to the planned size for static types
+      size_t size = 0;
+      for (const auto& type_map : location_map.second) {
+        if (!type_map.second.Contain(item.first)) continue;
+        size = IsStaticType(type_map.first) ? type_map.second.GetPlannedSize(item.first)
+                                            : type_map.second.GetAllocSize(item.first);
+        if (size != 0) break;
+      }
+      if (size == 0) continue;
+
+      const size_t start = std::min(info.lifetime_interval.first, num_node_size_ - 1);
+      const size_t end = std::min(info.lifetime_interval.second, num_node_size_ - 1);
+      allocated_bytes[start] += size;
+      freed_bytes[end] += size;
+      for (size_t step = start; step <= end; ++step) {
+        live_bytes[step] += size;
+        ++live_tensors[step];
+      }
+    }
+
+    for (size_t step = 0; step < num_node_size_; ++step) {
+      const std::string& node_name =
+          step < node_names_in_execution_order_.size() ? node_names_in_execution_order_[step] : std::string();
+      timeline << location.name << "," << step << "," << CsvQuote(node_name) << "," << live_bytes[step] << ","
+               << allocated_bytes[step] << "," << freed_bytes[step] << "," << live_tensors[step] << "\n";
+    }
+  }
+}
+
 void MemoryInfo::GenerateMemoryProfile() {
   // Write memory profile .json
   std::ofstream memory_profile("memory_profile_" + std::to_string(local_rank_) + ".json", std::ios::trunc);
@@ -158,6 +158,15 @@ class MemoryInfo {
   };
 
   static void GenerateTensorMap(const SequentialExecutionPlan* execution_plan, const OrtValueNameIdxMap& value_name_idx_map);
+
+  //Record the node names in execution order so the profile output can attribute each time step to
+  //the node executing at that step.
+  static void RecordNodeExecutionOrder(std::vector<std::string>&& node_names);
+
+  //Emit a per-step CSV timeline per location with node attribution: for every execution step, the
+  //node running at that step, the bytes allocated/freed at the step and the live-byte watermark.
+  //Answers "which node drives peak memory" so fusions can target the worst offenders.
+  static void GenerateNodeMemoryTimeline();
   static void RecordPatternInfo(const MemoryPatternGroup& mem_patterns,  const MapType& type);
 
   static void RecordInitializerAllocInfo(const std::unordered_map<int, OrtValue>& tensor_map);
@@ -222,6 +231,8 @@ class MemoryInfo {
   static size_t iteration_;
   static size_t num_node_size_;
   static int local_rank_;
+  //Node names in execution order; index is the execution step.
+  static std::vector<std::string> node_names_in_execution_order_;
   //Memory Profile
   static std::map<MapType, std::set<size_t> > time_step_trace_;
 };
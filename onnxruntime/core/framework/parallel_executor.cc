@@ -18,12 +18,14 @@
 
 namespace onnxruntime {
 
-ParallelExecutor::ParallelExecutor(const SessionState& session_state, const bool& terminate_flag)
-    : out_standings_(0), terminate_flag_(terminate_flag), executor_pool_(session_state.GetInterOpThreadPool()) {
-  const auto& graph_viewer = session_state.GetGraphViewer();
-  node_refs_.resize(graph_viewer.MaxNodeIndex());
-  for (auto& node : graph_viewer.Nodes()) {
-    node_refs_[node.Index()] = node.GetInputEdgesCount();
+ParallelExecutor::ParallelExecutor(const SessionState& session_state, const bool& terminate_flag,
+                                   std::chrono::steady_clock::time_point deadline)
+    : terminate_flag_(terminate_flag), deadline_(deadline), executor_pool_(session_state.GetInterOpThreadPool()) {
+  // seed the dependency counters from the counts precomputed in SessionState
+  const auto& input_edge_counts = session_state.GetNodeInputEdgeCounts();
+  node_refs_ = onnxruntime::make_unique<std::atomic<int>[]>(input_edge_counts.size());
+  for (size_t i = 0; i < input_edge_counts.size(); ++i) {
+    node_refs_[i].store(input_edge_counts[i], std::memory_order_relaxed);
   }
 }
 
@@ -53,7 +55,7 @@ Status ParallelExecutor::Execute(const SessionState& session_state, const std::v
   // Wait for finish.
   {
     std::unique_lock<OrtMutex> lock(complete_mutex_);
-    while (out_standings_ > 0) complete_cv_.wait(lock);
+    while (out_standings_.load(std::memory_order_acquire) > 0) complete_cv_.wait(lock);
   }
 
   Status status = Status::OK();
@@ -122,6 +124,16 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
   const bool f_profiler_enabled = session_state.Profiler().IsEnabled();
   const SequentialExecutionPlan& exec_plan = *session_state.GetExecutionPlan();
 
+  // node tasks run on inter-op pool threads, so the cancellation checkpoint is installed per
+  // task to make the terminate flag and deadline visible to parallel loops inside the kernels
+  ScopedCancellationCheckpoint cancellation_checkpoint(terminate_flag_, deadline_);
+  const auto effective_deadline = cancellation_checkpoint.EffectiveDeadline();
+  const bool check_deadline = effective_deadline != std::chrono::steady_clock::time_point::max();
+
+  // likewise installed per task so intra-op loops started from this node run in the
+  // session's scheduling priority class
+  ScopedSchedulingPriority scheduling_priority(session_state.GetUseHighPriorityScheduling());
+
   // Avoid context switching if possible.
   while (keep_running) {
     // TODO: Convert RunNodeAsync return Status.
@@ -131,6 +143,11 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
       ORT_THROW("Exiting due to terminate flag being set to true.");
     }
 
+    if (check_deadline && std::chrono::steady_clock::now() >= effective_deadline) {
+      LOGS(logger, WARNING) << "Exiting due to the run deadline being exceeded.";
+      ORT_THROW("Exiting due to the run deadline being exceeded.");
+    }
+
     const auto* p_op_kernel = session_state.GetKernel(node_index);
     const auto& node = *graph_viewer.GetNode(node_index);
 
@@ -257,15 +274,16 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
 
     keep_running = false;
 
-    // Checking which output nodes ready for running.
+    // Check which successor nodes became ready. The first one continues on this thread, so
+    // single-successor chains run as one task without re-enqueueing; any others go to the
+    // inter-op pool, whose per-thread queues distribute them via work stealing.
     {
       auto begin = node.OutputEdgesBegin();
       auto end = node.OutputEdgesEnd();
 
-      std::lock_guard<OrtMutex> lock(ref_mutex_);
       for (auto it = begin; it != end; it++) {
         auto idx = (*it).GetNode().Index();
-        if ((--node_refs_[idx]) == 0) {
+        if (node_refs_[idx].fetch_sub(1, std::memory_order_acq_rel) == 1) {
           if (!keep_running) {
             node_index = idx;
             keep_running = true;
@@ -273,10 +291,6 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
             EnqueueNode(idx, session_state, logger);
           }
         }
-
-        // std::cout << "handle output, current name: " << node.Name() << ", current index: "
-        // << p_node_index << ", output name: " << (*it)->GetNode().Name() << ", output index: "
-        // << (*it)->GetNode().Index() << ", after -- output ref: " << node_refs_[idx] << std::endl;
       }
     }
   }
@@ -285,14 +299,11 @@ Status ParallelExecutor::RunNodeAsync(size_t p_node_index,
 }
 
 void ParallelExecutor::EnqueueNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger) {
-  {
-    std::unique_lock<OrtMutex> lock(complete_mutex_);
-    // if there are errors there's no point queuing more work
-    if (!errors_.empty())
-      return;
+  // if there are errors there's no point queuing more work
+  if (have_errors_.load(std::memory_order_acquire))
+    return;
 
-    out_standings_++;
-  }
+  out_standings_.fetch_add(1, std::memory_order_acq_rel);
 
   onnxruntime::concurrency::ThreadPool::Schedule(executor_pool_, [this, p_node_index, &session_state, &logger]() {
     auto create_exception_message = [p_node_index, &session_state](const std::exception* ex) {
@@ -3,6 +3,9 @@
 
 #pragma once
 
+#include <atomic>
+#include <chrono>
+#include <memory>
 #include <vector>
 #include "core/common/common.h"
 #include "core/common/status.h"
@@ -20,7 +23,8 @@ class ExecutionFrame;
 
 class ParallelExecutor : public IExecutor {
  public:
-  ParallelExecutor(const SessionState& session_state, const bool& terminate_flag = false);
+  ParallelExecutor(const SessionState& session_state, const bool& terminate_flag = false,
+                   std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max());
 
   common::Status Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                          const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
@@ -36,30 +40,34 @@ class ParallelExecutor : public IExecutor {
   void EnqueueNode(size_t p_node_index, const SessionState& session_state, const logging::Logger& logger);
 
   void FinishNodeRun(const Status& status) {
-    bool finished = false;
-    {
-      //Because we have a mutex here, it's not possible another thread is doing the test("while (out_standings_ > 0)"
-      std::lock_guard<OrtMutex> lock(complete_mutex_);
-      finished = --out_standings_ == 0;
-      if (!status.IsOK())
-        errors_.push_back(status);
+    if (!status.IsOK()) {
+      std::lock_guard<OrtMutex> lock(errors_mutex_);
+      errors_.push_back(status);
+      have_errors_.store(true, std::memory_order_release);
     }
 
-    if (finished) {
-      //std::cout << "all out standing nodes are completed." << std::endl;
+    if (out_standings_.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+      // taking the lock pairs with the waiter's predicate check so the notification can't be
+      // missed between its out_standings_ load and the wait
+      std::lock_guard<OrtMutex> lock(complete_mutex_);
       complete_cv_.notify_all();
     }
   }
 
   std::unique_ptr<ExecutionFrame> root_frame_;
-  std::vector<size_t> node_refs_;
-  OrtMutex ref_mutex_;
-  int out_standings_;  //protected by complete_mutex_
+  // count of unsatisfied input edges per node index; a node is scheduled when its count hits zero.
+  // atomics let completing nodes release successors without a shared lock.
+  std::unique_ptr<std::atomic<int>[]> node_refs_;
+  std::atomic<int> out_standings_{0};
   OrtMutex complete_mutex_;
   OrtCondVar complete_cv_;
-  std::vector<Status> errors_;
+  std::atomic<bool> have_errors_{false};
+  OrtMutex errors_mutex_;
+  std::vector<Status> errors_;  // protected by errors_mutex_ until execution completes
 
   const bool& terminate_flag_;
+  // the point in time at which the run is cooperatively cancelled; time_point::max() = no limit
+  const std::chrono::steady_clock::time_point deadline_;
   // TODO: Temporary threadpool for the executor.  This is a costly way to handle the problem.
   onnxruntime::concurrency::ThreadPool* const executor_pool_{};
 };
@@ -84,4 +84,73 @@ class PhiloxGenerator {
   uint64_t offset_;
 };
 
+/**
+ * Counter-based Philox-4x32-10 engine for the CPU kernels.  Each (seed, counter)
+ * pair maps to an independent block of four 32-bit random values, so disjoint
+ * counter ranges can be generated in parallel and the stream for a given seed
+ * and offset is reproducible no matter how the work is sharded.
+ */
+class Philox4x32x10 {
+ public:
+  Philox4x32x10(uint64_t seed, uint64_t counter)
+      : counter_(counter),
+        key0_(static_cast<uint32_t>(seed)),
+        key1_(static_cast<uint32_t>(seed >> 32)) {}
+
+  /**
+   * Generates the block of four 32-bit values for the current counter and
+   * advances the counter to the next block.
+   */
+  void NextBlock(uint32_t output[4]) {
+    uint32_t x0 = static_cast<uint32_t>(counter_);
+    uint32_t x1 = static_cast<uint32_t>(counter_ >> 32);
+    uint32_t x2 = 0;
+    uint32_t x3 = 0;
+    uint32_t k0 = key0_;
+    uint32_t k1 = key1_;
+
+    for (int round = 0; round < 10; ++round) {
+      const uint64_t product0 = kMultiplier0 * static_cast<uint64_t>(x0);
+      const uint64_t product1 = kMultiplier1 * static_cast<uint64_t>(x2);
+      const uint32_t y0 = static_cast<uint32_t>(product1 >> 32) ^ x1 ^ k0;
+      const uint32_t y1 = static_cast<uint32_t>(product1);
+      const uint32_t y2 = static_cast<uint32_t>(product0 >> 32) ^ x3 ^ k1;
+      const uint32_t y3 = static_cast<uint32_t>(product0);
+      x0 = y0;
+      x1 = y1;
+      x2 = y2;
+      x3 = y3;
+      k0 += kKeyIncrement0;
+      k1 += kKeyIncrement1;
+    }
+
+    output[0] = x0;
+    output[1] = x1;
+    output[2] = x2;
+    output[3] = x3;
+    ++counter_;
+  }
+
+ private:
+  static constexpr uint64_t kMultiplier0 = 0xD2511F53;
+  static constexpr uint64_t kMultiplier1 = 0xCD9E8D57;
+  static constexpr uint32_t kKeyIncrement0 = 0x9E3779B9;
+  static constexpr uint32_t kKeyIncrement1 = 0xBB67AE85;
+
+  uint64_t counter_;
+  uint32_t key0_;
+  uint32_t key1_;
+};
+
+/** Converts one 32-bit Philox lane to a uniform float in [0, 1). */
+inline float PhiloxUniformFloat(uint32_t bits) {
+  return static_cast<float>(bits >> 8) * (1.0f / 16777216.0f);
+}
+
+/** Converts two 32-bit Philox lanes to a uniform double in [0, 1). */
+inline double PhiloxUniformDouble(uint32_t hi, uint32_t lo) {
+  const uint64_t bits = (static_cast<uint64_t>(hi) << 32) | lo;
+  return static_cast<double>(bits >> 11) * (1.0 / 9007199254740992.0);
+}
+
 }  // namespace onnxruntime
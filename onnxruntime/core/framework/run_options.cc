@@ -53,3 +53,11 @@ ORT_API_STATUS_IMPL(OrtApis::RunOptionsUnsetTerminate, _Inout_ OrtRunOptions* op
   options->terminate = false;
   return nullptr;
 }
+
+ORT_API_STATUS_IMPL(OrtApis::RunOptionsSetTimeout, _Inout_ OrtRunOptions* options, int64_t timeout_in_ms) {
+  if (timeout_in_ms < 0) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "timeout_in_ms must be >= 0");
+  }
+  options->timeout_in_ms = timeout_in_ms;
+  return nullptr;
+}
@@ -0,0 +1,66 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/scratch_buffer_arena.h"
+
+#include <algorithm>
+
+namespace onnxruntime {
+
+ScratchBufferArena::ScratchBufferArena(AllocatorPtr upstream, size_t initial_slab_bytes)
+    : upstream_(std::move(upstream)), next_slab_bytes_(initial_slab_bytes) {
+  ORT_ENFORCE(upstream_ != nullptr, "ScratchBufferArena requires an upstream allocator.");
+}
+
+ScratchBufferArena::~ScratchBufferArena() {
+  for (auto& slab : slabs_) {
+    upstream_->Free(slab.base);
+  }
+}
+
+void* ScratchBufferArena::Alloc(size_t size) {
+  if (size == 0) {
+    return nullptr;
+  }
+
+  // keep every allocation kAllocAlignment aligned. slab bases come from the upstream allocator
+  // which provides at least that alignment (the memory pattern big-chunk path relies on the same).
+  const size_t rounded = (size + kAllocAlignment - 1) & ~(kAllocAlignment - 1);
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+
+  if (!slabs_.empty()) {
+    Slab& current = slabs_.back();
+    if (current.capacity - current.used >= rounded) {
+      void* p = static_cast<char*>(current.base) + current.used;
+      current.used += rounded;
+      return p;
+    }
+  }
+
+  // grow geometrically so steady-state runs settle on a single slab. oversized requests get a
+  // dedicated slab without disturbing the growth sequence.
+  const size_t slab_bytes = std::max(next_slab_bytes_, rounded);
+  void* base = upstream_->Alloc(slab_bytes);
+  if (base == nullptr) {
+    return nullptr;
+  }
+
+  slabs_.push_back(Slab{base, slab_bytes, rounded});
+  if (slab_bytes == next_slab_bytes_ && next_slab_bytes_ < kMaxSlabBytes) {
+    next_slab_bytes_ <<= 1;
+  }
+
+  return base;
+}
+
+size_t ScratchBufferArena::TotalSlabBytes() const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  size_t total = 0;
+  for (const auto& slab : slabs_) {
+    total += slab.capacity;
+  }
+  return total;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,52 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/allocator.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+// Bump-pointer arena for tensors that provably do not outlive a single Run call.
+// Slabs are carved out of the upstream allocator and handed back wholesale when the arena is
+// destroyed, so a run-local allocation costs a pointer increment instead of the general
+// allocator's per-chunk bookkeeping.
+// Alloc is thread safe so the parallel executor can allocate from multiple threads.
+class ScratchBufferArena {
+ public:
+  explicit ScratchBufferArena(AllocatorPtr upstream, size_t initial_slab_bytes = kDefaultInitialSlabBytes);
+
+  // returns all slabs to the upstream allocator
+  ~ScratchBufferArena();
+
+  // Returns kAllocAlignment aligned memory that stays valid until the arena is destroyed,
+  // or nullptr if size is 0 or the upstream allocator could not provide a slab.
+  void* Alloc(size_t size);
+
+  // total bytes currently held in slabs. primarily for logging/tests.
+  size_t TotalSlabBytes() const;
+
+  static constexpr size_t kDefaultInitialSlabBytes = 1 * 1024 * 1024;
+  // cap on geometric slab growth. requests larger than this get a dedicated slab.
+  static constexpr size_t kMaxSlabBytes = 64 * 1024 * 1024;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ScratchBufferArena);
+
+  struct Slab {
+    void* base;
+    size_t capacity;
+    size_t used;
+  };
+
+  AllocatorPtr upstream_;
+  std::vector<Slab> slabs_;
+  size_t next_slab_bytes_;
+  mutable OrtMutex mutex_;
+};
+
+}  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #include "core/framework/sequential_executor.h"
 
+#include <algorithm>
 #include <chrono>
 #include <thread>
 #include <vector>
@@ -14,6 +15,7 @@
 #include "core/framework/session_state.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/utils.h"
+#include "core/platform/threadpool.h"
 
 #if defined DEBUG_NODE_INPUTS_OUTPUTS
 #include "core/framework/debug_node_inputs_outputs_utils.h"
@@ -128,9 +130,15 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                    const std::unordered_map<size_t, CustomAllocator>& fetch_allocators,
                                    const logging::Logger& logger) {
   const bool is_profiler_enabled = session_state.Profiler().IsEnabled();
+  // sampled node timing is independent of the profiler so it can stay on in release builds.
+  // the sampling decision is made once per Run; unsampled runs only pay for this check.
+  const bool sample_node_timing =
+      session_state.NodeTimingSamplingEnabled() && session_state.ShouldSampleNodeTiming();
   TimePoint tp;
   TimePoint sync_time_begin;
   TimePoint kernel_begin_time;
+  TimePoint sampled_kernel_begin_time;
+  concurrency::ThreadPool::PoolStats pool_stats_begin;
   size_t input_activation_sizes = 0;
   size_t input_parameter_sizes = 0;
   size_t total_output_sizes = 0;
@@ -155,10 +163,26 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 #endif
 
   LOGS(logger, INFO) << "Begin execution";
+
+  // make the terminate flag and deadline visible to parallel loops inside kernels for the
+  // duration of the execution, so abandoned runs stop consuming cores mid-kernel
+  ScopedCancellationCheckpoint cancellation_checkpoint(terminate_flag_, deadline_);
+  const auto effective_deadline = cancellation_checkpoint.EffectiveDeadline();
+  const bool check_deadline = effective_deadline != std::chrono::steady_clock::time_point::max();
+
+  // queue this session's parallel loop shards in its scheduling priority class for the
+  // duration of the execution; matters when the intra-op pool is shared between sessions
+  ScopedSchedulingPriority scheduling_priority(session_state.GetUseHighPriorityScheduling());
+
   const SequentialExecutionPlan& seq_exec_plan = *session_state.GetExecutionPlan();
   const auto& exec_plan_vec = seq_exec_plan.execution_plan;
   VLOGS(logger, 1) << "Size of execution plan vector: " << exec_plan_vec.size();
 
+  // flat kernel/node/fence records baked at plan time; avoids the per-node graph and plan lookups
+  // on every Run. empty if the session state was not finalized (e.g. some unit tests).
+  const auto& baked_plan = session_state.GetBakedExecutionPlan();
+  const bool use_baked_plan = baked_plan.size() == exec_plan_vec.size();
+
 // Enable TRACE_EXECUTION compile flag to dump execution plan
 #if defined(TRACE_EXECUTION)
   std::cout << std::make_pair(&seq_exec_plan, &session_state) << std::endl;
@@ -188,12 +212,18 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       profile::Color::Black);
 #endif
 
-  for (const auto& node_exec_plan : exec_plan_vec) {
+  for (size_t program_counter = 0; program_counter < exec_plan_vec.size(); ++program_counter) {
+    const auto& node_exec_plan = exec_plan_vec[program_counter];
     if (terminate_flag_) {
       LOGS(logger, WARNING) << "Exiting due to terminate flag being set to true.";
       return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to terminate flag being set to true.");
     }
 
+    if (check_deadline && std::chrono::steady_clock::now() >= effective_deadline) {
+      LOGS(logger, WARNING) << "Exiting due to the run deadline being exceeded.";
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Exiting due to the run deadline being exceeded.");
+    }
+
     auto node_index = node_exec_plan.node_index;
 
     // If it is not necessary to execute the node.
@@ -201,7 +231,8 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       continue;
     }
 
-    const auto& node = *graph_viewer.GetNode(node_exec_plan.node_index);
+    const auto& node = use_baked_plan ? *baked_plan[program_counter].node
+                                      : *graph_viewer.GetNode(node_exec_plan.node_index);
 
 #ifdef CONCURRENCY_VISUALIZER
     series.write_flag(node.Name().c_str());
@@ -219,13 +250,19 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     }
 #endif
 
-    auto p_op_kernel = session_state.GetKernel(node_index);
+    auto p_op_kernel = use_baked_plan ? baked_plan[program_counter].kernel
+                                      : session_state.GetKernel(node_index);
 
     // if a kernel has been added in the session state, it better be NON-null.
     if (p_op_kernel == nullptr)
       return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Got nullptr from GetKernel for node: ",
                              node.Name());
 
+    // resolved at plan time for the baked plan so fence-free graphs skip all fence handling
+    // without touching the execution plan on the hot path
+    const bool node_has_fence = use_baked_plan ? baked_plan[program_counter].has_fence
+                                               : seq_exec_plan.NodeHasFence(node_index);
+
 #ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
     LARGE_INTEGER kernel_start;
     QueryPerformanceCounter(&kernel_start);
@@ -240,7 +277,7 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 
     // sync before compute
     int queue_id = p_op_kernel->KernelDef().ExecQueueId();
-    if (seq_exec_plan.NodeHasFence(node_index)) {
+    if (node_has_fence) {
       for (int input_index = 0; input_index < op_kernel_context.InputCount(); ++input_index) {
         Fence_t fence = op_kernel_context.InputFence(input_index);
         if (fence) {
@@ -290,12 +327,17 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
       VLOGS(logger, 1) << "Computing kernel: " << node_name_for_profiling;
 
       kernel_begin_time = session_state.Profiler().StartTime();
+      pool_stats_begin = concurrency::ThreadPool::GetStats(session_state.GetThreadPool());
 
       // Calculate total input sizes for this operation.
       CalculateTotalInputSizes(&op_kernel_context, p_op_kernel,
                                input_activation_sizes, input_parameter_sizes, node_name_for_profiling);
     }
 
+    if (sample_node_timing) {
+      sampled_kernel_begin_time = std::chrono::high_resolution_clock::now();
+    }
+
     Status compute_status;
     {
 #ifdef CONCURRENCY_VISUALIZER
@@ -326,6 +368,14 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
 #endif
     }
 
+    if (sample_node_timing) {
+      session_state.AccumulateNodeTime(
+          node_index,
+          static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(
+                                    std::chrono::high_resolution_clock::now() - sampled_kernel_begin_time)
+                                    .count()));
+    }
+
     if (!compute_status.IsOK()) {
       std::ostringstream ss;
       ss << "Non-zero status code returned while running " << node.OpType() << " node. Name:'" << node.Name()
@@ -341,6 +391,10 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
     }
 
     if (is_profiler_enabled) {
+      // intra-op pool activity while this kernel was running; lets a profile consumer judge
+      // how much parallelism each op actually achieved
+      const auto pool_stats_end = concurrency::ThreadPool::GetStats(session_state.GetThreadPool());
+
       // Calculate total output sizes for this operation.
       CalculateTotalOutputSizes(&op_kernel_context, total_output_sizes, node_name_for_profiling);
 
@@ -369,13 +423,19 @@ Status SequentialExecutor::Execute(const SessionState& session_state, const std:
                                                          {"activation_size", std::to_string(input_activation_sizes)},
                                                          {"parameter_size", std::to_string(input_parameter_sizes)},
                                                          {"output_size", std::to_string(total_output_sizes)},
+                                                         {"pool_tasks", std::to_string(pool_stats_end.tasks_executed -
+                                                                                       pool_stats_begin.tasks_executed)},
+                                                         {"pool_steals", std::to_string(pool_stats_end.steals -
+                                                                                        pool_stats_begin.steals)},
+                                                         {"pool_idle_blocks", std::to_string(pool_stats_end.blocks -
+                                                                                             pool_stats_begin.blocks)},
                                                      });
 
       sync_time_begin = session_state.Profiler().StartTime();
     }
 
     // sync after compute for outputs
-    if (seq_exec_plan.NodeHasFence(node_index)) {
+    if (node_has_fence) {
       for (int input_index = 0; input_index < op_kernel_context.InputCount(); ++input_index) {
         Fence_t fence = op_kernel_context.InputFence(input_index);
         if (fence) {
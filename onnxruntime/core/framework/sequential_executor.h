@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <chrono>
 #include <vector>
 #include <unordered_map>
 #include "core/common/common.h"
@@ -18,8 +19,11 @@
 namespace onnxruntime {
 class SequentialExecutor : public IExecutor {
  public:
-  SequentialExecutor(const bool& terminate_flag = false, const bool only_execute_path_to_fetches = false)
-      : terminate_flag_{terminate_flag}, only_execute_path_to_fetches_(only_execute_path_to_fetches) {}
+  SequentialExecutor(const bool& terminate_flag = false, const bool only_execute_path_to_fetches = false,
+                     std::chrono::steady_clock::time_point deadline = std::chrono::steady_clock::time_point::max())
+      : terminate_flag_{terminate_flag},
+        only_execute_path_to_fetches_(only_execute_path_to_fetches),
+        deadline_(deadline) {}
 
   common::Status Execute(const SessionState& session_state, const std::vector<int>& feed_mlvalue_idxs,
                          const std::vector<OrtValue>& feeds, const std::vector<int>& fetch_mlvalue_idxs,
@@ -31,5 +35,7 @@ class SequentialExecutor : public IExecutor {
   ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SequentialExecutor);
   const bool& terminate_flag_;
   const bool only_execute_path_to_fetches_;
+  // the point in time at which the run is cooperatively cancelled; time_point::max() = no limit
+  const std::chrono::steady_clock::time_point deadline_;
 };
 }  // namespace onnxruntime
@@ -13,7 +13,9 @@
 #include "core/framework/op_kernel.h"
 #include "core/framework/ort_value_pattern_planner.h"
 #include "core/framework/session_state_utils.h"
+#include "core/framework/startup_memory_profiler.h"
 #include "core/framework/utils.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/controlflow/utils.h"
 #include "core/session/onnxruntime_session_options_config_keys.h"
 
@@ -119,6 +121,13 @@ void SessionState::CreateGraphInfo() {
     }
   }
 
+  // precompute per-node input-edge counts so the parallel executor can seed its dependency
+  // counters without walking the graph on every Run
+  node_input_edge_counts_.assign(graph_viewer_->MaxNodeIndex(), 0);
+  for (auto& node : graph_viewer_->Nodes()) {
+    node_input_edge_counts_[node.Index()] = static_cast<int>(node.GetInputEdgesCount());
+  }
+
   LOGS(logger_, VERBOSE) << "Done saving OrtValue mappings.";
 }
 
@@ -174,24 +183,107 @@ Status SessionState::CreateKernels(const KernelRegistryManager& kernel_registry_
     }
     session_kernels_.clear();
     session_kernels_.resize(max_nodeid + 1, nullptr);
+
+    if (NodeTimingSamplingEnabled()) {
+      node_timing_cumulative_ns_ = onnxruntime::make_unique<std::atomic<uint64_t>[]>(max_nodeid + 1);
+      node_timing_sampled_runs_ = onnxruntime::make_unique<std::atomic<uint64_t>[]>(max_nodeid + 1);
+      for (size_t i = 0; i <= max_nodeid; ++i) {
+        node_timing_cumulative_ns_[i].store(0, std::memory_order_relaxed);
+        node_timing_sampled_runs_[i].store(0, std::memory_order_relaxed);
+      }
+    }
+
+    // Construct the kernels in parallel. Construction of one kernel only reads per-node state
+    // (the node's attributes and KernelCreateInfo, plus the constant initializers saved before
+    // this is called) and writes the node's own session_kernels_ slot, so nodes are fanned out
+    // over the intra-op thread pool. Attribute parsing and kernel-owned buffer setup dominate
+    // the cost, which adds up on models with many nodes.
+    std::vector<const Node*> node_ptrs;
+    node_ptrs.reserve(graph_viewer_->NumberOfNodes());
     for (const auto& node : nodes) {
-      // construct and save the kernels
-      const KernelCreateInfo& kci = GetNodeKernelCreateInfo(node.Index());
+      node_ptrs.push_back(&node);
+    }
+
+    std::vector<Status> create_statuses(node_ptrs.size());
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        thread_pool_, static_cast<std::ptrdiff_t>(node_ptrs.size()),
+        [&](std::ptrdiff_t i) {
+          const Node& node = *node_ptrs[i];
+          ORT_TRY {
+            const KernelCreateInfo& kci = GetNodeKernelCreateInfo(node.Index());
 
-      // the execution provider was required to be valid to find the KernelCreateInfo so we don't need to check it here
-      onnxruntime::ProviderType exec_provider_name = node.GetExecutionProviderType();
-      const IExecutionProvider& exec_provider = *execution_providers_.Get(exec_provider_name);
+            // the execution provider was required to be valid to find the KernelCreateInfo so we don't need to
+            // check it here
+            onnxruntime::ProviderType exec_provider_name = node.GetExecutionProviderType();
+            const IExecutionProvider& exec_provider = *execution_providers_.Get(exec_provider_name);
 
-      auto op_kernel = kernel_registry_manager.CreateKernel(node, exec_provider, *this, kci);
+            auto op_kernel = kernel_registry_manager.CreateKernel(node, exec_provider, *this, kci);
 
-      // assumes vector is already resize()'ed to the number of nodes in the graph
-      session_kernels_[node.Index()] = op_kernel.release();
+            // assumes vector is already resize()'ed to the number of nodes in the graph
+            session_kernels_[node.Index()] = op_kernel.release();
+          }
+          ORT_CATCH(const std::exception& ex) {
+            ORT_HANDLE_EXCEPTION([&]() {
+              create_statuses[i] = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Kernel creation failed for node '",
+                                                   node.Name(), "' (", node.OpType(), "): ", ex.what());
+            });
+          }
+        });
+
+    for (const auto& status : create_statuses) {
+      ORT_RETURN_IF_ERROR(status);
     }
   }
   node_index_info_ = onnxruntime::make_unique<NodeIndexInfo>(*graph_viewer_, ort_value_name_idx_map_);
   return Status::OK();
 }
 
+std::vector<SessionState::NodeTimingStat> SessionState::GetNodeTimingStats() const {
+  std::vector<NodeTimingStat> stats;
+  if (node_timing_cumulative_ns_ == nullptr || graph_viewer_ == nullptr) {
+    return stats;
+  }
+
+  for (const auto& node : graph_viewer_->Nodes()) {
+    const OpKernel* kernel = GetKernel(node.Index());
+    if (kernel == nullptr) {
+      continue;
+    }
+
+    NodeTimingStat stat;
+    stat.node_name = node.Name().empty() ? MakeString(node.OpType(), "_", node.Index()) : node.Name();
+    stat.op_type = node.OpType();
+    stat.provider = kernel->KernelDef().Provider();
+    stat.sampled_runs = node_timing_sampled_runs_[node.Index()].load(std::memory_order_relaxed);
+    stat.cumulative_ns = node_timing_cumulative_ns_[node.Index()].load(std::memory_order_relaxed);
+    stats.push_back(std::move(stat));
+  }
+
+  return stats;
+}
+
+void SessionState::BakeExecutionPlan() {
+  baked_exec_plan_.clear();
+  plan_has_fences_ = false;
+
+  if (!p_seq_exec_plan_) {
+    return;
+  }
+
+  const auto& exec_plan_vec = p_seq_exec_plan_->execution_plan;
+  baked_exec_plan_.reserve(exec_plan_vec.size());
+
+  for (const auto& node_exec_plan : exec_plan_vec) {
+    const NodeIndex node_index = node_exec_plan.node_index;
+    BakedNodeEntry entry;
+    entry.kernel = GetKernel(node_index);
+    entry.node = graph_viewer_->GetNode(node_index);
+    entry.has_fence = p_seq_exec_plan_->NodeHasFence(node_index);
+    plan_has_fences_ = plan_has_fences_ || entry.has_fence;
+    baked_exec_plan_.push_back(entry);
+  }
+}
+
 const SequentialExecutionPlan* SessionState::GetExecutionPlan() const { return p_seq_exec_plan_.get(); }
 
 Status SessionState::AddInitializedTensor(int ort_value_index, const OrtValue& ort_value, const OrtCallback* d,
@@ -218,6 +310,41 @@ const std::unordered_map<int, OrtValue>& SessionState::GetConstantInitializedTen
   return constant_initialized_tensors_;
 }
 
+#if !defined(ORT_MINIMAL_BUILD)
+OrtValue* SessionState::GetMutableInitializedTensor(int ort_value_index) {
+  auto entry = initialized_tensors_.find(ort_value_index);
+  return entry != initialized_tensors_.end() ? &entry->second : nullptr;
+}
+
+bool SessionState::IsConstantInitializedTensor(int ort_value_index) const {
+  return constant_initialized_tensors_.count(ort_value_index) != 0;
+}
+
+Status SessionState::RepackConstantInitializer(const std::string& initializer_name, const Tensor& tensor) {
+  for (auto& node : GetGraphViewer().Nodes()) {
+    auto* kernel = GetMutableKernel(node.Index());
+    int input_idx = 0;
+    for (auto& input_def : node.InputDefs()) {
+      if (input_def->Exists() && input_def->Name() == initializer_name) {
+        ORT_RETURN_IF_NOT(kernel != nullptr, "No kernel registered for node ", node.Name());
+        bool is_packed = false;
+        ORT_RETURN_IF_ERROR(kernel->PrePack(tensor, input_idx, is_packed));
+      }
+      input_idx++;
+    }
+  }
+
+  // subgraph kernels may consume the value from outer scope
+  for (const auto& node_to_subgraph_ss : subgraph_session_states_) {
+    for (const auto& attr_subgraph_pair : node_to_subgraph_ss.second) {
+      ORT_RETURN_IF_ERROR(attr_subgraph_pair.second->RepackConstantInitializer(initializer_name, tensor));
+    }
+  }
+
+  return Status::OK();
+}
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
 #ifdef ENABLE_TRAINING
 Status SessionState::GetInitializedTensors(
     const std::unordered_set<std::string>& interested_weights,
@@ -299,10 +426,17 @@ Status SessionState::PrepackConstantInitializedTensors(std::unordered_map<std::s
   return Status::OK();
 }
 
-static int64_t CalculateMemoryPatternsKey(const std::vector<std::reference_wrapper<const TensorShape>>& shapes) {
+static int64_t CalculateMemoryPatternsKey(const std::vector<std::reference_wrapper<const TensorShape>>& shapes,
+                                          int64_t bucket_size) {
   int64_t key = 0;
   for (auto shape : shapes) {
-    for (auto dim : shape.get().GetDims()) key ^= dim;
+    for (auto dim : shape.get().GetDims()) {
+      // round dims up to the bucket multiple so recurring shape buckets map to the same pattern
+      if (bucket_size > 1 && dim > 0) {
+        dim = ((dim + bucket_size - 1) / bucket_size) * bucket_size;
+      }
+      key ^= dim;
+    }
   }
   return key;
 }
@@ -529,7 +663,7 @@ Status SessionState::GeneratePatternGroupCache(const std::vector<std::reference_
 const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
                                                               const std::vector<int>& feed_mlvalue_idxs,
                                                               std::unordered_map<int, TensorShape>& inferred_shapes) const {
-  int64_t key = CalculateMemoryPatternsKey(input_shapes);
+  int64_t key = CalculateMemoryPatternsKey(input_shapes, mem_pattern_bucket_size_);
 
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
   auto it = mem_patterns_.find(key);
@@ -537,7 +671,7 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<
 #ifdef ENABLE_TRAINING
     auto mem_patterns = onnxruntime::make_unique<MemoryPatternGroup>();
     if (GeneratePatternGroupCache(input_shapes, feed_mlvalue_idxs, mem_patterns.get(), inferred_shapes).IsOK()) {
-      key = CalculateMemoryPatternsKey(input_shapes);
+      key = CalculateMemoryPatternsKey(input_shapes, mem_pattern_bucket_size_);
       auto ptr = mem_patterns.get();
       mem_patterns_[key] = std::move(mem_patterns);
       shape_patterns_[key] = inferred_shapes;
@@ -550,7 +684,11 @@ const MemoryPatternGroup* SessionState::GetMemoryPatternGroup(const std::vector<
 #endif
   }
 
-  inferred_shapes = shape_patterns_[key];
+  // with bucketing the cached pattern may have been traced from different concrete shapes, so the
+  // stored inferred shapes are not valid for this run.
+  if (mem_pattern_bucket_size_ <= 1) {
+    inferred_shapes = shape_patterns_[key];
+  }
   return it->second.get();
 }
 
@@ -567,17 +705,91 @@ void SessionState::ResolveMemoryPatternFlag() {
 
 Status SessionState::UpdateMemoryPatternGroupCache(const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes,
                                                    std::unique_ptr<MemoryPatternGroup> mem_patterns) const {
-  int64_t key = CalculateMemoryPatternsKey(input_shapes);
+  int64_t key = CalculateMemoryPatternsKey(input_shapes, mem_pattern_bucket_size_);
 
   std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
   auto it = mem_patterns_.find(key);
   if (it == mem_patterns_.end()) {
     mem_patterns_[key] = std::move(mem_patterns);
+  } else if (mem_pattern_bucket_size_ > 1) {
+    // within a shape bucket, keep the pattern traced from the largest shapes seen so far so
+    // smaller shapes in the bucket can be served from its (oversized) blocks.
+    size_t existing_peak = 0;
+    size_t new_peak = 0;
+    for (const auto& pattern : it->second->patterns) existing_peak += pattern.PeakSize();
+    for (const auto& pattern : mem_patterns->patterns) new_peak += pattern.PeakSize();
+    if (new_peak > existing_peak) {
+      it->second = std::move(mem_patterns);
+      shape_patterns_.erase(key);
+    }
   }
 
   return Status::OK();
 }
 
+bool SessionState::ShouldGenerateMemoryPattern(
+    const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes) const {
+  if (mem_pattern_min_stable_runs_ <= 1)
+    return true;
+
+  int64_t key = CalculateMemoryPatternsKey(input_shapes, mem_pattern_bucket_size_);
+
+  std::lock_guard<OrtMutex> lock(mem_patterns_lock_);
+  return ++mem_pattern_run_counts_[key] >= mem_pattern_min_stable_runs_;
+}
+
+std::vector<OrtValue> SessionState::AcquireFrameValueStorage() const {
+  std::lock_guard<OrtMutex> lock(frame_value_storage_lock_);
+  if (frame_value_storage_pool_.empty()) {
+    return {};
+  }
+
+  std::vector<OrtValue> values = std::move(frame_value_storage_pool_.back());
+  frame_value_storage_pool_.pop_back();
+  return values;
+}
+
+void SessionState::RecycleFrameValueStorage(std::vector<OrtValue>&& values) const {
+  // destroy any remaining values outside the lock. the capacity is what we want to keep.
+  values.clear();
+
+  // bound the pool by the number of concurrent Runs we realistically serve; beyond that just
+  // let the allocation go.
+  constexpr size_t kMaxPooledFrameValueStorage = 8;
+  std::lock_guard<OrtMutex> lock(frame_value_storage_lock_);
+  if (frame_value_storage_pool_.size() < kMaxPooledFrameValueStorage) {
+    frame_value_storage_pool_.push_back(std::move(values));
+  }
+}
+
+BufferUniquePtr SessionState::AcquirePatternBuffer(const OrtMemoryInfo& location, size_t size) const {
+  std::lock_guard<OrtMutex> lock(pattern_buffer_pool_lock_);
+  for (auto it = pattern_buffer_pool_.begin(); it != pattern_buffer_pool_.end(); ++it) {
+    if (it->size == size && it->location == location) {
+      BufferUniquePtr buffer = std::move(it->buffer);
+      pattern_buffer_pool_.erase(it);
+      return buffer;
+    }
+  }
+
+  return nullptr;
+}
+
+void SessionState::RecyclePatternBuffer(const OrtMemoryInfo& location, size_t size,
+                                        BufferUniquePtr buffer) const {
+  if (buffer == nullptr || size == 0) {
+    return;
+  }
+
+  // bound the pool by the number of concurrent executions we realistically serve; beyond that
+  // just let the chunk be freed.
+  constexpr size_t kMaxPooledPatternBuffers = 4;
+  std::lock_guard<OrtMutex> lock(pattern_buffer_pool_lock_);
+  if (pattern_buffer_pool_.size() < kMaxPooledPatternBuffers) {
+    pattern_buffer_pool_.push_back({location, size, std::move(buffer)});
+  }
+}
+
 bool SessionState::GetEnableMemoryPattern() const { return enable_mem_pattern_; }
 
 common::Status SessionState::AddInputNameToNodeInfoMapping(const std::string& input_name, const NodeInfo& node_info) {
@@ -808,7 +1020,11 @@ Status SessionState::CreateSubgraphSessionState() {
       auto subgraph_session_state =
           onnxruntime::make_unique<SessionState>(*subgraph, execution_providers_, enable_mem_pattern_,
                                                  thread_pool_, inter_op_thread_pool_, data_transfer_mgr_,
-                                                 logger_, profiler_);
+                                                 logger_, profiler_, use_deterministic_compute_,
+                                                 use_scratch_arena_, mem_pattern_bucket_size_,
+                                                 mem_pattern_min_stable_runs_,
+                                                 node_timing_sample_interval_,
+                                                 use_high_priority_scheduling_);
 
       // Pass fused function manager to subgraph
       subgraph_session_state->fused_funcs_mgr_.SetFusedFuncs(fused_funcs_mgr_);
@@ -935,7 +1151,8 @@ Status SessionState::FinalizeSessionState(const std::basic_string<PATH_CHAR_TYPE
                                           const SessionOptions& session_options,
                                           const onnxruntime::experimental::fbs::SessionState* serialized_session_state,
                                           bool remove_initializers,
-                                          bool saving_ort_format) {
+                                          bool saving_ort_format,
+                                          SharedModelWeights* shared_weights) {
   // recursively create the subgraph session state instances and populate the kernel create info in them.
   // it's simpler to handle the kernel create info recursively when deserializing,
   // so also do it recursively when calling PopulateKernelCreateInfo for consistency.
@@ -966,7 +1183,7 @@ Status SessionState::FinalizeSessionState(const std::basic_string<PATH_CHAR_TYPE
   std::unordered_map<std::string, size_t> constant_initializers_use_count;
   ComputeConstantInitializerUseCount(graph_, constant_initializers_use_count);
   return FinalizeSessionStateImpl(graph_location, kernel_registry_manager, nullptr, session_options,
-                                  remove_initializers, constant_initializers_use_count);
+                                  remove_initializers, constant_initializers_use_count, shared_weights);
 }
 
 Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_TYPE>& graph_location,
@@ -974,7 +1191,8 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
                                               _In_opt_ const Node* parent_node,
                                               const SessionOptions& session_options,
                                               bool remove_initializers,
-                                              std::unordered_map<std::string, size_t>& constant_initializers_use_count) {
+                                              std::unordered_map<std::string, size_t>& constant_initializers_use_count,
+                                              SharedModelWeights* shared_weights) {
   CreateGraphInfo();
 
   // ignore any outer scope args we don't know about. this can happen if a node contains multiple subgraphs.
@@ -993,15 +1211,27 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   }
 
   SequentialPlannerContext context(session_options.execution_mode, session_options.execution_order);
-  ORT_RETURN_IF_ERROR(SequentialPlanner::CreatePlan(parent_node, *graph_viewer_, valid_outer_scope_node_args,
-                                                    execution_providers_, kernel_create_info_map_,
-                                                    ort_value_name_idx_map_, context, p_seq_exec_plan_));
+  {
+    startup_profile::ScopedPhase plan_phase(startup_profile::Phase::Plan);
+    ORT_RETURN_IF_ERROR(SequentialPlanner::CreatePlan(parent_node, *graph_viewer_, valid_outer_scope_node_args,
+                                                      execution_providers_, kernel_create_info_map_,
+                                                      ort_value_name_idx_map_, context, p_seq_exec_plan_));
+  }
   //Record the allocation plan
 
   // Uncomment the below to dump the allocation plan to std::cout
   // LOGS(logger_, VERBOSE) << std::make_pair(p_seq_exec_plan_.get(), this);
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::GenerateTensorMap(GetExecutionPlan(), GetOrtValueNameIdxMap());
+  {
+    std::vector<std::string> node_names_in_execution_order;
+    node_names_in_execution_order.reserve(p_seq_exec_plan_->execution_plan.size());
+    for (const auto& node_plan : p_seq_exec_plan_->execution_plan) {
+      const auto* node = graph_viewer_->GetNode(node_plan.node_index);
+      node_names_in_execution_order.push_back(node->Name().empty() ? node->OpType() : node->Name());
+    }
+    MemoryInfo::RecordNodeExecutionOrder(std::move(node_names_in_execution_order));
+  }
 #endif
 
   std::unique_ptr<ITensorAllocator> tensor_allocator(
@@ -1010,15 +1240,19 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
   const auto& initializer_allocation_order = p_seq_exec_plan_->initializer_allocation_order;
 
   // move initializers from TensorProto instances in Graph to OrtValue instances in SessionState
-  ORT_RETURN_IF_ERROR(
-      session_state_utils::SaveInitializedTensors(
-          Env::Default(), graph_location, *graph_viewer_,
-          execution_providers_.GetDefaultCpuMemoryInfo(),
-          ort_value_name_idx_map_, initializer_allocation_order, *tensor_allocator,
-          [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant) -> Status {
-            return AddInitializedTensor(idx, value, &d, constant);
-          },
-          logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options));
+  {
+    startup_profile::ScopedPhase initializers_phase(startup_profile::Phase::Initializers);
+    ORT_RETURN_IF_ERROR(
+        session_state_utils::SaveInitializedTensors(
+            Env::Default(), graph_location, *graph_viewer_,
+            execution_providers_.GetDefaultCpuMemoryInfo(),
+            ort_value_name_idx_map_, initializer_allocation_order, *tensor_allocator,
+            [this](int idx, const OrtValue& value, const OrtCallback& d, bool constant) -> Status {
+              return AddInitializedTensor(idx, value, &d, constant);
+            },
+            logger_, data_transfer_mgr_, *p_seq_exec_plan_.get(), session_options, thread_pool_,
+            shared_weights));
+  }
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   //Record Weight allocation info on device
   MemoryInfo::RecordInitializerAllocInfo(GetInitializedTensors());
@@ -1033,10 +1267,13 @@ Status SessionState::FinalizeSessionStateImpl(const std::basic_string<PATH_CHAR_
 
   ORT_RETURN_IF_ERROR(CreateKernels(kernel_registry_manager));
 
+  BakeExecutionPlan();
+
   const auto disable_prepacking =
       session_options.GetConfigOrDefault(kOrtSessionOptionsConfigDisablePrepacking, "0");
 
   if (disable_prepacking != "1") {
+    startup_profile::ScopedPhase prepack_phase(startup_profile::Phase::Prepack);
     ORT_RETURN_IF_ERROR(PrepackConstantInitializedTensors(constant_initializers_use_count));
   }
 
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <map>
 #include <unordered_map>
@@ -53,6 +54,7 @@ class ExecutionProviders;
 class KernelDef;
 class OpKernel;
 class NodeIndexInfo;
+class SharedModelWeights;
 struct SequentialExecutionPlan;
 struct MemoryPatternGroup;
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
@@ -86,7 +88,12 @@ class SessionState {
                const DataTransferManager& data_transfer_mgr,
                const logging::Logger& logger,
                profiling::Profiler& profiler,
-               bool use_deterministic_compute = false)
+               bool use_deterministic_compute = false,
+               bool use_scratch_arena = false,
+               int64_t mem_pattern_bucket_size = 0,
+               int64_t mem_pattern_min_stable_runs = 1,
+               int64_t node_timing_sample_interval = 0,
+               bool use_high_priority_scheduling = false)
       : graph_(graph),
         execution_providers_(execution_providers),
         logger_(logger),
@@ -95,7 +102,12 @@ class SessionState {
         thread_pool_(thread_pool),
         inter_op_thread_pool_(inter_op_thread_pool),
         data_transfer_mgr_(data_transfer_mgr),
-        use_deterministic_compute_(use_deterministic_compute) {
+        use_deterministic_compute_(use_deterministic_compute),
+        use_scratch_arena_(use_scratch_arena),
+        mem_pattern_bucket_size_(mem_pattern_bucket_size),
+        mem_pattern_min_stable_runs_(mem_pattern_min_stable_runs),
+        node_timing_sample_interval_(node_timing_sample_interval),
+        use_high_priority_scheduling_(use_high_priority_scheduling) {
     SetupAllocators();
   }
 
@@ -111,6 +123,26 @@ class SessionState {
   // Graph viewer. CreateGraphInfo must have been called previously.
   const GraphViewer& GetGraphViewer() const noexcept { return *graph_viewer_.get(); };
 
+  // Per-node input-edge counts indexed by node index, precomputed so the parallel executor can
+  // seed its dependency counters without walking the graph on every Run.
+  // CreateGraphInfo must have been called previously.
+  const std::vector<int>& GetNodeInputEdgeCounts() const noexcept { return node_input_edge_counts_; }
+
+  // One record per execution step of the sequential plan, with the per-step lookups (kernel,
+  // node, fence flag) resolved once at plan time so the sequential executor can drive execution
+  // from a flat array. Empty until FinalizeSessionState has run.
+  struct BakedNodeEntry {
+    const OpKernel* kernel;
+    const Node* node;
+    bool has_fence;
+  };
+
+  const std::vector<BakedNodeEntry>& GetBakedExecutionPlan() const noexcept { return baked_exec_plan_; }
+
+  // True if any node in the plan requires fence synchronization. When false the executors can
+  // skip the per-node fence handling entirely.
+  bool PlanHasFences() const noexcept { return plan_has_fences_; }
+
   // kernels
   // Get kernel for specified node.
   // It should called right before graph execution only.
@@ -156,6 +188,25 @@ class SessionState {
      */
   const std::unordered_map<int, OrtValue>& GetConstantInitializedTensors() const;
 
+#if !defined(ORT_MINIMAL_BUILD)
+  /**
+     * Gets the initialized tensor stored for ort_value_index, or nullptr if none is present
+     * (e.g. the tensor was released after its kernels prepacked it). Used by weight refresh.
+     */
+  OrtValue* GetMutableInitializedTensor(int ort_value_index);
+
+  /** True when ort_value_index refers to a constant initialized tensor. */
+  bool IsConstantInitializedTensor(int ort_value_index) const;
+
+  /**
+     * Re-runs OpKernel::PrePack with 'tensor' for every kernel input named 'initializer_name'
+     * in this graph and, via outer-scope usage, in its subgraphs, replacing packed buffers that
+     * captured the previous weights. Used by weight refresh after an initializer's contents
+     * have been updated.
+     */
+  Status RepackConstantInitializer(const std::string& initializer_name, const Tensor& tensor);
+#endif
+
 #ifdef ENABLE_TRAINING
   /**
     Get some initialized tensors (weights).
@@ -205,8 +256,81 @@ class SessionState {
   Status UpdateMemoryPatternGroupCache(const std::vector<std::reference_wrapper<const TensorShape>>& input_shape,
                                        std::unique_ptr<MemoryPatternGroup> mem_patterns) const;
 
+  /**
+  Record a run with the given input shapes and return true once the shape key (after any
+  bucketing) has recurred often enough that a memory pattern should be traced and cached for it.
+  Const as it's an internal cache update only.
+  */
+  bool ShouldGenerateMemoryPattern(
+      const std::vector<std::reference_wrapper<const TensorShape>>& input_shapes) const;
+
+  /**
+  Take a recycled OrtValue vector for a new ExecutionFrame, retaining the heap allocation a
+  previous Run built up. Returns an empty vector if none is available.
+  Const as it's an internal cache update only.
+  */
+  std::vector<OrtValue> AcquireFrameValueStorage() const;
+
+  /**
+  Return an ExecutionFrame's OrtValue vector so a later Run can reuse its allocation.
+  Const as it's an internal cache update only.
+  */
+  void RecycleFrameValueStorage(std::vector<OrtValue>&& values) const;
+
+  /**
+  Take a recycled memory-pattern chunk for the given location if one of exactly this size is
+  pooled, so repeated executions with a cached pattern (e.g. Loop body iterations) skip the
+  allocator for their activation chunk. Returns nullptr when nothing matches.
+  Const as it's an internal cache update only.
+  */
+  BufferUniquePtr AcquirePatternBuffer(const OrtMemoryInfo& location, size_t size) const;
+
+  /**
+  Return a memory-pattern chunk for reuse by a later execution.
+  Const as it's an internal cache update only.
+  */
+  void RecyclePatternBuffer(const OrtMemoryInfo& location, size_t size, BufferUniquePtr buffer) const;
+
   bool GetUseDeterministicCompute() const { return use_deterministic_compute_; }
 
+  bool GetUseScratchArena() const { return use_scratch_arena_; }
+
+  // True when this session's parallel loops run in the intra-op thread pool's strict
+  // high-priority class; see "session.use_high_priority_scheduling".
+  bool GetUseHighPriorityScheduling() const { return use_high_priority_scheduling_; }
+
+  int64_t GetMemPatternBucketSize() const { return mem_pattern_bucket_size_; }
+
+  // Sampled node timing. When "session.node_timing_sample_interval" is N >= 1, one in every N
+  // Run calls accumulates per-node wall clock time into relaxed atomic counters, cheap enough to
+  // stay enabled in release builds and queryable at any point without the full profiler.
+  bool NodeTimingSamplingEnabled() const noexcept { return node_timing_sample_interval_ > 0; }
+
+  // Decides whether the Run call that is starting should be timed. Counts runs with a relaxed
+  // atomic, so concurrent Run calls jointly sample approximately one in every N.
+  bool ShouldSampleNodeTiming() const noexcept {
+    return node_timing_run_counter_.fetch_add(1, std::memory_order_relaxed) % node_timing_sample_interval_ == 0;
+  }
+
+  void AccumulateNodeTime(size_t node_index, uint64_t elapsed_ns) const noexcept {
+    if (node_timing_cumulative_ns_ != nullptr && node_index < session_kernels_.size()) {
+      node_timing_cumulative_ns_[node_index].fetch_add(elapsed_ns, std::memory_order_relaxed);
+      node_timing_sampled_runs_[node_index].fetch_add(1, std::memory_order_relaxed);
+    }
+  }
+
+  // One entry per node with a kernel, in graph viewer order. Empty unless sampling is enabled
+  // and CreateKernels has run.
+  struct NodeTimingStat {
+    std::string node_name;
+    std::string op_type;
+    std::string provider;
+    uint64_t sampled_runs;
+    uint64_t cumulative_ns;
+  };
+
+  std::vector<NodeTimingStat> GetNodeTimingStats() const;
+
   /**
   Get enable memory pattern flag
   */
@@ -288,7 +412,8 @@ class SessionState {
                               const SessionOptions& session_options = {},
                               const onnxruntime::experimental::fbs::SessionState* serialized_session_state = nullptr,
                               bool remove_initializers = true,
-                              bool saving_ort_format = false);
+                              bool saving_ort_format = false,
+                              SharedModelWeights* shared_weights = nullptr);
 
   SessionState* Parent() {
     return parent_;
@@ -305,6 +430,10 @@ class SessionState {
   // create kernels using info in kernel_create_info_map_
   Status CreateKernels(const KernelRegistryManager& custom_registry_manager);
 
+  // Resolve the per-step kernel/node/fence lookups of the sequential plan into baked_exec_plan_.
+  // CreateKernels must have been called previously.
+  void BakeExecutionPlan();
+
   // remove TensorProto versions of initializers from Graph instance
   // (replaced byOrtValue instances in initialized_tensors_)
   void CleanInitializedTensorsFromGraph();
@@ -331,7 +460,8 @@ class SessionState {
                                   _In_opt_ const Node* parent_node,
                                   const SessionOptions& session_options,
                                   bool remove_initializers,
-                                  std::unordered_map<std::string, size_t>& constant_initializers_use_count);
+                                  std::unordered_map<std::string, size_t>& constant_initializers_use_count,
+                                  SharedModelWeights* shared_weights = nullptr);
 
 #ifdef ENABLE_TRAINING
   Status GeneratePatternGroupCache(
@@ -396,6 +526,13 @@ class SessionState {
 
   OrtValueNameIdxMap ort_value_name_idx_map_;
 
+  // input-edge count per node index; see GetNodeInputEdgeCounts
+  std::vector<int> node_input_edge_counts_;
+
+  // see GetBakedExecutionPlan; built by BakeExecutionPlan during finalization
+  std::vector<BakedNodeEntry> baked_exec_plan_;
+  bool plan_has_fences_ = false;
+
   // initialized tensors
   std::unordered_map<int, OrtValue> initialized_tensors_;  // key is ort_value_index
   // subset of initialized_tensors_ that are constant and cannot be overridden at runtime
@@ -420,6 +557,30 @@ class SessionState {
   mutable std::map<int64_t, std::unique_ptr<MemoryPatternGroup>> mem_patterns_;
   mutable std::map<int64_t, std::unordered_map<int, TensorShape>> shape_patterns_;
 
+  // number of runs seen per shape key, used to defer pattern tracing until a shape proves stable.
+  // also guarded by mem_patterns_lock_.
+  mutable std::map<int64_t, int64_t> mem_pattern_run_counts_;
+
+  // lock for frame_value_storage_pool_
+  mutable OrtMutex frame_value_storage_lock_;
+
+  // recycled per-Run OrtValue vectors (cleared, capacity retained) so steady-state Runs don't
+  // reallocate the ExecutionFrame's value table on every request.
+  mutable std::vector<std::vector<OrtValue>> frame_value_storage_pool_;
+
+  struct PatternBufferPoolEntry {
+    OrtMemoryInfo location;
+    size_t size;
+    BufferUniquePtr buffer;
+  };
+
+  // lock for pattern_buffer_pool_
+  mutable OrtMutex pattern_buffer_pool_lock_;
+
+  // recycled memory-pattern chunks so back-to-back executions with a cached pattern reuse the
+  // same allocation instead of a free/alloc round trip per execution.
+  mutable std::vector<PatternBufferPoolEntry> pattern_buffer_pool_;
+
   NameNodeInfoMapType input_names_to_nodeinfo_mapping_;
   NameNodeInfoMapType output_names_to_nodeinfo_mapping_;
 
@@ -439,6 +600,27 @@ class SessionState {
 
   bool use_deterministic_compute_;
 
+  // serve plan-proven run-local allocations from a per-Run bump-pointer arena
+  bool use_scratch_arena_;
+
+  // when > 1, round input dims up to this multiple for memory pattern cache keys so recurring
+  // shape buckets share one pattern. 0 keys the cache on exact shapes.
+  int64_t mem_pattern_bucket_size_;
+
+  // number of runs a shape key must be seen before a memory pattern is traced and cached for it.
+  // 1 traces on the first run with each shape.
+  int64_t mem_pattern_min_stable_runs_;
+
+  // sampled node timing (see "session.node_timing_sample_interval"). The counter arrays are
+  // indexed by node index and allocated in CreateKernels when sampling is enabled.
+  int64_t node_timing_sample_interval_;
+  mutable std::atomic<uint64_t> node_timing_run_counter_{0};
+  std::unique_ptr<std::atomic<uint64_t>[]> node_timing_cumulative_ns_;
+  std::unique_ptr<std::atomic<uint64_t>[]> node_timing_sampled_runs_;
+
+  // run this session's parallel loops in the intra-op thread pool's strict high-priority class
+  bool use_high_priority_scheduling_ = false;
+
   std::unique_ptr<NodeIndexInfo> node_index_info_;
   std::multimap<int, std::unique_ptr<FeedsFetchesManager>> cached_feeds_fetches_managers_;
 
@@ -13,6 +13,7 @@
 
 #include "core/graph/graph_viewer.h"
 #include "core/framework/data_transfer_manager.h"
+#include "core/framework/endian.h"
 #include "core/framework/graph_partitioner.h"
 #include "core/framework/ml_value.h"
 #include "core/framework/ort_value_pattern_planner.h"
@@ -22,7 +23,11 @@
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/utils.h"
 #include "core/framework/mem_buffer.h"
+#include "core/framework/shared_weight_cache.h"
+#include "core/framework/startup_memory_profiler.h"
 #include "core/framework/tensor_allocator.h"
+#include "core/platform/threadpool.h"
+#include "core/session/onnxruntime_session_options_config_keys.h"
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
 #include "core/framework/memory_info.h"
 #endif
@@ -99,7 +104,9 @@ common::Status SaveInitializedTensors(
     const std::function<Status(int idx, const OrtValue& value, const OrtCallback& d, bool constant)>& save_tensor_func,
     const logging::Logger& logger, const DataTransferManager& data_transfer_mgr,
     const ExecutionPlanBase& exec_plan,
-    const SessionOptions& session_options) {
+    const SessionOptions& session_options,
+    concurrency::ThreadPool* thread_pool,
+    SharedModelWeights* shared_weights) {
   LOGS(logger, INFO) << "Saving initialized tensors.";
   ORT_ENFORCE(ort_value_name_idx_map.MaxIdx() > -1, "OrtValue indexes should have been populated.");
 
@@ -132,6 +139,74 @@ common::Status SaveInitializedTensors(
     return retval;
   };
 
+  // External data initializers that are planned on CPU can be backed directly by a memory mapping
+  // of the external file (see GetFileContent in tensorprotoutils.cc), so no buffer needs to be
+  // reserved for them here. Opt-in via session config: the mapping pins the file for the lifetime
+  // of the session, and the raw file bytes must already be in native (little-endian) layout.
+  const bool use_mmap_external_data =
+      endian::native == endian::little &&
+      session_options.GetConfigOrDefault(kOrtSessionOptionsUseMmapExternalData, "0") == "1";
+  auto use_mmapped_initializer =
+      [use_mmap_external_data, &exec_plan](int ort_value_index, const ONNX_NAMESPACE::TensorProto& tensor_proto) {
+        if (!use_mmap_external_data || !utils::HasExternalData(tensor_proto)) {
+          return false;
+        }
+        const auto& location = exec_plan.GetLocation(ort_value_index);
+        return strcmp(location.name, CPU) == 0 || location.mem_type == OrtMemTypeCPUOutput;
+      };
+
+  // Initializers loaded from an ORT format model may reference their payload inside the model's
+  // flatbuffer directly (see kOrtSessionOptionsUseOrtModelBytesForInitializers). Those planned on
+  // CPU use the flatbuffer bytes in place, so no buffer needs to be reserved for them either.
+  auto use_in_memory_initializer =
+      [&exec_plan](int ort_value_index, const ONNX_NAMESPACE::TensorProto& tensor_proto) {
+        if (!utils::HasExternalDataInMemory(tensor_proto)) {
+          return false;
+        }
+        const auto& location = exec_plan.GetLocation(ort_value_index);
+        return strcmp(location.name, CPU) == 0 || location.mem_type == OrtMemTypeCPUOutput;
+      };
+
+  // When requested, initializers are allocated individually with tensor ownership instead of
+  // being packed into the planner's block allocation. Individually owned tensors can actually be
+  // freed when they are dropped later (e.g. once PrePack replaces a weight with its packed copy).
+  // External data initializers are excluded since their backing may be a file mapping, and string
+  // tensors since their buffers need the planner's placement-new handling.
+  const bool use_device_allocator_for_initializers =
+      session_options.GetConfigOrDefault(kOrtSessionOptionsUseDeviceAllocatorForInitializers, "0") == "1";
+  auto use_owned_allocation =
+      [use_device_allocator_for_initializers](const ONNX_NAMESPACE::TensorProto& tensor_proto) {
+        return use_device_allocator_for_initializers &&
+               !utils::HasExternalData(tensor_proto) &&
+               tensor_proto.data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING;
+      };
+
+  // Cross-session weight sharing: a constant initializer already present in the shared store for
+  // the planned device is referenced directly, and one that is not yet present is deserialized
+  // into a buffer the store owns so later sessions can reference it. This covers device-resident
+  // weights too: sessions of the same model planned on the same GPU map one device copy
+  // read-only, and the stored OrtValue pins the allocator so the buffer outlives the session
+  // that created it. External data initializers are left to the mmap path above, and string
+  // tensors are excluded since their buffers are not trivially shareable.
+  auto lookup_shared_weight =
+      [shared_weights, &graph, &exec_plan](int ort_value_index,
+                                           const ONNX_NAMESPACE::TensorProto& tensor_proto) -> const OrtValue* {
+    if (shared_weights == nullptr ||
+        !graph.IsConstantInitializer(tensor_proto.name(), /* check_outer_scope */ false)) {
+      return nullptr;
+    }
+    return shared_weights->Lookup(tensor_proto.name(), exec_plan.GetLocation(ort_value_index).device);
+  };
+  auto publish_shared_weight =
+      [shared_weights, &graph](int /*ort_value_index*/, const ONNX_NAMESPACE::TensorProto& tensor_proto) {
+        if (shared_weights == nullptr ||
+            !graph.IsConstantInitializer(tensor_proto.name(), /* check_outer_scope */ false)) {
+          return false;
+        }
+        return !utils::HasExternalData(tensor_proto) &&
+               tensor_proto.data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING;
+      };
+
   //1. first plan the memory
   const onnxruntime::InitializedTensorSet& initialized_tensor_set = graph.GetAllInitializedTensors();
   std::unordered_map<int, const ONNX_NAMESPACE::TensorProto*> id_to_initialized_tensor;
@@ -150,7 +225,13 @@ common::Status SaveInitializedTensors(
   for (int ort_value_index : initializer_allocation_order) {
     const auto entry = initialized_tensors_to_allocate.find(ort_value_index);
     ORT_ENFORCE(entry != initialized_tensors_to_allocate.end());
-    ORT_RETURN_IF_ERROR(planner.Trace(entry->first, entry->second));
+    if (!use_mmapped_initializer(entry->first, *entry->second) &&
+        !use_in_memory_initializer(entry->first, *entry->second) &&
+        lookup_shared_weight(entry->first, *entry->second) == nullptr &&
+        !publish_shared_weight(entry->first, *entry->second) &&
+        !use_owned_allocation(*entry->second)) {
+      ORT_RETURN_IF_ERROR(planner.Trace(entry->first, entry->second));
+    }
     initialized_tensors_to_allocate.erase(entry);
   }
 
@@ -159,6 +240,13 @@ common::Status SaveInitializedTensors(
     if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
       continue;
     }
+    if (use_mmapped_initializer(entry.first, *entry.second) ||
+        use_in_memory_initializer(entry.first, *entry.second) ||
+        lookup_shared_weight(entry.first, *entry.second) != nullptr ||
+        publish_shared_weight(entry.first, *entry.second) ||
+        use_owned_allocation(*entry.second)) {
+      continue;
+    }
     ORT_RETURN_IF_ERROR(planner.Trace(entry.first, entry.second));
   }
   //2. allocate weight buffer on different locations
@@ -176,42 +264,141 @@ common::Status SaveInitializedTensors(
   for (auto i : planned_initializers_memory_sizes_in_byte) {
     LOGS(logger, INFO) << "[Memory] SessionStateInitializer statically allocates "
                        << i.second << " bytes for " << i.first << std::endl;
+    startup_profile::RecordAllocation("SaveInitializedTensors planned weight buffer", i.second);
   }
 
-  OrtCallback deleter{nullptr, nullptr};
+  //3. create weight tensors based on weights buffer.
+  // Deserializing one initializer is independent of deserializing another, so the proto-to-Tensor
+  // unpack (and device copy, if any) is fanned out over the intra-op thread pool. The preallocated
+  // buffers are fetched from the planner on this thread, and save_tensor_func mutates the session
+  // state so it stays sequential as well.
+  struct PendingInitializer {
+    int ort_value_index;
+    const ONNX_NAMESPACE::TensorProto* tensor_proto;
+    std::unique_ptr<MemBuffer> buffer;
+    OrtValue ort_value;
+    OrtCallback deleter{nullptr, nullptr};
+    // set when the tensor gets its own allocation (with tensor ownership) instead of planner memory
+    bool owned_allocation{false};
+    // set when the deserialized tensor is additionally published to the shared weight store
+    bool publish_shared{false};
+    AllocatorPtr owned_alloc;
+    BufferUniquePtr owned_buffer;
+  };
+  std::vector<PendingInitializer> pending;
+  pending.reserve(id_to_initialized_tensor.size());
+  std::vector<std::pair<int, OrtValue>> shared_entries;  // initializers resolved from the shared weight store
 
-  //3. create weight tensors based on weights buffer
   for (const auto& entry : id_to_initialized_tensor) {
     int ort_value_index = entry.first;
     const char* name = (entry.second->name().empty()) ? "" : entry.second->name().c_str();
-    OrtValue ort_value;
 
-    if (user_supplied_initializer_ids.find(entry.first) != user_supplied_initializer_ids.end()) {
-      ort_value = *(session_options.initializers_to_share_map.at(name));
-      LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
-    } else {
-      const ONNX_NAMESPACE::TensorProto& tensor_proto = *(entry.second);
+    if (user_supplied_initializer_ids.find(ort_value_index) != user_supplied_initializer_ids.end()) {
+      continue;  // saved below, nothing to deserialize
+    }
+
+    if (const OrtValue* cached = lookup_shared_weight(ort_value_index, *entry.second)) {
+      LOGS(logger, INFO) << "Using shared weight store entry for initializer (" << name << ").";
+      shared_entries.emplace_back(ort_value_index, *cached);
+      continue;
+    }
 
-      std::unique_ptr<MemBuffer> m;
+    PendingInitializer p{};
+    p.ort_value_index = ort_value_index;
+    p.tensor_proto = entry.second;
+    p.publish_shared = publish_shared_weight(ort_value_index, *entry.second);
+    p.owned_allocation = p.publish_shared || use_owned_allocation(*entry.second);
+    if (p.owned_allocation) {
+      // allocate outside the planner so the buffer's lifetime is tied to the tensor (or the
+      // shared store), not to this session's weight arena
+      size_t len = 0;
+      ORT_RETURN_IF_ERROR(utils::GetSizeInBytesFromTensorProto<0>(*entry.second, &len));
+      const auto& location = exec_plan.GetLocation(ort_value_index);
+      p.owned_alloc = planner.GetAllocator(location);
+      ORT_ENFORCE(p.owned_alloc != nullptr, "Failed to get allocator for ", location.name);
+      void* data = len > 0 ? p.owned_alloc->Alloc(len) : nullptr;
+      startup_profile::RecordAllocation("SaveInitializedTensors owned weight buffer", len);
+      p.owned_buffer = BufferUniquePtr(data, BufferDeleter(p.owned_alloc));
+      p.buffer = onnxruntime::make_unique<MemBuffer>(data, len, location);
+    } else if (use_mmapped_initializer(ort_value_index, *entry.second) ||
+               use_in_memory_initializer(ort_value_index, *entry.second)) {
+      // no buffer was reserved; TensorProtoToMLValue maps the external file (or uses the
+      // in-memory flatbuffer bytes) and the tensor references that memory directly.
+      p.buffer = onnxruntime::make_unique<MemBuffer>(nullptr, 0, default_cpu_memory_info);
+    } else {
       // TODO: if the tensor need be copied, does it have enough room?
-      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, m));
+      ORT_RETURN_IF_ERROR(planner.GetPreallocatedBuffer(ort_value_index, name, p.buffer));
+    }
 #ifndef NDEBUG
-      ORT_ENFORCE(m != nullptr);
-      ORT_ENFORCE(m->GetBuffer() != nullptr || m->GetLen() == 0);
+    ORT_ENFORCE(p.buffer != nullptr);
+    ORT_ENFORCE(p.buffer->GetBuffer() != nullptr || p.buffer->GetLen() == 0);
 #endif
-      Status st = DeserializeTensorProto(env, graph_loc, tensor_proto, *m, default_cpu_memory_info, ort_value, deleter,
-                                         data_transfer_mgr);
-      if (!st.IsOK()) {
-        std::ostringstream oss;
-        oss << "Deserialize tensor " << name << " failed." << st.ErrorMessage();
-        return Status(st.Category(), st.Code(), oss.str());
-      }
+    pending.push_back(std::move(p));
+  }
+
+  std::vector<Status> deserialize_statuses(pending.size());
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      thread_pool, static_cast<std::ptrdiff_t>(pending.size()),
+      [&](std::ptrdiff_t i) {
+        auto& p = pending[i];
+        deserialize_statuses[i] = DeserializeTensorProto(env, graph_loc, *p.tensor_proto, *p.buffer,
+                                                         default_cpu_memory_info, p.ort_value, p.deleter,
+                                                         data_transfer_mgr);
+      });
+
+  for (size_t i = 0; i != pending.size(); ++i) {
+    const Status& st = deserialize_statuses[i];
+    if (!st.IsOK()) {
+      std::ostringstream oss;
+      oss << "Deserialize tensor " << pending[i].tensor_proto->name() << " failed." << st.ErrorMessage();
+      return Status(st.Category(), st.Code(), oss.str());
     }
+  }
 
+  for (auto& p : pending) {
+    if (!p.owned_allocation) {
+      continue;
+    }
+    // re-wrap the tensor so that it owns its buffer
+    const Tensor& deserialized = p.ort_value.Get<Tensor>();
+    auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+    auto owned_tensor = onnxruntime::make_unique<Tensor>(deserialized.DataType(), deserialized.Shape(),
+                                                         p.owned_buffer.release(), p.owned_alloc);
+    OrtValue owned_value;
+    owned_value.Init(owned_tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+    if (p.publish_shared) {
+      // publish, then adopt whichever copy won the insertion race
+      p.ort_value = shared_weights->Insert(p.tensor_proto->name(), owned_value);
+    } else {
+      p.ort_value = owned_value;
+    }
+  }
+
+  for (auto& p : pending) {
+    const std::string& name = p.tensor_proto->name();
     // any outer scope value is shadowed by a local value and can't override it.
     // due to that check_outer_scope is false
     bool constant = graph.IsConstantInitializer(name, /* check_outer_scope */ false);
-    ORT_RETURN_IF_ERROR(save_tensor_func(ort_value_index, ort_value, deleter, constant));
+    ORT_RETURN_IF_ERROR(save_tensor_func(p.ort_value_index, p.ort_value, p.deleter, constant));
+
+    VLOGS(logger, 1) << "Added weight with name : " << name << " with index: " << p.ort_value_index;
+  }
+
+  for (auto& entry : shared_entries) {
+    // lookup_shared_weight only matches constant initializers
+    ORT_RETURN_IF_ERROR(save_tensor_func(entry.first, entry.second, OrtCallback{nullptr, nullptr},
+                                         /* constant */ true));
+    VLOGS(logger, 1) << "Added shared weight with index: " << entry.first;
+  }
+
+  for (int ort_value_index : user_supplied_initializer_ids) {
+    const auto* tensor_proto = id_to_initialized_tensor.at(ort_value_index);
+    const std::string& name = tensor_proto->name();
+    OrtValue ort_value = *(session_options.initializers_to_share_map.at(name));
+    LOGS(logger, INFO) << "Using user supplied initializer with name (" << name << ").";
+
+    bool constant = graph.IsConstantInitializer(name, /* check_outer_scope */ false);
+    ORT_RETURN_IF_ERROR(save_tensor_func(ort_value_index, ort_value, OrtCallback{nullptr, nullptr}, constant));
 
     VLOGS(logger, 1) << "Added weight with name : " << name << " with index: " << ort_value_index;
   }
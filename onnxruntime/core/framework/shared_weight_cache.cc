@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/shared_weight_cache.h"
+
+#include "core/framework/tensor.h"
+
+namespace onnxruntime {
+
+static const OrtDevice& DeviceOf(const OrtValue& value) {
+  return value.Get<Tensor>().Location().device;
+}
+
+const OrtValue* SharedModelWeights::Lookup(const std::string& initializer_name, const OrtDevice& device) const {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto range = weights_.equal_range(initializer_name);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (DeviceOf(it->second) == device) {
+      return &it->second;
+    }
+  }
+  return nullptr;
+}
+
+const OrtValue& SharedModelWeights::Insert(const std::string& initializer_name, const OrtValue& value) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  // first writer wins per device so concurrent sessions finalizing the same model agree on one copy
+  const OrtDevice& device = DeviceOf(value);
+  auto range = weights_.equal_range(initializer_name);
+  for (auto it = range.first; it != range.second; ++it) {
+    if (DeviceOf(it->second) == device) {
+      return it->second;
+    }
+  }
+  return weights_.emplace(initializer_name, value)->second;
+}
+
+SharedModelWeights& SharedWeightCache::GetOrCreateModelWeights(const std::string& model_key) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto& entry = models_[model_key];
+  if (!entry) {
+    entry = onnxruntime::make_unique<SharedModelWeights>();
+  }
+  return *entry;
+}
+
+}  // namespace onnxruntime
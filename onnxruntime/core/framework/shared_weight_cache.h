@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+
+#include "core/common/common.h"
+#include "core/framework/ml_value.h"
+#include "core/framework/ortdevice.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+/**
+ * The initialized tensors of one model that are shared between the InferenceSession instances
+ * created for that model. The stored OrtValue instances own their buffers (a device tensor also
+ * keeps its allocator alive through the tensor's AllocatorPtr), so they stay valid for as long
+ * as the cache (i.e. the Environment) is alive, independent of the session that first
+ * deserialized them. One entry is kept per (initializer name, device) pair, so sessions planned
+ * on different GPUs each share a copy resident on their own device.
+ */
+class SharedModelWeights {
+ public:
+  SharedModelWeights() = default;
+
+  /**
+   * Returns the cached value for the given initializer name resident on the given device,
+   * or nullptr if not present.
+   */
+  const OrtValue* Lookup(const std::string& initializer_name, const OrtDevice& device) const;
+
+  /**
+   * Stores the value for the given initializer name on the device the value resides on. If
+   * another session inserted the same name for that device first, that value wins and is
+   * returned; the caller should use the returned value and drop its own copy.
+   */
+  const OrtValue& Insert(const std::string& initializer_name, const OrtValue& value);
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SharedModelWeights);
+
+  mutable OrtMutex mutex_;
+  // multimap so the same name can be cached once per device; node based storage keeps the
+  // references handed out by Insert stable across later insertions
+  std::unordered_multimap<std::string, OrtValue> weights_;
+};
+
+/**
+ * Environment level store of initialized tensors, keyed by model. Sessions created for the same
+ * model reference one copy of each constant initializer instead of deserializing their own,
+ * cutting weight memory from N copies to one when many sessions of a model are hosted in a
+ * single process.
+ */
+class SharedWeightCache {
+ public:
+  SharedWeightCache() = default;
+
+  /** Returns the weight store for the given model key, creating an empty one if needed. */
+  SharedModelWeights& GetOrCreateModelWeights(const std::string& model_key);
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SharedWeightCache);
+
+  OrtMutex mutex_;
+  std::unordered_map<std::string, std::unique_ptr<SharedModelWeights>> models_;
+};
+
+}  // namespace onnxruntime
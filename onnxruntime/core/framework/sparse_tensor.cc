@@ -30,4 +30,40 @@ SparseTensor::SparseTensor(MLDataType elt_type,
                allocator),
       shape_(shape) {}
 
+SparseTensor::SparseTensor(MLDataType elt_type,
+                           const TensorShape& shape,
+                           size_t nnz,
+                           void* values_data,
+                           void* inner_indices_data,
+                           void* outer_indices_data,
+                           const OrtMemoryInfo& memory_info)
+    : values_(elt_type, TensorShape({static_cast<int64_t>(nnz)}), values_data, memory_info),
+      indices_(DataTypeImpl::GetType<int64_t>(), TensorShape({static_cast<int64_t>(nnz)}),
+               inner_indices_data, memory_info, 0),
+      outer_indices_(DataTypeImpl::GetType<int64_t>(), TensorShape({shape[0] + 1}),
+                     outer_indices_data, memory_info, 0),
+      shape_(shape),
+      format_(SparseFormat::kCsr) {
+  ORT_ENFORCE(shape.NumDimensions() == 2, "CSR format requires a 2-dimensional shape. Got: ", shape);
+}
+
+SparseTensor::SparseTensor(MLDataType elt_type,
+                           const TensorShape& shape,
+                           size_t nnz,
+                           std::shared_ptr<IAllocator> allocator,
+                           SparseFormat format)
+    : values_(elt_type, TensorShape({static_cast<int64_t>(nnz)}), allocator),
+      indices_(DataTypeImpl::GetType<int64_t>(),
+               format == SparseFormat::kCsr
+                   ? TensorShape({static_cast<int64_t>(nnz)})
+                   : TensorShape({static_cast<int64_t>(nnz), static_cast<int64_t>(shape.NumDimensions())}),
+               allocator),
+      shape_(shape),
+      format_(format) {
+  if (format == SparseFormat::kCsr) {
+    ORT_ENFORCE(shape.NumDimensions() == 2, "CSR format requires a 2-dimensional shape. Got: ", shape);
+    outer_indices_ = Tensor(DataTypeImpl::GetType<int64_t>(), TensorShape({shape[0] + 1}), allocator);
+  }
+}
+
 }  // namespace onnxruntime
@@ -0,0 +1,150 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/startup_memory_profiler.h"
+
+#include <algorithm>
+#include <array>
+#include <sstream>
+#include <unordered_map>
+#include <vector>
+
+#include "core/platform/env_var_utils.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+namespace startup_profile {
+
+namespace {
+
+constexpr size_t kPhaseCount = static_cast<size_t>(Phase::Plan) + 1;
+constexpr size_t kTopSitesPerPhase = 5;
+
+const char* PhaseName(Phase phase) {
+  switch (phase) {
+    case Phase::Load:
+      return "load";
+    case Phase::Resolve:
+      return "resolve";
+    case Phase::Transform:
+      return "transform";
+    case Phase::Initializers:
+      return "initializers";
+    case Phase::Prepack:
+      return "prepack";
+    case Phase::Plan:
+      return "plan";
+    case Phase::None:
+    default:
+      return "untagged";
+  }
+}
+
+struct SiteStats {
+  size_t bytes{0};
+  size_t count{0};
+};
+
+struct PhaseStats {
+  // bytes allocated while the phase was active
+  size_t cumulative_bytes{0};
+  size_t allocation_count{0};
+  // highest tracked live size observed while the phase was active
+  size_t peak_live_bytes{0};
+  std::unordered_map<const char*, SiteStats> sites;
+};
+
+struct Tracker {
+  OrtMutex mutex;
+  // live bytes across all phases; allocations from one phase are commonly freed in another
+  size_t live_bytes{0};
+  std::array<PhaseStats, kPhaseCount> phases;
+};
+
+Tracker& GetTracker() {
+  static Tracker tracker;
+  return tracker;
+}
+
+thread_local Phase t_current_phase = Phase::None;
+
+}  // namespace
+
+bool IsEnabled() {
+  static const bool enabled = ParseEnvironmentVariableWithDefault<bool>("ORT_STARTUP_MEMORY_PROFILE", false);
+  return enabled;
+}
+
+ScopedPhase::ScopedPhase(Phase phase) : previous_(t_current_phase) {
+  t_current_phase = phase;
+}
+
+ScopedPhase::~ScopedPhase() {
+  t_current_phase = previous_;
+}
+
+void RecordAllocation(const char* site, size_t bytes) {
+  if (!IsEnabled() || bytes == 0) {
+    return;
+  }
+  auto& tracker = GetTracker();
+  std::lock_guard<OrtMutex> lock(tracker.mutex);
+  tracker.live_bytes += bytes;
+  auto& phase = tracker.phases[static_cast<size_t>(t_current_phase)];
+  phase.cumulative_bytes += bytes;
+  ++phase.allocation_count;
+  phase.peak_live_bytes = std::max(phase.peak_live_bytes, tracker.live_bytes);
+  auto& site_stats = phase.sites[site];
+  site_stats.bytes += bytes;
+  ++site_stats.count;
+}
+
+void RecordDeallocation(size_t bytes) {
+  if (!IsEnabled() || bytes == 0) {
+    return;
+  }
+  auto& tracker = GetTracker();
+  std::lock_guard<OrtMutex> lock(tracker.mutex);
+  tracker.live_bytes -= std::min(tracker.live_bytes, bytes);
+}
+
+std::string Report() {
+  auto& tracker = GetTracker();
+  std::lock_guard<OrtMutex> lock(tracker.mutex);
+
+  std::ostringstream report;
+  report << "[Memory] Startup allocation profile (instrumented sites only):\n";
+  for (size_t i = 0; i != kPhaseCount; ++i) {
+    const auto& phase = tracker.phases[i];
+    if (phase.allocation_count == 0) {
+      continue;
+    }
+    report << "  phase '" << PhaseName(static_cast<Phase>(i)) << "': peak live " << phase.peak_live_bytes
+           << " bytes, allocated " << phase.cumulative_bytes << " bytes in " << phase.allocation_count
+           << " allocations\n";
+
+    std::vector<std::pair<const char*, SiteStats>> sites(phase.sites.begin(), phase.sites.end());
+    std::sort(sites.begin(), sites.end(),
+              [](const std::pair<const char*, SiteStats>& a, const std::pair<const char*, SiteStats>& b) {
+                return a.second.bytes > b.second.bytes;
+              });
+    const size_t top = std::min(sites.size(), kTopSitesPerPhase);
+    for (size_t s = 0; s != top; ++s) {
+      report << "    " << sites[s].first << ": " << sites[s].second.bytes << " bytes in "
+             << sites[s].second.count << " allocations\n";
+    }
+  }
+  return report.str();
+}
+
+void Reset() {
+  auto& tracker = GetTracker();
+  std::lock_guard<OrtMutex> lock(tracker.mutex);
+  tracker.live_bytes = 0;
+  for (auto& phase : tracker.phases) {
+    phase = PhaseStats{};
+  }
+}
+
+}  // namespace startup_profile
+}  // namespace onnxruntime
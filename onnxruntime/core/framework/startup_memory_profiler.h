@@ -0,0 +1,65 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+
+namespace onnxruntime {
+namespace startup_profile {
+
+// Phase-tagged allocation tracking for session startup.
+//
+// Model load, graph resolve, optimizer temporaries, initializer copies and prepacked buffers
+// briefly coexist during InferenceSession::Initialize, so the startup peak can be far above the
+// steady-state footprint. When enabled (ORT_STARTUP_MEMORY_PROFILE=1), instrumented allocation
+// sites report their allocations here tagged with the phase that is active on the calling thread,
+// and Report() renders peak/cumulative bytes per phase with the top allocation sites so the
+// dominant copies can be targeted.
+//
+// The tracker only sees instrumented sites, not every allocation; it is a cheap attribution tool,
+// not a heap profiler. All functions are no-ops when profiling is disabled.
+
+enum class Phase : int {
+  None = 0,
+  Load,
+  Resolve,
+  Transform,
+  Initializers,
+  Prepack,
+  Plan,
+};
+
+// true when the ORT_STARTUP_MEMORY_PROFILE environment variable is set to a non-zero value.
+// cached on first use.
+bool IsEnabled();
+
+// tags the current thread with a phase for the lifetime of the object, restoring the
+// previous phase on destruction so nested scopes compose
+class ScopedPhase {
+ public:
+  explicit ScopedPhase(Phase phase);
+  ~ScopedPhase();
+
+  ScopedPhase(const ScopedPhase&) = delete;
+  ScopedPhase& operator=(const ScopedPhase&) = delete;
+
+ private:
+  Phase previous_;
+};
+
+// records an allocation attributed to the calling thread's phase and the given site.
+// `site` must be a string literal (it is stored by pointer).
+void RecordAllocation(const char* site, size_t bytes);
+
+// records that previously recorded bytes were released, lowering the tracked live size
+void RecordDeallocation(size_t bytes);
+
+// human-readable peak-by-phase report with the top allocation sites per phase
+std::string Report();
+
+// clears all recorded data, e.g. between sessions in tests
+void Reset();
+
+}  // namespace startup_profile
+}  // namespace onnxruntime
@@ -64,6 +64,37 @@ void Tensor::Init(MLDataType p_type, const TensorShape& shape, void* p_raw_data,
     }
   }
   byte_offset_ = offset;
+  // the size calculation can overflow for invalid shapes that are only diagnosed later by
+  // SizeInBytes(), so treat overflow as zero capacity rather than throwing here.
+  if (!IAllocator::CalcMemSizeForArray(SafeInt<size_t>(shape_size), dtype_->Size(), &capacity_bytes_)) {
+    capacity_bytes_ = 0;
+  }
+}
+
+Status Tensor::SetShapeWithinCapacity(const TensorShape& new_shape) {
+  if (IsDataTypeString()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "SetShapeWithinCapacity is not supported for string tensors.");
+  }
+
+  int64_t new_shape_size = new_shape.Size();
+  if (new_shape_size < 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "new_shape.Size() must be >= 0");
+  }
+
+  size_t new_size_in_bytes;
+  if (!IAllocator::CalcMemSizeForArray(SafeInt<size_t>(new_shape_size), dtype_->Size(), &new_size_in_bytes)) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "tensor size overflow");
+  }
+
+  if (new_size_in_bytes > capacity_bytes_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Requested shape requires ", new_size_in_bytes,
+                           " bytes which exceeds the buffer capacity of ", capacity_bytes_, " bytes.");
+  }
+
+  shape_ = new_shape;
+  return Status::OK();
 }
 
 Tensor::Tensor(Tensor&& other) noexcept
@@ -72,12 +103,14 @@ Tensor::Tensor(Tensor&& other) noexcept
       shape_(other.shape_),
       dtype_(other.dtype_),
       alloc_info_(other.alloc_info_),
-      byte_offset_(other.byte_offset_) {
+      byte_offset_(other.byte_offset_),
+      capacity_bytes_(other.capacity_bytes_) {
   other.dtype_ = DataTypeImpl::GetType<float>()->AsPrimitiveDataType();
   other.shape_ = TensorShape(std::vector<int64_t>(1, 0));
   other.p_data_ = nullptr;
   other.buffer_deleter_ = nullptr;
   other.byte_offset_ = 0;
+  other.capacity_bytes_ = 0;
 }
 
 Tensor& Tensor::operator=(Tensor&& other) noexcept {
@@ -88,6 +121,7 @@ Tensor& Tensor::operator=(Tensor&& other) noexcept {
     shape_ = other.shape_;
     alloc_info_ = other.alloc_info_;
     byte_offset_ = other.byte_offset_;
+    capacity_bytes_ = other.capacity_bytes_;
     p_data_ = other.p_data_;
     buffer_deleter_ = other.buffer_deleter_;
 
@@ -95,6 +129,7 @@ Tensor& Tensor::operator=(Tensor&& other) noexcept {
     other.shape_ = TensorShape(std::vector<int64_t>(1, 0));
     other.p_data_ = nullptr;
     other.byte_offset_ = 0;
+    other.capacity_bytes_ = 0;
     other.buffer_deleter_ = nullptr;
   }
   return *this;
@@ -6,32 +6,83 @@
 #include "core/common/common.h"
 #include "core/common/safeint.h"
 #include "core/framework/tensorprotoutils.h"
+#include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
 
-TensorShape::TensorShape(const int64_t* dimension_sizes, size_t dimension_count)
-    : std::vector<int64_t>(dimension_count) {
-  for (size_t i = 0; i < dimension_count; ++i) {
-    (*this)[i] = dimension_sizes[i];
+// out-of-line definition for pre-C++17 translation units that odr-use the constant
+constexpr size_t TensorShape::kInlineDimCapacity;
+
+namespace {
+// Materialization is a one-time transition per shape, so contention is negligible and a small
+// set of shared mutexes avoids growing every TensorShape by a mutex.
+OrtMutex& MaterializeMutex(const void* shape) {
+  static OrtMutex mutexes[16];
+  return mutexes[(reinterpret_cast<uintptr_t>(shape) >> 4) & 15];
+}
+}  // namespace
+
+void TensorShape::Assign(const int64_t* dims, size_t count) {
+  if (count <= kInlineDimCapacity && !materialized_.load(std::memory_order_relaxed)) {
+    std::copy(dims, dims + count, inline_dims_);
+    inline_size_ = count;
+    return;
   }
+  dims_vec_.assign(dims, dims + count);
+  inline_size_ = 0;
+  materialized_.store(true, std::memory_order_release);
 }
 
-TensorShape::TensorShape(const std::vector<int64_t>& dims, size_t start, size_t end) {
-  assign(dims.begin() + start, dims.begin() + end);
+void TensorShape::Materialize() const {
+  std::lock_guard<OrtMutex> lock(MaterializeMutex(this));
+  if (materialized_.load(std::memory_order_relaxed)) return;
+  dims_vec_.assign(inline_dims_, inline_dims_ + inline_size_);
+  materialized_.store(true, std::memory_order_release);
+}
+
+TensorShape& TensorShape::operator=(const TensorShape& other) {
+  if (this == &other) return *this;
+  Assign(other.Data(), other.NumDimensions());
+  return *this;
+}
+
+TensorShape::TensorShape(TensorShape&& other) noexcept {
+  if (other.materialized_.load(std::memory_order_acquire)) {
+    dims_vec_ = std::move(other.dims_vec_);
+    materialized_.store(true, std::memory_order_relaxed);
+    // leave the source materialized with its (now empty) vector so its invariants hold
+    other.dims_vec_.clear();
+  } else {
+    std::copy(other.inline_dims_, other.inline_dims_ + other.inline_size_, inline_dims_);
+    inline_size_ = other.inline_size_;
+  }
+}
+
+TensorShape& TensorShape::operator=(TensorShape&& other) noexcept {
+  if (this == &other) return *this;
+  if (other.materialized_.load(std::memory_order_acquire)) {
+    dims_vec_ = std::move(other.dims_vec_);
+    inline_size_ = 0;
+    materialized_.store(true, std::memory_order_release);
+    other.dims_vec_.clear();
+  } else {
+    Assign(other.inline_dims_, other.inline_size_);
+  }
+  return *this;
 }
 
 /**
  * Return the total number of elements. Returns 1 for an empty (rank 0) TensorShape.
  */
 int64_t TensorShape::Size() const {
-  size_t arraySize = size();
+  size_t arraySize = NumDimensions();
   int64_t size = SizeHelper(0, arraySize);
   //should we cache the size? as multiple operation may be expensive.
   return size;
 }
 
 int64_t TensorShape::SizeToDimension(size_t dimension) const {
-  const size_t num_dims = size();
+  const size_t num_dims = NumDimensions();
   ORT_ENFORCE(dimension <= num_dims,
               "Invalid dimension of ", dimension, " for SizeFromDimension. Tensor has ",
               num_dims, " dimensions.");
@@ -41,7 +92,7 @@ int64_t TensorShape::SizeToDimension(size_t dimension) const {
 }
 
 int64_t TensorShape::SizeFromDimension(size_t dimension) const {
-  const size_t num_dims = size();
+  const size_t num_dims = NumDimensions();
   ORT_ENFORCE(dimension <= num_dims,
               "Invalid dimension of ", dimension, " for SizeFromDimension. Tensor has ",
               num_dims, " dimensions.");
@@ -51,13 +102,13 @@ int64_t TensorShape::SizeFromDimension(size_t dimension) const {
 }
 
 TensorShape TensorShape::Slice(size_t dimstart, size_t dimend) const {
-  ORT_ENFORCE(dimstart <= dimend && dimend <= size(),
+  ORT_ENFORCE(dimstart <= dimend && dimend <= NumDimensions(),
               "Invalid tensor shape slice argument.");
-  return TensorShape(*this, dimstart, dimend);
+  return TensorShape(Data() + dimstart, dimend - dimstart);
 }
 
 TensorShape TensorShape::Slice(size_t dimstart) const {
-  return Slice(dimstart, size());
+  return Slice(dimstart, NumDimensions());
 }
 
 // output dimensions
@@ -66,12 +117,13 @@ std::string TensorShape::ToString() const {
 
   result.append("{");
   bool first = true;
-  for (auto dim : (*this)) {
+  const int64_t* dims = Data();
+  for (size_t i = 0, num_dims = NumDimensions(); i < num_dims; ++i) {
     if (!first) {
       result.append(",");
     }
 
-    result.append(std::to_string(dim));
+    result.append(std::to_string(dims[i]));
     first = false;
   }
   result.append("}");
@@ -82,9 +134,10 @@ std::string TensorShape::ToString() const {
 int64_t TensorShape::SizeHelper(size_t start, size_t end) const {
   // Must return 1 for an empty sequence
   SafeInt<int64_t> size = 1;  // this is used to calculate the size, which is used for memory allocations, so validate no overflow
+  const int64_t* dims = Data();
   for (size_t i = start; i < end; i++) {
-    if ((*this)[i] < 0) return -1;
-    size *= (*this)[i];
+    if (dims[i] < 0) return -1;
+    size *= dims[i];
   }
   return size;
 }
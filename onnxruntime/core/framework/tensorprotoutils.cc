@@ -5,6 +5,7 @@
 
 #include <memory>
 #include <algorithm>
+#include <cstring>
 #include <limits>
 #include <gsl/gsl>
 
@@ -17,6 +18,7 @@
 #include "core/framework/allocator.h"
 #include "core/framework/callback.h"
 #include "core/framework/data_types.h"
+#include "core/framework/startup_memory_profiler.h"
 #include "core/platform/path_lib.h"
 #include "core/session/ort_apis.h"
 #include "onnx/defs/tensor_proto_util.h"
@@ -144,7 +146,11 @@ static Status GetExternalDataInfo(const ONNX_NAMESPACE::TensorProto& tensor_prot
   std::unique_ptr<onnxruntime::ExternalDataInfo> external_data_info;
   ORT_RETURN_IF_ERROR(onnxruntime::ExternalDataInfo::Create(tensor_proto.external_data(), external_data_info));
 
-  if (tensor_proto_dir != nullptr) {
+  if (external_data_info->GetRelPath() == onnxruntime::utils::kTensorProtoMemoryAddressTag) {
+    // the data is already in memory and the offset is its address, so there is no file path to fix up.
+    // keep the tag so callers can recognize the in-memory case.
+    external_file_path = external_data_info->GetRelPath();
+  } else if (tensor_proto_dir != nullptr) {
     external_file_path = onnxruntime::ConcatPathComponent<ORTCHAR_T>(tensor_proto_dir, external_data_info->GetRelPath());
   } else {
     external_file_path = external_data_info->GetRelPath();
@@ -180,6 +186,15 @@ static Status ReadExternalDataForTensor(const ONNX_NAMESPACE::TensorProto& tenso
       tensor_byte_size));
 
   unpacked_tensor.reset(new unsigned char[*&tensor_byte_size]);
+
+  if (external_file_path == onnxruntime::utils::kTensorProtoMemoryAddressTag) {
+    // the data is already in memory at the address carried by the offset field
+    std::memcpy(unpacked_tensor.get(),
+                reinterpret_cast<const void*>(static_cast<uintptr_t>(file_offset)),
+                tensor_byte_size);
+    return Status::OK();
+  }
+
   ORT_RETURN_IF_ERROR(onnxruntime::Env::Default().ReadFileIntoBuffer(
       external_file_path.c_str(),
       file_offset,
@@ -586,6 +601,7 @@ static Status GetFileContent(
 
   // if that fails, try to copy
   auto buffer = onnxruntime::make_unique<char[]>(length);
+  startup_profile::RecordAllocation("GetFileContent heap copy (mmap unavailable)", length);
   ORT_RETURN_IF_ERROR(env.ReadFileIntoBuffer(
       file_path, offset, length, gsl::make_span(buffer.get(), length)));
 
@@ -625,6 +641,7 @@ Status TensorProtoToMLValue(const Env& env, const ORTCHAR_T* model_path,
   SafeInt<size_t> raw_data_len = 0;
   const DataTypeImpl* const type = DataTypeImpl::TensorTypeFromONNXEnum(tensor_proto.data_type())->GetElementType();
   AutoDelete deleter_for_file_data;
+  bool raw_data_in_memory = false;
   void* tensor_data;
   {
     if (utils::HasExternalData(tensor_proto)) {
@@ -640,10 +657,17 @@ Status TensorProtoToMLValue(const Env& env, const ORTCHAR_T* model_path,
           tensor_proto_dir.size() == 0 ? nullptr : tensor_proto_dir.c_str(),
           external_data_file_path, file_offset, raw_data_len));
 
-      // load the file
-      ORT_RETURN_IF_ERROR(GetFileContent(
-          env, external_data_file_path.c_str(), file_offset, raw_data_len,
-          raw_data, deleter_for_file_data.d));
+      if (external_data_file_path == utils::kTensorProtoMemoryAddressTag) {
+        // the data is already in memory (e.g. the mmapped ORT format model buffer) and the offset
+        // carries its address. whoever loaded the proto owns the bytes, so no deleter is set.
+        raw_data = reinterpret_cast<void*>(static_cast<uintptr_t>(file_offset));
+        raw_data_in_memory = true;
+      } else {
+        // load the file
+        ORT_RETURN_IF_ERROR(GetFileContent(
+            env, external_data_file_path.c_str(), file_offset, raw_data_len,
+            raw_data, deleter_for_file_data.d));
+      }
     } else if (utils::HasRawData(tensor_proto)) {
       if (ele_type == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING)
         return Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "string tensor can not have raw data");
@@ -656,7 +680,8 @@ Status TensorProtoToMLValue(const Env& env, const ORTCHAR_T* model_path,
       //raw_data = buffer.release();
       raw_data_len = tensor_proto.raw_data().size();
     }
-    if (endian::native == endian::little && raw_data != nullptr && deleter_for_file_data.d.f != nullptr) {
+    if (endian::native == endian::little && raw_data != nullptr &&
+        (deleter_for_file_data.d.f != nullptr || raw_data_in_memory)) {
       tensor_data = raw_data;
       MoveOrtCallback(deleter_for_file_data.d, deleter);
     } else {
@@ -1137,6 +1162,18 @@ template common::Status GetSizeInBytesFromTensorProto<0>(const ONNX_NAMESPACE::T
     break;                                                                      \
   }
 
+bool HasExternalDataInMemory(const ONNX_NAMESPACE::TensorProto& ten_proto) {
+  if (!HasExternalData(ten_proto)) {
+    return false;
+  }
+  for (const auto& entry : ten_proto.external_data()) {
+    if (entry.has_key() && entry.key() == "location" && entry.has_value()) {
+      return ToWideString(entry.value()) == kTensorProtoMemoryAddressTag;
+    }
+  }
+  return false;
+}
+
 Status UnpackInitializerData(const onnx::TensorProto& initializer,
                              const Path& model_path,
                              std::unique_ptr<unsigned char[]>& unpacked_tensor,
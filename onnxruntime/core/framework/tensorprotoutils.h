@@ -129,6 +129,15 @@ inline bool HasExternalData(const ONNX_NAMESPACE::TensorProto& ten_proto) {
          ten_proto.data_location() == ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL;
 }
 
+// 'location' value of an external data entry whose payload lives in memory rather than in a file.
+// The 'offset' entry then carries the address of the data. Used for initializers that reference
+// the (mmapped) ORT format model buffer directly instead of owning a copy of the bytes.
+constexpr const ORTCHAR_T* kTensorProtoMemoryAddressTag = ORT_TSTR("*/_ORT_MEM_ADDR_/*");
+
+// Returns true if the initializer has external data whose location is kTensorProtoMemoryAddressTag,
+// i.e. its payload is already in memory and no file needs to be read.
+bool HasExternalDataInMemory(const ONNX_NAMESPACE::TensorProto& ten_proto);
+
 inline bool HasDataType(const ONNX_NAMESPACE::TensorProto& ten_proto) {
   return ten_proto.data_type() != ONNX_NAMESPACE::TensorProto::UNDEFINED;
 }
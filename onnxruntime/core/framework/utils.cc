@@ -429,35 +429,64 @@ static common::Status CopyOutputsAcrossDevices(const SessionState& session_state
   return Status::OK();
 }
 
+// total bytes held by the tensor values in the container; used for the byte counts on run trace
+// copy spans. non-tensor and string values are skipped.
+static size_t CalculateTensorBytes(const std::vector<OrtValue>& values) {
+  size_t bytes = 0;
+  for (const auto& value : values) {
+    if (value.IsAllocated() && value.IsTensor()) {
+      const auto& tensor = value.Get<Tensor>();
+      if (!tensor.IsDataTypeString()) {
+        bytes += tensor.SizeInBytes();
+      }
+    }
+  }
+
+  return bytes;
+}
+
 static common::Status ExecuteGraphImpl(const SessionState& session_state,
                                        const FeedsFetchesManager& feeds_fetches_manager,
                                        const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
                                        const std::unordered_map<size_t, IExecutor::CustomAllocator>& fetch_allocators,
                                        ExecutionMode execution_mode, const bool& terminate_flag,
-                                       const logging::Logger& logger, const bool only_execute_path_to_fetches = false) {
+                                       const logging::Logger& logger, const bool only_execute_path_to_fetches = false,
+                                       std::chrono::steady_clock::time_point deadline =
+                                           std::chrono::steady_clock::time_point::max(),
+                                       const RunTraceContext* run_trace = nullptr) {
   std::unique_ptr<IExecutor> p_exec;
   if (execution_mode == ExecutionMode::ORT_SEQUENTIAL) {
-    p_exec = std::unique_ptr<IExecutor>(new SequentialExecutor(terminate_flag, only_execute_path_to_fetches));
+    p_exec = std::unique_ptr<IExecutor>(new SequentialExecutor(terminate_flag, only_execute_path_to_fetches, deadline));
   } else if (execution_mode == ExecutionMode::ORT_PARALLEL) {
     auto* p_inter_op_thread_pool = session_state.GetInterOpThreadPool();
     if (!p_inter_op_thread_pool) {
       LOGS(logger, WARNING) << "Only one thread was configured for parallel execution. Hence will use sequential execution.";
-      p_exec = std::unique_ptr<IExecutor>(new SequentialExecutor(terminate_flag, only_execute_path_to_fetches));
+      p_exec = std::unique_ptr<IExecutor>(new SequentialExecutor(terminate_flag, only_execute_path_to_fetches, deadline));
     } else {
-      p_exec = std::unique_ptr<IExecutor>(new ParallelExecutor(session_state, terminate_flag));
+      p_exec = std::unique_ptr<IExecutor>(new ParallelExecutor(session_state, terminate_flag, deadline));
     }
   }
 
   const auto& feeds_fetches_info = feeds_fetches_manager.GetFeedsFetchesInfo();
   const auto& device_copy_checks = feeds_fetches_manager.GetDeviceCopyChecks();
 
+  std::chrono::steady_clock::time_point span_start;
+
   // see if we can skip copies due to the types of execution providers available
   if (device_copy_checks.status == DeviceCopyCheck::NoCopy) {
     // no device copies are needed so simple execute
+    if (run_trace != nullptr) {
+      span_start = std::chrono::steady_clock::now();
+    }
+
     ORT_RETURN_IF_ERROR(p_exec->Execute(session_state,
                                         feeds_fetches_info.feeds_mlvalue_idxs, feeds,
                                         feeds_fetches_info.fetches_mlvalue_idxs, fetches, fetch_allocators,
                                         logger));
+
+    if (run_trace != nullptr) {
+      run_trace->Emit(RunTraceSpanKind::kExecute, span_start, std::chrono::steady_clock::now());
+    }
   } else {
     const std::vector<OrtValue>* p_feeds = &feeds;
     std::vector<OrtValue>* p_fetches = &fetches;
@@ -465,9 +494,18 @@ static common::Status ExecuteGraphImpl(const SessionState& session_state,
     std::vector<OrtValue> device_fetches;
 
     if (device_copy_checks.input_copy_needed == DeviceCopyCheck::Copy) {
+      if (run_trace != nullptr) {
+        span_start = std::chrono::steady_clock::now();
+      }
+
       const auto& feed_copy_info = feeds_fetches_manager.GetFeedsDeviceCopyInfo();
       ORT_RETURN_IF_ERROR(CopyInputsAcrossDevices(session_state, feeds, device_feeds, feed_copy_info));
       p_feeds = &device_feeds;
+
+      if (run_trace != nullptr) {
+        run_trace->Emit(RunTraceSpanKind::kFeedCopy, span_start, std::chrono::steady_clock::now(),
+                        CalculateTensorBytes(feeds));
+      }
     }
 
     auto num_outputs = fetches.size();
@@ -489,13 +527,30 @@ static common::Status ExecuteGraphImpl(const SessionState& session_state,
       p_fetches = &device_fetches;
     }
 
+    if (run_trace != nullptr) {
+      span_start = std::chrono::steady_clock::now();
+    }
+
     ORT_RETURN_IF_ERROR(p_exec->Execute(session_state,
                                         feeds_fetches_info.feeds_mlvalue_idxs, *p_feeds,
                                         feeds_fetches_info.fetches_mlvalue_idxs, *p_fetches, fetch_allocators,
                                         logger));
 
+    if (run_trace != nullptr) {
+      run_trace->Emit(RunTraceSpanKind::kExecute, span_start, std::chrono::steady_clock::now());
+    }
+
     if (device_copy_checks.output_copy_needed == DeviceCopyCheck::Copy) {
+      if (run_trace != nullptr) {
+        span_start = std::chrono::steady_clock::now();
+      }
+
       ORT_RETURN_IF_ERROR(CopyOutputsAcrossDevices(session_state, *p_fetches, fetches, fetch_copy_info));
+
+      if (run_trace != nullptr) {
+        run_trace->Emit(RunTraceSpanKind::kFetchCopy, span_start, std::chrono::steady_clock::now(),
+                        CalculateTensorBytes(fetches));
+      }
     }
   }
 
@@ -506,14 +561,17 @@ common::Status ExecuteGraph(const SessionState& session_state,
                             FeedsFetchesManager& feeds_fetches_manager,
                             const std::vector<OrtValue>& feeds, std::vector<OrtValue>& fetches,
                             ExecutionMode execution_mode, const bool& terminate_flag,
-                            const logging::Logger& logger, bool only_execute_path_to_fetches) {
+                            const logging::Logger& logger, bool only_execute_path_to_fetches,
+                            std::chrono::steady_clock::time_point deadline,
+                            const RunTraceContext* run_trace) {
   ORT_RETURN_IF_ERROR(utils::InitializeFeedFetchCopyInfo(session_state, feeds_fetches_manager));
 
   // finalize the copy info using the provided feeds and fetches. will update device_copy_checks in the background
   FinalizeFeedFetchCopyInfo(feeds_fetches_manager, feeds, fetches);
 
   auto status = ExecuteGraphImpl(session_state, feeds_fetches_manager, feeds, fetches, {},
-                                 execution_mode, terminate_flag, logger, only_execute_path_to_fetches);
+                                 execution_mode, terminate_flag, logger, only_execute_path_to_fetches, deadline,
+                                 run_trace);
 
   return status;
 }
@@ -1622,6 +1622,7 @@ Matrix product that behaves like numpy.matmul: https://docs.scipy.org/doc/numpy-
       .SinceVersion(1)
       .Input(0, "A", "N-dimensional matrix A", "T")
       .Input(1, "B", "N-dimensional matrix B", "T")
+      .Input(2, "C", "Optional residual tensor with exactly the same shape as output Y, added element-wise to the matrix product", "T", OpSchema::Optional)
       .Attr(
           "alpha",
           "Scalar multiplier for the product of the input tensors.",
@@ -2282,6 +2283,46 @@ It's an extension of Gelu. It takes the sum of input A and bias input B as the i
         }
       });
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(SparseMatMul)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc("Multiplies a 2-dimensional sparse matrix A (COO or CSR format) with a 2-dimensional "
+              "dense matrix B, producing the dense matrix Y = A * B without materializing A densely.")
+      .Input(0, "A", "2-dimensional sparse matrix A.", "T1")
+      .Input(1, "B", "2-dimensional dense matrix B.", "T")
+      .Output(0, "Y", "Matrix multiply results.", "T")
+      .TypeConstraint(
+          "T1",
+          {"sparse_tensor(float)", "sparse_tensor(double)"},
+          "Constrain the sparse input to float tensors.")
+      .TypeConstraint(
+          "T",
+          {"tensor(float)", "tensor(double)"},
+          "Constrain the dense input and output to float tensors.")
+      .TypeAndShapeInferenceFunction([](ONNX_NAMESPACE::InferenceContext& ctx) {
+        using namespace ONNX_NAMESPACE;
+        propagateElemTypeFromInputToOutput(ctx, 1, 0);
+
+        const auto* a_type = ctx.getInputType(0);
+        const auto* b_type = ctx.getInputType(1);
+        if (a_type == nullptr || b_type == nullptr ||
+            a_type->value_case() != TypeProto::kSparseTensorType ||
+            !a_type->sparse_tensor_type().has_shape() ||
+            !b_type->tensor_type().has_shape()) {
+          return;
+        }
+
+        const auto& a_shape = a_type->sparse_tensor_type().shape();
+        const auto& b_shape = b_type->tensor_type().shape();
+        if (a_shape.dim_size() != 2 || b_shape.dim_size() != 2) {
+          fail_shape_inference("Both inputs must be 2-dimensional matrices.");
+        }
+
+        auto* output_shape = ctx.getOutputType(0)->mutable_tensor_type()->mutable_shape();
+        *output_shape->add_dim() = a_shape.dim(0);
+        *output_shape->add_dim() = b_shape.dim(1);
+      });
+
   static const char* Trilu_ver1_doc = R"DOC(
       Returns the upper or lower triangular part of a 2-D matrix, or batches of 2-D matrices. If the attribute "upper" is set to true,
       the upper triangular matrix is retained. Lower triangular matrix is retained otherwise. Default value for upper is true.
@@ -2368,6 +2409,25 @@ It's an extension of Gelu. It takes the sum of input A and bias input B as the i
           "Constrain input and output types to float tensors.")
       .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
 
+  ONNX_CONTRIB_OPERATOR_SCHEMA(FusedElementwise)
+      .SetDomain(kMSDomain)
+      .SinceVersion(1)
+      .SetDoc(
+          "Evaluates a chain of pointwise ops in one pass over the data, eliminating the "
+          "intermediate tensors between them. The chain starts from 'data'; each binary step "
+          "consumes the next operand input in order. Created by the ElementwiseChainFusion "
+          "graph transformer and not intended to be used directly in models.")
+      .Attr("ops", "op types applied in order; each entry is one of Add, Sub, Mul, Div, Sigmoid, Tanh, Relu, Exp, Sqrt, Neg, Abs", AttributeProto::STRINGS)
+      .Attr("reversed", "per step, 1 if the running value is the second operand of the binary op (e.g. operand - value); defaults to all 0", AttributeProto::INTS, OPTIONAL_VALUE)
+      .Input(0, "data", "The input the chain starts from.", "T")
+      .Input(1, "operands", "Second operands of the binary steps, in step order. Each either matches the shape of 'data' or is a scalar.", "T", OpSchema::Variadic, true, 0)
+      .Output(0, "output", "The output, with the shape of 'data'.", "T")
+      .TypeConstraint(
+          "T",
+          {"tensor(float16)", "tensor(float)", "tensor(double)"},
+          "Constrain input and output types to float tensors.")
+      .TypeAndShapeInferenceFunction(ONNX_NAMESPACE::propagateShapeAndTypeFromFirstInput);
+
   // Register the NCHWc schemas if supported by the platform.
   if (MlasNchwcGetBlockSize() > 1) {
     RegisterNchwcSchemas();
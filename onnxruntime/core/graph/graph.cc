@@ -42,6 +42,21 @@ using namespace onnxruntime::experimental;
 
 namespace onnxruntime {
 
+void NodeArenaDeleter::operator()(Node* node) const noexcept {
+  // storage is owned by the Graph's node arena; only run the destructor here
+  node->~Node();
+}
+
+void* Graph::NodeArena::Allocate() {
+  if (used_in_last_block_ == kNodesPerBlock) {
+    // operator new[] for uint8_t returns storage aligned for any object of fundamental alignment
+    blocks_.push_back(onnxruntime::make_unique<uint8_t[]>(kNodesPerBlock * sizeof(Node)));
+    used_in_last_block_ = 0;
+  }
+
+  return blocks_.back().get() + (used_in_last_block_++ * sizeof(Node));
+}
+
 #if !defined(ORT_MINIMAL_BUILD)
 #define NO_CHANGE_ON_SYNC_FLAG(...)                  \
   do {                                               \
@@ -428,6 +443,8 @@ const Node* Node::NodeConstIterator::operator->() const {
 
 void Node::SetPriority(int priority) noexcept {
   priority_ = priority;
+  // priority feeds into the priority based topological order cached on the graph
+  graph_->InvalidateTopologicalOrderCache();
 }
 
 const Path& Node::ModelPath() const noexcept {
@@ -575,8 +592,8 @@ flatbuffers::Offset<fbs::NodeEdge> Node::SaveEdgesToOrtFormat(flatbuffers::FlatB
 
 #if defined(ENABLE_ORT_FORMAT_LOAD)
 Status Node::LoadFromOrtFormat(const onnxruntime::experimental::fbs::Node& fbs_node, Graph& graph,
-                               const logging::Logger& logger, std::unique_ptr<Node>& node) {
-  node.reset(new Node(fbs_node.index(), graph));
+                               const logging::Logger& logger, NodePtr& node) {
+  node.reset(new (graph.node_arena_.Allocate()) Node(fbs_node.index(), graph));
   return node->LoadFromOrtFormat(fbs_node, logger);
 }
 
@@ -710,14 +727,14 @@ void Node::Init(const std::string& name,
 
 Node::Definitions& Node::MutableDefinitions() noexcept {
   // someone fetching these is going to change something
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   return definitions_;
 }
 
 Node::Relationships& Node::MutableRelationships() noexcept {
   // someone fetching these is going to change something
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   return relationships_;
 }
@@ -738,14 +755,14 @@ void Node::CreateSubgraph(const std::string& attr_name) {
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 void Node::AddAttribute(const std::string& attr_name, const AttributeProto& value) {
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   attributes_[attr_name] = value;
 }
 
 #define ADD_BASIC_ATTR_IMPL(type, enumType, field)                           \
   void Node::AddAttribute(const std::string& attr_name, const type& value) { \
-    graph_->SetGraphResolveNeeded();                                         \
+    graph_->SetGraphResolveNeeded(*this);                                    \
     graph_->SetGraphProtoSyncNeeded();                                       \
     AttributeProto a;                                                        \
     a.set_name(attr_name);                                                   \
@@ -756,7 +773,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
 
 #define ADD_ATTR_IMPL(type, enumType, field)                                 \
   void Node::AddAttribute(const std::string& attr_name, const type& value) { \
-    graph_->SetGraphResolveNeeded();                                         \
+    graph_->SetGraphResolveNeeded(*this);                                    \
     graph_->SetGraphProtoSyncNeeded();                                       \
     AttributeProto a;                                                        \
     a.set_name(attr_name);                                                   \
@@ -768,7 +785,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
 #define ADD_LIST_ATTR_IMPL(type, enumType, field)            \
   void Node::AddAttribute(const std::string& attr_name,      \
                           const std::vector<type>& values) { \
-    graph_->SetGraphResolveNeeded();                         \
+    graph_->SetGraphResolveNeeded(*this);                    \
     graph_->SetGraphProtoSyncNeeded();                       \
     AttributeProto a;                                        \
     a.set_name(attr_name);                                   \
@@ -780,7 +797,7 @@ void Node::AddAttribute(const std::string& attr_name, const AttributeProto& valu
   };
 
 void Node::AddAttribute(const std::string& attr_name, const GraphProto& value) {
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   AttributeProto a;
   a.set_name(attr_name);
@@ -808,7 +825,7 @@ ADD_LIST_ATTR_IMPL(SparseTensorProto, AttributeProto_AttributeType::AttributePro
 
 #if !defined(ORT_MINIMAL_BUILD)
 bool Node::ClearAttribute(const std::string& attr_name) {
-  graph_->SetGraphResolveNeeded();
+  graph_->SetGraphResolveNeeded(*this);
   graph_->SetGraphProtoSyncNeeded();
   return attributes_.erase(attr_name) > 0;
 }
@@ -862,7 +879,7 @@ Status Node::UpdateInputArgCount() {
     // of the operator.
     input_arg_count.push_back(arg_count_left);
 
-    graph_->SetGraphResolveNeeded();
+    graph_->SetGraphResolveNeeded(*this);
     graph_->SetGraphProtoSyncNeeded();
   }
 
@@ -1192,6 +1209,10 @@ void Graph::InitializeStateFromModelFileGraphProto() {
   ComputeOverridableInitializers();
 }
 
+const std::string* Graph::InternString(const std::string& str) const {
+  return &owning_model_.InternString(str);
+}
+
 Status Graph::VerifyNoDuplicateName() {
   auto& inputs_and_initializers = resolve_context_.inputs_and_initializers;
   auto& output_args = resolve_context_.output_args;
@@ -1206,14 +1227,15 @@ Status Graph::VerifyNoDuplicateName() {
     // Verify node name should be unique.
     auto& node_name = node.Name();
 
-    if (!node_name.empty() && node_name_to_index.end() != node_name_to_index.find(node_name)) {
+    if (!node_name.empty() && node_name_to_index.end() != node_name_to_index.find(&node_name)) {
       // The node has name and its name was used by another node.
       Status status(ONNXRUNTIME, FAIL,
                     "This is an invalid model. Error: two nodes with same node name (" + node_name + ").");
       return status;
     }
 
-    node_name_to_index[node_name] = node.Index();
+    // key by the interned copy; the node (and the name it owns) can be removed later in resolve
+    node_name_to_index[InternString(node_name)] = node.Index();
 
     // Verify node outputs' name should be unique.
     int output_index = -1;
@@ -1221,12 +1243,12 @@ Status Graph::VerifyNoDuplicateName() {
       ++output_index;
       if (output_def->Exists()) {
         auto& output_arg_name = output_def->Name();
-        if (inputs_and_initializers.count(output_arg_name)) {
+        if (inputs_and_initializers.count(&output_arg_name)) {
           Status status(ONNXRUNTIME, FAIL,
                         "This is an invalid model. Error: Duplicate definition of name (" + output_arg_name + ").");
           return status;
         }
-        auto result = output_args.insert({output_arg_name, {&node, output_index}});
+        auto result = output_args.insert({&output_arg_name, {&node, output_index}});
         if (!result.second) {
           // Two outputs with same name, so that insertion fails.
           Status status(ONNXRUNTIME, FAIL,
@@ -1255,12 +1277,15 @@ common::Status Graph::SetOuterScopeNodeArgs(const std::unordered_set<std::string
     // PerformTopologicalSortAndCheckIsAcyclic will validate these links.
     std::unordered_set<std::string> node_args_in_scope_for_subgraph = outer_scope_node_args;
 
-    node_args_in_scope_for_subgraph.insert(resolve_context_.inputs_and_initializers.cbegin(),
-                                           resolve_context_.inputs_and_initializers.cend());
+    for (const auto* name : resolve_context_.inputs_and_initializers) {
+      node_args_in_scope_for_subgraph.insert(*name);
+    }
 
     std::transform(resolve_context_.output_args.cbegin(), resolve_context_.output_args.cend(),
                    std::inserter(node_args_in_scope_for_subgraph, node_args_in_scope_for_subgraph.end()),
-                   [](const std::pair<std::string, std::pair<Node*, int>>& entry) { return entry.first; });
+                   [](const std::pair<const std::string* const, std::pair<Node*, int>>& entry) {
+                     return *entry.first;
+                   });
 
     for (auto* node : resolve_context_.nodes_with_subgraphs) {
       for (auto& subgraph : node->MutableSubgraphs()) {
@@ -1318,6 +1343,8 @@ void Graph::AddEdge(NodeIndex src_node_index, NodeIndex dst_node_index, int src_
 
   nodes_[src_node_index]->MutableRelationships().output_edges.insert(Node::EdgeEnd(*nodes_[dst_node_index], src_arg_slot, dst_arg_slot));
   nodes_[dst_node_index]->MutableRelationships().input_edges.insert(Node::EdgeEnd(*nodes_[src_node_index], src_arg_slot, dst_arg_slot));
+
+  InvalidateTopologicalOrderCache();
 }
 
 void Graph::RemoveEdge(NodeIndex src_node_index, NodeIndex dst_node_index, int src_arg_slot, int dst_arg_slot) {
@@ -1358,6 +1385,8 @@ void Graph::RemoveEdge(NodeIndex src_node_index, NodeIndex dst_node_index, int s
 
   nodes_[dst_node_index]->MutableRelationships().input_edges.erase(Node::EdgeEnd(*nodes_[src_node_index], src_arg_slot, dst_arg_slot));
   nodes_[src_node_index]->MutableRelationships().output_edges.erase(Node::EdgeEnd(*nodes_[dst_node_index], src_arg_slot, dst_arg_slot));
+
+  InvalidateTopologicalOrderCache();
 }
 #endif  // !defined(ORT_MINIMAL_BUILD) || defined(ORT_EXTENDED_MINIMAL_BUILD)
 
@@ -1421,7 +1450,7 @@ Status Graph::BuildConnections(std::unordered_set<std::string>& outer_scope_node
             input_slot_index += static_cast<int>(iter - implicit_inputs.cbegin());
           }
 
-          auto entry = resolve_context_.output_args.find(node_arg_name);
+          auto entry = resolve_context_.output_args.find(&node_arg_name);
           if (entry != resolve_context_.output_args.end()) {
             // Create relationship between this node (node), and the node providing the output (output_node).
             Node& output_node = *entry->second.first;
@@ -1472,7 +1501,7 @@ Status Graph::BuildConnections(std::unordered_set<std::string>& outer_scope_node
 
         node_arg_to_consumer_nodes_[input_arg->Name()].insert(node.Index());
         const auto& input_arg_name = input_arg->Name();
-        auto output_arg_iter = resolve_context_.output_args.find(input_arg_name);
+        auto output_arg_iter = resolve_context_.output_args.find(&input_arg_name);
         if (resolve_context_.output_args.end() != output_arg_iter) {
           // The input to this node is an output from a previous node in this graph.
           // Create relationship between this node (node), and the node providing the output (output_node).
@@ -1485,7 +1514,7 @@ Status Graph::BuildConnections(std::unordered_set<std::string>& outer_scope_node
           // if coming from outer scope, so first check if this is a subgraph (otherwise there is no outer scope).
           if (parent_graph_ != nullptr) {
             // make sure it's not an input or initializer first as those override any outer scope values
-            if (resolve_context_.inputs_and_initializers.find(input_arg_name) ==
+            if (resolve_context_.inputs_and_initializers.find(&input_arg_name) ==
                 resolve_context_.inputs_and_initializers.cend()) {
               // If it is present in the outer scope it will be 'fed' by the execution frame
               // providing access to the OrtValue from the outer scope. Pass the name back up so nodes can
@@ -1508,7 +1537,7 @@ Status Graph::BuildConnections(std::unordered_set<std::string>& outer_scope_node
   // if not we add them to the list of outer scope values consumed.
   for (const auto& name : node_args_consumed_by_subgraphs) {
     if (node_arg_to_producer_node_.count(name) == 0 &&
-        resolve_context_.inputs_and_initializers.find(name) == resolve_context_.inputs_and_initializers.cend()) {
+        resolve_context_.inputs_and_initializers.find(&name) == resolve_context_.inputs_and_initializers.cend()) {
       ORT_IGNORE_RETURN_VALUE(outer_scope_node_args_consumed.insert(name));
     }
   }
@@ -2269,8 +2298,9 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
   ctx.set_model_dir(ToMBString(ModelPath().ParentPath().ToPathString()));
 
   LexicalScopeContext lsc;
-  lsc.output_names.insert(resolve_context_.inputs_and_initializers.cbegin(),
-                          resolve_context_.inputs_and_initializers.cend());
+  for (const auto* name : resolve_context_.inputs_and_initializers) {
+    lsc.output_names.insert(*name);
+  }
 
   // technically we could add values from Node.GetDefinitions().implicit_input_defs on a per-node basis inside
   // the below loop so that we only check against the specific outer dependencies of the node.
@@ -2284,10 +2314,42 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
   // and need to call Resolve
   lsc.output_names.insert(outer_scope_node_arg_names_.cbegin(), outer_scope_node_arg_names_.cend());
 
+  // if only node level changes were made since the last resolve, type/shape inference can be
+  // limited to the changed nodes and their downstream consumers. anything that altered graph level
+  // state (inputs/outputs, initializers, node arg types, ...) sets full_resolve_needed_ and
+  // disables this. nodes with subgraphs are always re-inferred as subgraph edits are not tracked.
+  const bool incremental_resolve = num_resolves_ > 0 && !full_resolve_needed_;
+
+  // output names produced by nodes re-inferred in this pass. consumers of these must also be
+  // re-inferred as their input types/shapes may have changed.
+  std::unordered_set<std::string> refreshed_args;
+
   for (auto node_index : nodes_in_topological_order_) {
     // Node verification.
     auto& node = *GetNode(node_index);
 
+    if (incremental_resolve && node.Op() != nullptr && !node.ContainsSubgraph() &&
+        nodes_needing_inference_.count(node_index) == 0) {
+      auto consumes_refreshed_arg = [&refreshed_args](const ConstPointerContainer<std::vector<NodeArg*>>& defs) {
+        return std::any_of(defs.cbegin(), defs.cend(),
+                           [&refreshed_args](const NodeArg* def) {
+                             return def->Exists() && refreshed_args.count(def->Name()) != 0;
+                           });
+      };
+
+      if (!consumes_refreshed_arg(node.InputDefs()) && !consumes_refreshed_arg(node.ImplicitInputDefs())) {
+        // node and its inputs are unchanged. its outputs still need to be visible to the
+        // lexical scope checks of downstream nodes.
+        for (const auto* output_def : node.OutputDefs()) {
+          if (output_def->Exists()) {
+            lsc.output_names.insert(output_def->Name());
+          }
+        }
+
+        continue;
+      }
+    }
+
     NodeProto node_proto;
     node.ToProto(node_proto);
     auto& node_name = node.Name();
@@ -2359,6 +2421,7 @@ Status Graph::VerifyNodeAndOpMatch(const ResolveOptions& options) {
     // Accumulate output names of the iterated Node
     for (auto& output_name : node_proto.output()) {
       lsc.output_names.insert(output_name);
+      refreshed_args.insert(output_name);
     }
   }
 
@@ -2386,10 +2449,10 @@ void Graph::InitFunctionBodyForNode(Node& node) {
 }
 
 Status Graph::VerifyInputAndInitializerNames() {
-  std::unordered_set<std::string>& inputs_and_initializers = resolve_context_.inputs_and_initializers;
+  auto& inputs_and_initializers = resolve_context_.inputs_and_initializers;
 
   for (auto* input : GetInputs()) {
-    auto result = inputs_and_initializers.insert(input->Name());
+    auto result = inputs_and_initializers.insert(&input->Name());
     if (!result.second) {
       Status status(ONNXRUNTIME, FAIL,
                     "Error: Duplicate definition-site for (" + input->Name() + ").");
@@ -2399,7 +2462,8 @@ Status Graph::VerifyInputAndInitializerNames() {
 
   for (auto& initializer_pair : name_to_initial_tensor_) {
     GSL_SUPPRESS(es .84)
-    inputs_and_initializers.insert(initializer_pair.first);
+    // key by the interned copy; unused initializers can be removed mid-resolve
+    inputs_and_initializers.insert(InternString(initializer_pair.first));
     // Initializers are expected to be included in inputs (according to ONNX spec).
     // onnxruntime relaxes this constraint. No duplicate-name check here.
   }
@@ -2417,6 +2481,8 @@ Status Graph::InitInputsInitializersOutputs() {
     node.MutableDefinitions().implicit_input_defs.clear();
   }
 
+  InvalidateTopologicalOrderCache();
+
   // add the subgraph pointers to the resolve context.
   for (auto& node : Nodes()) {
     auto& subgraphs = node.MutableSubgraphs();
@@ -2784,7 +2850,7 @@ std::string Graph::GenerateNodeArgName(const std::string& base_name) {
   // Check if new_name has been generated by this function.
   // If both are not, add new_name into name set and return the new_name
   // as the generated name. Otherwise, keep generating new names.
-  while (node_args_.find(new_name) != node_args_.end() ||
+  while (node_args_.find(&new_name) != node_args_.end() ||
          generated_node_arg_names_.find(new_name) != generated_node_arg_names_.end()) {
     std::ostringstream str;
     str << base_name << "_token_" << name_generator_++;
@@ -2981,6 +3047,8 @@ bool Graph::AddControlEdge(NodeIndex src_node_index, NodeIndex dst_node_index) {
     nodes_[dst_node_index]->MutableRelationships().control_inputs.insert(nodes_[src_node_index]->Name());
   }
 
+  InvalidateTopologicalOrderCache();
+
   return true;
 }
 
@@ -3316,12 +3384,13 @@ IOnnxRuntimeOpSchemaCollectionPtr Graph::GetSchemaRegistry() const {
 GSL_SUPPRESS(r .11)
 gsl::not_null<Node*> Graph::AllocateNode() {
   ORT_ENFORCE(nodes_.size() < static_cast<unsigned int>(std::numeric_limits<int>::max()));
-  std::unique_ptr<Node> new_node(new Node(nodes_.size(), *this));
+  NodePtr new_node(new (node_arena_.Allocate()) Node(nodes_.size(), *this));
   Node* node{new_node.get()};
 
   nodes_.push_back(std::move(new_node));
   ++num_of_nodes_;
-  GraphResolveNeeded(true);
+  SetGraphResolveNeeded(*node);
+  InvalidateTopologicalOrderCache();
 
   return gsl::not_null<Node*>{node};
 }
@@ -3337,7 +3406,10 @@ bool Graph::ReleaseNode(NodeIndex index) {
     nodes_[index] = nullptr;
     --num_of_nodes_;
     GraphProtoSyncNeeded(true);
-    GraphResolveNeeded(true);
+    InvalidateTopologicalOrderCache();
+    // removing a node does not invalidate the inferred types of the remaining nodes: consumers
+    // must have been rewired already (which marked them), so incremental resolve stays possible
+    graph_resolve_needed_ = true;
   }
 
   return true;
@@ -3650,7 +3722,8 @@ Status Graph::LoadFromOrtFormat(const onnxruntime::experimental::fbs::Graph& fbs
 #if !defined(ORT_MINIMAL_BUILD)
                                 IOnnxRuntimeOpSchemaCollectionPtr schema_registry,
 #endif
-                                const logging::Logger& logger, std::unique_ptr<Graph>& graph) {
+                                const logging::Logger& logger, std::unique_ptr<Graph>& graph,
+                                bool can_use_flatbuffer_for_initializers) {
   // can't use make_unique as we're calling a private ctor
   graph.reset(new Graph(owning_model, domain_to_version,
 #if !defined(ORT_MINIMAL_BUILD)
@@ -3658,6 +3731,7 @@ Status Graph::LoadFromOrtFormat(const onnxruntime::experimental::fbs::Graph& fbs
 #endif
                         nullptr, nullptr, logger));
 
+  graph->can_use_flatbuffer_for_initializers_ = can_use_flatbuffer_for_initializers;
   ORT_RETURN_IF_ERROR(graph->LoadFromOrtFormat(fbs_graph));
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -3684,6 +3758,7 @@ Status Graph::LoadFromOrtFormat(const onnxruntime::experimental::fbs::Graph& fbs
                         &parent_graph, &parent_node,
                         logger));
 
+  graph->can_use_flatbuffer_for_initializers_ = parent_graph.can_use_flatbuffer_for_initializers_;
   return graph->LoadFromOrtFormat(fbs_graph);
 }
 
@@ -3732,7 +3807,8 @@ common::Status Graph::LoadFromOrtFormat(const onnxruntime::experimental::fbs::Gr
     for (const auto* fbs_tensor : *fbs_initializers) {
       ORT_RETURN_IF(nullptr == fbs_tensor, "Initializer tensor is missing. Invalid ORT format model.");
       TensorProto* initializer = deserialized_proto_data_.add_initializer();
-      ORT_RETURN_IF_ERROR(experimental::utils::LoadInitializerOrtFormat(*fbs_tensor, *initializer));
+      ORT_RETURN_IF_ERROR(experimental::utils::LoadInitializerOrtFormat(*fbs_tensor, *initializer,
+                                                                        can_use_flatbuffer_for_initializers_));
       auto p = name_to_initial_tensor_.emplace(initializer->name(), initializer);
       if (!p.second) {
         LOGS(logger_, WARNING) << "Duplicate initializer (dense or ConstantNode): '" << initializer->name()
@@ -3773,7 +3849,9 @@ common::Status Graph::LoadFromOrtFormat(const onnxruntime::experimental::fbs::Gr
       NodeArgInfo node_arg_info;
       ORT_RETURN_IF_ERROR(experimental::utils::LoadValueInfoOrtFormat(*fbs_value_info, node_arg_info));
       // NodeArg ctor is private, cannot use make_unique
-      node_args_[fbs_value_info->name()->str()] = std::unique_ptr<NodeArg>(new NodeArg(std::move(node_arg_info)));
+      std::unique_ptr<NodeArg> node_arg(new NodeArg(std::move(node_arg_info)));
+      const std::string* name = &node_arg->Name();
+      node_args_[name] = std::move(node_arg);
     }
   }
 
@@ -3790,7 +3868,7 @@ common::Status Graph::LoadFromOrtFormat(const onnxruntime::experimental::fbs::Gr
   if (fbs_nodes != nullptr) {
     for (const auto* fbs_node : *fbs_nodes) {
       ORT_RETURN_IF(nullptr == fbs_node, "Node is missing. Invalid ORT format model.");
-      std::unique_ptr<Node> node;
+      NodePtr node;
       ORT_RETURN_IF_ERROR(Node::LoadFromOrtFormat(*fbs_node, *this, logger_, node));
       ORT_RETURN_IF(node->Index() >= fbs_graph.max_node_index(), "Node index is out of range");
       nodes_[node->Index()] = std::move(node);
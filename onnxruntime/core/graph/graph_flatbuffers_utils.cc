@@ -48,6 +48,9 @@ Status SaveInitializerOrtFormat(flatbuffers::FlatBufferBuilder& builder,
     size_t tensor_byte_size = 0;
     ORT_RETURN_IF_ERROR(
         onnxruntime::utils::UnpackInitializerData(initializer, model_path, unpacked_tensor, tensor_byte_size));
+    // align the data so initializers can be used in place from the (mmapped) model buffer when
+    // the model is loaded. see LoadInitializerOrtFormat.
+    builder.ForceVectorAlignment(tensor_byte_size, sizeof(uint8_t), kInitializerRawDataAlignment);
     raw_data = builder.CreateVector(unpacked_tensor.get(), tensor_byte_size);
   }
 
@@ -178,7 +181,8 @@ Status SaveAttributeOrtFormat(flatbuffers::FlatBufferBuilder& builder,
 #if defined(ENABLE_ORT_FORMAT_LOAD)
 
 Status LoadInitializerOrtFormat(const fbs::Tensor& fbs_tensor,
-                                TensorProto& initializer) {
+                                TensorProto& initializer,
+                                bool can_use_flatbuffer_for_initializers) {
   initializer.Clear();
 
   LOAD_STR_FROM_ORT_FORMAT(initializer, name, fbs_tensor.name());
@@ -202,8 +206,29 @@ Status LoadInitializerOrtFormat(const fbs::Tensor& fbs_tensor,
     const auto* fbs_raw_data = fbs_tensor.raw_data();
     ORT_RETURN_IF(nullptr == fbs_raw_data, "Missing raw data for initializer. Invalid ORT format model.");
 
-    // fbs_raw_data is uint8_t vector, so the size is byte size
-    initializer.set_raw_data(fbs_raw_data->Data(), fbs_raw_data->size());
+    if (can_use_flatbuffer_for_initializers &&
+        fbs_raw_data->size() > 127 &&
+        reinterpret_cast<uintptr_t>(fbs_raw_data->Data()) % kInitializerRawDataAlignment == 0) {
+      // reference the payload in the flatbuffer directly instead of copying it. models serialized
+      // with the current writer have 64-byte aligned raw_data (see SaveInitializerOrtFormat);
+      // older, unaligned models and small initializers (where the external data entries would
+      // cost more than the copy saves) take the copying path below.
+      static_assert(sizeof(void*) <= sizeof(int64_t), "pointer must fit in the external data offset value");
+      initializer.set_data_location(ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL);
+      auto* external_data = initializer.mutable_external_data();
+      auto* entry = external_data->Add();
+      entry->set_key("location");
+      entry->set_value(ToMBString(onnxruntime::utils::kTensorProtoMemoryAddressTag));
+      entry = external_data->Add();
+      entry->set_key("offset");
+      entry->set_value(std::to_string(reinterpret_cast<intptr_t>(fbs_raw_data->Data())));
+      entry = external_data->Add();
+      entry->set_key("length");
+      entry->set_value(std::to_string(fbs_raw_data->size()));
+    } else {
+      // fbs_raw_data is uint8_t vector, so the size is byte size
+      initializer.set_raw_data(fbs_raw_data->Data(), fbs_raw_data->size());
+    }
   }
 
   return Status::OK();
@@ -34,6 +34,10 @@ struct Tensor;
 
 namespace utils {
 
+// Alignment the serializer guarantees for fbs::Tensor raw_data, so initializers can be used
+// in place from the (mmapped) model buffer with cache-line aligned, vectorization-friendly data.
+constexpr size_t kInitializerRawDataAlignment = 64;
+
 // TODO, add ORT_MUST_USE_RESULT when it is moved to a different header
 onnxruntime::common::Status SaveInitializerOrtFormat(
     flatbuffers::FlatBufferBuilder& builder, const ONNX_NAMESPACE::TensorProto& initializer,
@@ -54,8 +58,14 @@ onnxruntime::common::Status SaveAttributeOrtFormat(
 
 #if defined(ENABLE_ORT_FORMAT_LOAD)
 
+// Load an initializer from fbs::Tensor.
+// If can_use_flatbuffer_for_initializers is true, a suitably aligned raw_data payload is not
+// copied into the TensorProto; the proto instead gets an external data entry carrying the
+// in-memory address (see utils::kTensorProtoMemoryAddressTag), so the caller must keep the
+// flatbuffer bytes alive for as long as the initializer may be read.
 onnxruntime::common::Status LoadInitializerOrtFormat(
-    const fbs::Tensor& fbs_tensor, ONNX_NAMESPACE::TensorProto& initializer);
+    const fbs::Tensor& fbs_tensor, ONNX_NAMESPACE::TensorProto& initializer,
+    bool can_use_flatbuffer_for_initializers = false);
 
 onnxruntime::common::Status LoadSparseInitializerOrtFormat(const fbs::SparseTensor& fbs_sparse_tensor,
                                                            ONNX_NAMESPACE::SparseTensorProto& initializer);
@@ -57,32 +57,50 @@ GraphViewer::GraphViewer(const Graph& graph, const IndexedSubGraph* filter_info)
           filter_info ? [this](NodeIndex idx) { return filtered_node_indices_.count(idx) == 0; }
                       : ConstGraphNodes::NodeFilterFunc(nullptr))},
       filter_info_{filter_info} {
-  std::vector<const Node*> leaf_nodes;
-  for (auto& node : graph_->Nodes()) {
-    // This is a leaf node (without any output node)
-    if (node.OutputNodesBegin() == node.OutputNodesEnd()) {
-      leaf_nodes.push_back(&node);
-    }
-    // This is a root node (without any input node)
-    if (node.InputEdgesBegin() == node.InputEdgesEnd()) {
-      root_nodes_.push_back(node.Index());
+  // the sorts are relatively expensive and GraphViewer instances are created repeatedly over
+  // an unchanged graph during partitioning and the transformer passes, so the results are
+  // cached on the Graph and re-used until a change to its nodes or edges invalidates them.
+  auto& cache = graph_->topological_order_cache_;
+  if (!cache.valid) {
+    cache.root_nodes.clear();
+    cache.nodes_in_topological_order.clear();
+
+    std::vector<const Node*> leaf_nodes;
+    for (auto& node : graph_->Nodes()) {
+      // This is a leaf node (without any output node)
+      if (node.OutputNodesBegin() == node.OutputNodesEnd()) {
+        leaf_nodes.push_back(&node);
+      }
+      // This is a root node (without any input node)
+      if (node.InputEdgesBegin() == node.InputEdgesEnd()) {
+        cache.root_nodes.push_back(node.Index());
+      }
     }
-  }
 
-  graph.ReverseDFSFrom(
-      leaf_nodes,
-      nullptr,
-      [this](const Node* n) {
-        nodes_in_topological_order_.push_back(n->Index());
-      },
-      NodeCompare());
+    graph.ReverseDFSFrom(
+        leaf_nodes,
+        nullptr,
+        [&cache](const Node* n) {
+          cache.nodes_in_topological_order.push_back(n->Index());
+        },
+        NodeCompare());
+
+#if !defined(ORT_MINIMAL_BUILD)
+    cache.nodes_in_topological_order_with_priority.clear();
+    graph.KahnsTopologicalSort(
+        [&cache](const Node* n) {
+          cache.nodes_in_topological_order_with_priority.push_back(n->Index());
+        },
+        PriorityNodeCompare());
+#endif
+
+    cache.valid = true;
+  }
 
+  root_nodes_ = cache.root_nodes;
+  nodes_in_topological_order_ = cache.nodes_in_topological_order;
 #if !defined(ORT_MINIMAL_BUILD)
-  graph.KahnsTopologicalSort(
-      [this](const Node* n) {
-        nodes_in_topological_order_with_priority_.push_back(n->Index());
-      },
-      PriorityNodeCompare());
+  nodes_in_topological_order_with_priority_ = cache.nodes_in_topological_order_with_priority;
 #endif
 
   if (filter_info_) {
@@ -14,6 +14,7 @@
 // 'type' : forcing value to bool 'true' or 'false' (performance warning)
 #pragma warning(disable : 4800)
 #endif
+#include <google/protobuf/arena.h>
 #include <google/protobuf/io/coded_stream.h>
 #ifdef _MSC_VER
 #pragma warning(pop)
@@ -48,11 +49,13 @@ Model::Model(const std::string& graph_name,
              const std::vector<ONNX_NAMESPACE::FunctionProto>&,
              const logging::Logger& logger)
     : model_path_(Path::Parse(model_path)) {
-  model_proto_.set_ir_version(ONNX_NAMESPACE::Version::IR_VERSION);
-  model_proto_.mutable_graph()->set_name(graph_name);
+  owned_model_proto_ = onnxruntime::make_unique<ModelProto>();
+  model_proto_ = owned_model_proto_.get();
+  model_proto_->set_ir_version(ONNX_NAMESPACE::Version::IR_VERSION);
+  model_proto_->mutable_graph()->set_name(graph_name);
   model_metadata_ = model_metadata;
   for (auto& metadata : model_metadata_) {
-    const gsl::not_null<StringStringEntryProto*> prop{model_proto_.add_metadata_props()};
+    const gsl::not_null<StringStringEntryProto*> prop{model_proto_->add_metadata_props()};
     prop->set_key(metadata.first);
     prop->set_value(metadata.second);
   }
@@ -77,14 +80,14 @@ Model::Model(const std::string& graph_name,
     model_load_utils::ValidateOpsetForDomain(
         domain_to_version_static, logger, allow_released_opsets_only,
         domain.first, domain.second);
-    const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_.add_opset_import()};
+    const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_->add_opset_import()};
     opset_id_proto->set_domain(domain.first);
     opset_id_proto->set_version(domain.second);
   }
 
   // need to call private ctor so can't use make_shared
   GSL_SUPPRESS(r .11)
-  graph_.reset(new Graph(*this, model_proto_.mutable_graph(), *p_domain_to_version, IrVersion(), schema_registry,
+  graph_.reset(new Graph(*this, model_proto_->mutable_graph(), *p_domain_to_version, IrVersion(), schema_registry,
                          logger));
 }
 
@@ -97,22 +100,39 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path,
              const IOnnxRuntimeOpSchemaRegistryList* local_registries,
              const logging::Logger& logger)
     : model_path_(Path::Parse(model_path)) {
-  if (!utils::HasGraph(model_proto)) {
+  owned_model_proto_ = onnxruntime::make_unique<ModelProto>(std::move(model_proto));
+  model_proto_ = owned_model_proto_.get();
+  InitializeFromModelProto(local_registries, logger);
+}
+
+Model::Model(std::unique_ptr<google::protobuf::Arena> arena, ModelProto& model_proto,
+             const PathString& model_path,
+             const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+             const logging::Logger& logger)
+    : model_path_(Path::Parse(model_path)) {
+  ORT_ENFORCE(model_proto.GetArena() == arena.get(), "<model_proto> must have been created on <arena>.");
+  arena_ = std::move(arena);
+  model_proto_ = &model_proto;
+  InitializeFromModelProto(local_registries, logger);
+}
+
+void Model::InitializeFromModelProto(const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                                     const logging::Logger& logger) {
+  if (!utils::HasGraph(*model_proto_)) {
     ORT_THROW("ModelProto does not have a graph.");
   }
 
-  if (model_proto.opset_import_size() == 0) {
+  if (model_proto_->opset_import_size() == 0) {
     ORT_THROW(
         "Missing opset in the model. All ModelProtos MUST have at least one entry that"
         " specifies which version of the ONNX OperatorSet is being imported.");
   }
 
-  if (!model_proto.has_ir_version() || model_proto.ir_version() > ONNX_NAMESPACE::Version::IR_VERSION) {
+  if (!model_proto_->has_ir_version() || model_proto_->ir_version() > ONNX_NAMESPACE::Version::IR_VERSION) {
     ORT_THROW("Unknown model file format version.");
   }
 
-  model_proto_ = std::move(model_proto);
-  for (auto& prop : model_proto_.metadata_props()) {
+  for (auto& prop : model_proto_->metadata_props()) {
     model_metadata_[prop.key()] = prop.value();
   }
 
@@ -129,7 +149,7 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path,
       schema_registry->GetLastReleasedOpsetVersions(false);
 
   std::unordered_map<std::string, int> domain_to_version;
-  for (auto& opSet : model_proto_.opset_import()) {
+  for (auto& opSet : model_proto_->opset_import()) {
     const auto& domain = opSet.domain();
     const auto version = gsl::narrow_cast<int>(opSet.version());
     // empty domain and 'ai.onnx' are equivalent
@@ -164,7 +184,7 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path,
   for (const auto& domain : domain_map) {
     if (domain_to_version.find(domain.first) == domain_to_version.end()) {
       domain_to_version[domain.first] = domain.second;
-      const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_.add_opset_import()};
+      const gsl::not_null<OperatorSetIdProto*> opset_id_proto{model_proto_->add_opset_import()};
       opset_id_proto->set_domain(domain.first);
       opset_id_proto->set_version(domain.second);
     }
@@ -172,74 +192,74 @@ Model::Model(ModelProto&& model_proto, const PathString& model_path,
 
   // create instance. need to call private ctor so can't use make_unique
   GSL_SUPPRESS(r .11)
-  graph_.reset(new Graph(*this, model_proto_.mutable_graph(), domain_to_version, IrVersion(), schema_registry, logger));
+  graph_.reset(new Graph(*this, model_proto_->mutable_graph(), domain_to_version, IrVersion(), schema_registry, logger));
 }
 
 Version Model::IrVersion() const {
-  if (utils::HasIrVersion(model_proto_)) {
-    return model_proto_.ir_version();
+  if (utils::HasIrVersion(*model_proto_)) {
+    return model_proto_->ir_version();
   }
   return kNoVersion;
 }
 
 const std::string Model::ProducerName() const {
-  if (model_proto_.has_producer_name()) {
-    return model_proto_.producer_name();
+  if (model_proto_->has_producer_name()) {
+    return model_proto_->producer_name();
   }
   return std::string();
 }
 
 void Model::SetProducerName(const std::string& producer_name) {
-  model_proto_.set_producer_name(producer_name);
+  model_proto_->set_producer_name(producer_name);
 }
 
 const std::string Model::ProducerVersion() const {
-  if (model_proto_.has_producer_version()) {
-    return model_proto_.producer_version();
+  if (model_proto_->has_producer_version()) {
+    return model_proto_->producer_version();
   }
   return std::string();
 }
 
 void Model::SetProducerVersion(const std::string& producer_version) {
-  model_proto_.set_producer_version(producer_version);
+  model_proto_->set_producer_version(producer_version);
 }
 
 const std::string Model::Domain() const {
-  if (model_proto_.has_domain()) {
-    return model_proto_.domain();
+  if (model_proto_->has_domain()) {
+    return model_proto_->domain();
   }
   return std::string();
 }
 
 void Model::SetDomain(const std::string& domain) {
-  model_proto_.set_domain(domain);
+  model_proto_->set_domain(domain);
 }
 
 Version Model::ModelVersion() const {
-  if (utils::HasModelVersion(model_proto_)) {
-    return model_proto_.model_version();
+  if (utils::HasModelVersion(*model_proto_)) {
+    return model_proto_->model_version();
   }
   return kNoVersion;
 }
 
 void Model::SetModelVersion(onnxruntime::Version version) {
-  model_proto_.set_model_version(version);
+  model_proto_->set_model_version(version);
 }
 
 const std::string Model::DocString() const {
-  if (model_proto_.has_doc_string()) {
-    return model_proto_.doc_string();
+  if (model_proto_->has_doc_string()) {
+    return model_proto_->doc_string();
   }
   return std::string();
 }
 
 void Model::SetDocString(const std::string& doc_string) {
-  model_proto_.set_doc_string(doc_string);
+  model_proto_->set_doc_string(doc_string);
 }
 
 const std::string Model::GraphDocString() const {
-  if (model_proto_.has_graph() && model_proto_.graph().has_doc_string()) {
-    return model_proto_.graph().doc_string();
+  if (model_proto_->has_graph() && model_proto_->graph().has_doc_string()) {
+    return model_proto_->graph().doc_string();
   }
   return std::string();
 }
@@ -265,7 +285,7 @@ ModelProto Model::ToProto() {
   // that returns by value and, therefore, allows us to filter
   // out dense duplicates of sparse initializers and leave the original
   // proto intact.
-  ModelProto result(model_proto_);
+  ModelProto result(*model_proto_);
   const auto& graph = *graph_;
   *(result.mutable_graph()) = graph.ToGraphProto();
   return result;
@@ -462,6 +482,14 @@ Status Model::Save(Model& model, const std::string& file_path) {
   return SaveModel(model, file_path);
 }
 
+Status Model::LoadMetadata(const PathString& file_path, ONNX_NAMESPACE::ModelProto& model_proto) {
+  const auto loader = [&model_proto](int fd) {
+    return Model::LoadMetadata(fd, model_proto);
+  };
+
+  return LoadModelHelper(file_path, loader);
+}
+
 Status Model::LoadFromBytes(int count, void* p_bytes, /*out*/ ONNX_NAMESPACE::ModelProto& model_proto) {
   const bool result = model_proto.ParseFromArray(p_bytes, count);
   if (!result) {
@@ -479,14 +507,17 @@ Status Model::LoadFromBytes(int count, void* p_bytes, /*out*/ std::shared_ptr<Mo
 Status Model::LoadFromBytes(int count, void* p_bytes, const PathString& model_path,
                             std::shared_ptr<Model>& p_model, const IOnnxRuntimeOpSchemaRegistryList* local_registries,
                             const logging::Logger& logger) {
-  ModelProto model_proto;
+  // parse on an arena so the many small ModelProto field allocations come from (and are returned
+  // to) a handful of large blocks owned by the model
+  auto arena = onnxruntime::make_unique<google::protobuf::Arena>();
+  ModelProto& model_proto = *google::protobuf::Arena::CreateMessage<ModelProto>(arena.get());
 
   auto status = LoadFromBytes(count, p_bytes, model_proto);
   if (!status.IsOK()) {
     return status;
   }
 
-  p_model = std::make_shared<Model>(std::move(model_proto), model_path, local_registries, logger);
+  p_model = std::make_shared<Model>(std::move(arena), model_proto, model_path, local_registries, logger);
 
   Graph::ResolveOptions options;
   options.no_proto_sync_required = true;
@@ -533,6 +564,201 @@ Status Model::Load(int fd, ONNX_NAMESPACE::ModelProto& model_proto) {
   return Status::OK();
 }
 
+namespace {
+
+using ::google::protobuf::io::CodedOutputStream;
+using ::google::protobuf::io::StringOutputStream;
+
+// onnx.proto field numbers needed by the metadata-only partial parse in Model::LoadMetadata.
+constexpr int kModelProtoGraphField = 7;               // ModelProto.graph
+constexpr int kGraphProtoInitializerField = 5;         // GraphProto.initializer
+constexpr int kGraphProtoSparseInitializerField = 15;  // GraphProto.sparse_initializer
+constexpr int kSparseTensorProtoValuesField = 1;       // SparseTensorProto.values
+constexpr int kSparseTensorProtoIndicesField = 2;      // SparseTensorProto.indices
+
+// TensorProto fields holding the tensor's payload: float_data(4), int32_data(5), string_data(6),
+// int64_data(7), raw_data(9), double_data(10) and uint64_data(11). Everything else
+// (dims, data_type, name, external_data, ...) is metadata and is kept.
+bool IsTensorProtoPayloadField(int field_number) {
+  return field_number == 4 || field_number == 5 || field_number == 6 || field_number == 7 ||
+         field_number == 9 || field_number == 10 || field_number == 11;
+}
+
+// Skips over one field whose tag has already been consumed, without copying its contents.
+bool SkipWireField(uint32_t tag, CodedInputStream& input) {
+  uint64_t varint;
+  uint32_t length;
+  switch (tag & 0x7) {
+    case 0:  // varint
+      return input.ReadVarint64(&varint);
+    case 1:  // fixed64
+      return input.Skip(8);
+    case 2:  // length-delimited
+      return input.ReadVarint32(&length) && input.Skip(static_cast<int>(length));
+    case 5:  // fixed32
+      return input.Skip(4);
+    default:  // groups are not produced by onnx.proto
+      return false;
+  }
+}
+
+// Copies one field verbatim, tag included. The tag has already been consumed from the input.
+bool CopyWireField(uint32_t tag, CodedInputStream& input, CodedOutputStream& output) {
+  uint64_t varint;
+  uint32_t fixed32;
+  uint32_t length;
+  std::string bytes;
+  output.WriteVarint32(tag);
+  switch (tag & 0x7) {
+    case 0:  // varint
+      if (!input.ReadVarint64(&varint)) return false;
+      output.WriteVarint64(varint);
+      return true;
+    case 1:  // fixed64
+      if (!input.ReadLittleEndian64(&varint)) return false;
+      output.WriteLittleEndian64(varint);
+      return true;
+    case 2:  // length-delimited
+      if (!input.ReadVarint32(&length) || !input.ReadString(&bytes, static_cast<int>(length))) return false;
+      output.WriteVarint32(length);
+      output.WriteString(bytes);
+      return true;
+    case 5:  // fixed32
+      if (!input.ReadLittleEndian32(&fixed32)) return false;
+      output.WriteLittleEndian32(fixed32);
+      return true;
+    default:  // groups are not produced by onnx.proto
+      return false;
+  }
+}
+
+using MessageFilterFn = bool (*)(CodedInputStream& input, CodedOutputStream& output);
+
+// Runs 'filter' over the length-delimited submessage at the current input position,
+// collecting the filtered serialization in 'filtered'.
+bool FilterNestedMessage(CodedInputStream& input, MessageFilterFn filter, std::string& filtered) {
+  uint32_t length;
+  if (!input.ReadVarint32(&length)) return false;
+  const auto limit = input.PushLimit(static_cast<int>(length));
+  bool ok;
+  {
+    StringOutputStream string_output(&filtered);
+    CodedOutputStream coded_output(&string_output);
+    ok = filter(input, coded_output);
+  }
+  input.PopLimit(limit);
+  return ok;
+}
+
+// Copies a TensorProto, dropping its payload fields.
+bool FilterTensorProto(CodedInputStream& input, CodedOutputStream& output) {
+  uint32_t tag;
+  while ((tag = input.ReadTag()) != 0) {
+    if (IsTensorProtoPayloadField(static_cast<int>(tag >> 3))) {
+      if (!SkipWireField(tag, input)) return false;
+    } else if (!CopyWireField(tag, input, output)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Copies a SparseTensorProto, dropping the payloads of its values/indices tensors.
+bool FilterSparseTensorProto(CodedInputStream& input, CodedOutputStream& output) {
+  uint32_t tag;
+  while ((tag = input.ReadTag()) != 0) {
+    const int field_number = static_cast<int>(tag >> 3);
+    if ((field_number == kSparseTensorProtoValuesField || field_number == kSparseTensorProtoIndicesField) &&
+        (tag & 0x7) == 2) {
+      std::string filtered;
+      if (!FilterNestedMessage(input, FilterTensorProto, filtered)) return false;
+      output.WriteVarint32(tag);
+      output.WriteVarint32(static_cast<uint32_t>(filtered.size()));
+      output.WriteString(filtered);
+    } else if (!CopyWireField(tag, input, output)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Copies a GraphProto, dropping the payloads of its initializers and sparse initializers.
+bool FilterGraphProto(CodedInputStream& input, CodedOutputStream& output) {
+  uint32_t tag;
+  while ((tag = input.ReadTag()) != 0) {
+    const int field_number = static_cast<int>(tag >> 3);
+    if (field_number == kGraphProtoInitializerField && (tag & 0x7) == 2) {
+      std::string filtered;
+      if (!FilterNestedMessage(input, FilterTensorProto, filtered)) return false;
+      output.WriteVarint32(tag);
+      output.WriteVarint32(static_cast<uint32_t>(filtered.size()));
+      output.WriteString(filtered);
+    } else if (field_number == kGraphProtoSparseInitializerField && (tag & 0x7) == 2) {
+      std::string filtered;
+      if (!FilterNestedMessage(input, FilterSparseTensorProto, filtered)) return false;
+      output.WriteVarint32(tag);
+      output.WriteVarint32(static_cast<uint32_t>(filtered.size()));
+      output.WriteString(filtered);
+    } else if (!CopyWireField(tag, input, output)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+bool FilterModelProto(CodedInputStream& input, CodedOutputStream& output) {
+  uint32_t tag;
+  while ((tag = input.ReadTag()) != 0) {
+    if (static_cast<int>(tag >> 3) == kModelProtoGraphField && (tag & 0x7) == 2) {
+      std::string filtered;
+      if (!FilterNestedMessage(input, FilterGraphProto, filtered)) return false;
+      output.WriteVarint32(tag);
+      output.WriteVarint32(static_cast<uint32_t>(filtered.size()));
+      output.WriteString(filtered);
+    } else if (!CopyWireField(tag, input, output)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+}  // namespace
+
+Status Model::LoadMetadata(int fd, ONNX_NAMESPACE::ModelProto& model_proto) {
+  if (fd < 0) {
+    return Status(ONNXRUNTIME, INVALID_ARGUMENT, "<fd> less than 0.");
+  }
+
+  size_t file_size = 0;
+  int block_size = -1;
+  Status st = Env::Default().GetFileLength(fd, file_size);
+  if (st.IsOK()) {
+    block_size = std::min(DEFAULT_PROTOBUF_BLOCK_SIZE, static_cast<int>(file_size));
+  }
+  FileInputStream input(fd, block_size);
+  CodedInputStream coded_input(&input);
+  // the skipped initializer payloads still count towards the stream's total-bytes limit,
+  // so lift it the same way a full parse of a large model would have to.
+  coded_input.SetTotalBytesLimit(INT_MAX);
+
+  std::string metadata_bytes;
+  bool ok;
+  {
+    StringOutputStream string_output(&metadata_bytes);
+    CodedOutputStream coded_output(&string_output);
+    ok = FilterModelProto(coded_input, coded_output);
+  }
+  if (!ok || !coded_input.ConsumedEntireMessage() || input.GetErrno() != 0) {
+    return Status(ONNXRUNTIME, INVALID_PROTOBUF, "Protobuf parsing failed.");
+  }
+
+  if (!model_proto.ParseFromArray(metadata_bytes.data(), static_cast<int>(metadata_bytes.size()))) {
+    return Status(ONNXRUNTIME, INVALID_PROTOBUF, "Protobuf parsing failed.");
+  }
+
+  return Status::OK();
+}
+
 Status Model::Load(int fd, std::shared_ptr<Model>& p_model, const IOnnxRuntimeOpSchemaRegistryList* local_registries,
                    const logging::Logger& logger) {
   return Load(fd, PathString{}, p_model, local_registries, logger);
@@ -540,11 +766,14 @@ Status Model::Load(int fd, std::shared_ptr<Model>& p_model, const IOnnxRuntimeOp
 
 Status Model::Load(int fd, const PathString& model_path, std::shared_ptr<Model>& p_model,
                    const IOnnxRuntimeOpSchemaRegistryList* local_registries, const logging::Logger& logger) {
-  ModelProto model_proto;
+  // parse on an arena so the many small ModelProto field allocations come from (and are returned
+  // to) a handful of large blocks owned by the model
+  auto arena = onnxruntime::make_unique<google::protobuf::Arena>();
+  ModelProto& model_proto = *google::protobuf::Arena::CreateMessage<ModelProto>(arena.get());
 
   ORT_RETURN_IF_ERROR(Load(fd, model_proto));
 
-  p_model = std::make_shared<Model>(std::move(model_proto), model_path, local_registries, logger);
+  p_model = std::make_shared<Model>(std::move(arena), model_proto, model_path, local_registries, logger);
 
   Graph::ResolveOptions options;
   options.no_proto_sync_required = true;
@@ -572,18 +801,18 @@ Status Model::Save(Model& model, int p_fd) {
 common::Status Model::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
                                       flatbuffers::Offset<fbs::Model>& fbs_model) const {
   auto producer_name = experimental::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_producer_name(), model_proto_.producer_name());
+      builder, model_proto_->has_producer_name(), model_proto_->producer_name());
   auto producer_version = experimental::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_producer_version(), model_proto_.producer_version());
-  auto domain = builder.CreateSharedString(model_proto_.domain());
+      builder, model_proto_->has_producer_version(), model_proto_->producer_version());
+  auto domain = builder.CreateSharedString(model_proto_->domain());
   auto doc_string = experimental::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_doc_string(), model_proto_.doc_string());
+      builder, model_proto_->has_doc_string(), model_proto_->doc_string());
   auto graph_doc_string = experimental::utils::SaveStringToOrtFormat(
-      builder, model_proto_.has_graph() && model_proto_.graph().has_doc_string(), model_proto_.graph().doc_string());
+      builder, model_proto_->has_graph() && model_proto_->graph().has_doc_string(), model_proto_->graph().doc_string());
 
   std::vector<flatbuffers::Offset<fbs::OperatorSetId>> op_set_ids_vec;
-  op_set_ids_vec.reserve(model_proto_.opset_import().size());
-  for (const auto& entry : model_proto_.opset_import()) {
+  op_set_ids_vec.reserve(model_proto_->opset_import().size());
+  for (const auto& entry : model_proto_->opset_import()) {
     auto op_set_domain = builder.CreateSharedString(entry.domain());
     fbs::OperatorSetIdBuilder ob(builder);
     ob.add_domain(op_set_domain);
@@ -596,12 +825,12 @@ common::Status Model::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
   ORT_RETURN_IF_ERROR(graph_->SaveToOrtFormat(builder, fbs_graph));
 
   fbs::ModelBuilder mb(builder);
-  mb.add_ir_version(model_proto_.ir_version());
+  mb.add_ir_version(model_proto_->ir_version());
   mb.add_opset_import(op_set_ids);
   mb.add_producer_name(producer_name);
   mb.add_producer_version(producer_version);
   mb.add_domain(domain);
-  mb.add_model_version(model_proto_.model_version());
+  mb.add_model_version(model_proto_->model_version());
   mb.add_doc_string(doc_string);
   mb.add_graph_doc_string(graph_doc_string);
   mb.add_graph(fbs_graph);
@@ -615,27 +844,35 @@ common::Status Model::SaveToOrtFormat(flatbuffers::FlatBufferBuilder& builder,
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 Model::Model() : model_path_{} {
+#if !defined(ORT_MINIMAL_BUILD)
+  owned_model_proto_ = onnxruntime::make_unique<ONNX_NAMESPACE::ModelProto>();
+  model_proto_ = owned_model_proto_.get();
+#endif
 }
 
+// defined here as the header only has a forward declaration of google::protobuf::Arena
+Model::~Model() = default;
+
 #if defined(ENABLE_ORT_FORMAT_LOAD)
 common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
 #if !defined(ORT_MINIMAL_BUILD)
                                         const IOnnxRuntimeOpSchemaRegistryList* local_registries,
 #endif
                                         const logging::Logger& logger,
-                                        std::unique_ptr<Model>& model) {
+                                        std::unique_ptr<Model>& model,
+                                        bool can_use_flatbuffer_for_initializers) {
   model.reset(new Model());
 
 #if !defined(ORT_MINIMAL_BUILD)
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, producer_name, fbs_model.producer_name());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, producer_version, fbs_model.producer_version());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, domain, fbs_model.domain());
-  LOAD_STR_FROM_ORT_FORMAT(model->model_proto_, doc_string, fbs_model.doc_string());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), producer_name, fbs_model.producer_name());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), producer_version, fbs_model.producer_version());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), domain, fbs_model.domain());
+  LOAD_STR_FROM_ORT_FORMAT((*model->model_proto_), doc_string, fbs_model.doc_string());
   if (fbs_model.graph_doc_string()) {
-    model->model_proto_.mutable_graph()->set_doc_string(fbs_model.graph_doc_string()->c_str());
+    model->model_proto_->mutable_graph()->set_doc_string(fbs_model.graph_doc_string()->c_str());
   }
-  model->model_proto_.set_model_version(fbs_model.model_version());
-  model->model_proto_.set_ir_version(fbs_model.ir_version());
+  model->model_proto_->set_model_version(fbs_model.model_version());
+  model->model_proto_->set_ir_version(fbs_model.ir_version());
 
   auto schema_registry = std::make_shared<SchemaRegistryManager>();
   if (local_registries != nullptr) {
@@ -661,9 +898,10 @@ common::Status Model::LoadFromOrtFormat(const fbs::Model& fbs_model,
 
 #if !defined(ORT_MINIMAL_BUILD)
   ORT_RETURN_IF_ERROR(Graph::LoadFromOrtFormat(*fbs_graph, *model, domain_to_version, schema_registry, logger,
-                                               model->graph_));
+                                               model->graph_, can_use_flatbuffer_for_initializers));
 #else
-  ORT_RETURN_IF_ERROR(Graph::LoadFromOrtFormat(*fbs_graph, *model, domain_to_version, logger, model->graph_));
+  ORT_RETURN_IF_ERROR(Graph::LoadFromOrtFormat(*fbs_graph, *model, domain_to_version, logger, model->graph_,
+                                               can_use_flatbuffer_for_initializers));
 #endif
   return Status::OK();
 }
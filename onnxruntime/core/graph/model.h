@@ -4,6 +4,7 @@
 #pragma once
 #include <list>
 #include <unordered_map>
+#include <unordered_set>
 #include <memory>
 #include <climits>
 #include <string>
@@ -18,6 +19,12 @@ template <typename T>
 struct Offset;
 }  // namespace flatbuffers
 
+namespace google {
+namespace protobuf {
+class Arena;
+}
+}  // namespace google
+
 namespace onnxruntime {
 
 namespace experimental {
@@ -81,6 +88,16 @@ class Model {
                  const IOnnxRuntimeOpSchemaRegistryList* local_registries,
                  const logging::Logger& logger);
 
+  // NOTE: <model_proto> must have been created on <arena>, which <*this> model takes ownership of.
+  // Parsing the ModelProto on an arena replaces the per-field heap allocations made while loading
+  // a large graph with a few big block allocations, which are released wholesale when the model
+  // is destroyed.
+  explicit Model(std::unique_ptr<google::protobuf::Arena> arena,
+                 ONNX_NAMESPACE::ModelProto& model_proto,
+                 const PathString& model_path,
+                 const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                 const logging::Logger& logger);
+
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 #if !defined(ORT_MINIMAL_BUILD)
@@ -161,6 +178,14 @@ class Model {
   Graph& MainGraph() noexcept;
   const Graph& MainGraph() const noexcept;
 
+  /** Intern a string into the model-level name pool.
+  The returned reference stays valid for the life of the Model, so graphs (including subgraphs,
+  which share the pool) can index names by pointer to the single pooled copy instead of each
+  name-keyed container owning its own duplicate. */
+  const std::string& InternString(const std::string& str) const {
+    return *interned_strings_.insert(str).first;
+  }
+
 #if !defined(ORT_MINIMAL_BUILD)
   // Get model's serialization proto data.
   ONNX_NAMESPACE::ModelProto ToProto();
@@ -185,6 +210,17 @@ class Model {
 
   static common::Status Load(int fd, /*out*/ ONNX_NAMESPACE::ModelProto& model_proto);
 
+  // Parses only the model's metadata: every field of the ModelProto is kept except the payload
+  // fields of the main graph's (sparse) initializers, which are skipped at the wire level instead
+  // of being materialized. The result has each initializer's name/type/dims but none of its data,
+  // so it cannot back a Model for inference; it is intended for cheap signature and opset
+  // inspection of models whose weights dominate the file size. Initializers of subgraphs nested
+  // inside node attributes are not stripped.
+  static common::Status LoadMetadata(const PathString& file_path,
+                                     /*out*/ ONNX_NAMESPACE::ModelProto& model_proto);
+
+  static common::Status LoadMetadata(int fd, /*out*/ ONNX_NAMESPACE::ModelProto& model_proto);
+
   static common::Status Load(int fd, /*out*/ std::shared_ptr<Model>& p_model,
                              const IOnnxRuntimeOpSchemaRegistryList* local_registries,
                              const logging::Logger& logger);
@@ -238,20 +274,37 @@ class Model {
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
 #if defined(ENABLE_ORT_FORMAT_LOAD)
+  // can_use_flatbuffer_for_initializers: suitably aligned initializers reference their payload in
+  // the flatbuffer directly instead of copying it. the caller must keep the flatbuffer bytes alive
+  // for the lifetime of the Model.
   static common::Status LoadFromOrtFormat(const onnxruntime::experimental::fbs::Model& fbs_model,
 #if !defined(ORT_MINIMAL_BUILD)
                                           const IOnnxRuntimeOpSchemaRegistryList* local_registries,
 #endif
                                           const logging::Logger& logger,
-                                          std::unique_ptr<Model>& model);
+                                          std::unique_ptr<Model>& model,
+                                          bool can_use_flatbuffer_for_initializers = false);
 #endif
 
+  ~Model();
+
  private:
   Model();
 
+#if !defined(ORT_MINIMAL_BUILD)
+  // shared tail of the constructors that take a ModelProto. validates the proto pointed to by
+  // model_proto_ and creates the main Graph over it.
+  void InitializeFromModelProto(const IOnnxRuntimeOpSchemaRegistryList* local_registries,
+                                const logging::Logger& logger);
+#endif
+
   // Model data.
 #if !defined(ORT_MINIMAL_BUILD)
-  ONNX_NAMESPACE::ModelProto model_proto_;
+  // when set, the arena owns *model_proto_ and every allocation made while parsing it, and frees
+  // them wholesale when the model is destroyed. otherwise owned_model_proto_ holds the proto.
+  std::unique_ptr<google::protobuf::Arena> arena_;
+  std::unique_ptr<ONNX_NAMESPACE::ModelProto> owned_model_proto_;
+  ONNX_NAMESPACE::ModelProto* model_proto_{nullptr};
 #else
   // properties that would normally come from ModelProto
   std::string producer_version_;
@@ -263,6 +316,11 @@ class Model {
   std::string graph_doc_string_;
 #endif
 
+  // Model-level name pool backing the graphs' name indexes (see InternString). Mutable because
+  // interning is logically a cache fill and graphs only hold a const Model&. Entries are never
+  // removed, which is what makes the returned references safe to key containers with.
+  mutable std::unordered_set<std::string> interned_strings_;
+
   // This is a duplication of <model_proto_.metadata_props()>.
   // It gives better accessibility.
   ModelMetaData model_metadata_;
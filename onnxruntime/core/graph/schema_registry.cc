@@ -161,6 +161,32 @@ void SchemaRegistryManager::RegisterRegistry(std::shared_ptr<IOnnxRuntimeOpSchem
   registries.push_front(registry);
 }
 
+namespace {
+OrtMutex deferred_registration_mutex;
+std::function<void()> deferred_registration_fn;
+std::atomic<bool> deferred_registration_pending{false};
+}  // namespace
+
+void SchemaRegistryManager::SetDeferredRegistrationFn(std::function<void()> fn) {
+  std::lock_guard<OrtMutex> lock(deferred_registration_mutex);
+  deferred_registration_fn = std::move(fn);
+  deferred_registration_pending.store(deferred_registration_fn != nullptr, std::memory_order_release);
+}
+
+void SchemaRegistryManager::EnsureDeferredRegistration() {
+  // fast path: schema queries happen per node during Resolve, so avoid the lock once done
+  if (!deferred_registration_pending.load(std::memory_order_acquire)) {
+    return;
+  }
+
+  std::lock_guard<OrtMutex> lock(deferred_registration_mutex);
+  if (deferred_registration_fn) {
+    deferred_registration_fn();
+    deferred_registration_fn = nullptr;
+  }
+  deferred_registration_pending.store(false, std::memory_order_release);
+}
+
 void SchemaRegistryManager::GetDomainToVersionMapForRegistries(DomainToVersionMap& domain_version_map, bool is_onnx_only) const {
   // Build the map using each of the registries
   for (auto& registry : registries) {
@@ -182,6 +208,8 @@ void SchemaRegistryManager::GetDomainToVersionMapForRegistries(DomainToVersionMa
 }
 
 DomainToVersionMap SchemaRegistryManager::GetLastReleasedOpsetVersions(bool is_onnx_only) const {
+  EnsureDeferredRegistration();
+
   DomainToVersionMap domain_version_map;
   GetDomainToVersionMapForRegistries(domain_version_map, is_onnx_only);
 
@@ -205,6 +233,8 @@ DomainToVersionMap SchemaRegistryManager::GetLastReleasedOpsetVersions(bool is_o
 }
 
 DomainToVersionMap SchemaRegistryManager::GetLatestOpsetVersions(bool is_onnx_only) const {
+  EnsureDeferredRegistration();
+
   DomainToVersionMap domain_version_map;
   GetDomainToVersionMapForRegistries(domain_version_map, is_onnx_only);
 
@@ -248,6 +278,8 @@ void SchemaRegistryManager::GetSchemaAndHistory(
     const std::string& domain,
     const ONNX_NAMESPACE::OpSchema** latest_schema,
     int* earliest_opset_where_unchanged) const {
+  EnsureDeferredRegistration();
+
   // A greedy algorithm is used to search for a schema registration in some registry,
   // while potentially inferring from other registries the allowed schema version
   // given the op-set version.  Each time a registry fails to locate the schema
@@ -116,39 +116,40 @@ PyObject* MakePyObj(const void* data, int32_t type, const vector<int64_t>& dim)
     for (auto d: dim) {
         np_dim.push_back(static_cast<npy_intp>(d));
     }
-    auto pyObj = static_cast<PyObject*>(PyArray_EMPTY(static_cast<int>(np_dim.size()), np_dim.data(), type, 0));
-    auto data_len = std::accumulate(begin(np_dim), end(np_dim),
-                                    static_cast<int64_t>(PyArray_DescrFromType(type)->elsize),
-                                    std::multiplies<int64_t>());
-    auto np_array = reinterpret_cast<PyArrayObject*>(pyObj);
-    memcpy(PyArray_DATA(np_array), data, data_len);
+    // Hand the script a read-only view over the tensor memory instead of a copy.
+    // The view is only valid while the invocation is in flight, so scripts that
+    // need to keep the data beyond the call must copy it themselves.
+    auto pyObj = PyArray_SimpleNewFromData(static_cast<int>(np_dim.size()), np_dim.data(),
+                                           type, const_cast<void*>(data));
+    if (nullptr != pyObj) {
+        PyArray_CLEARFLAGS(reinterpret_cast<PyArrayObject*>(pyObj), NPY_ARRAY_WRITEABLE);
+    }
     return pyObj;
 }
 
-bool ExtractOutput(PyObject*                   pyObj,
-                   vector<unique_ptr<char[]>>& outputs,
-                   vector<int32_t>&            outputs_elem_size,
-                   vector<vector<int64_t>>&    outputs_dim) {
+bool ExtractOutput(PyObject*               pyObj,
+                   size_t                  index,
+                   const PyOpSetOutputFunc& set_output) {
     if (!PyArray_Check(pyObj)) {
         return false;
     }
 
-    outputs_dim.push_back({});
-    auto np_array = reinterpret_cast<PyArrayObject*>(pyObj);
-    outputs_elem_size.push_back(static_cast<int32_t>(PyArray_ITEMSIZE(np_array)));
+    auto np_array = PyArray_GETCONTIGUOUS(reinterpret_cast<PyArrayObject*>(pyObj));
+    if (nullptr == np_array) {
+        return false;
+    }
 
+    vector<int64_t> output_dim;
     for (int i = 0; i < PyArray_NDIM(np_array); ++i) {
-        outputs_dim.back().push_back(PyArray_SHAPE(np_array)[i]);
+        output_dim.push_back(PyArray_SHAPE(np_array)[i]);
     }
 
-    auto data_len = std::accumulate(begin(outputs_dim.back()),
-                                    end(outputs_dim.back()),
-                                    static_cast<int64_t>(outputs_elem_size.back()),
-                                    std::multiplies<int64_t>());
-
-    outputs.push_back(unique_ptr<char[]>(new char[data_len]));
-    memcpy(static_cast<void*>(outputs.back().get()), PyArray_DATA(np_array), data_len);
-    return true;
+    // Write straight from the numpy buffer into the output tensor while the GIL
+    // is still held, skipping the intermediate heap copy.
+    auto ok = set_output(index, static_cast<int32_t>(PyArray_ITEMSIZE(np_array)),
+                         output_dim, PyArray_DATA(np_array));
+    Py_XDECREF(np_array);
+    return ok;
 }
 
 void* PyOpLibProxy::NewInstance(const char* module, const char* class_name, const unordered_map<string, string>& args) {
@@ -185,9 +186,7 @@ bool PyOpLibProxy::InvokePythonFunc(void*                            raw_inst,
                                     const vector<const void*>&       inputs,
                                     const vector<int32_t>&           inputs_type,
                                     const vector<vector<int64_t>>&   inputs_dim,
-                                    vector<unique_ptr<char[]>>&      outputs,
-                                    vector<int32_t>&                 outputs_elem_size,
-                                    vector<vector<int64_t>>&         outputs_dim,
+                                    const PyOpSetOutputFunc&         set_output,
                                     std::function<void(const char*)> logging_func) {
     Scope scope;
     auto instance = static_cast<PyObject*>(raw_inst);
@@ -217,10 +216,10 @@ bool PyOpLibProxy::InvokePythonFunc(void*                            raw_inst,
 
     scope.Add(pyResult);
     if (PyArray_Check(pyResult)) {
-        ExtractOutput(pyResult, outputs, outputs_elem_size, outputs_dim);
+        ExtractOutput(pyResult, 0, set_output);
     } else if (PyTuple_Check(pyResult)) {
         for (int32_t i = 0; i < PyTuple_Size(pyResult); ++i) {
-            if (!ExtractOutput(PyTuple_GetItem(pyResult, i), outputs, outputs_elem_size, outputs_dim)) {
+            if (!ExtractOutput(PyTuple_GetItem(pyResult, i), i, set_output)) {
                 logging_func("InvokePythonFunc: failed to extract output");
                 return false;
             }
@@ -262,9 +261,8 @@ void PyCustomKernel::Compute(OrtKernelContext* context) {
   ORT_ENFORCE(nullptr != context);
   auto inputs_count = (size_t) reinterpret_cast<onnxruntime::OpKernelContextInternal*>(context)->InputCount();
   std::vector<const void*> inputs;
-  std::vector<std::unique_ptr<char[]>> outputs;
-  std::vector<int32_t> inputs_type, outputs_elem_size;
-  std::vector<std::vector<int64_t>> inputs_dim, outputs_dim;
+  std::vector<int32_t> inputs_type;
+  std::vector<std::vector<int64_t>> inputs_dim;
 
   for (size_t i = 0; i < inputs_count; ++i) {
     auto ort_value = ort_.KernelContext_GetInput(context, i);
@@ -273,20 +271,23 @@ void PyCustomKernel::Compute(OrtKernelContext* context) {
     inputs_dim.push_back(const_cast<MLValue*>(ort_value)->Get<Tensor>().Shape().GetDims());
   }
 
+  // Allocates the output tensor and fills it straight from the numpy result while
+  // the invocation still holds the GIL, so each result is copied exactly once.
+  auto set_output = [this, context](size_t index, int32_t elem_size,
+                                    const std::vector<int64_t>& dims, const void* data) {
+    auto ort_output = ort_.KernelContext_GetOutput(context, index, dims.data(), dims.size());
+    auto output_mem_addr = ort_.GetTensorMutableData<char>(ort_output);
+    auto output_len = std::accumulate(begin(dims), end(dims), static_cast<int64_t>(elem_size), std::multiplies<int64_t>());
+    memcpy(output_mem_addr, data, output_len);
+    return true;
+  };
+
   std::string err;
   auto state = PyOpLibProxy::GetInstance().GetGil();
   ORT_ENFORCE(PyOpLibProxy::GetInstance().InvokePythonFunc(instance_, compute_.c_str(), inputs, inputs_type,
-                                                           inputs_dim, outputs, outputs_elem_size,
-                                                           outputs_dim, logging_func_),
+                                                           inputs_dim, set_output, logging_func_),
               PyOpLibProxy::GetInstance().GetLastErrorMessage(err));  //ORT_ENFORCE
   PyOpLibProxy::GetInstance().PutGil(state);
-
-  for (size_t i = 0; i < outputs.size(); ++i) {
-    auto ort_output = ort_.KernelContext_GetOutput(context, i, outputs_dim[i].data(), outputs_dim[i].size());
-    auto output_mem_addr = ort_.GetTensorMutableData<char>(ort_output);
-    auto output_len = std::accumulate(begin(outputs_dim[i]), end(outputs_dim[i]), static_cast<int64_t>(outputs_elem_size[i]), std::multiplies<int64_t>());
-    memcpy(output_mem_addr, outputs[i].get(), output_len);
-  }
 }
 
 int32_t PyCustomKernel::GetType(const OrtValue* input) const {
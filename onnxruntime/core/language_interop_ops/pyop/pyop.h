@@ -18,6 +18,9 @@ namespace onnxruntime {
 using OnnxTypes   = std::vector<ONNXTensorElementDataType>;
 using OnnxAttrs   = std::unordered_map<std::string, std::string>;
 using PyOpLogFunc = std::function<void(const char*)>;
+// Called once per output while the GIL is held, with the output index, element size,
+// dimensions and a pointer to the (contiguous) numpy buffer to copy from.
+using PyOpSetOutputFunc = std::function<bool(size_t, int32_t, const std::vector<int64_t>&, const void*)>;
 
 class PyOpLibProxy {
 
@@ -29,9 +32,7 @@ public:
                           const std::vector<const void*>&,
                           const std::vector<int32_t>&,
                           const std::vector<std::vector<int64_t>>&,
-                          std::vector<std::unique_ptr<char[]>>&,
-                          std::vector<int32_t>&,
-                          std::vector<std::vector<int64_t>>&,
+                          const PyOpSetOutputFunc&,
                           std::function<void(const char*)>);
     const char* GetLastErrorMessage(std::string&);
     void* NewInstance(const char*, const char*, const OnnxAttrs&);
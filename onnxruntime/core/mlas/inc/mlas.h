@@ -113,6 +113,7 @@ enum MLAS_ACTIVATION_KIND {
     MlasTanhActivation,
     MlasLogisticActivation,
     MlasClipActivation,
+    MlasHardSigmoidActivation,
 };
 
 struct MLAS_ACTIVATION {
@@ -125,6 +126,10 @@ struct MLAS_ACTIVATION {
             float minimum;
             float maximum;
         } Clip;
+        struct {
+            float alpha;
+            float beta;
+        } HardSigmoid;
         float Values[2];
     } Parameters;
 };
@@ -140,9 +145,74 @@ MlasActivation(
     size_t ldc
     );
 
+//
+// Element-wise variant of the activation routines reading from a source
+// buffer, for use by standalone activation operators.  Input and Output may
+// be the same buffer.
+//
+
+void
+MLASCALL
+MlasComputeActivation(
+    const MLAS_ACTIVATION* Activation,
+    const float* Input,
+    float* Output,
+    size_t N
+    );
+
 //
 // Matrix/matrix multiply routines.
 //
+// The optional output processor is invoked on each tile of the output matrix
+// after its values are final, while the data is still hot in the cache. This
+// fuses epilogues such as bias addition, residual addition and activations
+// into the multiply and avoids a second pass over the output tensor.
+//
+
+class MLAS_SGEMM_OUTPUT_PROCESSOR {
+public:
+    virtual
+    void
+    Process(
+        float*,         // Supplies the address of the output tile to process
+        size_t,         // Supplies the start row index of the tile
+        size_t,         // Supplies the start col index of the tile
+        size_t,         // Supplies the element count per row to process
+        size_t,         // Supplies the element count per col to process
+        size_t          // Supplies the leading dimension of matrix
+        ) const = 0;
+};
+
+class MLAS_SGEMM_ACTIVATION_OUTPUT_PROCESSOR : public MLAS_SGEMM_OUTPUT_PROCESSOR {
+public:
+    MLAS_SGEMM_ACTIVATION_OUTPUT_PROCESSOR(
+        const MLAS_ACTIVATION* Activation,
+        const float* Bias = nullptr,
+        const float* AddSource = nullptr,
+        size_t LeadingDimensionAddSource = 0) :
+            Activation_(Activation),
+            Bias_(Bias),
+            AddSource_(AddSource),
+            LeadingDimensionAddSource_(LeadingDimensionAddSource)
+    {
+    }
+
+    void
+    Process(
+        float* C,
+        size_t StartM,
+        size_t StartN,
+        size_t CountM,
+        size_t CountN,
+        size_t ldc
+        ) const override;
+
+private:
+    const MLAS_ACTIVATION* Activation_;
+    const float* Bias_;     // per-row bias, indexed by the tile row
+    const float* AddSource_;
+    size_t LeadingDimensionAddSource_;
+};
 
 void
 MLASCALL
@@ -160,7 +230,8 @@ MlasGemm(
     float beta,
     float* C,
     size_t ldc,
-    MLAS_THREADPOOL* ThreadPool
+    MLAS_THREADPOOL* ThreadPool,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor = nullptr
     );
 
 void
@@ -177,6 +248,37 @@ MlasGemm(
     float beta,
     float* C,
     size_t ldc,
+    MLAS_THREADPOOL* ThreadPool,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor = nullptr
+    );
+
+//
+// Batched matrix/matrix multiply of identically shaped matrices, scheduled as
+// a single pass over the thread pool. The strides are in elements between
+// consecutive matrices; a zero StrideB multiplies every A matrix against the
+// same B matrix.
+//
+
+void
+MLASCALL
+MlasGemmBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    size_t StrideA,
+    const float* B,
+    size_t ldb,
+    size_t StrideB,
+    float beta,
+    float* C,
+    size_t ldc,
+    size_t StrideC,
+    size_t BatchSize,
     MLAS_THREADPOOL* ThreadPool
     );
 
@@ -351,6 +453,51 @@ MlasGemmPackB(
     void* PackedB
     );
 
+//
+// Block sparse matrix/matrix multiply routines.
+//
+// MlasSparseGemmPackBSize returns zero when the matrix is not sparse enough
+// for the sparse path to outperform the dense SGEMM kernels.
+//
+
+size_t
+MLASCALL
+MlasSparseGemmPackBSize(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb
+    );
+
+void
+MLASCALL
+MlasSparseGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB
+    );
+
+void
+MLASCALL
+MlasSparseGemm(
+    CBLAS_TRANSPOSE TransA,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    float beta,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Convolution routines.
 //
@@ -359,6 +506,7 @@ enum MLAS_CONV_ALGORITHM {
     MlasConvAlgorithmGemmDirect,
     MlasConvAlgorithmExpandThenGemm,
     MlasConvAlgorithmExpandThenGemmSegmented,
+    MlasConvAlgorithmWinograd,
 };
 
 struct MLAS_CONV_PARAMETERS {
@@ -387,6 +535,9 @@ struct MLAS_CONV_PARAMETERS {
         struct {
             size_t ThreadStrideN;
         } ExpandThenGemmSegmented;
+        struct {
+            size_t TileCountBlock;
+        } Winograd;
     } u;
 };
 
@@ -511,6 +662,22 @@ MlasComputeSoftmax(
     MLAS_THREADPOOL* ThreadPool
     );
 
+void
+MLASCALL
+MlasComputeLayerNorm(
+    const float* Input,
+    const float* Scale,
+    const float* Bias,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t N,
+    size_t D,
+    float Epsilon,
+    bool SimplifiedLayerNorm,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 void
 MLASCALL
 MlasComputeTanh(
@@ -532,9 +699,98 @@ MlasConvertHalfToFloatBuffer(
     size_t Count
     );
 
+extern "C"
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    );
+
+//
+// Half-precision matrix/matrix multiply routine. Processors with native
+// half precision arithmetic run an FP16 kernel; other processors convert
+// panels of the operands and accumulate with the single precision kernels,
+// so it works on any processor. MlasFp16AccelerationSupported reports
+// whether the processor has the native instructions.
+//
+
+bool
+MLASCALL
+MlasFp16AccelerationSupported(
+    void
+    );
+
+void
+MLASCALL
+MlasHalfGemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    const uint16_t* A,
+    size_t lda,
+    const uint16_t* B,
+    size_t ldb,
+    uint16_t* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+//
+// bfloat16 floating-point routines. The matrix/matrix multiply converts
+// panels of the bfloat16 operands and accumulates with the single precision
+// kernels, so it works on any processor; MlasBf16AccelerationSupported
+// reports whether the processor also has native bfloat16 instructions.
+//
+
+bool
+MLASCALL
+MlasBf16AccelerationSupported(
+    void
+    );
+
+void
+MLASCALL
+MlasConvertFloatToBFloat16(
+    const float* Source,
+    uint16_t* Destination,
+    size_t Count
+    );
+
+void
+MLASCALL
+MlasConvertBFloat16ToFloat(
+    const uint16_t* Source,
+    float* Destination,
+    size_t Count
+    );
+
+void
+MLASCALL
+MlasGemm(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const uint16_t* A,
+    size_t lda,
+    const uint16_t* B,
+    size_t ldb,
+    float beta,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Transpose routines.
 //
+// The overloads taking a MLAS_THREADPOOL* optionally spread the work across
+// multiple threads for large matrices.
+//
 
 void
 MLASCALL
@@ -545,6 +801,35 @@ MlasTranspose(
     size_t N
     );
 
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 void
 MLASCALL
 MlasTranspose(
@@ -554,6 +839,35 @@ MlasTranspose(
     size_t N
     );
 
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    uint64_t* Output,
+    size_t M,
+    size_t N
+    );
+
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    uint64_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 //
 // Buffer reordering routines.
 //
@@ -563,7 +877,8 @@ MLASCALL
 MlasReorderInput(
     const int64_t* InputShape,
     const float* S,
-    float* D
+    float* D,
+    MLAS_THREADPOOL* ThreadPool
     );
 
 void
@@ -571,7 +886,8 @@ MLASCALL
 MlasReorderOutputNchw(
     const int64_t* OutputShape,
     const float* S,
-    float* D
+    float* D,
+    MLAS_THREADPOOL* ThreadPool
     );
 
 void
@@ -666,6 +982,18 @@ MlasQuantizeLinear(
     OutputType ZeroPoint
     );
 
+template<typename OutputType>
+void
+MLASCALL
+MlasQuantizeLinear(
+    const float* Input,
+    OutputType* Output,
+    size_t N,
+    float Scale,
+    OutputType ZeroPoint,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 void
 MLASCALL
 MlasRequantizeOutput(
@@ -688,6 +1016,16 @@ MlasFindMinMaxElement(
     size_t N
     );
 
+void
+MLASCALL
+MlasFindMinMaxElement(
+    const float* Input,
+    float* Min,
+    float* Max,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
 size_t
 MLASCALL
 MlasQLinearSafePaddingElementCount(
@@ -193,6 +193,44 @@ struct MLAS_ACTIVATION_FUNCTION<MlasClipActivation>
     }
 };
 
+template<>
+struct MLAS_ACTIVATION_FUNCTION<MlasHardSigmoidActivation>
+{
+    const MLAS_FLOAT32X4 ZeroFloat32x4 = MlasZeroFloat32x4();
+    const MLAS_FLOAT32X4 OneFloat32x4 = MlasBroadcastFloat32x4(1.0f);
+
+    MLAS_FLOAT32X4 AlphaBroadcast;
+    MLAS_FLOAT32X4 BetaBroadcast;
+
+    MLAS_ACTIVATION_FUNCTION(const MLAS_ACTIVATION* Activation)
+    {
+        AlphaBroadcast = MlasBroadcastFloat32x4(&Activation->Parameters.HardSigmoid.alpha);
+        BetaBroadcast = MlasBroadcastFloat32x4(&Activation->Parameters.HardSigmoid.beta);
+    }
+
+    MLAS_FLOAT32X4 Activate(MLAS_FLOAT32X4 Value)
+    {
+        Value = MlasMultiplyAddFloat32x4(Value, AlphaBroadcast, BetaBroadcast);
+        Value = MlasMaximumFloat32x4(ZeroFloat32x4, Value);
+        Value = MlasMinimumFloat32x4(OneFloat32x4, Value);
+
+        return Value;
+    }
+
+    float Activate(float Value)
+    {
+#if defined(MLAS_SSE2_INTRINSICS)
+        return _mm_cvtss_f32(Activate(_mm_set_ss(Value)));
+#else
+        Value = Value * MlasExtractLaneFloat32x4<0>(AlphaBroadcast) + MlasExtractLaneFloat32x4<0>(BetaBroadcast);
+        Value = std::max(Value, 0.0f);
+        Value = std::min(Value, 1.0f);
+
+        return Value;
+#endif
+    }
+};
+
 template<MLAS_ACTIVATION_KIND ActivationKind, bool AddBias>
 void
 MlasActivationKernel(
@@ -464,5 +502,213 @@ Return Value:
             MlasActivationKernel<MlasClipActivation>(Activation, Buffer, Bias, M, N, ldc);
             break;
         }
+
+        case MlasHardSigmoidActivation:
+        {
+            MlasActivationKernel<MlasHardSigmoidActivation>(Activation, Buffer, Bias, M, N, ldc);
+            break;
+        }
+    }
+}
+
+template<MLAS_ACTIVATION_KIND ActivationKind>
+void
+MlasActivationElementwiseKernel(
+    const MLAS_ACTIVATION* Activation,
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine steps over the input buffer and invokes the templated
+    activation function, writing the results to the output buffer.
+
+Arguments:
+
+    Activation - Supplies the parameters for the activation.
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.  May be the same as the input
+        buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_ACTIVATION_FUNCTION<ActivationKind> ActivationFunction(Activation);
+
+    while (N >= 4) {
+
+        MlasStoreFloat32x4(Output, ActivationFunction.Activate(MlasLoadFloat32x4(Input)));
+        Input += 4;
+        Output += 4;
+        N -= 4;
+    }
+
+    while (N > 0) {
+
+        *Output++ = ActivationFunction.Activate(*Input++);
+        N -= 1;
     }
 }
+
+void
+MLASCALL
+MlasComputeActivation(
+    const MLAS_ACTIVATION* Activation,
+    const float* Input,
+    float* Output,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine applies an activation function element-wise, reading from
+    the input buffer and writing to the output buffer.
+
+Arguments:
+
+    Activation - Supplies the parameters for the activation.
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.  May be the same as the input
+        buffer.
+
+    N - Supplies the number of elements to process.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    switch (Activation->ActivationKind) {
+
+        case MlasIdentityActivation:
+        {
+            if (Input != Output) {
+                memcpy(Output, Input, N * sizeof(float));
+            }
+            break;
+        }
+
+        case MlasReluActivation:
+        {
+            MlasActivationElementwiseKernel<MlasReluActivation>(Activation, Input, Output, N);
+            break;
+        }
+
+        case MlasLeakyReluActivation:
+        {
+            MlasActivationElementwiseKernel<MlasLeakyReluActivation>(Activation, Input, Output, N);
+            break;
+        }
+
+        case MlasTanhActivation:
+        {
+            MlasComputeTanh(Input, Output, N);
+            break;
+        }
+
+        case MlasLogisticActivation:
+        {
+            MlasComputeLogistic(Input, Output, N);
+            break;
+        }
+
+        case MlasClipActivation:
+        {
+            MlasActivationElementwiseKernel<MlasClipActivation>(Activation, Input, Output, N);
+            break;
+        }
+
+        case MlasHardSigmoidActivation:
+        {
+            MlasActivationElementwiseKernel<MlasHardSigmoidActivation>(Activation, Input, Output, N);
+            break;
+        }
+    }
+}
+
+void
+MLAS_SGEMM_ACTIVATION_OUTPUT_PROCESSOR::Process(
+    float* C,
+    size_t StartM,
+    size_t StartN,
+    size_t CountM,
+    size_t CountN,
+    size_t ldc
+    ) const
+/*++
+
+Routine Description:
+
+    This routine applies the fused GEMM epilogue to a completed tile of the
+    output matrix: the optional residual source is accumulated to the tile
+    and the activation function with optional per-row bias is then applied
+    in place.
+
+Arguments:
+
+    C - Supplies the address of the output tile to process.
+
+    StartM - Supplies the row position of the tile within the full output
+        matrix.
+
+    StartN - Supplies the column position of the tile within the full output
+        matrix.
+
+    CountM - Supplies the number of rows of the tile.
+
+    CountN - Supplies the number of columns of the tile.
+
+    ldc - Supplies the leading dimension of the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (AddSource_ != nullptr) {
+
+        const float* addSource = AddSource_ + StartM * LeadingDimensionAddSource_ + StartN;
+        float* buffer = C;
+
+        for (size_t m = 0; m < CountM; m++) {
+
+            size_t n = CountN;
+            float* c = buffer;
+            const float* a = addSource;
+
+            while (n >= 4) {
+                MlasStoreFloat32x4(c, MlasAddFloat32x4(MlasLoadFloat32x4(c), MlasLoadFloat32x4(a)));
+                c += 4;
+                a += 4;
+                n -= 4;
+            }
+
+            while (n > 0) {
+                *c++ += *a++;
+                n -= 1;
+            }
+
+            buffer += ldc;
+            addSource += LeadingDimensionAddSource_;
+        }
+    }
+
+    const float* Bias = (Bias_ != nullptr) ? Bias_ + StartM : nullptr;
+
+    MlasActivation(Activation_, C, Bias, CountM, CountN, ldc);
+}
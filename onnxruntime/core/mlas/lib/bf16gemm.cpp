@@ -0,0 +1,484 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    bf16gemm.cpp
+
+Abstract:
+
+    This module implements the bfloat16 matrix/matrix multiply operation and
+    the supporting conversion routines between single precision and bfloat16.
+
+    The operation converts panels of the bfloat16 operands to single precision
+    and reuses the platform single precision kernels with float accumulation,
+    which halves the memory traffic of the operands relative to a float GEMM.
+    Processors with native bfloat16 dot product support can supply a faster
+    operation through the platform dispatch.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the parameters to execute segments of a bfloat16 GEMM operation on
+// worker threads.
+//
+
+struct MLAS_BF16GEMM_WORK_BLOCK {
+    int32_t ThreadCountM;
+    CBLAS_TRANSPOSE TransA;
+    CBLAS_TRANSPOSE TransB;
+    size_t M;
+    size_t N;
+    size_t K;
+    const uint16_t* A;
+    size_t lda;
+    const uint16_t* B;
+    size_t ldb;
+    float* C;
+    size_t ldc;
+    float alpha;
+    float beta;
+};
+
+//
+// Define the panel sizes used to convert the bfloat16 operands to single
+// precision stack buffers.
+//
+
+#define MLAS_BF16GEMM_STRIDEM               32
+#define MLAS_BF16GEMM_STRIDEN               64
+#define MLAS_BF16GEMM_STRIDEK               128
+
+void
+MLASCALL
+MlasConvertFloatToBFloat16(
+    const float* Source,
+    uint16_t* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a buffer of single precision values to bfloat16
+    using round to nearest even.
+
+Arguments:
+
+    Source - Supplies the buffer of single precision values.
+
+    Destination - Supplies the buffer to receive the bfloat16 values.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count > 0) {
+
+        uint32_t Bits;
+        memcpy(&Bits, Source, sizeof(uint32_t));
+
+        if ((Bits & 0x7FFFFFFF) > 0x7F800000) {
+
+            //
+            // Preserve NaN values with the quiet bit forced on, else the
+            // rounding below could overflow the mantissa into the exponent
+            // and produce an infinity.
+            //
+
+            *Destination = uint16_t((Bits >> 16) | 0x0040);
+
+        } else {
+
+            const uint32_t LowHalfLsb = (Bits >> 16) & 1;
+            *Destination = uint16_t((Bits + 0x7FFF + LowHalfLsb) >> 16);
+        }
+
+        Source += 1;
+        Destination += 1;
+        Count -= 1;
+    }
+}
+
+void
+MLASCALL
+MlasConvertBFloat16ToFloat(
+    const uint16_t* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a buffer of bfloat16 values to single precision.
+
+Arguments:
+
+    Source - Supplies the buffer of bfloat16 values.
+
+    Destination - Supplies the buffer to receive the single precision values.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (Count > 0) {
+
+        const uint32_t Bits = uint32_t(*Source) << 16;
+        memcpy(Destination, &Bits, sizeof(uint32_t));
+
+        Source += 1;
+        Destination += 1;
+        Count -= 1;
+    }
+}
+
+bool
+MLASCALL
+MlasBf16AccelerationSupported(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine reports whether the processor supports native bfloat16
+    acceleration (AVX512-BF16). The bfloat16 GEMM works on any processor, but
+    callers can use this to decide whether demoting operands is profitable.
+
+Arguments:
+
+    None.
+
+Return Value:
+
+    Returns true if the processor supports native bfloat16 instructions.
+
+--*/
+{
+#if defined(MLAS_TARGET_AMD64)
+    return MlasPlatform.Bf16Supported != 0;
+#else
+    return false;
+#endif
+}
+
+void
+MlasBf16GemmConvertPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t CountK,
+    size_t CountN,
+    const uint16_t* B,
+    size_t ldb,
+    float* PanelB
+    )
+/*++
+
+Routine Description:
+
+    This routine converts a panel of the bfloat16 matrix B to a row major
+    single precision buffer.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    CountK - Supplies the number of rows of the panel.
+
+    CountN - Supplies the number of columns of the panel.
+
+    B - Supplies the address of the panel inside matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    PanelB - Supplies the buffer to receive the converted panel, stored with a
+        leading dimension of CountN.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (TransB == CblasNoTrans) {
+
+        for (size_t k = 0; k < CountK; k++) {
+            MlasConvertBFloat16ToFloat(B + k * ldb, PanelB + k * CountN, CountN);
+        }
+
+    } else {
+
+        for (size_t k = 0; k < CountK; k++) {
+
+            for (size_t n = 0; n < CountN; n++) {
+                const uint32_t Bits = uint32_t(B[n * ldb + k]) << 16;
+                memcpy(&PanelB[k * CountN + n], &Bits, sizeof(uint32_t));
+            }
+        }
+    }
+}
+
+void
+MlasBf16GemmOperation(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const uint16_t* A,
+    size_t lda,
+    const uint16_t* B,
+    size_t ldb,
+    float beta,
+    float* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single-threaded bfloat16 matrix/matrix
+    multiply operation with float accumulation.
+
+Arguments:
+
+    See MlasGemm.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_DECLSPEC_ALIGN(float PanelA[MLAS_BF16GEMM_STRIDEM * MLAS_BF16GEMM_STRIDEK], 64);
+    MLAS_DECLSPEC_ALIGN(float PanelB[MLAS_BF16GEMM_STRIDEK * MLAS_BF16GEMM_STRIDEN], 64);
+
+    for (size_t n = 0; n < N; n += MLAS_BF16GEMM_STRIDEN) {
+
+        const size_t CountN = std::min(N - n, size_t(MLAS_BF16GEMM_STRIDEN));
+
+        for (size_t k = 0; k < K; k += MLAS_BF16GEMM_STRIDEK) {
+
+            const size_t CountK = std::min(K - k, size_t(MLAS_BF16GEMM_STRIDEK));
+
+            //
+            // Accumulate into C after the first panel of the K dimension has
+            // applied the caller's beta.
+            //
+
+            const float PanelBeta = (k == 0) ? beta : 1.0f;
+
+            const uint16_t* b = (TransB == CblasNoTrans) ? (B + k * ldb + n) : (B + n * ldb + k);
+
+            MlasBf16GemmConvertPackB(TransB, CountK, CountN, b, ldb, PanelB);
+
+            for (size_t m = 0; m < M; m += MLAS_BF16GEMM_STRIDEM) {
+
+                const size_t CountM = std::min(M - m, size_t(MLAS_BF16GEMM_STRIDEM));
+
+                //
+                // Convert the panel of matrix A to a row major buffer.
+                //
+
+                if (TransA == CblasNoTrans) {
+
+                    for (size_t mm = 0; mm < CountM; mm++) {
+                        MlasConvertBFloat16ToFloat(A + (m + mm) * lda + k, PanelA + mm * CountK, CountK);
+                    }
+
+                } else {
+
+                    for (size_t mm = 0; mm < CountM; mm++) {
+
+                        for (size_t kk = 0; kk < CountK; kk++) {
+                            const uint32_t Bits = uint32_t(A[(k + kk) * lda + (m + mm)]) << 16;
+                            memcpy(&PanelA[mm * CountK + kk], &Bits, sizeof(uint32_t));
+                        }
+                    }
+                }
+
+                MlasSgemmOperation(CblasNoTrans, CblasNoTrans, CountM, CountN, CountK, alpha,
+                    PanelA, CountK, PanelB, CountN, PanelBeta, C + m * ldc + n, ldc);
+            }
+        }
+    }
+}
+
+void
+MlasBf16GemmThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    bfloat16 GEMM operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_BF16GEMM_WORK_BLOCK*)Context;
+
+    //
+    // Partition the operation along the M dimension.
+    //
+
+    size_t RangeStartM;
+    size_t RangeCountM;
+
+    MlasPartitionWork(ThreadId, WorkBlock->ThreadCountM, WorkBlock->M, &RangeStartM, &RangeCountM);
+
+    const CBLAS_TRANSPOSE TransA = WorkBlock->TransA;
+
+    const uint16_t* A = WorkBlock->A + RangeStartM * ((TransA == CblasNoTrans) ? WorkBlock->lda : 1);
+    float* C = WorkBlock->C + RangeStartM * WorkBlock->ldc;
+
+    MlasBf16GemmOperation(TransA, WorkBlock->TransB, RangeCountM, WorkBlock->N, WorkBlock->K,
+        WorkBlock->alpha, A, WorkBlock->lda, WorkBlock->B, WorkBlock->ldb, WorkBlock->beta,
+        C, WorkBlock->ldc);
+}
+
+void
+MLASCALL
+MlasGemm(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const uint16_t* A,
+    size_t lda,
+    const uint16_t* B,
+    size_t ldb,
+    float beta,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the bfloat16 matrix/matrix multiply operation
+    with single precision accumulation and output.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for matrix A.
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    A - Supplies the address of matrix A as bfloat16 values.
+
+    lda - Supplies the first dimension of matrix A.
+
+    B - Supplies the address of matrix B as bfloat16 values.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    beta - Supplies the scalar beta multiplier (see SGEMM definition).
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_BF16GEMM_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the GEMM parameters to the work block.
+    //
+
+    memset(&WorkBlock, 0, sizeof(MLAS_BF16GEMM_WORK_BLOCK));
+
+    WorkBlock.TransA = TransA;
+    WorkBlock.TransB = TransB;
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+    WorkBlock.K = K;
+    WorkBlock.A = A;
+    WorkBlock.lda = lda;
+    WorkBlock.B = B;
+    WorkBlock.ldb = ldb;
+    WorkBlock.C = C;
+    WorkBlock.ldc = ldc;
+    WorkBlock.alpha = alpha;
+    WorkBlock.beta = beta;
+
+    //
+    // Compute the number of target threads given the complexity of the GEMM
+    // operation. Small requests should run using the single threaded path.
+    //
+
+    const double Complexity = double(M) * double(N) * double(K);
+
+    int32_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = int32_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    //
+    // Segment the operation across multiple threads along the M dimension.
+    //
+
+    if (size_t(TargetThreadCount) > M) {
+        TargetThreadCount = int32_t(std::max(M, size_t(1)));
+    }
+
+    WorkBlock.ThreadCountM = TargetThreadCount;
+
+    MlasExecuteThreaded(MlasBf16GemmThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+}
@@ -23,6 +23,13 @@ Abstract:
 #define MLAS_CONV_WORKING_BUFFER_SIZE_PER_THREAD \
     (MLAS_SGEMM_STRIDEN * MLAS_SGEMM_STRIDEK)
 
+//
+// Define the number of 2x2 output tiles processed per block of the Winograd
+// F(2x2,3x3) algorithm, which bounds the transformed input/output buffers.
+//
+
+#define MLAS_CONV_WINOGRAD_TILE_BLOCK       128
+
 //
 // Define the parameters to execute segments of a convolution operation on
 // worker threads.
@@ -713,26 +720,22 @@ Return Value:
         const float* filter = WorkBlock->Filter + group * FilterGroupSize;
         float* output = WorkBlock->Output + bg * OutputGroupSize;
 
-        //
-        // Invoke the non-threaded GEMM directly with the input tensor.
-        //
-
-        MlasSgemmOperation(CblasNoTrans, Parameters->u.GemmDirect.TransB, FilterCount,
-            OutputSize, K, 1.0f, filter, K, input, Parameters->u.GemmDirect.ldb, 0.0f,
-            output, OutputSize);
-
-        //
-        // Apply the activation with optional bias.
-        //
-
         const float* bias = WorkBlock->Bias;
 
         if (bias != nullptr) {
             bias += group * FilterCount;
         }
 
-        MlasActivation(Parameters->Activation, output, bias, FilterCount,
-            OutputSize, OutputSize);
+        //
+        // Invoke the non-threaded GEMM directly with the input tensor, with
+        // the activation and optional bias fused into the GEMM epilogue.
+        //
+
+        MLAS_SGEMM_ACTIVATION_OUTPUT_PROCESSOR ActivationProcessor(Parameters->Activation, bias);
+
+        MlasSgemmOperation(CblasNoTrans, Parameters->u.GemmDirect.TransB, FilterCount,
+            OutputSize, K, 1.0f, filter, K, input, Parameters->u.GemmDirect.ldb, 0.0f,
+            output, OutputSize, &ActivationProcessor);
     }
 }
 
@@ -826,6 +829,279 @@ Return Value:
     return true;
 }
 
+void
+MlasConvWinogradWeightTransform(
+    size_t FilterCount,
+    size_t InputChannels,
+    const float* Filter,
+    float* U
+    )
+/*++
+
+Routine Description:
+
+    This routine transforms the 3x3 filters to the 4x4 Winograd F(2x2,3x3)
+    domain: U = G g G'. The transformed weights are stored with the transform
+    point as the outermost dimension so each point is a FilterCount by
+    InputChannels matrix ready for the batched GEMM.
+
+Arguments:
+
+    FilterCount - Supplies the number of filters.
+
+    InputChannels - Supplies the number of input channels.
+
+    Filter - Supplies the filter tensor (FilterCount x InputChannels x 3 x 3).
+
+    U - Supplies the buffer to receive the transformed weights
+        (16 x FilterCount x InputChannels).
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t KC = FilterCount * InputChannels;
+
+    for (size_t k = 0; k < FilterCount; k++) {
+
+        for (size_t c = 0; c < InputChannels; c++) {
+
+            const float* g = Filter + (k * InputChannels + c) * 9;
+
+            //
+            // Compute T = G g (4x3 intermediate).
+            //
+
+            float T[4][3];
+
+            for (size_t j = 0; j < 3; j++) {
+
+                const float g0 = g[j];
+                const float g1 = g[3 + j];
+                const float g2 = g[6 + j];
+
+                T[0][j] = g0;
+                T[1][j] = 0.5f * (g0 + g1 + g2);
+                T[2][j] = 0.5f * (g0 - g1 + g2);
+                T[3][j] = g2;
+            }
+
+            //
+            // Compute U = T G' and scatter to the transform point matrices.
+            //
+
+            float* u = U + k * InputChannels + c;
+
+            for (size_t i = 0; i < 4; i++) {
+
+                const float t0 = T[i][0];
+                const float t1 = T[i][1];
+                const float t2 = T[i][2];
+
+                u[(i * 4 + 0) * KC] = t0;
+                u[(i * 4 + 1) * KC] = 0.5f * (t0 + t1 + t2);
+                u[(i * 4 + 2) * KC] = 0.5f * (t0 - t1 + t2);
+                u[(i * 4 + 3) * KC] = t2;
+            }
+        }
+    }
+}
+
+void
+MlasConvWinogradOperation(
+    const MLAS_CONV_PARAMETERS* Parameters,
+    const float* Input,
+    const float* U,
+    float* V,
+    float* M,
+    float* Output,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the Winograd F(2x2,3x3) convolution for a single
+    batch and group using pre-transformed weights. Blocks of 2x2 output tiles
+    are gathered to the transform domain, multiplied with a batched GEMM over
+    the sixteen transform points, and scattered back.
+
+Arguments:
+
+    Parameters - Supplies the structure that contains the convolution
+        parameters.
+
+    Input - Supplies the input tensor for this group.
+
+    U - Supplies the transformed weights (16 x FilterCount x InputChannels).
+
+    V - Supplies the buffer for the transformed input
+        (16 x InputChannels x TileCountBlock).
+
+    M - Supplies the buffer for the transformed output
+        (16 x FilterCount x TileCountBlock).
+
+    Output - Supplies the output tensor for this group.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t InputChannels = Parameters->InputChannels;
+    const size_t FilterCount = Parameters->FilterCount;
+
+    const size_t InputHeight = Parameters->InputShape[0];
+    const size_t InputWidth = Parameters->InputShape[1];
+    const size_t OutputHeight = Parameters->OutputShape[0];
+    const size_t OutputWidth = Parameters->OutputShape[1];
+
+    const size_t PaddingTop = Parameters->Padding[0];
+    const size_t PaddingLeft = Parameters->Padding[1];
+
+    const size_t InputSize = Parameters->InputSize;
+    const size_t OutputSize = Parameters->OutputSize;
+
+    const size_t TileColumns = (OutputWidth + 1) / 2;
+    const size_t TileRows = (OutputHeight + 1) / 2;
+    const size_t TileCount = TileRows * TileColumns;
+
+    const size_t TileCountBlock = Parameters->u.Winograd.TileCountBlock;
+
+    for (size_t p = 0; p < TileCount; p += TileCountBlock) {
+
+        const size_t CountP = std::min(TileCount - p, TileCountBlock);
+
+        //
+        // Gather and transform a block of input tiles: V = B' d B.
+        //
+
+        for (size_t c = 0; c < InputChannels; c++) {
+
+            const float* input = Input + c * InputSize;
+
+            for (size_t pp = 0; pp < CountP; pp++) {
+
+                const size_t TileIndex = p + pp;
+                const int64_t ih0 = int64_t((TileIndex / TileColumns) * 2) - int64_t(PaddingTop);
+                const int64_t iw0 = int64_t((TileIndex % TileColumns) * 2) - int64_t(PaddingLeft);
+
+                //
+                // Load the 4x4 input tile with zero padding at the borders.
+                //
+
+                float d[4][4];
+
+                for (int64_t i = 0; i < 4; i++) {
+
+                    const int64_t ih = ih0 + i;
+
+                    if (uint64_t(ih) < uint64_t(InputHeight)) {
+
+                        const float* row = input + ih * InputWidth;
+
+                        for (int64_t j = 0; j < 4; j++) {
+                            const int64_t iw = iw0 + j;
+                            d[i][j] = (uint64_t(iw) < uint64_t(InputWidth)) ? row[iw] : 0.0f;
+                        }
+
+                    } else {
+                        d[i][0] = d[i][1] = d[i][2] = d[i][3] = 0.0f;
+                    }
+                }
+
+                //
+                // Compute W = B' d.
+                //
+
+                float W[4][4];
+
+                for (size_t j = 0; j < 4; j++) {
+                    W[0][j] = d[0][j] - d[2][j];
+                    W[1][j] = d[1][j] + d[2][j];
+                    W[2][j] = d[2][j] - d[1][j];
+                    W[3][j] = d[1][j] - d[3][j];
+                }
+
+                //
+                // Compute V = W B and scatter to the transform point matrices.
+                //
+
+                float* v = V + c * CountP + pp;
+
+                for (size_t i = 0; i < 4; i++) {
+                    v[(i * 4 + 0) * InputChannels * CountP] = W[i][0] - W[i][2];
+                    v[(i * 4 + 1) * InputChannels * CountP] = W[i][1] + W[i][2];
+                    v[(i * 4 + 2) * InputChannels * CountP] = W[i][2] - W[i][1];
+                    v[(i * 4 + 3) * InputChannels * CountP] = W[i][1] - W[i][3];
+                }
+            }
+        }
+
+        //
+        // Multiply the sixteen transform point matrices in one batched pass:
+        // M[t] = U[t] x V[t].
+        //
+
+        MlasGemmBatch(CblasNoTrans, CblasNoTrans, FilterCount, CountP, InputChannels, 1.0f,
+            U, InputChannels, FilterCount * InputChannels,
+            V, CountP, InputChannels * CountP,
+            0.0f, M, CountP, FilterCount * CountP, 16, ThreadPool);
+
+        //
+        // Transform the block back to the output tiles: Y = A' M A.
+        //
+
+        for (size_t k = 0; k < FilterCount; k++) {
+
+            float* output = Output + k * OutputSize;
+
+            for (size_t pp = 0; pp < CountP; pp++) {
+
+                const size_t TileIndex = p + pp;
+                const size_t oh0 = (TileIndex / TileColumns) * 2;
+                const size_t ow0 = (TileIndex % TileColumns) * 2;
+
+                const float* m = M + k * CountP + pp;
+
+                float Z[2][4];
+
+                for (size_t j = 0; j < 4; j++) {
+
+                    const float m0 = m[(0 * 4 + j) * FilterCount * CountP];
+                    const float m1 = m[(1 * 4 + j) * FilterCount * CountP];
+                    const float m2 = m[(2 * 4 + j) * FilterCount * CountP];
+                    const float m3 = m[(3 * 4 + j) * FilterCount * CountP];
+
+                    Z[0][j] = m0 + m1 + m2;
+                    Z[1][j] = m1 - m2 - m3;
+                }
+
+                for (size_t i = 0; i < 2; i++) {
+
+                    if (oh0 + i >= OutputHeight) {
+                        break;
+                    }
+
+                    float* row = output + (oh0 + i) * OutputWidth + ow0;
+
+                    row[0] = Z[i][0] + Z[i][1] + Z[i][2];
+
+                    if (ow0 + 1 < OutputWidth) {
+                        row[1] = Z[i][1] - Z[i][2] - Z[i][3];
+                    }
+                }
+            }
+        }
+    }
+}
+
 void
 MLASCALL
 MlasConv(
@@ -930,19 +1206,17 @@ Return Value:
                 case MlasConvAlgorithmGemmDirect:
                 {
                     //
-                    // Invoke the threaded GEMM directly with the input tensor.
+                    // Invoke the threaded GEMM directly with the input tensor,
+                    // with the activation and optional bias fused into the GEMM
+                    // epilogue. This convolution is typically memory bound, so
+                    // avoiding a second pass over the output tensor matters.
                     //
 
+                    MLAS_SGEMM_ACTIVATION_OUTPUT_PROCESSOR ActivationProcessor(Parameters->Activation, bias);
+
                     MlasGemm(CblasNoTrans, Parameters->u.GemmDirect.TransB, FilterCount,
                         OutputSize, K, 1.0f, filter, K, Input, Parameters->u.GemmDirect.ldb, 0.0f,
-                        Output, OutputSize, ThreadPool);
-
-                    //
-                    // Apply the activation with optional bias.
-                    //
-
-                    MlasActivation(Parameters->Activation, Output, bias, FilterCount,
-                        OutputSize, OutputSize);
+                        Output, OutputSize, ThreadPool, &ActivationProcessor);
 
                     break;
                 }
@@ -988,6 +1262,30 @@ Return Value:
 
                     break;
                 }
+
+                case MlasConvAlgorithmWinograd:
+                {
+                    //
+                    // Transform the weights, run the tiled Winograd convolution,
+                    // then apply the activation with optional bias.
+                    //
+
+                    const size_t TileCountBlock = Parameters->u.Winograd.TileCountBlock;
+                    const size_t InputChannels = Parameters->InputChannels;
+
+                    float* U = WorkingBuffer;
+                    float* V = U + 16 * FilterCount * InputChannels;
+                    float* M = V + 16 * InputChannels * TileCountBlock;
+
+                    MlasConvWinogradWeightTransform(FilterCount, InputChannels, filter, U);
+
+                    MlasConvWinogradOperation(Parameters, Input, U, V, M, Output, ThreadPool);
+
+                    MlasActivation(Parameters->Activation, Output, bias, FilterCount,
+                        OutputSize, OutputSize);
+
+                    break;
+                }
             }
 
             //
@@ -1191,6 +1489,33 @@ Return Value:
         }
     }
 
+    //
+    // Use the Winograd F(2x2,3x3) fast algorithm for unit stride/dilation 3x3
+    // convolutions with enough channels and filters to amortize the transform
+    // overhead. The 2.25x multiply reduction only pays off when the GEMM over
+    // the transform domain dominates the gather/scatter transforms.
+    //
+
+    if (Dimensions == 2 && AllStridesAreOne && AllDilationsAreOne &&
+        Parameters->KernelShape[0] == 3 && Parameters->KernelShape[1] == 3 &&
+        Parameters->Padding[0] <= 1 && Parameters->Padding[1] <= 1 &&
+        Parameters->Padding[2] <= 1 && Parameters->Padding[3] <= 1 &&
+        InputChannels >= 8 && FilterCount >= 8 &&
+        Parameters->OutputShape[0] >= 2 && Parameters->OutputShape[1] >= 2) {
+
+        const size_t TileCount =
+            ((Parameters->OutputShape[0] + 1) / 2) * ((Parameters->OutputShape[1] + 1) / 2);
+        const size_t TileCountBlock = std::min(TileCount, size_t(MLAS_CONV_WINOGRAD_TILE_BLOCK));
+
+        Parameters->Algorithm = MlasConvAlgorithmWinograd;
+        Parameters->u.Winograd.TileCountBlock = TileCountBlock;
+
+        *WorkingBufferSize = 16 * FilterCount * InputChannels +
+            16 * (InputChannels + FilterCount) * TileCountBlock;
+
+        return;
+    }
+
     if (FilterCount > OutputSize) {
 
         //
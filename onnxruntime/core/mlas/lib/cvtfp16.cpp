@@ -0,0 +1,320 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    cvtfp16.cpp
+
+Abstract:
+
+    This module implements routines to convert between FP16 and FP32 formats.
+
+    The conversions follow IEEE 754 semantics: FP16 denormals are expanded
+    exactly, conversion to FP16 rounds to nearest even, and values outside the
+    FP16 range saturate to infinity.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Bit casting helpers between single precision values and their integer
+// representation.
+//
+
+MLAS_FORCEINLINE
+float
+MlasFp16BitsToFloat(
+    uint32_t Bits
+    )
+{
+    float Value;
+    memcpy(&Value, &Bits, sizeof(float));
+    return Value;
+}
+
+MLAS_FORCEINLINE
+uint32_t
+MlasFp16FloatToBits(
+    float Value
+    )
+{
+    uint32_t Bits;
+    memcpy(&Bits, &Value, sizeof(uint32_t));
+    return Bits;
+}
+
+MLAS_FORCEINLINE
+float
+MlasConvertHalfToFloatScalar(
+    uint16_t HalfValue
+    )
+{
+    const uint32_t ExponentMantissa = uint32_t(HalfValue & 0x7FFF) << 13;
+    const uint32_t Sign = uint32_t(HalfValue & 0x8000) << 16;
+
+    if ((HalfValue & 0x7FFF) >= 0x7C00) {
+
+        //
+        // Infinity/NaN: rebias the exponent to the single precision maximum.
+        //
+
+        return MlasFp16BitsToFloat(Sign | (ExponentMantissa + 0x70000000));
+
+    } else if ((HalfValue & 0x7FFF) < 0x0400) {
+
+        //
+        // Zero/denormal: renormalize using floating point arithmetic.
+        //
+
+        const float Magic = MlasFp16BitsToFloat(0x38800000);
+        const float Value = MlasFp16BitsToFloat(ExponentMantissa + 0x38800000) - Magic;
+        return (Sign != 0) ? -Value : Value;
+
+    } else {
+
+        return MlasFp16BitsToFloat(Sign | (ExponentMantissa + 0x38000000));
+    }
+}
+
+MLAS_FORCEINLINE
+uint16_t
+MlasConvertFloatToHalfScalar(
+    float FloatValue
+    )
+{
+    uint32_t Bits = MlasFp16FloatToBits(FloatValue);
+    const uint32_t Sign = Bits & 0x80000000;
+    Bits ^= Sign;
+
+    uint32_t HalfValue;
+
+    if (Bits >= 0x47800000) {
+
+        //
+        // Saturate to infinity or quiet any NaN.
+        //
+
+        HalfValue = (Bits > 0x7F800000) ? 0x7E00 : 0x7C00;
+
+    } else if (Bits < 0x38800000) {
+
+        //
+        // Zero/denormal: round the mantissa using floating point arithmetic.
+        //
+
+        const uint32_t MagicDenormal = 0x3F000000;
+        const float Value = MlasFp16BitsToFloat(Bits) + MlasFp16BitsToFloat(MagicDenormal);
+        HalfValue = MlasFp16FloatToBits(Value) - MagicDenormal;
+
+    } else {
+
+        //
+        // Rebias the exponent and round the mantissa to nearest even.
+        //
+
+        const uint32_t MantissaOdd = (Bits >> 13) & 1;
+        Bits -= 0x38000000;
+        Bits += 0xFFF + MantissaOdd;
+        HalfValue = Bits >> 13;
+    }
+
+    return uint16_t(HalfValue | (Sign >> 16));
+}
+
+#if defined(MLAS_SSE2_INTRINSICS)
+
+MLAS_FORCEINLINE
+__m128
+MlasConvertHalfToFloatVector(
+    __m128i HalfVector
+    )
+{
+    const __m128i MaskSign = _mm_set1_epi32(0x00007FFF);
+    const __m128i CompareInfinity = _mm_set1_epi32(0x00007C00);
+    const __m128i CompareSmallest = _mm_set1_epi32(0x00000400);
+    const __m128i AdjustExponent = _mm_set1_epi32(0x38000000);
+    const __m128i MagicDenormal = _mm_set1_epi32(0x38800000);
+
+    __m128i Value = _mm_unpacklo_epi16(HalfVector, HalfVector);
+    __m128i ExponentMantissa = _mm_and_si128(Value, MaskSign);
+    __m128i Sign = _mm_xor_si128(Value, ExponentMantissa);
+
+    __m128i RegularMask = _mm_cmpgt_epi32(CompareInfinity, ExponentMantissa);
+    __m128i DenormalMask = _mm_cmpgt_epi32(CompareSmallest, ExponentMantissa);
+    __m128i InfinityNanAdjust = _mm_andnot_si128(RegularMask, AdjustExponent);
+
+    __m128i Shifted = _mm_slli_epi32(ExponentMantissa, 13);
+    __m128i NormalValue = _mm_add_epi32(_mm_add_epi32(Shifted, AdjustExponent), InfinityNanAdjust);
+    __m128 DenormalValue = _mm_sub_ps(_mm_castsi128_ps(_mm_add_epi32(Shifted, MagicDenormal)),
+                                      _mm_castsi128_ps(MagicDenormal));
+
+    __m128i Blended = _mm_or_si128(_mm_and_si128(DenormalMask, _mm_castps_si128(DenormalValue)),
+                                   _mm_andnot_si128(DenormalMask, NormalValue));
+    Sign = _mm_slli_epi32(Sign, 16);
+
+    return _mm_castsi128_ps(_mm_or_si128(Blended, Sign));
+}
+
+MLAS_FORCEINLINE
+__m128i
+MlasConvertFloatToHalfVector(
+    __m128 FloatVector
+    )
+{
+    const __m128 MaskSign = _mm_castsi128_ps(_mm_set1_epi32(int(0x80000000)));
+    const __m128i CompareMaximum = _mm_set1_epi32(0x47800000);
+    const __m128i CompareDenormal = _mm_set1_epi32(0x38800000);
+    const __m128i NanBit = _mm_set1_epi32(0x0200);
+    const __m128i InfinityValue = _mm_set1_epi32(0x7C00);
+    const __m128i MagicDenormal = _mm_set1_epi32(0x3F000000);
+    const __m128i ExponentRebias = _mm_set1_epi32(int(0xC8000FFF));
+
+    __m128 AbsValue = _mm_andnot_ps(MaskSign, FloatVector);
+    __m128i AbsBits = _mm_castps_si128(AbsValue);
+    __m128i SignBits = _mm_srli_epi32(_mm_castps_si128(_mm_and_ps(FloatVector, MaskSign)), 16);
+
+    __m128i NanMask = _mm_castps_si128(_mm_cmpunord_ps(AbsValue, AbsValue));
+    __m128i RegularMask = _mm_cmpgt_epi32(CompareMaximum, AbsBits);
+    __m128i SpecialValue = _mm_or_si128(_mm_and_si128(NanMask, NanBit), InfinityValue);
+
+    __m128i DenormalMask = _mm_cmpgt_epi32(CompareDenormal, AbsBits);
+    __m128i DenormalValue = _mm_sub_epi32(_mm_castps_si128(_mm_add_ps(AbsValue,
+                                          _mm_castsi128_ps(MagicDenormal))), MagicDenormal);
+
+    __m128i MantissaOdd = _mm_srai_epi32(_mm_slli_epi32(AbsBits, 31 - 13), 31);
+    __m128i NormalValue = _mm_add_epi32(AbsBits, ExponentRebias);
+    NormalValue = _mm_srli_epi32(_mm_sub_epi32(NormalValue, MantissaOdd), 13);
+
+    __m128i Blended = _mm_or_si128(_mm_and_si128(DenormalMask, DenormalValue),
+                                   _mm_andnot_si128(DenormalMask, NormalValue));
+    Blended = _mm_or_si128(_mm_and_si128(RegularMask, Blended),
+                           _mm_andnot_si128(RegularMask, SpecialValue));
+    Blended = _mm_or_si128(Blended, SignBits);
+
+    //
+    // Compact the half-precision result from the low word of each element to
+    // the low quadword of the vector.
+    //
+
+    Blended = _mm_shufflelo_epi16(Blended, _MM_SHUFFLE(3, 3, 2, 0));
+    Blended = _mm_shufflehi_epi16(Blended, _MM_SHUFFLE(3, 3, 2, 0));
+
+    return _mm_shuffle_epi32(Blended, _MM_SHUFFLE(3, 3, 2, 0));
+}
+
+#endif
+
+#if !defined(_M_AMD64)
+
+//
+// Windows AMD64 builds use the assembly implementation of the half to float
+// conversion from amd64/cvtfp16a.asm.
+//
+
+void
+MLASCALL
+MlasConvertHalfToFloatBuffer(
+    const unsigned short* Source,
+    float* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of half-precision floats to the
+    destination buffer of single-precision floats.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer of half-precision
+        floats.
+
+    Destination - Supplies the address of the destination buffer of
+        single-precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    while (Count >= 4) {
+
+        __m128i HalfVector = _mm_loadl_epi64((const __m128i*)Source);
+        _mm_storeu_ps(Destination, MlasConvertHalfToFloatVector(HalfVector));
+
+        Source += 4;
+        Destination += 4;
+        Count -= 4;
+    }
+
+#endif
+
+    while (Count > 0) {
+
+        *Destination++ = MlasConvertHalfToFloatScalar(*Source++);
+        Count--;
+    }
+}
+
+#endif
+
+void
+MLASCALL
+MlasConvertFloatToHalfBuffer(
+    const float* Source,
+    unsigned short* Destination,
+    size_t Count
+    )
+/*++
+
+Routine Description:
+
+    This routine converts the source buffer of single-precision floats to the
+    destination buffer of half-precision floats.
+
+Arguments:
+
+    Source - Supplies the address of the source buffer of single-precision
+        floats.
+
+    Destination - Supplies the address of the destination buffer of
+        half-precision floats.
+
+    Count - Supplies the number of elements to convert.
+
+Return Value:
+
+    None.
+
+--*/
+{
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    while (Count >= 4) {
+
+        __m128 FloatVector = _mm_loadu_ps(Source);
+        _mm_storel_epi64((__m128i*)Destination, MlasConvertFloatToHalfVector(FloatVector));
+
+        Source += 4;
+        Destination += 4;
+        Count -= 4;
+    }
+
+#endif
+
+    while (Count > 0) {
+
+        *Destination++ = MlasConvertFloatToHalfScalar(*Source++);
+        Count--;
+    }
+}
@@ -0,0 +1,465 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    halfgemm.cpp
+
+Abstract:
+
+    This module implements the half precision matrix/matrix multiply
+    operation.
+
+    Processors with the ARMv8.2 half precision arithmetic extension use a
+    native FP16 kernel that multiplies and accumulates in half precision,
+    which doubles the arithmetic throughput and halves the memory traffic
+    relative to a float GEMM. Other processors convert panels of the operands
+    to single precision stack buffers and reuse the platform single precision
+    kernels, which still halves the memory traffic of the operands.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the parameters to execute segments of a half precision GEMM
+// operation on worker threads.
+//
+
+struct MLAS_HGEMM_WORK_BLOCK {
+    int32_t ThreadCountM;
+    size_t M;
+    size_t N;
+    size_t K;
+    const uint16_t* A;
+    size_t lda;
+    const uint16_t* B;
+    size_t ldb;
+    uint16_t* C;
+    size_t ldc;
+};
+
+//
+// Define the panel sizes used to convert the half precision operands to
+// single precision stack buffers.
+//
+
+#define MLAS_HGEMM_STRIDEM                  32
+#define MLAS_HGEMM_STRIDEN                  64
+#define MLAS_HGEMM_STRIDEK                  128
+
+bool
+MLASCALL
+MlasFp16AccelerationSupported(
+    void
+    )
+/*++
+
+Routine Description:
+
+    This routine reports whether the processor supports native half precision
+    arithmetic (ARMv8.2 FP16). The half precision GEMM works on any processor,
+    but callers can use this to decide whether demoting operands is
+    profitable.
+
+Arguments:
+
+    None.
+
+Return Value:
+
+    Returns true if the processor supports native half precision arithmetic.
+
+--*/
+{
+#if defined(MLAS_TARGET_ARM64)
+    return MlasPlatform.Fp16Supported != 0;
+#else
+    return false;
+#endif
+}
+
+void
+MlasHalfGemmOperation(
+    size_t M,
+    size_t N,
+    size_t K,
+    const uint16_t* A,
+    size_t lda,
+    const uint16_t* B,
+    size_t ldb,
+    uint16_t* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single-threaded half precision matrix/matrix
+    multiply operation by converting panels of the operands to single
+    precision and accumulating with the platform single precision kernels.
+
+Arguments:
+
+    See MlasHalfGemm.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_DECLSPEC_ALIGN(float PanelA[MLAS_HGEMM_STRIDEM * MLAS_HGEMM_STRIDEK], 64);
+    MLAS_DECLSPEC_ALIGN(float PanelB[MLAS_HGEMM_STRIDEK * MLAS_HGEMM_STRIDEN], 64);
+    MLAS_DECLSPEC_ALIGN(float PanelC[MLAS_HGEMM_STRIDEM * MLAS_HGEMM_STRIDEN], 64);
+
+    for (size_t m = 0; m < M; m += MLAS_HGEMM_STRIDEM) {
+
+        const size_t CountM = std::min(M - m, size_t(MLAS_HGEMM_STRIDEM));
+
+        for (size_t n = 0; n < N; n += MLAS_HGEMM_STRIDEN) {
+
+            const size_t CountN = std::min(N - n, size_t(MLAS_HGEMM_STRIDEN));
+
+            for (size_t k = 0; k < K; k += MLAS_HGEMM_STRIDEK) {
+
+                const size_t CountK = std::min(K - k, size_t(MLAS_HGEMM_STRIDEK));
+
+                //
+                // Accumulate into the single precision output panel after the
+                // first panel of the K dimension has initialized it.
+                //
+
+                const float PanelBeta = (k == 0) ? 0.0f : 1.0f;
+
+                for (size_t mm = 0; mm < CountM; mm++) {
+                    MlasConvertHalfToFloatBuffer(A + (m + mm) * lda + k, PanelA + mm * CountK, CountK);
+                }
+
+                for (size_t kk = 0; kk < CountK; kk++) {
+                    MlasConvertHalfToFloatBuffer(B + (k + kk) * ldb + n, PanelB + kk * CountN, CountN);
+                }
+
+                MlasSgemmOperation(CblasNoTrans, CblasNoTrans, CountM, CountN, CountK, 1.0f,
+                    PanelA, CountK, PanelB, CountN, PanelBeta, PanelC, CountN);
+            }
+
+            for (size_t mm = 0; mm < CountM; mm++) {
+                MlasConvertFloatToHalfBuffer(PanelC + mm * CountN, C + (m + mm) * ldc + n, CountN);
+            }
+        }
+    }
+}
+
+#if defined(MLAS_F16_INTRINSICS)
+
+MLAS_F16_TARGET
+MLAS_FORCEINLINE
+float16x8_t
+MlasHalfGemmLoadVectorNeon(
+    const float16_t* Address,
+    size_t Columns
+    )
+{
+    if (Columns == 8) {
+        return vld1q_f16(Address);
+    }
+
+    //
+    // Copy the remaining columns to a zero padded stack buffer. The zero
+    // padded lanes contribute nothing to the accumulators and are discarded
+    // by the partial store below.
+    //
+
+    float16_t Buffer[8];
+
+    vst1q_f16(Buffer, vdupq_n_f16(0));
+
+    for (size_t n = 0; n < Columns; n++) {
+        Buffer[n] = Address[n];
+    }
+
+    return vld1q_f16(Buffer);
+}
+
+MLAS_F16_TARGET
+MLAS_FORCEINLINE
+void
+MlasHalfGemmStoreVectorNeon(
+    float16_t* C,
+    float16x8_t Accumulator,
+    size_t Columns
+    )
+{
+    if (Columns == 8) {
+
+        vst1q_f16(C, Accumulator);
+
+    } else {
+
+        float16_t Buffer[8];
+
+        vst1q_f16(Buffer, Accumulator);
+
+        for (size_t n = 0; n < Columns; n++) {
+            C[n] = Buffer[n];
+        }
+    }
+}
+
+MLAS_F16_TARGET
+void
+MlasHalfGemmOperationNeon(
+    size_t M,
+    size_t N,
+    size_t K,
+    const uint16_t* A,
+    size_t lda,
+    const uint16_t* B,
+    size_t ldb,
+    uint16_t* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the single-threaded half precision matrix/matrix
+    multiply operation using the ARMv8.2 half precision arithmetic
+    instructions. Rows are processed in blocks of four so that every vector
+    load of matrix B is reused across four accumulators.
+
+Arguments:
+
+    See MlasHalfGemm.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const float16_t* a = reinterpret_cast<const float16_t*>(A);
+    const float16_t* b = reinterpret_cast<const float16_t*>(B);
+    float16_t* c = reinterpret_cast<float16_t*>(C);
+
+    size_t m = 0;
+
+    for (; m + 4 <= M; m += 4) {
+
+        const float16_t* a0 = a + m * lda;
+        const float16_t* a1 = a0 + lda;
+        const float16_t* a2 = a1 + lda;
+        const float16_t* a3 = a2 + lda;
+
+        for (size_t n = 0; n < N; n += 8) {
+
+            const size_t Columns = std::min(N - n, size_t(8));
+
+            float16x8_t Accumulator0 = vdupq_n_f16(0);
+            float16x8_t Accumulator1 = vdupq_n_f16(0);
+            float16x8_t Accumulator2 = vdupq_n_f16(0);
+            float16x8_t Accumulator3 = vdupq_n_f16(0);
+
+            for (size_t k = 0; k < K; k++) {
+
+                const float16x8_t MatrixB = MlasHalfGemmLoadVectorNeon(b + k * ldb + n, Columns);
+
+                Accumulator0 = vfmaq_n_f16(Accumulator0, MatrixB, a0[k]);
+                Accumulator1 = vfmaq_n_f16(Accumulator1, MatrixB, a1[k]);
+                Accumulator2 = vfmaq_n_f16(Accumulator2, MatrixB, a2[k]);
+                Accumulator3 = vfmaq_n_f16(Accumulator3, MatrixB, a3[k]);
+            }
+
+            MlasHalfGemmStoreVectorNeon(c + m * ldc + n, Accumulator0, Columns);
+            MlasHalfGemmStoreVectorNeon(c + (m + 1) * ldc + n, Accumulator1, Columns);
+            MlasHalfGemmStoreVectorNeon(c + (m + 2) * ldc + n, Accumulator2, Columns);
+            MlasHalfGemmStoreVectorNeon(c + (m + 3) * ldc + n, Accumulator3, Columns);
+        }
+    }
+
+    for (; m < M; m++) {
+
+        const float16_t* a0 = a + m * lda;
+
+        for (size_t n = 0; n < N; n += 8) {
+
+            const size_t Columns = std::min(N - n, size_t(8));
+
+            float16x8_t Accumulator0 = vdupq_n_f16(0);
+
+            for (size_t k = 0; k < K; k++) {
+
+                const float16x8_t MatrixB = MlasHalfGemmLoadVectorNeon(b + k * ldb + n, Columns);
+
+                Accumulator0 = vfmaq_n_f16(Accumulator0, MatrixB, a0[k]);
+            }
+
+            MlasHalfGemmStoreVectorNeon(c + m * ldc + n, Accumulator0, Columns);
+        }
+    }
+}
+
+#endif // MLAS_F16_INTRINSICS
+
+void
+MlasHalfGemmThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    half precision GEMM operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_HGEMM_WORK_BLOCK*)Context;
+
+    //
+    // Partition the operation along the M dimension.
+    //
+
+    size_t RangeStartM;
+    size_t RangeCountM;
+
+    MlasPartitionWork(ThreadId, WorkBlock->ThreadCountM, WorkBlock->M, &RangeStartM, &RangeCountM);
+
+    const uint16_t* A = WorkBlock->A + RangeStartM * WorkBlock->lda;
+    uint16_t* C = WorkBlock->C + RangeStartM * WorkBlock->ldc;
+
+#if defined(MLAS_F16_INTRINSICS)
+
+    if (MlasPlatform.Fp16Supported) {
+        MlasHalfGemmOperationNeon(RangeCountM, WorkBlock->N, WorkBlock->K, A, WorkBlock->lda,
+            WorkBlock->B, WorkBlock->ldb, C, WorkBlock->ldc);
+        return;
+    }
+
+#endif
+
+    MlasHalfGemmOperation(RangeCountM, WorkBlock->N, WorkBlock->K, A, WorkBlock->lda,
+        WorkBlock->B, WorkBlock->ldb, C, WorkBlock->ldc);
+}
+
+void
+MLASCALL
+MlasHalfGemm(
+    size_t M,
+    size_t N,
+    size_t K,
+    const uint16_t* A,
+    size_t lda,
+    const uint16_t* B,
+    size_t ldb,
+    uint16_t* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the half precision matrix/matrix multiply
+    operation C = A * B. Neither operand is transposed.
+
+    Processors with native half precision arithmetic accumulate in half
+    precision; other processors accumulate in single precision and round the
+    output panel to half precision.
+
+Arguments:
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    A - Supplies the address of matrix A as half precision values.
+
+    lda - Supplies the first dimension of matrix A.
+
+    B - Supplies the address of matrix B as half precision values.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    C - Supplies the address of matrix C as half precision values.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_HGEMM_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the GEMM parameters to the work block.
+    //
+
+    memset(&WorkBlock, 0, sizeof(MLAS_HGEMM_WORK_BLOCK));
+
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+    WorkBlock.K = K;
+    WorkBlock.A = A;
+    WorkBlock.lda = lda;
+    WorkBlock.B = B;
+    WorkBlock.ldb = ldb;
+    WorkBlock.C = C;
+    WorkBlock.ldc = ldc;
+
+    //
+    // Compute the number of target threads given the complexity of the GEMM
+    // operation. Small requests should run using the single threaded path.
+    //
+
+    const double Complexity = double(M) * double(N) * double(K);
+
+    int32_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = int32_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    //
+    // Segment the operation across multiple threads along the M dimension.
+    //
+
+    if (size_t(TargetThreadCount) > M) {
+        TargetThreadCount = int32_t(std::max(M, size_t(1)));
+    }
+
+    WorkBlock.ThreadCountM = TargetThreadCount;
+
+    MlasExecuteThreaded(MlasHalfGemmThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+}
@@ -0,0 +1,174 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    layernorm_avx.cpp
+
+Abstract:
+
+    This module implements the layer normalization operation with AVX
+    instructions.
+
+--*/
+
+#include "mlasi.h"
+
+void
+MLASCALL
+MlasComputeLayerNormF32KernelAvx(
+    const float* Input,
+    const float* Scale,
+    const float* Bias,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t N,
+    size_t D,
+    float Epsilon,
+    bool SimplifiedLayerNorm
+    )
+{
+    while (N > 0) {
+
+        //
+        // Accumulate the sum for the row and compute the center value (zero
+        // for simplified layer normalization, the mean otherwise).
+        //
+
+        __m256 SumVector = _mm256_setzero_ps();
+
+        const float* input = Input;
+        size_t d = D;
+
+        while (d >= 8) {
+
+            SumVector = _mm256_add_ps(SumVector, _mm256_loadu_ps(input));
+
+            input += 8;
+            d -= 8;
+        }
+
+        float Sum = MlasReduceAddFloat32x4(_mm_add_ps(_mm256_castps256_ps128(SumVector),
+            _mm256_extractf128_ps(SumVector, 1)));
+
+        while (d > 0) {
+
+            Sum += *input++;
+
+            d -= 1;
+        }
+
+        float MeanValue = Sum / float(D);
+        float CenterValue = SimplifiedLayerNorm ? 0.0f : MeanValue;
+
+        //
+        // Accumulate the sum of squared deviations from the center value in a
+        // second pass. Accumulating the sum of squares alongside the sum and
+        // subtracting the squared mean cancels catastrophically when the mean
+        // is large relative to the variance, so the deviations are squared
+        // directly instead.
+        //
+
+        __m256 CenterVector = _mm256_set1_ps(CenterValue);
+        __m256 SumSquaresVector = _mm256_setzero_ps();
+
+        input = Input;
+        d = D;
+
+        while (d >= 8) {
+
+            __m256 DeviationVector = _mm256_sub_ps(_mm256_loadu_ps(input), CenterVector);
+
+            SumSquaresVector = _mm256_add_ps(SumSquaresVector, _mm256_mul_ps(DeviationVector, DeviationVector));
+
+            input += 8;
+            d -= 8;
+        }
+
+        float SumSquares = MlasReduceAddFloat32x4(_mm_add_ps(_mm256_castps256_ps128(SumSquaresVector),
+            _mm256_extractf128_ps(SumSquaresVector, 1)));
+
+        while (d > 0) {
+
+            float Deviation = *input++ - CenterValue;
+
+            SumSquares += Deviation * Deviation;
+
+            d -= 1;
+        }
+
+        //
+        // Compute the reciprocal of the standard deviation.
+        //
+
+        float Variance = SumSquares / float(D);
+        float InvStdDevValue = 1.0f / std::sqrt(Variance + Epsilon);
+
+        //
+        // Normalize the row with the scale vector and the optional bias
+        // vector.
+        //
+
+        __m256 InvStdDevVector = _mm256_set1_ps(InvStdDevValue);
+
+        input = Input;
+        float* output = Output;
+        const float* scale = Scale;
+        const float* bias = Bias;
+
+        d = D;
+
+        while (d >= 8) {
+
+            __m256 Vector = _mm256_sub_ps(_mm256_loadu_ps(input), CenterVector);
+
+            Vector = _mm256_mul_ps(Vector, InvStdDevVector);
+            Vector = _mm256_mul_ps(Vector, _mm256_loadu_ps(scale));
+
+            if (bias != nullptr) {
+                Vector = _mm256_add_ps(Vector, _mm256_loadu_ps(bias));
+                bias += 8;
+            }
+
+            _mm256_storeu_ps(output, Vector);
+
+            input += 8;
+            output += 8;
+            scale += 8;
+            d -= 8;
+        }
+
+        while (d > 0) {
+
+            float Value = (*input++ - CenterValue) * InvStdDevValue * *scale++;
+
+            if (bias != nullptr) {
+                Value += *bias++;
+            }
+
+            *output++ = Value;
+
+            d -= 1;
+        }
+
+        //
+        // Store the optional per-row statistics.
+        //
+
+        if (Mean != nullptr) {
+            *Mean++ = MeanValue;
+        }
+
+        if (InvStdDev != nullptr) {
+            *InvStdDev++ = InvStdDevValue;
+        }
+
+        Input += D;
+        Output += D;
+        N -= 1;
+    }
+}
@@ -0,0 +1,397 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    layernorm.cpp
+
+Abstract:
+
+    This module implements the layer normalization operation.
+
+    Each row of the input is reduced to its mean and variance in a single
+    pass and then normalized in place of multiple passes with temporary
+    buffers. The implementation below targets the base instruction set
+    (typically SSE2) while platform specific versions target newer
+    instruction sets (such as AVX).
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the parameters to execute segments of a layer normalization
+// operation on worker threads.
+//
+
+struct MLAS_LAYERNORM_WORK_BLOCK {
+    int32_t ThreadCountN;
+    const float* Input;
+    const float* Scale;
+    const float* Bias;
+    float* Output;
+    float* Mean;
+    float* InvStdDev;
+    size_t N;
+    size_t D;
+    float Epsilon;
+    bool SimplifiedLayerNorm;
+};
+
+void
+MLASCALL
+MlasComputeLayerNormF32Kernel(
+    const float* Input,
+    const float* Scale,
+    const float* Bias,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t N,
+    size_t D,
+    float Epsilon,
+    bool SimplifiedLayerNorm
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the layer normalization operation for a range of
+    rows.
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Scale - Supplies the per-column scale vector of length D.
+
+    Bias - Optionally supplies the per-column bias vector of length D.
+
+    Output - Supplies the output buffer.
+
+    Mean - Optionally supplies the output buffer for the per-row mean.
+
+    InvStdDev - Optionally supplies the output buffer for the per-row
+        reciprocal of the standard deviation.
+
+    N - Supplies the number of rows to process.
+
+    D - Supplies the number of columns per row to process.
+
+    Epsilon - Supplies the epsilon value added to the variance for numerical
+        stability.
+
+    SimplifiedLayerNorm - Supplies true if the mean is not subtracted from
+        the input (root mean square normalization), else false.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    while (N > 0) {
+
+        //
+        // Accumulate the sum for the row and compute the center value (zero
+        // for simplified layer normalization, the mean otherwise).
+        //
+
+        MLAS_FLOAT32X4 SumVector = MlasZeroFloat32x4();
+
+        const float* input = Input;
+        size_t d = D;
+
+        while (d >= 4) {
+
+            SumVector = MlasAddFloat32x4(SumVector, MlasLoadFloat32x4(input));
+
+            input += 4;
+            d -= 4;
+        }
+
+        float Sum = MlasReduceAddFloat32x4(SumVector);
+
+        while (d > 0) {
+
+            Sum += *input++;
+
+            d -= 1;
+        }
+
+        float MeanValue = Sum / float(D);
+        float CenterValue = SimplifiedLayerNorm ? 0.0f : MeanValue;
+
+        //
+        // Accumulate the sum of squared deviations from the center value in a
+        // second pass. Accumulating the sum of squares alongside the sum and
+        // subtracting the squared mean cancels catastrophically when the mean
+        // is large relative to the variance, so the deviations are squared
+        // directly instead.
+        //
+
+        MLAS_FLOAT32X4 CenterVector = MlasBroadcastFloat32x4(CenterValue);
+        MLAS_FLOAT32X4 SumSquaresVector = MlasZeroFloat32x4();
+
+        input = Input;
+        d = D;
+
+        while (d >= 4) {
+
+            MLAS_FLOAT32X4 DeviationVector = MlasSubtractFloat32x4(MlasLoadFloat32x4(input), CenterVector);
+
+            SumSquaresVector = MlasMultiplyAddFloat32x4(DeviationVector, DeviationVector, SumSquaresVector);
+
+            input += 4;
+            d -= 4;
+        }
+
+        float SumSquares = MlasReduceAddFloat32x4(SumSquaresVector);
+
+        while (d > 0) {
+
+            float Deviation = *input++ - CenterValue;
+
+            SumSquares += Deviation * Deviation;
+
+            d -= 1;
+        }
+
+        //
+        // Compute the reciprocal of the standard deviation.
+        //
+
+        float Variance = SumSquares / float(D);
+        float InvStdDevValue = 1.0f / std::sqrt(Variance + Epsilon);
+
+        //
+        // Normalize the row with the scale vector and the optional bias
+        // vector.
+        //
+
+        MLAS_FLOAT32X4 InvStdDevVector = MlasBroadcastFloat32x4(InvStdDevValue);
+
+        input = Input;
+        float* output = Output;
+        const float* scale = Scale;
+        const float* bias = Bias;
+
+        d = D;
+
+        while (d >= 4) {
+
+            MLAS_FLOAT32X4 Vector = MlasSubtractFloat32x4(MlasLoadFloat32x4(input), CenterVector);
+
+            Vector = MlasMultiplyFloat32x4(Vector, InvStdDevVector);
+            Vector = MlasMultiplyFloat32x4(Vector, MlasLoadFloat32x4(scale));
+
+            if (bias != nullptr) {
+                Vector = MlasAddFloat32x4(Vector, MlasLoadFloat32x4(bias));
+                bias += 4;
+            }
+
+            MlasStoreFloat32x4(output, Vector);
+
+            input += 4;
+            output += 4;
+            scale += 4;
+            d -= 4;
+        }
+
+        while (d > 0) {
+
+            float Value = (*input++ - CenterValue) * InvStdDevValue * *scale++;
+
+            if (bias != nullptr) {
+                Value += *bias++;
+            }
+
+            *output++ = Value;
+
+            d -= 1;
+        }
+
+        //
+        // Store the optional per-row statistics.
+        //
+
+        if (Mean != nullptr) {
+            *Mean++ = MeanValue;
+        }
+
+        if (InvStdDev != nullptr) {
+            *InvStdDev++ = InvStdDevValue;
+        }
+
+        Input += D;
+        Output += D;
+        N -= 1;
+    }
+}
+
+void
+MlasComputeLayerNormThreaded(
+    void* Context,
+    int32_t Index
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    layer normalization operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    Index - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_LAYERNORM_WORK_BLOCK*)Context;
+
+    //
+    // Partition the operation along the N dimension.
+    //
+
+    size_t n;
+    size_t CountN;
+
+    MlasPartitionWork(Index, WorkBlock->ThreadCountN, WorkBlock->N, &n, &CountN);
+
+    //
+    // Normalize the rows of this range.
+    //
+
+    const size_t D = WorkBlock->D;
+
+    const float* Input = WorkBlock->Input + n * D;
+    float* Output = WorkBlock->Output + n * D;
+    float* Mean = (WorkBlock->Mean != nullptr) ? WorkBlock->Mean + n : nullptr;
+    float* InvStdDev = (WorkBlock->InvStdDev != nullptr) ? WorkBlock->InvStdDev + n : nullptr;
+
+#if defined(MLAS_TARGET_AMD64)
+    MlasPlatform.ComputeLayerNormF32Kernel(Input, WorkBlock->Scale, WorkBlock->Bias,
+        Output, Mean, InvStdDev, CountN, D, WorkBlock->Epsilon,
+        WorkBlock->SimplifiedLayerNorm);
+#else
+    MlasComputeLayerNormF32Kernel(Input, WorkBlock->Scale, WorkBlock->Bias,
+        Output, Mean, InvStdDev, CountN, D, WorkBlock->Epsilon,
+        WorkBlock->SimplifiedLayerNorm);
+#endif
+}
+
+void
+MLASCALL
+MlasComputeLayerNorm(
+    const float* Input,
+    const float* Scale,
+    const float* Bias,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t N,
+    size_t D,
+    float Epsilon,
+    bool SimplifiedLayerNorm,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the layer normalization function:
+
+        Output = (Input - mean(Input)) / sqrt(var(Input) + Epsilon) * Scale + Bias
+
+    applied independently to each of the N rows of length D. The simplified
+    variant skips the mean subtraction (root mean square normalization).
+
+    N.B. This implementation supports in place updates of the output buffer.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Scale - Supplies the per-column scale vector of length D.
+
+    Bias - Optionally supplies the per-column bias vector of length D.
+
+    Output - Supplies the output buffer.
+
+    Mean - Optionally supplies the output buffer for the per-row mean.
+
+    InvStdDev - Optionally supplies the output buffer for the per-row
+        reciprocal of the standard deviation.
+
+    N - Supplies the number of rows to process.
+
+    D - Supplies the number of columns per row to process.
+
+    Epsilon - Supplies the epsilon value added to the variance for numerical
+        stability.
+
+    SimplifiedLayerNorm - Supplies true if the mean is not subtracted from
+        the input (root mean square normalization), else false.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    MLAS_LAYERNORM_WORK_BLOCK WorkBlock;
+
+    //
+    // Capture the layer normalization parameters to the work block.
+    //
+
+    WorkBlock.Input = Input;
+    WorkBlock.Scale = Scale;
+    WorkBlock.Bias = Bias;
+    WorkBlock.Output = Output;
+    WorkBlock.Mean = Mean;
+    WorkBlock.InvStdDev = InvStdDev;
+    WorkBlock.N = N;
+    WorkBlock.D = D;
+    WorkBlock.Epsilon = Epsilon;
+    WorkBlock.SimplifiedLayerNorm = SimplifiedLayerNorm;
+
+    //
+    // Compute the number of target threads given the complexity of the layer
+    // normalization operation. Limit the number of threads to the number of
+    // rows and try to keep each thread processing a minimum number of
+    // elements before using another thread.
+    //
+
+    int32_t ThreadCountN = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (size_t(ThreadCountN) > N) {
+        ThreadCountN = int32_t(N);
+    }
+
+    constexpr size_t MinimumElementsPerThread = 16384;
+
+    size_t BlockCount = ((N * D) / MinimumElementsPerThread) + 1;
+
+    if (size_t(ThreadCountN) > BlockCount) {
+        ThreadCountN = int32_t(BlockCount);
+    }
+
+    WorkBlock.ThreadCountN = ThreadCountN;
+
+    MlasExecuteThreaded(MlasComputeLayerNormThreaded, &WorkBlock, ThreadCountN, ThreadPool);
+}
@@ -453,6 +453,23 @@ void
 
 typedef MLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL* PMLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL;
 
+typedef
+void
+(MLASCALL MLAS_COMPUTE_LAYERNORM_FLOAT_KERNEL)(
+    const float* Input,
+    const float* Scale,
+    const float* Bias,
+    float* Output,
+    float* Mean,
+    float* InvStdDev,
+    size_t N,
+    size_t D,
+    float Epsilon,
+    bool SimplifiedLayerNorm
+    );
+
+typedef MLAS_COMPUTE_LAYERNORM_FLOAT_KERNEL* PMLAS_COMPUTE_LAYERNORM_FLOAT_KERNEL;
+
 typedef
 void
 (MLASCALL MLAS_QLINEAR_BINARY_OP_S8_KERNEL)(
@@ -642,9 +659,11 @@ extern "C" {
 
     MLAS_REDUCE_MAXIMUM_FLOAT_KERNEL MlasReduceMaximumF32Kernel;
     MLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL MlasReduceMinimumMaximumF32Kernel;
+    MLAS_COMPUTE_LAYERNORM_FLOAT_KERNEL MlasComputeLayerNormF32Kernel;
 #if defined(MLAS_TARGET_AMD64)
     MLAS_REDUCE_MAXIMUM_FLOAT_KERNEL MlasReduceMaximumF32KernelAvx;
     MLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL MlasReduceMinimumMaximumF32KernelAvx;
+    MLAS_COMPUTE_LAYERNORM_FLOAT_KERNEL MlasComputeLayerNormF32KernelAvx;
 #endif
 
 }
@@ -693,7 +712,10 @@ MlasSgemmOperation(
     size_t ldb,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor = nullptr,
+    size_t RangeStartM = 0,
+    size_t RangeStartN = 0
     );
 
 //
@@ -703,6 +725,8 @@ MlasSgemmOperation(
 struct MLAS_GEMM_U8X8_KERNEL_SSE;
 struct MLAS_GEMM_U8S8_KERNEL_AVX2;
 struct MLAS_GEMM_U8U8_KERNEL_AVX2;
+struct MLAS_GEMM_U8X8_KERNEL_NEON;
+struct MLAS_GEMM_U8X8_KERNEL_UDOT;
 
 template<typename KernelType>
 void
@@ -792,13 +816,24 @@ struct MLAS_PLATFORM {
     PMLAS_COMPUTE_LOGSOFTMAX_OUTPUT_FLOAT_KERNEL ComputeLogSoftmaxOutputF32Kernel;
     PMLAS_REDUCE_MAXIMUM_FLOAT_KERNEL ReduceMaximumF32Kernel;
     PMLAS_REDUCE_MINIMUM_MAXIMUM_FLOAT_KERNEL ReduceMinimumMaximumF32Kernel;
+    PMLAS_COMPUTE_LAYERNORM_FLOAT_KERNEL ComputeLayerNormF32Kernel;
     PMLAS_QUANTIZE_LINEAR_S8_KERNEL QuantizeLinearS8Kernel;
     PMLAS_QUANTIZE_LINEAR_U8_KERNEL QuantizeLinearU8Kernel;
+    uint32_t Bf16Supported;
     uint32_t NchwcBlockSize;
     uint32_t PreferredBufferAlignment;
     uint32_t MaximumThreadCount;
+    uint32_t SgemmStrideN;
+    uint32_t SgemmStrideK;
 #else
+#if defined(MLAS_TARGET_ARM64)
+    PMLAS_GEMM_U8X8_OPERATION GemmU8X8Operation;
+    PMLAS_GEMM_U8X8_OPERATION GemmU8X8PackedOperation;
+    uint32_t Fp16Supported;
+#endif
     static constexpr uint32_t MaximumThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+    static constexpr uint32_t SgemmStrideN = MLAS_SGEMM_STRIDEN;
+    static constexpr uint32_t SgemmStrideK = MLAS_SGEMM_STRIDEK;
 #endif
 };
 
@@ -933,6 +968,19 @@ MlasFp32FromBits(
 #elif defined(MLAS_TARGET_ARM64)
 #define MLAS_NEON_INTRINSICS
 #define MLAS_NEON64_INTRINSICS
+//
+// The ARMv8.2 dot product (UDOT/SDOT) and half precision arithmetic kernels
+// are built with a function level target attribute so the rest of the library
+// can stay at the baseline architecture. MSVC has no equivalent of the
+// attribute, so those kernels are limited to the toolchains below and
+// selected at runtime from MLAS_PLATFORM.
+//
+#if !defined(_MSC_VER) && (defined(__clang__) || (defined(__GNUC__) && __GNUC__ >= 9))
+#define MLAS_UDOT_INTRINSICS
+#define MLAS_UDOT_TARGET __attribute__((target("arch=armv8.2-a+dotprod")))
+#define MLAS_F16_INTRINSICS
+#define MLAS_F16_TARGET __attribute__((target("arch=armv8.2-a+fp16")))
+#endif
 #elif defined(MLAS_TARGET_POWER)
 #define MLAS_VSX_INTRINSICS
 #elif defined(MLAS_TARGET_AMD64_IX86)
@@ -88,6 +88,75 @@ MlasReadExtendedControlRegister(
 
 #endif
 
+#if defined(MLAS_UDOT_INTRINSICS) || defined(MLAS_F16_INTRINSICS)
+
+#if defined(__linux__)
+#include <sys/auxv.h>
+#if !defined(HWCAP_ASIMDDOT)
+#define HWCAP_ASIMDDOT (1 << 20)
+#endif
+#if !defined(HWCAP_FPHP)
+#define HWCAP_FPHP (1 << 9)
+#endif
+#if !defined(HWCAP_ASIMDHP)
+#define HWCAP_ASIMDHP (1 << 10)
+#endif
+#elif defined(__APPLE__)
+#include <sys/sysctl.h>
+#endif
+
+//
+// Reads the operating system's processor capability bits to determine if the
+// ARMv8.2 dot product (UDOT/SDOT) instructions are available.
+//
+
+static
+bool
+MlasDotProductInstructionsSupported(
+    void
+    )
+{
+#if defined(__linux__)
+    return (getauxval(AT_HWCAP) & HWCAP_ASIMDDOT) != 0;
+#elif defined(__APPLE__)
+    int value = 0;
+    size_t size = sizeof(value);
+
+    return (sysctlbyname("hw.optional.arm.FEAT_DotProd", &value, &size, nullptr, 0) == 0) &&
+        (value != 0);
+#else
+    return false;
+#endif
+}
+
+//
+// Reads the operating system's processor capability bits to determine if the
+// ARMv8.2 half precision arithmetic (FP16/SIMDHP) instructions are available.
+//
+
+static
+bool
+MlasFp16InstructionsSupported(
+    void
+    )
+{
+#if defined(__linux__)
+    const unsigned long HardwareCap = getauxval(AT_HWCAP);
+
+    return (HardwareCap & HWCAP_FPHP) != 0 && (HardwareCap & HWCAP_ASIMDHP) != 0;
+#elif defined(__APPLE__)
+    int value = 0;
+    size_t size = sizeof(value);
+
+    return (sysctlbyname("hw.optional.arm.FEAT_FP16", &value, &size, nullptr, 0) == 0) &&
+        (value != 0);
+#else
+    return false;
+#endif
+}
+
+#endif
+
 MLAS_PLATFORM::MLAS_PLATFORM(
     void
     )
@@ -138,6 +207,7 @@ Return Value:
     this->ComputeLogSoftmaxOutputF32Kernel = MlasComputeLogSoftmaxOutputF32Kernel;
     this->ReduceMaximumF32Kernel = MlasReduceMaximumF32Kernel;
     this->ReduceMinimumMaximumF32Kernel = MlasReduceMinimumMaximumF32Kernel;
+    this->ComputeLayerNormF32Kernel = MlasComputeLayerNormF32Kernel;
     this->QLinearAddS8Kernel = MlasQLinearAddS8Kernel;
     this->QLinearAddU8Kernel = MlasQLinearAddU8Kernel;
     this->QuantizeLinearS8Kernel = MlasQuantizeLinearS8Kernel;
@@ -145,11 +215,47 @@ Return Value:
     this->ConvDepthwiseU8S8Kernel = MlasConvDepthwiseKernel<int8_t>;
     this->ConvDepthwiseU8U8Kernel = MlasConvDepthwiseKernel<uint8_t>;
 
+    this->Bf16Supported = 0;
     this->NchwcBlockSize = 8;
     this->PreferredBufferAlignment = MLAS_DEFAULT_PREFERRED_BUFFER_ALIGNMENT;
 
     this->MaximumThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
 
+    //
+    // Select the SGEMM blocking parameters using the size of the processor's
+    // level 2 cache. Processors with larger caches per core (such as recent
+    // AMD parts with 512KB) benefit from deeper slices of the K dimension,
+    // while the shallower default is a better fit for the 256KB caches found
+    // on most Intel client parts. The product of the strides is kept constant
+    // so the fixed size panel buffers in the SGEMM operation remain valid.
+    //
+
+    this->SgemmStrideN = MLAS_SGEMM_STRIDEN;
+    this->SgemmStrideK = MLAS_SGEMM_STRIDEK;
+
+    unsigned CpuidExtended[4];
+#if defined(_WIN32)
+    __cpuid((int*)CpuidExtended, 0x80000000);
+#else
+    __cpuid(0x80000000, CpuidExtended[0], CpuidExtended[1], CpuidExtended[2], CpuidExtended[3]);
+#endif
+
+    if (CpuidExtended[0] >= 0x80000006) {
+
+#if defined(_WIN32)
+        __cpuid((int*)CpuidExtended, 0x80000006);
+#else
+        __cpuid(0x80000006, CpuidExtended[0], CpuidExtended[1], CpuidExtended[2], CpuidExtended[3]);
+#endif
+
+        uint32_t CacheSizeL2 = CpuidExtended[2] >> 16;
+
+        if (CacheSizeL2 >= 512) {
+            this->SgemmStrideN = MLAS_SGEMM_STRIDEN / 2;
+            this->SgemmStrideK = MLAS_SGEMM_STRIDEK * 2;
+        }
+    }
+
 #endif
 
     //
@@ -192,6 +298,7 @@ Return Value:
             this->ComputeLogSoftmaxOutputF32Kernel = MlasComputeLogSoftmaxOutputF32KernelAvx;
             this->ReduceMaximumF32Kernel = MlasReduceMaximumF32KernelAvx;
             this->ReduceMinimumMaximumF32Kernel = MlasReduceMinimumMaximumF32KernelAvx;
+            this->ComputeLayerNormF32Kernel = MlasComputeLayerNormF32KernelAvx;
 
             //
             // Check if the processor supports AVX2/FMA3 features.
@@ -280,6 +387,13 @@ Return Value:
                     this->NchwcBlockSize = 16;
                     this->PreferredBufferAlignment = 64;
 
+                    //
+                    // Check if the processor supports AVX512-BF16 (Cooper
+                    // Lake and later).
+                    //
+
+                    this->Bf16Supported = (Cpuid7_1[0] & 0x20) != 0;
+
 #if !defined(MLAS_AVX512F_INTRINSICS_UNSUPPORTED)
                     this->QuantizeLinearS8Kernel = MlasQuantizeLinearS8KernelAvx512F;
                     this->QuantizeLinearU8Kernel = MlasQuantizeLinearU8KernelAvx512F;
@@ -326,6 +440,42 @@ Return Value:
 
 #endif // MLAS_TARGET_AMD64_IX86
 
+#if defined(MLAS_TARGET_ARM64)
+
+    //
+    // Default to the baseline NEON kernels.
+    //
+
+    this->GemmU8X8Operation = MlasGemmU8X8Operation<MLAS_GEMM_U8X8_KERNEL_NEON>;
+    this->GemmU8X8PackedOperation = MlasGemmU8X8PackedOperation<MLAS_GEMM_U8X8_KERNEL_NEON>;
+    this->Fp16Supported = 0;
+
+#if defined(MLAS_F16_INTRINSICS)
+
+    //
+    // Check if the processor supports the ARMv8.2 half precision arithmetic
+    // instructions.
+    //
+
+    this->Fp16Supported = MlasFp16InstructionsSupported() ? 1 : 0;
+
+#endif
+
+#if defined(MLAS_UDOT_INTRINSICS)
+
+    //
+    // Check if the processor supports the ARMv8.2 dot product instructions.
+    //
+
+    if (MlasDotProductInstructionsSupported()) {
+        this->GemmU8X8Operation = MlasGemmU8X8Operation<MLAS_GEMM_U8X8_KERNEL_UDOT>;
+        this->GemmU8X8PackedOperation = MlasGemmU8X8PackedOperation<MLAS_GEMM_U8X8_KERNEL_UDOT>;
+    }
+
+#endif
+
+#endif // MLAS_TARGET_ARM64
+
 }
 
 size_t
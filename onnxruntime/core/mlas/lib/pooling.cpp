@@ -30,6 +30,8 @@ struct MLAS_POOL_WORK_BLOCK
     int64_t KernelShape[3];
     int64_t Padding[6];
     int64_t StrideShape[3];
+    const size_t* LastDimWindowStart;
+    const size_t* LastDimWindowEnd;
 };
 
 //
@@ -62,6 +64,15 @@ typedef MLAS_POOL_KERNEL_ROUTINE* PMLAS_POOL_KERNEL_ROUTINE;
 
 #define MLAS_POOL_REDUCTION_BUFFER_PADDING  ((sizeof(MLAS_FLOAT32X4) / sizeof(float)) - 1)
 
+//
+// Define the number of output elements along the last dimension for which
+// the clamped pooling window bounds are precomputed on the stack, so the
+// innermost loops of the generic kernels avoid recomputing the clamping for
+// every output element of every channel.
+//
+
+#define MLAS_POOL_WINDOW_BOUNDS_STACK       512
+
 //
 // Abstraction for maximum pooling.
 //
@@ -286,15 +297,29 @@ Return Value:
     const int64_t PaddingLeftWidth = WorkBlock->Padding[WidthShapeIndex];
     const int64_t StrideWidth = WorkBlock->StrideShape[WidthShapeIndex];
 
+    const size_t* WindowStartTable = WorkBlock->LastDimWindowStart;
+    const size_t* WindowEndTable = WorkBlock->LastDimWindowEnd;
+
     for (size_t c = 0; c < ChannelCount; c++) {
 
         for (size_t pw = 0; pw < OutputWidth; pw++) {
 
-            const int64_t iwStart64 = pw * StrideWidth - PaddingLeftWidth;
-            const int64_t iwEnd64 = iwStart64 + KernelWidth;
+            size_t iwStart;
+            size_t iwEnd;
+
+            if (WindowStartTable != nullptr) {
+
+                iwStart = WindowStartTable[pw];
+                iwEnd = WindowEndTable[pw];
 
-            const size_t iwStart = size_t(std::max(iwStart64, int64_t(0)));
-            const size_t iwEnd = size_t(std::min(iwEnd64, int64_t(InputWidth)));
+            } else {
+
+                const int64_t iwStart64 = pw * StrideWidth - PaddingLeftWidth;
+                const int64_t iwEnd64 = iwStart64 + KernelWidth;
+
+                iwStart = size_t(std::max(iwStart64, int64_t(0)));
+                iwEnd = size_t(std::min(iwEnd64, int64_t(InputWidth)));
+            }
 
             float m = PoolingType::InitialValue();
 
@@ -363,6 +388,9 @@ Return Value:
     const int64_t StrideHeight = WorkBlock->StrideShape[HeightShapeIndex];
     const int64_t StrideWidth = WorkBlock->StrideShape[WidthShapeIndex];
 
+    const size_t* WindowStartTable = WorkBlock->LastDimWindowStart;
+    const size_t* WindowEndTable = WorkBlock->LastDimWindowEnd;
+
     for (size_t c = 0; c < ChannelCount; c++) {
 
         for (size_t ph = 0; ph < OutputHeight; ph++) {
@@ -375,11 +403,22 @@ Return Value:
 
             for (size_t pw = 0; pw < OutputWidth; pw++) {
 
-                const int64_t iwStart64 = pw * StrideWidth - PaddingLeftWidth;
-                const int64_t iwEnd64 = iwStart64 + KernelWidth;
+                size_t iwStart;
+                size_t iwEnd;
 
-                const size_t iwStart = size_t(std::max(iwStart64, int64_t(0)));
-                const size_t iwEnd = size_t(std::min(iwEnd64, int64_t(InputWidth)));
+                if (WindowStartTable != nullptr) {
+
+                    iwStart = WindowStartTable[pw];
+                    iwEnd = WindowEndTable[pw];
+
+                } else {
+
+                    const int64_t iwStart64 = pw * StrideWidth - PaddingLeftWidth;
+                    const int64_t iwEnd64 = iwStart64 + KernelWidth;
+
+                    iwStart = size_t(std::max(iwStart64, int64_t(0)));
+                    iwEnd = size_t(std::min(iwEnd64, int64_t(InputWidth)));
+                }
 
                 float m = PoolingType::InitialValue();
 
@@ -679,6 +718,9 @@ Return Value:
     const int64_t StrideHeight = WorkBlock->StrideShape[HeightShapeIndex];
     const int64_t StrideWidth = WorkBlock->StrideShape[WidthShapeIndex];
 
+    const size_t* WindowStartTable = WorkBlock->LastDimWindowStart;
+    const size_t* WindowEndTable = WorkBlock->LastDimWindowEnd;
+
     for (size_t c = 0; c < ChannelCount; c++) {
 
         for (size_t pd = 0; pd < OutputDepth; pd++) {
@@ -699,11 +741,22 @@ Return Value:
 
                 for (size_t pw = 0; pw < OutputWidth; pw++) {
 
-                    const int64_t iwStart64 = pw * StrideWidth - PaddingLeftWidth;
-                    const int64_t iwEnd64 = iwStart64 + KernelWidth;
+                    size_t iwStart;
+                    size_t iwEnd;
+
+                    if (WindowStartTable != nullptr) {
+
+                        iwStart = WindowStartTable[pw];
+                        iwEnd = WindowEndTable[pw];
 
-                    const size_t iwStart = size_t(std::max(iwStart64, int64_t(0)));
-                    const size_t iwEnd = size_t(std::min(iwEnd64, int64_t(InputWidth)));
+                    } else {
+
+                        const int64_t iwStart64 = pw * StrideWidth - PaddingLeftWidth;
+                        const int64_t iwEnd64 = iwStart64 + KernelWidth;
+
+                        iwStart = size_t(std::max(iwStart64, int64_t(0)));
+                        iwEnd = size_t(std::min(iwEnd64, int64_t(InputWidth)));
+                    }
 
                     float m = PoolingType::InitialValue();
 
@@ -1276,6 +1329,40 @@ Return Value:
         }
     }
 
+    //
+    // Precompute the clamped pooling window bounds along the last dimension
+    // for the generic kernels, which would otherwise recompute the clamping
+    // for every output element of every channel.
+    //
+
+    size_t WindowBounds[MLAS_POOL_WINDOW_BOUNDS_STACK * 2];
+
+    WorkBlock.LastDimWindowStart = nullptr;
+    WorkBlock.LastDimWindowEnd = nullptr;
+
+    const size_t LastDimOutputWidth = WorkBlock.OutputShape[Dimensions - 1];
+
+    if (PoolKernelRoutine == MlasPoolGenericKernels[PoolingKind][Dimensions - 1] &&
+        LastDimOutputWidth <= MLAS_POOL_WINDOW_BOUNDS_STACK) {
+
+        const int64_t KernelWidth = WorkBlock.KernelShape[Dimensions - 1];
+        const int64_t PaddingLeftWidth = WorkBlock.Padding[Dimensions - 1];
+        const int64_t StrideWidth = WorkBlock.StrideShape[Dimensions - 1];
+        const int64_t InputWidth = int64_t(WorkBlock.InputShape[Dimensions - 1]);
+
+        for (size_t pw = 0; pw < LastDimOutputWidth; pw++) {
+
+            const int64_t iwStart64 = pw * StrideWidth - PaddingLeftWidth;
+            const int64_t iwEnd64 = iwStart64 + KernelWidth;
+
+            WindowBounds[pw] = size_t(std::max(iwStart64, int64_t(0)));
+            WindowBounds[LastDimOutputWidth + pw] = size_t(std::min(iwEnd64, InputWidth));
+        }
+
+        WorkBlock.LastDimWindowStart = &WindowBounds[0];
+        WorkBlock.LastDimWindowEnd = &WindowBounds[LastDimOutputWidth];
+    }
+
 #ifdef MLAS_NO_ONNXRUNTIME_THREADPOOL
     MLAS_UNREFERENCED_PARAMETER(ThreadPool);
     //
@@ -1298,6 +1385,62 @@ Return Value:
     //
     // Use an external thread pool if one is provided.
     // TODO: change to use MlasExecuteThreaded
+
+    //
+    // When the channel count alone cannot occupy the available threads, also
+    // partition the outermost pooling dimension into blocks of output rows.
+    // Each task views its block as a smaller tensor by slicing the input and
+    // compensating the leading padding, which leaves the window clamping (and
+    // thus the exclude-pad divisors) identical to the unpartitioned case.
+    //
+
+    const size_t MaximumThreadCount = size_t(MlasGetMaximumThreadCount(ThreadPool));
+    const size_t OutputRows = WorkBlock.OutputShape[0];
+
+    if (Dimensions >= 2 && OutputRows > 1 && WorkBlock.InputShape[0] > 0 &&
+        PoolKernelRoutine != MlasPoolGlobalKernels[PoolingKind] &&
+        TotalChannelCount < MaximumThreadCount) {
+
+        size_t RowBlockCount = (MaximumThreadCount + TotalChannelCount - 1) / TotalChannelCount;
+        RowBlockCount = std::min(RowBlockCount, OutputRows);
+
+        const size_t RowsPerBlock = (OutputRows + RowBlockCount - 1) / RowBlockCount;
+        RowBlockCount = (OutputRows + RowsPerBlock - 1) / RowsPerBlock;
+
+        const size_t InputRowStride = InputSize / WorkBlock.InputShape[0];
+        const size_t OutputRowStride = OutputSize / OutputRows;
+
+        onnxruntime::concurrency::ThreadPool::TryBatchParallelFor(ThreadPool,
+            static_cast<ptrdiff_t>(TotalChannelCount * RowBlockCount), [&](ptrdiff_t Index) {
+
+          const size_t c = size_t(Index) / RowBlockCount;
+          const size_t RowBegin = (size_t(Index) % RowBlockCount) * RowsPerBlock;
+          const size_t RowEnd = std::min(RowBegin + RowsPerBlock, OutputRows);
+
+          const int64_t WindowStart = int64_t(RowBegin) * WorkBlock.StrideShape[0] -
+              WorkBlock.Padding[0];
+          const int64_t WindowEnd = int64_t(RowEnd - 1) * WorkBlock.StrideShape[0] -
+              WorkBlock.Padding[0] + WorkBlock.KernelShape[0];
+
+          const int64_t SliceBegin = std::max(WindowStart, int64_t(0));
+          const int64_t SliceEnd = std::max(std::min(WindowEnd, int64_t(WorkBlock.InputShape[0])),
+                                            SliceBegin);
+
+          MLAS_POOL_WORK_BLOCK BlockView = WorkBlock;
+
+          BlockView.InputShape[0] = size_t(SliceEnd - SliceBegin);
+          BlockView.InputSize = BlockView.InputShape[0] * InputRowStride;
+          BlockView.OutputShape[0] = RowEnd - RowBegin;
+          BlockView.Padding[0] = SliceBegin - WindowStart;
+
+          PoolKernelRoutine(&BlockView, 1,
+                            Input + c * InputSize + size_t(SliceBegin) * InputRowStride,
+                            Output + c * OutputSize + RowBegin * OutputRowStride);
+        }, 0);
+
+        return;
+    }
+
     onnxruntime::concurrency::ThreadPool::TryBatchParallelFor(ThreadPool, static_cast<ptrdiff_t>(TotalChannelCount), [&](ptrdiff_t c) {
       PoolKernelRoutine(&WorkBlock, 1, Input + c * InputSize, Output + c * OutputSize);
     }, 0);
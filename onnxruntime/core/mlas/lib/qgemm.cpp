@@ -1928,6 +1928,507 @@ constexpr size_t MLAS_GEMM_U8X8_KERNEL_NEON::PackedK;
 constexpr MLAS_GEMM_U8X8_STRIDES MLAS_GEMM_U8X8_KERNEL_NEON::Strides;
 constexpr MLAS_GEMM_U8X8_STRIDES MLAS_GEMM_U8X8_KERNEL_NEON::PackedStrides;
 
+template
+void
+MLASCALL
+MlasGemmU8X8Operation<MLAS_GEMM_U8X8_KERNEL_NEON>(
+    const MLAS_GEMM_U8X8_WORK_BLOCK* WorkBlock
+    );
+
+template
+void
+MLASCALL
+MlasGemmU8X8PackedOperation<MLAS_GEMM_U8X8_KERNEL_NEON>(
+    const MLAS_GEMM_U8X8_WORK_BLOCK* WorkBlock
+    );
+
+#if defined(MLAS_UDOT_INTRINSICS)
+
+//
+// Emits a dot product of a block of four unsigned 8-bit values from each of
+// the four columns of MatrixB against the block of four values selected by
+// Lane from MatrixA, accumulating into the four 32-bit lanes of Accumulator.
+//
+// This is a macro instead of a helper function so the lane number remains an
+// immediate operand of the UDOT instruction.
+//
+
+#define MlasGemmU8X8DotLaneUdot(Accumulator, MatrixB, MatrixA, Lane) \
+    vreinterpretq_s32_u32(vdotq_laneq_u32(vreinterpretq_u32_s32(Accumulator), (MatrixB), (MatrixA), (Lane)))
+
+void
+MlasGemmU8X8CopyPackBUdot(
+    uint8_t* D,
+    const uint8_t* B,
+    size_t ldb,
+    size_t CountN,
+    size_t CountK,
+    int32_t* ColumnSumBuffer,
+    bool BIsSigned
+    )
+/*++
+
+Routine Description:
+
+    This routine copies elements from the source matrix to the destination
+    packed buffer using the layout expected by the UDOT kernel.
+
+    Columns are processed in groups of eight. Each block of four rows is
+    transposed so that every column stores its four K values contiguously:
+
+        [ B00 B10 B20 B30 B01 B11 B21 B31 ... B07 B17 B27 B37 ]
+
+    which lets a 16 byte vector load feed four columns of the UDOT
+    instruction's per-lane dot product directly.
+
+Arguments:
+
+    D - Supplies the address of the destination packed buffer.
+
+    B - Supplies the address of the source matrix.
+
+    ldb - Supplies the number of elements per row of the source matrix.
+
+    CountN - Supplies the number of columns of the source matrix to copy.
+
+    CountK - Supplies the number of rows of the source matrix to copy.
+
+    ColumnSumBuffer - Supplies the address of the buffer to receive the sums of
+        the elements along each of the columns.
+
+    BIsSigned - Supplies true if the source matrix is signed data, else false
+        if the source matrix is unsigned data.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const uint8x8_t BitFlipVector = vdup_n_u8(BIsSigned ? 0x80 : 0);
+    const uint8x8_t ZeroVector = vmov_n_u8(0);
+
+    //
+    // Copy columns from matrix B to the packed buffer. Signed buffers are
+    // converted to unsigned buffers in order to share a common kernel.
+    //
+    // If CountK is not aligned to a multiple of four, then the packed buffer
+    // is padded with zero vectors.
+    //
+    // If CountN is not aligned to a multiple of eight, then the extra columns
+    // are padded with zeroes.
+    //
+
+    while (CountN > 0) {
+
+        const size_t Columns = std::min(CountN, size_t(8));
+        uint32x4_t ColumnSums[2];
+
+        ColumnSums[0] = vmovq_n_u32(0);
+        ColumnSums[1] = vmovq_n_u32(0);
+
+        for (size_t k = 0; k < CountK; k += 4) {
+
+            uint8x8x4_t BlockRows;
+
+            for (size_t i = 0; i < 4; i++) {
+
+                uint8x8_t BytesRow;
+
+                if (k + i < CountK) {
+
+                    const uint8_t* b = B + (k + i) * ldb;
+
+                    if (Columns == 8) {
+                        BytesRow = vld1_u8(b);
+                    } else {
+
+                        //
+                        // Copy the remaining columns to the zero padded stack
+                        // buffer.
+                        //
+
+                        uint8_t PaddedMatrixBData[8];
+
+                        vst1_u8(PaddedMatrixBData, ZeroVector);
+
+                        for (size_t n = 0; n < Columns; n++) {
+                            PaddedMatrixBData[n] = b[n];
+                        }
+
+                        BytesRow = vld1_u8(PaddedMatrixBData);
+                    }
+
+                    BytesRow = veor_u8(BytesRow, BitFlipVector);
+
+                    uint16x8_t WordsRow = vmovl_u8(BytesRow);
+                    ColumnSums[0] = vaddq_u32(ColumnSums[0], vmovl_u16(vget_low_u16(WordsRow)));
+                    ColumnSums[1] = vaddq_u32(ColumnSums[1], vmovl_high_u16(WordsRow));
+
+                } else {
+                    BytesRow = ZeroVector;
+                }
+
+                BlockRows.val[i] = BytesRow;
+            }
+
+            vst4_u8(D, BlockRows);
+            D += 32;
+        }
+
+        vst1q_s32(&ColumnSumBuffer[0], vreinterpretq_s32_u32(ColumnSums[0]));
+        vst1q_s32(&ColumnSumBuffer[4], vreinterpretq_s32_u32(ColumnSums[1]));
+        ColumnSumBuffer += 8;
+
+        B += 8;
+        CountN -= Columns;
+    }
+}
+
+MLAS_UDOT_TARGET
+MLAS_FORCEINLINE
+void
+MlasGemmU8X8StoreRowUdot(
+    int32_t* C,
+    int32x4_t Accumulator0,
+    int32x4_t Accumulator1,
+    size_t Columns,
+    bool ZeroMode
+    )
+{
+    if (Columns == 8) {
+
+        if (!ZeroMode) {
+            Accumulator0 = vaddq_s32(Accumulator0, vld1q_s32(&C[0]));
+            Accumulator1 = vaddq_s32(Accumulator1, vld1q_s32(&C[4]));
+        }
+
+        vst1q_s32(&C[0], Accumulator0);
+        vst1q_s32(&C[4], Accumulator1);
+
+    } else {
+
+        int32_t Buffer[8];
+
+        vst1q_s32(&Buffer[0], Accumulator0);
+        vst1q_s32(&Buffer[4], Accumulator1);
+
+        for (size_t n = 0; n < Columns; n++) {
+            C[n] = ZeroMode ? Buffer[n] : C[n] + Buffer[n];
+        }
+    }
+}
+
+MLAS_UDOT_TARGET
+size_t
+MlasGemmU8X8KernelUdot(
+    const uint8_t* A,
+    const uint8_t* B,
+    int32_t* C,
+    size_t PackedCountK,
+    size_t CountM,
+    size_t CountN,
+    size_t ldc,
+    const int32_t* RowSumBuffer,
+    const int32_t* ColumnSumBuffer,
+    int32_t DepthValue,
+    bool ZeroMode
+    )
+/*++
+
+Routine Description:
+
+    This routine is an inner kernel to compute matrix multiplication for a set
+    of rows using the ARMv8.2 dot product instructions.
+
+    Matrix A uses the same packed layout as the NEON kernel, where groups of
+    four rows interleave blocks of four K values per row, so the UDOT lane
+    selector picks out a row directly from a 16 byte vector load.
+
+Arguments:
+
+    A - Supplies the address of matrix A. The matrix data has been packed
+        using MlasGemmU8X8CopyPackANeon.
+
+    B - Supplies the address of matrix B. The matrix data has been packed
+        using MlasGemmU8X8CopyPackBUdot.
+
+    C - Supplies the address of matrix C.
+
+    PackedCountK - Supplies the number of packed columns from matrix A and the
+        number of packed rows from matrix B to iterate over.
+
+    CountM - Supplies the maximum number of rows that can be processed for
+        matrix A and matrix C. The actual number of rows handled for this
+        invocation depends on the kernel implementation.
+
+    CountN - Supplies the number of columns from matrix B and matrix C to
+        iterate over.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    RowSumBuffer - Supplies the sum of each row from matrix A multiplied by the
+        zero point offset of matrix B. These values are accumulated into every
+        row of matrix C.
+
+    ColumnSumBuffer - Supplies the sum of each column from matrix B multiplied
+        by the zero point offset of matrix A. These values are accumulated into
+        every column of matrix C.
+
+    DepthValue - Supplies the value CountK multiplied by the zero point offset
+        of matrix A multiplied by the zero point offset of matrix B. This value
+        is accumulated into every element of matrix C.
+
+    ZeroMode - Supplies true if the output matrix must be zero initialized,
+        else false if the output matrix is accumulated into.
+
+Return Value:
+
+    Returns the number of rows handled.
+
+--*/
+{
+    const size_t RowsHandled = (CountM >= 4) ? 4 : ((CountM >= 2) ? 2 : 1);
+
+    while (CountN > 0) {
+
+        const size_t Columns = std::min(CountN, size_t(8));
+
+        const int32x4_t ColumnSums0 = vld1q_s32(&ColumnSumBuffer[0]);
+        const int32x4_t ColumnSums1 = vld1q_s32(&ColumnSumBuffer[4]);
+
+        const uint8_t* a = A;
+
+        if (RowsHandled == 4) {
+
+            int32x4_t Accumulator00 = vaddq_s32(vdupq_n_s32(RowSumBuffer[0] + DepthValue), ColumnSums0);
+            int32x4_t Accumulator01 = vaddq_s32(vdupq_n_s32(RowSumBuffer[0] + DepthValue), ColumnSums1);
+            int32x4_t Accumulator10 = vaddq_s32(vdupq_n_s32(RowSumBuffer[1] + DepthValue), ColumnSums0);
+            int32x4_t Accumulator11 = vaddq_s32(vdupq_n_s32(RowSumBuffer[1] + DepthValue), ColumnSums1);
+            int32x4_t Accumulator20 = vaddq_s32(vdupq_n_s32(RowSumBuffer[2] + DepthValue), ColumnSums0);
+            int32x4_t Accumulator21 = vaddq_s32(vdupq_n_s32(RowSumBuffer[2] + DepthValue), ColumnSums1);
+            int32x4_t Accumulator30 = vaddq_s32(vdupq_n_s32(RowSumBuffer[3] + DepthValue), ColumnSums0);
+            int32x4_t Accumulator31 = vaddq_s32(vdupq_n_s32(RowSumBuffer[3] + DepthValue), ColumnSums1);
+
+            for (size_t k = 0; k < PackedCountK; k++) {
+
+                const uint8x16_t MatrixA = vld1q_u8(a);
+                const uint8x16_t MatrixB0 = vld1q_u8(&B[0]);
+                const uint8x16_t MatrixB1 = vld1q_u8(&B[16]);
+
+                Accumulator00 = MlasGemmU8X8DotLaneUdot(Accumulator00, MatrixB0, MatrixA, 0);
+                Accumulator01 = MlasGemmU8X8DotLaneUdot(Accumulator01, MatrixB1, MatrixA, 0);
+                Accumulator10 = MlasGemmU8X8DotLaneUdot(Accumulator10, MatrixB0, MatrixA, 1);
+                Accumulator11 = MlasGemmU8X8DotLaneUdot(Accumulator11, MatrixB1, MatrixA, 1);
+                Accumulator20 = MlasGemmU8X8DotLaneUdot(Accumulator20, MatrixB0, MatrixA, 2);
+                Accumulator21 = MlasGemmU8X8DotLaneUdot(Accumulator21, MatrixB1, MatrixA, 2);
+                Accumulator30 = MlasGemmU8X8DotLaneUdot(Accumulator30, MatrixB0, MatrixA, 3);
+                Accumulator31 = MlasGemmU8X8DotLaneUdot(Accumulator31, MatrixB1, MatrixA, 3);
+
+                a += 16;
+                B += 32;
+            }
+
+            MlasGemmU8X8StoreRowUdot(&C[0], Accumulator00, Accumulator01, Columns, ZeroMode);
+            MlasGemmU8X8StoreRowUdot(&C[ldc], Accumulator10, Accumulator11, Columns, ZeroMode);
+            MlasGemmU8X8StoreRowUdot(&C[ldc * 2], Accumulator20, Accumulator21, Columns, ZeroMode);
+            MlasGemmU8X8StoreRowUdot(&C[ldc * 3], Accumulator30, Accumulator31, Columns, ZeroMode);
+
+        } else if (RowsHandled == 2) {
+
+            int32x4_t Accumulator00 = vaddq_s32(vdupq_n_s32(RowSumBuffer[0] + DepthValue), ColumnSums0);
+            int32x4_t Accumulator01 = vaddq_s32(vdupq_n_s32(RowSumBuffer[0] + DepthValue), ColumnSums1);
+            int32x4_t Accumulator10 = vaddq_s32(vdupq_n_s32(RowSumBuffer[1] + DepthValue), ColumnSums0);
+            int32x4_t Accumulator11 = vaddq_s32(vdupq_n_s32(RowSumBuffer[1] + DepthValue), ColumnSums1);
+
+            for (size_t k = 0; k < PackedCountK; k++) {
+
+                const uint8x8_t RowPair = vld1_u8(a);
+                const uint8x16_t MatrixA = vcombine_u8(RowPair, RowPair);
+                const uint8x16_t MatrixB0 = vld1q_u8(&B[0]);
+                const uint8x16_t MatrixB1 = vld1q_u8(&B[16]);
+
+                Accumulator00 = MlasGemmU8X8DotLaneUdot(Accumulator00, MatrixB0, MatrixA, 0);
+                Accumulator01 = MlasGemmU8X8DotLaneUdot(Accumulator01, MatrixB1, MatrixA, 0);
+                Accumulator10 = MlasGemmU8X8DotLaneUdot(Accumulator10, MatrixB0, MatrixA, 1);
+                Accumulator11 = MlasGemmU8X8DotLaneUdot(Accumulator11, MatrixB1, MatrixA, 1);
+
+                a += 8;
+                B += 32;
+            }
+
+            MlasGemmU8X8StoreRowUdot(&C[0], Accumulator00, Accumulator01, Columns, ZeroMode);
+            MlasGemmU8X8StoreRowUdot(&C[ldc], Accumulator10, Accumulator11, Columns, ZeroMode);
+
+        } else {
+
+            int32x4_t Accumulator00 = vaddq_s32(vdupq_n_s32(RowSumBuffer[0] + DepthValue), ColumnSums0);
+            int32x4_t Accumulator01 = vaddq_s32(vdupq_n_s32(RowSumBuffer[0] + DepthValue), ColumnSums1);
+
+            for (size_t k = 0; k < PackedCountK; k++) {
+
+                const uint8x16_t MatrixA =
+                    vreinterpretq_u8_u32(vld1q_dup_u32(reinterpret_cast<const uint32_t*>(a)));
+                const uint8x16_t MatrixB0 = vld1q_u8(&B[0]);
+                const uint8x16_t MatrixB1 = vld1q_u8(&B[16]);
+
+                Accumulator00 = MlasGemmU8X8DotLaneUdot(Accumulator00, MatrixB0, MatrixA, 0);
+                Accumulator01 = MlasGemmU8X8DotLaneUdot(Accumulator01, MatrixB1, MatrixA, 0);
+
+                a += 4;
+                B += 32;
+            }
+
+            MlasGemmU8X8StoreRowUdot(&C[0], Accumulator00, Accumulator01, Columns, ZeroMode);
+        }
+
+        C += 8;
+        ColumnSumBuffer += 8;
+        CountN -= Columns;
+    }
+
+    return RowsHandled;
+}
+
+struct MLAS_GEMM_U8X8_KERNEL_UDOT
+{
+    typedef uint8_t PackedAType;
+    typedef uint8_t PackedBType;
+    typedef uint8_t OffsetBType;
+
+    static constexpr size_t PackedK = 4;
+    static constexpr MLAS_GEMM_U8X8_STRIDES Strides{24, 128, 256};
+    static constexpr MLAS_GEMM_U8X8_STRIDES PackedStrides{24, 256, 128};
+
+    MLAS_FORCEINLINE
+    static
+    bool
+    TryGemvKernel(
+        const uint8_t* A,
+        const uint8_t* B,
+        size_t ldb,
+        int32_t* C,
+        size_t CountK,
+        size_t CountN,
+        bool BIsSigned
+        )
+    {
+        MLAS_UNREFERENCED_PARAMETER(A);
+        MLAS_UNREFERENCED_PARAMETER(B);
+        MLAS_UNREFERENCED_PARAMETER(ldb);
+        MLAS_UNREFERENCED_PARAMETER(C);
+        MLAS_UNREFERENCED_PARAMETER(CountK);
+        MLAS_UNREFERENCED_PARAMETER(CountN);
+        MLAS_UNREFERENCED_PARAMETER(BIsSigned);
+
+        return false;
+    }
+
+    MLAS_FORCEINLINE
+    static
+    int32_t
+    FixupZeroPointB(
+        int32_t offb,
+        bool BIsSigned
+        )
+    {
+        if (BIsSigned) {
+            offb = OffsetBType(offb ^ 0x80);
+        }
+
+        return offb;
+    }
+
+    MLAS_FORCEINLINE
+    static
+    void
+    CopyPackA(
+        PackedAType* D,
+        const uint8_t* A,
+        size_t lda,
+        size_t CountM,
+        size_t CountK,
+        int32_t* RowSumBuffer
+        )
+    {
+        //
+        // The NEON packed layout for matrix A is already arranged as blocks
+        // of four K values per row, which is what the UDOT lane selector
+        // consumes, so the packing routine is shared.
+        //
+
+        MlasGemmU8X8CopyPackANeon(D, A, lda, CountM, CountK, RowSumBuffer);
+    }
+
+    MLAS_FORCEINLINE
+    static
+    void
+    CopyPackB(
+        PackedBType* D,
+        const uint8_t* B,
+        size_t ldb,
+        size_t CountN,
+        size_t CountK,
+        int32_t* ColumnSumBuffer,
+        bool BIsSigned
+        )
+    {
+        MlasGemmU8X8CopyPackBUdot(D, B, ldb, CountN, CountK, ColumnSumBuffer,
+            BIsSigned);
+    }
+
+    MLAS_FORCEINLINE
+    static
+    size_t
+    GemmKernel(
+        const PackedAType* A,
+        const PackedBType* B,
+        int32_t* C,
+        size_t PackedCountK,
+        size_t CountM,
+        size_t CountN,
+        size_t ldc,
+        const int32_t* RowSumBuffer,
+        const int32_t* ColumnSumBuffer,
+        int32_t DepthValue,
+        bool ZeroMode
+        )
+    {
+        return MlasGemmU8X8KernelUdot(A, B, C, PackedCountK, CountM, CountN, ldc,
+            RowSumBuffer, ColumnSumBuffer, DepthValue, ZeroMode);
+    }
+};
+
+constexpr size_t MLAS_GEMM_U8X8_KERNEL_UDOT::PackedK;
+constexpr MLAS_GEMM_U8X8_STRIDES MLAS_GEMM_U8X8_KERNEL_UDOT::Strides;
+constexpr MLAS_GEMM_U8X8_STRIDES MLAS_GEMM_U8X8_KERNEL_UDOT::PackedStrides;
+
+//
+// The packed buffer geometry of MlasGemmPackBSize is shared with the NEON
+// kernel, so both kernel types must agree on these parameters.
+//
+
+static_assert(MLAS_GEMM_U8X8_KERNEL_UDOT::PackedK == MLAS_GEMM_U8X8_KERNEL_NEON::PackedK,
+    "UDOT and NEON packed kernels must share the same packed K alignment");
+static_assert(MLAS_GEMM_U8X8_KERNEL_UDOT::PackedStrides.K == MLAS_GEMM_U8X8_KERNEL_NEON::PackedStrides.K,
+    "UDOT and NEON packed kernels must share the same packed K stride");
+
+template
+void
+MLASCALL
+MlasGemmU8X8Operation<MLAS_GEMM_U8X8_KERNEL_UDOT>(
+    const MLAS_GEMM_U8X8_WORK_BLOCK* WorkBlock
+    );
+
+template
+void
+MLASCALL
+MlasGemmU8X8PackedOperation<MLAS_GEMM_U8X8_KERNEL_UDOT>(
+    const MLAS_GEMM_U8X8_WORK_BLOCK* WorkBlock
+    );
+
+#endif // MLAS_UDOT_INTRINSICS
+
 #endif
 
 struct MLAS_GEMM_U8X8_KERNEL_DEFAULT
@@ -2195,7 +2696,12 @@ Return Value:
     GemmU8X8Operation(&WorkBlock);
 #elif defined(MLAS_SSE2_INTRINSICS)
     MlasGemmU8X8Operation<MLAS_GEMM_U8X8_KERNEL_SSE>(&WorkBlock);
-#elif defined(MLAS_NEON64_INTRINSICS) || (defined(MLAS_NEON32_INTRINSICS) && !defined(_MSC_VER))
+#elif defined(MLAS_NEON64_INTRINSICS)
+    PMLAS_GEMM_U8X8_OPERATION GemmU8X8Operation = WorkBlock.BIsPacked ?
+        MlasPlatform.GemmU8X8PackedOperation : MlasPlatform.GemmU8X8Operation;
+
+    GemmU8X8Operation(&WorkBlock);
+#elif defined(MLAS_NEON32_INTRINSICS) && !defined(_MSC_VER)
     if (WorkBlock.BIsPacked) {
         MlasGemmU8X8PackedOperation<MLAS_GEMM_U8X8_KERNEL_NEON>(&WorkBlock);
     } else {
@@ -2522,6 +3028,11 @@ Return Value:
 #elif defined(MLAS_NEON_INTRINSICS)
     MLAS_UNREFERENCED_PARAMETER(BIsSigned);
 
+    //
+    // The UDOT kernel shares the NEON packing parameters, so the buffer size
+    // is the same regardless of which kernel the platform selected.
+    //
+
     PackedK = MLAS_GEMM_U8X8_KERNEL_NEON::PackedK;
 #else
 #error Unknown architecture.
@@ -2607,6 +3118,11 @@ Return Value:
 #endif
     }
 #elif defined(MLAS_NEON_INTRINSICS)
+    //
+    // The UDOT kernel shares the NEON packing parameters, so the kernel type
+    // only needs to be dispatched when copying the packed data below.
+    //
+
     PackedK = MLAS_GEMM_U8X8_KERNEL_NEON::PackedK;
     StrideK = MLAS_GEMM_U8X8_KERNEL_NEON::PackedStrides.K;
 #else
@@ -2656,6 +3172,12 @@ Return Value:
             } else {
                 MLAS_GEMM_U8U8_KERNEL_AVX2::CopyPackB(pb, B + n, ldb, CountN, CountK, ColumnSumBuffer, BIsSigned);
             }
+#elif defined(MLAS_UDOT_INTRINSICS)
+            if (MlasPlatform.GemmU8X8PackedOperation == &MlasGemmU8X8PackedOperation<MLAS_GEMM_U8X8_KERNEL_UDOT>) {
+                MLAS_GEMM_U8X8_KERNEL_UDOT::CopyPackB(pb, B + n, ldb, CountN, CountK, ColumnSumBuffer, BIsSigned);
+            } else {
+                MLAS_GEMM_U8X8_KERNEL_NEON::CopyPackB(pb, B + n, ldb, CountN, CountK, ColumnSumBuffer, BIsSigned);
+            }
 #elif defined(MLAS_NEON_INTRINSICS)
             MLAS_GEMM_U8X8_KERNEL_NEON::CopyPackB(pb, B + n, ldb, CountN, CountK, ColumnSumBuffer, BIsSigned);
 #else
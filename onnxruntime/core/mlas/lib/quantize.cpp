@@ -884,6 +884,13 @@ Return Value:
     const float MinimumValue = float(0 - ZeroPoint);
     const float MaximumValue = float(255 - ZeroPoint);
 
+    const MLAS_FLOAT32X4 PerMatrixScaleVector = MlasBroadcastFloat32x4(PerMatrixScaleValue);
+    const MLAS_FLOAT32X4 MinimumValueVector = MlasBroadcastFloat32x4(MinimumValue);
+    const MLAS_FLOAT32X4 MaximumValueVector = MlasBroadcastFloat32x4(MaximumValue);
+    const MLAS_FLOAT32X4 RoundingBiasVector = MlasBroadcastFloat32x4(MLAS_ROUNDING_BIAS_MAGIC);
+    const MLAS_INT32X4 RoundingBiasBitsVector = MlasBroadcastInt32x4(MLAS_ROUNDING_BIAS_MAGIC_BITS);
+    const MLAS_INT32X4 ZeroPointVector = MlasBroadcastInt32x4(ZeroPoint);
+
     //
     // Step through each row of the output matrix.
     //
@@ -894,6 +901,56 @@ Return Value:
         const float* scale = Scale;
         size_t n = N;
 
+        //
+        // Process four columns of the row using the fast rounding trick
+        // adapted from XNNPACK: bias the floating point value by the first
+        // floating point value that has no fractional bits. The add operation
+        // performs the "round to nearest even". Extract the mantissa bits
+        // from this floating point value to obtain the rounded integer value.
+        //
+
+        while (n >= 4) {
+
+            MLAS_INT32X4 IntegerVector = MlasLoadInt32x4(Input);
+            Input += 4;
+
+            if (bias != nullptr) {
+                IntegerVector = MlasAddInt32x4(IntegerVector, MlasLoadInt32x4(bias));
+                bias += 4;
+            }
+
+            MLAS_FLOAT32X4 ScaleVector;
+
+            if (PerColumnScale) {
+                ScaleVector = MlasLoadFloat32x4(scale);
+                scale += 4;
+            } else {
+                ScaleVector = PerMatrixScaleVector;
+            }
+
+            MLAS_FLOAT32X4 FloatVector = MlasCastToFloat32x4(IntegerVector);
+
+            FloatVector = MlasMultiplyFloat32x4(FloatVector, ScaleVector);
+            FloatVector = MlasMaximumFloat32x4(FloatVector, MinimumValueVector);
+            FloatVector = MlasMinimumFloat32x4(FloatVector, MaximumValueVector);
+
+            FloatVector = MlasAddFloat32x4(FloatVector, RoundingBiasVector);
+            IntegerVector = MlasSubtractInt32x4(MlasReinterpretAsInt32x4(FloatVector),
+                RoundingBiasBitsVector);
+            IntegerVector = MlasAddInt32x4(IntegerVector, ZeroPointVector);
+
+            int32_t IntegerValues[4];
+            MlasStoreInt32x4(IntegerValues, IntegerVector);
+
+            Output[0] = uint8_t(IntegerValues[0]);
+            Output[1] = uint8_t(IntegerValues[1]);
+            Output[2] = uint8_t(IntegerValues[2]);
+            Output[3] = uint8_t(IntegerValues[3]);
+            Output += 4;
+
+            n -= 4;
+        }
+
         while (n > 0) {
 
             int32_t IntegerValue = *Input++;
@@ -909,14 +966,6 @@ Return Value:
             FloatValue = std::max(FloatValue, MinimumValue);
             FloatValue = std::min(FloatValue, MaximumValue);
 
-            //
-            // Use the fast rounding trick adapted from XNNPACK: bias the floating
-            // point value by the first floating point value that has no
-            // fractional bits. The add operation performs the "round to nearest
-            // even". Extract the mantissa bits from this floating point value to
-            // obtain the rounded integer value.
-            //
-
             IntegerValue = int32_t(MlasBitsOfFp32(FloatValue + MLAS_ROUNDING_BIAS_MAGIC)) -
                 MLAS_ROUNDING_BIAS_MAGIC_BITS;
 
@@ -965,3 +1014,240 @@ Return Value:
     MlasReduceMinimumMaximumF32Kernel(Input, Min, Max, N);
 #endif
 }
+
+//
+// Threaded implementations of the dynamic quantization helpers. The input
+// buffer is partitioned into contiguous shards that are processed with the
+// single threaded routines above.
+//
+
+constexpr int32_t MlasFindMinMaxMaximumThreadCount = 16;
+
+struct MLAS_FIND_MIN_MAX_WORK_BLOCK {
+    int32_t ThreadCountN;
+    const float* Input;
+    size_t N;
+    float Minimums[MlasFindMinMaxMaximumThreadCount];
+    float Maximums[MlasFindMinMaxMaximumThreadCount];
+};
+
+void
+MlasFindMinMaxElementThreaded(
+    void* Context,
+    int32_t Index
+    )
+{
+    auto* WorkBlock = (MLAS_FIND_MIN_MAX_WORK_BLOCK*)Context;
+
+    size_t n;
+    size_t CountN;
+    MlasPartitionWork(Index, WorkBlock->ThreadCountN, WorkBlock->N, &n, &CountN);
+
+    MlasFindMinMaxElement(WorkBlock->Input + n, &WorkBlock->Minimums[Index],
+        &WorkBlock->Maximums[Index], CountN);
+}
+
+void
+MLASCALL
+MlasFindMinMaxElement(
+    const float* Input,
+    float* Min,
+    float* Max,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine finds the minimum and maximum values of the supplied buffer
+    using multiple threads, with each shard reduced by the vectorized kernel
+    and the per-shard results combined at the end.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Min - Returns the minimum value of the supplied buffer.
+
+    Max - Returns the maximum value of the supplied buffer.
+
+    N - Supplies the number of elements to process.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Compute the number of target threads given the size of the buffer.
+    // Limit the number of threads to the fixed size of the per-shard result
+    // arrays and try to keep each thread processing a minimum number of
+    // elements before using another thread.
+    //
+
+    int32_t ThreadCountN = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (ThreadCountN > MlasFindMinMaxMaximumThreadCount) {
+        ThreadCountN = MlasFindMinMaxMaximumThreadCount;
+    }
+
+    constexpr size_t MinimumElementsPerThread = 16384;
+
+    size_t BlockCount = (N / MinimumElementsPerThread) + 1;
+
+    if (size_t(ThreadCountN) > BlockCount) {
+        ThreadCountN = int32_t(BlockCount);
+    }
+
+    if (ThreadCountN <= 1) {
+        MlasFindMinMaxElement(Input, Min, Max, N);
+        return;
+    }
+
+    MLAS_FIND_MIN_MAX_WORK_BLOCK WorkBlock;
+
+    WorkBlock.ThreadCountN = ThreadCountN;
+    WorkBlock.Input = Input;
+    WorkBlock.N = N;
+
+    MlasExecuteThreaded(MlasFindMinMaxElementThreaded, &WorkBlock, ThreadCountN, ThreadPool);
+
+    float MinimumValue = WorkBlock.Minimums[0];
+    float MaximumValue = WorkBlock.Maximums[0];
+
+    for (int32_t i = 1; i < ThreadCountN; i++) {
+        MinimumValue = std::min(MinimumValue, WorkBlock.Minimums[i]);
+        MaximumValue = std::max(MaximumValue, WorkBlock.Maximums[i]);
+    }
+
+    *Min = MinimumValue;
+    *Max = MaximumValue;
+}
+
+template<typename OutputType>
+struct MLAS_QUANTIZE_LINEAR_WORK_BLOCK {
+    int32_t ThreadCountN;
+    const float* Input;
+    OutputType* Output;
+    size_t N;
+    float Scale;
+    OutputType ZeroPoint;
+};
+
+template<typename OutputType>
+void
+MlasQuantizeLinearThreaded(
+    void* Context,
+    int32_t Index
+    )
+{
+    const auto* WorkBlock = (MLAS_QUANTIZE_LINEAR_WORK_BLOCK<OutputType>*)Context;
+
+    size_t n;
+    size_t CountN;
+    MlasPartitionWork(Index, WorkBlock->ThreadCountN, WorkBlock->N, &n, &CountN);
+
+    MlasQuantizeLinear(WorkBlock->Input + n, WorkBlock->Output + n, CountN,
+        WorkBlock->Scale, WorkBlock->ZeroPoint);
+}
+
+template<typename OutputType>
+void
+MLASCALL
+MlasQuantizeLinear(
+    const float* Input,
+    OutputType* Output,
+    size_t N,
+    float Scale,
+    OutputType ZeroPoint,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine quantizes the input buffer using the supplied quantization
+    parameters, partitioning the work across multiple threads.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    N - Supplies the number of elements to process.
+
+    Scale - Supplies the quantization scale.
+
+    ZeroPoint - Supplies the quantization zero point value.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Compute the number of target threads given the size of the buffer. Try
+    // to keep each thread processing a minimum number of elements before
+    // using another thread.
+    //
+
+    int32_t ThreadCountN = MlasGetMaximumThreadCount(ThreadPool);
+
+    constexpr size_t MinimumElementsPerThread = 16384;
+
+    size_t BlockCount = (N / MinimumElementsPerThread) + 1;
+
+    if (size_t(ThreadCountN) > BlockCount) {
+        ThreadCountN = int32_t(BlockCount);
+    }
+
+    if (ThreadCountN <= 1) {
+        MlasQuantizeLinear(Input, Output, N, Scale, ZeroPoint);
+        return;
+    }
+
+    MLAS_QUANTIZE_LINEAR_WORK_BLOCK<OutputType> WorkBlock;
+
+    WorkBlock.ThreadCountN = ThreadCountN;
+    WorkBlock.Input = Input;
+    WorkBlock.Output = Output;
+    WorkBlock.N = N;
+    WorkBlock.Scale = Scale;
+    WorkBlock.ZeroPoint = ZeroPoint;
+
+    MlasExecuteThreaded(MlasQuantizeLinearThreaded<OutputType>, &WorkBlock, ThreadCountN, ThreadPool);
+}
+
+template
+void
+MLASCALL
+MlasQuantizeLinear<int8_t>(
+    const float* Input,
+    int8_t* Output,
+    size_t N,
+    float Scale,
+    int8_t ZeroPoint,
+    MLAS_THREADPOOL* ThreadPool
+    );
+
+template
+void
+MLASCALL
+MlasQuantizeLinear<uint8_t>(
+    const float* Input,
+    uint8_t* Output,
+    size_t N,
+    float Scale,
+    uint8_t ZeroPoint,
+    MLAS_THREADPOOL* ThreadPool
+    );
@@ -17,6 +17,28 @@ Abstract:
 
 #include "mlasi.h"
 
+//
+// Define the number of bytes to move per thread before dispatching additional
+// threads. The reorder operations are memory bound, so a modest chunk size
+// keeps the per-thread overhead small relative to the work.
+//
+
+#define MLAS_REORDER_THREAD_COMPLEXITY             (size_t(128) * size_t(1024))
+
+//
+// Define the parameters to execute segments of a reorder operation on worker
+// threads.
+//
+
+struct MLAS_REORDER_WORK_BLOCK {
+    int32_t ThreadCount;
+    const float* S;
+    float* D;
+    size_t Channels;
+    size_t SpatialSize;
+    size_t BatchCount;
+};
+
 MLAS_FORCEINLINE
 void
 MlasReorderGatherFloat32x4(
@@ -177,27 +199,32 @@ Return Value:
 #endif
 }
 
+static
 void
-MLASCALL
-MlasReorderInput(
-    const int64_t* InputShape,
+MlasReorderInputSegment(
     const float* S,
-    float* D
+    float* D,
+    size_t InputChannels,
+    size_t InputSize
     )
 /*++
 
 Routine Description:
 
-    This routine reorders an input buffer from NCHW to NCHWc format.
+    This routine reorders a segment of an input buffer from NCHW to NCHWc
+    format. The segment is a range of block aligned channels of the input
+    tensor.
 
 Arguments:
 
-    InputShape - Supplies the shape of the input tensor.
-
     S - Supplies the address of the source tensor.
 
     D - Supplies the address of the destination tensor.
 
+    InputChannels - Supplies the number of channels in this segment.
+
+    InputSize - Supplies the number of elements per channel.
+
 Return Value:
 
     None.
@@ -206,9 +233,6 @@ Return Value:
 {
     const size_t BlockSize = MlasNchwcGetBlockSize();
 
-    const size_t InputChannels = size_t(InputShape[0] * InputShape[1]);
-    const size_t InputSize = size_t(InputShape[2]) * size_t(InputShape[3]);
-
     const MLAS_FLOAT32X4 ZeroFloat32x4 = MlasZeroFloat32x4();
 
     for (size_t i = InputChannels; i > 0;) {
@@ -267,27 +291,87 @@ Return Value:
     }
 }
 
+static
+void
+MlasReorderInputThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of an
+    input reorder operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_REORDER_WORK_BLOCK*)Context;
+
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t InputChannels = WorkBlock->Channels;
+    const size_t InputSize = WorkBlock->SpatialSize;
+
+    //
+    // Partition the channel blocks across the thread count. Each channel
+    // block reads from and writes to an independent range of the buffers.
+    //
+
+    const size_t TotalBlocks = (InputChannels + BlockSize - 1) / BlockSize;
+
+    size_t BlockIndex;
+    size_t BlockCount;
+
+    MlasPartitionWork(ThreadId, WorkBlock->ThreadCount, TotalBlocks, &BlockIndex, &BlockCount);
+
+    if (BlockCount == 0) {
+        return;
+    }
+
+    const size_t SegmentOffset = BlockIndex * BlockSize * InputSize;
+    const size_t SegmentChannels =
+        std::min(InputChannels - BlockIndex * BlockSize, BlockCount * BlockSize);
+
+    MlasReorderInputSegment(WorkBlock->S + SegmentOffset, WorkBlock->D + SegmentOffset,
+                            SegmentChannels, InputSize);
+}
+
 void
 MLASCALL
-MlasReorderOutputNchw(
-    const int64_t* OutputShape,
+MlasReorderInput(
+    const int64_t* InputShape,
     const float* S,
-    float* D
+    float* D,
+    MLAS_THREADPOOL* ThreadPool
     )
 /*++
 
 Routine Description:
 
-    This routine reorders an output buffer from NCHWc to NCHW format.
+    This routine reorders an input buffer from NCHW to NCHWc format.
 
 Arguments:
 
-    OutputShape - Supplies the shape of the output tensor.
+    InputShape - Supplies the shape of the input tensor.
 
     S - Supplies the address of the source tensor.
 
     D - Supplies the address of the destination tensor.
 
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
 Return Value:
 
     None.
@@ -296,75 +380,295 @@ Return Value:
 {
     const size_t BlockSize = MlasNchwcGetBlockSize();
 
-    const size_t BatchCount = size_t(OutputShape[0]);
-    const size_t OutputChannels = size_t(OutputShape[1]);
-    const size_t OutputSize = size_t(OutputShape[2]) * size_t(OutputShape[3]);
+    const size_t InputChannels = size_t(InputShape[0] * InputShape[1]);
+    const size_t InputSize = size_t(InputShape[2]) * size_t(InputShape[3]);
 
     //
-    // Transpose NCHWc blocks from the source buffer to the destination buffer.
+    // Compute the number of target threads given the size of the tensor.
+    // Small requests should run using a single thread to avoid the overhead
+    // of the threaded dispatch.
     //
 
-    for (size_t batch = 0; batch < BatchCount; batch++) {
+    const size_t TotalBlocks = (InputChannels + BlockSize - 1) / BlockSize;
+    const size_t BytesToMove = TotalBlocks * BlockSize * InputSize * sizeof(float);
 
-        for (size_t o = OutputChannels; o > 0;) {
+    int32_t TargetThreadCount;
 
-            const size_t OutputChannelsThisIteration = std::min(o, BlockSize);
-            const size_t AlignedOutputChannelsThisIteration = OutputChannelsThisIteration & (~3);
-            o -= OutputChannelsThisIteration;
+    if (BytesToMove < MLAS_REORDER_THREAD_COMPLEXITY) {
+        TargetThreadCount = 1;
+    } else {
+        TargetThreadCount = int32_t(BytesToMove / MLAS_REORDER_THREAD_COMPLEXITY) + 1;
+    }
 
-            const float* s = S;
-            float* d = D;
-            size_t OutputSizeRemaining = OutputSize;
+    int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
 
-            for (; OutputSizeRemaining >= 4; OutputSizeRemaining -= 4) {
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
 
-                const float* ss = s;
-                float* dd = d;
-                size_t bc = 0;
+    if (size_t(TargetThreadCount) > TotalBlocks) {
+        TargetThreadCount = int32_t(TotalBlocks);
+    }
 
-                for (; bc < AlignedOutputChannelsThisIteration; bc += 4) {
-                    MlasReorderTransposeFloat32x4x4(ss, dd, BlockSize, OutputSize);
-                    ss += 4;
-                    dd += 4 * OutputSize;
-                }
+    if (TargetThreadCount <= 1) {
+        MlasReorderInputSegment(S, D, InputChannels, InputSize);
+        return;
+    }
 
-                for (; bc < OutputChannelsThisIteration; bc += 1) {
-                    MlasReorderGatherFloat32x4(ss, dd, BlockSize);
-                    ss += 1;
-                    dd += OutputSize;
-                }
+    MLAS_REORDER_WORK_BLOCK WorkBlock;
+
+    WorkBlock.ThreadCount = TargetThreadCount;
+    WorkBlock.S = S;
+    WorkBlock.D = D;
+    WorkBlock.Channels = InputChannels;
+    WorkBlock.SpatialSize = InputSize;
+    WorkBlock.BatchCount = 1;
+
+    MlasExecuteThreaded(MlasReorderInputThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+}
+
+static
+void
+MlasReorderOutputNchwSegment(
+    const float* S,
+    float* D,
+    size_t OutputChannels,
+    size_t OutputSize
+    )
+/*++
+
+Routine Description:
 
-                s += 4 * BlockSize;
-                d += 4;
+    This routine reorders a segment of an output buffer from NCHWc to NCHW
+    format. The segment is a range of channels of a single image of the
+    output tensor, starting at a channel block boundary.
+
+Arguments:
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+    OutputChannels - Supplies the number of channels in this segment.
+
+    OutputSize - Supplies the number of elements per channel.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    //
+    // Transpose NCHWc blocks from the source buffer to the destination buffer.
+    //
+
+    for (size_t o = OutputChannels; o > 0;) {
+
+        const size_t OutputChannelsThisIteration = std::min(o, BlockSize);
+        const size_t AlignedOutputChannelsThisIteration = OutputChannelsThisIteration & (~3);
+        o -= OutputChannelsThisIteration;
+
+        const float* s = S;
+        float* d = D;
+        size_t OutputSizeRemaining = OutputSize;
+
+        for (; OutputSizeRemaining >= 4; OutputSizeRemaining -= 4) {
+
+            const float* ss = s;
+            float* dd = d;
+            size_t bc = 0;
+
+            for (; bc < AlignedOutputChannelsThisIteration; bc += 4) {
+                MlasReorderTransposeFloat32x4x4(ss, dd, BlockSize, OutputSize);
+                ss += 4;
+                dd += 4 * OutputSize;
             }
 
-            for (; OutputSizeRemaining > 0; OutputSizeRemaining--) {
+            for (; bc < OutputChannelsThisIteration; bc += 1) {
+                MlasReorderGatherFloat32x4(ss, dd, BlockSize);
+                ss += 1;
+                dd += OutputSize;
+            }
 
-                const float* ss = s;
-                float* dd = d;
-                size_t bc = 0;
+            s += 4 * BlockSize;
+            d += 4;
+        }
 
-                for (; bc < AlignedOutputChannelsThisIteration; bc += 4) {
-                    MlasReorderScatterFloat32x4(ss, dd, OutputSize);
-                    ss += 4;
-                    dd += 4 * OutputSize;
-                }
+        for (; OutputSizeRemaining > 0; OutputSizeRemaining--) {
 
-                for (; bc < OutputChannelsThisIteration; bc += 1) {
-                    *dd = *ss++;
-                    dd += OutputSize;
-                }
+            const float* ss = s;
+            float* dd = d;
+            size_t bc = 0;
+
+            for (; bc < AlignedOutputChannelsThisIteration; bc += 4) {
+                MlasReorderScatterFloat32x4(ss, dd, OutputSize);
+                ss += 4;
+                dd += 4 * OutputSize;
+            }
 
-                s += BlockSize;
-                d += 1;
+            for (; bc < OutputChannelsThisIteration; bc += 1) {
+                *dd = *ss++;
+                dd += OutputSize;
             }
 
-            S += BlockSize * OutputSize;
-            D += OutputChannelsThisIteration * OutputSize;
+            s += BlockSize;
+            d += 1;
         }
+
+        S += BlockSize * OutputSize;
+        D += OutputChannelsThisIteration * OutputSize;
     }
 }
 
+static
+void
+MlasReorderOutputNchwThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of an
+    output reorder operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_REORDER_WORK_BLOCK*)Context;
+
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t OutputChannels = WorkBlock->Channels;
+    const size_t OutputSize = WorkBlock->SpatialSize;
+
+    //
+    // Partition the batched channel blocks across the thread count. Each
+    // channel block reads from and writes to an independent range of the
+    // buffers.
+    //
+
+    const size_t BlocksPerBatch = (OutputChannels + BlockSize - 1) / BlockSize;
+    const size_t TotalBlocks = WorkBlock->BatchCount * BlocksPerBatch;
+
+    size_t BlockIndex;
+    size_t BlockCount;
+
+    MlasPartitionWork(ThreadId, WorkBlock->ThreadCount, TotalBlocks, &BlockIndex, &BlockCount);
+
+    for (size_t t = BlockIndex; t < BlockIndex + BlockCount; t++) {
+
+        const size_t batch = t / BlocksPerBatch;
+        const size_t block = t % BlocksPerBatch;
+
+        const float* S = WorkBlock->S + t * BlockSize * OutputSize;
+        float* D = WorkBlock->D + (batch * OutputChannels + block * BlockSize) * OutputSize;
+
+        const size_t SegmentChannels = std::min(OutputChannels - block * BlockSize, BlockSize);
+
+        MlasReorderOutputNchwSegment(S, D, SegmentChannels, OutputSize);
+    }
+}
+
+void
+MLASCALL
+MlasReorderOutputNchw(
+    const int64_t* OutputShape,
+    const float* S,
+    float* D,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine reorders an output buffer from NCHWc to NCHW format.
+
+Arguments:
+
+    OutputShape - Supplies the shape of the output tensor.
+
+    S - Supplies the address of the source tensor.
+
+    D - Supplies the address of the destination tensor.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    const size_t BatchCount = size_t(OutputShape[0]);
+    const size_t OutputChannels = size_t(OutputShape[1]);
+    const size_t OutputSize = size_t(OutputShape[2]) * size_t(OutputShape[3]);
+
+    //
+    // Compute the number of target threads given the size of the tensor.
+    // Small requests should run using a single thread to avoid the overhead
+    // of the threaded dispatch.
+    //
+
+    const size_t BlocksPerBatch = (OutputChannels + BlockSize - 1) / BlockSize;
+    const size_t TotalBlocks = BatchCount * BlocksPerBatch;
+    const size_t BytesToMove = TotalBlocks * BlockSize * OutputSize * sizeof(float);
+
+    int32_t TargetThreadCount;
+
+    if (BytesToMove < MLAS_REORDER_THREAD_COMPLEXITY) {
+        TargetThreadCount = 1;
+    } else {
+        TargetThreadCount = int32_t(BytesToMove / MLAS_REORDER_THREAD_COMPLEXITY) + 1;
+    }
+
+    int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    if (size_t(TargetThreadCount) > TotalBlocks) {
+        TargetThreadCount = int32_t(TotalBlocks);
+    }
+
+    if (TargetThreadCount <= 1) {
+        TargetThreadCount = 1;
+    }
+
+    MLAS_REORDER_WORK_BLOCK WorkBlock;
+
+    WorkBlock.ThreadCount = TargetThreadCount;
+    WorkBlock.S = S;
+    WorkBlock.D = D;
+    WorkBlock.Channels = OutputChannels;
+    WorkBlock.SpatialSize = OutputSize;
+    WorkBlock.BatchCount = BatchCount;
+
+    if (TargetThreadCount == 1) {
+        MlasReorderOutputNchwThreaded(&WorkBlock, 0);
+        return;
+    }
+
+    MlasExecuteThreaded(MlasReorderOutputNchwThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+}
+
 void
 MLASCALL
 MlasReorderOutputNhwc(
@@ -48,6 +48,7 @@ struct MLAS_SGEMM_WORK_BLOCK {
     float alpha;
     float beta;
     bool BIsPacked;
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor;
 };
 
 void
@@ -843,7 +844,10 @@ MlasSgemmOperation(
     size_t ldb,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor,
+    size_t RangeStartM,
+    size_t RangeStartN
     )
 /*++
 
@@ -881,6 +885,15 @@ Arguments:
 
     ldc - Supplies the first dimension of matrix C.
 
+    OutputProcessor - Optionally supplies the output processor to invoke on
+        each completed slice of matrix C.
+
+    RangeStartM - Supplies the row position of matrix C within the full
+        output matrix, for output processor coordinates.
+
+    RangeStartN - Supplies the column position of matrix C within the full
+        output matrix, for output processor coordinates.
+
 Return Value:
 
     None.
@@ -897,6 +910,9 @@ Return Value:
 
     if (K == 0) {
         MlasSgemmMultiplyBeta(C, M, N, ldc, beta);
+        if (OutputProcessor != nullptr) {
+            OutputProcessor->Process(C, RangeStartM, RangeStartN, M, N, ldc);
+        }
         return;
     }
 
@@ -920,6 +936,9 @@ Return Value:
 
         if (SgemmKernelM1Routine != nullptr) {
             SgemmKernelM1Routine(A, B, C, K, N, ldb, beta);
+            if (OutputProcessor != nullptr) {
+                OutputProcessor->Process(C, RangeStartM, RangeStartN, 1, N, ldc);
+            }
             return;
         }
 
@@ -927,6 +946,9 @@ Return Value:
 
         if (TransB == CblasNoTrans) {
             MlasGemvFloatKernel(A, B, C, K, N, ldb, (beta == 0.0f));
+            if (OutputProcessor != nullptr) {
+                OutputProcessor->Process(C, RangeStartM, RangeStartN, 1, N, ldc);
+            }
             return;
         }
 
@@ -955,6 +977,9 @@ Return Value:
 
         if (SgemmKernelM1Routine != nullptr) {
             SgemmKernelM1Routine(B, A, C, K, M, lda, beta);
+            if (OutputProcessor != nullptr) {
+                OutputProcessor->Process(C, RangeStartM, RangeStartN, M, 1, ldc);
+            }
             return;
         }
 
@@ -973,6 +998,18 @@ Return Value:
     size_t StrideN = MLAS_SGEMM_STRIDEN;
     size_t StrideK = MLAS_SGEMM_STRIDEK;
 
+    if (TransA == CblasNoTrans) {
+
+        //
+        // Use the blocking parameters selected for this platform. These keep
+        // the same panel footprint, so the stack buffers above remain large
+        // enough.
+        //
+
+        StrideN = MlasPlatform.SgemmStrideN;
+        StrideK = MlasPlatform.SgemmStrideK;
+    }
+
     if (N >= K) {
 
         while (StrideK / 2 >= K) {
@@ -1065,6 +1102,15 @@ Return Value:
 
             ZeroMode = false;
         }
+
+        //
+        // The columns of this slice are complete, so invoke the fused
+        // epilogue while the data is still hot in the cache.
+        //
+
+        if (OutputProcessor != nullptr) {
+            OutputProcessor->Process(C + n, RangeStartM, RangeStartN + n, M, CountN, ldc);
+        }
     }
 }
 
@@ -1082,7 +1128,9 @@ MlasSgemmPackedOperation(
     size_t AlignedN,
     float beta,
     float* C,
-    size_t ldc
+    size_t ldc,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor,
+    size_t RangeStartM
     )
 /*++
 
@@ -1122,6 +1170,12 @@ Arguments:
 
     ldc - Supplies the first dimension of matrix C.
 
+    OutputProcessor - Optionally supplies the output processor to invoke on
+        each completed slice of matrix C.
+
+    RangeStartM - Supplies the row position of matrix C within the full
+        output matrix, for output processor coordinates.
+
 Return Value:
 
     None.
@@ -1200,6 +1254,15 @@ Return Value:
 
             ZeroMode = false;
         }
+
+        //
+        // The columns of this slice are complete, so invoke the fused
+        // epilogue while the data is still hot in the cache.
+        //
+
+        if (OutputProcessor != nullptr) {
+            OutputProcessor->Process(C + n, RangeStartM, SliceStartN, M, CountN, ldc);
+        }
     }
 }
 
@@ -1280,7 +1343,8 @@ Return Value:
 
         MlasSgemmPackedOperation(TransA, RangeCountM, RangeStartN, RangeCountN,
             WorkBlock->K, WorkBlock->alpha, A, lda, WorkBlock->B,
-            BlockedN * MLAS_SGEMM_STRIDEN_THREAD_ALIGN, WorkBlock->beta, C, ldc);
+            BlockedN * MLAS_SGEMM_STRIDEN_THREAD_ALIGN, WorkBlock->beta, C, ldc,
+            WorkBlock->OutputProcessor, RangeStartM);
 
     } else {
 
@@ -1291,7 +1355,8 @@ Return Value:
         const float* B = (const float*)WorkBlock->B + RangeStartN * ((TransB == CblasNoTrans) ? 1 : ldb);
 
         MlasSgemmOperation(TransA, TransB, RangeCountM, RangeCountN, WorkBlock->K,
-            WorkBlock->alpha, A, lda, B, ldb, WorkBlock->beta, C, ldc);
+            WorkBlock->alpha, A, lda, B, ldb, WorkBlock->beta, C, ldc,
+            WorkBlock->OutputProcessor, RangeStartM, RangeStartN);
     }
 }
 
@@ -1393,7 +1458,8 @@ MlasGemm(
     float beta,
     float* C,
     size_t ldc,
-    MLAS_THREADPOOL* ThreadPool
+    MLAS_THREADPOOL* ThreadPool,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor
     )
 /*++
 
@@ -1434,6 +1500,9 @@ Arguments:
     ThreadPool - Supplies the thread pool object to use, else nullptr if the
         base library threading support should be used.
 
+    OutputProcessor - Optionally supplies the output processor to invoke on
+        each completed tile of matrix C.
+
 Return Value:
 
     None.
@@ -1461,6 +1530,7 @@ Return Value:
     WorkBlock.ldc = ldc;
     WorkBlock.alpha = alpha;
     WorkBlock.beta = beta;
+    WorkBlock.OutputProcessor = OutputProcessor;
 
     //
     // Schedule the operation across a set of worker threads.
@@ -1483,7 +1553,8 @@ MlasGemm(
     float beta,
     float* C,
     size_t ldc,
-    MLAS_THREADPOOL* ThreadPool
+    MLAS_THREADPOOL* ThreadPool,
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* OutputProcessor
     )
 /*++
 
@@ -1520,6 +1591,9 @@ Arguments:
     ThreadPool - Supplies the thread pool object to use, else nullptr if the
         base library threading support should be used.
 
+    OutputProcessor - Optionally supplies the output processor to invoke on
+        each completed tile of matrix C.
+
 Return Value:
 
     None.
@@ -1546,6 +1620,7 @@ Return Value:
     WorkBlock.alpha = alpha;
     WorkBlock.beta = beta;
     WorkBlock.BIsPacked = true;
+    WorkBlock.OutputProcessor = OutputProcessor;
 
     //
     // Schedule the operation across a set of worker threads.
@@ -1554,6 +1629,232 @@ Return Value:
     MlasSgemmSchedule(&WorkBlock, ThreadPool);
 }
 
+//
+// Define the parameters to execute segments of a batch of identically shaped
+// SGEMM operations on worker threads.
+//
+
+struct MLAS_SGEMM_BATCH_WORK_BLOCK {
+    MLAS_SGEMM_WORK_BLOCK Gemm;
+    size_t StrideA;
+    size_t StrideB;
+    size_t StrideC;
+    size_t BatchSize;
+    int32_t ThreadsPerGemm;
+};
+
+void
+MlasSgemmBatchThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of one
+    matrix from a batched SGEMM operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* BatchBlock = (MLAS_SGEMM_BATCH_WORK_BLOCK*)Context;
+
+    const size_t GemmIndex = size_t(ThreadId) / BatchBlock->ThreadsPerGemm;
+    const int32_t GemmThreadId = ThreadId % BatchBlock->ThreadsPerGemm;
+
+    //
+    // Advance the base pointers to this matrix of the batch and reuse the
+    // single GEMM partitioning logic for the local thread index.
+    //
+
+    MLAS_SGEMM_WORK_BLOCK WorkBlock = BatchBlock->Gemm;
+
+    WorkBlock.A += GemmIndex * BatchBlock->StrideA;
+    WorkBlock.B = (const float*)WorkBlock.B + GemmIndex * BatchBlock->StrideB;
+    WorkBlock.C += GemmIndex * BatchBlock->StrideC;
+
+    MlasSgemmThreaded(&WorkBlock, GemmThreadId);
+}
+
+void
+MLASCALL
+MlasGemmBatch(
+    CBLAS_TRANSPOSE TransA,
+    CBLAS_TRANSPOSE TransB,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    size_t StrideA,
+    const float* B,
+    size_t ldb,
+    size_t StrideB,
+    float beta,
+    float* C,
+    size_t ldc,
+    size_t StrideC,
+    size_t BatchSize,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements a batch of identically shaped single precision
+    matrix/matrix multiply operations (SGEMM) scheduled as a single pass over
+    the thread pool, which amortizes the partitioning overhead that per-call
+    MlasGemm would pay for each matrix.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for the A matrices.
+
+    TransB - Supplies the transpose operation for the B matrices.
+
+    M - Supplies the number of rows of the A matrices and the C matrices.
+
+    N - Supplies the number of columns of the B matrices and the C matrices.
+
+    K - Supplies the number of columns of the A matrices and the number of
+        rows of the B matrices.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    A - Supplies the address of the first A matrix.
+
+    lda - Supplies the first dimension of the A matrices.
+
+    StrideA - Supplies the element offset between consecutive A matrices.
+
+    B - Supplies the address of the first B matrix.
+
+    ldb - Supplies the first dimension of the B matrices.
+
+    StrideB - Supplies the element offset between consecutive B matrices.
+        Supply zero to multiply every A matrix against the same B matrix.
+
+    beta - Supplies the scalar beta multiplier (see SGEMM definition).
+
+    C - Supplies the address of the first C matrix.
+
+    ldc - Supplies the first dimension of the C matrices.
+
+    StrideC - Supplies the element offset between consecutive C matrices.
+
+    BatchSize - Supplies the number of matrices in the batch.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    if (BatchSize == 1) {
+        MlasGemm(TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, C, ldc, ThreadPool);
+        return;
+    }
+
+    MLAS_SGEMM_BATCH_WORK_BLOCK BatchBlock;
+
+    //
+    // Capture the shared GEMM parameters to the work block.
+    //
+
+    memset(&BatchBlock, 0, sizeof(MLAS_SGEMM_BATCH_WORK_BLOCK));
+
+    BatchBlock.Gemm.TransA = TransA;
+    BatchBlock.Gemm.TransB = TransB;
+    BatchBlock.Gemm.M = M;
+    BatchBlock.Gemm.N = N;
+    BatchBlock.Gemm.K = K;
+    BatchBlock.Gemm.A = A;
+    BatchBlock.Gemm.lda = lda;
+    BatchBlock.Gemm.B = B;
+    BatchBlock.Gemm.ldb = ldb;
+    BatchBlock.Gemm.C = C;
+    BatchBlock.Gemm.ldc = ldc;
+    BatchBlock.Gemm.alpha = alpha;
+    BatchBlock.Gemm.beta = beta;
+
+    BatchBlock.StrideA = StrideA;
+    BatchBlock.StrideB = StrideB;
+    BatchBlock.StrideC = StrideC;
+    BatchBlock.BatchSize = BatchSize;
+
+    //
+    // Spread the available threads over the batch before splitting an
+    // individual matrix, so a batch of small operations runs each matrix on
+    // a single thread instead of oversubscribing the pool.
+    //
+
+    const double Complexity = double(M) * double(N) * double(K);
+
+    int32_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MlasPlatform.MaximumThreadCount)) {
+        TargetThreadCount = int32_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MlasPlatform.MaximumThreadCount;
+    }
+
+    int32_t ThreadsPerGemm = MlasGetMaximumThreadCount(ThreadPool) / int32_t(BatchSize);
+
+    if (ThreadsPerGemm < 1) {
+        ThreadsPerGemm = 1;
+    }
+
+    if (TargetThreadCount < ThreadsPerGemm) {
+        ThreadsPerGemm = TargetThreadCount;
+    }
+
+    //
+    // Segment each matrix of the batch using the same 1D partition as the
+    // single GEMM path.
+    //
+
+    if (N > M) {
+
+        const size_t BlockedN = (N + MLAS_SGEMM_STRIDEN_THREAD_ALIGN - 1) /
+            MLAS_SGEMM_STRIDEN_THREAD_ALIGN;
+
+        if (size_t(ThreadsPerGemm) > BlockedN) {
+            ThreadsPerGemm = int32_t(BlockedN);
+        }
+
+        BatchBlock.Gemm.ThreadCountM = 1;
+        BatchBlock.Gemm.ThreadCountN = ThreadsPerGemm;
+
+    } else {
+
+        if (size_t(ThreadsPerGemm) > M) {
+            ThreadsPerGemm = int32_t(M);
+        }
+
+        BatchBlock.Gemm.ThreadCountM = ThreadsPerGemm;
+        BatchBlock.Gemm.ThreadCountN = 1;
+    }
+
+    BatchBlock.ThreadsPerGemm = ThreadsPerGemm;
+
+    MlasExecuteThreaded(MlasSgemmBatchThreaded, &BatchBlock,
+        ThreadsPerGemm * int32_t(BatchSize), ThreadPool);
+}
+
 size_t
 MLASCALL
 MlasGemmPackBSize(
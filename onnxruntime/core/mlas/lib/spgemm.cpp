@@ -0,0 +1,660 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    spgemm.cpp
+
+Abstract:
+
+    This module implements the single precision block sparse matrix/matrix
+    multiply operation (SGEMM) for weight matrices that have been pruned to
+    a high level of sparsity.
+
+    Matrix B is packed once into a block compressed sparse row format built
+    from 4x4 element blocks. Blocks that contain only zero elements are
+    omitted from the packed image, so the multiply only spends time on the
+    surviving blocks.
+
+--*/
+
+#include "mlasi.h"
+
+//
+// Define the dimension of the square element blocks stored in the packed
+// image.
+//
+
+#define MLAS_SPARSE_GEMM_BLOCK_SIZE                 4
+
+//
+// Define the maximum fraction of non-zero blocks for which the sparse path
+// is expected to outperform the dense SGEMM kernels. Beyond this density
+// the dense kernels win on raw FLOPs, so packing is refused.
+//
+
+#define MLAS_SPARSE_GEMM_MAXIMUM_DENSITY            0.30f
+
+//
+// Define the layout of the packed buffer. The header is followed by the
+// block row offsets (BlockCountK + 1 entries), the block column indexes
+// (NonZeroBlockCount entries), and the block values (NonZeroBlockCount
+// blocks of 16 floats in row-major order).
+//
+
+struct MLAS_SPARSE_GEMM_PACKED_HEADER {
+    size_t BlockCountK;
+    size_t BlockCountN;
+    size_t NonZeroBlockCount;
+};
+
+//
+// Define the parameters to execute segments of a sparse GEMM operation on
+// worker threads.
+//
+
+struct MLAS_SPARSE_GEMM_WORK_BLOCK {
+    int32_t ThreadCountM;
+    CBLAS_TRANSPOSE TransA;
+    size_t M;
+    size_t N;
+    size_t K;
+    float alpha;
+    const float* A;
+    size_t lda;
+    const void* PackedB;
+    float beta;
+    float* C;
+    size_t ldc;
+};
+
+MLAS_FORCEINLINE
+float
+MlasSparseGemmElementB(
+    CBLAS_TRANSPOSE TransB,
+    const float* B,
+    size_t ldb,
+    size_t k,
+    size_t n
+    )
+/*++
+
+Routine Description:
+
+    This routine reads an element of matrix B accounting for the transpose
+    mode of the supplied buffer.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    k - Supplies the row of the element in the logical K by N matrix.
+
+    n - Supplies the column of the element in the logical K by N matrix.
+
+Return Value:
+
+    Returns the element value.
+
+--*/
+{
+    if (TransB == CblasNoTrans) {
+        return B[k * ldb + n];
+    } else {
+        return B[n * ldb + k];
+    }
+}
+
+MLAS_FORCEINLINE
+bool
+MlasSparseGemmBlockIsZero(
+    CBLAS_TRANSPOSE TransB,
+    const float* B,
+    size_t ldb,
+    size_t k,
+    size_t n
+    )
+/*++
+
+Routine Description:
+
+    This routine tests if the 4x4 element block at the supplied coordinates
+    contains only zero elements.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    k - Supplies the first row of the block.
+
+    n - Supplies the first column of the block.
+
+Return Value:
+
+    Returns true if every element of the block is zero.
+
+--*/
+{
+    for (size_t i = 0; i < MLAS_SPARSE_GEMM_BLOCK_SIZE; i++) {
+        for (size_t j = 0; j < MLAS_SPARSE_GEMM_BLOCK_SIZE; j++) {
+            if (MlasSparseGemmElementB(TransB, B, ldb, k + i, n + j) != 0.0f) {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+size_t
+MLASCALL
+MlasSparseGemmPackBSize(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb
+    )
+/*++
+
+Routine Description:
+
+    This routine computes the length in bytes for the packed sparse matrix B
+    buffer.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+Return Value:
+
+    Returns the size in bytes for the packed matrix B buffer, else zero if
+    the matrix cannot be represented or is not sparse enough to benefit from
+    the sparse path.
+
+--*/
+{
+    //
+    // Restrict the sparse path to shapes that partition evenly into blocks
+    // and are large enough for the packing to pay off.
+    //
+
+    if ((N % MLAS_SPARSE_GEMM_BLOCK_SIZE) != 0 || (K % MLAS_SPARSE_GEMM_BLOCK_SIZE) != 0) {
+        return 0;
+    }
+
+    if (N < 16 || K < 16) {
+        return 0;
+    }
+
+    //
+    // Count the number of blocks that contain at least one non-zero element
+    // and refuse to pack if the density is above the threshold where the
+    // dense kernels are faster.
+    //
+
+    const size_t BlockCountK = K / MLAS_SPARSE_GEMM_BLOCK_SIZE;
+    const size_t BlockCountN = N / MLAS_SPARSE_GEMM_BLOCK_SIZE;
+
+    size_t NonZeroBlockCount = 0;
+
+    for (size_t kb = 0; kb < BlockCountK; kb++) {
+        for (size_t nb = 0; nb < BlockCountN; nb++) {
+            if (!MlasSparseGemmBlockIsZero(TransB, B, ldb, kb * MLAS_SPARSE_GEMM_BLOCK_SIZE,
+                nb * MLAS_SPARSE_GEMM_BLOCK_SIZE)) {
+                NonZeroBlockCount++;
+            }
+        }
+    }
+
+    const float Density = float(NonZeroBlockCount) / float(BlockCountK * BlockCountN);
+
+    if (Density > MLAS_SPARSE_GEMM_MAXIMUM_DENSITY) {
+        return 0;
+    }
+
+    size_t BytesRequired = sizeof(MLAS_SPARSE_GEMM_PACKED_HEADER);
+    BytesRequired += (BlockCountK + 1) * sizeof(size_t);
+    BytesRequired += NonZeroBlockCount * sizeof(uint32_t);
+    BytesRequired += NonZeroBlockCount * MLAS_SPARSE_GEMM_BLOCK_SIZE *
+        MLAS_SPARSE_GEMM_BLOCK_SIZE * sizeof(float);
+
+    const size_t BufferAlignment = MlasGetPreferredBufferAlignment();
+    BytesRequired = (BytesRequired + BufferAlignment - 1) & ~(BufferAlignment - 1);
+
+    return BytesRequired;
+}
+
+void
+MLASCALL
+MlasSparseGemmPackB(
+    CBLAS_TRANSPOSE TransB,
+    size_t N,
+    size_t K,
+    const float* B,
+    size_t ldb,
+    void* PackedB
+    )
+/*++
+
+Routine Description:
+
+    This routine packs the contents of matrix B to the block compressed
+    sparse row format. The caller must have sized the buffer using
+    MlasSparseGemmPackBSize.
+
+Arguments:
+
+    TransB - Supplies the transpose operation for matrix B.
+
+    N - Supplies the number of columns of matrix B.
+
+    K - Supplies the number of rows of matrix B.
+
+    B - Supplies the address of matrix B.
+
+    ldb - Supplies the first dimension of matrix B.
+
+    PackedB - Supplies the address of packed matrix B.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const size_t BlockCountK = K / MLAS_SPARSE_GEMM_BLOCK_SIZE;
+    const size_t BlockCountN = N / MLAS_SPARSE_GEMM_BLOCK_SIZE;
+
+    //
+    // Walk the blocks once to count the survivors, then lay out the packed
+    // image and walk again to fill the indexes and values.
+    //
+
+    size_t NonZeroBlockCount = 0;
+
+    for (size_t kb = 0; kb < BlockCountK; kb++) {
+        for (size_t nb = 0; nb < BlockCountN; nb++) {
+            if (!MlasSparseGemmBlockIsZero(TransB, B, ldb, kb * MLAS_SPARSE_GEMM_BLOCK_SIZE,
+                nb * MLAS_SPARSE_GEMM_BLOCK_SIZE)) {
+                NonZeroBlockCount++;
+            }
+        }
+    }
+
+    auto* Header = (MLAS_SPARSE_GEMM_PACKED_HEADER*)PackedB;
+
+    Header->BlockCountK = BlockCountK;
+    Header->BlockCountN = BlockCountN;
+    Header->NonZeroBlockCount = NonZeroBlockCount;
+
+    size_t* BlockRowOffsets = (size_t*)(Header + 1);
+    uint32_t* ColumnIndexes = (uint32_t*)(BlockRowOffsets + BlockCountK + 1);
+    float* Values = (float*)(ColumnIndexes + NonZeroBlockCount);
+
+    size_t BlockIndex = 0;
+
+    for (size_t kb = 0; kb < BlockCountK; kb++) {
+
+        BlockRowOffsets[kb] = BlockIndex;
+
+        for (size_t nb = 0; nb < BlockCountN; nb++) {
+
+            const size_t k = kb * MLAS_SPARSE_GEMM_BLOCK_SIZE;
+            const size_t n = nb * MLAS_SPARSE_GEMM_BLOCK_SIZE;
+
+            if (MlasSparseGemmBlockIsZero(TransB, B, ldb, k, n)) {
+                continue;
+            }
+
+            ColumnIndexes[BlockIndex] = uint32_t(nb);
+
+            float* v = Values + BlockIndex * MLAS_SPARSE_GEMM_BLOCK_SIZE * MLAS_SPARSE_GEMM_BLOCK_SIZE;
+
+            for (size_t i = 0; i < MLAS_SPARSE_GEMM_BLOCK_SIZE; i++) {
+                for (size_t j = 0; j < MLAS_SPARSE_GEMM_BLOCK_SIZE; j++) {
+                    v[i * MLAS_SPARSE_GEMM_BLOCK_SIZE + j] =
+                        MlasSparseGemmElementB(TransB, B, ldb, k + i, n + j);
+                }
+            }
+
+            BlockIndex++;
+        }
+    }
+
+    BlockRowOffsets[BlockCountK] = BlockIndex;
+}
+
+void
+MlasSparseGemmOperation(
+    CBLAS_TRANSPOSE TransA,
+    size_t RangeStartM,
+    size_t RangeCountM,
+    size_t N,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    float beta,
+    float* C,
+    size_t ldc
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the sparse matrix/matrix multiply operation
+    (SGEMM) over a range of rows of matrix A and matrix C.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for matrix A.
+
+    RangeStartM - Supplies the starting row of the operation.
+
+    RangeCountM - Supplies the number of rows of the operation.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    PackedB - Supplies the address of packed matrix B.
+
+    beta - Supplies the scalar beta multiplier (see SGEMM definition).
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* Header = (const MLAS_SPARSE_GEMM_PACKED_HEADER*)PackedB;
+
+    const size_t BlockCountK = Header->BlockCountK;
+    const size_t NonZeroBlockCount = Header->NonZeroBlockCount;
+
+    const size_t* BlockRowOffsets = (const size_t*)(Header + 1);
+    const uint32_t* ColumnIndexes = (const uint32_t*)(BlockRowOffsets + BlockCountK + 1);
+    const float* Values = (const float*)(ColumnIndexes + NonZeroBlockCount);
+
+    for (size_t m = RangeStartM; m < RangeStartM + RangeCountM; m++) {
+
+        float* c = C + m * ldc;
+
+        //
+        // Apply the beta multiplier to the output row.
+        //
+
+        if (beta == 0.0f) {
+            std::fill_n(c, N, 0.0f);
+        } else if (beta != 1.0f) {
+            for (size_t n = 0; n < N; n++) {
+                c[n] *= beta;
+            }
+        }
+
+        //
+        // Accumulate the contribution of each surviving block. The alpha
+        // multiplier is folded into the elements loaded from matrix A.
+        //
+
+        for (size_t kb = 0; kb < BlockCountK; kb++) {
+
+            const size_t RowStart = BlockRowOffsets[kb];
+            const size_t RowEnd = BlockRowOffsets[kb + 1];
+
+            if (RowStart == RowEnd) {
+                continue;
+            }
+
+            const size_t k = kb * MLAS_SPARSE_GEMM_BLOCK_SIZE;
+
+            float a0;
+            float a1;
+            float a2;
+            float a3;
+
+            if (TransA == CblasNoTrans) {
+                a0 = A[m * lda + k];
+                a1 = A[m * lda + k + 1];
+                a2 = A[m * lda + k + 2];
+                a3 = A[m * lda + k + 3];
+            } else {
+                a0 = A[(k + 0) * lda + m];
+                a1 = A[(k + 1) * lda + m];
+                a2 = A[(k + 2) * lda + m];
+                a3 = A[(k + 3) * lda + m];
+            }
+
+            a0 *= alpha;
+            a1 *= alpha;
+            a2 *= alpha;
+            a3 *= alpha;
+
+#if defined(MLAS_SSE2_INTRINSICS)
+
+            __m128 va0 = _mm_set1_ps(a0);
+            __m128 va1 = _mm_set1_ps(a1);
+            __m128 va2 = _mm_set1_ps(a2);
+            __m128 va3 = _mm_set1_ps(a3);
+
+#elif defined(MLAS_NEON_INTRINSICS)
+
+            float32x4_t va0 = vdupq_n_f32(a0);
+            float32x4_t va1 = vdupq_n_f32(a1);
+            float32x4_t va2 = vdupq_n_f32(a2);
+            float32x4_t va3 = vdupq_n_f32(a3);
+
+#endif
+
+            for (size_t Index = RowStart; Index < RowEnd; Index++) {
+
+                float* cb = c + size_t(ColumnIndexes[Index]) * MLAS_SPARSE_GEMM_BLOCK_SIZE;
+                const float* v = Values + Index * MLAS_SPARSE_GEMM_BLOCK_SIZE * MLAS_SPARSE_GEMM_BLOCK_SIZE;
+
+#if defined(MLAS_SSE2_INTRINSICS)
+
+                __m128 Accumulator = _mm_loadu_ps(cb);
+                Accumulator = _mm_add_ps(Accumulator, _mm_mul_ps(va0, _mm_loadu_ps(&v[0])));
+                Accumulator = _mm_add_ps(Accumulator, _mm_mul_ps(va1, _mm_loadu_ps(&v[4])));
+                Accumulator = _mm_add_ps(Accumulator, _mm_mul_ps(va2, _mm_loadu_ps(&v[8])));
+                Accumulator = _mm_add_ps(Accumulator, _mm_mul_ps(va3, _mm_loadu_ps(&v[12])));
+                _mm_storeu_ps(cb, Accumulator);
+
+#elif defined(MLAS_NEON_INTRINSICS)
+
+                float32x4_t Accumulator = vld1q_f32(cb);
+                Accumulator = vmlaq_f32(Accumulator, va0, vld1q_f32(&v[0]));
+                Accumulator = vmlaq_f32(Accumulator, va1, vld1q_f32(&v[4]));
+                Accumulator = vmlaq_f32(Accumulator, va2, vld1q_f32(&v[8]));
+                Accumulator = vmlaq_f32(Accumulator, va3, vld1q_f32(&v[12]));
+                vst1q_f32(cb, Accumulator);
+
+#else
+
+                for (size_t j = 0; j < MLAS_SPARSE_GEMM_BLOCK_SIZE; j++) {
+                    cb[j] += a0 * v[j] + a1 * v[4 + j] + a2 * v[8 + j] + a3 * v[12 + j];
+                }
+
+#endif
+
+            }
+        }
+    }
+}
+
+void
+MlasSparseGemmThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    sparse GEMM operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_SPARSE_GEMM_WORK_BLOCK*)Context;
+
+    size_t RangeStartM;
+    size_t RangeCountM;
+
+    MlasPartitionWork(ThreadId, WorkBlock->ThreadCountM, WorkBlock->M, &RangeStartM,
+        &RangeCountM);
+
+    if (RangeCountM == 0) {
+        return;
+    }
+
+    MlasSparseGemmOperation(WorkBlock->TransA, RangeStartM, RangeCountM, WorkBlock->N,
+        WorkBlock->alpha, WorkBlock->A, WorkBlock->lda, WorkBlock->PackedB, WorkBlock->beta,
+        WorkBlock->C, WorkBlock->ldc);
+}
+
+void
+MLASCALL
+MlasSparseGemm(
+    CBLAS_TRANSPOSE TransA,
+    size_t M,
+    size_t N,
+    size_t K,
+    float alpha,
+    const float* A,
+    size_t lda,
+    const void* PackedB,
+    float beta,
+    float* C,
+    size_t ldc,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine implements the sparse matrix/matrix multiply operation
+    (SGEMM) using a matrix B that was packed by MlasSparseGemmPackB.
+
+Arguments:
+
+    TransA - Supplies the transpose operation for matrix A.
+
+    M - Supplies the number of rows of matrix A and matrix C.
+
+    N - Supplies the number of columns of matrix B and matrix C.
+
+    K - Supplies the number of columns of matrix A and the number of rows of
+        matrix B.
+
+    alpha - Supplies the scalar alpha multiplier (see SGEMM definition).
+
+    A - Supplies the address of matrix A.
+
+    lda - Supplies the first dimension of matrix A.
+
+    PackedB - Supplies the address of packed matrix B.
+
+    beta - Supplies the scalar beta multiplier (see SGEMM definition).
+
+    C - Supplies the address of matrix C.
+
+    ldc - Supplies the first dimension of matrix C.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* Header = (const MLAS_SPARSE_GEMM_PACKED_HEADER*)PackedB;
+
+    //
+    // Compute the number of target threads given the complexity of the
+    // sparse multiply. Only the surviving blocks contribute work.
+    //
+
+    const double Complexity = double(M) * double(Header->NonZeroBlockCount) *
+        double(MLAS_SPARSE_GEMM_BLOCK_SIZE * MLAS_SPARSE_GEMM_BLOCK_SIZE);
+
+    int32_t TargetThreadCount;
+
+    if (Complexity < double(MLAS_SGEMM_THREAD_COMPLEXITY * MLAS_MAXIMUM_THREAD_COUNT)) {
+        TargetThreadCount = int32_t(Complexity / double(MLAS_SGEMM_THREAD_COMPLEXITY)) + 1;
+    } else {
+        TargetThreadCount = MLAS_MAXIMUM_THREAD_COUNT;
+    }
+
+    int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    if (size_t(TargetThreadCount) > M) {
+        TargetThreadCount = int32_t(M);
+    }
+
+    if (TargetThreadCount <= 1) {
+        MlasSparseGemmOperation(TransA, 0, M, N, alpha, A, lda, PackedB, beta, C, ldc);
+        return;
+    }
+
+    MLAS_SPARSE_GEMM_WORK_BLOCK WorkBlock;
+
+    WorkBlock.ThreadCountM = TargetThreadCount;
+    WorkBlock.TransA = TransA;
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+    WorkBlock.K = K;
+    WorkBlock.alpha = alpha;
+    WorkBlock.A = A;
+    WorkBlock.lda = lda;
+    WorkBlock.PackedB = PackedB;
+    WorkBlock.beta = beta;
+    WorkBlock.C = C;
+    WorkBlock.ldc = ldc;
+
+    MlasExecuteThreaded(MlasSparseGemmThreaded, &WorkBlock, TargetThreadCount, ThreadPool);
+}
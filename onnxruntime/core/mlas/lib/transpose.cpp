@@ -16,6 +16,27 @@ Abstract:
 
 #include "mlasi.h"
 
+//
+// Define the number of bytes to move per thread before dispatching additional
+// threads. The transpose operation is memory bound, so a modest chunk size
+// keeps the per-thread overhead small relative to the work.
+//
+
+#define MLAS_TRANSPOSE_THREAD_COMPLEXITY            (size_t(128) * size_t(1024))
+
+//
+// Define the parameters to execute segments of a transpose operation on worker
+// threads.
+//
+
+struct MLAS_TRANSPOSE_WORK_BLOCK {
+    int32_t ThreadCountM;
+    const void* Input;
+    void* Output;
+    size_t M;
+    size_t N;
+};
+
 #if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
 
 MLAS_FORCEINLINE
@@ -132,6 +153,79 @@ Return Value:
 
 }
 
+MLAS_FORCEINLINE
+void
+MlasTranspose4x4Block(
+    const uint32_t* Input,
+    size_t InputStride,
+    uint32_t* Output,
+    size_t OutputStride
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes a four by four element block from the input
+    matrix to the output matrix.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    InputStride - Supplies the number of elements between rows of the input
+        matrix.
+
+    Output - Supplies the output buffer.
+
+    OutputStride - Supplies the number of elements between rows of the output
+        matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+
+#if defined(MLAS_SSE2_INTRINSICS)
+
+    __m128i a0 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 0]);
+    __m128i a1 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 1]);
+    __m128i a2 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 2]);
+    __m128i a3 = _mm_loadu_si128((const __m128i*)&Input[InputStride * 3]);
+
+    __m128i b0 = _mm_unpacklo_epi32(a0, a1);
+    __m128i b1 = _mm_unpackhi_epi32(a0, a1);
+    __m128i b2 = _mm_unpacklo_epi32(a2, a3);
+    __m128i b3 = _mm_unpackhi_epi32(a2, a3);
+
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 0], _mm_unpacklo_epi64(b0, b2));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 1], _mm_unpackhi_epi64(b0, b2));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 2], _mm_unpacklo_epi64(b1, b3));
+    _mm_storeu_si128((__m128i*)&Output[OutputStride * 3], _mm_unpackhi_epi64(b1, b3));
+
+#elif defined(MLAS_NEON_INTRINSICS)
+
+    uint32x4_t a0 = vld1q_u32(&Input[InputStride * 0]);
+    uint32x4_t a1 = vld1q_u32(&Input[InputStride * 1]);
+    uint32x4_t a2 = vld1q_u32(&Input[InputStride * 2]);
+    uint32x4_t a3 = vld1q_u32(&Input[InputStride * 3]);
+
+    uint32x4x2_t b0 = vzipq_u32(a0, a2);
+    uint32x4x2_t b1 = vzipq_u32(a1, a3);
+
+    uint32x4x2_t c0 = vzipq_u32(b0.val[0], b1.val[0]);
+    uint32x4x2_t c1 = vzipq_u32(b0.val[1], b1.val[1]);
+
+    vst1q_u32(&Output[OutputStride * 0], c0.val[0]);
+    vst1q_u32(&Output[OutputStride * 1], c0.val[1]);
+    vst1q_u32(&Output[OutputStride * 2], c1.val[0]);
+    vst1q_u32(&Output[OutputStride * 3], c1.val[1]);
+
+#endif
+
+}
+
 #endif
 
 MLAS_FORCEINLINE
@@ -189,10 +283,10 @@ Return Value:
 }
 
 void
-MLASCALL
-MlasTranspose(
+MlasTransposeSegment(
     const uint8_t* Input,
     uint8_t* Output,
+    size_t CountM,
     size_t M,
     size_t N
     )
@@ -200,14 +294,18 @@ MlasTranspose(
 
 Routine Description:
 
-    This routine transposes the input matrix (M rows by N columns) to the
-    output matrix (N rows by M columns).
+    This routine transposes a range of rows of the input matrix (M rows by
+    N columns) to the output matrix (N rows by M columns).
 
 Arguments:
 
-    Input - Supplies the input buffer.
+    Input - Supplies the input buffer addressed at the first row of the
+        segment.
 
-    Output - Supplies the output buffer.
+    Output - Supplies the output buffer addressed at the first column of the
+        segment.
+
+    CountM - Supplies the number of rows of the input matrix to transpose.
 
     M - Supplies the number of rows for the input matrix and the number of
         columns for the output matrix.
@@ -232,7 +330,7 @@ Return Value:
 
         const uint8_t* s = Input;
         uint8_t* d = Output;
-        size_t m = M;
+        size_t m = CountM;
 
 #if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
 
@@ -270,7 +368,7 @@ Return Value:
 
         const uint8_t* s = Input;
         uint8_t* d = Output;
-        size_t m = M;
+        size_t m = CountM;
 
         while (m >= 8) {
 
@@ -295,3 +393,436 @@ Return Value:
         n -= 1;
     }
 }
+
+void
+MlasTransposeSegment(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t CountM,
+    size_t M,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes a range of rows of the input matrix (M rows by
+    N columns) to the output matrix (N rows by M columns).
+
+Arguments:
+
+    Input - Supplies the input buffer addressed at the first row of the
+        segment.
+
+    Output - Supplies the output buffer addressed at the first column of the
+        segment.
+
+    CountM - Supplies the number of rows of the input matrix to transpose.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    size_t n = N;
+
+    //
+    // Transpose elements from the input matrix to the output matrix 4 columns
+    // at a time.
+    //
+
+    while (n >= 4) {
+
+        const uint32_t* s = Input;
+        uint32_t* d = Output;
+        size_t m = CountM;
+
+#if defined(MLAS_SSE2_INTRINSICS) || defined(MLAS_NEON_INTRINSICS)
+
+        while (m >= 4) {
+
+            MlasTranspose4x4Block(s, N, d, M);
+
+            s += N * 4;
+            d += 4;
+            m -= 4;
+        }
+
+#endif
+
+        while (m > 0) {
+
+            uint32_t a0 = s[0];
+            uint32_t a1 = s[1];
+            uint32_t a2 = s[2];
+            uint32_t a3 = s[3];
+
+            d[M * 0] = a0;
+            d[M * 1] = a1;
+            d[M * 2] = a2;
+            d[M * 3] = a3;
+
+            s += N;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 4;
+        Output += M * 4;
+        n -= 4;
+    }
+
+    //
+    // Transpose elements from the input matrix to the output matrix for the
+    // remaining columns.
+    //
+
+    while (n > 0) {
+
+        const uint32_t* s = Input;
+        uint32_t* d = Output;
+        size_t m = CountM;
+
+        while (m > 0) {
+
+            d[0] = s[0];
+
+            s += N;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 1;
+        Output += M;
+        n -= 1;
+    }
+}
+
+template<typename ElementType>
+void
+MlasTransposeSegment(
+    const ElementType* Input,
+    ElementType* Output,
+    size_t CountM,
+    size_t M,
+    size_t N
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes a range of rows of the input matrix (M rows by
+    N columns) to the output matrix (N rows by M columns).
+
+    This implementation supports the element types without a vectorized
+    kernel by walking the input four columns at a time, which bounds the
+    stride pattern of the output stores.
+
+Arguments:
+
+    Input - Supplies the input buffer addressed at the first row of the
+        segment.
+
+    Output - Supplies the output buffer addressed at the first column of the
+        segment.
+
+    CountM - Supplies the number of rows of the input matrix to transpose.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    size_t n = N;
+
+    while (n >= 4) {
+
+        const ElementType* s = Input;
+        ElementType* d = Output;
+        size_t m = CountM;
+
+        while (m > 0) {
+
+            ElementType a0 = s[0];
+            ElementType a1 = s[1];
+            ElementType a2 = s[2];
+            ElementType a3 = s[3];
+
+            d[M * 0] = a0;
+            d[M * 1] = a1;
+            d[M * 2] = a2;
+            d[M * 3] = a3;
+
+            s += N;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 4;
+        Output += M * 4;
+        n -= 4;
+    }
+
+    while (n > 0) {
+
+        const ElementType* s = Input;
+        ElementType* d = Output;
+        size_t m = CountM;
+
+        while (m > 0) {
+
+            d[0] = s[0];
+
+            s += N;
+            d += 1;
+            m -= 1;
+        }
+
+        Input += 1;
+        Output += M;
+        n -= 1;
+    }
+}
+
+template<typename ElementType>
+void
+MlasTransposeThreaded(
+    void* Context,
+    int32_t ThreadId
+    )
+/*++
+
+Routine Description:
+
+    This routine is invoked from a worker thread to execute a segment of a
+    transpose operation.
+
+Arguments:
+
+    Context - Supplies the pointer to the context for the threaded operation.
+
+    ThreadId - Supplies the current index of the threaded operation.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    const auto* WorkBlock = (MLAS_TRANSPOSE_WORK_BLOCK*)Context;
+
+    //
+    // Partition the rows of the input matrix across the thread count. Rows of
+    // the input matrix are contiguous in the input buffer and become columns
+    // of the output matrix.
+    //
+
+    const size_t M = WorkBlock->M;
+    const size_t N = WorkBlock->N;
+
+    size_t IndexM;
+    size_t CountM;
+
+    MlasPartitionWork(ThreadId, WorkBlock->ThreadCountM, M, &IndexM, &CountM);
+
+    if (CountM == 0) {
+        return;
+    }
+
+    MlasTransposeSegment((const ElementType*)WorkBlock->Input + IndexM * N,
+                         (ElementType*)WorkBlock->Output + IndexM, CountM, M, N);
+}
+
+template<typename ElementType>
+void
+MlasTransposeImpl(
+    const ElementType* Input,
+    ElementType* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+/*++
+
+Routine Description:
+
+    This routine transposes the input matrix (M rows by N columns) to the
+    output matrix (N rows by M columns), optionally spreading the work across
+    multiple threads.
+
+Arguments:
+
+    Input - Supplies the input buffer.
+
+    Output - Supplies the output buffer.
+
+    M - Supplies the number of rows for the input matrix and the number of
+        columns for the output matrix.
+
+    N - Supplies the number of columns for the input matrix and the number of
+        rows for the output matrix.
+
+    ThreadPool - Supplies the thread pool object to use, else nullptr if the
+        base library threading support should be used.
+
+Return Value:
+
+    None.
+
+--*/
+{
+    //
+    // Compute the number of target threads given the size of the matrix.
+    // Small requests should run using a single thread to avoid the overhead
+    // of the threaded dispatch.
+    //
+
+    const size_t BytesToMove = M * N * sizeof(ElementType);
+
+    int32_t TargetThreadCount;
+
+    if (BytesToMove < MLAS_TRANSPOSE_THREAD_COMPLEXITY) {
+        TargetThreadCount = 1;
+    } else {
+        TargetThreadCount = int32_t(BytesToMove / MLAS_TRANSPOSE_THREAD_COMPLEXITY) + 1;
+    }
+
+    int32_t MaximumThreadCount = MlasGetMaximumThreadCount(ThreadPool);
+
+    if (TargetThreadCount >= MaximumThreadCount) {
+        TargetThreadCount = MaximumThreadCount;
+    }
+
+    if (size_t(TargetThreadCount) > M) {
+        TargetThreadCount = int32_t(M);
+    }
+
+    if (TargetThreadCount <= 1) {
+        MlasTransposeSegment(Input, Output, M, M, N);
+        return;
+    }
+
+    MLAS_TRANSPOSE_WORK_BLOCK WorkBlock;
+
+    WorkBlock.ThreadCountM = TargetThreadCount;
+    WorkBlock.Input = Input;
+    WorkBlock.Output = Output;
+    WorkBlock.M = M;
+    WorkBlock.N = N;
+
+    MlasExecuteThreaded(MlasTransposeThreaded<ElementType>, &WorkBlock, TargetThreadCount, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeImpl(Input, Output, M, N, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint8_t* Input,
+    uint8_t* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeImpl(Input, Output, M, N, nullptr);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeImpl(Input, Output, M, N, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint16_t* Input,
+    uint16_t* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeImpl(Input, Output, M, N, nullptr);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeImpl(Input, Output, M, N, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint32_t* Input,
+    uint32_t* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeImpl(Input, Output, M, N, nullptr);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    uint64_t* Output,
+    size_t M,
+    size_t N,
+    MLAS_THREADPOOL* ThreadPool
+    )
+{
+    MlasTransposeImpl(Input, Output, M, N, ThreadPool);
+}
+
+void
+MLASCALL
+MlasTranspose(
+    const uint64_t* Input,
+    uint64_t* Output,
+    size_t M,
+    size_t N
+    )
+{
+    MlasTransposeImpl(Input, Output, M, N, nullptr);
+}
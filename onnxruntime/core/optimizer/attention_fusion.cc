@@ -247,6 +247,10 @@ Status AttentionFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
           fused_count++;
           modified = true;
         }
+      } else {
+        DEBUG_LOG("AttentionFusion: candidate " << node.Name() << " not fused: layer norm fanout (Add=" << add_count
+                                                << ", MatMul=" << matmul_count << ", Shape=" << shape_count
+                                                << ", Reshape=" << reshape_count << ") matches neither BERT nor GPT");
       }
     }
   }
@@ -427,7 +431,7 @@ static bool FuseSubGraphQK(Node& layer_norm,
   // path to q
   std::vector<graph_utils::EdgeEndToMatch> q_varience_path{
       {0, 0, "Div", {7, 13}, kOnnxDomain},
-      {0, 0, "MatMul", {1, 9}, kOnnxDomain}};
+      {0, 0, "MatMul", {1, 9, 13}, kOnnxDomain}};
   std::vector<const Node::EdgeEnd*> edges;
   if (!graph_utils::FindPath(*(mask_nodes.add), true, q_varience_path, edges, logger)) {
     DEBUG_LOG("Failed to find path for q");
@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/common/logging/logging.h"
+#include "core/optimizer/rewrite_rule.h"
+#include "core/optimizer/cast_chain_elimination.h"
+#include "core/optimizer/utils.h"
+#include "core/graph/graph.h"
+#include "core/graph/graph_utils.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// Ops that move or reshape data without looking at the element values, so the element type
+// of the tensors flowing through them can be relabeled freely.
+bool IsPrecisionAgnostic(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Transpose", {1, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Reshape", {1, 5, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Squeeze", {1, 11, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Unsqueeze", {1, 11, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Flatten", {1, 9, 11, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Identity", {1, 13});
+}
+
+// True when casting 'from' to 'to' preserves every representable value, so a
+// from->to->from round trip is exact.
+bool IsLosslessCast(int64_t from, int64_t to) {
+  namespace on = ONNX_NAMESPACE;
+  switch (from) {
+    case on::TensorProto_DataType_FLOAT16:
+    case on::TensorProto_DataType_BFLOAT16:
+      return to == on::TensorProto_DataType_FLOAT || to == on::TensorProto_DataType_DOUBLE;
+    case on::TensorProto_DataType_FLOAT:
+      return to == on::TensorProto_DataType_DOUBLE;
+    case on::TensorProto_DataType_INT8:
+      return to == on::TensorProto_DataType_INT16 || to == on::TensorProto_DataType_INT32 ||
+             to == on::TensorProto_DataType_INT64;
+    case on::TensorProto_DataType_INT16:
+      return to == on::TensorProto_DataType_INT32 || to == on::TensorProto_DataType_INT64;
+    case on::TensorProto_DataType_INT32:
+      return to == on::TensorProto_DataType_INT64;
+    case on::TensorProto_DataType_UINT8:
+      return to == on::TensorProto_DataType_UINT16 || to == on::TensorProto_DataType_UINT32 ||
+             to == on::TensorProto_DataType_UINT64 || to == on::TensorProto_DataType_INT16 ||
+             to == on::TensorProto_DataType_INT32 || to == on::TensorProto_DataType_INT64;
+    case on::TensorProto_DataType_UINT16:
+      return to == on::TensorProto_DataType_UINT32 || to == on::TensorProto_DataType_UINT64 ||
+             to == on::TensorProto_DataType_INT32 || to == on::TensorProto_DataType_INT64;
+    case on::TensorProto_DataType_UINT32:
+      return to == on::TensorProto_DataType_UINT64 || to == on::TensorProto_DataType_INT64;
+    default:
+      return false;
+  }
+}
+
+// Walks producers upwards from 'node' (the downstream Cast) through single-use
+// precision-agnostic nodes, looking for the upstream Cast that 'node' inverts.
+// The traversed precision-agnostic nodes are collected in 'chain'.
+// Returns nullptr when no such upstream Cast exists.
+const Node* FindInverseCastProducer(const Graph& graph, const Node& node, int64_t to_type,
+                                    std::vector<const Node*>& chain, const logging::Logger& logger) {
+  const Node* cur = graph_utils::GetInputNode(node, 0);
+  while (cur != nullptr && IsPrecisionAgnostic(*cur)) {
+    if (cur->GetOutputEdgesCount() != 1 || !graph.GetNodeOutputsInGraphOutputs(*cur).empty()) {
+      return nullptr;
+    }
+    chain.push_back(cur);
+    cur = graph_utils::GetInputNode(*cur, 0);
+  }
+
+  if (cur == nullptr || !graph_utils::IsSupportedOptypeVersionAndDomain(*cur, "Cast", {6, 9, 13})) {
+    return nullptr;
+  }
+
+  if (cur->GetOutputEdgesCount() != 1 || !graph_utils::CanRemoveNode(graph, *cur, logger)) {
+    return nullptr;
+  }
+
+  const auto* cast_input_type = cur->InputDefs()[0]->TypeAsProto();
+  if (cast_input_type == nullptr || !cast_input_type->tensor_type().has_elem_type() ||
+      static_cast<int64_t>(cast_input_type->tensor_type().elem_type()) != to_type) {
+    return nullptr;
+  }
+
+  // The values travel between the two Casts in the widened type; cancelling the pair is only
+  // exact when the upstream Cast did not lose information.
+  const auto* widened_type = cur->OutputDefs()[0]->TypeAsProto();
+  if (widened_type == nullptr || !widened_type->tensor_type().has_elem_type() ||
+      !IsLosslessCast(to_type, widened_type->tensor_type().elem_type())) {
+    return nullptr;
+  }
+
+  return cur;
+}
+
+}  // namespace
+
+Status CastChainElimination::Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const {
+  const auto* to_attr = graph_utils::GetNodeAttribute(node, "to");
+  ORT_ENFORCE(to_attr != nullptr, "Cast node is missing the 'to' attribute.");
+
+  std::vector<const Node*> chain;
+  const Node* upstream_cast = FindInverseCastProducer(graph, node, to_attr->i(), chain, logger);
+  ORT_ENFORCE(upstream_cast != nullptr, "Expecting an upstream Cast node since SatisfyCondition passed.");
+
+  // Relabel the defs between the two Casts to the type the pair preserves.
+  ONNX_NAMESPACE::TypeProto new_type;
+  new_type.mutable_tensor_type()->set_elem_type(static_cast<int32_t>(to_attr->i()));
+  for (const Node* chain_node : chain) {
+    Node& mutable_chain_node = *graph.GetNode(chain_node->Index());
+    ORT_RETURN_IF_ERROR(mutable_chain_node.MutableOutputDefs()[0]->UpdateTypeAndShape(
+        new_type, /*strict*/ false, /*override_types*/ true, logger));
+  }
+
+  graph_utils::RemoveNode(graph, *graph.GetNode(upstream_cast->Index()));
+
+  if (graph_utils::RemoveNode(graph, node)) {
+    rule_effect = RewriteRuleEffect::kRemovedCurrentNode;
+  }
+
+  return Status::OK();
+}
+
+bool CastChainElimination::SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const {
+  if (!graph_utils::CanRemoveNode(graph, node, logger)) {
+    return false;
+  }
+
+  const auto* to_attr = graph_utils::GetNodeAttribute(node, "to");
+  if (to_attr == nullptr) {
+    return false;
+  }
+
+  std::vector<const Node*> chain;
+  return FindInverseCastProducer(graph, node, to_attr->i(), chain, logger) != nullptr;
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,35 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/rewrite_rule.h"
+
+namespace onnxruntime {
+
+/**
+@Class CastChainElimination
+
+Rewrite rule that cancels an inverse pair of Cast nodes, optionally separated by a chain of
+precision-agnostic single-use nodes (Transpose, Reshape, Squeeze, Unsqueeze, Flatten, Identity).
+The intervening nodes only move data, so their defs are relabeled to the original element type
+and both Casts are removed. The pair is only cancelled when the upstream Cast widens the type
+losslessly, so the rewrite is exact.
+
+It is attempted to be triggered only on nodes with op type "Cast".
+*/
+class CastChainElimination : public RewriteRule {
+ public:
+  CastChainElimination() noexcept : RewriteRule("CastChainElimination") {}
+
+  std::vector<std::string> TargetOpTypes() const noexcept override {
+    return {"Cast"};
+  }
+
+ private:
+  bool SatisfyCondition(const Graph& graph, const Node& node, const logging::Logger& logger) const override;
+
+  Status Apply(Graph& graph, Node& node, RewriteRuleEffect& rule_effect, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
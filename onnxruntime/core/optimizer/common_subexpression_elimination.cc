@@ -5,10 +5,13 @@
 #include "core/optimizer/utils.h"
 #include "core/graph/graph_utils.h"
 
+#include <algorithm>
 #include <memory>
+#include <string>
 #include <type_traits>
 #include <unordered_map>
 #include <unordered_set>
+#include <utility>
 #include <vector>
 
 // This optimization pass will collapse expressions that always evaluate to the same value
@@ -32,6 +35,12 @@
 // first every graph input, constant initializer and graph node output are assigned
 // an equivalence class, and then nodes that have the same operation and equivalent inputs
 // are collapsed.
+//
+// In addition, expressions that both If branches compute from outer scope values are hoisted
+// into the parent graph, where they run once regardless of which branch is taken. Requiring
+// the expression on both branches ensures no work is added on the path that did not need it;
+// unconditionally executed subgraphs (Loop and Scan bodies) are instead handled by the
+// LoopInvariantCodeMotion pass, which needs no such agreement check.
 
 namespace onnxruntime {
 
@@ -316,6 +325,26 @@ struct NodeArgPtrEquality {
 bool IsNodeSupported(const Node& node) {
   return !node.ContainsSubgraph() && optimizer_utils::IsOperationDeterministic(node.Domain(), node.OpType());
 }
+
+// Two hoistable nodes in sibling subgraphs compute the same value when they run the same
+// operation on the same outer scope values.
+bool SameHoistableExpression(const Node& lhs, const Node& rhs) {
+  if (lhs.OpType() != rhs.OpType() || lhs.Domain() != rhs.Domain() ||
+      lhs.InputDefs().size() != rhs.InputDefs().size()) {
+    return false;
+  }
+  for (std::size_t i = 0; i < lhs.InputDefs().size(); ++i) {
+    const NodeArg* lhs_input = Normalize(lhs.InputDefs()[i]);
+    const NodeArg* rhs_input = Normalize(rhs.InputDefs()[i]);
+    if ((lhs_input == nullptr) != (rhs_input == nullptr)) {
+      return false;
+    }
+    if (lhs_input != nullptr && lhs_input->Name() != rhs_input->Name()) {
+      return false;
+    }
+  }
+  return SameAttributes(&lhs.GetAttributes(), &rhs.GetAttributes());
+}
 }  // namespace
 
 }  // namespace onnxruntime
@@ -442,6 +471,50 @@ Status CommonSubexpressionElimination::ApplyImpl(Graph& graph, bool& modified, i
     }
   }
 
+  // After merging within this graph level, hoist expressions that both If branches compute
+  // from outer scope values into this graph, so they run once regardless of the branch taken.
+  // Hoisting from each branch leaves two equal nodes in this graph that the next application
+  // of this pass merges. Multi-node common chains migrate one layer per application for the
+  // same reason: each hoisted layer turns its consumers' inputs into outer scope values.
+  // Subgraphs that execute unconditionally (Loop and Scan bodies) are handled by the
+  // LoopInvariantCodeMotion pass, which does not need the cross-branch agreement check.
+  for (NodeIndex node_index : node_topology_list) {
+    Node* node = graph.GetNode(node_index);
+    if (node == nullptr || node->OpType() != "If" || node->Domain() != kOnnxDomain) {
+      continue;
+    }
+
+    std::vector<std::pair<Graph*, Node*>> candidates;
+    for (const auto& name_to_subgraph : node->GetAttributeNameToMutableSubgraphMap()) {
+      Graph& subgraph = *name_to_subgraph.second;
+      const auto local_value_names = optimizer_utils::CollectSubgraphLocalValueNames(subgraph);
+      GraphViewer subgraph_viewer(subgraph);
+      for (NodeIndex subgraph_node_index : subgraph_viewer.GetNodesInTopologicalOrder()) {
+        Node* subgraph_node = subgraph.GetNode(subgraph_node_index);
+        if (subgraph_node != nullptr &&
+            optimizer_utils::CanHoistNodeFromSubgraph(subgraph, *subgraph_node, local_value_names)) {
+          candidates.emplace_back(&subgraph, subgraph_node);
+        }
+      }
+    }
+
+    for (const auto& candidate : candidates) {
+      if (std::none_of(candidates.begin(), candidates.end(),
+                       [&candidate](const std::pair<Graph*, Node*>& other) {
+                         return other.first != candidate.first &&
+                                SameHoistableExpression(*other.second, *candidate.second);
+                       })) {
+        continue;
+      }
+
+      LOGS(logger, VERBOSE) << "Hoisting " << candidate.second->OpType() << " node "
+                            << candidate.second->Name() << " out of a branch of If node "
+                            << node->Name() << ".";
+      optimizer_utils::HoistNodeFromSubgraph(graph, *candidate.first, *candidate.second);
+      modified = true;
+    }
+  }
+
   return Status::OK();
 }
 
@@ -9,7 +9,9 @@ namespace onnxruntime {
 
 /**
 @Class CommonSubexpressionElimination
-Merge nodes that always evaluate to the same result.
+Merge nodes that always evaluate to the same result, and hoist expressions that both If
+branches compute from outer scope values into the parent graph so they run once regardless
+of the branch taken.
 */
 class CommonSubexpressionElimination : public GraphTransformer {
  public:
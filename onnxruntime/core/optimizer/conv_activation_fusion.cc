@@ -163,6 +163,11 @@ Status ConvActivationFusion::ApplyImpl(Graph& graph, bool& modified, int graph_l
           !graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Tanh", {6, 13})) {
         if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "LeakyRelu", {6})) {
           activation_params.push_back(graph_utils::GetNodeAttribute(next_node, "alpha")->f());
+        } else if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "HardSigmoid", {6})) {
+          const auto* alpha_attr = graph_utils::GetNodeAttribute(next_node, "alpha");
+          const auto* beta_attr = graph_utils::GetNodeAttribute(next_node, "beta");
+          activation_params.push_back(alpha_attr != nullptr ? alpha_attr->f() : 0.2f);
+          activation_params.push_back(beta_attr != nullptr ? beta_attr->f() : 0.5f);
         } else if (graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Clip", {6, 11, 12, 13})) {
           float min, max;
           if (GetClipConstantMinMax(graph, next_node, min, max)) {
@@ -0,0 +1,212 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/elementwise_chain_fusion.h"
+
+#include "core/common/logging/logging.h"
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+using namespace onnxruntime;
+
+namespace {
+
+// matches the program capacity of the FusedElementwise CUDA kernel; longer
+// chains are split into several fused nodes
+constexpr size_t kMaxFusedOps = 16;
+
+bool IsSupportedUnary(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sigmoid", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Tanh", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Relu", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Exp", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sqrt", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Neg", {6, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Abs", {6, 13});
+}
+
+bool IsSupportedBinary(const Node& node) {
+  return graph_utils::IsSupportedOptypeVersionAndDomain(node, "Add", {7, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Sub", {7, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Mul", {7, 13}) ||
+         graph_utils::IsSupportedOptypeVersionAndDomain(node, "Div", {7, 13});
+}
+
+bool IsSupportedFloatType(const NodeArg& node_arg) {
+  const TypeProto* type = node_arg.TypeAsProto();
+  if (type == nullptr || !utils::HasElemType(type->tensor_type())) {
+    return false;
+  }
+  const auto elem_type = type->tensor_type().elem_type();
+  return elem_type == TensorProto_DataType_FLOAT ||
+         elem_type == TensorProto_DataType_FLOAT16 ||
+         elem_type == TensorProto_DataType_DOUBLE;
+}
+
+// all dimensions are concrete 1's (or rank 0), so the operand holds a single
+// element the kernel can broadcast
+bool IsScalarShape(const TensorShapeProto* shape) {
+  if (shape == nullptr) {
+    return false;
+  }
+  for (int i = 0; i < shape->dim_size(); i++) {
+    if (!utils::HasDimValue(shape->dim(i)) || shape->dim(i).dim_value() != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// shapes match dimension by dimension, on concrete values or on identical
+// symbolic parameters
+bool SameShape(const TensorShapeProto* lhs, const TensorShapeProto* rhs) {
+  if (lhs == nullptr || rhs == nullptr || lhs->dim_size() != rhs->dim_size()) {
+    return false;
+  }
+  for (int i = 0; i < lhs->dim_size(); i++) {
+    const auto& l = lhs->dim(i);
+    const auto& r = rhs->dim(i);
+    if (utils::HasDimValue(l) && utils::HasDimValue(r)) {
+      if (l.dim_value() != r.dim_value()) {
+        return false;
+      }
+    } else if (utils::HasDimParam(l) && utils::HasDimParam(r)) {
+      if (l.dim_param() != r.dim_param() || l.dim_param().empty()) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// picks the operand of a binary node given the arg the chain value enters
+// through; fails if the operand would require broadcasting in the kernel
+bool TryGetBinaryOperand(Node& node, NodeArg* chain_arg, NodeArg*& operand, bool& reversed) {
+  auto& inputs = node.MutableInputDefs();
+  if (inputs[0] == chain_arg) {
+    operand = inputs[1];
+    reversed = false;
+  } else if (inputs[1] == chain_arg) {
+    operand = inputs[0];
+    reversed = true;
+  } else {
+    return false;
+  }
+  return SameShape(chain_arg->Shape(), operand->Shape()) || IsScalarShape(operand->Shape());
+}
+
+struct ChainStep {
+  Node* node;
+  NodeArg* operand;  // nullptr for unary steps
+  bool reversed;
+};
+
+}  // namespace
+
+namespace onnxruntime {
+
+Status ElementwiseChainFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed as part of an earlier chain
+
+    auto& node = *node_ptr;
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        (!IsSupportedUnary(node) && !IsSupportedBinary(node))) {
+      continue;
+    }
+
+    // resolve the chain input of the head node; for a binary head try either
+    // input so that e.g. scalar - x starts a chain through x
+    NodeArg* chain_input = node.MutableInputDefs()[0];
+    ChainStep head{&node, nullptr, false};
+    if (IsSupportedBinary(node)) {
+      if (!TryGetBinaryOperand(node, chain_input, head.operand, head.reversed)) {
+        chain_input = node.MutableInputDefs()[1];
+        if (!TryGetBinaryOperand(node, chain_input, head.operand, head.reversed)) {
+          continue;
+        }
+      }
+    }
+
+    if (!IsSupportedFloatType(*chain_input)) {
+      continue;
+    }
+
+    std::vector<ChainStep> steps{head};
+
+    // extend while the chain value has a single in-graph consumer that is
+    // another fusable pointwise op on the same provider
+    Node* cur = &node;
+    while (steps.size() < kMaxFusedOps) {
+      if (!optimizer_utils::CheckOutputEdges(graph, *cur, 1)) {
+        break;
+      }
+
+      Node& next = *graph.GetNode(cur->OutputNodesBegin()->Index());
+      if (next.GetExecutionProviderType() != node.GetExecutionProviderType() ||
+          (!IsSupportedUnary(next) && !IsSupportedBinary(next))) {
+        break;
+      }
+
+      ChainStep step{&next, nullptr, false};
+      if (IsSupportedBinary(next) &&
+          !TryGetBinaryOperand(next, cur->MutableOutputDefs()[0], step.operand, step.reversed)) {
+        break;
+      }
+
+      steps.push_back(step);
+      cur = &next;
+    }
+
+    // a single op gains nothing from the fused kernel
+    if (steps.size() < 2) {
+      continue;
+    }
+
+    std::vector<NodeArg*> fused_inputs{chain_input};
+    std::vector<std::string> ops;
+    std::vector<int64_t> reversed;
+    std::vector<std::reference_wrapper<Node>> nodes_to_fuse;
+    for (const auto& step : steps) {
+      ops.push_back(step.node->OpType());
+      reversed.push_back(step.reversed ? 1 : 0);
+      if (step.operand != nullptr) {
+        fused_inputs.push_back(step.operand);
+      }
+      nodes_to_fuse.push_back(*step.node);
+    }
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName("FusedElementwise"),
+                                     "FusedElementwise",
+                                     "fused pointwise chain starting at " + node.OpType(),
+                                     fused_inputs,
+                                     {},
+                                     {},
+                                     kMSDomain);
+    fused_node.AddAttribute("ops", ops);
+    fused_node.AddAttribute("reversed", reversed);
+
+    // finalize node fusion (e.g. remove chain nodes and shift the output)
+    fused_node.SetExecutionProviderType(node.GetExecutionProviderType());
+    graph_utils::FinalizeNodeFusion(graph, nodes_to_fuse, fused_node);
+    modified = true;
+
+    VLOGF(logger, 1, "Fused %d pointwise ops into a FusedElementwise node.\n", static_cast<int>(ops.size()));
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,28 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class ElementwiseChainFusion
+
+Collapse chains of adjacent pointwise ops (Add/Sub/Mul/Div and simple
+activations) assigned to the CUDA execution provider into single
+FusedElementwise nodes, so the chain runs as one kernel without writing the
+intermediate tensors to memory. Only chains whose binary operands have the
+shape of the chain input or are scalars qualify, since the fused kernel does
+not implement general broadcasting.
+*/
+class ElementwiseChainFusion : public GraphTransformer {
+ public:
+  ElementwiseChainFusion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("ElementwiseChainFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/fp16_execution_transformer.h"
+
+#include <unordered_set>
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+
+namespace onnxruntime {
+
+namespace {
+
+// Ops whose CUDA float16 kernels are numerically safe to run in half precision throughout.
+// Softmax, Exp, Pow, reductions and the normalization ops intentionally stay float32.
+bool IsFp16SafeOp(const Node& node) {
+  static const std::unordered_set<std::string> fp16_safe_ops = {
+      "Add", "AveragePool", "Concat", "Conv", "ConvTranspose", "Div", "Flatten", "Gather",
+      "Gemm", "GlobalAveragePool", "GlobalMaxPool", "LeakyRelu", "MatMul", "MaxPool", "Mul",
+      "Relu", "Reshape", "Sigmoid", "Slice", "Split", "Squeeze", "Sub", "Tanh", "Transpose",
+      "Unsqueeze"};
+  return node.Domain() == kOnnxDomain && fp16_safe_ops.count(node.OpType()) != 0;
+}
+
+bool IsFloatTensor(const NodeArg* arg) {
+  if (arg == nullptr || !arg->Exists()) {
+    return false;
+  }
+  const TypeProto* type = arg->TypeAsProto();
+  return type != nullptr && type->value_case() == TypeProto::kTensorType &&
+         type->tensor_type().elem_type() == TensorProto_DataType_FLOAT;
+}
+
+bool HasFloatArg(const Node& node) {
+  for (const NodeArg* def : node.InputDefs()) {
+    if (IsFloatTensor(def)) {
+      return true;
+    }
+  }
+  for (const NodeArg* def : node.OutputDefs()) {
+    if (IsFloatTensor(def)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+NodeArg& InsertCast(Graph& graph, NodeArg* old_arg, TypeProto* new_type, bool new_on_input,
+                    int64_t to_type, const std::string& provider_type) {
+  std::string node_name = graph.GenerateNodeName("InsertedFp16Cast");
+  auto* new_arg = &graph.GetOrCreateNodeArg(node_name, new_type);
+
+  std::vector<NodeArg*> input_defs = {new_on_input ? new_arg : old_arg};
+  std::vector<NodeArg*> output_defs = {new_on_input ? old_arg : new_arg};
+
+  auto& cast_node = graph.AddNode(node_name, "Cast", "cast at a float32/float16 execution boundary",
+                                  input_defs, output_defs);
+  cast_node.AddAttribute("to", to_type);
+  cast_node.SetExecutionProviderType(provider_type);
+  return *new_arg;
+}
+
+}  // namespace
+
+Status Fp16ExecutionTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level,
+                                           const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& order = graph_viewer.GetNodesInTopologicalOrder();
+
+  // first decide the set of nodes to convert, so boundary decisions below can tell whether a
+  // value flows between two converted nodes (no cast needed) or leaves the converted region
+  std::unordered_set<NodeIndex> to_convert;
+  for (NodeIndex index : order) {
+    const Node* node = graph.GetNode(index);
+    if (node != nullptr &&
+        node->GetExecutionProviderType() == kCudaExecutionProvider &&
+        IsFp16SafeOp(*node) && !node->ContainsSubgraph() && HasFloatArg(*node)) {
+      to_convert.insert(index);
+    }
+  }
+
+  TypeProto float16_type;
+  float16_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT16);
+
+  const auto& output_args = graph.GetOutputs();
+  const std::unordered_set<const NodeArg*> graph_outputs(output_args.begin(), output_args.end());
+
+  // maps a float32 value to the float16 value converted consumers read instead. an entry mapping
+  // an arg to itself means the arg was retyped in place.
+  std::map<NodeArg*, NodeArg*> fp16_values;
+
+  for (NodeIndex index : order) {
+    auto* node = graph.GetNode(index);
+    if (node == nullptr) {
+      continue;
+    }
+
+    if (to_convert.count(index) == 0) {
+      ORT_RETURN_IF_ERROR(Recurse(*node, modified, graph_level, logger));
+      continue;
+    }
+
+    std::map<const NodeArg*, NodeArg*> replacement_defs;
+
+    for (NodeArg* input : node->MutableInputDefs()) {
+      if (!IsFloatTensor(input)) {
+        continue;
+      }
+
+      auto it = fp16_values.find(input);
+      if (it != fp16_values.end()) {
+        if (it->second != input) {
+          replacement_defs[input] = it->second;
+        }
+        continue;
+      }
+
+      NodeArg* fp16_arg = nullptr;
+      const TensorProto* initializer =
+          graph_utils::GetConstantInitializer(graph, input->Name(), /* check_outer_scope */ false);
+      if (initializer != nullptr) {
+        // convert the weight once at load instead of casting it every Run
+        Initializer data(*initializer, graph.ModelPath());
+        TensorProto fp16_proto = data.ToFP16(graph.GenerateNodeArgName(input->Name() + "_fp16"));
+        fp16_arg = &graph_utils::AddInitializer(graph, fp16_proto);
+      } else {
+        // graph input or value produced outside the converted region
+        fp16_arg = &InsertCast(graph, input, &float16_type, /* new_on_input */ false,
+                               static_cast<int64_t>(TensorProto_DataType_FLOAT16),
+                               kCudaExecutionProvider);
+      }
+      replacement_defs[input] = fp16_arg;
+      fp16_values[input] = fp16_arg;
+    }
+
+    for (NodeArg* output : node->MutableOutputDefs()) {
+      if (!IsFloatTensor(output)) {
+        continue;
+      }
+
+      bool needs_float = graph_outputs.count(output) != 0;
+      if (!needs_float) {
+        for (const Node* consumer : graph.GetConsumerNodes(output->Name())) {
+          if (to_convert.count(consumer->Index()) == 0) {
+            needs_float = true;
+            break;
+          }
+        }
+      }
+
+      if (!needs_float) {
+        // every reader is converted too; retype the value in place
+        graph.SetNodeArgType(*output, float16_type);
+        fp16_values[output] = output;
+      } else {
+        // the float32 arg keeps its name for the unconverted readers; this node now produces a
+        // new float16 arg that the inserted Cast converts back
+        NodeArg& fp16_arg = InsertCast(graph, output, &float16_type, /* new_on_input */ true,
+                                       static_cast<int64_t>(TensorProto_DataType_FLOAT),
+                                       kCudaExecutionProvider);
+        replacement_defs[output] = &fp16_arg;
+        fp16_values[output] = &fp16_arg;
+      }
+
+      modified = true;
+    }
+
+    node->ReplaceDefs(replacement_defs);
+    modified = modified || !replacement_defs.empty();
+
+    ORT_RETURN_IF_ERROR(Recurse(*node, modified, graph_level, logger));
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
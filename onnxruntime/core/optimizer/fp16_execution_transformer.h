@@ -0,0 +1,33 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class Fp16ExecutionTransformer
+
+Opt-in mixed precision execution: rewrites eligible float32 subgraphs assigned to the CUDA
+execution provider to float16 so they run through the half-precision (tensor core) kernels
+without an offline model conversion. Conversion is limited to an allow-list of numerically
+safe ops; sensitive ops such as Softmax, reductions and normalizations stay in float32.
+Constant initializers feeding converted nodes are converted to float16 once at load, and
+Cast nodes are inserted at the float32/float16 boundaries (runs of converted nodes share
+one cast per value).
+
+Runs after the fusion transformers so it sees the final node set, and before
+InsertCastTransformer whose duplicate-cast removal cleans up any redundant boundary casts.
+*/
+class Fp16ExecutionTransformer : public GraphTransformer {
+ public:
+  Fp16ExecutionTransformer(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("Fp16ExecutionTransformer", compatible_execution_providers) {}
+
+ private:
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
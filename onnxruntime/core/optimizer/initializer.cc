@@ -18,10 +18,6 @@ Status Initializer::ReadExternalRawData(
           tensor_proto.data_type() != ONNX_NAMESPACE::TensorProto_DataType_STRING,
       "External data type must not be UNDEFINED or STRING.");
 
-  ORT_RETURN_IF(
-      model_path.IsEmpty(),
-      "model_path must not be empty. Ensure that a path is provided when the model is created or loaded.");
-
   std::unique_ptr<ExternalDataInfo> external_data{};
   ORT_RETURN_IF_ERROR(ExternalDataInfo::Create(tensor_proto.external_data(), external_data));
 
@@ -37,6 +33,18 @@ Status Initializer::ReadExternalRawData(
       "Computed size: ", actual_tensor_data_length,
       ", external_data.length: ", external_data_length);
 
+  if (external_data->GetRelPath() == utils::kTensorProtoMemoryAddressTag) {
+    // the data is already in memory (e.g. the ORT format model's flatbuffer) at the address
+    // carried by the offset field
+    const auto* data = reinterpret_cast<const char*>(static_cast<uintptr_t>(external_data->GetOffset()));
+    raw_data.assign(data, data + actual_tensor_data_length);
+    return Status::OK();
+  }
+
+  ORT_RETURN_IF(
+      model_path.IsEmpty(),
+      "model_path must not be empty. Ensure that a path is provided when the model is created or loaded.");
+
   Path external_data_relative_path{};
   ORT_RETURN_IF_ERROR(Path::Parse(
       external_data->GetRelPath(), external_data_relative_path));
@@ -9,12 +9,18 @@
 
 #include "core/common/common.h"
 #include "core/common/path.h"
+#include "core/framework/startup_memory_profiler.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/graph/onnx_protobuf.h"
 #include "core/util/math.h"
 
 namespace onnxruntime {
 
+// In-memory view over an initializer TensorProto used by the optimizers.
+// When constructed from a proto that stores its data as raw_data, the proto's buffer is
+// referenced directly and only copied on the first mutating access, so read-only passes
+// (and round-tripping folded constants back through ToProto) do not duplicate the weights.
+// The source proto must outlive the Initializer until a mutable accessor has been called.
 class Initializer final {
  public:
   // Construct an initializer with the provided name and data type, with all values initialized to 0
@@ -71,7 +77,10 @@ class Initializer final {
 
     if (tensor_proto.data_location() != ONNX_NAMESPACE::TensorProto_DataLocation_EXTERNAL) {
       if (utils::HasRawData(tensor_proto)) {
-        raw_data_.assign(tensor_proto.raw_data().begin(), tensor_proto.raw_data().end());
+        // reference the proto's buffer directly. EnsureWritable() makes a copy if the data
+        // is ever mutated, so the proto only needs to outlive read-only usage.
+        flat_data_ = tensor_proto.raw_data().data();
+        flat_data_size_ = tensor_proto.raw_data().size();
       } else {
         switch (data_type_) {
           case ONNX_NAMESPACE::TensorProto_DataType_FLOAT16: 
@@ -124,11 +133,15 @@ class Initializer final {
       const auto status = ReadExternalRawData(tensor_proto, model_path, raw_data_);
       ORT_ENFORCE(status.IsOK(), "ReadExternalRawData() failed: ", status.ErrorMessage());
     }
+    // the borrowed raw_data view costs nothing; only copied-out data is reported
+    startup_profile::RecordAllocation("optimizer::Initializer copy from proto", AllocatedBytes());
   }
 
-  ~Initializer() = default;
+  ~Initializer() {
+    startup_profile::RecordDeallocation(AllocatedBytes());
+  }
 
-  void ToProto(ONNX_NAMESPACE::TensorProto& tensor_proto) {
+  void ToProto(ONNX_NAMESPACE::TensorProto& tensor_proto) const {
     tensor_proto.clear_name();
     if (!name_.empty()) {
       tensor_proto.set_name(name_);
@@ -142,7 +155,10 @@ class Initializer final {
     tensor_proto.clear_data_type();
     tensor_proto.set_data_type(data_type_);
 
-    if (!raw_data_.empty()) {
+    if (flat_data_ != nullptr) {
+      tensor_proto.clear_raw_data();
+      tensor_proto.set_raw_data(flat_data_, flat_data_size_);
+    } else if (!raw_data_.empty()) {
       tensor_proto.clear_raw_data();
       tensor_proto.set_raw_data(raw_data_.data(), raw_data_.size());
     } else {
@@ -190,7 +206,7 @@ class Initializer final {
     }
   }
 
-  ONNX_NAMESPACE::TensorProto ToFP16(const std::string name) {
+  ONNX_NAMESPACE::TensorProto ToFP16(const std::string name) const {
     ONNX_NAMESPACE::TensorProto tensor_proto;
     tensor_proto.set_name(name);
 
@@ -202,23 +218,23 @@ class Initializer final {
 
     switch (data_type_) {
       case ONNX_NAMESPACE::TensorProto_DataType_FLOAT16: {
-        uint16_t* dst = data<uint16_t>();
+        const uint16_t* src = data<uint16_t>();
         for (int i = 0; i < size_; i++) {
-          tensor_proto.add_int32_data(dst[i]);
+          tensor_proto.add_int32_data(src[i]);
         }
         break;
       }
       case ONNX_NAMESPACE::TensorProto_DataType_FLOAT: {
-        float* dst = data<float>();
+        const float* src = data<float>();
         for (int i = 0; i < size_; i++) {
-          tensor_proto.add_int32_data(math::floatToHalf(dst[i]));
+          tensor_proto.add_int32_data(math::floatToHalf(src[i]));
         }
         break;
       }
       case ONNX_NAMESPACE::TensorProto_DataType_DOUBLE: {
-        double* dst = data<double>();
+        const double* src = data<double>();
         for (int i = 0; i < size_; i++) {
-          tensor_proto.add_int32_data(math::doubleToHalf(dst[i]));
+          tensor_proto.add_int32_data(math::doubleToHalf(src[i]));
         }
         break;
       }
@@ -229,7 +245,7 @@ class Initializer final {
     return tensor_proto;
   }
 
-  ONNX_NAMESPACE::TensorProto ToBFloat16(const std::string name) {
+  ONNX_NAMESPACE::TensorProto ToBFloat16(const std::string name) const {
     ONNX_NAMESPACE::TensorProto tensor_proto;
     tensor_proto.set_name(name);
 
@@ -241,23 +257,23 @@ class Initializer final {
 
     switch (data_type_) {
       case ONNX_NAMESPACE::TensorProto_DataType_FLOAT: {
-        float* dst = data<float>();
+        const float* src = data<float>();
         for (int i = 0; i < size_; i++) {
-          tensor_proto.add_int32_data(BFloat16(dst[i]).val);
+          tensor_proto.add_int32_data(BFloat16(src[i]).val);
         }
         break;
       }
       case ONNX_NAMESPACE::TensorProto_DataType_DOUBLE: {
-        double* dst = data<double>();
+        const double* src = data<double>();
         for (int i = 0; i < size_; i++) {
-          tensor_proto.add_int32_data(math::doubleToHalf(dst[i]));
+          tensor_proto.add_int32_data(math::doubleToHalf(src[i]));
         }
         break;
       }
       case ONNX_NAMESPACE::TensorProto_DataType_BFLOAT16: {
-        uint16_t* dst = data<uint16_t>();
+        const uint16_t* src = data<uint16_t>();
         for (int i = 0; i < size_; i++) {
-          tensor_proto.add_int32_data(dst[i]);
+          tensor_proto.add_int32_data(src[i]);
         }
         break;
       }
@@ -282,6 +298,7 @@ class Initializer final {
 
   template <typename T>
   T* data() {
+    EnsureWritable();
     if (!raw_data_.empty()) {
       return reinterpret_cast<T*>(raw_data_.data());
     }
@@ -316,6 +333,9 @@ class Initializer final {
 
   template <typename T>
   const T* data() const {
+    if (flat_data_ != nullptr) {
+      return reinterpret_cast<const T*>(flat_data_);
+    }
     if (!raw_data_.empty()) {
       return reinterpret_cast<const T*>(raw_data_.data());
     }
@@ -743,11 +763,36 @@ class Initializer final {
   static Status ReadExternalRawData(
       const ONNX_NAMESPACE::TensorProto& tensor_proto, const Path& model_path, std::vector<char>& raw_data);
 
+  // detach from a borrowed proto buffer before handing out a mutable pointer
+  void EnsureWritable() {
+    if (flat_data_ != nullptr) {
+      raw_data_.assign(flat_data_, flat_data_ + flat_data_size_);
+      startup_profile::RecordAllocation("optimizer::Initializer copy-on-write detach", flat_data_size_);
+      flat_data_ = nullptr;
+      flat_data_size_ = 0;
+    }
+  }
+
+  // bytes held in this instance's own buffers (the borrowed proto view is excluded)
+  size_t AllocatedBytes() const {
+    return raw_data_.size() * sizeof(char) +
+           float_data_.size() * sizeof(float) +
+           float16_data_.size() * sizeof(uint16_t) +
+           double_data_.size() * sizeof(double) +
+           int32_data_.size() * sizeof(int32_t) +
+           int64_data_.size() * sizeof(int64_t);
+  }
+
   int data_type_;
   std::string name_;
   std::vector<int64_t> dims_;
   int64_t size_;
 
+  // borrowed view into the source proto's raw_data; cleared by EnsureWritable() once the
+  // data has been copied into raw_data_
+  const char* flat_data_{nullptr};
+  size_t flat_data_size_{0};
+
   std::vector<char> raw_data_;
   std::vector<float> float_data_;
   std::vector<uint16_t> float16_data_;
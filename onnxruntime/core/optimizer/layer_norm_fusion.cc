@@ -7,6 +7,8 @@
 #include "float.h"
 #include <deque>
 
+#define DEBUG_LOG(x) LOGS(logger, VERBOSE) << x
+
 using namespace ONNX_NAMESPACE;
 using namespace onnxruntime::common;
 namespace onnxruntime {
@@ -106,6 +108,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         sub_node.GetExecutionProviderType() != reduce_mean_node.GetExecutionProviderType() ||
         !optimizer_utils::CheckOutputEdges(graph, sub_node, subCnt == 1 ? 2u : 1u) ||
         !IsSupportedDataType(sub_node)) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: Sub node mismatch");
       continue;
     }
     nodes_to_remove.push_back(sub_node);
@@ -131,6 +134,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
     }
 
     if (p_div == nullptr) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: no Div after Sub");
       continue;
     }
     Node& div_node = *graph.GetNode(p_div->Index());
@@ -138,6 +142,16 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         div_node.GetExecutionProviderType() != reduce_mean_node.GetExecutionProviderType() ||
         !optimizer_utils::CheckOutputEdges(graph, div_node, 1) ||
         !IsSupportedDataType(div_node)) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: Div node mismatch");
+      continue;
+    }
+
+    // Div is not commutative: the subgraph is only equivalent to layer normalization when
+    // the centered input is the numerator and the standard deviation the denominator.
+    const std::string& div_numerator = div_node.InputDefs()[0]->Name();
+    if (div_numerator != sub_node.OutputDefs()[0]->Name() &&
+        (p_sub_node_dup == nullptr || div_numerator != p_sub_node_dup->OutputDefs()[0]->Name())) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: Sub is not the Div numerator");
       continue;
     }
     nodes_to_remove.push_back(div_node);
@@ -145,6 +159,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
     // Traceback the div node to find sqrt --> div
     const Node* p_sqrt = graph_utils::FirstParentByType(div_node, "Sqrt");
     if (p_sqrt == nullptr) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: no Sqrt before Div");
       continue;
     }
     Node& sqrt_node = *graph.GetNode(p_sqrt->Index());
@@ -154,6 +169,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         !optimizer_utils::CheckOutputEdges(graph, sqrt_node, 1) ||
         !IsSupportedDataType(sqrt_node) ||
         sqrt_node.GetInputEdgesCount() == 0) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: Sqrt node mismatch");
       continue;
     }
     nodes_to_remove.push_back(sqrt_node);
@@ -164,6 +180,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         add2_node.GetExecutionProviderType() != reduce_mean_node.GetExecutionProviderType() ||
         !optimizer_utils::CheckOutputEdges(graph, add2_node, 1) ||
         !IsSupportedDataType(add2_node)) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: epsilon Add node mismatch");
       continue;
     }
     nodes_to_remove.push_back(add2_node);
@@ -172,6 +189,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
 
     p_reduce_mean2 = graph_utils::FirstParentByType(add2_node, "ReduceMean");
     if (p_reduce_mean2 == nullptr) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: no ReduceMean before epsilon Add");
       continue;
     }
     Node& reduce_mean2_node = *graph.GetNode(p_reduce_mean2->Index());
@@ -180,6 +198,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         !optimizer_utils::CheckOutputEdges(graph, reduce_mean2_node, 1) ||
         !IsSupportedDataType(reduce_mean2_node) ||
         reduce_mean2_node.GetInputEdgesCount() == 0) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: second ReduceMean node mismatch");
       continue;
     }
     nodes_to_remove.push_back(reduce_mean2_node);
@@ -190,6 +209,13 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         pow_node.GetExecutionProviderType() != reduce_mean_node.GetExecutionProviderType() ||
         !optimizer_utils::CheckOutputEdges(graph, pow_node, 1) ||
         !IsSupportedDataType(pow_node)) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: Pow node mismatch");
+      continue;
+    }
+
+    // The subgraph computes the variance only when the exponent is exactly 2.
+    if (!optimizer_utils::IsInitializerWithExpectedValue(graph, *(pow_node.InputDefs()[1]), 2.0f, true)) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: Pow exponent is not a constant 2");
       continue;
     }
     nodes_to_remove.push_back(pow_node);
@@ -199,9 +225,10 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
     if (p_cast_node != nullptr) {
       Node& cast_node = *graph.GetNode(pow_node.InputNodesBegin()->Index());
       if (!graph_utils::IsSupportedOptypeVersionAndDomain(cast_node, "Cast", {9, 13}) ||
-          cast_node.GetExecutionProviderType() != cast_node.GetExecutionProviderType() ||
+          cast_node.GetExecutionProviderType() != reduce_mean_node.GetExecutionProviderType() ||
           !optimizer_utils::CheckOutputEdges(graph, cast_node, 1) ||
           !IsSupportedDataType(cast_node)) {
+        DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: Cast node mismatch");
         continue;
       }
       nodes_to_remove.push_back(cast_node);
@@ -211,6 +238,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
     const Node* p_sub2_node = graph_utils::FirstParentByType(nodes_to_remove.back(), "Sub");
     if (p_sub2_node == nullptr ||
         (p_sub2_node != p_sub_node && p_sub2_node != p_sub_node_dup)) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: variance path does not start at Sub");
       continue;
     }
 
@@ -220,6 +248,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
         mul_node.GetExecutionProviderType() != reduce_mean_node.GetExecutionProviderType() ||
         !optimizer_utils::CheckOutputEdges(graph, mul_node, 1) ||
         !IsSupportedDataType(mul_node)) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: scale Mul node mismatch");
       continue;
     }
     nodes_to_remove.push_back(mul_node);
@@ -230,6 +259,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
     if (!graph_utils::IsSupportedOptypeVersionAndDomain(last_add_node, "Add", {7, 13}) ||
         last_add_node.GetExecutionProviderType() != reduce_mean_node.GetExecutionProviderType() ||
         !IsSupportedDataType(last_add_node)) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: bias Add node mismatch");
       continue;
     }
     nodes_to_remove.push_back(last_add_node);
@@ -280,6 +310,7 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
       }
     }
     if (scale == nullptr || bias == nullptr) {
+      DEBUG_LOG("LayerNormFusion: candidate " << reduce_mean_node.Name() << " not fused: no 1-D constant scale or bias");
       continue;
     }
 
@@ -301,8 +332,12 @@ Status LayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level,
                                           layer_norm_input_defs,
                                           {}, {}, kOnnxDomain);
 
-    // Get constant "epsilon" from "Add2" node if available. Else, default value will be used.
+    // Get constant "epsilon" from "Add2" node if available. Add is commutative, so the
+    // initializer may be on either input. Else, default value will be used.
     const ONNX_NAMESPACE::TensorProto* tensor_proto = graph_utils::GetConstantInitializer(graph, add2_node.MutableInputDefs()[1]->Name());
+    if (tensor_proto == nullptr) {
+      tensor_proto = graph_utils::GetConstantInitializer(graph, add2_node.MutableInputDefs()[0]->Name());
+    }
     if (tensor_proto != nullptr &&
         tensor_proto->data_type() == ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
       Initializer initializer{*tensor_proto, graph.ModelPath()};
@@ -358,6 +393,11 @@ Status SimplifiedLayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int gr
         !IsSupportedDataType(pow_node)) {
       continue;
     }
+
+    // The subgraph computes the mean square only when the exponent is exactly 2.
+    if (!optimizer_utils::IsInitializerWithExpectedValue(graph, *(pow_node.InputDefs()[1]), 2.0f, true)) {
+      continue;
+    }
     nodes_to_remove.push_back(pow_node);
 
     const Node* p_reduce_mean = nullptr;
@@ -473,8 +513,12 @@ Status SimplifiedLayerNormFusion::ApplyImpl(Graph& graph, bool& modified, int gr
                                           layer_norm_input_defs,
                                           {}, {}, kOnnxDomain);
 
-    // Get constant "epsilon" from "Add" node if available. Else, default value will be used.
+    // Get constant "epsilon" from "Add" node if available. Add is commutative, so the
+    // initializer may be on either input. Else, default value will be used.
     const ONNX_NAMESPACE::TensorProto* tensor_proto = graph_utils::GetConstantInitializer(graph, add_node.MutableInputDefs()[1]->Name());
+    if (tensor_proto == nullptr) {
+      tensor_proto = graph_utils::GetConstantInitializer(graph, add_node.MutableInputDefs()[0]->Name());
+    }
     if (tensor_proto != nullptr &&
         tensor_proto->data_type() == ONNX_NAMESPACE::TensorProto_DataType_FLOAT) {
       Initializer initializer{*tensor_proto, graph.ModelPath()};
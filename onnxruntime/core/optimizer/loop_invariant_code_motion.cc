@@ -0,0 +1,70 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/loop_invariant_code_motion.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/utils.h"
+
+#include <string>
+#include <vector>
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+Status LoopInvariantCodeMotion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (NodeIndex node_index : node_topology_list) {
+    Node* node = graph.GetNode(node_index);
+    if (node == nullptr) {
+      continue;
+    }
+
+    ORT_RETURN_IF_ERROR(Recurse(*node, modified, graph_level, logger));
+
+    if (!node->ContainsSubgraph() ||
+        (node->OpType() == "If" && node->Domain() == kOnnxDomain)) {
+      // If branches do not execute unconditionally; CommonSubexpressionElimination hoists
+      // expressions out of them only when both branches compute the same value.
+      continue;
+    }
+
+    for (const auto& name_to_subgraph : node->GetAttributeNameToMutableSubgraphMap()) {
+      Graph& subgraph = *name_to_subgraph.second;
+
+      // each hoisted layer turns its consumers' inputs into outer scope values, so repeat
+      // until the subgraph reaches a fixed point to move whole invariant chains at once
+      bool hoisted_any = true;
+      while (hoisted_any) {
+        hoisted_any = false;
+
+        const auto local_value_names = optimizer_utils::CollectSubgraphLocalValueNames(subgraph);
+        std::vector<Node*> hoistable_nodes;
+        GraphViewer subgraph_viewer(subgraph);
+        for (NodeIndex subgraph_node_index : subgraph_viewer.GetNodesInTopologicalOrder()) {
+          Node* subgraph_node = subgraph.GetNode(subgraph_node_index);
+          if (subgraph_node != nullptr &&
+              optimizer_utils::CanHoistNodeFromSubgraph(subgraph, *subgraph_node, local_value_names)) {
+            hoistable_nodes.push_back(subgraph_node);
+          }
+        }
+
+        for (Node* subgraph_node : hoistable_nodes) {
+          LOGS(logger, VERBOSE) << "Hoisting loop-invariant " << subgraph_node->OpType() << " node "
+                                << subgraph_node->Name() << " out of a subgraph of node "
+                                << node->Name() << "[" << node->OpType() << "].";
+          optimizer_utils::HoistNodeFromSubgraph(graph, subgraph, *subgraph_node);
+          hoisted_any = true;
+          modified = true;
+        }
+      }
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
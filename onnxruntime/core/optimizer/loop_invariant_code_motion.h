@@ -0,0 +1,30 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class LoopInvariantCodeMotion
+
+Hoists nodes inside Loop and Scan bodies whose inputs are all resolved from the outer scope
+into the parent graph, so they execute once per Run instead of once per iteration. Typical
+candidates are weight reshapes, casts of implicit inputs and arithmetic on outer scope
+values. Invariant chains are hoisted completely in a single application: each hoisted layer
+turns its consumers' inputs into outer scope values, and the subgraph is re-examined until
+no further node qualifies. If branches are deliberately left to
+CommonSubexpressionElimination, which only hoists expressions both branches compute so no
+work is added on the path that did not need it.
+*/
+class LoopInvariantCodeMotion : public GraphTransformer {
+ public:
+  LoopInvariantCodeMotion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("LoopInvariantCodeMotion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
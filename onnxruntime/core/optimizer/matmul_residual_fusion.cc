@@ -0,0 +1,122 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/matmul_residual_fusion.h"
+#include "core/graph/graph_utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+// The residual must match the MatMul output shape exactly: the fused kernel adds
+// it tile-wise without any broadcasting. Symbolic dimensions are accepted when
+// both sides carry the same dimension parameter.
+static bool ShapesEqualExactly(const TensorShapeProto* lhs, const TensorShapeProto* rhs) {
+  if (lhs == nullptr || rhs == nullptr || lhs->dim_size() != rhs->dim_size()) {
+    return false;
+  }
+  for (int i = 0; i < lhs->dim_size(); ++i) {
+    const auto& l = lhs->dim(i);
+    const auto& r = rhs->dim(i);
+    if (l.has_dim_value() && r.has_dim_value()) {
+      if (l.dim_value() != r.dim_value()) {
+        return false;
+      }
+    } else if (l.has_dim_param() && r.has_dim_param()) {
+      if (l.dim_param() != r.dim_param()) {
+        return false;
+      }
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+Status MatMulResidualFusion::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (!node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if ((!graph_utils::IsSupportedOptypeVersionAndDomain(node, "MatMul", {1, 9, 13}) &&
+         !graph_utils::IsSupportedOptypeVersionAndDomain(node, "FusedMatMul", {1}, kMSDomain) &&
+         !graph_utils::IsSupportedOptypeVersionAndDomain(node, "TransposeMatMul", {1}, kMSDomain)) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders()) ||
+        node.GetOutputEdgesCount() != 1) {
+      continue;
+    }
+
+    // a FusedMatMul that already carries a residual input cannot take another
+    if (node.InputDefs().size() > 2) {
+      continue;
+    }
+
+    if (!graph.GetNodeOutputsInGraphOutputs(node).empty()) {
+      continue;
+    }
+
+    const Node& next_node = *node.OutputNodesBegin();
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(next_node, "Add", {7, 13}) ||
+        next_node.GetExecutionProviderType() != node.GetExecutionProviderType()) {
+      continue;
+    }
+
+    Node& matmul_node = node;
+    Node& add_node = const_cast<Node&>(next_node);
+
+    // the epilogue runs in the float GEMM only
+    const auto* matmul_type = matmul_node.InputDefs()[0]->Type();
+    if (matmul_type == nullptr || *matmul_type != "tensor(float)") {
+      continue;
+    }
+
+    // the Add input that is not the MatMul output is the residual; skip the
+    // degenerate Add of the MatMul output with itself
+    auto add_input_defs = add_node.MutableInputDefs();
+    const auto& matmul_output_name = matmul_node.OutputDefs()[0]->Name();
+    if (add_input_defs[0]->Name() == matmul_output_name &&
+        add_input_defs[1]->Name() == matmul_output_name) {
+      continue;
+    }
+    NodeArg* residual_def =
+        add_input_defs[0]->Name() == matmul_output_name ? add_input_defs[1] : add_input_defs[0];
+
+    if (!ShapesEqualExactly(matmul_node.OutputDefs()[0]->Shape(), residual_def->Shape())) {
+      continue;
+    }
+
+    NodeAttributes fused_node_attrs =
+        matmul_node.OpType() == "MatMul" ? NodeAttributes{} : matmul_node.GetAttributes();
+
+    std::vector<NodeArg*> fused_node_inputs = matmul_node.MutableInputDefs();
+    fused_node_inputs.push_back(residual_def);
+
+    Node& fused_node = graph.AddNode(graph.GenerateNodeName(matmul_node.Name() + "_FusedMatMulResidual"),
+                                     "FusedMatMul",
+                                     "fused " + matmul_node.OpType() + " and residual Add",
+                                     fused_node_inputs,
+                                     {},
+                                     &fused_node_attrs,
+                                     kMSDomain);
+
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(matmul_node.GetExecutionProviderType());
+
+    // move output definitions and edges from add_node to fused_node, then delete both
+    graph_utils::FinalizeNodeFusion(graph, {matmul_node, add_node}, fused_node);
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,27 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class MatMulResidualFusion
+
+Fuses a residual Add that follows a MatMul/FusedMatMul into the FusedMatMul
+node itself when the Add's other input has exactly the output shape. The CPU
+FusedMatMul kernel accumulates the residual in the GEMM epilogue while each
+output tile is still in cache, removing one full read+write pass over the
+activation tensor.
+*/
+class MatMulResidualFusion : public GraphTransformer {
+ public:
+  MatMulResidualFusion(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("MatMulResidualFusion", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
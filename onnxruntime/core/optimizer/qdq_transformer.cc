@@ -0,0 +1,300 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "qdq_transformer.h"
+
+#include "core/graph/graph_utils.h"
+#include "core/optimizer/initializer.h"
+#include "core/optimizer/utils.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+static const TensorProto* GetConstantInitializer(const Graph& graph, const NodeArg* node_arg) {
+  if (node_arg == nullptr || !node_arg->Exists()) {
+    return nullptr;
+  }
+  return graph_utils::GetConstantInitializer(graph, node_arg->Name());
+}
+
+static bool IsScalarInitializer(const TensorProto& tensor_proto) {
+  return tensor_proto.dims_size() == 0 ||
+         (tensor_proto.dims_size() == 1 && tensor_proto.dims(0) == 1);
+}
+
+static int32_t GetElementType(const NodeArg& node_arg) {
+  const auto* type_proto = node_arg.TypeAsProto();
+  if (type_proto == nullptr || !type_proto->has_tensor_type()) {
+    return TensorProto_DataType_UNDEFINED;
+  }
+  return type_proto->tensor_type().elem_type();
+}
+
+// Check that the scale and zero point of a QuantizeLinear or DequantizeLinear node are
+// constant initializers describing per-tensor quantization.
+static bool HasConstantScalarScaleAndZeroPoint(const Graph& graph, const Node& node) {
+  const auto& input_defs = node.InputDefs();
+
+  const TensorProto* scale = GetConstantInitializer(graph, input_defs[1]);
+  if (scale == nullptr || scale->data_type() != TensorProto_DataType_FLOAT || !IsScalarInitializer(*scale)) {
+    return false;
+  }
+
+  if (input_defs.size() > 2 && input_defs[2]->Exists()) {
+    const TensorProto* zero_point = GetConstantInitializer(graph, input_defs[2]);
+    if (zero_point == nullptr || !IsScalarInitializer(*zero_point)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// Check the DequantizeLinear feeding the Conv weight. QLinearConv additionally supports
+// per-channel quantization with one scale per output channel: DequantizeLinear-13
+// defaults its axis to 1, so an explicit axis of 0 is required, and the zero point must
+// share the scale's shape.
+static bool HasValidWeightQuantization(const Graph& graph, const Node& dq_node) {
+  const auto& input_defs = dq_node.InputDefs();
+
+  const TensorProto* scale = GetConstantInitializer(graph, input_defs[1]);
+  if (scale == nullptr || scale->data_type() != TensorProto_DataType_FLOAT) {
+    return false;
+  }
+
+  const TensorProto* zero_point = nullptr;
+  if (input_defs.size() > 2 && input_defs[2]->Exists()) {
+    zero_point = GetConstantInitializer(graph, input_defs[2]);
+    if (zero_point == nullptr) {
+      return false;
+    }
+  }
+
+  if (IsScalarInitializer(*scale)) {
+    return zero_point == nullptr || IsScalarInitializer(*zero_point);
+  }
+
+  const auto* axis_attr = graph_utils::GetNodeAttribute(dq_node, "axis");
+  if (axis_attr == nullptr || axis_attr->i() != 0) {
+    return false;
+  }
+
+  const auto* weight_shape = input_defs[0]->Shape();
+  if (scale->dims_size() != 1 || weight_shape == nullptr || weight_shape->dim_size() < 1 ||
+      weight_shape->dim(0).dim_value() != scale->dims(0)) {
+    return false;
+  }
+
+  return zero_point != nullptr && zero_point->dims_size() == 1 &&
+         zero_point->dims(0) == scale->dims(0);
+}
+
+// The QLinearConv bias is int32 data quantized with scale x_scale * w_scale and a zero
+// point of 0. Verify that the DequantizeLinear feeding the Conv bias matches that form
+// so its int32 input can be passed through to QLinearConv unchanged.
+static bool CanFuseConvBias(const Graph& graph, const Node& dq_bias, const Node& dq_x, const Node& dq_w) {
+  const auto& input_defs = dq_bias.InputDefs();
+
+  if (GetElementType(*input_defs[0]) != TensorProto_DataType_INT32) {
+    return false;
+  }
+
+  const TensorProto* bias_scale_proto = GetConstantInitializer(graph, input_defs[1]);
+  if (bias_scale_proto == nullptr || bias_scale_proto->data_type() != TensorProto_DataType_FLOAT) {
+    return false;
+  }
+
+  if (input_defs.size() > 2 && input_defs[2]->Exists()) {
+    const TensorProto* zero_point_proto = GetConstantInitializer(graph, input_defs[2]);
+    if (zero_point_proto == nullptr || zero_point_proto->data_type() != TensorProto_DataType_INT32) {
+      return false;
+    }
+
+    Initializer zero_point(*zero_point_proto, graph.ModelPath());
+    const int32_t* zero_point_data = zero_point.data<int32_t>();
+    for (int64_t i = 0; i < zero_point.size(); i++) {
+      if (zero_point_data[i] != 0) {
+        return false;
+      }
+    }
+  }
+
+  Initializer bias_scale(*bias_scale_proto, graph.ModelPath());
+  Initializer x_scale(*GetConstantInitializer(graph, dq_x.InputDefs()[1]), graph.ModelPath());
+  Initializer w_scale(*GetConstantInitializer(graph, dq_w.InputDefs()[1]), graph.ModelPath());
+
+  if (bias_scale.size() != w_scale.size()) {
+    return false;
+  }
+
+  const float x_scale_value = *x_scale.data<float>();
+  const float* w_scale_data = w_scale.data<float>();
+  const float* bias_scale_data = bias_scale.data<float>();
+  for (int64_t i = 0; i < bias_scale.size(); i++) {
+    const float expected_scale = x_scale_value * w_scale_data[i];
+    if (std::fabs(bias_scale_data[i] - expected_scale) > 1e-5f * std::fabs(expected_scale)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+// QuantizeLinear/DequantizeLinear treat the zero point as optional with a default of 0,
+// but it is a required input of QLinearConv/QLinearMatMul, so synthesize a scalar zero
+// of the quantized type when the source node omitted it.
+static NodeArg* GetOrCreateZeroPoint(Graph& graph, Node& node, int32_t elem_type) {
+  if (node.InputDefs().size() > 2 && node.InputDefs()[2]->Exists()) {
+    return node.MutableInputDefs()[2];
+  }
+
+  TensorProto zero_point_proto;
+  zero_point_proto.set_name(graph.GenerateNodeArgName("qdq_zero_point"));
+  zero_point_proto.set_data_type(elem_type);
+  zero_point_proto.add_int32_data(0);
+  return &graph_utils::AddInitializer(graph, zero_point_proto);
+}
+
+/**
+QDQTransformer folds the simulated quantization pattern exported for
+quantization-aware-trained models into the corresponding QLinear operator:
+
+ (x)   x_scale x_zero    (w)   w_scale w_zero
+   \      |     /          \      |     /
+    \     |    /            \     |    /                (x, x_scale, x_zero, w, w_scale, w_zero, y_scale, y_zero, [bias])
+   DequantizeLinear        DequantizeLinear                                     |
+            \                 /                                                 v
+             \               /                 ---->               QLinearConv / QLinearMatMul
+              Conv / MatMul <--- DequantizeLinear(bias, Optional)               |
+                    |                                                           v
+                    v                                                       (output)
+              QuantizeLinear
+                    |
+                    v
+                (output)
+
+ */
+Status QDQTransformer::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (nullptr == node_ptr)
+      continue;  // node was removed
+
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    const bool is_conv = graph_utils::IsSupportedOptypeVersionAndDomain(node, "Conv", {1, 11});
+    if ((!is_conv && !graph_utils::IsSupportedOptypeVersionAndDomain(node, "MatMul", {1, 9, 13})) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    // The float output must feed a single QuantizeLinear so removing the pattern cannot
+    // change any other consumer.
+    if (!optimizer_utils::CheckOutputEdges(graph, node, 1)) {
+      continue;
+    }
+
+    Node& q_node = *graph.GetNode(node.OutputEdgesBegin()->GetNode().Index());
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(q_node, "QuantizeLinear", {10, 13}) ||
+        !HasConstantScalarScaleAndZeroPoint(graph, q_node)) {
+      continue;
+    }
+
+    // Map each of the target's inputs to the node that produces it.
+    std::vector<Node*> parent_nodes(node.InputDefs().size(), nullptr);
+    for (auto edge_it = node.InputEdgesBegin(); edge_it != node.InputEdgesEnd(); ++edge_it) {
+      parent_nodes[edge_it->GetDstArgIndex()] = graph.GetNode(edge_it->GetNode().Index());
+    }
+
+    Node* dq_x = parent_nodes[0];
+    Node* dq_w = parent_nodes[1];
+    if (dq_x == nullptr || dq_w == nullptr ||
+        !graph_utils::IsSupportedOptypeVersionAndDomain(*dq_x, "DequantizeLinear", {10, 13}) ||
+        !graph_utils::IsSupportedOptypeVersionAndDomain(*dq_w, "DequantizeLinear", {10, 13}) ||
+        !optimizer_utils::CheckOutputEdges(graph, *dq_x, 1) ||
+        !optimizer_utils::CheckOutputEdges(graph, *dq_w, 1)) {
+      continue;
+    }
+
+    if (!HasConstantScalarScaleAndZeroPoint(graph, *dq_x)) {
+      continue;
+    }
+
+    // QLinearConv supports per-channel weight scales along the output channel;
+    // QLinearMatMul requires per-tensor quantization throughout.
+    if (is_conv ? !HasValidWeightQuantization(graph, *dq_w)
+                : !HasConstantScalarScaleAndZeroPoint(graph, *dq_w)) {
+      continue;
+    }
+
+    // Match the type combinations implemented by the CPU integer kernels: an unsigned
+    // activation and output with a signed or unsigned weight.
+    const int32_t x_type = GetElementType(*dq_x->InputDefs()[0]);
+    const int32_t w_type = GetElementType(*dq_w->InputDefs()[0]);
+    const int32_t y_type = GetElementType(*q_node.OutputDefs()[0]);
+    if (x_type != TensorProto_DataType_UINT8 ||
+        (w_type != TensorProto_DataType_UINT8 && w_type != TensorProto_DataType_INT8) ||
+        y_type != TensorProto_DataType_UINT8) {
+      continue;
+    }
+
+    Node* dq_bias = nullptr;
+    if (is_conv && node.InputDefs().size() > 2 && node.InputDefs()[2]->Exists()) {
+      dq_bias = parent_nodes[2];
+      // Never drop a bias the integer kernel cannot represent.
+      if (dq_bias == nullptr ||
+          !graph_utils::IsSupportedOptypeVersionAndDomain(*dq_bias, "DequantizeLinear", {10, 13}) ||
+          !optimizer_utils::CheckOutputEdges(graph, *dq_bias, 1) ||
+          !CanFuseConvBias(graph, *dq_bias, *dq_x, *dq_w)) {
+        continue;
+      }
+    }
+
+    std::vector<NodeArg*> input_defs{
+        dq_x->MutableInputDefs()[0],
+        dq_x->MutableInputDefs()[1],
+        GetOrCreateZeroPoint(graph, *dq_x, x_type),
+        dq_w->MutableInputDefs()[0],
+        dq_w->MutableInputDefs()[1],
+        GetOrCreateZeroPoint(graph, *dq_w, w_type),
+        q_node.MutableInputDefs()[1],
+        GetOrCreateZeroPoint(graph, q_node, y_type)};
+
+    if (dq_bias != nullptr) {
+      input_defs.push_back(dq_bias->MutableInputDefs()[0]);
+    }
+
+    Node& fused_node = graph.AddNode(node.Name(),
+                                     is_conv ? "QLinearConv" : "QLinearMatMul",
+                                     "",
+                                     input_defs,
+                                     q_node.MutableOutputDefs(),
+                                     is_conv ? &node.GetAttributes() : nullptr,
+                                     kOnnxDomain);
+    // Assign provider to this new node. Provider should be same as the provider for old node.
+    fused_node.SetExecutionProviderType(node.GetExecutionProviderType());
+
+    std::vector<std::reference_wrapper<Node>> nodes_to_remove{*dq_x, *dq_w};
+    if (dq_bias != nullptr) {
+      nodes_to_remove.push_back(*dq_bias);
+    }
+    nodes_to_remove.push_back(node);
+    nodes_to_remove.push_back(q_node);
+
+    for (const auto& node_to_remove : nodes_to_remove) {
+      graph_utils::RemoveNodeOutputEdges(graph, node_to_remove);
+      graph.RemoveNode(node_to_remove.get().Index());
+    }
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+}  // namespace onnxruntime
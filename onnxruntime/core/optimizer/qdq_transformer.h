@@ -0,0 +1,25 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class QDQTransformer
+Fold DequantizeLinear -> Conv/MatMul -> QuantizeLinear subgraphs into QLinearConv
+and QLinearMatMul so quantization-aware-trained models run on the integer kernels
+instead of the simulated float path.
+*/
+class QDQTransformer : public GraphTransformer {
+ public:
+  QDQTransformer(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("QDQTransformer", compatible_execution_providers) {
+  }
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
@@ -0,0 +1,255 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/optimizer/transpose_sinking.h"
+
+#include "core/graph/graph_utils.h"
+
+#include <algorithm>
+#include <numeric>
+
+using namespace ONNX_NAMESPACE;
+using namespace ::onnxruntime::common;
+namespace onnxruntime {
+
+// elementwise ops that compute each output element from the input element at the same index,
+// so a Transpose on the (first) input can be swapped with them. All take the data tensor as
+// input 0, any further inputs (e.g. Clip min/max) are scalars, and all have a single output.
+static const std::unordered_set<std::string> kShapeInvariantUnaryOps = {
+    "Abs", "Cast", "Ceil", "Celu", "Clip", "Cos", "Elu", "Erf", "Exp", "Floor", "HardSigmoid",
+    "LeakyRelu", "Log", "Neg", "Reciprocal", "Relu", "Round", "Selu", "Sigmoid", "Sign", "Sin",
+    "Softplus", "Softsign", "Sqrt", "Tanh", "ThresholdedRelu"};
+
+static bool GetTransposePerms(const Node& transpose_node, std::vector<int64_t>& perms) {
+  const auto* perm_attr = graph_utils::GetNodeAttribute(transpose_node, "perm");
+  if (perm_attr != nullptr) {
+    perms = RetrieveValues<int64_t>(*perm_attr);
+    return true;
+  }
+
+  // default is to reverse the dimensions, which requires the rank to be known
+  const TensorShapeProto* shape = transpose_node.InputDefs()[0]->Shape();
+  if (!shape) {
+    return false;
+  }
+
+  perms.resize(shape->dim_size());
+  std::iota(perms.rbegin(), perms.rend(), 0);
+  return true;
+}
+
+static bool IsIdentityPerm(const std::vector<int64_t>& perms) {
+  for (size_t i = 0; i < perms.size(); ++i) {
+    if (perms[i] != static_cast<int64_t>(i)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Merge a Transpose with the Transpose producing its input into a single node with the
+// composed permutation. The upstream node is left in place for its other consumers (if any)
+// and is removed by the caller once nothing consumes it.
+static bool ComposeWithProducerTranspose(Graph& graph, Node& node, const std::vector<int64_t>& perms,
+                                         std::vector<NodeIndex>& maybe_dead_nodes) {
+  Node* producer = graph.GetMutableProducerNode(node.MutableInputDefs()[0]->Name());
+  if (producer == nullptr || producer->OpType() != "Transpose" ||
+      producer->Domain() != kOnnxDomain) {
+    return false;
+  }
+
+  std::vector<int64_t> producer_perms;
+  if (!GetTransposePerms(*producer, producer_perms) || producer_perms.size() != perms.size()) {
+    return false;
+  }
+
+  // node computes output[i] = producer_input[producer_perms[perms[i]]]
+  std::vector<int64_t> composed_perms(perms.size());
+  for (size_t i = 0; i < perms.size(); ++i) {
+    composed_perms[i] = producer_perms[static_cast<size_t>(perms[i])];
+  }
+
+  // reroute node to consume the upstream Transpose's input
+  graph.RemoveEdge(producer->Index(), node.Index(), 0, 0);
+  graph_utils::ReplaceNodeInput(node, 0, *producer->MutableInputDefs()[0]);
+  const Node::EdgeEnd* producer_input_edge = graph_utils::GetInputEdge(*producer, 0);
+  if (producer_input_edge != nullptr) {
+    graph.AddEdge(producer_input_edge->GetNode().Index(), node.Index(),
+                  producer_input_edge->GetSrcArgIndex(), 0);
+  }
+
+  node.AddAttribute("perm", composed_perms);
+  maybe_dead_nodes.push_back(producer->Index());
+  return true;
+}
+
+// Swap a Transpose with its single elementwise unary consumer so the Transpose moves towards
+// the graph outputs, where it can meet and cancel against its inverse. The consumer keeps its
+// output name (now produced by the Transpose) so downstream nodes are unaffected.
+static bool SinkThroughElementwise(Graph& graph, Node& node) {
+  if (node.GetOutputEdgesCount() != 1 || !graph.GetNodeOutputsInGraphOutputs(node).empty()) {
+    return false;
+  }
+
+  const Node::EdgeEnd& output_edge = *node.OutputEdgesBegin();
+  if (output_edge.GetDstArgIndex() != 0) {
+    return false;
+  }
+
+  Node& consumer = *graph.GetNode(output_edge.GetNode().Index());
+  if (kShapeInvariantUnaryOps.count(consumer.OpType()) == 0 ||
+      consumer.Domain() != kOnnxDomain) {
+    return false;
+  }
+
+  NodeArg* transpose_input = node.MutableInputDefs()[0];
+  NodeArg* consumer_output = consumer.MutableOutputDefs()[0];
+  const auto* consumer_output_type = consumer_output->TypeAsProto();
+  if (consumer_output_type == nullptr || !consumer_output_type->has_tensor_type()) {
+    return false;
+  }
+
+  // intermediate value: the elementwise op applied to the untransposed input, so it has the
+  // consumer's element type (it may be a Cast) and the Transpose input's shape
+  TypeProto intermediate_type;
+  intermediate_type.mutable_tensor_type()->set_elem_type(consumer_output_type->tensor_type().elem_type());
+  if (transpose_input->Shape() != nullptr) {
+    *intermediate_type.mutable_tensor_type()->mutable_shape() = *transpose_input->Shape();
+  }
+  NodeArg& intermediate_arg = graph.GetOrCreateNodeArg(
+      graph.GenerateNodeArgName(consumer.Name() + "_transpose_sunk"), &intermediate_type);
+
+  graph.RemoveEdge(node.Index(), consumer.Index(), 0, 0);
+
+  // consumer now reads the Transpose's input directly
+  graph_utils::ReplaceNodeInput(consumer, 0, *transpose_input);
+  const Node::EdgeEnd* transpose_input_edge = graph_utils::GetInputEdge(node, 0);
+  if (transpose_input_edge != nullptr) {
+    NodeIndex src_index = transpose_input_edge->GetNode().Index();
+    int src_arg_index = transpose_input_edge->GetSrcArgIndex();
+    graph.RemoveEdge(src_index, node.Index(), src_arg_index, 0);
+    graph.AddEdge(src_index, consumer.Index(), src_arg_index, 0);
+  }
+
+  // move the consumer's output edges to the Transpose, which takes over its output def
+  std::vector<Node::EdgeEnd> downstream_edges(consumer.OutputEdgesBegin(), consumer.OutputEdgesEnd());
+  for (const auto& edge : downstream_edges) {
+    graph.RemoveEdge(consumer.Index(), edge.GetNode().Index(), 0, edge.GetDstArgIndex());
+  }
+
+  consumer.MutableOutputDefs()[0] = &intermediate_arg;
+  graph_utils::ReplaceNodeInput(node, 0, intermediate_arg);
+  node.MutableOutputDefs()[0] = consumer_output;
+  graph.AddEdge(consumer.Index(), node.Index(), 0, 0);
+
+  for (const auto& edge : downstream_edges) {
+    graph.AddEdge(node.Index(), edge.GetNode().Index(), 0, edge.GetDstArgIndex());
+  }
+
+  return true;
+}
+
+// Remove an identity Transpose whose output is a graph output, which graph_utils::RemoveNode
+// cannot handle as plain removal would lose the output name. If the upstream value feeds only
+// this Transpose and is not a graph output itself, the producer can take over the output def.
+static bool RemoveIdentityTransposeProducingGraphOutput(Graph& graph, Node& node) {
+  const Node::EdgeEnd* input_edge = graph_utils::GetInputEdge(node, 0);
+  if (input_edge == nullptr) {
+    // input is a graph input or initializer which cannot be renamed
+    return false;
+  }
+
+  Node& producer = *graph.GetNode(input_edge->GetNode().Index());
+  int src_arg_index = input_edge->GetSrcArgIndex();
+
+  int value_consumers = 0;
+  for (auto it = producer.OutputEdgesBegin(); it != producer.OutputEdgesEnd(); ++it) {
+    if (it->GetSrcArgIndex() == src_arg_index) {
+      ++value_consumers;
+    }
+  }
+
+  const auto& graph_outputs = graph.GetOutputs();
+  if (value_consumers != 1 ||
+      std::find(graph_outputs.begin(), graph_outputs.end(), node.InputDefs()[0]) != graph_outputs.end()) {
+    return false;
+  }
+
+  // move any downstream consumers of the Transpose output to the producer, which takes over
+  // producing the graph output
+  std::vector<Node::EdgeEnd> downstream_edges(node.OutputEdgesBegin(), node.OutputEdgesEnd());
+  for (const auto& edge : downstream_edges) {
+    graph.RemoveEdge(node.Index(), edge.GetNode().Index(), 0, edge.GetDstArgIndex());
+  }
+
+  graph.RemoveEdge(producer.Index(), node.Index(), src_arg_index, 0);
+  producer.MutableOutputDefs()[src_arg_index] = node.MutableOutputDefs()[0];
+
+  for (const auto& edge : downstream_edges) {
+    graph.AddEdge(producer.Index(), edge.GetNode().Index(), src_arg_index, edge.GetDstArgIndex());
+  }
+
+  graph.RemoveNode(node.Index());
+  return true;
+}
+
+Status TransposeSinking::ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_topology_list = graph_viewer.GetNodesInTopologicalOrder();
+  std::vector<NodeIndex> maybe_dead_nodes;
+
+  for (auto node_index : node_topology_list) {
+    auto* node_ptr = graph.GetNode(node_index);
+    if (node_ptr == nullptr) {
+      continue;
+    }
+    auto& node = *node_ptr;
+
+    ORT_RETURN_IF_ERROR(Recurse(node, modified, graph_level, logger));
+
+    if (!graph_utils::IsSupportedOptypeVersionAndDomain(node, "Transpose", {1, 13}) ||
+        !graph_utils::IsSupportedProvider(node, GetCompatibleExecutionProviders())) {
+      continue;
+    }
+
+    std::vector<int64_t> perms;
+    if (!GetTransposePerms(node, perms)) {
+      continue;
+    }
+
+    if (ComposeWithProducerTranspose(graph, node, perms, maybe_dead_nodes)) {
+      modified = true;
+      continue;
+    }
+
+    if (IsIdentityPerm(perms)) {
+      if (graph_utils::CanRemoveNode(graph, node, logger)) {
+        if (graph_utils::RemoveNode(graph, node)) {
+          modified = true;
+        }
+      } else if (!graph.GetNodeOutputsInGraphOutputs(node).empty() &&
+                 RemoveIdentityTransposeProducingGraphOutput(graph, node)) {
+        modified = true;
+      }
+      continue;
+    }
+
+    if (SinkThroughElementwise(graph, node)) {
+      modified = true;
+    }
+  }
+
+  // remove upstream Transpose nodes that lost their last consumer during composition
+  for (NodeIndex index : maybe_dead_nodes) {
+    Node* node = graph.GetNode(index);
+    if (node != nullptr && node->GetOutputEdgesCount() == 0 &&
+        graph.GetNodeOutputsInGraphOutputs(*node).empty()) {
+      graph_utils::RemoveNodeOutputEdges(graph, *node);
+      graph.RemoveNode(index);
+    }
+  }
+
+  return Status::OK();
+}
+
+}  // namespace onnxruntime
@@ -0,0 +1,31 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/optimizer/graph_transformer.h"
+
+namespace onnxruntime {
+
+/**
+@Class TransposeSinking
+
+Layout propagation pass that pushes Transpose nodes down through elementwise shape-invariant
+ops so that transposes originating from framework exports meet and cancel. Per pass it
+ - composes a Transpose with a producing Transpose into a single node,
+ - removes Transpose nodes whose permutation is the identity, and
+ - swaps a Transpose with its single elementwise unary consumer.
+The graph transformer manager re-applies the pass until it no longer modifies the graph, so
+chains of elementwise ops between inverse Transpose pairs are traversed one step at a time.
+Survivors that end up adjacent to a MatMul are folded into FusedMatMul transA/transB by the
+later MatmulTransposeFusion pass.
+*/
+class TransposeSinking : public GraphTransformer {
+ public:
+  TransposeSinking(const std::unordered_set<std::string>& compatible_execution_providers = {}) noexcept
+      : GraphTransformer("TransposeSinking", compatible_execution_providers) {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+};
+
+}  // namespace onnxruntime
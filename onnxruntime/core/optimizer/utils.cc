@@ -302,5 +302,103 @@ bool IsOperationDeterministic(const std::string& domain, const std::string& op)
   return itDomain->second.count(op) == 0;
 }
 
+std::unordered_set<std::string> CollectSubgraphLocalValueNames(const Graph& subgraph) {
+  std::unordered_set<std::string> local_names;
+  for (const auto* input : subgraph.GetInputsIncludingInitializers()) {
+    local_names.insert(input->Name());
+  }
+  for (const auto& initializer : subgraph.GetAllInitializedTensors()) {
+    local_names.insert(initializer.first);
+  }
+  for (const auto& node : subgraph.Nodes()) {
+    for (const auto* output_def : node.OutputDefs()) {
+      if (output_def->Exists()) {
+        local_names.insert(output_def->Name());
+      }
+    }
+  }
+  return local_names;
+}
+
+bool CanHoistNodeFromSubgraph(const Graph& subgraph, const Node& node,
+                              const std::unordered_set<std::string>& local_value_names) {
+  if (node.ContainsSubgraph() || !IsOperationDeterministic(node.Domain(), node.OpType())) {
+    return false;
+  }
+
+  bool has_input = false;
+  for (const auto* input_def : node.InputDefs()) {
+    if (input_def == nullptr || !input_def->Exists()) {
+      continue;
+    }
+    if (local_value_names.count(input_def->Name()) > 0) {
+      return false;
+    }
+    has_input = true;
+  }
+  if (!has_input) {
+    // nodes without inputs (e.g. Constant) are left to constant folding
+    return false;
+  }
+
+  const auto& subgraph_outputs = subgraph.GetOutputs();
+  for (const auto* output_def : node.OutputDefs()) {
+    if (output_def->Exists() &&
+        std::find(subgraph_outputs.begin(), subgraph_outputs.end(), output_def) != subgraph_outputs.end()) {
+      return false;
+    }
+  }
+
+  for (auto edge_it = node.OutputEdgesBegin(); edge_it != node.OutputEdgesEnd(); ++edge_it) {
+    if (edge_it->GetDstArgIndex() >= static_cast<int>(edge_it->GetNode().InputDefs().size())) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void HoistNodeFromSubgraph(Graph& parent_graph, Graph& subgraph, Node& node) {
+  std::vector<NodeArg*> parent_inputs;
+  parent_inputs.reserve(node.InputDefs().size());
+  for (const auto* input_def : node.InputDefs()) {
+    parent_inputs.push_back(input_def != nullptr && input_def->Exists()
+                                ? &parent_graph.GetOrCreateNodeArg(input_def->Name(), input_def->TypeAsProto())
+                                : &parent_graph.GetOrCreateNodeArg("", nullptr));
+  }
+
+  std::vector<NodeArg*> parent_outputs;
+  std::vector<NodeArg*> replacements;
+  parent_outputs.reserve(node.OutputDefs().size());
+  replacements.reserve(node.OutputDefs().size());
+  for (const auto* output_def : node.OutputDefs()) {
+    if (!output_def->Exists()) {
+      parent_outputs.push_back(&parent_graph.GetOrCreateNodeArg("", nullptr));
+      replacements.push_back(nullptr);
+      continue;
+    }
+    // the name must be new to both scopes so it cannot shadow or be shadowed
+    std::string hoisted_name = parent_graph.GenerateNodeArgName(output_def->Name() + "_hoisted");
+    while (subgraph.GetNodeArg(hoisted_name) != nullptr) {
+      hoisted_name = parent_graph.GenerateNodeArgName(hoisted_name);
+    }
+    parent_outputs.push_back(&parent_graph.GetOrCreateNodeArg(hoisted_name, output_def->TypeAsProto()));
+    replacements.push_back(&subgraph.GetOrCreateNodeArg(hoisted_name, output_def->TypeAsProto()));
+  }
+
+  parent_graph.AddNode(parent_graph.GenerateNodeName(node.OpType() + "_hoisted"), node.OpType(),
+                       node.Description(), parent_inputs, parent_outputs, &node.GetAttributes(),
+                       node.Domain());
+
+  std::vector<Node::EdgeEnd> output_edges(node.OutputEdgesBegin(), node.OutputEdgesEnd());
+  for (const auto& edge : output_edges) {
+    Node& consumer = *subgraph.GetNode(edge.GetNode().Index());
+    subgraph.RemoveEdge(node.Index(), consumer.Index(), edge.GetSrcArgIndex(), edge.GetDstArgIndex());
+    consumer.MutableInputDefs()[edge.GetDstArgIndex()] = replacements[edge.GetSrcArgIndex()];
+  }
+
+  subgraph.RemoveNode(node.Index());
+}
+
 }  // namespace optimizer_utils
 }  // namespace onnxruntime
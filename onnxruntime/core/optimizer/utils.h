@@ -6,6 +6,9 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/graph/graph.h"
 
+#include <string>
+#include <unordered_set>
+
 namespace onnxruntime {
 class Graph;
 class NodeArg;
@@ -90,5 +93,26 @@ bool CheckOutputEdges(const Graph& graph, const Node& node, size_t expected_outp
 
 bool IsOperationDeterministic(const std::string& domain, const std::string& op);
 
+/** Collect the names that resolve inside a subgraph: its inputs, local initializers and the
+outputs of its own nodes. Any other name a subgraph node consumes comes from the outer scope.
+*/
+std::unordered_set<std::string> CollectSubgraphLocalValueNames(const Graph& subgraph);
+
+/** Check whether a subgraph node can be hoisted into the parent graph.
+@param local_value_names the names collected by CollectSubgraphLocalValueNames.
+@remarks a node is hoistable when it is deterministic and every input resolves from the outer
+         scope, so it evaluates to the same value on every execution of the subgraph. Its
+         consumers must read the value as an explicit input: a nested subgraph references an
+         implicit input by name internally, which hoisting would have to rewrite.
+*/
+bool CanHoistNodeFromSubgraph(const Graph& subgraph, const Node& node,
+                              const std::unordered_set<std::string>& local_value_names);
+
+/** Move a hoistable subgraph node into the parent graph and reroute its subgraph consumers to
+the hoisted value. The consumers pick the value up from the outer scope, and the next
+Graph::Resolve turns it into an implicit input of the node owning the subgraph.
+*/
+void HoistNodeFromSubgraph(Graph& parent_graph, Graph& subgraph, Node& node);
+
 }  // namespace optimizer_utils
 }  // namespace onnxruntime
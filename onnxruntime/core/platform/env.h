@@ -68,6 +68,12 @@ struct ThreadOptions {
 
   // Set or unset denormal as zero.
   bool set_denormal_as_zero = false;
+
+  // Upper bound on the number of spin iterations a worker performs while waiting for work
+  // before blocking. A negative value keeps the implementation default; 0 disables spinning
+  // entirely, which matters on shared hosts where spin-waiting steals cycles from co-located
+  // services. Ignored when the pool was created with spinning disabled.
+  int spin_loop_iterations = -1;
 };
 /// \brief An interface used by the onnxruntime implementation to
 /// access operating system functionality like the filesystem etc.
@@ -111,6 +117,25 @@ class Env {
   // This function doesn't support systems with more than 64 logical processors
   virtual std::vector<size_t> GetThreadAffinityMasks() const = 0;
 
+  // Returns the logical processors belonging to the given NUMA node, or an empty vector when the
+  // node doesn't exist or the platform exposes no NUMA topology information.
+  virtual std::vector<size_t> GetNumaNodeProcessors(int numa_node) const {
+    ORT_UNUSED_PARAMETER(numa_node);
+    return {};
+  }
+
+  // Returns the logical processors of the performance cores on hybrid CPUs, or an empty vector
+  // when the CPU is not hybrid or the platform exposes no core-type information.
+  virtual std::vector<size_t> GetPerformanceCoreProcessors() const {
+    return {};
+  }
+
+  // Returns the logical processors of the efficiency cores on hybrid CPUs, or an empty vector
+  // when the CPU is not hybrid or the platform exposes no core-type information.
+  virtual std::vector<size_t> GetEfficiencyCoreProcessors() const {
+    return {};
+  }
+
   /// \brief Returns the number of micro-seconds since the Unix epoch.
   virtual uint64_t NowMicros() const {
     return env_time_->NowMicros();
@@ -27,7 +27,10 @@ limitations under the License.
 #include <dlfcn.h>
 #include <ftw.h>
 #include <string.h>
+#include <algorithm>
 #include <thread>
+#include <fstream>
+#include <sstream>
 #include <utility>  // for std::forward
 #include <vector>
 #include <assert.h>
@@ -174,6 +177,69 @@ class PosixThread : public EnvThread {
   pthread_t hThread;
 };
 
+// Reads a sysfs cpulist file (a list of ranges, e.g. "0-15,32-47") and returns the processors
+// it names. Returns an empty vector when the file does not exist or cannot be parsed.
+static std::vector<size_t> ReadCpuList(const std::string& path) {
+  std::vector<size_t> ret;
+  std::ifstream cpulist_file(path);
+  std::string cpulist;
+  if (!cpulist_file || !std::getline(cpulist_file, cpulist)) {
+    return ret;
+  }
+
+  std::istringstream parser(cpulist);
+  std::string range;
+  while (std::getline(parser, range, ',')) {
+    char* end = nullptr;
+    unsigned long first = strtoul(range.c_str(), &end, 10);
+    unsigned long last = first;
+    if (end != nullptr && *end == '-') {
+      last = strtoul(end + 1, nullptr, 10);
+    }
+    for (unsigned long cpu = first; cpu <= last; ++cpu) {
+      ret.push_back(static_cast<size_t>(cpu));
+    }
+  }
+
+  return ret;
+}
+
+// Reads each processor's cpu_capacity (the kernel's relative throughput rating, populated on
+// ARM big.LITTLE systems) and returns the processors of the requested core class: the ones at
+// the maximum capacity for the performance class, at the minimum for the efficiency class.
+// Returns an empty vector when capacities are absent or uniform.
+static std::vector<size_t> ReadCpusByCapacityClass(bool performance) {
+  std::vector<long> capacities;
+  for (int cpu = 0;; ++cpu) {
+    std::ostringstream path;
+    path << "/sys/devices/system/cpu/cpu" << cpu << "/cpu_capacity";
+    std::ifstream capacity_file(path.str());
+    long capacity = -1;
+    if (!capacity_file || !(capacity_file >> capacity)) {
+      break;
+    }
+    capacities.push_back(capacity);
+  }
+
+  if (capacities.empty()) {
+    return {};
+  }
+
+  const auto min_max = std::minmax_element(capacities.begin(), capacities.end());
+  if (*min_max.first == *min_max.second) {
+    return {};
+  }
+
+  const long wanted = performance ? *min_max.second : *min_max.first;
+  std::vector<size_t> ret;
+  for (size_t cpu = 0; cpu != capacities.size(); ++cpu) {
+    if (capacities[cpu] == wanted) {
+      ret.push_back(cpu);
+    }
+  }
+  return ret;
+}
+
 class PosixEnv : public Env {
  public:
   static PosixEnv& Instance() {
@@ -200,6 +266,33 @@ class PosixEnv : public Env {
     return ret;
   }
 
+  std::vector<size_t> GetNumaNodeProcessors(int numa_node) const override {
+    // Linux exposes each node's processors through sysfs as a list of ranges, e.g. "0-15,32-47".
+    // On POSIX systems without that file there is no topology information to report.
+    std::ostringstream path;
+    path << "/sys/devices/system/node/node" << numa_node << "/cpulist";
+    return ReadCpuList(path.str());
+  }
+
+  std::vector<size_t> GetPerformanceCoreProcessors() const override {
+    // On Intel hybrid parts Linux groups the performance cores under the "cpu_core" device
+    // (the efficiency cores under "cpu_atom"). The file is absent on non-hybrid systems.
+    std::vector<size_t> ret = ReadCpuList("/sys/devices/cpu_core/cpus");
+    if (ret.empty()) {
+      // On ARM big.LITTLE parts the core classes are told apart by cpu_capacity instead.
+      ret = ReadCpusByCapacityClass(/*performance*/ true);
+    }
+    return ret;
+  }
+
+  std::vector<size_t> GetEfficiencyCoreProcessors() const override {
+    std::vector<size_t> ret = ReadCpuList("/sys/devices/cpu_atom/cpus");
+    if (ret.empty()) {
+      ret = ReadCpusByCapacityClass(/*performance*/ false);
+    }
+    return ret;
+  }
+
   void SleepForMicroseconds(int64_t micros) const override {
     while (micros > 0) {
       timespec sleep_time;
@@ -253,6 +346,35 @@ class PosixEnv : public Env {
     return Status::OK();
   }
 
+  // Reads [offset, offset + length) from the file into data using positional
+  // reads, so several extents of the same file can be read concurrently.
+  static Status ReadFileExtent(int fd, const ORTCHAR_T* file_path, FileOffsetType offset, size_t length,
+                               char* data) {
+    size_t total_bytes_read = 0;
+    while (total_bytes_read < length) {
+      constexpr size_t k_max_bytes_to_read = 1 << 30;  // read at most 1GB each time
+      const size_t bytes_remaining = length - total_bytes_read;
+      const size_t bytes_to_read = std::min(bytes_remaining, k_max_bytes_to_read);
+
+      const ssize_t bytes_read =
+          TempFailureRetry(pread, fd, data + total_bytes_read, bytes_to_read,
+                           offset + static_cast<FileOffsetType>(total_bytes_read));
+
+      if (bytes_read == -1) {
+        return ReportSystemError("pread", file_path);
+      }
+
+      if (bytes_read == 0) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "ReadFileIntoBuffer - unexpected end of file. ", "File: ", file_path,
+                               ", offset: ", offset, ", length: ", length);
+      }
+
+      total_bytes_read += bytes_read;
+    }
+
+    return Status::OK();
+  }
+
   Status ReadFileIntoBuffer(const ORTCHAR_T* file_path, FileOffsetType offset, size_t length,
                             gsl::span<char> buffer) const override {
     ORT_RETURN_IF_NOT(file_path, "file_path == nullptr");
@@ -267,32 +389,40 @@ class PosixEnv : public Env {
     if (length == 0)
       return Status::OK();
 
-    if (offset > 0) {
-      const FileOffsetType seek_result = lseek(file_descriptor.Get(), offset, SEEK_SET);
-      if (seek_result == -1) {
-        return ReportSystemError("lseek", file_path);
-      }
+    // Large reads are split into extents read concurrently with positional
+    // reads. This keeps several requests in flight, which hides most of the
+    // per-request latency on network-attached and other high-latency storage.
+    constexpr size_t k_min_bytes_per_concurrent_read = 16 * 1024 * 1024;
+    const size_t num_extents =
+        std::min<size_t>(std::max<size_t>(std::thread::hardware_concurrency(), 1),
+                         length / k_min_bytes_per_concurrent_read);
+
+    if (num_extents < 2) {
+      return ReadFileExtent(file_descriptor.Get(), file_path, offset, length, buffer.data());
     }
 
-    size_t total_bytes_read = 0;
-    while (total_bytes_read < length) {
-      constexpr size_t k_max_bytes_to_read = 1 << 30;  // read at most 1GB each time
-      const size_t bytes_remaining = length - total_bytes_read;
-      const size_t bytes_to_read = std::min(bytes_remaining, k_max_bytes_to_read);
+    const size_t bytes_per_extent = length / num_extents;
+    std::vector<Status> statuses(num_extents, Status::OK());
+    std::vector<std::thread> readers;
+    readers.reserve(num_extents - 1);
+    for (size_t i = 1; i < num_extents; ++i) {
+      const size_t extent_begin = i * bytes_per_extent;
+      const size_t extent_length = i + 1 < num_extents ? bytes_per_extent : length - extent_begin;
+      readers.emplace_back([&, i, extent_begin, extent_length]() {
+        statuses[i] = ReadFileExtent(file_descriptor.Get(), file_path,
+                                     offset + static_cast<FileOffsetType>(extent_begin),
+                                     extent_length, buffer.data() + extent_begin);
+      });
+    }
 
-      const ssize_t bytes_read =
-          TempFailureRetry(read, file_descriptor.Get(), buffer.data() + total_bytes_read, bytes_to_read);
+    statuses[0] = ReadFileExtent(file_descriptor.Get(), file_path, offset, bytes_per_extent, buffer.data());
 
-      if (bytes_read == -1) {
-        return ReportSystemError("read", file_path);
-      }
-
-      if (bytes_read == 0) {
-        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "ReadFileIntoBuffer - unexpected end of file. ", "File: ", file_path,
-                               ", offset: ", offset, ", length: ", length);
-      }
+    for (auto& reader : readers) {
+      reader.join();
+    }
 
-      total_bytes_read += bytes_read;
+    for (const auto& status : statuses) {
+      ORT_RETURN_IF_ERROR(status);
     }
 
     return Status::OK();
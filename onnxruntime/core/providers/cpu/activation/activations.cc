@@ -45,19 +45,25 @@ REGISTER_UNARY_ELEMENTWISE_KERNEL(HardSigmoid, 6);
 REGISTER_UNARY_ELEMENTWISE_KERNEL(LeakyRelu, 6);
 REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Relu, 6, 12, float);
 REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Relu, 6, 12, double);
+REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Relu, 6, 12, MLFloat16);
 REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Relu, 13, float);
 REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Relu, 13, double);
+REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Relu, 13, MLFloat16);
 REGISTER_UNARY_ELEMENTWISE_KERNEL(Selu, 6);
 REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Sigmoid, 6, 12, float);
 REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Sigmoid, 6, 12, double);
+REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Sigmoid, 6, 12, MLFloat16);
 REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Sigmoid, 13, float);
 REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Sigmoid, 13, double);
+REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Sigmoid, 13, MLFloat16);
 REGISTER_UNARY_ELEMENTWISE_KERNEL(Softplus, 1);
 REGISTER_UNARY_ELEMENTWISE_KERNEL(Softsign, 1);
 REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Tanh, 6, 12, float);
 REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Tanh, 6, 12, double);
+REGISTER_VERSIONED_UNARY_ELEMENTWISE_TYPED_KERNEL(Tanh, 6, 12, MLFloat16);
 REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Tanh, 13, float);
 REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Tanh, 13, double);
+REGISTER_UNARY_ELEMENTWISE_TYPED_KERNEL(Tanh, 13, MLFloat16);
 REGISTER_UNARY_ELEMENTWISE_KERNEL(ThresholdedRelu, 10);
 
 namespace functors {
@@ -99,6 +105,125 @@ void Tanh<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
   float* output_ptr = output + first;
   MlasComputeTanh(input + first, output_ptr, static_cast<size_t>(len));
 }
+
+template <>
+void Relu<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  ptrdiff_t len = last - first;
+  MLAS_ACTIVATION activation;
+  activation.ActivationKind = MlasReluActivation;
+  MlasComputeActivation(&activation, input + first, output + first, static_cast<size_t>(len));
+}
+
+// The half precision activations run the single precision MLAS kernels over
+// cache resident blocks: convert a block to float, transform it in place, and
+// round it back to half precision. The conversions never leave the L1 cache,
+// so the tensor is still read and written at half precision bandwidth.
+constexpr ptrdiff_t kHalfPrecisionBlockSize = 256;
+
+template <>
+void Relu<MLFloat16>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  const auto* input_ptr = reinterpret_cast<const unsigned short*>(input + first);
+  auto* output_ptr = reinterpret_cast<unsigned short*>(output + first);
+  ptrdiff_t len = last - first;
+  float block[kHalfPrecisionBlockSize];
+  MLAS_ACTIVATION activation;
+  activation.ActivationKind = MlasReluActivation;
+  while (len > 0) {
+    const size_t count = static_cast<size_t>(std::min(len, kHalfPrecisionBlockSize));
+    MlasConvertHalfToFloatBuffer(input_ptr, block, count);
+    MlasComputeActivation(&activation, block, block, count);
+    MlasConvertFloatToHalfBuffer(block, output_ptr, count);
+    input_ptr += count;
+    output_ptr += count;
+    len -= static_cast<ptrdiff_t>(count);
+  }
+}
+
+template <>
+void Sigmoid<MLFloat16>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  const auto* input_ptr = reinterpret_cast<const unsigned short*>(input + first);
+  auto* output_ptr = reinterpret_cast<unsigned short*>(output + first);
+  ptrdiff_t len = last - first;
+  float block[kHalfPrecisionBlockSize];
+  while (len > 0) {
+    const size_t count = static_cast<size_t>(std::min(len, kHalfPrecisionBlockSize));
+    MlasConvertHalfToFloatBuffer(input_ptr, block, count);
+    MlasComputeLogistic(block, block, count);
+    MlasConvertFloatToHalfBuffer(block, output_ptr, count);
+    input_ptr += count;
+    output_ptr += count;
+    len -= static_cast<ptrdiff_t>(count);
+  }
+}
+
+template <>
+void Tanh<MLFloat16>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  const auto* input_ptr = reinterpret_cast<const unsigned short*>(input + first);
+  auto* output_ptr = reinterpret_cast<unsigned short*>(output + first);
+  ptrdiff_t len = last - first;
+  float block[kHalfPrecisionBlockSize];
+  while (len > 0) {
+    const size_t count = static_cast<size_t>(std::min(len, kHalfPrecisionBlockSize));
+    MlasConvertHalfToFloatBuffer(input_ptr, block, count);
+    MlasComputeTanh(block, block, count);
+    MlasConvertFloatToHalfBuffer(block, output_ptr, count);
+    input_ptr += count;
+    output_ptr += count;
+    len -= static_cast<ptrdiff_t>(count);
+  }
+}
+
+template <>
+void LeakyRelu<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  ptrdiff_t len = last - first;
+  MLAS_ACTIVATION activation;
+  activation.ActivationKind = MlasLeakyReluActivation;
+  activation.Parameters.LeakyRelu.alpha = alpha;
+  MlasComputeActivation(&activation, input + first, output + first, static_cast<size_t>(len));
+}
+
+template <>
+void HardSigmoid<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  ptrdiff_t len = last - first;
+  MLAS_ACTIVATION activation;
+  activation.ActivationKind = MlasHardSigmoidActivation;
+  activation.Parameters.HardSigmoid.alpha = alpha;
+  activation.Parameters.HardSigmoid.beta = beta;
+  MlasComputeActivation(&activation, input + first, output + first, static_cast<size_t>(len));
+}
+
+template <>
+void Elu<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  ptrdiff_t len = last - first;
+  const float* input_ptr = input + first;
+  float* output_ptr = output + first;
+  ConstEigenVectorArrayMap<float> xm(input_ptr, len);
+  EigenVectorArrayMap<float> ym(output_ptr, len);
+  if (input_ptr == output_ptr) {
+    // in-place execution cannot stage exp(x) in the output buffer
+    ym = (xm >= 0).select(xm, alpha * (xm.exp() - 1));
+    return;
+  }
+  // compute exp(x) for the whole range with the vectorized MLAS routine, then blend; the
+  // exponential dominates the cost of the Eigen expression this replaces
+  MlasComputeExp(input_ptr, output_ptr, static_cast<size_t>(len));
+  ym = (xm >= 0).select(xm, alpha * (ym - 1.0f));
+}
+
+template <>
+void Selu<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const {
+  ptrdiff_t len = last - first;
+  const float* input_ptr = input + first;
+  float* output_ptr = output + first;
+  ConstEigenVectorArrayMap<float> xm(input_ptr, len);
+  EigenVectorArrayMap<float> ym(output_ptr, len);
+  if (input_ptr == output_ptr) {
+    ym = gamma * (xm.cwiseMax(0.0f) + (alpha * (xm.exp() - 1.0f)).cwiseMin(0.0f));
+    return;
+  }
+  MlasComputeExp(input_ptr, output_ptr, static_cast<size_t>(len));
+  ym = gamma * (xm.cwiseMax(0.0f) + (alpha * (ym - 1.0f)).cwiseMin(0.0f));
+}
 }  // namespace functors
 
 }  // namespace onnxruntime
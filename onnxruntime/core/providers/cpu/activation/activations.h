@@ -106,6 +106,9 @@ struct Relu : public ElementWiseRangedTransform<T> {
   }
 };
 
+template <>
+void Relu<MLFloat16>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const;
+
 template <typename T>
 struct Sigmoid : public ElementWiseRangedTransform<T> {
   Status Init(const onnxruntime::NodeAttributes&) {
@@ -131,6 +134,9 @@ struct Sigmoid : public ElementWiseRangedTransform<T> {
 template <>
 void Sigmoid<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const;
 
+template <>
+void Sigmoid<MLFloat16>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const;
+
 template <typename T>
 struct Softsign : public ElementWiseRangedTransform<T> {
   Status Init(const onnxruntime::NodeAttributes&) {
@@ -178,6 +184,9 @@ struct Tanh : public ElementWiseRangedTransform<T> {
 template <>
 void Tanh<float>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const;
 
+template <>
+void Tanh<MLFloat16>::operator()(std::ptrdiff_t first, std::ptrdiff_t last) const;
+
 template <typename T>
 struct ThresholdedRelu : public ElementWiseRangedTransform<T> {
   ORT_GET_FLOAT_ATTR_AND_RETURN(alpha);
@@ -21,6 +21,7 @@
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/framework/session_options.h"
 #include "core/framework/TensorSeq.h"
+#include "core/platform/threadpool.h"
 
 #include "gsl/gsl"
 
@@ -215,7 +216,7 @@ class LoopImpl {
   void* stream_;
 };
 
-static Status ConcatenateCpuOutput(void* /*stream*/,
+static Status ConcatenateCpuOutput(void* /*stream*/, concurrency::ThreadPool* tp,
                                    std::vector<OrtValue>& per_iteration_output,
                                    void* output, size_t output_size_in_bytes) {
   const auto& first_output = per_iteration_output.front().Get<Tensor>();
@@ -227,22 +228,32 @@ static Status ConcatenateCpuOutput(void* /*stream*/,
   gsl::span<gsl::byte> output_span = gsl::make_span<gsl::byte>(static_cast<gsl::byte*>(output),
                                                                output_size_in_bytes);
 
-  for (size_t i = 0, num_iterations = per_iteration_output.size(); i < num_iterations; ++i) {
-    auto& ort_value = per_iteration_output[i];
-    auto& iteration_data = ort_value.Get<Tensor>();
+  const size_t num_iterations = per_iteration_output.size();
 
-    // sanity check
+  // sanity check before copying so a failure can be reported without a partial parallel copy
+  for (size_t i = 0; i < num_iterations; ++i) {
+    auto& iteration_data = per_iteration_output[i].Get<Tensor>();
     if (bytes_per_iteration != iteration_data.SizeInBytes()) {
       return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Inconsistent shape in loop output for output. ",
                              " Expected:", per_iteration_shape, " Got:", iteration_data.Shape());
     }
-
-    auto src = gsl::make_span<const gsl::byte>(static_cast<const gsl::byte*>(iteration_data.DataRaw()),
-                                               bytes_per_iteration);
-    auto dst = output_span.subspan(i * bytes_per_iteration, bytes_per_iteration);
-    gsl::copy(src, dst);
   }
 
+  // the per-iteration copies are independent, so spread them over the intra-op pool when the
+  // output is large enough for that to pay off
+  concurrency::ThreadPool::TryParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_iterations),
+      TensorOpCost{static_cast<double>(bytes_per_iteration), static_cast<double>(bytes_per_iteration), 0.0},
+      [&per_iteration_output, &output_span, bytes_per_iteration](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          auto& iteration_data = per_iteration_output[i].Get<Tensor>();
+          auto src = gsl::make_span<const gsl::byte>(static_cast<const gsl::byte*>(iteration_data.DataRaw()),
+                                                     bytes_per_iteration);
+          auto dst = output_span.subspan(i * bytes_per_iteration, bytes_per_iteration);
+          gsl::copy(src, dst);
+        }
+      });
+
   return Status::OK();
 }
 
@@ -411,6 +422,16 @@ Status LoopImpl::Initialize() {
 
   loop_output_tensors_.resize(info_.num_outputs - info_.num_loop_carried_vars);
 
+  // when the trip count is known up front, reserve the per-iteration output slots so long running
+  // loops don't repeatedly regrow these vectors. cap the reservation as 'M' may be a huge value
+  // that a false termination condition cuts short.
+  if (max_trip_count_ > 0 && max_trip_count_ != INT64_MAX) {
+    const auto reserve_size = static_cast<size_t>(std::min<int64_t>(max_trip_count_, 4096));
+    for (auto& per_iteration_outputs : loop_output_tensors_) {
+      per_iteration_outputs.reserve(reserve_size);
+    }
+  }
+
   return status;
 }
 
@@ -463,7 +484,8 @@ Status LoopImpl::ConcatenateLoopOutput(std::vector<OrtValue>& per_iteration_outp
   TensorShape output_shape{dims};
   Tensor* output = context_.Output(output_index, output_shape);
 
-  ORT_RETURN_IF_ERROR(concat_output_func_(stream_, per_iteration_output, output->MutableDataRaw(), output->SizeInBytes()));
+  ORT_RETURN_IF_ERROR(concat_output_func_(stream_, context_.GetOperatorThreadPool(), per_iteration_output,
+                                          output->MutableDataRaw(), output->SizeInBytes()));
 
   return Status::OK();
 }
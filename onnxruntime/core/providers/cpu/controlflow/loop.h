@@ -11,6 +11,9 @@
 #include "core/providers/cpu/controlflow/utils.h"
 
 namespace onnxruntime {
+namespace concurrency {
+class ThreadPool;
+}
 
 class Loop : public controlflow::IControlFlowKernel {
  public:
@@ -27,9 +30,12 @@ class Loop : public controlflow::IControlFlowKernel {
   ~Loop();
 
   // function to concatenate the OrtValue instances from each Loop iteration into a single output buffer.
+  // @param tp Intra-op thread pool of the session running the Loop node. May be nullptr.
+  //           The per-iteration copies are independent so an implementation may spread them over the pool.
   // @param per_iteration_output OrtValue instances from each iteration. Never empty. All should have the same shape.
   // @param output Pre-allocated output buffer. On device specific to the ExecutionProvider running the Loop node.
-  using ConcatOutput = std::function<Status(void* stream, std::vector<OrtValue>& per_iteration_output,
+  using ConcatOutput = std::function<Status(void* stream, concurrency::ThreadPool* tp,
+                                            std::vector<OrtValue>& per_iteration_output,
                                             void* output, size_t output_size_in_bytes)>;
 
  protected:
@@ -12,9 +12,15 @@ namespace onnxruntime {
 // Information needed to construct CPU execution providers.
 struct CPUExecutionProviderInfo {
   bool create_arena{true};
+  // back the arena with mimalloc per-thread heaps instead of BFCArena. only honored in builds
+  // with onnxruntime_USE_MIMALLOC_ARENA_ALLOCATOR.
+  bool use_mimalloc_arena{false};
+  // advise the kernel to back arena regions with huge pages, cutting dTLB misses on large
+  // weight working sets. best effort; ignored where the platform has no such facility.
+  bool use_huge_pages{false};
 
-  explicit CPUExecutionProviderInfo(bool use_arena)
-      : create_arena(use_arena) {}
+  explicit CPUExecutionProviderInfo(bool use_arena, bool use_mimalloc = false)
+      : create_arena(use_arena), use_mimalloc_arena(use_mimalloc) {}
 
   CPUExecutionProviderInfo() = default;
 };
@@ -40,8 +46,11 @@ class CPUExecutionProvider : public IExecutionProvider {
     create_arena = false;
 #endif
 
+    // enable the arena's small-chunk thread cache: CPU tensors are allocated and freed on host
+    // threads and small activations dominate under concurrent Run calls
     AllocatorCreationInfo device_info{[](int) { return onnxruntime::make_unique<TAllocator>(); },
-                                      0, create_arena};
+                                      0, create_arena, {0, -1, -1, -1}, /*use_arena_thread_cache*/ true,
+                                      info.use_mimalloc_arena, info.use_huge_pages};
 
     InsertAllocator(CreateAllocator(device_info));
   }
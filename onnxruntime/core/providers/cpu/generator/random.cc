@@ -23,9 +23,11 @@ limitations under the License.
 
 #include <algorithm>
 #include <chrono>
+#include <cmath>
 #include <random>
 
 #include "core/common/safeint.h"
+#include "core/platform/threadpool.h"
 #include "core/util/math_cpuonly.h"
 #include "core/common/eigen_common_wrapper.h"
 #include "gsl/gsl"
@@ -68,11 +70,10 @@ ONNX_CPU_OPERATOR_KERNEL(
     KernelDefBuilder().TypeConstraint("T1", DataTypeImpl::GetTensorType<float>()).TypeConstraint("T2", std::vector<MLDataType>{DataTypeImpl::GetTensorType<int32_t>(), DataTypeImpl::GetTensorType<int64_t>()}),
     Multinomial);
 
-template <typename T, typename TDistribution>
-void GenerateData(std::default_random_engine& generator, TDistribution distribution, Tensor& tensor);
-
-static Status RandomNormalCompute(float mean, float scale, std::default_random_engine& generator, TensorProto::DataType dtype, Tensor& Y);
-static Status RandomUniformCompute(float high, float low, std::default_random_engine& generator, TensorProto::DataType dtype, Tensor& Y);
+static Status RandomNormalCompute(float mean, float scale, PhiloxGenerator& generator,
+                                  concurrency::ThreadPool* thread_pool, TensorProto::DataType dtype, Tensor& Y);
+static Status RandomUniformCompute(float high, float low, PhiloxGenerator& generator,
+                                   concurrency::ThreadPool* thread_pool, TensorProto::DataType dtype, Tensor& Y);
 
 static Status CreateOutputTensorFromTensorShape(OpKernelContext* ctx, const Tensor& X, Tensor** Y);
 static TensorProto::DataType InferDataType(const Tensor& tensor);
@@ -80,8 +81,8 @@ static TensorProto::DataType InferDataType(const Tensor& tensor);
 Status RandomNormal::Compute(OpKernelContext* ctx) const {
   Tensor& Y = *ctx->Output(0, shape_);
 
-  std::lock_guard<onnxruntime::OrtMutex> l(generator_mutex_);
-  auto status = RandomNormalCompute(mean_, scale_, generator_, dtype_, Y);
+  // generator_ is internally synchronized: each call reserves its own span of counter blocks
+  auto status = RandomNormalCompute(mean_, scale_, generator_, ctx->GetOperatorThreadPool(), dtype_, Y);
 
   return status;
 }
@@ -89,8 +90,7 @@ Status RandomNormal::Compute(OpKernelContext* ctx) const {
 Status RandomUniform::Compute(OpKernelContext* ctx) const {
   Tensor& Y = *ctx->Output(0, shape_);
 
-  std::lock_guard<onnxruntime::OrtMutex> l(generator_mutex_);
-  auto status = RandomUniformCompute(low_, high_, generator_, dtype_, Y);
+  auto status = RandomUniformCompute(low_, high_, generator_, ctx->GetOperatorThreadPool(), dtype_, Y);
 
   return status;
 }
@@ -111,8 +111,7 @@ Status RandomNormalLike::Compute(OpKernelContext* ctx) const {
                            "Could not infer data type from input tensor with data type ",
                            X.DataType());
 
-  std::lock_guard<onnxruntime::OrtMutex> l(generator_mutex_);
-  status = RandomNormalCompute(mean_, scale_, generator_, dtype, *Y);
+  status = RandomNormalCompute(mean_, scale_, generator_, ctx->GetOperatorThreadPool(), dtype, *Y);
 
   return status;
 }
@@ -132,8 +131,7 @@ Status RandomUniformLike::Compute(OpKernelContext* ctx) const {
     return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
                            "Could not infer data type from input tensor with data type ",
                            X.DataType());
-  std::lock_guard<onnxruntime::OrtMutex> l(generator_mutex_);
-  status = RandomUniformCompute(low_, high_, generator_, dtype, *Y);
+  status = RandomUniformCompute(low_, high_, generator_, ctx->GetOperatorThreadPool(), dtype, *Y);
 
   return status;
 }
@@ -272,21 +270,126 @@ static TensorProto::DataType InferDataType(const Tensor& tensor) {
   return static_cast<TensorProto::DataType>(dtype);
 }
 
+// Walks the Philox counter space [offset, offset + num_blocks) and converts each
+// block of four 32-bit lanes into up to 'lanes_per_block' output values with
+// 'block_fn'. Every shard seeds its own engine at its first block, so the stream
+// for a given seed and offset is identical no matter how the thread pool splits
+// the work.
+template <typename T, typename BlockFn>
+static void GeneratePhilox(uint64_t seed, uint64_t offset, int64_t lanes_per_block,
+                           T* output, int64_t count,
+                           concurrency::ThreadPool* thread_pool, BlockFn block_fn) {
+  const int64_t num_blocks = (count + lanes_per_block - 1) / lanes_per_block;
+  auto generate_fn =
+      [=](std::ptrdiff_t block_begin, std::ptrdiff_t block_end) {
+        Philox4x32x10 engine(seed, offset + static_cast<uint64_t>(block_begin));
+        uint32_t bits[4];
+        for (auto block = block_begin; block < block_end; ++block) {
+          engine.NextBlock(bits);
+          const int64_t element = block * lanes_per_block;
+          block_fn(bits, output + element, std::min(lanes_per_block, count - element));
+        }
+      };
+  // each block is ten rounds of integer mixing plus the distribution transform
+  concurrency::ThreadPool::TryParallelFor(thread_pool, static_cast<std::ptrdiff_t>(num_blocks),
+                                          64.0, generate_fn);
+}
+
+template <typename T>
+static void GenerateUniform(PhiloxGenerator& generator, T low, T high, T* output, int64_t count,
+                            concurrency::ThreadPool* thread_pool);
+
+template <>
+void GenerateUniform<float>(PhiloxGenerator& generator, float low, float high, float* output,
+                            int64_t count, concurrency::ThreadPool* thread_pool) {
+  const int64_t num_blocks = (count + 3) / 4;
+  const auto seeds = generator.NextPhiloxSeeds(static_cast<uint64_t>(num_blocks));
+  const float range = high - low;
+  GeneratePhilox(seeds.first, seeds.second, 4, output, count, thread_pool,
+                 [low, range](const uint32_t* bits, float* dst, int64_t n) {
+                   for (int64_t i = 0; i < n; ++i) {
+                     dst[i] = low + range * PhiloxUniformFloat(bits[i]);
+                   }
+                 });
+}
+
+template <>
+void GenerateUniform<double>(PhiloxGenerator& generator, double low, double high, double* output,
+                             int64_t count, concurrency::ThreadPool* thread_pool) {
+  const int64_t num_blocks = (count + 1) / 2;
+  const auto seeds = generator.NextPhiloxSeeds(static_cast<uint64_t>(num_blocks));
+  const double range = high - low;
+  GeneratePhilox(seeds.first, seeds.second, 2, output, count, thread_pool,
+                 [low, range](const uint32_t* bits, double* dst, int64_t n) {
+                   for (int64_t i = 0; i < n; ++i) {
+                     dst[i] = low + range * PhiloxUniformDouble(bits[2 * i], bits[2 * i + 1]);
+                   }
+                 });
+}
+
+constexpr double kTwoPi = 6.283185307179586476925286766559;
+
+template <typename T>
+static void GenerateNormal(PhiloxGenerator& generator, T mean, T scale, T* output, int64_t count,
+                           concurrency::ThreadPool* thread_pool);
+
+template <>
+void GenerateNormal<float>(PhiloxGenerator& generator, float mean, float scale, float* output,
+                           int64_t count, concurrency::ThreadPool* thread_pool) {
+  const int64_t num_blocks = (count + 3) / 4;
+  const auto seeds = generator.NextPhiloxSeeds(static_cast<uint64_t>(num_blocks));
+  GeneratePhilox(seeds.first, seeds.second, 4, output, count, thread_pool,
+                 [mean, scale](const uint32_t* bits, float* dst, int64_t n) {
+                   // Box-Muller on each pair of lanes
+                   for (int64_t i = 0; i < n; i += 2) {
+                     // offset the first uniform into (0, 1] so the log is finite
+                     const float u1 = (static_cast<float>(bits[i] >> 8) + 1.0f) * (1.0f / 16777216.0f);
+                     const float u2 = PhiloxUniformFloat(bits[i + 1]);
+                     const float radius = std::sqrt(-2.0f * std::log(u1));
+                     const float theta = static_cast<float>(kTwoPi) * u2;
+                     dst[i] = mean + scale * radius * std::cos(theta);
+                     if (i + 1 < n) {
+                       dst[i + 1] = mean + scale * radius * std::sin(theta);
+                     }
+                   }
+                 });
+}
+
+template <>
+void GenerateNormal<double>(PhiloxGenerator& generator, double mean, double scale, double* output,
+                            int64_t count, concurrency::ThreadPool* thread_pool) {
+  const int64_t num_blocks = (count + 1) / 2;
+  const auto seeds = generator.NextPhiloxSeeds(static_cast<uint64_t>(num_blocks));
+  GeneratePhilox(seeds.first, seeds.second, 2, output, count, thread_pool,
+                 [mean, scale](const uint32_t* bits, double* dst, int64_t n) {
+                   const uint64_t u1_bits = (static_cast<uint64_t>(bits[0]) << 32) | bits[1];
+                   const double u1 = (static_cast<double>(u1_bits >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+                   const double u2 = PhiloxUniformDouble(bits[2], bits[3]);
+                   const double radius = std::sqrt(-2.0 * std::log(u1));
+                   const double theta = kTwoPi * u2;
+                   dst[0] = mean + scale * radius * std::cos(theta);
+                   if (n > 1) {
+                     dst[1] = mean + scale * radius * std::sin(theta);
+                   }
+                 });
+}
+
 static Status RandomNormalCompute(float mean, float scale,
-                                  std::default_random_engine& generator,
+                                  PhiloxGenerator& generator,
+                                  concurrency::ThreadPool* thread_pool,
                                   TensorProto::DataType dtype, Tensor& Y) {
   switch (dtype) {
     case TensorProto::FLOAT: {
-      GenerateData<float, std::normal_distribution<float>>(
-          generator, std::normal_distribution<float>{mean, scale}, Y);
+      GenerateNormal<float>(generator, mean, scale,
+                            Y.MutableData<float>(), Y.Shape().Size(), thread_pool);
       break;
     }
     case TensorProto::FLOAT16: {
       ORT_NOT_IMPLEMENTED("FLOAT16 is not supported");
     }
     case TensorProto::DOUBLE: {
-      GenerateData<double, std::normal_distribution<double>>(
-          generator, std::normal_distribution<double>{mean, scale}, Y);
+      GenerateNormal<double>(generator, mean, scale,
+                             Y.MutableData<double>(), Y.Shape().Size(), thread_pool);
       break;
     }
     default:
@@ -297,21 +400,22 @@ static Status RandomNormalCompute(float mean, float scale,
 }
 
 static Status RandomUniformCompute(float low, float high,
-                                   std::default_random_engine& generator,
+                                   PhiloxGenerator& generator,
+                                   concurrency::ThreadPool* thread_pool,
                                    TensorProto::DataType dtype,
                                    Tensor& Y) {
   switch (dtype) {
     case TensorProto::FLOAT: {
-      GenerateData<float, std::uniform_real_distribution<float>>(
-          generator, std::uniform_real_distribution<float>{low, high}, Y);
+      GenerateUniform<float>(generator, low, high,
+                             Y.MutableData<float>(), Y.Shape().Size(), thread_pool);
       break;
     }
     case TensorProto::FLOAT16: {
       ORT_NOT_IMPLEMENTED("FLOAT16 is not supported");
     }
     case TensorProto::DOUBLE: {
-      GenerateData<double, std::uniform_real_distribution<double>>(
-          generator, std::uniform_real_distribution<double>{low, high}, Y);
+      GenerateUniform<double>(generator, low, high,
+                              Y.MutableData<double>(), Y.Shape().Size(), thread_pool);
       break;
     }
     default:
@@ -321,13 +425,4 @@ static Status RandomUniformCompute(float low, float high,
   return Status::OK();
 }
 
-template <typename T, typename TDistribution>
-void GenerateData(std::default_random_engine& generator, TDistribution distribution, Tensor& tensor) {
-  T* out = tensor.MutableData<T>();
-  for (int64_t i = 0, end = tensor.Shape().Size(); i < end; ++i) {
-    *out = distribution(generator);
-    ++out;
-  }
-}
-
 }  // namespace onnxruntime
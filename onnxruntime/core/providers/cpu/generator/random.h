@@ -8,6 +8,7 @@
 
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/framework/random_generator.h"
 #include "core/platform/ort_mutex.h"
 
 namespace onnxruntime {
@@ -21,12 +22,12 @@ class RandomNormal final : public OpKernel {
     // read optional seed attribute and generate if not provided
     float seed = 0.f;
     if (info.GetAttr<float>("seed", &seed).IsOK()) {
-      generator_ = std::default_random_engine{gsl::narrow_cast<uint32_t>(seed)};
+      generator_.SetSeed(gsl::narrow_cast<uint32_t>(seed));
     }
     else {
-      generator_ = std::default_random_engine{
+      generator_.SetSeed(
         gsl::narrow_cast<uint32_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count())
-      };
+      );
     }
 
     int64_t dtype;
@@ -45,12 +46,11 @@ class RandomNormal final : public OpKernel {
  private:
   float mean_;
   float scale_;
-  
-  // generator_ is updated with every call to Compute(). 
-  // use generator_mutex_ to ensure Compute() can be called concurrently.
-  // this is to ensure that a model with random generators is deterministic and still can be executed in parallel.
-  mutable std::default_random_engine generator_;
-  mutable onnxruntime::OrtMutex generator_mutex_;
+
+  // generator_ hands out a fresh span of Philox counter blocks to every call to
+  // Compute(). this is to ensure that a model with random generators is
+  // deterministic for a given seed and still can be executed in parallel.
+  mutable PhiloxGenerator generator_{0};
   ONNX_NAMESPACE::TensorProto::DataType dtype_;
   TensorShape shape_;
 };
@@ -64,12 +64,12 @@ class RandomNormalLike final : public OpKernel {
     // read optional seed attribute and generate if not provided
     float seed = 0.f;
     if (info.GetAttr<float>("seed", &seed).IsOK()) {
-      generator_ = std::default_random_engine{gsl::narrow_cast<uint32_t>(seed)};
+      generator_.SetSeed(gsl::narrow_cast<uint32_t>(seed));
     }
     else {
-      generator_ = std::default_random_engine{
+      generator_.SetSeed(
         gsl::narrow_cast<uint32_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count())
-      };
+      );
     }
 
     int64_t dtype;
@@ -85,10 +85,9 @@ class RandomNormalLike final : public OpKernel {
  private:
   float mean_;
   float scale_;
-  
-  // see comments for generator_ and generator_mutex_ in RandomNormal class.
-  mutable std::default_random_engine generator_;
-  mutable onnxruntime::OrtMutex generator_mutex_;
+
+  // see comments for generator_ in RandomNormal class.
+  mutable PhiloxGenerator generator_{0};
   ONNX_NAMESPACE::TensorProto::DataType dtype_ = ONNX_NAMESPACE::TensorProto::DataType::TensorProto_DataType_UNDEFINED;  //optional and may be inferred
 };
 
@@ -101,12 +100,12 @@ class RandomUniform final : public OpKernel {
     // read optional seed attribute and generate if not provided
     float seed = 0.f;
     if (info.GetAttr<float>("seed", &seed).IsOK()) {
-      generator_ = std::default_random_engine{gsl::narrow_cast<uint32_t>(seed)};
+      generator_.SetSeed(gsl::narrow_cast<uint32_t>(seed));
     }
     else {
-      generator_ = std::default_random_engine{
+      generator_.SetSeed(
         gsl::narrow_cast<uint32_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count())
-      };
+      );
     }
 
     int64_t dtype;
@@ -126,9 +125,8 @@ class RandomUniform final : public OpKernel {
   float high_;
   float low_;
 
-  // see comments for generator_ and generator_mutex_ in RandomNormal class.
-  mutable std::default_random_engine generator_;
-  mutable onnxruntime::OrtMutex generator_mutex_;
+  // see comments for generator_ in RandomNormal class.
+  mutable PhiloxGenerator generator_{0};
   ONNX_NAMESPACE::TensorProto::DataType dtype_;
   TensorShape shape_;
 };
@@ -141,12 +139,12 @@ class RandomUniformLike final : public OpKernel {
     // read optional seed attribute and generate if not provided
     float seed = 0.f;
     if (info.GetAttr<float>("seed", &seed).IsOK()) {
-      generator_ = std::default_random_engine{gsl::narrow_cast<uint32_t>(seed)};
+      generator_.SetSeed(gsl::narrow_cast<uint32_t>(seed));
     }
     else {
-      generator_ = std::default_random_engine{
+      generator_.SetSeed(
         gsl::narrow_cast<uint32_t>(std::chrono::high_resolution_clock::now().time_since_epoch().count())
-      };
+      );
     }
 
     int64_t dtype;
@@ -162,10 +160,9 @@ class RandomUniformLike final : public OpKernel {
  private:
   float high_;
   float low_;
-  
-  // see comments for generator_ and generator_mutex_ in RandomNormal class.
-  mutable std::default_random_engine generator_;
-  mutable onnxruntime::OrtMutex generator_mutex_;
+
+  // see comments for generator_ in RandomNormal class.
+  mutable PhiloxGenerator generator_{0};
   ONNX_NAMESPACE::TensorProto::DataType dtype_ = ONNX_NAMESPACE::TensorProto::DataType::TensorProto_DataType_UNDEFINED;  //optional and may be inferred
 };
 
@@ -199,7 +196,9 @@ class Multinomial final : public OpKernel {
  private:
   int64_t num_samples_;
 
-  // see comments for generator_ and generator_mutex_ in RandomNormal class.
+  // generator_ is updated with every call to Compute().
+  // use generator_mutex_ to ensure Compute() can be called concurrently.
+  // this is to ensure that a model with random generators is deterministic and still can be executed in parallel.
   mutable std::default_random_engine generator_;
   mutable onnxruntime::OrtMutex generator_mutex_;
   ONNX_NAMESPACE::TensorProto::DataType output_dtype_;
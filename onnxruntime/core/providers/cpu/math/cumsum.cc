@@ -2,8 +2,8 @@
 // Licensed under the MIT License.
 
 #include "cumsum.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
-#include "core/providers/cpu/tensor/utils.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/tensorprotoutils.h"
 
@@ -11,40 +11,87 @@ using namespace onnxruntime;
 
 namespace {
 // static section
-std::vector<int64_t> GetStarts(int64_t rank, int64_t axis, int64_t index) {
-  std::vector<int64_t> starts(rank, 0);
-  starts[axis] = index;
-  return starts;
-}
-template <typename T>
-void ZeroOutSliceAtIndex(Tensor& output, int64_t rank, int64_t axis, int64_t index,
-                         const std::vector<int64_t>& slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  T zero{};
-  auto output_starts(GetStarts(rank, axis, index));
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator) {
-    *output_iterator = zero;
-  }
-}
+
+// Minimum number of elements a scan block should own before the blocked parallel
+// scan is worth its two passes over the data.
+constexpr int64_t kMinElementsPerScanBlock = 4096;
+
+// Blocked parallel scan of one contiguous row: per-block reductions (which vectorize),
+// a serial exclusive scan of the block totals, then a parallel pass where every block
+// computes its local scan on top of its offset.
 template <typename T>
-void CopySlices(const Tensor& input, Tensor& output,
-                const std::vector<int64_t>& input_starts, const std::vector<int64_t>& output_starts,
-                const std::vector<int64_t>& slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  SliceIterator<T> input_iterator(input, input_starts, slice_dims, steps);
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator, ++input_iterator) {
-    *output_iterator = *input_iterator;
+void BlockedScanRow(const T* in, T* out, int64_t n, bool exclusive, bool reverse,
+                    concurrency::ThreadPool* tp) {
+  const int64_t num_blocks =
+      std::max<int64_t>(1, std::min<int64_t>(concurrency::ThreadPool::DegreeOfParallelism(tp),
+                                             n / kMinElementsPerScanBlock));
+
+  std::vector<T> block_offsets(static_cast<size_t>(num_blocks) + 1, T{});
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_blocks), [&](std::ptrdiff_t block) {
+        const auto work = concurrency::ThreadPool::PartitionWork(block, static_cast<std::ptrdiff_t>(num_blocks),
+                                                                 static_cast<std::ptrdiff_t>(n));
+        T total{};
+        for (std::ptrdiff_t k = work.start; k < work.end; ++k) {
+          total += in[reverse ? n - 1 - k : k];
+        }
+        block_offsets[block + 1] = total;
+      });
+
+  for (int64_t block = 0; block < num_blocks; ++block) {
+    block_offsets[block + 1] += block_offsets[block];
   }
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_blocks), [&](std::ptrdiff_t block) {
+        const auto work = concurrency::ThreadPool::PartitionWork(block, static_cast<std::ptrdiff_t>(num_blocks),
+                                                                 static_cast<std::ptrdiff_t>(n));
+        T running = block_offsets[block];
+        for (std::ptrdiff_t k = work.start; k < work.end; ++k) {
+          const int64_t idx = reverse ? n - 1 - k : k;
+          if (exclusive) {
+            out[idx] = running;
+            running += in[idx];
+          } else {
+            running += in[idx];
+            out[idx] = running;
+          }
+        }
+      });
 }
+
+// Scans one [dim, inner] panel along the axis for the inner columns in [chunk_begin, chunk_end).
+// Columns are independent, so the inner loops vectorize and panels/chunks can run in parallel.
 template <typename T>
-void SumSlices(const Tensor& input, Tensor& output,
-               const std::vector<int64_t>& input_starts, const std::vector<int64_t>& output_starts, const std::vector<int64_t>& previous_output_starts,
-               const std::vector<int64_t>& slice_dims, const std::vector<int64_t>& steps, const int64_t slice_size) {
-  SliceIterator<T> input_iterator(input, input_starts, slice_dims, steps);
-  WritableSliceIterator<T> output_iterator(output, output_starts, slice_dims, steps);
-  SliceIterator<T> previous_output_iterator(output, previous_output_starts, slice_dims, steps);
-  for (int64_t k = 0; k < slice_size; ++k, ++output_iterator, ++input_iterator, ++previous_output_iterator) {
-    *output_iterator = *input_iterator + *previous_output_iterator;
+void ScanColumns(const T* in, T* out, int64_t dim, int64_t inner,
+                 int64_t chunk_begin, int64_t chunk_end, bool exclusive, bool reverse) {
+  const T* prev = nullptr;
+
+  for (int64_t k = 0; k < dim; ++k) {
+    const int64_t out_idx = reverse ? dim - 1 - k : k;
+    T* out_slice = out + out_idx * inner;
+
+    if (k == 0) {
+      if (exclusive) {
+        for (int64_t j = chunk_begin; j < chunk_end; ++j) {
+          out_slice[j] = T{};
+        }
+      } else {
+        const T* in_slice = in + out_idx * inner;
+        for (int64_t j = chunk_begin; j < chunk_end; ++j) {
+          out_slice[j] = in_slice[j];
+        }
+      }
+    } else {
+      const int64_t in_idx = exclusive ? (reverse ? out_idx + 1 : out_idx - 1) : out_idx;
+      const T* in_slice = in + in_idx * inner;
+      for (int64_t j = chunk_begin; j < chunk_end; ++j) {
+        out_slice[j] = in_slice[j] + prev[j];
+      }
+    }
+
+    prev = out_slice;
   }
 }
 }  // namespace
@@ -147,63 +194,53 @@ Status CumSum<T>::Compute(OpKernelContext* ctx) const {
   int64_t axis = 0;
   ORT_THROW_IF_ERROR(cumsum_op::GetAxis(axis_tensor, rank, axis));
 
-  auto dim(output_tensor.Shape()[axis]);    // dimension size for the axis
-  TensorShape slice_shape(input->Shape());  // the shape of one slice of input/output for the given value of the axis
-  slice_shape[axis] = 1;
-  auto slice_size(slice_shape.Size());     // total number of elements in each slice
-  auto slice_dims(slice_shape.GetDims());  // dim array for the slice
+  // decompose the shape into [outer, dim, inner] around the scan axis; the data is contiguous
+  // so every (outer, inner column) scan is independent
+  const auto& dims = input->Shape().GetDims();
+  const int64_t dim = dims[axis];
 
-  std::vector<int64_t> steps(rank, 1);  // steps for the slice -- always set to 1
+  int64_t outer = 1;
+  for (int64_t i = 0; i < axis; ++i) {
+    outer *= dims[i];
+  }
 
-  if (!reverse_) {
-    int64_t index(0);  // the index we use as we walkthrough the given axis
-    // If (exclusive == true) the first slice is always 0
-    if (exclusive_) {
-      ::ZeroOutSliceAtIndex<T>(output_tensor, rank, axis, index, slice_dims, steps, slice_size);
-      ++index;
-    }
-    {
-      // The next slice is a copy of the input (if exclusive == false then this is the first slice)
-      auto input_starts(::GetStarts(rank, axis, 0));
-      auto output_starts(::GetStarts(rank, axis, index));
-      ::CopySlices<T>(*input, output_tensor, input_starts, output_starts, slice_dims, steps, slice_size);
-      ++index;
-    }
+  int64_t inner = 1;
+  for (size_t i = static_cast<size_t>(axis) + 1; i < dims.size(); ++i) {
+    inner *= dims[i];
+  }
 
-    for (; index < dim; ++index) {
-      // Each output slice is the sum of corresponding input slice and the previous output slice
-      auto input_starts(::GetStarts(rank, axis, exclusive_ ? index - 1 : index));
-      auto output_starts(::GetStarts(rank, axis, index));
-      auto previous_starts(::GetStarts(rank, axis, index - 1));
-      ::SumSlices<T>(*input, output_tensor, input_starts, output_starts, previous_starts,
-                     slice_dims, steps, slice_size);
-    }
-  } else {
-    //_reverse == true
-    int64_t index(dim - 1);  // the index we use as we walkthrough the given axis
-    // If (exclusive == true) the first slice is always 0
-    if (exclusive_) {
-      ::ZeroOutSliceAtIndex<T>(output_tensor, rank, axis, index, slice_dims, steps, slice_size);
-      --index;
-    }
-    {
-      // The next slice is a copy of the input (if exclusive == false then this is the first slice)
-      auto input_starts(::GetStarts(rank, axis, dim - 1));
-      auto output_starts(::GetStarts(rank, axis, index));
-      ::CopySlices<T>(*input, output_tensor, input_starts, output_starts, slice_dims, steps, slice_size);
-      --index;
-    }
+  const T* input_data = input->template Data<T>();
+  T* output_data = output_tensor.template MutableData<T>();
+
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+  const int64_t degree_of_parallelism = concurrency::ThreadPool::DegreeOfParallelism(tp);
 
-    for (; index >= 0; --index) {
-      // Each output slice is the sum of corresponding input slice and the previous output slice
-      auto input_starts(::GetStarts(rank, axis, exclusive_ ? index + 1 : index));
-      auto output_starts(::GetStarts(rank, axis, index));
-      auto previous_starts(::GetStarts(rank, axis, index + 1));
-      ::SumSlices<T>(*input, output_tensor, input_starts, output_starts, previous_starts,
-                     slice_dims, steps, slice_size);
+  // long contiguous rows with too few of them to occupy the threads get the blocked
+  // parallel scan along the axis itself
+  if (inner == 1 && outer < degree_of_parallelism && dim >= 2 * ::kMinElementsPerScanBlock) {
+    for (int64_t o = 0; o < outer; ++o) {
+      ::BlockedScanRow(input_data + o * dim, output_data + o * dim, dim,
+                       exclusive_ != 0, reverse_ != 0, tp);
     }
+    return Status::OK();
   }
 
+  // otherwise shard the independent scans over (outer panel, inner column chunk) tasks
+  const int64_t num_inner_chunks =
+      std::min<int64_t>(inner, std::max<int64_t>(1, (degree_of_parallelism + outer - 1) / outer));
+  const int64_t chunk_size = (inner + num_inner_chunks - 1) / num_inner_chunks;
+
+  concurrency::ThreadPool::TryBatchParallelFor(
+      tp, static_cast<ptrdiff_t>(outer * num_inner_chunks),
+      [&](ptrdiff_t task) {
+        const int64_t o = task / num_inner_chunks;
+        const int64_t chunk_begin = (task % num_inner_chunks) * chunk_size;
+        const int64_t chunk_end = std::min(chunk_begin + chunk_size, inner);
+        ::ScanColumns(input_data + o * dim * inner, output_data + o * dim * inner,
+                      dim, inner, chunk_begin, chunk_end, exclusive_ != 0, reverse_ != 0);
+      },
+      0);
+
   return Status::OK();
 }
 
@@ -51,9 +51,28 @@ Status Einsum::DeviceCompute(OpKernelContext* context, const std::vector<const T
 
   einsum_compute_preprocessor.SetDeviceHelpers(EinsumOp::DeviceHelpers::CpuDeviceHelpers::Diagonal,
                                                EinsumOp::DeviceHelpers::CpuDeviceHelpers::Transpose);
+
+  // The metadata that the pre-processor derives only depends on the input shapes
+  // (the equation is fixed per kernel instance) - re-use the metadata cached over a
+  // previous call with identically shaped inputs where possible
+  {
+    std::lock_guard<OrtMutex> lock(einsum_shape_plan_mutex_);
+    if (einsum_shape_plan_cache_.Matches(inputs)) {
+      einsum_compute_preprocessor.SetCachedShapePlan(einsum_shape_plan_cache_);
+    }
+  }
+
   // Compute all required metadata to be used at Einsum compute time and return error status code if one was generated
   ORT_RETURN_IF_ERROR(einsum_compute_preprocessor.Run());
 
+  // Cache the derived metadata for re-use on the next call if the shapes repeat
+  {
+    std::lock_guard<OrtMutex> lock(einsum_shape_plan_mutex_);
+    if (!einsum_shape_plan_cache_.Matches(inputs)) {
+      einsum_compute_preprocessor.ExportShapePlan(einsum_shape_plan_cache_);
+    }
+  }
+
   // EinsumComputeProcessor section -
   if (inputs[0]->IsDataType<float>()) {
     auto einsum_compute_processor = EinsumTypedComputeProcessor<float>(context, allocator,
@@ -5,6 +5,7 @@
 
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include "einsum_utils/einsum_compute_preprocessor.h"
 #include "einsum_utils/einsum_typed_compute_processor.h"
 
@@ -27,6 +28,11 @@ class Einsum : public OpKernel {
 
   std::string equation_;
   std::unique_ptr<EinsumEquationPreprocessor> einsum_equation_preprocessor_;
+
+  // Shape-dependent metadata derived on the first Compute() call - re-used on subsequent
+  // calls as long as the input shapes stay the same (the steady state during inferencing)
+  mutable OrtMutex einsum_shape_plan_mutex_;
+  mutable EinsumShapePlan einsum_shape_plan_cache_;
 };
 
 }  // namespace onnxruntime
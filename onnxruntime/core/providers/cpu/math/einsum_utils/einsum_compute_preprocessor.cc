@@ -5,6 +5,20 @@
 
 namespace onnxruntime {
 
+bool EinsumShapePlan::Matches(const std::vector<const Tensor*>& inputs) const {
+  if (input_shapes_.size() != inputs.size()) {
+    return false;
+  }
+
+  for (size_t i = 0; i < inputs.size(); ++i) {
+    if (input_shapes_[i] != inputs[i]->Shape()) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 EinsumComputePreprocessor::EinsumComputePreprocessor(EinsumEquationPreprocessor& einsum_equation_preprocessor,
                                                      const std::vector<const Tensor*>& inputs,
                                                      AllocatorPtr allocator,
@@ -19,13 +33,17 @@ EinsumComputePreprocessor::EinsumComputePreprocessor(EinsumEquationPreprocessor&
 }
 
 Status EinsumComputePreprocessor::Run() {
-  ORT_RETURN_IF_ERROR(ProcessSubscripts());
+  // If the metadata derived over identically shaped inputs was cached by the kernel,
+  // skip straight to pre-processing the inputs themselves
+  if (!has_cached_shape_plan_) {
+    ORT_RETURN_IF_ERROR(ProcessSubscripts());
 
-  ORT_RETURN_IF_ERROR(PostProcessBroadcastedDims());
+    ORT_RETURN_IF_ERROR(PostProcessBroadcastedDims());
 
-  ORT_RETURN_IF_ERROR(ParseOrCreateOutputSubscript());
+    ORT_RETURN_IF_ERROR(ParseOrCreateOutputSubscript());
 
-  ORT_RETURN_IF_ERROR(CalculateOutputShape());
+    ORT_RETURN_IF_ERROR(CalculateOutputShape());
+  }
 
   ORT_RETURN_IF_ERROR(PreprocessInputs());
 
@@ -66,6 +84,29 @@ void EinsumComputePreprocessor::SetDeviceHelpers(const EinsumOp::DeviceHelpers::
   device_transpose_func_ = device_transpose_func;
 }
 
+void EinsumComputePreprocessor::ExportShapePlan(EinsumShapePlan& plan) const {
+  plan.input_shapes_.clear();
+  plan.input_shapes_.reserve(inputs_.size());
+  for (const auto* input : inputs_) {
+    plan.input_shapes_.push_back(input->Shape());
+  }
+
+  plan.num_subscript_indices_ = num_subscript_indices_;
+  plan.subscript_indices_to_last_input_ = subscript_indices_to_last_input_;
+  plan.output_dims_ = output_dims_;
+  plan.input_subscript_indices_ = input_subscript_indices_;
+  plan.subscript_indices_to_output_indices_ = subscript_indices_to_output_indices_;
+}
+
+void EinsumComputePreprocessor::SetCachedShapePlan(const EinsumShapePlan& plan) {
+  num_subscript_indices_ = plan.num_subscript_indices_;
+  subscript_indices_to_last_input_ = plan.subscript_indices_to_last_input_;
+  output_dims_ = plan.output_dims_;
+  input_subscript_indices_ = plan.input_subscript_indices_;
+  subscript_indices_to_output_indices_ = plan.subscript_indices_to_output_indices_;
+  has_cached_shape_plan_ = true;
+}
+
 Status EinsumComputePreprocessor::ProcessSubscripts() {
   const auto& left_equation_split = einsum_equation_preprocessor_.left_equation_split_;
   if (left_equation_split.size() != inputs_.size()) {
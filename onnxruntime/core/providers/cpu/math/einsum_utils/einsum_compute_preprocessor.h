@@ -97,6 +97,25 @@ struct EinsumEquationPreprocessor {
   bool is_explicit_ = false;
 };
 
+// Holds a snapshot of the shape-dependent metadata derived by EinsumComputePreprocessor.
+// The equation string is fixed per kernel instance, so this metadata only changes when the
+// input shapes change and kernels may cache it across Compute() calls keyed on the input shapes.
+struct EinsumShapePlan {
+  // Returns true iff this plan was derived over inputs with the given shapes
+  bool Matches(const std::vector<const Tensor*>& inputs) const;
+
+  // The shapes of the inputs this plan was derived from
+  std::vector<TensorShape> input_shapes_;
+
+  // Snapshots of the members of EinsumComputePreprocessor (of the same names)
+  // that are needed downstream of the metadata derivation
+  int64_t num_subscript_indices_ = 0;
+  std::vector<int64_t> subscript_indices_to_last_input_;
+  std::vector<int64_t> output_dims_;
+  std::vector<std::vector<int64_t>> input_subscript_indices_;
+  std::vector<int64_t> subscript_indices_to_output_indices_;
+};
+
 // Prologue:
 // In the sample Einsum string: 'ij, jk'
 // Subscripts are 'ij' and 'jk'
@@ -146,6 +165,14 @@ class EinsumComputePreprocessor final {
   void SetDeviceHelpers(const EinsumOp::DeviceHelpers::Diagonal& diagonal_func,
                         const EinsumOp::DeviceHelpers::Transpose& transpose_func);
 
+  // Populate `plan` with the shape-dependent metadata derived by Run() so that a subsequent
+  // call over identically shaped inputs may skip re-deriving it (see SetCachedShapePlan())
+  void ExportShapePlan(EinsumShapePlan& plan) const;
+
+  // Re-use previously derived metadata instead of deriving it again during Run()
+  // Must only be called with a plan that `Matches` the inputs this instance was created with
+  void SetCachedShapePlan(const EinsumShapePlan& plan);
+
  private:
   // Process subscripts of each input and collect metadata along the way
   Status ProcessSubscripts();
@@ -212,6 +239,10 @@ class EinsumComputePreprocessor final {
   // A value of -1 means the corresponding subscript index is not found in the output
   std::vector<int64_t> subscript_indices_to_output_indices_;
 
+  // Flag indicating if the metadata derivation steps of Run() are to be skipped
+  // because the metadata was populated from a kernel-cached shape plan
+  bool has_cached_shape_plan_ = false;
+
   // Allocator to use for ad-hoc tensor buffer allocation
   AllocatorPtr allocator_;
 
@@ -393,7 +393,7 @@ Status Add<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.EigenInput0<T>() + per_iter_bh.EigenInput1<T>();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0f);
+  UntypedBroadcastTwo(*context, funcs, 1.0f, nullptr, &plan_cache_);
   return Status::OK();
 }
 
@@ -410,7 +410,7 @@ Status Sub<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.EigenInput0<T>() - per_iter_bh.EigenInput1<T>();
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &plan_cache_);
   return Status::OK();
 }
 
@@ -427,7 +427,7 @@ Status Mul<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.EigenInput0<T>().cwiseProduct(per_iter_bh.EigenInput1<T>());
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &plan_cache_);
   return Status::OK();
 }
 
@@ -444,7 +444,7 @@ Status Div<T>::Compute(OpKernelContext* context) const {
         per_iter_bh.OutputEigen<T>() = per_iter_bh.EigenInput0<T>().cwiseQuotient(per_iter_bh.EigenInput1<T>());
       }};
 
-  UntypedBroadcastTwo(*context, funcs, 1.0);
+  UntypedBroadcastTwo(*context, funcs, 1.0, nullptr, &plan_cache_);
   return Status::OK();
 }
 
@@ -1687,8 +1687,9 @@ Status Mod::Compute(OpKernelContext* context) const {
 // Type specific logic is plugged in via the functions in ProcessBroadcastSpanFuncs.
 // Optional user_data can be provided, and will be available to the ProcessSpanFunc implementations
 // via BroadcastHelper.GetUserData().
-void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data) {
-  InputBroadcaster input_broadcaster(*context.Input<Tensor>(0), *context.Input<Tensor>(1));
+void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data,
+                         const BroadcastPlanCache* plan_cache) {
+  InputBroadcaster input_broadcaster(*context.Input<Tensor>(0), *context.Input<Tensor>(1), plan_cache);
   OutputBroadcaster output_broadcaster(input_broadcaster.GetSpanSize(),
                                        *context.Output(0, input_broadcaster.GetOutputShape()));
   BroadcastHelper broadcast_helper(input_broadcaster, output_broadcaster, user_data);
@@ -1700,10 +1701,10 @@ void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFun
 // Operator usage is the same as the parallelization is opaque to the operator.
 // unit_cost must be a valid cost value.
 void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, double unit_cost,
-                         void* user_data) {
+                         void* user_data, const BroadcastPlanCache* plan_cache) {
   const Tensor& input0_tensor = *context.Input<Tensor>(0);
   const Tensor& input1_tensor = *context.Input<Tensor>(1);
-  InputBroadcaster input_broadcaster(input0_tensor, input1_tensor);
+  InputBroadcaster input_broadcaster(input0_tensor, input1_tensor, plan_cache);
 
   Tensor& output_tensor = *context.Output(0, input_broadcaster.GetOutputShape());
 
@@ -5,6 +5,7 @@
 
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include "core/util/math_cpuonly.h"
 #include "core/providers/cpu/element_wise_ranged_transform.h"
 
@@ -205,6 +206,231 @@ DEFINE_ELE_KERNEL(Reciprocal)
 DEFINE_ELE_KERNEL(Sqrt)
 DEFINE_ELE_KERNEL(Exp)
 
+struct BroadcastIterator {
+  size_t Current() const { return index_; }
+
+  size_t AdvanceBy(size_t delta) {
+    size_t index = index_;
+
+    index_ += deltas_[0] * delta;
+    counters_[0] += delta;
+    if (counters_[0] == counts_[0]) {
+      counters_[0] = 0;
+      for (size_t counterIndex = 1; counterIndex < counters_.size(); counterIndex++) {
+        index_ += deltas_[counterIndex];
+        if (++counters_[counterIndex] != counts_[counterIndex])
+          break;
+        counters_[counterIndex] = 0;
+      }
+    } else if (counters_[0] > counts_[0]) {  // Keep original logic above so that in most case it is faster
+      delta = counters_[0] / counts_[0];
+      counters_[0] = counters_[0] % counts_[0];
+      for (size_t counterIndex = 1; counterIndex < counters_.size(); counterIndex++) {
+        index_ += delta * deltas_[counterIndex];
+        counters_[counterIndex] += delta;
+        if (counters_[counterIndex] < counts_[counterIndex]) break;
+        delta = counters_[counterIndex] / counts_[counterIndex];
+        counters_[counterIndex] = counters_[counterIndex] % counts_[counterIndex];
+      }
+    }
+    return index;
+  }
+
+  void Reserve(ptrdiff_t max_dims) {
+    deltas_.reserve(static_cast<size_t>(max_dims));
+    counts_.reserve(static_cast<size_t>(max_dims));
+  }
+
+  void Init(ptrdiff_t axis, ptrdiff_t largest) {
+    ORT_ENFORCE(axis == 1 || axis == largest, "Attempting to broadcast an axis by a dimension other than 1. ", axis, " by ", largest);
+
+    deltas_.push_back(axis > 1);
+    counts_.push_back(largest);
+    count_ *= axis;
+  }
+
+  void Append(ptrdiff_t axis, ptrdiff_t largest) {
+    ORT_ENFORCE(axis == 1 || axis == largest, "Attempting to broadcast an axis by a dimension other than 1. ", axis, " by ", largest);
+
+    // If we're greater than 1, it doesn't matter what the other tensor does
+    if (axis > 1) {
+      if (deltas_.back() <= 0)  // Were we broadcasting
+        StopBroadcasting();
+    } else {  // We must be 1, at this point
+      if (deltas_.back() > 0)
+        StartBroadcasting();
+    }
+
+    counts_.back() *= largest;  // Just increase the last count
+    count_ *= axis;
+  }
+
+  void StopBroadcasting() {
+    deltas_.push_back(count_);
+    counts_.push_back(1);
+  }
+
+  void StartBroadcasting() {
+    deltas_.push_back(-count_);
+    counts_.push_back(1);
+  }
+
+  std::vector<ptrdiff_t> counters_;
+  std::vector<ptrdiff_t> deltas_;
+  std::vector<ptrdiff_t> counts_;
+  ptrdiff_t count_{1};  // Running total count of entries in tensor, used while building up the entries
+
+ private:
+  size_t index_{};
+};
+
+struct Broadcaster {
+  Broadcaster() = default;
+
+  Broadcaster(const std::vector<int64_t>& shape1, const std::vector<int64_t>& shape2) {
+    size_t dimension_count_max = std::max(shape1.size(), shape2.size());
+    size_t dimension_count_min = std::min(shape1.size(), shape2.size());
+    output_shape_.resize(dimension_count_max);
+    iterator1_.Reserve(dimension_count_max);
+    iterator2_.Reserve(dimension_count_max);
+
+    auto iter1 = shape1.end();
+    auto iter2 = shape2.end();
+    auto output_shape = output_shape_.end();
+
+    // Scalars are a special case, as it's always a broadcast
+    size_t index = 0;
+    if (dimension_count_min == 0) {
+      if (shape1.empty())  // Shape1 is a scalar
+      {
+        if (shape2.empty())  // Two scalars?
+        {
+          iterator1_.Init(1, 1);
+          iterator2_.Init(1, 1);
+        } else {
+          ptrdiff_t axis = static_cast<ptrdiff_t>(*--iter2);
+          iterator1_.Init(1, axis);
+          iterator2_.Init(axis, axis);
+          *--output_shape = axis;
+        }
+      } else {  // Shape2 is a scalar
+        ptrdiff_t axis = static_cast<ptrdiff_t>(*--iter1);
+        iterator1_.Init(axis, axis);
+        iterator2_.Init(1, axis);
+        *--output_shape = axis;
+      }
+      index++;  // Manually increment since we processed one axis
+    } else {
+      for (; index < dimension_count_min; index++) {
+        ptrdiff_t axis1 = static_cast<ptrdiff_t>(*--iter1);
+        ptrdiff_t axis2 = static_cast<ptrdiff_t>(*--iter2);
+
+        ptrdiff_t largest = std::max<ptrdiff_t>(axis1, axis2);
+        ptrdiff_t smallest = std::min<ptrdiff_t>(axis1, axis2);
+        ptrdiff_t dim_to_use = largest;
+
+        if (smallest == 0) {
+          ORT_ENFORCE(largest <= 1, "Can broadcast 0 by 0 or 1. ", largest, " is invalid.");
+          dim_to_use = smallest;
+        }
+
+        *--output_shape = dim_to_use;
+
+        // if both 1, or a 1 and 0, and there are more dims, we can let the next iteration do the Init
+        if (dim_to_use <= 1 && index + 1 < dimension_count_min)
+          continue;
+
+        iterator1_.Init(axis1, dim_to_use);
+        iterator2_.Init(axis2, dim_to_use);
+        index++;  // Manually increment since we processed one axis
+        break;
+      }
+    }
+
+    for (; index < dimension_count_min; index++) {
+      ptrdiff_t axis1 = static_cast<ptrdiff_t>(*--iter1);
+      ptrdiff_t axis2 = static_cast<ptrdiff_t>(*--iter2);
+
+      ptrdiff_t largest = std::max(axis1, axis2);
+      ptrdiff_t smallest = std::min(axis1, axis2);
+      ptrdiff_t dim_to_use = largest;
+
+      if (smallest == 0) {
+        ORT_ENFORCE(largest <= 1, "Can broadcast 0 by 0 or 1. ", largest, " is invalid.");
+        dim_to_use = smallest;
+      }
+
+      *--output_shape = dim_to_use;
+
+      if (largest == 1)  // Nothing to do in this case
+        continue;
+
+      iterator1_.Append(axis1, dim_to_use);
+      iterator2_.Append(axis2, dim_to_use);
+    }
+
+    // If one shape is bigger than another we need to broadcast the smaller onto the bigger from this point on
+    for (; index < dimension_count_max; index++) {
+      if (dimension_count_max == shape2.size()) {
+        ptrdiff_t axis = static_cast<ptrdiff_t>(*--iter2);
+        iterator1_.Append(1, axis);
+        iterator2_.Append(axis, axis);
+        *--output_shape = axis;
+      } else {
+        ptrdiff_t axis = static_cast<ptrdiff_t>(*--iter1);
+        iterator1_.Append(axis, axis);
+        iterator2_.Append(1, axis);
+        *--output_shape = axis;
+      }
+    }
+
+    // Allocate the counters
+    iterator1_.counters_.resize(iterator1_.counts_.size(), 0);
+    iterator2_.counters_.resize(iterator2_.counts_.size(), 0);
+  }
+
+  size_t GetSpanSize() const { return std::min(iterator1_.counts_.front(), iterator2_.counts_.front()); }
+
+  BroadcastIterator iterator1_, iterator2_;
+  std::vector<int64_t> output_shape_;
+};
+
+// Caches the collapsed stride loop plan (the canonicalized Broadcaster state) for the most recently
+// seen pair of input shapes. Binary elementwise kernels typically see the same static shapes on every
+// Compute call, so the plan can be copied instead of re-deriving the collapsed loops each time.
+class BroadcastPlanCache {
+ public:
+  // Copies the cached plan for the given shape pair into 'broadcaster', building and caching a new
+  // plan on a cache miss.
+  void GetPlan(const std::vector<int64_t>& shape0, const std::vector<int64_t>& shape1,
+               Broadcaster& broadcaster) const {
+    {
+      std::lock_guard<OrtMutex> lock(mutex_);
+      if (plan_ != nullptr && shape0 == shape0_ && shape1 == shape1_) {
+        broadcaster = *plan_;
+        return;
+      }
+    }
+
+    // Build the plan outside the lock so concurrent Compute calls with mismatched shapes don't
+    // serialize on the shape canonicalization.
+    broadcaster = Broadcaster(shape0, shape1);
+
+    {
+      std::lock_guard<OrtMutex> lock(mutex_);
+      shape0_ = shape0;
+      shape1_ = shape1;
+      plan_ = onnxruntime::make_unique<Broadcaster>(broadcaster);
+    }
+  }
+
+ private:
+  mutable OrtMutex mutex_;
+  mutable std::vector<int64_t> shape0_;
+  mutable std::vector<int64_t> shape1_;
+  mutable std::unique_ptr<Broadcaster> plan_;
+};
+
 template <typename T>
 class Add final : public OpKernel {
  public:
@@ -212,6 +438,9 @@ class Add final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  BroadcastPlanCache plan_cache_;
 };
 
 template <typename T>
@@ -221,6 +450,9 @@ class Sub final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  BroadcastPlanCache plan_cache_;
 };
 
 template <typename T>
@@ -230,6 +462,9 @@ class Mul final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  BroadcastPlanCache plan_cache_;
 };
 
 template <typename T>
@@ -239,6 +474,9 @@ class Div final : public OpKernel {
   }
 
   Status Compute(OpKernelContext* context) const override;
+
+ private:
+  BroadcastPlanCache plan_cache_;
 };
 
 class Pow final : public OpKernel {
@@ -440,204 +678,20 @@ auto MakeEigenArrayMap(const Tensor& t) -> ConstEigenVectorArrayMap<T> {
   return ConstEigenVectorArrayMap<T>(t.template Data<T>(), gsl::narrow<ptrdiff_t>(t.Shape().Size()));
 }
 
-struct BroadcastIterator {
-  size_t Current() const { return index_; }
-
-  size_t AdvanceBy(size_t delta) {
-    size_t index = index_;
-
-    index_ += deltas_[0] * delta;
-    counters_[0] += delta;
-    if (counters_[0] == counts_[0]) {
-      counters_[0] = 0;
-      for (size_t counterIndex = 1; counterIndex < counters_.size(); counterIndex++) {
-        index_ += deltas_[counterIndex];
-        if (++counters_[counterIndex] != counts_[counterIndex])
-          break;
-        counters_[counterIndex] = 0;
-      }
-    } else if (counters_[0] > counts_[0]) {  // Keep original logic above so that in most case it is faster
-      delta = counters_[0] / counts_[0];
-      counters_[0] = counters_[0] % counts_[0];
-      for (size_t counterIndex = 1; counterIndex < counters_.size(); counterIndex++) {
-        index_ += delta * deltas_[counterIndex];
-        counters_[counterIndex] += delta;
-        if (counters_[counterIndex] < counts_[counterIndex]) break;
-        delta = counters_[counterIndex] / counts_[counterIndex];
-        counters_[counterIndex] = counters_[counterIndex] % counts_[counterIndex];
-      }
-    }
-    return index;
-  }
-
-  void Reserve(ptrdiff_t max_dims) {
-    deltas_.reserve(static_cast<size_t>(max_dims));
-    counts_.reserve(static_cast<size_t>(max_dims));
-  }
-
-  void Init(ptrdiff_t axis, ptrdiff_t largest) {
-    ORT_ENFORCE(axis == 1 || axis == largest, "Attempting to broadcast an axis by a dimension other than 1. ", axis, " by ", largest);
-
-    deltas_.push_back(axis > 1);
-    counts_.push_back(largest);
-    count_ *= axis;
-  }
-
-  void Append(ptrdiff_t axis, ptrdiff_t largest) {
-    ORT_ENFORCE(axis == 1 || axis == largest, "Attempting to broadcast an axis by a dimension other than 1. ", axis, " by ", largest);
-
-    // If we're greater than 1, it doesn't matter what the other tensor does
-    if (axis > 1) {
-      if (deltas_.back() <= 0)  // Were we broadcasting
-        StopBroadcasting();
-    } else {  // We must be 1, at this point
-      if (deltas_.back() > 0)
-        StartBroadcasting();
-    }
-
-    counts_.back() *= largest;  // Just increase the last count
-    count_ *= axis;
-  }
-
-  void StopBroadcasting() {
-    deltas_.push_back(count_);
-    counts_.push_back(1);
-  }
-
-  void StartBroadcasting() {
-    deltas_.push_back(-count_);
-    counts_.push_back(1);
-  }
-
-  std::vector<ptrdiff_t> counters_;
-  std::vector<ptrdiff_t> deltas_;
-  std::vector<ptrdiff_t> counts_;
-  ptrdiff_t count_{1};  // Running total count of entries in tensor, used while building up the entries
-
- private:
-  size_t index_{};
-};
-
-struct Broadcaster {
-  Broadcaster(const std::vector<int64_t>& shape1, const std::vector<int64_t>& shape2) {
-    size_t dimension_count_max = std::max(shape1.size(), shape2.size());
-    size_t dimension_count_min = std::min(shape1.size(), shape2.size());
-    output_shape_.resize(dimension_count_max);
-    iterator1_.Reserve(dimension_count_max);
-    iterator2_.Reserve(dimension_count_max);
-
-    auto iter1 = shape1.end();
-    auto iter2 = shape2.end();
-    auto output_shape = output_shape_.end();
-
-    // Scalars are a special case, as it's always a broadcast
-    size_t index = 0;
-    if (dimension_count_min == 0) {
-      if (shape1.empty())  // Shape1 is a scalar
-      {
-        if (shape2.empty())  // Two scalars?
-        {
-          iterator1_.Init(1, 1);
-          iterator2_.Init(1, 1);
-        } else {
-          ptrdiff_t axis = static_cast<ptrdiff_t>(*--iter2);
-          iterator1_.Init(1, axis);
-          iterator2_.Init(axis, axis);
-          *--output_shape = axis;
-        }
-      } else {  // Shape2 is a scalar
-        ptrdiff_t axis = static_cast<ptrdiff_t>(*--iter1);
-        iterator1_.Init(axis, axis);
-        iterator2_.Init(1, axis);
-        *--output_shape = axis;
-      }
-      index++;  // Manually increment since we processed one axis
-    } else {
-      for (; index < dimension_count_min; index++) {
-        ptrdiff_t axis1 = static_cast<ptrdiff_t>(*--iter1);
-        ptrdiff_t axis2 = static_cast<ptrdiff_t>(*--iter2);
-
-        ptrdiff_t largest = std::max<ptrdiff_t>(axis1, axis2);
-        ptrdiff_t smallest = std::min<ptrdiff_t>(axis1, axis2);
-        ptrdiff_t dim_to_use = largest;
-
-        if (smallest == 0) {
-          ORT_ENFORCE(largest <= 1, "Can broadcast 0 by 0 or 1. ", largest, " is invalid.");
-          dim_to_use = smallest;
-        }
-
-        *--output_shape = dim_to_use;
-
-        // if both 1, or a 1 and 0, and there are more dims, we can let the next iteration do the Init
-        if (dim_to_use <= 1 && index + 1 < dimension_count_min)
-          continue;
-
-        iterator1_.Init(axis1, dim_to_use);
-        iterator2_.Init(axis2, dim_to_use);
-        index++;  // Manually increment since we processed one axis
-        break;
-      }
-    }
-
-    for (; index < dimension_count_min; index++) {
-      ptrdiff_t axis1 = static_cast<ptrdiff_t>(*--iter1);
-      ptrdiff_t axis2 = static_cast<ptrdiff_t>(*--iter2);
-
-      ptrdiff_t largest = std::max(axis1, axis2);
-      ptrdiff_t smallest = std::min(axis1, axis2);
-      ptrdiff_t dim_to_use = largest;
-
-      if (smallest == 0) {
-        ORT_ENFORCE(largest <= 1, "Can broadcast 0 by 0 or 1. ", largest, " is invalid.");
-        dim_to_use = smallest;
-      }
-
-      *--output_shape = dim_to_use;
-
-      if (largest == 1)  // Nothing to do in this case
-        continue;
-
-      iterator1_.Append(axis1, dim_to_use);
-      iterator2_.Append(axis2, dim_to_use);
-    }
-
-    // If one shape is bigger than another we need to broadcast the smaller onto the bigger from this point on
-    for (; index < dimension_count_max; index++) {
-      if (dimension_count_max == shape2.size()) {
-        ptrdiff_t axis = static_cast<ptrdiff_t>(*--iter2);
-        iterator1_.Append(1, axis);
-        iterator2_.Append(axis, axis);
-        *--output_shape = axis;
-      } else {
-        ptrdiff_t axis = static_cast<ptrdiff_t>(*--iter1);
-        iterator1_.Append(axis, axis);
-        iterator2_.Append(1, axis);
-        *--output_shape = axis;
-      }
-    }
-
-    // Allocate the counters
-    iterator1_.counters_.resize(iterator1_.counts_.size(), 0);
-    iterator2_.counters_.resize(iterator2_.counts_.size(), 0);
-  }
-
-  size_t GetSpanSize() const { return std::min(iterator1_.counts_.front(), iterator2_.counts_.front()); }
-
-  BroadcastIterator iterator1_, iterator2_;
-  std::vector<int64_t> output_shape_;
-};
-
 struct InputBroadcaster {
-  InputBroadcaster(const Tensor& input0, const Tensor& input1)
+  InputBroadcaster(const Tensor& input0, const Tensor& input1, const BroadcastPlanCache* plan_cache = nullptr)
       : input_tensor0_(input0),
         input_tensor1_(&input1),
         input_tensor1_shape_(input1.Shape()) {
+    InitBroadcaster(plan_cache);
   }
 
-  InputBroadcaster(const Tensor& input0, const TensorShape& input1_shape)
+  InputBroadcaster(const Tensor& input0, const TensorShape& input1_shape,
+                   const BroadcastPlanCache* plan_cache = nullptr)
       : input_tensor0_(input0),
         input_tensor1_(nullptr),
         input_tensor1_shape_(input1_shape) {
+    InitBroadcaster(plan_cache);
   }
 
   void AdvanceBy(size_t offset) {
@@ -696,6 +750,16 @@ struct InputBroadcaster {
   }
 
  private:
+  void InitBroadcaster(const BroadcastPlanCache* plan_cache) {
+    if (plan_cache != nullptr) {
+      plan_cache->GetPlan(input_tensor0_.Shape().GetDims(), input_tensor1_shape_.GetDims(), broadcaster_);
+    } else {
+      broadcaster_ = Broadcaster(input_tensor0_.Shape().GetDims(), input_tensor1_shape_.GetDims());
+    }
+
+    span_size_ = broadcaster_.GetSpanSize();
+  }
+
   const Tensor& input_tensor0_;
   // need to support use case where input1 is just the shape for Expand op
   const Tensor* input_tensor1_{nullptr};
@@ -705,8 +769,8 @@ struct InputBroadcaster {
   const void* input0_bytes_{input_tensor0_.DataRaw()};
   const void* input1_bytes_{input_tensor1_ ? input_tensor1_->DataRaw() : nullptr};
 
-  Broadcaster broadcaster_{input_tensor0_.Shape().GetDims(), input_tensor1_shape_.GetDims()};
-  size_t span_size_{broadcaster_.GetSpanSize()};
+  Broadcaster broadcaster_;
+  size_t span_size_{0};
 };
 
 struct OutputBroadcaster {
@@ -910,14 +974,17 @@ static void ParallelizeSingleSpan(TBroadcastHelper& helper, const ProcessBroadca
 // Type specific logic is plugged in via the functions in ProcessBroadcastSpanFuncs.
 // Optional user_data can be provided, and will be available to the ProcessSpanFunc implementations
 // via BroadcastHelper.GetUserData().
-void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data = nullptr);
+void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, void* user_data = nullptr,
+                         const BroadcastPlanCache* plan_cache = nullptr);
 
 // Broadcast two inputs with parallelization.
 //
 // Operator usage is the same as the parallelization is opaque to the operator.
 // unit_cost must be a valid cost value.
+// An optional BroadcastPlanCache owned by the kernel lets repeated calls with static shapes reuse
+// the collapsed stride loop plan.
 void UntypedBroadcastTwo(OpKernelContext& context, const ProcessBroadcastSpanFuncs& funcs, double unit_cost,
-                         void* user_data = nullptr);
+                         void* user_data = nullptr, const BroadcastPlanCache* plan_cache = nullptr);
 
 // Helper to provide the looping logic with optimization for parallelizing within a single span if the
 // TBroadcastHelper instance was setup to enable that.
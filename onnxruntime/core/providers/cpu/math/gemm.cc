@@ -102,6 +102,43 @@ bool GemmPackBFp32(const OpKernelInfo& info,
   return true;
 }
 
+bool GemmSparsePackBFp32(const OpKernelInfo& info,
+                         const Tensor& tensor_b,
+                         bool trans_b,
+                         BufferUniquePtr& packed_b,
+                         TensorShape& b_shape) {
+  // Only handle the common case of a 2D weight matrix. Additional matrices
+  // could be handled by stacking the packed buffers.
+  if (tensor_b.Shape().NumDimensions() != 2) {
+    return false;
+  }
+
+  const size_t K = trans_b ? static_cast<size_t>(tensor_b.Shape()[1]) : static_cast<size_t>(tensor_b.Shape()[0]);
+  const size_t N = trans_b ? static_cast<size_t>(tensor_b.Shape()[0]) : static_cast<size_t>(tensor_b.Shape()[1]);
+  const size_t ldb = trans_b ? K : N;
+
+  // MlasSparseGemmPackBSize scans the matrix contents and returns 0 unless
+  // the density is low enough for the sparse kernels to beat dense MlasGemm.
+  const size_t packed_b_size = MlasSparseGemmPackBSize(trans_b ? CblasTrans : CblasNoTrans,
+                                                       N, K, tensor_b.Data<float>(), ldb);
+  if (packed_b_size == 0) {
+    return false;
+  }
+
+  b_shape = tensor_b.Shape();
+
+  auto alloc = info.GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_b_data = alloc->Alloc(packed_b_size);
+  packed_b = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
+  MlasSparseGemmPackB(trans_b ? CblasTrans : CblasNoTrans,
+                      N,
+                      K,
+                      tensor_b.Data<float>(),
+                      ldb,
+                      packed_b_data);
+  return true;
+}
+
 template <typename T>
 static void GemmBroadcastBias(int64_t M, int64_t N, float beta,
                               const T* c_data, const TensorShape* c_shape,
@@ -175,7 +212,9 @@ Status Gemm<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_packed
 
   // only pack Matrix B
   if (input_idx == 1) {
-    is_packed = GemmPackBFp32(Info(), tensor, trans_B_ != CblasNoTrans, packed_b_, b_shape_);
+    packed_b_is_sparse_ = GemmSparsePackBFp32(Info(), tensor, trans_B_ != CblasNoTrans, packed_b_, b_shape_);
+    is_packed = packed_b_is_sparse_ ||
+                GemmPackBFp32(Info(), tensor, trans_B_ != CblasNoTrans, packed_b_, b_shape_);
   }
   return Status::OK();
 }
@@ -268,19 +307,35 @@ Status Gemm<float>::Compute(OpKernelContext* context) const {
                 c_data, c_shape, y_data, thread_pool);
   } else {
     GemmBroadcastBias(M, N, beta_, c_data, c_shape, y_data);
-    MlasGemm(
-        trans_A_,
-        static_cast<size_t>(M),
-        static_cast<size_t>(N),
-        static_cast<size_t>(K),
-        alpha_,
-        A->Data<float>(),
-        static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K),
-        packed_b_.get(),
-        c_data != nullptr ? beta_ : 0.0f,
-        y_data,
-        static_cast<size_t>(N),
-        thread_pool);
+    if (packed_b_is_sparse_) {
+      MlasSparseGemm(
+          trans_A_,
+          static_cast<size_t>(M),
+          static_cast<size_t>(N),
+          static_cast<size_t>(K),
+          alpha_,
+          A->Data<float>(),
+          static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K),
+          packed_b_.get(),
+          c_data != nullptr ? beta_ : 0.0f,
+          y_data,
+          static_cast<size_t>(N),
+          thread_pool);
+    } else {
+      MlasGemm(
+          trans_A_,
+          static_cast<size_t>(M),
+          static_cast<size_t>(N),
+          static_cast<size_t>(K),
+          alpha_,
+          A->Data<float>(),
+          static_cast<size_t>(trans_A_ != CblasNoTrans ? M : K),
+          packed_b_.get(),
+          c_data != nullptr ? beta_ : 0.0f,
+          y_data,
+          static_cast<size_t>(N),
+          thread_pool);
+    }
   }
 
   ComputeActivation(y_data, M * N, thread_pool);
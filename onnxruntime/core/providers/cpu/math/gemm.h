@@ -47,6 +47,9 @@ class Gemm : public OpKernel {
  protected:
   TensorShape b_shape_;
   BufferUniquePtr packed_b_;
+  // True when packed_b_ holds the MLAS block sparse format instead of the
+  // dense packed format.
+  bool packed_b_is_sparse_ = false;
 
   // For fused gemm + activation
   std::unique_ptr<functors::ElementWiseRangedTransform<T>> activation_;
@@ -13,4 +13,12 @@ bool GemmPackBFp32(const OpKernelInfo& info,
                    BufferUniquePtr& packed_b,
                    TensorShape& b_shape);
 
+// Packs B to the MLAS block sparse format when enough of the matrix was
+// pruned to zero for the sparse kernels to win. Returns false otherwise.
+bool GemmSparsePackBFp32(const OpKernelInfo& info,
+                         const Tensor& tensor_b,
+                         bool trans_b,
+                         BufferUniquePtr& packed_b,
+                         TensorShape& b_shape);
+
 };  // namespace onnxruntime
@@ -59,6 +59,14 @@ ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
         .TypeConstraint("T", BuildKernelDefConstraints<int64_t, uint64_t>()),
     MatMul<int64_t>);
 
+ONNX_CPU_OPERATOR_VERSIONED_TYPED_KERNEL(
+    MatMul,
+    9,
+    12,
+    MLFloat16,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<MLFloat16>()),
+    MatMul<MLFloat16>);
+
 ONNX_CPU_OPERATOR_TYPED_KERNEL(
     MatMul,
     13,
@@ -89,6 +97,13 @@ ONNX_CPU_OPERATOR_TYPED_KERNEL(
         .TypeConstraint("T", BuildKernelDefConstraints<int64_t, uint64_t>()),
     MatMul<int64_t>);
 
+ONNX_CPU_OPERATOR_TYPED_KERNEL(
+    MatMul,
+    13,
+    MLFloat16,
+    KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<MLFloat16>()),
+    MatMul<MLFloat16>);
+
 template <typename T>
 Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
@@ -126,12 +141,103 @@ Status MatMul<T>::Compute(OpKernelContext* ctx) const {
   return Status::OK();
 }
 
+template <>
+Status MatMul<MLFloat16>::Compute(OpKernelContext* ctx) const {
+  concurrency::ThreadPool* thread_pool = ctx->GetOperatorThreadPool();
+
+  const auto* a = ctx->Input<Tensor>(0);
+  const auto* b = ctx->Input<Tensor>(1);
+
+  MatMulComputeHelper helper;
+  ORT_RETURN_IF_ERROR(helper.Compute(a->Shape(), b->Shape()));
+  Tensor* y = ctx->Output(0, helper.OutputShape());
+
+  // Bail out early if the output is going to be empty
+  if (y->Shape().Size() == 0)
+    return Status::OK();
+
+  const auto* a_data = reinterpret_cast<const uint16_t*>(a->Data<MLFloat16>());
+  const auto* b_data = reinterpret_cast<const uint16_t*>(b->Data<MLFloat16>());
+  auto* y_data = reinterpret_cast<uint16_t*>(y->MutableData<MLFloat16>());
+
+  size_t max_len = helper.OutputOffsets().size();
+  for (size_t i = 0; i < max_len; i++) {
+    MlasHalfGemm(
+        static_cast<size_t>(helper.M()),
+        static_cast<size_t>(helper.N()),
+        static_cast<size_t>(helper.K()),
+        a_data + helper.LeftOffsets()[i],
+        static_cast<size_t>(helper.K()),
+        b_data + helper.RightOffsets()[i],
+        static_cast<size_t>(helper.N()),
+        y_data + helper.OutputOffsets()[i],
+        static_cast<size_t>(helper.N()),
+        thread_pool);
+  }
+
+  return Status::OK();
+}
+
+// Packs a constant B with more than two dimensions by stacking the packed form
+// of every trailing [K, N] slice, covering the batched weights that the 2-D-only
+// GemmPackBFp32 declines.
+static bool PackBatchedBFp32(const OpKernelInfo& info,
+                             const Tensor& tensor_b,
+                             bool trans_b,
+                             BufferUniquePtr& packed_b,
+                             TensorShape& b_shape,
+                             size_t& packed_b_stride,
+                             size_t& b_matrix_size) {
+  const auto& shape = tensor_b.Shape();
+  const size_t num_dims = shape.NumDimensions();
+  if (num_dims < 3) {
+    return false;
+  }
+
+  const size_t K = static_cast<size_t>(trans_b ? shape[num_dims - 1] : shape[num_dims - 2]);
+  const size_t N = static_cast<size_t>(trans_b ? shape[num_dims - 2] : shape[num_dims - 1]);
+
+  const size_t packed_slice_size = MlasGemmPackBSize(N, K);
+  if (packed_slice_size == 0) {
+    return false;
+  }
+
+  const size_t num_slices = static_cast<size_t>(shape.SizeToDimension(num_dims - 2));
+  const size_t slice_size = K * N;
+  if (num_slices == 0 || slice_size == 0) {
+    return false;
+  }
+
+  auto alloc = info.GetAllocator(0, OrtMemTypeDefault);
+  auto* packed_b_data = alloc->Alloc(packed_slice_size * num_slices);
+  packed_b = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
+
+  const float* b_data = tensor_b.Data<float>();
+  for (size_t i = 0; i < num_slices; ++i) {
+    MlasGemmPackB(trans_b ? CblasTrans : CblasNoTrans,
+                  N,
+                  K,
+                  b_data + i * slice_size,
+                  trans_b ? K : N,
+                  static_cast<uint8_t*>(packed_b_data) + i * packed_slice_size);
+  }
+
+  b_shape = shape;
+  packed_b_stride = packed_slice_size;
+  b_matrix_size = slice_size;
+  return true;
+}
+
 Status MatMul<float>::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
   is_packed = false;
 
   // only pack Matrix B
   if (input_idx == 1) {
-    is_packed = GemmPackBFp32(Info(), tensor, trans_b_attr_, packed_b_, b_shape_);
+    packed_b_is_sparse_ = GemmSparsePackBFp32(Info(), tensor, trans_b_attr_ != 0, packed_b_, b_shape_);
+    is_packed = packed_b_is_sparse_ ||
+                GemmPackBFp32(Info(), tensor, trans_b_attr_, packed_b_, b_shape_) ||
+                PackBatchedBFp32(Info(), tensor, trans_b_attr_ != 0, packed_b_, b_shape_,
+                                 packed_b_stride_, b_matrix_size_);
   }
   return Status::OK();
 }
@@ -159,10 +265,59 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
   const auto* b_data = b ? b->Data<float>() : nullptr;
   auto* y_data = y->MutableData<float>();
 
+  // FusedMatMul carries an optional residual input with exactly the output shape;
+  // it is accumulated by the GEMM epilogue while each output tile is still hot in
+  // the cache instead of by a separate whole-tensor Add pass.
+  const Tensor* residual = ctx->Input<Tensor>(2);
+  if (residual != nullptr && residual->Shape() != y->Shape()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "FusedMatMul residual input C must have the same shape as output Y");
+  }
+  const float* residual_data = residual != nullptr ? residual->Data<float>() : nullptr;
+
+  MLAS_ACTIVATION identity_activation;
+  identity_activation.ActivationKind = MlasIdentityActivation;
+
   // TODO: replace it with GemmBatch for performance, it's OK for now as GemmBatch unrolls as well
   size_t max_len = helper.OutputOffsets().size();
   for (size_t i = 0; i < max_len; i++) {
+    const MLAS_SGEMM_ACTIVATION_OUTPUT_PROCESSOR residual_processor(
+        &identity_activation, nullptr,
+        residual_data != nullptr ? residual_data + helper.OutputOffsets()[i] : nullptr,
+        static_cast<size_t>(helper.N()));
+    const MLAS_SGEMM_OUTPUT_PROCESSOR* output_processor =
+        residual_data != nullptr ? &residual_processor : nullptr;
     if (packed_b_) {
+      if (packed_b_is_sparse_) {
+        MlasSparseGemm(
+            trans_a ? CblasTrans : CblasNoTrans,
+            static_cast<size_t>(helper.M()),
+            static_cast<size_t>(helper.N()),
+            static_cast<size_t>(helper.K()),
+            alpha_attr_,
+            a_data + helper.LeftOffsets()[i],
+            static_cast<size_t>(trans_a ? helper.M() : helper.K()),
+            packed_b_.get(),
+            0.0f,
+            y_data + helper.OutputOffsets()[i],
+            static_cast<size_t>(helper.N()),
+            thread_pool);
+        // the sparse kernels have no epilogue hook, so apply the residual to the
+        // completed output slice through the same processor
+        if (residual_data != nullptr) {
+          residual_processor.Process(y_data + helper.OutputOffsets()[i], 0, 0,
+                                     static_cast<size_t>(helper.M()),
+                                     static_cast<size_t>(helper.N()),
+                                     static_cast<size_t>(helper.N()));
+        }
+        continue;
+      }
+      // for a batched packed B, map the broadcast helper's offset into the
+      // original B back to its stacked packed slice
+      const auto* packed_b_data = static_cast<const uint8_t*>(packed_b_.get());
+      if (b_matrix_size_ != 0) {
+        packed_b_data += helper.RightOffsets()[i] / b_matrix_size_ * packed_b_stride_;
+      }
       MlasGemm(
           trans_a ? CblasTrans : CblasNoTrans,
           static_cast<size_t>(helper.M()),
@@ -171,25 +326,30 @@ Status MatMul<float>::Compute(OpKernelContext* ctx) const {
           alpha_attr_,
           a_data + helper.LeftOffsets()[i],
           static_cast<size_t>(trans_a ? helper.M() : helper.K()),
-          packed_b_.get(),
+          packed_b_data,
           0.0f,
           y_data + helper.OutputOffsets()[i],
           static_cast<size_t>(helper.N()),
-          thread_pool);
+          thread_pool,
+          output_processor);
       continue;
     }
-    math::Gemm<float, concurrency::ThreadPool>(
+    MlasGemm(
         trans_a ? CblasTrans : CblasNoTrans,
         trans_b ? CblasTrans : CblasNoTrans,
-        helper.M(),
-        helper.N(),
-        helper.K(),
+        static_cast<size_t>(helper.M()),
+        static_cast<size_t>(helper.N()),
+        static_cast<size_t>(helper.K()),
         alpha_attr_,
         a_data + helper.LeftOffsets()[i],
+        static_cast<size_t>(trans_a ? helper.M() : helper.K()),
         b_data + helper.RightOffsets()[i],
+        static_cast<size_t>(trans_b ? helper.K() : helper.N()),
         0.0f,
         y_data + helper.OutputOffsets()[i],
-        thread_pool);
+        static_cast<size_t>(helper.N()),
+        thread_pool,
+        output_processor);
   }
 
   return Status::OK();
@@ -15,6 +15,11 @@ class MatMul final : public OpKernel {
   Status Compute(OpKernelContext* context) const override;
 };
 
+// The half precision kernel runs natively on processors with fp16 arithmetic
+// support and through a single precision fallback elsewhere.
+template <>
+Status MatMul<MLFloat16>::Compute(OpKernelContext* context) const;
+
 template <>
 class MatMul<float> final : public OpKernel {
  public:
@@ -31,6 +36,16 @@ class MatMul<float> final : public OpKernel {
  private:
   TensorShape b_shape_;
   BufferUniquePtr packed_b_;
+  // True when packed_b_ holds the MLAS block sparse format instead of the
+  // dense packed format.
+  bool packed_b_is_sparse_ = false;
+
+  // Set when packed_b_ holds a stack of packed 2-D slices of a batched B.
+  // packed_b_stride_ is the byte size of one packed slice and b_matrix_size_
+  // the element count of one original slice (used to map a B offset from the
+  // broadcast helper back to its slice).
+  size_t packed_b_stride_ = 0;
+  size_t b_matrix_size_ = 0;
 
   // For FusedMatMul and TransposeMatMul contrib ops
   float alpha_attr_;
@@ -173,6 +173,72 @@ static void FindTopKElements(const Tensor* input, const TensorShape& input_shape
   int64_t threads_needed = static_cast<int64_t>(std::floor(input_shape.Size() * k / (128 * 1024)));
   num_threads = std::max(std::min(threads_needed, num_threads), static_cast<int64_t>(1));
 
+  // For a small number of selections over a very long axis (e.g. retrieval workloads with one
+  // row, millions of candidates and a small k), the row-level parallelism below leaves most
+  // threads idle. Pre-filter the axis in parallel instead: each thread heap-selects the top k
+  // of its partition, and only the partitions * k surviving candidates go through the final
+  // selection and sort.
+  if (k != 1 && rows * block_slice < tp_threads) {
+    constexpr int64_t min_partition_size = 64 * 1024;
+    const int64_t partitions = std::min({tp_threads, num_blocks / min_partition_size,
+                                         num_blocks / static_cast<int64_t>(k)});
+
+    if (partitions > 1) {
+      Comparator comparer(input_data);
+      std::vector<int64_t> candidates(partitions * k);
+      int64_t* candidates_data = candidates.data();
+
+      for (int64_t i = 0; i < rows; ++i) {
+        const auto row_offset = i * cols;
+
+        for (int64_t j = 0; j < block_slice; ++j) {
+          concurrency::ThreadPool::TrySimpleParallelFor(
+              threadpool, partitions,
+              [partitions, num_blocks, k, row_offset, j, block_slice, input_data, candidates_data,
+               comparer](std::ptrdiff_t p) {
+                auto work = concurrency::ThreadPool::PartitionWork(p, partitions, num_blocks);
+                int64_t* indices = candidates_data + p * k;
+
+                // seed the heap with the first k elements of the partition. partitions is capped
+                // at num_blocks / k, so every partition holds at least k elements.
+                auto cur_idx = row_offset + work.start * block_slice + j;
+                for (unsigned l = 0; l < k; ++l) {
+                  indices[k - l - 1] = cur_idx;
+                  HeapifyIthPosition(indices, k - l - 1, k, comparer);
+                  cur_idx += block_slice;
+                }
+
+                // insert remainder if the next value would replace the top of the heap
+                auto top = input_data[indices[0]];
+                for (int64_t l = static_cast<int64_t>(work.start) + k; l < work.end; ++l) {
+                  if (comparer.CompareValueOnly(input_data[cur_idx], top)) {
+                    indices[0] = cur_idx;
+                    HeapifyIthPosition(indices, 0, k, comparer);
+                    top = input_data[indices[0]];
+                  }
+                  cur_idx += block_slice;
+                }
+              });
+
+          // merge: the candidate pool is only partitions * k entries, so a full sort is cheap
+          // and produces the sorted output directly
+          std::sort(candidates.begin(), candidates.end(), comparer);
+
+          for (unsigned l = 0; l < k; ++l) {
+            int64_t idx = candidates[l];
+            auto col_index = l * block_slice + j;
+            values_map(i, col_index) = input_data[idx];
+            // convert overall index to result index. avoid '/' if possible for perf reasons
+            indices_map(i, col_index) = block_slice == 1 ? (idx - row_offset - j)
+                                                         : (idx - row_offset - j) / block_slice;
+          }
+        }
+      }
+
+      return;
+    }
+  }
+
   // from testing various batch sizes relative to k, the following appears to work well as a selector.
   // tested with following combinations
   //   batch_size = [ 8, 16, 32, 64, 128, 256, 512, 1024, 2048 ]
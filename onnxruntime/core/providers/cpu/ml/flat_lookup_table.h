@@ -0,0 +1,169 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/framework/murmurhash3.h"
+
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+#include <intrin.h>
+#endif
+
+namespace onnxruntime {
+namespace ml {
+
+inline uint32_t FlatTableHash(const std::string& key) {
+  uint32_t hash;
+  MurmurHash3::x86_32(key.data(), static_cast<int>(key.size()), 0, &hash);
+  return hash;
+}
+
+inline uint32_t FlatTableHash(int64_t key) {
+  uint32_t hash;
+  MurmurHash3::x86_32(&key, sizeof(key), 0, &hash);
+  return hash;
+}
+
+inline uint32_t FlatTableHash(float key) {
+  // canonicalize -0.0f so it hashes the same as 0.0f, which it compares equal to
+  if (key == 0.f) key = 0.f;
+  uint32_t hash;
+  MurmurHash3::x86_32(&key, sizeof(key), 0, &hash);
+  return hash;
+}
+
+inline void PrefetchForRead(const void* address) {
+#if defined(_MSC_VER) && (defined(_M_AMD64) || defined(_M_IX86))
+  _mm_prefetch(reinterpret_cast<const char*>(address), _MM_HINT_T0);
+#elif defined(__GNUC__)
+  __builtin_prefetch(address, 0 /*read*/, 3 /*high temporal locality*/);
+#else
+  ORT_UNUSED_PARAMETER(address);
+#endif
+}
+
+// Immutable-after-construction hash table with a flat bucket array, built once
+// over an attribute vocabulary and then probed per input element. Open
+// addressing with linear probing at a load factor of at most 0.5 keeps probe
+// chains short, and storing the full hash next to each slot rejects most
+// collisions without touching the key storage.
+//
+// Duplicate keys overwrite the previously inserted value, matching the
+// behavior of assigning into a std::unordered_map.
+template <typename TKey, typename TValue>
+class FlatLookupTable {
+ public:
+  FlatLookupTable() = default;
+
+  void Reserve(size_t num_entries) {
+    keys_.reserve(num_entries);
+    values_.reserve(num_entries);
+    if (num_entries > 0) {
+      Rehash(BucketCountFor(num_entries));
+    }
+  }
+
+  void Insert(const TKey& key, const TValue& value) {
+    if ((keys_.size() + 1) * 2 > buckets_.size()) {
+      Rehash(BucketCountFor(keys_.size() + 1));
+    }
+
+    const uint32_t hash = FlatTableHash(key);
+    const size_t slot = FindSlot(hash, key);
+    if (buckets_[slot].index < 0) {
+      buckets_[slot] = {hash, static_cast<int32_t>(keys_.size())};
+      keys_.push_back(key);
+      values_.push_back(value);
+    } else {
+      values_[buckets_[slot].index] = value;
+    }
+  }
+
+  const TValue* Find(const TKey& key, uint32_t hash) const {
+    if (buckets_.empty()) {
+      return nullptr;
+    }
+
+    const size_t slot = FindSlot(hash, key);
+    return buckets_[slot].index < 0 ? nullptr : &values_[buckets_[slot].index];
+  }
+
+  const TValue* Find(const TKey& key) const {
+    return Find(key, FlatTableHash(key));
+  }
+
+  // Maps input[0..count) into output[0..count), writing missing_value for keys
+  // that are not in the table. Elements are processed in small batches: the
+  // batch is hashed first with a prefetch of each home bucket, so the cache
+  // misses on the bucket array overlap instead of serializing per element.
+  void Lookup(const TKey* input, TValue* output, std::ptrdiff_t count, const TValue& missing_value) const {
+    constexpr std::ptrdiff_t kBatchSize = 16;
+    uint32_t hashes[kBatchSize];
+
+    for (std::ptrdiff_t base = 0; base < count; base += kBatchSize) {
+      const std::ptrdiff_t batch = std::min(kBatchSize, count - base);
+      for (std::ptrdiff_t i = 0; i < batch; ++i) {
+        hashes[i] = FlatTableHash(input[base + i]);
+        if (!buckets_.empty()) {
+          PrefetchForRead(&buckets_[hashes[i] & bucket_mask_]);
+        }
+      }
+
+      for (std::ptrdiff_t i = 0; i < batch; ++i) {
+        const TValue* found = Find(input[base + i], hashes[i]);
+        output[base + i] = found != nullptr ? *found : missing_value;
+      }
+    }
+  }
+
+ private:
+  struct Bucket {
+    uint32_t hash;
+    int32_t index;  // index into keys_/values_, or -1 when the slot is empty
+  };
+
+  static size_t BucketCountFor(size_t num_entries) {
+    size_t bucket_count = 8;
+    while (bucket_count < num_entries * 2) {
+      bucket_count *= 2;
+    }
+    return bucket_count;
+  }
+
+  // returns the slot holding 'key', or the empty slot where it would be inserted
+  size_t FindSlot(uint32_t hash, const TKey& key) const {
+    size_t slot = hash & bucket_mask_;
+    while (buckets_[slot].index >= 0 &&
+           (buckets_[slot].hash != hash || keys_[buckets_[slot].index] != key)) {
+      slot = (slot + 1) & bucket_mask_;
+    }
+    return slot;
+  }
+
+  void Rehash(size_t new_bucket_count) {
+    buckets_.assign(new_bucket_count, {0, -1});
+    bucket_mask_ = new_bucket_count - 1;
+
+    for (size_t i = 0; i < keys_.size(); ++i) {
+      const uint32_t hash = FlatTableHash(keys_[i]);
+      size_t slot = hash & bucket_mask_;
+      while (buckets_[slot].index >= 0) {
+        slot = (slot + 1) & bucket_mask_;
+      }
+      buckets_[slot] = {hash, static_cast<int32_t>(i)};
+    }
+  }
+
+  std::vector<Bucket> buckets_;
+  size_t bucket_mask_{0};
+  std::vector<TKey> keys_;
+  std::vector<TValue> values_;
+};
+
+}  // namespace ml
+}  // namespace onnxruntime
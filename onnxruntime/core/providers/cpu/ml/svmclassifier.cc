@@ -69,6 +69,14 @@ SVMClassifier::SVMClassifier(const OpKernelInfo& info)
   ORT_ENFORCE(coefficients_.size() > 0);
   weights_are_all_positive_ = std::all_of(coefficients_.cbegin(), coefficients_.cend(),
                                           [](float value) { return value >= 0.f; });
+
+  // pack the matrix every Compute call multiplies against: the support vectors in SVC mode,
+  // the per-class coefficients in liblinear mode
+  if (mode_ == SVM_TYPE::SVM_SVC) {
+    PackKernelMatrixB(info, support_vectors_, vector_count_, feature_count_);
+  } else {
+    PackKernelMatrixB(info, coefficients_, class_count_, feature_count_);
+  }
 }
 
 template <typename LabelType>
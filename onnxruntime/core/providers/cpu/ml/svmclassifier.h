@@ -30,6 +30,35 @@ class SVMCommon {
   void set_kernel_type(KERNEL new_kernel_type) { kernel_type_ = new_kernel_type; }
   KERNEL get_kernel_type() const { return kernel_type_; }
 
+  // Packs the B operand of batched_kernel_dot (support vectors or linear coefficients) into
+  // MLAS's internal SGEMM layout once at kernel construction, so every Compute call skips the
+  // repacking MlasGemm otherwise performs per call. Also caches the per-row squared norms that
+  // let the RBF kernel be evaluated as one GEMM over the same packed matrix.
+  void PackKernelMatrixB(const OpKernelInfo& info, const std::vector<float>& b, int64_t n, int64_t k) {
+    if (n <= 0 || k <= 0 || b.size() != static_cast<size_t>(n * k)) {
+      return;
+    }
+
+    b_norms_.resize(static_cast<size_t>(n));
+    for (int64_t j = 0; j < n; ++j) {
+      b_norms_[j] = ConstEigenVectorMap<float>(b.data() + j * k, k).squaredNorm();
+    }
+
+    const size_t packed_b_size = MlasGemmPackBSize(static_cast<size_t>(n), static_cast<size_t>(k));
+    if (packed_b_size == 0) {
+      return;  // shape not supported by the packed kernels; the unpacked GEMM path is used
+    }
+
+    auto alloc = info.GetAllocator(0, OrtMemTypeDefault);
+    auto* packed_b_data = alloc->Alloc(packed_b_size);
+    packed_b_ = BufferUniquePtr(packed_b_data, BufferDeleter(alloc));
+    // B is applied transposed (out = A * B^T), so in GEMM terms it is an n x k matrix with ldb = k
+    MlasGemmPackB(CblasTrans, static_cast<size_t>(n), static_cast<size_t>(k),
+                  b.data(), static_cast<size_t>(k), packed_b_data);
+    packed_b_rows_ = n;
+    packed_b_cols_ = k;
+  }
+
   template <typename T>
   void batched_kernel_dot(const gsl::span<const T> a, const gsl::span<const T> b,
                           int64_t m, int64_t n, int64_t k,
@@ -39,27 +68,53 @@ class SVMCommon {
     assert(a.size() == size_t(m * k) && b.size() == size_t(k * n) && out.size() == size_t(m * n));
 
     if (kernel_type_ == KERNEL::RBF) {
-      T* cur_out = out.data();
-      const T* cur_batch = a.data();
+      if (b_norms_.size() == static_cast<size_t>(n)) {
+        // ||x - s||^2 = ||x||^2 + ||s||^2 - 2 * x.s, so the pairwise terms come from a single
+        // GEMM over the (packed) support vectors instead of a scalar loop per sample and vector
+        if (has_packed_b(n, k)) {
+          packed_gemm(m, n, k, static_cast<T>(2 * gamma_), a.data(), static_cast<T>(0), out.data(),
+                      threadpool);
+        } else {
+          onnxruntime::Gemm<T>::ComputeGemm(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
+                                            m, n, k,
+                                            2 * gamma_, a.data(), b.data(), 0.f,
+                                            nullptr, nullptr,
+                                            out.data(),
+                                            threadpool);
+        }
+
+        for (int64_t i = 0; i < m; ++i) {
+          const T a_norm = ConstEigenVectorMap<T>(a.data() + i * k, k).squaredNorm();
+          T* cur_out = out.data() + i * n;
+          for (int64_t j = 0; j < n; ++j) {
+            cur_out[j] -= gamma_ * (a_norm + b_norms_[j]);
+          }
+        }
+
+        vectorized_exp(out.data(), out.size());
+      } else {
+        T* cur_out = out.data();
+        const T* cur_batch = a.data();
+
+        // each batch has 'k' features
+        for (int64_t batch = 0; batch < m; ++batch) {
+          const T* cur_support_vector = b.data();
 
-      // each batch has 'k' features
-      for (int64_t batch = 0; batch < m; ++batch) {
-        const T* cur_support_vector = b.data();
+          // broadcast the support vectors against the k features in each batch. output is one value per support vector
+          for (int64_t support_vector = 0; support_vector < n; ++support_vector) {
+            T sum = 0.f;
+            const T* cur_input = cur_batch;
 
-        // broadcast the support vectors against the k features in each batch. output is one value per support vector
-        for (int64_t support_vector = 0; support_vector < n; ++support_vector) {
-          T sum = 0.f;
-          const T* cur_input = cur_batch;
+            for (int64_t feature = 0; feature < k; ++feature) {
+              T val = *cur_input++ - *cur_support_vector++;
+              sum += val * val;
+            }
 
-          for (int64_t feature = 0; feature < k; ++feature) {
-            T val = *cur_input++ - *cur_support_vector++;
-            sum += val * val;
+            *cur_out++ = std::exp(-gamma_ * sum);
           }
 
-          *cur_out++ = std::exp(-gamma_ * sum);
+          cur_batch += k;  // move to start of next batch
         }
-
-        cur_batch += k;  // move to start of next batch
       }
     } else {
       float alpha = 1.f;
@@ -73,12 +128,21 @@ class SVMCommon {
         c = coef0_;
       }
 
-      onnxruntime::Gemm<T>::ComputeGemm(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
-                                        m, n, k,
-                                        alpha, a.data(), b.data(), beta,
-                                        c != 0.f ? &c : nullptr, &shape_C,
-                                        out.data(),
-                                        threadpool);
+      if (has_packed_b(n, k)) {
+        // broadcast the scalar bias first, then accumulate into it
+        if (c != 0.f) {
+          std::fill(out.data(), out.data() + out.size(), static_cast<T>(c));
+        }
+        packed_gemm(m, n, k, static_cast<T>(alpha), a.data(),
+                    c != 0.f ? static_cast<T>(1) : static_cast<T>(0), out.data(), threadpool);
+      } else {
+        onnxruntime::Gemm<T>::ComputeGemm(CBLAS_TRANSPOSE::CblasNoTrans, CBLAS_TRANSPOSE::CblasTrans,
+                                          m, n, k,
+                                          alpha, a.data(), b.data(), beta,
+                                          c != 0.f ? &c : nullptr, &shape_C,
+                                          out.data(),
+                                          threadpool);
+      }
 
       if (kernel_type_ == KERNEL::POLY) {
         auto map_out = EigenVectorArrayMap<T>(out.data(), out.size());
@@ -96,16 +160,51 @@ class SVMCommon {
   }
 
  private:
+  bool has_packed_b(int64_t n, int64_t k) const {
+    return packed_b_ != nullptr && n == packed_b_rows_ && k == packed_b_cols_;
+  }
+
+  void packed_gemm(int64_t m, int64_t n, int64_t k, float alpha, const float* a,
+                   float beta, float* c, concurrency::ThreadPool* threadpool) const {
+    MlasGemm(CblasNoTrans,
+             static_cast<size_t>(m), static_cast<size_t>(n), static_cast<size_t>(k),
+             alpha, a, static_cast<size_t>(k),
+             packed_b_.get(),
+             beta, c, static_cast<size_t>(n),
+             threadpool);
+  }
+
+  void packed_gemm(int64_t, int64_t, int64_t, double, const double*,
+                   double, double*, concurrency::ThreadPool*) const {
+    ORT_THROW("Packed GEMM is only implemented for float.");
+  }
+
+  static void vectorized_exp(float* data, size_t len) {
+    MlasComputeExp(data, data, len);
+  }
+
+  static void vectorized_exp(double* data, size_t len) {
+    EigenVectorArrayMap<double> map_out(data, len);
+    map_out = map_out.exp();
+  }
+
   KERNEL kernel_type_;
   float gamma_{0.f};
   float coef0_{0.f};
   float degree_{0.f};
+
+  // B operand prepacked for MlasGemm plus the per-row squared norms used by the RBF kernel
+  BufferUniquePtr packed_b_;
+  int64_t packed_b_rows_{0};
+  int64_t packed_b_cols_{0};
+  std::vector<float> b_norms_;
 };
 
 class SVMClassifier final : public OpKernel, private SVMCommon {
   using SVMCommon::batched_kernel_dot;
   using SVMCommon::set_kernel_type;
   using SVMCommon::get_kernel_type;
+  using SVMCommon::PackKernelMatrixB;
 
  public:
   SVMClassifier(const OpKernelInfo& info);
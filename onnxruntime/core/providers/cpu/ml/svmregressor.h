@@ -17,6 +17,7 @@ class SVMRegressor final : public OpKernel, private SVMCommon {
   using SVMCommon::batched_kernel_dot;
   using SVMCommon::set_kernel_type;
   using SVMCommon::get_kernel_type;
+  using SVMCommon::PackKernelMatrixB;
 
  public:
   SVMRegressor(const OpKernelInfo& info);
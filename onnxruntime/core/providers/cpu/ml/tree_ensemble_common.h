@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <limits>
+
 #include "tree_ensemble_aggregator.h"
 #include "core/platform/ort_mutex.h"
 #include "core/platform/threadpool.h"
@@ -31,6 +33,23 @@ class TreeEnsembleCommon {
   int parallel_tree_;  // starts parallelizing the computing if n_tree >= parallel_tree_ and n_rows == 1
   int parallel_N_;     // starts parallelizing the computing if n_rows >= parallel_N_
 
+  // Flattened structure-of-arrays copy of the interior nodes, built once at kernel construction
+  // when every branch uses the same comparison mode. Children are stored as indices into the
+  // compiled arrays and a leaf child is encoded as the bitwise complement of its index into
+  // nodes_, so the traversal is a tight compare-and-index loop with no pointer chasing.
+  bool use_compiled_;
+  NODE_MODE compiled_mode_;
+  std::vector<int32_t> compiled_feature_id_;
+  std::vector<OTYPE> compiled_value_;
+  std::vector<int32_t> compiled_truenode_;
+  std::vector<int32_t> compiled_falsenode_;
+  std::vector<uint8_t> compiled_missing_true_;
+  std::vector<int32_t> compiled_roots_;
+
+  // number of rows evaluated together against each tree; sized so the per-tile scores stay
+  // in registers/L1 while a tree's upper levels are reused across the whole tile
+  static constexpr int64_t kCompiledRowTile = 16;
+
  public:
   TreeEnsembleCommon(int parallel_tree,
                      int parallel_N,
@@ -58,8 +77,20 @@ class TreeEnsembleCommon {
   TreeNodeElement<OTYPE>* ProcessTreeNodeLeave(
       TreeNodeElement<OTYPE>* root, const ITYPE* x_data) const;
 
+  void BuildCompiledTrees();
+
+  const TreeNodeElement<OTYPE>& ProcessCompiledTreeLeave(int32_t idx, const ITYPE* x_data) const;
+
   template <typename AGG>
   void ComputeAgg(concurrency::ThreadPool* ttp, const Tensor* X, Tensor* Z, Tensor* label, const AGG& agg) const;
+
+  template <typename AGG>
+  void ComputeCompiledTiled1(concurrency::ThreadPool* ttp, const ITYPE* x_data, OTYPE* z_data,
+                             int64_t* label_data, int64_t N, int64_t stride, const AGG& agg) const;
+
+  template <typename AGG>
+  void ComputeCompiledTiledN(concurrency::ThreadPool* ttp, const ITYPE* x_data, OTYPE* z_data,
+                             int64_t* label_data, int64_t N, int64_t stride, const AGG& agg) const;
 };
 
 template <typename ITYPE, typename OTYPE>
@@ -213,6 +244,78 @@ TreeEnsembleCommon<ITYPE, OTYPE>::TreeEnsembleCommon(int parallel_tree, int para
       break;
     }
   }
+
+  BuildCompiledTrees();
+}
+
+template <typename ITYPE, typename OTYPE>
+void TreeEnsembleCommon<ITYPE, OTYPE>::BuildCompiledTrees() {
+  use_compiled_ = false;
+  compiled_mode_ = NODE_MODE::LEAF;
+  if (!same_mode_ || nodes_.empty() ||
+      nodes_.size() > static_cast<size_t>(std::numeric_limits<int32_t>::max())) {
+    return;
+  }
+
+  for (const auto& node : nodes_) {
+    if (node.is_not_leaf) {
+      compiled_mode_ = node.mode;
+      break;
+    }
+  }
+  if (compiled_mode_ == NODE_MODE::LEAF) {
+    return;  // every tree is a single leaf, nothing worth compiling
+  }
+
+  // breadth-first order per tree so a tree's upper levels end up contiguous in memory;
+  // `order` doubles as the BFS queue since discovered interior nodes are only appended
+  std::vector<int32_t> compiled_index(nodes_.size(), -1);
+  std::vector<const TreeNodeElement<OTYPE>*> order;
+  order.reserve(nodes_.size());
+  for (const auto* root : roots_) {
+    if (!root->is_not_leaf)
+      continue;
+    size_t head = order.size();
+    compiled_index[root - nodes_.data()] = static_cast<int32_t>(order.size());
+    order.push_back(root);
+    while (head < order.size()) {
+      const auto* n = order[head++];
+      if (n->truenode == nullptr || n->falsenode == nullptr) {
+        return;  // dangling child link; keep the pointer-walk implementation
+      }
+      for (const auto* child : {n->truenode, n->falsenode}) {
+        if (child->is_not_leaf) {
+          compiled_index[child - nodes_.data()] = static_cast<int32_t>(order.size());
+          order.push_back(child);
+        }
+      }
+    }
+  }
+
+  const size_t n_interior = order.size();
+  compiled_feature_id_.resize(n_interior);
+  compiled_value_.resize(n_interior);
+  compiled_truenode_.resize(n_interior);
+  compiled_falsenode_.resize(n_interior);
+  compiled_missing_true_.resize(n_interior);
+  for (size_t c = 0; c < n_interior; ++c) {
+    const auto* n = order[c];
+    compiled_feature_id_[c] = n->feature_id;
+    compiled_value_[c] = n->value;
+    compiled_missing_true_[c] = n->is_missing_track_true ? 1 : 0;
+    const auto* t = n->truenode;
+    const auto* f = n->falsenode;
+    compiled_truenode_[c] = t->is_not_leaf ? compiled_index[t - nodes_.data()]
+                                           : ~static_cast<int32_t>(t - nodes_.data());
+    compiled_falsenode_[c] = f->is_not_leaf ? compiled_index[f - nodes_.data()]
+                                            : ~static_cast<int32_t>(f - nodes_.data());
+  }
+  compiled_roots_.resize(roots_.size());
+  for (size_t j = 0; j < roots_.size(); ++j) {
+    compiled_roots_[j] = roots_[j]->is_not_leaf ? compiled_index[roots_[j] - nodes_.data()]
+                                                : ~static_cast<int32_t>(roots_[j] - nodes_.data());
+  }
+  use_compiled_ = true;
 }
 
 template <typename ITYPE, typename OTYPE>
@@ -299,6 +402,8 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
         agg.FinalizeScores1(z_data + i, score,
                             label_data == nullptr ? nullptr : (label_data + i));
       }
+    } else if (use_compiled_) { /* section CT: 1 output, 2+ rows, compiled trees: parallel row tiles */
+      ComputeCompiledTiled1(ttp, x_data, z_data, label_data, N, stride, agg);
     } else if (n_trees_ > max_num_threads) { /* section D: 1 output, 2+ rows and enough trees to parallelize */
       auto num_threads = std::min<int32_t>(max_num_threads, SafeInt<int32_t>(n_trees_));
       std::vector<ScoreValue<OTYPE>> scores(num_threads * N);
@@ -384,6 +489,8 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
         agg.FinalizeScores(scores, z_data + i * n_targets_or_classes_, -1,
                            label_data == nullptr ? nullptr : (label_data + i));
       }
+    } else if (use_compiled_) { /* section CT2: 2+ outputs, 2+ rows, compiled trees: parallel row tiles */
+      ComputeCompiledTiledN(ttp, x_data, z_data, label_data, N, stride, agg);
     } else if (n_trees_ >= max_num_threads) { /* section: D2: 2+ outputs, 2+ rows, enough trees to parallelize*/
       auto num_threads = std::min<int32_t>(max_num_threads, SafeInt<int32_t>(n_trees_));
       std::vector<std::vector<ScoreValue<OTYPE>>> scores(num_threads * N);
@@ -440,6 +547,87 @@ void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeAgg(concurrency::ThreadPool* ttp,
   }
 }  // namespace detail
 
+template <typename ITYPE, typename OTYPE>
+template <typename AGG>
+void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeCompiledTiled1(
+    concurrency::ThreadPool* ttp, const ITYPE* x_data, OTYPE* z_data,
+    int64_t* label_data, int64_t N, int64_t stride, const AGG& agg) const {
+  const int64_t n_tiles = (N + kCompiledRowTile - 1) / kCompiledRowTile;
+  auto max_num_threads = concurrency::ThreadPool::DegreeOfParallelism(ttp);
+  auto num_threads = std::min<int32_t>(max_num_threads, SafeInt<int32_t>(n_tiles));
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      ttp,
+      num_threads,
+      [this, &agg, x_data, z_data, label_data, N, stride, n_tiles, num_threads](ptrdiff_t batch_num) {
+        auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, n_tiles);
+        ScoreValue<OTYPE> scores[kCompiledRowTile];
+        for (auto tile = work.start; tile < work.end; ++tile) {
+          const int64_t row_begin = tile * kCompiledRowTile;
+          int64_t row_end = row_begin + kCompiledRowTile;
+          if (row_end > N)
+            row_end = N;
+          const int64_t rows = row_end - row_begin;
+          for (int64_t r = 0; r < rows; ++r) {
+            scores[r] = {0, 0};
+          }
+          // each tree walks every row of the tile before the next tree starts, so the tree's
+          // upper levels are read once per tile instead of once per row
+          for (size_t j = 0; j < compiled_roots_.size(); ++j) {
+            for (int64_t r = 0; r < rows; ++r) {
+              agg.ProcessTreeNodePrediction1(
+                  scores[r],
+                  ProcessCompiledTreeLeave(compiled_roots_[j], x_data + (row_begin + r) * stride));
+            }
+          }
+          for (int64_t r = 0; r < rows; ++r) {
+            agg.FinalizeScores1(z_data + row_begin + r, scores[r],
+                                label_data == nullptr ? nullptr : (label_data + row_begin + r));
+          }
+        }
+      });
+}
+
+template <typename ITYPE, typename OTYPE>
+template <typename AGG>
+void TreeEnsembleCommon<ITYPE, OTYPE>::ComputeCompiledTiledN(
+    concurrency::ThreadPool* ttp, const ITYPE* x_data, OTYPE* z_data,
+    int64_t* label_data, int64_t N, int64_t stride, const AGG& agg) const {
+  const int64_t n_tiles = (N + kCompiledRowTile - 1) / kCompiledRowTile;
+  auto max_num_threads = concurrency::ThreadPool::DegreeOfParallelism(ttp);
+  auto num_threads = std::min<int32_t>(max_num_threads, SafeInt<int32_t>(n_tiles));
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      ttp,
+      num_threads,
+      [this, &agg, x_data, z_data, label_data, N, stride, n_tiles, num_threads](ptrdiff_t batch_num) {
+        auto work = concurrency::ThreadPool::PartitionWork(batch_num, num_threads, n_tiles);
+        std::vector<std::vector<ScoreValue<OTYPE>>> scores(static_cast<size_t>(kCompiledRowTile));
+        for (auto& row_scores : scores) {
+          row_scores.resize(n_targets_or_classes_, {0, 0});
+        }
+        for (auto tile = work.start; tile < work.end; ++tile) {
+          const int64_t row_begin = tile * kCompiledRowTile;
+          int64_t row_end = row_begin + kCompiledRowTile;
+          if (row_end > N)
+            row_end = N;
+          const int64_t rows = row_end - row_begin;
+          for (int64_t r = 0; r < rows; ++r) {
+            std::fill(scores[r].begin(), scores[r].end(), ScoreValue<OTYPE>({0, 0}));
+          }
+          for (size_t j = 0; j < compiled_roots_.size(); ++j) {
+            for (int64_t r = 0; r < rows; ++r) {
+              agg.ProcessTreeNodePrediction(
+                  scores[r],
+                  ProcessCompiledTreeLeave(compiled_roots_[j], x_data + (row_begin + r) * stride));
+            }
+          }
+          for (int64_t r = 0; r < rows; ++r) {
+            agg.FinalizeScores(scores[r], z_data + (row_begin + r) * n_targets_or_classes_, -1,
+                               label_data == nullptr ? nullptr : (label_data + row_begin + r));
+          }
+        }
+      });
+}
+
 #define TREE_FIND_VALUE(CMP)                                         \
   if (has_missing_tracks_) {                                         \
     while (root->is_not_leaf) {                                      \
@@ -546,6 +734,53 @@ TreeEnsembleCommon<ITYPE, OTYPE>::ProcessTreeNodeLeave(
   return root;
 }
 
+#define COMPILED_TREE_FIND_VALUE(CMP)                              \
+  if (has_missing_tracks_) {                                       \
+    while (idx >= 0) {                                             \
+      val = x_data[compiled_feature_id_[idx]];                     \
+      idx = (val CMP compiled_value_[idx] ||                       \
+             (compiled_missing_true_[idx] && _isnan_(val)))        \
+                ? compiled_truenode_[idx]                          \
+                : compiled_falsenode_[idx];                        \
+    }                                                              \
+  } else {                                                         \
+    while (idx >= 0) {                                             \
+      val = x_data[compiled_feature_id_[idx]];                     \
+      idx = val CMP compiled_value_[idx] ? compiled_truenode_[idx] \
+                                         : compiled_falsenode_[idx]; \
+    }                                                              \
+  }
+
+template <typename ITYPE, typename OTYPE>
+const TreeNodeElement<OTYPE>&
+TreeEnsembleCommon<ITYPE, OTYPE>::ProcessCompiledTreeLeave(
+    int32_t idx, const ITYPE* x_data) const {
+  ITYPE val;
+  switch (compiled_mode_) {
+    case NODE_MODE::BRANCH_LEQ:
+      COMPILED_TREE_FIND_VALUE(<=)
+      break;
+    case NODE_MODE::BRANCH_LT:
+      COMPILED_TREE_FIND_VALUE(<)
+      break;
+    case NODE_MODE::BRANCH_GTE:
+      COMPILED_TREE_FIND_VALUE(>=)
+      break;
+    case NODE_MODE::BRANCH_GT:
+      COMPILED_TREE_FIND_VALUE(>)
+      break;
+    case NODE_MODE::BRANCH_EQ:
+      COMPILED_TREE_FIND_VALUE(==)
+      break;
+    case NODE_MODE::BRANCH_NEQ:
+      COMPILED_TREE_FIND_VALUE(!=)
+      break;
+    case NODE_MODE::LEAF:
+      break;
+  }
+  return nodes_[~idx];
+}
+
 template <typename ITYPE, typename OTYPE>
 class TreeEnsembleCommonClassifier : TreeEnsembleCommon<ITYPE, OTYPE> {
  private:
@@ -17,11 +17,14 @@
 
 #pragma once
 
+#include <array>
+
 #include "core/common/common.h"
 #include "core/common/exceptions.h"
 #include "core/framework/op_kernel.h"
 #include "core/providers/common.h"
 #include "core/framework/tensor.h"
+#include "core/platform/threadpool.h"
 #include "core/util/math_cpuonly.h"
 #include "core/providers/cpu/nn/batch_norm_helper.h"
 #include <safeint/SafeInt.hpp>
@@ -42,6 +45,43 @@ class BatchNorm : public OpKernel {
     //TODO: momentum
   }
 
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override {
+    is_packed = false;
+
+    // Fold scale/B/mean/var into the per-channel (scale', bias') pair once all four have been
+    // seen as constant initializers, so Compute runs a single fused y = scale' * x + bias' pass.
+    // The tensors stay in the session state (is_packed remains false) so Compute still works
+    // when only a subset of the parameters is constant.
+    if (is_spatial_ && input_idx >= 1 && input_idx <= 4 && tensor.Shape().NumDimensions() == 1) {
+      const size_t C = static_cast<size_t>(tensor.Shape().Size());
+      const T* data = tensor.template Data<T>();
+      prepacked_params_[input_idx - 1].assign(data, data + C);
+
+      bool have_all = true;
+      for (const auto& param : prepacked_params_) {
+        have_all &= (param.size() == C);
+      }
+
+      if (have_all) {
+        const auto& scale = prepacked_params_[0];
+        const auto& bias = prepacked_params_[1];
+        const auto& mean = prepacked_params_[2];
+        const auto& var = prepacked_params_[3];
+
+        folded_scale_.resize(C);
+        folded_bias_.resize(C);
+
+        for (size_t c = 0; c < C; ++c) {
+          const T inv_std = static_cast<T>(1) / std::sqrt(var[c] + static_cast<T>(epsilon_));
+          folded_scale_[c] = scale[c] * inv_std;
+          folded_bias_[c] = bias[c] - mean[c] * folded_scale_[c];
+        }
+      }
+    }
+
+    return Status::OK();
+  }
+
   Status Compute(OpKernelContext* p_op_kernel_context) const override {
     const auto* X = p_op_kernel_context->Input<Tensor>(0);
     const auto* scale = p_op_kernel_context->Input<Tensor>(1);
@@ -67,6 +107,25 @@ class BatchNorm : public OpKernel {
     // calculate sample_size (including all channels)
     size_t sample_size_incl_all_channels = sample_size * C;
 
+    // fast path when the parameters were folded at PrePack time: one vectorized
+    // y = scale' * x + bias' pass, sharded over the N * C channel images
+    if (is_spatial_ && folded_scale_.size() == C) {
+      const T* x_data = X->template Data<T>();
+      T* y_data = Y->template MutableData<T>();
+
+      concurrency::ThreadPool::TryBatchParallelFor(
+          p_op_kernel_context->GetOperatorThreadPool(), static_cast<ptrdiff_t>(N * C),
+          [&](ptrdiff_t nc) {
+            EigenVectorArrayMap<T>(y_data + nc * sample_size, sample_size) =
+                ConstEigenVectorArrayMap<T>(x_data + nc * sample_size, sample_size) *
+                    folded_scale_[nc % C] +
+                folded_bias_[nc % C];
+          },
+          0);
+
+      return Status::OK();
+    }
+
     ConstEigenVectorArrayMap<T> scale_arr(scale->template Data<T>(), is_spatial_ ? C : sample_size_incl_all_channels);
     ConstEigenVectorArrayMap<T> bias_arr(B->template Data<T>(), is_spatial_ ? C : sample_size_incl_all_channels);
 
@@ -107,5 +166,11 @@ class BatchNorm : public OpKernel {
   float epsilon_;
   const bool is_spatial_;
   //int64_t is_test_;   ignored in this implementation since we're doing inferencing only.
+
+  // copies of the constant initializers seen by PrePack (scale, B, mean, var) and the
+  // per-channel coefficients folded from them once all four are available
+  std::array<std::vector<T>, 4> prepacked_params_;
+  std::vector<T> folded_scale_;
+  std::vector<T> folded_bias_;
 };
 }  // namespace onnxruntime
@@ -18,6 +18,7 @@
 #include "core/providers/cpu/nn/conv_transpose.h"
 
 #include "core/common/safeint.h"
+#include "core/platform/threadpool.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
 
@@ -35,6 +36,52 @@ ONNX_CPU_OPERATOR_KERNEL(
     KernelDefBuilder().TypeConstraint("T", DataTypeImpl::GetTensorType<float>()),
     ConvTranspose<float>);
 
+template <typename T>
+Status ConvTranspose<T>::PrePack(const Tensor& tensor, int input_idx, bool& is_packed) {
+  is_packed = false;
+
+  // only pack the filter tensor
+  if (input_idx != 1) {
+    return Status::OK();
+  }
+
+  const auto& shape = tensor.Shape();
+  if (shape.NumDimensions() <= 2) {
+    return Status::OK();
+  }
+
+  if (shape[0] % conv_transpose_attrs_.group != 0) {
+    return Status::OK();
+  }
+
+  // The GEMM below multiplies the transpose of each group's [C / group, kernel_dim]
+  // filter block against the input image. Transpose the blocks once here so every
+  // Compute call can take the faster non-transposed GEMM path over the same weights.
+  const int64_t channels_per_group = shape[0] / conv_transpose_attrs_.group;
+  const int64_t kernel_dim = shape.Size() / shape[0];
+  const int64_t group_size = channels_per_group * kernel_dim;
+
+  auto alloc = Info().GetAllocator(0, OrtMemTypeDefault);
+  auto* transposed_data = alloc->Alloc(SafeInt<size_t>(sizeof(T)) * shape.Size());
+  transposed_filter_ = BufferUniquePtr(transposed_data, BufferDeleter(alloc));
+
+  const T* src = tensor.template Data<T>();
+  T* dst = static_cast<T*>(transposed_data);
+  for (int64_t group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
+    for (int64_t c = 0; c < channels_per_group; ++c) {
+      for (int64_t k = 0; k < kernel_dim; ++k) {
+        dst[k * channels_per_group + c] = src[c * kernel_dim + k];
+      }
+    }
+    src += group_size;
+    dst += group_size;
+  }
+
+  filter_shape_ = shape;
+  is_packed = true;
+  return Status::OK();
+}
+
 template <typename T>
 Status ConvTranspose<T>::Compute(OpKernelContext* context) const {
   return ConvTranspose<T>::DoConvTranspose(context, false);
@@ -47,17 +94,19 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
   size_t num_inputs = OpKernel::Node().InputDefs().size();
   ConvTransposeAttributes::Prepare p;
   bool has_bias = dynamic_padding ? num_inputs == 4 : num_inputs == 3;
-  ORT_RETURN_IF_ERROR(conv_transpose_attrs_.PrepareForCompute(context, has_bias, p, dynamic_padding));
+  ORT_RETURN_IF_ERROR(conv_transpose_attrs_.PrepareForCompute(context, has_bias, p, dynamic_padding,
+                                                              transposed_filter_ ? &filter_shape_ : nullptr));
 
   // Bail out early if one of the dimensions is zero.
   if (p.Y->Shape().Size() == 0) {
     return Status::OK();
   }
 
+  const TensorShape& F_shape = transposed_filter_ ? filter_shape_ : p.F->Shape();
   const int64_t input_image_size = p.input_shape.Size();
   const int64_t X_offset = p.num_input_channels / conv_transpose_attrs_.group * input_image_size;
   const int64_t Y_offset = p.Y->Shape().Size() / p.Y->Shape()[0] / conv_transpose_attrs_.group;
-  const int64_t W_offset = p.F->Shape().Size() / conv_transpose_attrs_.group;
+  const int64_t W_offset = F_shape.Size() / conv_transpose_attrs_.group;
   const int64_t kernel_size = TensorShape(p.kernel_shape).Size();
   const int64_t kernel_dim = p.num_output_channels / conv_transpose_attrs_.group * kernel_size;
   const int64_t output_size = (p.Y->Shape().Slice(2)).Size();
@@ -71,15 +120,20 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
   T* col_buffer_data = static_cast<T*>(col_buffer.get());
 
   const T* Xdata = p.X->template Data<T>();
-  const T* filter_data = p.F->template Data<T>();
+  const T* filter_data = transposed_filter_ ? static_cast<const T*>(transposed_filter_.get())
+                                            : p.F->template Data<T>();
+  const CBLAS_TRANSPOSE trans_filter = transposed_filter_ ? CblasNoTrans : CblasTrans;
   T* Ydata = p.Y->template MutableData<T>();
 
   if (p.X->Shape().NumDimensions() == 4) {
+    const int64_t output_channels_per_group = p.num_output_channels / conv_transpose_attrs_.group;
+    const int64_t output_image_size = p.Y->Shape()[2] * p.Y->Shape()[3];
+
     for (auto image_id = 0; image_id < p.N; ++image_id) {
       for (int group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
         // Weight term
         math::Gemm<T>(
-            CblasTrans,
+            trans_filter,
             CblasNoTrans,
             kernel_dim,
             input_image_size,
@@ -91,24 +145,37 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
             col_buffer_data,
             thread_pool);
 
-        // Col2im
-        math::Col2im<T, CPUMathUtil, StorageOrder::NCHW>(
-            col_buffer_data,
-            p.num_output_channels / conv_transpose_attrs_.group,
-            p.Y->Shape()[2],
-            p.Y->Shape()[3],
-            p.kernel_shape[0],
-            p.kernel_shape[1],
-            p.dilations[0],
-            p.dilations[1],
-            p.pads[0],
-            p.pads[1],
-            p.pads[2],
-            p.pads[3],
-            p.strides[0],
-            p.strides[1],
-            Ydata + group_id * Y_offset,
-            &CPUMathUtil::Instance());
+        // Col2im. Each output channel accumulates only from its own kernel_size rows
+        // of the column buffer, so the scatter can be sharded over output channels
+        // without any two shards touching the same output element.
+        T* group_Ydata = Ydata + group_id * Y_offset;
+        auto col2im_fn =
+            [&](ptrdiff_t c_begin, ptrdiff_t c_end) {
+              for (auto c = c_begin; c < c_end; ++c) {
+                math::Col2im<T, CPUMathUtil, StorageOrder::NCHW>(
+                    col_buffer_data + c * kernel_size * input_image_size,
+                    1,
+                    p.Y->Shape()[2],
+                    p.Y->Shape()[3],
+                    p.kernel_shape[0],
+                    p.kernel_shape[1],
+                    p.dilations[0],
+                    p.dilations[1],
+                    p.pads[0],
+                    p.pads[1],
+                    p.pads[2],
+                    p.pads[3],
+                    p.strides[0],
+                    p.strides[1],
+                    group_Ydata + c * output_image_size,
+                    &CPUMathUtil::Instance());
+              }
+            };
+        concurrency::ThreadPool::TryParallelFor(
+            thread_pool,
+            static_cast<std::ptrdiff_t>(output_channels_per_group),
+            static_cast<double>(kernel_size * input_image_size * sizeof(T)),
+            col2im_fn);
       }
 
       if (p.B != nullptr) {
@@ -127,7 +194,7 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
       for (int group_id = 0; group_id < conv_transpose_attrs_.group; ++group_id) {
         // Weight term
         math::Gemm<T>(
-            CblasTrans,
+            trans_filter,
             CblasNoTrans,
             kernel_dim,
             input_image_size,
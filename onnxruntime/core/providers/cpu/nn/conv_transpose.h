@@ -29,11 +29,18 @@ class ConvTranspose : public OpKernel {
 
   Status Compute(OpKernelContext* context) const override;
 
+  Status PrePack(const Tensor& tensor, int input_idx, bool& is_packed) override;
+
  protected:
   Status DoConvTranspose(OpKernelContext* context, bool dynamic_padding) const;
 
  private:
   ConvTransposeAttributes conv_transpose_attrs_;
+
+  // Filter reordered by PrePack so the per-image GEMM can run without
+  // transposing the weights on every call.
+  TensorShape filter_shape_;
+  BufferUniquePtr transposed_filter_;
 };
 
 }  // namespace onnxruntime
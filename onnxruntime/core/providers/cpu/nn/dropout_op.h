@@ -5,8 +5,10 @@
 
 #include "core/framework/op_kernel.h"
 #include "core/framework/random_generator.h"
+#include <algorithm>
 #include <chrono>
 #include <random>
+#include "core/platform/threadpool.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
@@ -17,14 +19,14 @@ class Dropout final: public OpKernel {
   Dropout(const OpKernelInfo& info) : OpKernel{info} {
     int64_t seed = 0;
     if (info.GetAttr<int64_t>("seed", &seed).IsOK()) {
-      generator_ = onnxruntime::make_unique<RandomGenerator>(seed);
+      generator_ = onnxruntime::make_unique<PhiloxGenerator>(static_cast<uint64_t>(seed));
     }
   }
 
   Status Compute(OpKernelContext* context) const override;
 
  private:
-  mutable std::unique_ptr<RandomGenerator> generator_;
+  mutable std::unique_ptr<PhiloxGenerator> generator_;
 };
 
 namespace {
@@ -81,14 +83,30 @@ Status Dropout<T1, T2>::Compute(OpKernelContext* context) const {
     EigenVectorArrayMap<T1> Y_arr(Y_span.data(), Y_span.size());
     EigenVectorArrayMap<bool> mask_arr(mask_span.data(), mask_span.size());
 
-    // generate mask
+    // generate mask with the counter-based Philox engine, sharded over the thread
+    // pool. each shard seeds itself at its first counter block, so the mask for a
+    // given seed does not depend on how many threads execute the kernel.
     {
-      RandomGenerator& generator = generator_ != nullptr ? *generator_.get() : RandomGenerator::Default();
-      std::default_random_engine rng(generator.NextSeed());
-      std::uniform_real_distribution<float> dist{0.0f, 1.0f};
-      mask_arr = Eigen::ArrayX<bool>::NullaryExpr(
-          mask_arr.size(),
-          [ratio_value, &dist, &rng]() { return dist(rng) >= ratio_value; });
+      PhiloxGenerator& generator = generator_ != nullptr ? *generator_.get() : PhiloxGenerator::Default();
+      const int64_t count = static_cast<int64_t>(mask_span.size());
+      const int64_t num_blocks = (count + 3) / 4;
+      const auto seeds = generator.NextPhiloxSeeds(static_cast<uint64_t>(num_blocks));
+      bool* mask_data = mask_span.data();
+      auto mask_fn =
+          [=](std::ptrdiff_t block_begin, std::ptrdiff_t block_end) {
+            Philox4x32x10 engine(seeds.first, seeds.second + static_cast<uint64_t>(block_begin));
+            uint32_t bits[4];
+            for (auto block = block_begin; block < block_end; ++block) {
+              engine.NextBlock(bits);
+              const int64_t element = block * 4;
+              const int64_t lanes = std::min<int64_t>(4, count - element);
+              for (int64_t lane = 0; lane < lanes; ++lane) {
+                mask_data[element + lane] = PhiloxUniformFloat(bits[lane]) >= ratio_value;
+              }
+            }
+          };
+      concurrency::ThreadPool::TryParallelFor(context->GetOperatorThreadPool(),
+                                              static_cast<std::ptrdiff_t>(num_blocks), 64.0, mask_fn);
     }
 
     Y_arr = mask_arr.cast<T1>() * X_arr / (1.0f - ratio_value);
@@ -3,6 +3,7 @@
 
 #include "core/providers/cpu/nn/instance_norm.h"
 #include "core/providers/cpu/nn/instance_norm_helper.h"
+#include "core/platform/threadpool.h"
 #include "core/util/math_cpuonly.h"
 using namespace ::onnxruntime::common;
 
@@ -28,16 +29,26 @@ Status InstanceNorm<float>::Compute(OpKernelContext* p_op_kernel_context) const
   const TensorShape& x_shape = input->Shape();
   Tensor* Y = p_op_kernel_context->Output(0, x_shape);
 
-  for (auto i = 0; i < N * C; ++i) {
-    ConstEigenVectorArrayMap<float> Xi(input->template Data<float>() + W * i, W);
-    const float Xi_mean = Xi.mean();
-    const float squared_norm = (Xi - Xi_mean).matrix().squaredNorm();
-    const float inv_stdev = 1.0f / std::sqrt(squared_norm / W + epsilon_);
-    EigenVectorArrayMap<float> Yi(Y->template MutableData<float>() + W * i, W);
-    const float channel_scale = inv_stdev * scale->template Data<float>()[i % C];
-    const float channel_shift = B->template Data<float>()[i % C] - Xi_mean * channel_scale;
-    Yi = Xi * channel_scale + channel_shift;
-  }
+  const float* x_data = input->template Data<float>();
+  const float* scale_data = scale->template Data<float>();
+  const float* bias_data = B->template Data<float>();
+  float* y_data = Y->template MutableData<float>();
+
+  // each (n, c) image is normalized independently, so shard the mean/variance
+  // reduction and the fused scale/shift pass across the instances
+  concurrency::ThreadPool::TryBatchParallelFor(
+      p_op_kernel_context->GetOperatorThreadPool(), static_cast<ptrdiff_t>(N * C),
+      [&](ptrdiff_t i) {
+        ConstEigenVectorArrayMap<float> Xi(x_data + W * i, W);
+        const float Xi_mean = Xi.mean();
+        const float squared_norm = (Xi - Xi_mean).matrix().squaredNorm();
+        const float inv_stdev = 1.0f / std::sqrt(squared_norm / W + epsilon_);
+        EigenVectorArrayMap<float> Yi(y_data + W * i, W);
+        const float channel_scale = inv_stdev * scale_data[i % C];
+        const float channel_shift = bias_data[i % C] - Xi_mean * channel_scale;
+        Yi = Xi * channel_scale + channel_shift;
+      },
+      0);
 
   return Status::OK();
 }
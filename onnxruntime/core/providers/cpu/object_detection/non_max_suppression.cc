@@ -13,6 +13,7 @@ limitations under the License.
 
 #include "non_max_suppression.h"
 #include "non_max_suppression_helper.h"
+#include "core/platform/threadpool.h"
 #include <queue>
 #include <utility>
 //TODO:fix the warnings
@@ -159,74 +160,121 @@ Status NonMaxSuppression::Compute(OpKernelContext* ctx) const {
     inline bool operator<(const BoxInfo& rhs) const {
       return score_ < rhs.score_ || (score_ == rhs.score_ && index_ > rhs.index_);
     }
-
-    inline bool SuppressByIOU(const BoxInfo& rhs, float iou_threshold) const {
-      const float intersection_x_min = std::max(box_[1], rhs.box_[1]);
-      const float intersection_y_min = std::max(box_[0], rhs.box_[0]);
-      const float intersection_x_max = std::min(box_[3], rhs.box_[3]);
-      const float intersection_y_max = std::min(box_[2], rhs.box_[2]);
-
-      const float intersection_area = std::max(intersection_x_max - intersection_x_min, .0f) *
-                                      std::max(intersection_y_max - intersection_y_min, .0f);
-      if (intersection_area <= .0f) {
-        return false;
-      }
-      const float union_area = area_ + rhs.area_ - intersection_area;
-      const float intersection_over_union = intersection_area / union_area;
-      return intersection_over_union > iou_threshold;
-    }
   };
 
   const auto center_point_box = GetCenterPointBox();
 
-  std::vector<SelectedIndex> selected_indices;
-  std::vector<BoxInfo> selected_boxes_inside_class;
-  selected_boxes_inside_class.reserve(std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_));
-
-  for (int64_t batch_index = 0; batch_index < pc.num_batches_; ++batch_index) {
-    for (int64_t class_index = 0; class_index < pc.num_classes_; ++class_index) {
-      int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
-      const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
-      std::vector<BoxInfo> candidate_boxes;
-      candidate_boxes.reserve(pc.num_boxes_);
-
-      // Filter by score_threshold_
-      const auto* class_scores = scores_data + box_score_offset;
-      if (pc.score_threshold_ != nullptr) {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
-          if (*class_scores > score_threshold) {
-            candidate_boxes.emplace_back(*class_scores, box_index, center_point_box, batch_boxes + (box_index * 4));
-          }
-        }
-      } else {
-        for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
+  // Each (batch, class) pair can be processed independently - hand them to the thread
+  // pool as separate jobs and stitch the per-job selections together afterwards so that
+  // the output ordering matches the sequential version
+  const int64_t num_jobs = pc.num_batches_ * pc.num_classes_;
+  std::vector<std::vector<SelectedIndex>> selected_indices_per_job(num_jobs);
+
+  auto process_class = [&](std::ptrdiff_t job_index) {
+    const int64_t batch_index = job_index / pc.num_classes_;
+    const int64_t class_index = job_index % pc.num_classes_;
+
+    int64_t box_score_offset = (batch_index * pc.num_classes_ + class_index) * pc.num_boxes_;
+    const float* batch_boxes = boxes_data + (batch_index * pc.num_boxes_ * 4);
+    std::vector<BoxInfo> candidate_boxes;
+    candidate_boxes.reserve(pc.num_boxes_);
+
+    // Filter by score_threshold_
+    const auto* class_scores = scores_data + box_score_offset;
+    if (pc.score_threshold_ != nullptr) {
+      for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
+        if (*class_scores > score_threshold) {
           candidate_boxes.emplace_back(*class_scores, box_index, center_point_box, batch_boxes + (box_index * 4));
         }
       }
-      std::priority_queue<BoxInfo, std::vector<BoxInfo>> sorted_boxes(std::less<BoxInfo>(), std::move(candidate_boxes));
-
-      selected_boxes_inside_class.clear();
-      // Get the next box with top score, filter by iou_threshold
-      while (!sorted_boxes.empty() && static_cast<int64_t>(selected_boxes_inside_class.size()) < max_output_boxes_per_class) {
-        const BoxInfo& next_top_score = sorted_boxes.top();
-
-        bool selected = true;
-        // Check with existing selected boxes for this class, suppress if exceed the IOU (Intersection Over Union) threshold
-        for (const auto& selected_index : selected_boxes_inside_class) {
-          if (next_top_score.SuppressByIOU(selected_index, iou_threshold)) {
-            selected = false;
-            break;
-          }
+    } else {
+      for (int64_t box_index = 0; box_index < pc.num_boxes_; ++box_index, ++class_scores) {
+        candidate_boxes.emplace_back(*class_scores, box_index, center_point_box, batch_boxes + (box_index * 4));
+      }
+    }
+    std::priority_queue<BoxInfo, std::vector<BoxInfo>> sorted_boxes(std::less<BoxInfo>(), std::move(candidate_boxes));
+
+    // The selected boxes are kept in structure-of-arrays form so that a candidate can be
+    // checked against a whole block of them in a tight loop the compiler can vectorize
+    const size_t selected_reserve = std::min<size_t>(static_cast<size_t>(max_output_boxes_per_class), pc.num_boxes_);
+    std::vector<float> selected_x_min, selected_y_min, selected_x_max, selected_y_max, selected_area;
+    selected_x_min.reserve(selected_reserve);
+    selected_y_min.reserve(selected_reserve);
+    selected_x_max.reserve(selected_reserve);
+    selected_y_max.reserve(selected_reserve);
+    selected_area.reserve(selected_reserve);
+
+    auto& selected_indices_inside_class = selected_indices_per_job[job_index];
+
+    // Get the next box with top score, filter by iou_threshold
+    while (!sorted_boxes.empty() && static_cast<int64_t>(selected_area.size()) < max_output_boxes_per_class) {
+      const BoxInfo& next_top_score = sorted_boxes.top();
+
+      const float y_min = next_top_score.box_[0];
+      const float x_min = next_top_score.box_[1];
+      const float y_max = next_top_score.box_[2];
+      const float x_max = next_top_score.box_[3];
+      const float area = next_top_score.area_;
+
+      // Check with existing selected boxes for this class, suppress if exceed the IOU
+      // (Intersection Over Union) threshold. The check runs a block of boxes at a time
+      // without branching inside the block, early-exiting between blocks once a
+      // suppressing box has been found.
+      bool selected = true;
+      constexpr size_t block_size = 16;
+      const size_t selected_count = selected_area.size();
+      for (size_t block_start = 0; selected && block_start < selected_count; block_start += block_size) {
+        const size_t block_end = std::min(block_start + block_size, selected_count);
+        int suppressed = 0;
+        for (size_t i = block_start; i < block_end; ++i) {
+          const float intersection_x_min = std::max(x_min, selected_x_min[i]);
+          const float intersection_y_min = std::max(y_min, selected_y_min[i]);
+          const float intersection_x_max = std::min(x_max, selected_x_max[i]);
+          const float intersection_y_max = std::min(y_max, selected_y_max[i]);
+
+          const float intersection_area = std::max(intersection_x_max - intersection_x_min, .0f) *
+                                          std::max(intersection_y_max - intersection_y_min, .0f);
+          const float union_area = area + selected_area[i] - intersection_area;
+
+          // A union of zero only happens with a zero intersection, so the quotient is
+          // either well-defined or a NaN that fails both comparisons
+          suppressed |= static_cast<int>(intersection_area > .0f) &
+                        static_cast<int>(intersection_area / union_area > iou_threshold);
         }
+        selected = suppressed == 0;
+      }
 
-        if (selected) {
-          selected_boxes_inside_class.push_back(next_top_score);
-          selected_indices.emplace_back(batch_index, class_index, next_top_score.index_);
-        }
-        sorted_boxes.pop();
-      }  //while
-    }    //for class_index
-  }      //for batch_index
+      if (selected) {
+        selected_x_min.push_back(x_min);
+        selected_y_min.push_back(y_min);
+        selected_x_max.push_back(x_max);
+        selected_y_max.push_back(y_max);
+        selected_area.push_back(area);
+        selected_indices_inside_class.emplace_back(batch_index, class_index, next_top_score.index_);
+      }
+      sorted_boxes.pop();
+    }  //while
+  };
+
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+  if (tp == nullptr || num_jobs == 1) {
+    for (int64_t job_index = 0; job_index < num_jobs; ++job_index) {
+      process_class(job_index);
+    }
+  } else {
+    concurrency::ThreadPool::TrySimpleParallelFor(tp, static_cast<std::ptrdiff_t>(num_jobs), process_class);
+  }
+
+  // Stitch the per-job selections together in job order
+  size_t total_selected = 0;
+  for (const auto& job_selections : selected_indices_per_job) {
+    total_selected += job_selections.size();
+  }
+  std::vector<SelectedIndex> selected_indices;
+  selected_indices.reserve(total_selected);
+  for (const auto& job_selections : selected_indices_per_job) {
+    selected_indices.insert(selected_indices.end(), job_selections.begin(), job_selections.end());
+  }
 
   const auto last_dim = 3;
   const auto num_selected = selected_indices.size();
@@ -261,6 +261,10 @@ bool SetupForReduce(const Tensor* input_tensor_ptr,
 void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
                                  const std::vector<int64_t>& reduced_axes,
                                  ResultsNoTransposePrepareForReduce& results) {
+  // Record the keys the plan was built for so later calls can reuse it.
+  results.input_shape = new_input_shape.GetDims();
+  results.reduced_axes = reduced_axes;
+
   // Common initialisation for the indices.
   std::vector<int64_t> cumulative_shape = new_input_shape.GetDims();
   cumulative_shape[cumulative_shape.size() - 1] = 1;
@@ -355,6 +359,10 @@ void NoTransposePrepareForReduce(const TensorShape& new_input_shape,
   }
 }
 
+// Fixed block length (in elements) for tree reductions over the whole tensor. Partial aggregates
+// are computed per block and merged in block order.
+constexpr int64_t kTreeReduceBlockSize = 16384;
+
 template <typename T, typename AGG>
 void NoTransposeReduce(Tensor* output, const TensorShape& new_input_shape, const Tensor& input,
                        const std::vector<int64_t>& reduced_axes, concurrency::ThreadPool* tp,
@@ -367,15 +375,41 @@ void NoTransposeReduce(Tensor* output, const TensorShape& new_input_shape, const
   if (reduced_axes.size() == 0 || reduced_axes.size() == new_input_shape.NumDimensions()) {
     ORT_ENFORCE(count == 1, "Reduction on all axes, output size should be 1.");
     int64_t input_size = new_input_shape.Size();
-    to_data[0] = AGG(input_size, from_data[0]).aggall(from_data);
+    if (AGG::tree_reduce() && input_size > kTreeReduceBlockSize &&
+        concurrency::ThreadPool::ShouldParallelize(tp)) {
+      // Compute partial aggregates over fixed-size blocks in parallel and merge them in block
+      // order. The block boundaries do not depend on the thread count, so float results are
+      // deterministic from run to run.
+      const int64_t block_count = (input_size + kTreeReduceBlockSize - 1) / kTreeReduceBlockSize;
+      std::vector<T> partials(static_cast<size_t>(block_count));
+      concurrency::ThreadPool::TryParallelFor(
+          tp, block_count,
+          TensorOpCost{static_cast<double>(kTreeReduceBlockSize * sizeof(T)),
+                       static_cast<double>(sizeof(T)),
+                       static_cast<double>(kTreeReduceBlockSize)},
+          [input_size, from_data, &partials](std::ptrdiff_t first, std::ptrdiff_t end) {
+            for (std::ptrdiff_t block = first; block < end; ++block) {
+              int64_t begin = block * kTreeReduceBlockSize;
+              int64_t length = std::min(kTreeReduceBlockSize, input_size - begin);
+              partials[block] = AGG::aggblock(from_data + begin, length);
+            }
+          });
+      AGG accumulator(input_size, from_data[0]);
+      for (int64_t block = 0; block < block_count; ++block) {
+        accumulator.absorb(partials[static_cast<size_t>(block)]);
+      }
+      to_data[0] = accumulator.get_value();
+    } else {
+      to_data[0] = AGG(input_size, from_data[0]).aggall(from_data);
+    }
     return;
   }
 
   if (!last_results.equal(new_input_shape.GetDims(), reduced_axes)) {
     NoTransposePrepareForReduce(new_input_shape, reduced_axes, last_results);
-    if (last_results.last_loop_red_size == 0 || last_results.last_loop_size == 0)
-      return;
   }
+  if (last_results.last_loop_red_size == 0 || last_results.last_loop_size == 0)
+    return;
   ORT_ENFORCE(last_results.last_loop_red_size > 0);
   ORT_ENFORCE(last_results.last_loop_size > 0);
   ORT_ENFORCE(last_results.projected_index.size() > 0);
@@ -525,63 +559,81 @@ Status ReduceL1<T>::Compute(OpKernelContext* ctx) const {
   // axes do not either. It could be either cached in ctx or precomputed
   // in the constructor if shape and axes are known at this stage.
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorL1<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ReduceL2<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorL2<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ReduceLogSum<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorLogSum<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ReduceLogSumExp<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorLogSumExp<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ReduceMax<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorMax<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ReduceMean<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorMean<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ReduceMin<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorMin<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ReduceProd<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorProd<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ReduceSum<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorSum<T>>(ctx, axes_, keepdims_, last_results, noop_with_empty_axes_);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
@@ -629,29 +681,35 @@ Tensor ReduceSum<T>::Impl(const Tensor& input, const std::vector<int64_t>& reduc
 template <typename T>
 Status ReduceSumSquare<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   CommonReduce<T, ReduceAggregatorSumSquare<T>>(ctx, axes_, keepdims_, last_results);
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ArgMax<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   if (select_last_index_) {
     CommonReduce<T, ReduceAggregatorArgMaxLastIndex<T>>(ctx, axes_, keepdims_, last_results);
   } else {
     CommonReduce<T, ReduceAggregatorArgMax<T>>(ctx, axes_, keepdims_, last_results);
   }
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
 template <typename T>
 Status ArgMin<T>::Compute(OpKernelContext* ctx) const {
   ResultsNoTransposePrepareForReduce last_results;
+  LoadCachedPlan(last_results);
   if (select_last_index_) {
     CommonReduce<T, ReduceAggregatorArgMinLastIndex<T>>(ctx, axes_, keepdims_, last_results);
   } else {
     CommonReduce<T, ReduceAggregatorArgMin<T>>(ctx, axes_, keepdims_, last_results);
   }
+  SaveCachedPlan(last_results);
   return Status::OK();
 }
 
@@ -7,6 +7,7 @@
 #include "core/common/common.h"
 #include "core/common/optional.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/cpu/containers.h"
 #include "core/util/math_cpuonly.h"
 #include "core/platform/threadpool.h"
@@ -122,6 +123,13 @@ class ReduceAggregator {
   inline TVAL get_value() { return accumulator_; }
   inline void enforce(const ResultsNoTransposePrepareForReduce&) {}
   static inline bool two_loops() { return false; }
+
+  // Tree reduction support for reductions over the whole tensor: 'aggblock' computes the partial
+  // aggregate of a contiguous block and 'absorb' merges a partial into this accumulator. Only
+  // aggregators whose merge step is associative opt in by returning true from 'tree_reduce'.
+  static inline bool tree_reduce() { return false; }
+  static inline T aggblock(const T*, int64_t) { ORT_ENFORCE(false, "must be overloaded."); }
+  inline void absorb(const T&) { ORT_ENFORCE(false, "must be overloaded."); }
 };
 
 template <typename T, typename TVAL = T>
@@ -132,6 +140,11 @@ class ReduceAggregatorSum : public ReduceAggregator<T, TVAL> {
   inline TVAL aggall(const T* from_data) {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).sum();
   }
+  static inline bool tree_reduce() { return true; }
+  static inline T aggblock(const T* from_data, int64_t n) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).sum();
+  }
+  inline void absorb(const T& v) { this->accumulator_ += v; }
 };
 
 template <typename T, typename TVAL = T>
@@ -142,6 +155,11 @@ class ReduceAggregatorSumSquare : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).squaredNorm();
   }
   inline void update(const T& v) { this->accumulator_ += v * v; }
+  static inline bool tree_reduce() { return true; }
+  static inline T aggblock(const T* from_data, int64_t n) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).squaredNorm();
+  }
+  inline void absorb(const T& v) { this->accumulator_ += v; }
 };
 
 template <typename T, typename TVAL = T>
@@ -162,6 +180,11 @@ class ReduceAggregatorMax : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).maxCoeff();
   }
   inline void update(const T& v) { this->accumulator_ = v > this->accumulator_ ? v : this->accumulator_; }
+  static inline bool tree_reduce() { return true; }
+  static inline T aggblock(const T* from_data, int64_t n) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).maxCoeff();
+  }
+  inline void absorb(const T& v) { this->accumulator_ = v > this->accumulator_ ? v : this->accumulator_; }
 };
 
 template <typename T, typename TVAL = int64_t>
@@ -261,6 +284,11 @@ class ReduceAggregatorMin : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).minCoeff();
   }
   inline void update(const T& v) { this->accumulator_ = v < this->accumulator_ ? v : this->accumulator_; }
+  static inline bool tree_reduce() { return true; }
+  static inline T aggblock(const T* from_data, int64_t n) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).minCoeff();
+  }
+  inline void absorb(const T& v) { this->accumulator_ = v < this->accumulator_ ? v : this->accumulator_; }
 };
 
 template <typename T, typename TVAL = T>
@@ -271,6 +299,11 @@ class ReduceAggregatorProd : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).prod();
   }
   inline void update(const T& v) { this->accumulator_ *= v; }
+  static inline bool tree_reduce() { return true; }
+  static inline T aggblock(const T* from_data, int64_t n) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).prod();
+  }
+  inline void absorb(const T& v) { this->accumulator_ *= v; }
 };
 
 template <typename T, typename TVAL = T>
@@ -281,6 +314,11 @@ class ReduceAggregatorL1 : public ReduceAggregator<T, TVAL> {
     return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, this->N_).cwiseAbs().sum();
   }
   inline void update(const T& v) { this->accumulator_ += v > 0 ? v : -v; }
+  static inline bool tree_reduce() { return true; }
+  static inline T aggblock(const T* from_data, int64_t n) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).cwiseAbs().sum();
+  }
+  inline void absorb(const T& v) { this->accumulator_ += v; }
 };
 
 template <typename T, typename TVAL = T>
@@ -292,6 +330,11 @@ class ReduceAggregatorL2 : public ReduceAggregator<T, TVAL> {
   }
   inline void update(const T& v) { this->accumulator_ += v * v; }
   inline TVAL get_value() { return reduce_sqrt<T>(this->accumulator_); }
+  static inline bool tree_reduce() { return true; }
+  static inline T aggblock(const T* from_data, int64_t n) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).squaredNorm();
+  }
+  inline void absorb(const T& v) { this->accumulator_ += v; }
 };
 
 template <typename T, typename TVAL = T>
@@ -303,6 +346,11 @@ class ReduceAggregatorLogSum : public ReduceAggregator<T, TVAL> {
   }
   inline void update(const T& v) { this->accumulator_ += v; }
   inline TVAL get_value() { return reduce_log<T>(this->accumulator_); }
+  static inline bool tree_reduce() { return true; }
+  static inline T aggblock(const T* from_data, int64_t n) {
+    return Eigen::Map<const Eigen::Matrix<T, Eigen::Dynamic, 1>>(from_data, n).sum();
+  }
+  inline void absorb(const T& v) { this->accumulator_ += v; }
 };
 
 template <typename T, typename TVAL = T>
@@ -385,6 +433,25 @@ template <bool allow_multi_axes>
 class ReduceKernel : public OpKernel, public ReduceKernelBase<allow_multi_axes> {
  protected:
   ReduceKernel(const OpKernelInfo& info) : OpKernel(info), ReduceKernelBase<allow_multi_axes>(info) {}
+
+  // The loop plan built by NoTransposePrepareForReduce only depends on the input shape and the
+  // reduced axes, which are static for most models, so repeated Compute calls copy the cached plan
+  // instead of rebuilding the projected/unprojected index tables every time.
+  void LoadCachedPlan(ResultsNoTransposePrepareForReduce& plan) const {
+    std::lock_guard<OrtMutex> lock(plan_mutex_);
+    plan = cached_plan_;
+  }
+
+  void SaveCachedPlan(const ResultsNoTransposePrepareForReduce& plan) const {
+    std::lock_guard<OrtMutex> lock(plan_mutex_);
+    if (!cached_plan_.equal(plan.input_shape, plan.reduced_axes)) {
+      cached_plan_ = plan;
+    }
+  }
+
+ private:
+  mutable OrtMutex plan_mutex_;
+  mutable ResultsNoTransposePrepareForReduce cached_plan_;
 };
 
 template <typename T>
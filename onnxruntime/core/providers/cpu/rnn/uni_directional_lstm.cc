@@ -69,6 +69,15 @@ UniDirectionalLstm<T>::UniDirectionalLstm(
 
   clip_with_bias_ptr_ = use_bias_ ? deepcpu::clip_add_bias : deepcpu::clip_ignore_bias;
 
+  // The default activations (sigmoid for the i/o/f gates, tanh for the c gate and the hidden
+  // state) can be applied with the vectorized MLAS kernels in single passes over the contiguous
+  // gate buffers. Peepholes and input-forget interleave extra per-gate work, so those
+  // configurations use the general per-gate path.
+  fused_gate_activations_ = activation_f_.func == deepcpu::sigmoid &&
+                            activation_g_.func == deepcpu::tanh &&
+                            activation_h_.func == deepcpu::tanh_m &&
+                            !use_peepholes_ && !input_forget_;
+
   SetNumThreads();
   AllocateBuffers();
   InitializeBuffers(initial_hidden_state, initial_cell_state);
@@ -95,10 +104,13 @@ void UniDirectionalLstm<T>::AllocateBuffers() {
   output_iofc_ = Allocate(allocator_, hidden_size_ * 4 * batch_size_ * seq_length_, output_iofc_ptr_);
 
   if (use_bias_) {
-    bias_WRi_ = Allocate(allocator_, hidden_size_, bias_WRi_ptr_);
-    bias_WRf_ = Allocate(allocator_, hidden_size_, bias_WRf_ptr_);
-    bias_WRo_ = Allocate(allocator_, hidden_size_, bias_WRo_ptr_);
-    bias_WRc_ = Allocate(allocator_, hidden_size_, bias_WRc_ptr_);
+    // allocate the per-gate biases as one contiguous buffer in the i/o/f/c order of the GEMM
+    // output so the fused activation path can add all four gate biases in a single pass
+    bias_WRiofc_ = Allocate(allocator_, hidden_size_ * 4, bias_WRiofc_ptr_);
+    bias_WRi_ = bias_WRiofc_.subspan(0, hidden_size_);
+    bias_WRo_ = bias_WRiofc_.subspan(hidden_size_, hidden_size_);
+    bias_WRf_ = bias_WRiofc_.subspan(2 * hidden_size_, hidden_size_);
+    bias_WRc_ = bias_WRiofc_.subspan(3 * hidden_size_, hidden_size_);
   }
 
   if (direction_ == kReverse) {
@@ -439,6 +451,27 @@ void UniDirectionalLstm<T>::GateComputations(
 
     // DumpMatrix("C_prev" + row_str, pCprev_hidden_size, 1, hidden_size_);
 
+    if (fused_gate_activations_) {
+      // apply the bias/clip to all four gates at once, then the activations in two passes:
+      // sigmoid over the adjacent i/o/f gates and tanh over the c gate
+      const float* pBiofc = use_bias_ ? SafeRawConstPointer<T>(bias_WRiofc_, 0, hidden_size_x4) : nullptr;
+      clip_with_bias_ptr_(clip_, pBiofc, pi, hidden_size_x4);
+      MlasComputeLogistic(pi, pi, 3 * hidden_size_);
+      MlasComputeTanh(pc, pc, hidden_size_);
+
+      deepcpu::merge_lstm_gates_to_memory(pCprev_hidden_size, pi, pf, pc, pCprev_hidden_size, hidden_size_);
+
+      float* pH =
+          SafeRawPointer<T>(batched_output + row * hidden_size_ + b * hidden_size_, batched_output_end, hidden_size_);
+      float* pCt = SafeRawPointer<T>(C_prev_clipped + b * hidden_size_, C_prev_clipped_end, hidden_size_);
+      MlasComputeTanh(pCprev_hidden_size, pCt, hidden_size_);
+      for (int i = 0; i < hidden_size_; i++) {
+        pH[i] = po[i] * pCt[i];
+      }
+
+      continue;
+    }
+
     // Input Gate
     if (use_peepholes_) {
       deepcpu::elementwise_product(pCprev_hidden_size, SafeRawConstPointer<const T>(peephole_i_, 0, hidden_size_), pi,
@@ -6,6 +6,8 @@
 #include "core/providers/cpu/tensor/utils.h"
 #include "core/framework/TensorSeq.h"
 
+#include <cstring>
+
 using namespace onnxruntime::common;
 
 namespace onnxruntime {
@@ -39,8 +41,15 @@ Status ConcatFromSequence::Compute(OpKernelContext* ctx) const {
   if (p.output_num_elements == 0)
     return Status::OK();
 
+  // A contiguous sequence already holds its elements tightly packed in sequence order, so joining
+  // them along the leading axis (concatenating or stacking) is a single block copy.
+  if (X->IsContiguous() && !p.is_string_type && p.axis == 0) {
+    memcpy(p.output_tensor->MutableDataRaw(), X->Get(0).DataRaw(), p.output_tensor->SizeInBytes());
+    return Status::OK();
+  }
+
   // Compute values to be placed in the output tensor
-  return ComputeImpl(p);
+  return ComputeImpl(p, ctx->GetOperatorThreadPool());
 }
 
 }  // namespace onnxruntime
@@ -191,6 +191,48 @@ Status CreateCopyAndAppendCpuTensor(const Tensor& in_tensor, OpKernelContext* co
   return Status::OK();
 }
 
+// Copies the source tensors into a single allocation with their data tightly packed in order, and
+// hands both the individual views and the backing buffer to the output sequence. Pooling the
+// elements replaces N allocations with one and makes the sequence contiguous, which downstream
+// consumers such as ConcatFromSequence can exploit. String tensors cannot live in a raw buffer,
+// so they fall back to per-tensor allocations.
+static Status SetPooledElements(OpKernelContext* context, const std::vector<const Tensor*>& sources,
+                                TensorSeq& target) {
+  AllocatorPtr alloc;
+  ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+
+  if (!sources.empty() && sources[0]->IsDataTypeString()) {
+    std::vector<Tensor> tensors;
+    tensors.reserve(sources.size());
+    for (const auto* source : sources) {
+      ORT_RETURN_IF_ERROR(CreateCopyAndAppendCpuTensor(*source, context, tensors));
+    }
+    target.SetElements(std::move(tensors));
+    return Status::OK();
+  }
+
+  size_t total_bytes = 0;
+  for (const auto* source : sources) {
+    total_bytes += source->SizeInBytes();
+  }
+
+  // All elements share the data type of the sequence, so tight packing preserves the natural
+  // alignment of each element's data.
+  BufferUniquePtr storage(alloc->Alloc(total_bytes), BufferDeleter(alloc));
+  std::vector<Tensor> tensors;
+  tensors.reserve(sources.size());
+  size_t offset = 0;
+  for (const auto* source : sources) {
+    Tensor view(source->DataType(), source->Shape(), storage.get(), alloc->Info(),
+                static_cast<ptrdiff_t>(offset));
+    CopyCpuTensor(source, &view);
+    offset += source->SizeInBytes();
+    tensors.push_back(std::move(view));
+  }
+  target.SetElements(std::move(tensors), std::move(storage));
+  return Status::OK();
+}
+
 Status SequenceInsert::Compute(OpKernelContext* context) const {
   const auto* S = context->Input<TensorSeq>(0);
   ORT_ENFORCE(S != nullptr, "Got nullptr for sequence input.");
@@ -222,22 +264,20 @@ Status SequenceInsert::Compute(OpKernelContext* context) const {
 
   auto* Y = context->Output<TensorSeq>(0);
   ORT_ENFORCE(Y != nullptr, "SequenceInsert: Got nullptr for output sequence");
-  std::vector<Tensor> tensors;
-  tensors.reserve(num_tensors_input_seq + 1);
+  std::vector<const Tensor*> sources;
+  sources.reserve(num_tensors_input_seq + 1);
   for (int i = 0; i < num_tensors_input_seq; ++i) {
     if (i == input_seq_idx) {
-      CreateCopyAndAppendCpuTensor(*X, context, tensors);
-      CreateCopyAndAppendCpuTensor(S->Get(i), context, tensors);
-    } else {
-      CreateCopyAndAppendCpuTensor(S->Get(i), context, tensors);
+      sources.push_back(X);
     }
+    sources.push_back(&S->Get(i));
   }
   if (input_seq_idx == num_tensors_input_seq + 1) {
-    CreateCopyAndAppendCpuTensor(*X, context, tensors);
+    sources.push_back(X);
   }
 
   Y->SetType(S->DataType());
-  Y->SetElements(std::move(tensors));
+  ORT_RETURN_IF_ERROR(SetPooledElements(context, sources, *Y));
 
   return Status::OK();
 }
@@ -275,15 +315,15 @@ Status SequenceErase::Compute(OpKernelContext* context) const {
   auto* Y = context->Output<TensorSeq>(0);
   ORT_ENFORCE(Y != nullptr, "SequenceErase: Got nullptr for output sequence");
   Y->SetType(S->DataType());
-  std::vector<Tensor> tensors;
-  tensors.reserve(num_tensors_input_seq - 1);
+  std::vector<const Tensor*> sources;
+  sources.reserve(num_tensors_input_seq - 1);
   for (int i = 0; i < num_tensors_input_seq; ++i) {
     if (i == input_seq_idx) {
       continue;
     }
-    CreateCopyAndAppendCpuTensor(S->Get(i), context, tensors);
+    sources.push_back(&S->Get(i));
   }
-  Y->SetElements(std::move(tensors));
+  ORT_RETURN_IF_ERROR(SetPooledElements(context, sources, *Y));
   return Status::OK();
 }
 
@@ -315,13 +355,12 @@ Status SequenceConstruct::Compute(OpKernelContext* context) const {
 
   // now copy the tensors to the output sequence
   Y->SetType(first_dtype);
-  std::vector<Tensor> tensors;
-  tensors.reserve(num_inputs);
+  std::vector<const Tensor*> sources;
+  sources.reserve(num_inputs);
   for (int input_idx = 0; input_idx < num_inputs; ++input_idx) {
-    const auto* X = context->Input<Tensor>(input_idx);
-    CreateCopyAndAppendCpuTensor(*X, context, tensors);
+    sources.push_back(context->Input<Tensor>(input_idx));
   }
-  Y->SetElements(std::move(tensors));
+  ORT_RETURN_IF_ERROR(SetPooledElements(context, sources, *Y));
   return Status::OK();
 }
 
@@ -499,7 +538,9 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
   // copy dimensions so we can update the selected axis in place
   auto& input_dims = input_shape.GetDims();
   std::vector<int64_t> output_dimensions{input_dims};
-  std::vector<Tensor> tensors;
+  auto& tseq = *context.Output<TensorSeq>(0);
+  tseq.SetType(input.DataType());
+  tseq.Reserve(static_cast<size_t>(num_outputs));
   int64_t input_offset = 0;
   const T* input_data = input.template Data<T>();
   for (int i = 0; i < num_outputs; ++i) {
@@ -543,13 +584,9 @@ Status SplitToSequence::ComputeImpl(OpKernelContext& context, const Tensor& inpu
     }
 
     // finally move the resulting tensor to the output sequence
-    tensors.push_back(std::move(output_tensor));
+    tseq.Add(std::move(output_tensor));
   }
 
-  auto& tseq = *context.Output<TensorSeq>(0);
-  tseq.SetType(input.DataType());
-  tseq.SetElements(std::move(tensors));
-
   return Status::OK();
 }
 }  // namespace onnxruntime
@@ -22,9 +22,8 @@
 #include "Eigen/src/Core/arch/Default/BFloat16.h"
 #include "Eigen/src/Core/arch/Default/Half.h"
 
-#if defined(_M_AMD64)
 #include "core/mlas/inc/mlas.h"
-#endif
+#include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 
@@ -204,18 +203,41 @@ struct TensorCaster<std::string, DstType> {
   }
 };
 
-#if defined(_M_AMD64)
-// specializations to use optimized and Windows x64-specific
-// MlasConvertHalfToFloatBuffer() routine for MLFloat16 -> float conversion
+// specializations to use the optimized MlasConvertHalfToFloatBuffer() and
+// MlasConvertFloatToHalfBuffer() routines for MLFloat16 <-> float conversion,
+// chunked across the operator's thread pool for large tensors
 
 // tensor MLFloat16 -> float
 template <>
 struct TensorCaster<MLFloat16, float> {
-  void Cast(const OpKernelContext&, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
     auto out_data = out.MutableData<float>();
     auto in_data = in.Data<MLFloat16>();
-    const size_t shape_size = gsl::narrow<size_t>(shape.Size());
-    MlasConvertHalfToFloatBuffer(&in_data[0].val, out_data, shape_size);
+    const std::ptrdiff_t shape_size = gsl::narrow<std::ptrdiff_t>(shape.Size());
+    concurrency::ThreadPool::TryParallelFor(
+        context.GetOperatorThreadPool(), shape_size,
+        TensorOpCost{static_cast<double>(sizeof(MLFloat16)), static_cast<double>(sizeof(float)), 1.0},
+        [in_data, out_data](std::ptrdiff_t first, std::ptrdiff_t last) {
+          MlasConvertHalfToFloatBuffer(&in_data[first].val, out_data + first,
+                                       static_cast<size_t>(last - first));
+        });
+  }
+};
+
+// tensor float -> MLFloat16
+template <>
+struct TensorCaster<float, MLFloat16> {
+  void Cast(const OpKernelContext& context, const TensorShape& shape, const Tensor& in, Tensor& out) const {
+    auto out_data = out.MutableData<MLFloat16>();
+    auto in_data = in.Data<float>();
+    const std::ptrdiff_t shape_size = gsl::narrow<std::ptrdiff_t>(shape.Size());
+    concurrency::ThreadPool::TryParallelFor(
+        context.GetOperatorThreadPool(), shape_size,
+        TensorOpCost{static_cast<double>(sizeof(float)), static_cast<double>(sizeof(MLFloat16)), 1.0},
+        [in_data, out_data](std::ptrdiff_t first, std::ptrdiff_t last) {
+          MlasConvertFloatToHalfBuffer(in_data + first, &out_data[first].val,
+                                       static_cast<size_t>(last - first));
+        });
   }
 };
 
@@ -251,7 +273,6 @@ struct TensorCaster<MLFloat16, std::string> {
     CastMLFloat16ThroughFloatTensor<std::string>(context, shape, in, out);
   }
 };
-#endif
 
 class Cast final : public OpKernel {
  public:
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/tensor/compress.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 using namespace ::onnxruntime::common;
 
@@ -38,18 +39,22 @@ Status Compress::Compute(OpKernelContext* ctx) const {
   auto condition_length = condition->Shape().Size();
   auto condition_data = condition->template Data<bool>();
 
-  int64_t positive_condition_count = 0;
   // if has axis, we need to compress on dimension[axis], otherwise compress on the flattened input data
   int64_t compress_input_length = has_axis_ ? input_dimensions[axis] : input_tensor->Shape().Size();
   int64_t valid_condition_length = compress_input_length < condition_length ? compress_input_length : condition_length;
 
-  // Figure out output shape
-  for (int i = 0; i < valid_condition_length; ++i) {
+  // gather the selected indices once; this sizes the output and lets the copy
+  // loops below be sharded over the thread pool
+  std::vector<int64_t> selected_indices;
+  selected_indices.reserve(static_cast<size_t>(valid_condition_length));
+  for (int64_t i = 0; i < valid_condition_length; ++i) {
     if (condition_data[i]) {
-      ++positive_condition_count;
+      selected_indices.push_back(i);
     }
   }
 
+  int64_t positive_condition_count = static_cast<int64_t>(selected_indices.size());
+
   std::vector<int64_t> output_dims(input_dimensions);
   if (has_axis_) {
     output_dims[axis] = positive_condition_count;
@@ -88,34 +93,45 @@ Status Compress::Compute(OpKernelContext* ctx) const {
     if (!IAllocator::CalcMemSizeForArray(static_cast<size_t>(axes_right_stride), element_bytes,
                                          &axes_right_stride_bytes))
       return Status(ONNXRUNTIME, FAIL, "size overflow");
-    for (int i = 0; i < axes_left_stride; ++i) {
-      for (int j = 0; j < valid_condition_length; ++j) {
-        if (!condition_data[j]) {
-          continue;
-        }
-        if (is_string_type) {
+    if (is_string_type) {
+      for (int64_t i = 0; i < axes_left_stride; ++i) {
+        for (int64_t j : selected_indices) {
           for (int idxItem = 0; idxItem < axes_right_stride; ++idxItem) {
             reinterpret_cast<std::string*>(output_data)[output_index + idxItem] =
                 reinterpret_cast<const std::string*>(input_data)[i * axes_included_right_stride + j * axes_right_stride + idxItem];
           }
           output_index += axes_right_stride;
-        } else {
-          memcpy(output_data + output_index, input_data + i * axes_included_right_stride_bytes + j * axes_right_stride_bytes, axes_right_stride_bytes);
-          output_index += axes_right_stride_bytes;
         }
       }
+    } else {
+      // every (outer block, selected index) pair maps to a contiguous output slice, so the
+      // copies are independent and can be sharded
+      concurrency::ThreadPool::TryBatchParallelFor(
+          ctx->GetOperatorThreadPool(),
+          static_cast<ptrdiff_t>(axes_left_stride * positive_condition_count),
+          [&](ptrdiff_t task) {
+            const int64_t i = task / positive_condition_count;
+            const int64_t j = selected_indices[task % positive_condition_count];
+            memcpy(output_data + task * axes_right_stride_bytes,
+                   input_data + i * axes_included_right_stride_bytes + j * axes_right_stride_bytes,
+                   axes_right_stride_bytes);
+          },
+          0);
     }
   } else {
-    for (int i = 0; i < valid_condition_length; ++i) {
-      if (!condition_data[i]) {
-        continue;
-      }
-      if (is_string_type) {
+    if (is_string_type) {
+      for (int64_t i : selected_indices) {
         reinterpret_cast<std::string*>(output_data)[output_index] = reinterpret_cast<const std::string*>(input_data)[i];
-      } else {
-        memcpy(output_data + output_index * element_bytes, input_data + i * element_bytes, element_bytes);
+        ++output_index;
       }
-      ++output_index;
+    } else {
+      concurrency::ThreadPool::TryBatchParallelFor(
+          ctx->GetOperatorThreadPool(), static_cast<ptrdiff_t>(positive_condition_count),
+          [&](ptrdiff_t k) {
+            memcpy(output_data + k * element_bytes, input_data + selected_indices[k] * element_bytes,
+                   element_bytes);
+          },
+          0);
     }
   }
 
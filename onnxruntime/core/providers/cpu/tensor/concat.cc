@@ -2,11 +2,26 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/tensor/concat.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/framework/TensorSeq.h"
 
 namespace onnxruntime {
 
+namespace {
+// A contiguous run of bytes to be moved into the output buffer
+struct CopySegment {
+  const uint8_t* src;
+  uint8_t* dst;
+  size_t bytes;
+};
+
+// Large copies are chunked into segments of at most this many bytes so that even a
+// concatenation contributing a single contiguous block (e.g. concatenation along the
+// outermost axis) can be spread across the threads of the thread pool
+constexpr size_t kMaxBytesPerCopySegment = 1 << 18;  // 256 KB
+}  // namespace
+
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Concat,
     4,
@@ -160,10 +175,53 @@ Status ConcatBase::PrepareForCompute(OpKernelContext* ctx,
 }
 
 // This method computes the output tensor for Concat/ConcatFromSequence ops
-Status ConcatBase::ComputeImpl(Prepare& p) const {
+Status ConcatBase::ComputeImpl(Prepare& p, concurrency::ThreadPool* tp) const {
   int input_count = static_cast<int>(p.inputs.size());
   int64_t initial_output_offset = 0;  // initial offset for each input
   auto element_bytes = p.output_tensor->DataType()->Size();
+
+  // Strings need element-wise copy assignment - handle them with the simple sequential loop
+  if (p.is_string_type) {
+    std::string* output = static_cast<std::string*>(p.output_tensor->MutableDataRaw());
+    for (int input_index = 0; input_index < input_count; input_index++) {
+      const auto& prep = p.inputs[input_index];
+
+      // no data in this tensor - so skip it
+      if (prep.num_elements == 0)
+        continue;
+
+      auto input_axis_pitch = prep.axis_pitch;
+      const std::string* input = static_cast<const std::string*>(prep.tensor->DataRaw());
+
+      // Copy the data across. For every 'input_axis_pitch' values copied, we move over by the 'output_axis_pitch'
+      int64_t cur_out_offset = 0;
+      int64_t cur_in_offset = 0;
+      for (size_t idx_copy = 0, end = prep.num_elements / input_axis_pitch; idx_copy < end; ++idx_copy) {
+        size_t out = initial_output_offset + cur_out_offset;
+        for (int idx_item = 0; idx_item < input_axis_pitch; ++idx_item) {
+          output[out + idx_item] = input[cur_in_offset + idx_item];
+        }
+
+        cur_out_offset += p.output_axis_pitch;
+        cur_in_offset += input_axis_pitch;
+      }
+
+      initial_output_offset += input_axis_pitch;
+    }
+
+    return Status::OK();
+  }
+
+  // All other types are raw byte moves. Flatten the copies into a list of contiguous
+  // segments (chunking large blocks) so that they may be handed to the thread pool -
+  // this way even a concatenation along the outermost axis (a single contiguous block
+  // per input) gets split across threads
+  std::vector<CopySegment> segments;
+  segments.reserve(input_count);  // lower bound - each non-empty input contributes at least one segment
+
+  uint8_t* output = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
+  size_t total_bytes = 0;
+
   for (int input_index = 0; input_index < input_count; input_index++) {
     const auto& prep = p.inputs[input_index];
 
@@ -174,30 +232,24 @@ Status ConcatBase::ComputeImpl(Prepare& p) const {
     auto input_axis_pitch = prep.axis_pitch;
     const uint8_t* input = static_cast<const uint8_t*>(prep.tensor->DataRaw());
 
-    auto input_size = prep.num_elements;
+    const size_t block_bytes = static_cast<size_t>(input_axis_pitch) * element_bytes;
+    total_bytes += static_cast<size_t>(prep.num_elements) * element_bytes;
 
-    // Copy the data across. For every 'input_axis_pitch' values copied, we move over by the 'output_axis_pitch'
-    // TODO: Optimization possibility: There are cases where we simply need to "merge" raw buffers and this
-    // could be done without the pointer house-keeping as below. Some scenarios whether this is possible are:
-    // 1) Concatenating on input axis = 0
-    // 2) Stacking on output axis = 0
-    // 3) Stacking scalars
-    uint8_t* output = static_cast<uint8_t*>(p.output_tensor->MutableDataRaw());
+    // For every 'input_axis_pitch' values copied, we move over by the 'output_axis_pitch'
     int64_t cur_out_offset = 0;
     int64_t cur_in_offset = 0;
-    for (size_t idx_copy = 0, end = input_size / input_axis_pitch; idx_copy < end; ++idx_copy) {
-      if (p.is_string_type) {
-        size_t out = initial_output_offset + cur_out_offset;
-        for (int idx_item = 0; idx_item < input_axis_pitch; ++idx_item) {
-          reinterpret_cast<std::string*>(output)[out + idx_item] =
-              reinterpret_cast<const std::string*>(input)[cur_in_offset + idx_item];
-        }
-      } else {
-        memcpy(
-            output + (initial_output_offset + cur_out_offset) * element_bytes,
-            input + cur_in_offset * element_bytes,
-            input_axis_pitch * element_bytes);
+    for (size_t idx_copy = 0, end = prep.num_elements / input_axis_pitch; idx_copy < end; ++idx_copy) {
+      const uint8_t* src = input + cur_in_offset * element_bytes;
+      uint8_t* dst = output + (initial_output_offset + cur_out_offset) * element_bytes;
+
+      size_t remaining_bytes = block_bytes;
+      while (remaining_bytes > kMaxBytesPerCopySegment) {
+        segments.push_back({src, dst, kMaxBytesPerCopySegment});
+        src += kMaxBytesPerCopySegment;
+        dst += kMaxBytesPerCopySegment;
+        remaining_bytes -= kMaxBytesPerCopySegment;
       }
+      segments.push_back({src, dst, remaining_bytes});
 
       cur_out_offset += p.output_axis_pitch;
       cur_in_offset += input_axis_pitch;
@@ -206,6 +258,21 @@ Status ConcatBase::ComputeImpl(Prepare& p) const {
     initial_output_offset += input_axis_pitch;
   }
 
+  // Only involve the thread pool if there is enough data being moved for the copies
+  // to be split across threads meaningfully
+  if (tp == nullptr || segments.size() == 1 || total_bytes <= kMaxBytesPerCopySegment) {
+    for (const auto& segment : segments) {
+      memcpy(segment.dst, segment.src, segment.bytes);
+    }
+  } else {
+    concurrency::ThreadPool::TrySimpleParallelFor(
+        tp, static_cast<std::ptrdiff_t>(segments.size()),
+        [&segments](std::ptrdiff_t segment_index) {
+          const auto& segment = segments[segment_index];
+          memcpy(segment.dst, segment.src, segment.bytes);
+        });
+  }
+
   return Status::OK();
 }
 
@@ -232,7 +299,7 @@ Status Concat::Compute(OpKernelContext* ctx) const {
     return Status::OK();
 
   // Compute values to be placed in the output tensor
-  return ComputeImpl(p);
+  return ComputeImpl(p, ctx->GetOperatorThreadPool());
 }
 
 }  // namespace onnxruntime
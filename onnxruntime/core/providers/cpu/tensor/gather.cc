@@ -3,6 +3,10 @@
 
 //https://github.com/onnx/onnx/blob/master/docs/Operators.md#Gather
 #include "core/providers/cpu/tensor/gather.h"
+
+#include <algorithm>
+#include <utility>
+
 #include "core/common/common.h"
 #include "core/platform/threadpool.h"
 #include "core/providers/op_kernel_type_control.h"
@@ -23,6 +27,12 @@ using EnabledIndexTypes = ORT_OP_KERNEL_ARG_ENABLED_TYPE_LIST_ALL_OPSETS(kCpuExe
 
 const auto supported_index_type_constraints = BuildKernelDefConstraintsFromTypeList<SupportedIndexTypes>();
 const auto enabled_index_type_constraints = BuildKernelDefConstraintsFromTypeList<EnabledIndexTypes>();
+
+// Thresholds for the index-sorted gather path. Only large lookups of small rows from a single
+// batch benefit from reordering the copies by source row: with fewer indices the sort overhead
+// dominates, and rows spanning a page are already read mostly sequentially.
+constexpr int64_t kSortedAccessMinIndices = 4096;
+constexpr int64_t kSortedAccessMaxBlockBytes = 4096;
 }  // namespace
 
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
@@ -97,6 +107,33 @@ Status GatherCopyData(const Tensor* indices_tensor, const uint8_t* src_base, uin
     }
   }
 
+  // For large gathers of small rows from a single batch (the embedding lookup case), random
+  // indices touch pages of the data tensor in arbitrary order and the copy loop becomes TLB and
+  // page bound. Visiting the indices in source order keeps the reads walking the data tensor
+  // sequentially; the scattered writes land in the smaller output buffer. The order only changes
+  // the copy schedule, not the result.
+  if (!is_string_type && M == 1 && N >= kSortedAccessMinIndices && block_size <= kSortedAccessMaxBlockBytes) {
+    std::vector<std::pair<Tin, int64_t>> sorted_indices(static_cast<size_t>(N));
+    for (int64_t i = 0; i < N; ++i) {
+      Tin idx = indices_data[i];
+      idx = idx < 0 ? idx + static_cast<Tin>(axis_dim_limit) : idx;
+      sorted_indices[static_cast<size_t>(i)] = std::make_pair(idx, i);
+    }
+    std::sort(sorted_indices.begin(), sorted_indices.end());
+
+    concurrency::ThreadPool::TryParallelFor(
+        tp, N, static_cast<double>(block_size),
+        [&sorted_indices, src_base, dst_base, block_size](ptrdiff_t first, ptrdiff_t last) {
+          for (ptrdiff_t entry = first; entry < last; ++entry) {
+            const int64_t src_offset = static_cast<int64_t>(sorted_indices[entry].first) * block_size;
+            const int64_t dst_offset = sorted_indices[entry].second * block_size;
+            memcpy(dst_base + dst_offset, src_base + src_offset, block_size);
+          }
+        });
+
+    return Status::OK();
+  }
+
   auto lambda = [&](int64_t index) {
     int64_t batch = index / N;
     int64_t i = index % N;
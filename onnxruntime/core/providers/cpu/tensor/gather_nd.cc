@@ -2,10 +2,22 @@
 // Licensed under the MIT License.
 
 #include "gather_nd.h"
+
+#include <algorithm>
+#include <utility>
+
 #include "core/platform/threadpool.h"
 
 namespace onnxruntime {
 
+namespace {
+// Thresholds for the slice-sorted gather path. Only large gathers of small slices benefit from
+// reordering the copies by source offset: with fewer slices the sort overhead dominates, and
+// slices spanning a page are already read mostly sequentially.
+constexpr int64_t kSortedAccessMinSlices = 4096;
+constexpr int64_t kSortedAccessMaxSliceBytes = 4096;
+}  // namespace
+
 // Register a kernel for kMsDomain (contrib op) GatherND
 #ifndef DISABLE_CONTRIB_OPS
 
@@ -172,6 +184,33 @@ Status GatherND::Compute(OpKernelContext* context) const {
 }
 
 Status GatherND::GatherNumber(const Prepare& p, concurrency::ThreadPool* tp) const {
+  // For large gathers of small slices, random indices touch pages of the input tensor in
+  // arbitrary order and the copy loop becomes TLB and page bound. Visiting the slices in source
+  // offset order keeps the reads walking the input tensor sequentially; the scattered writes
+  // land in the smaller output buffer. The order only changes the copy schedule, not the result.
+  const int64_t num_slices = static_cast<int64_t>(p.slice_offsets.size());
+  if (num_slices >= kSortedAccessMinSlices &&
+      p.bytes_per_slice <= static_cast<uint64_t>(kSortedAccessMaxSliceBytes)) {
+    std::vector<std::pair<uint64_t, int64_t>> sorted_slices(static_cast<size_t>(num_slices));
+    for (int64_t slice_idx = 0; slice_idx < num_slices; ++slice_idx) {
+      sorted_slices[static_cast<size_t>(slice_idx)] =
+          std::make_pair(p.slice_offsets[slice_idx], slice_idx);
+    }
+    std::sort(sorted_slices.begin(), sorted_slices.end());
+
+    concurrency::ThreadPool::TryParallelFor(
+        tp, num_slices, static_cast<double>(p.bytes_per_slice),
+        [&sorted_slices, &p](ptrdiff_t first, ptrdiff_t last) {
+          for (ptrdiff_t entry = first; entry < last; ++entry) {
+            memcpy(p.output_base + sorted_slices[entry].second * p.bytes_per_slice,
+                   p.input_base + sorted_slices[entry].first * p.element_bytes,
+                   p.bytes_per_slice);
+          }
+        });
+
+    return Status::OK();
+  }
+
   auto lambda = [&](int64_t slice_idx) {
     memcpy(p.output_base + slice_idx * p.bytes_per_slice, p.input_base + p.slice_offsets[slice_idx] * p.element_bytes,
            p.bytes_per_slice);
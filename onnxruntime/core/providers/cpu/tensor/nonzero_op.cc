@@ -6,6 +6,7 @@
 #include <cassert>
 #include <vector>
 
+#include "core/platform/threadpool.h"
 #include "core/util/math_cpuonly.h"
 
 namespace onnxruntime {
@@ -59,59 +60,85 @@ Status NonZero<T>::Compute(OpKernelContext* context) const {
   const auto& X_shape = X->Shape();
   assert(X_shape.Size() >= 0);
 
-  const Eigen::Index coordinate_size = X_shape.IsScalar() ? 1 : X_shape.NumDimensions();
-  std::vector<int64_t> non_zero_indices_buffer{};
-  // reserve enough space for indices for every element of X
-  non_zero_indices_buffer.reserve(X_shape.Size() * coordinate_size);
-
+  const int64_t coordinate_size = X_shape.IsScalar() ? 1 : X_shape.NumDimensions();
   const T* data = X->Data<T>();
 
   if (X_shape.IsScalar()) {
-    const T& value = *data;
-    if (value != T{}) {
-      non_zero_indices_buffer.push_back(0);
-    }
-  } else {
-    std::vector<int64_t> coordinate(coordinate_size, 0);
-
-    // as we iterate the entries, increment the coordinate for the current entry
-    // e.g. if shape is {2,2}, we start with 0,0 increment to 0,1 increment to 1,0 and finally 1,1
-    auto increment_coordinate = [&coordinate, &coordinate_size, &X_shape]() {
-      for (int64_t idx = coordinate_size - 1; idx >= 0; --idx) {
-        int64_t& cur_coord = coordinate[idx];
-        if (cur_coord != X_shape[idx] - 1) {
-          ++cur_coord;
-          break;
-        }
-        cur_coord = 0;
-      }
-    };
-
-    for (size_t i = 0, end = X_shape.Size(); i < end; ++i) {
-      const T& value = *data++;
-      if (value != T{}) {
-        non_zero_indices_buffer.insert(non_zero_indices_buffer.end(),
-                                       coordinate.begin(), coordinate.end());
-      }
-
-      increment_coordinate();
+    const bool non_zero = (*data != T{});
+    Tensor* const Y = context->Output(0, {1, non_zero ? 1 : 0});
+    ORT_ENFORCE(Y, "failed to get first output!");
+    if (non_zero) {
+      *Y->MutableData<int64_t>() = 0;
     }
+    return Status::OK();
   }
 
-  const Eigen::Index num_non_zero_values = non_zero_indices_buffer.size() / coordinate_size;
+  const int64_t total = X_shape.Size();
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
 
-  // transpose result for output
-  ConstEigenMatrixMapRowMajor<int64_t> non_zero_indices_matrix{
-      non_zero_indices_buffer.data(),
-      num_non_zero_values, coordinate_size};
+  const int64_t num_shards =
+      std::max<int64_t>(1, std::min<int64_t>(concurrency::ThreadPool::DegreeOfParallelism(tp), total));
+
+  // first pass: count the non-zero entries per shard. the branch-free predicate sum
+  // vectorizes, so sizing the output costs one streaming read of the data.
+  std::vector<int64_t> shard_offsets(static_cast<size_t>(num_shards) + 1, 0);
+
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_shards), [&](std::ptrdiff_t shard) {
+        const auto work = concurrency::ThreadPool::PartitionWork(shard, static_cast<std::ptrdiff_t>(num_shards),
+                                                                 static_cast<std::ptrdiff_t>(total));
+        int64_t count = 0;
+        for (std::ptrdiff_t i = work.start; i < work.end; ++i) {
+          count += (data[i] != T{}) ? 1 : 0;
+        }
+        shard_offsets[shard + 1] = count;
+      });
+
+  for (int64_t shard = 0; shard < num_shards; ++shard) {
+    shard_offsets[shard + 1] += shard_offsets[shard];
+  }
+
+  const int64_t num_non_zero_values = shard_offsets[num_shards];
 
   Tensor* const Y = context->Output(0, {coordinate_size, num_non_zero_values});
   ORT_ENFORCE(Y, "failed to get first output!");
+  int64_t* const y_data = Y->MutableData<int64_t>();
+
+  // second pass: every shard writes its coordinates at its exclusive offset, directly in the
+  // transposed [coordinate_size, num_non_zero_values] output layout.
+  concurrency::ThreadPool::TrySimpleParallelFor(
+      tp, static_cast<std::ptrdiff_t>(num_shards), [&](std::ptrdiff_t shard) {
+        const auto work = concurrency::ThreadPool::PartitionWork(shard, static_cast<std::ptrdiff_t>(num_shards),
+                                                                 static_cast<std::ptrdiff_t>(total));
+
+        // decompose the shard's first flat index into a coordinate, then keep it incremented
+        // in lockstep with the scan
+        std::vector<int64_t> coordinate(coordinate_size, 0);
+        int64_t remaining = work.start;
+        for (int64_t idx = coordinate_size - 1; idx >= 0; --idx) {
+          coordinate[idx] = remaining % X_shape[idx];
+          remaining /= X_shape[idx];
+        }
 
-  EigenMatrixMapRowMajor<int64_t> y_matrix{
-      Y->MutableData<int64_t>(),
-      coordinate_size, num_non_zero_values};
-  y_matrix = non_zero_indices_matrix.transpose();
+        int64_t pos = shard_offsets[shard];
+        for (std::ptrdiff_t i = work.start; i < work.end; ++i) {
+          if (data[i] != T{}) {
+            for (int64_t idx = 0; idx < coordinate_size; ++idx) {
+              y_data[idx * num_non_zero_values + pos] = coordinate[idx];
+            }
+            ++pos;
+          }
+
+          for (int64_t idx = coordinate_size - 1; idx >= 0; --idx) {
+            int64_t& cur_coord = coordinate[idx];
+            if (cur_coord != X_shape[idx] - 1) {
+              ++cur_coord;
+              break;
+            }
+            cur_coord = 0;
+          }
+        }
+      });
 
   return Status::OK();
 }
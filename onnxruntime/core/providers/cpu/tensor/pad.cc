@@ -7,6 +7,7 @@
 #ifdef _MSC_VER
 #pragma warning(disable : 4996)
 #endif
+#include "core/platform/threadpool.h"
 #include "core/util/math.h"
 #include "core/providers/cpu/tensor/pad.h"
 #include "core/providers/cpu/tensor/utils.h"
@@ -111,6 +112,143 @@ static void PadAxisConstant(T* output, T constant, size_t size) {
   }
 }
 
+// Parallel row-based fast path for the common case of no negative pads. The padded tensor is
+// treated as a stack of innermost-axis rows: interior rows are written with one contiguous copy
+// plus specialized inner pre/post pad handling, and rows that lie in the padded outer region are
+// either filled (constant mode) or copied whole from the interior row they mirror (edge/reflect).
+// Both passes are sharded over the operator thread pool. Returns false when the shape needs the
+// general iterator-based path.
+template <typename T>
+static bool PadParallel(OpKernelContext* ctx,
+                        const std::vector<int64_t>& reshaped_input_dims,
+                        const std::vector<int64_t>& reshaped_pad,
+                        size_t inner_no_pad_size,
+                        const Mode& mode,
+                        T value,
+                        const T* input,
+                        T* output) {
+  const size_t nd = reshaped_input_dims.size();
+  const size_t inner_axis = nd - 1;
+
+  const int64_t inner_pre_pad = reshaped_pad[inner_axis];
+  const int64_t inner_post_pad = reshaped_pad[inner_axis + nd];
+  const int64_t inner_input_size = reshaped_input_dims[inner_axis];
+  const int64_t inner_output_size = inner_input_size + inner_pre_pad + inner_post_pad;
+
+  // the specialized inner edge handling for edge/reflect modes needs element granularity on the
+  // innermost axis; a flattened inner axis is only supported when it carries no padding
+  if (mode != Mode::Constant && inner_no_pad_size != 1 && (inner_pre_pad != 0 || inner_post_pad != 0)) {
+    return false;
+  }
+
+  // a single reflection must stay inside the data
+  if (mode == Mode::Reflect && (inner_pre_pad >= inner_input_size || inner_post_pad >= inner_input_size)) {
+    return false;
+  }
+
+  int64_t outer_input_rows = 1;
+  int64_t outer_output_rows = 1;
+  std::vector<int64_t> outer_output_dims(inner_axis);
+
+  for (size_t i = 0; i < inner_axis; ++i) {
+    outer_output_dims[i] = reshaped_input_dims[i] + reshaped_pad[i] + reshaped_pad[i + nd];
+    outer_input_rows *= reshaped_input_dims[i];
+    outer_output_rows *= outer_output_dims[i];
+
+    if (mode == Mode::Reflect &&
+        (reshaped_pad[i] >= reshaped_input_dims[i] || reshaped_pad[i + nd] >= reshaped_input_dims[i])) {
+      return false;
+    }
+  }
+
+  std::vector<int64_t> outer_output_strides(inner_axis);
+  int64_t stride = 1;
+  for (size_t i = inner_axis; i-- > 0;) {
+    outer_output_strides[i] = stride;
+    stride *= outer_output_dims[i];
+  }
+
+  concurrency::ThreadPool* tp = ctx->GetOperatorThreadPool();
+
+  // first pass: interior rows. one contiguous copy each plus the inner-axis padding.
+  concurrency::ThreadPool::TryBatchParallelFor(
+      tp, static_cast<ptrdiff_t>(outer_input_rows),
+      [&](ptrdiff_t row) {
+        int64_t remaining = row;
+        int64_t output_row = 0;
+        for (size_t i = inner_axis; i-- > 0;) {
+          const int64_t coord = remaining % reshaped_input_dims[i];
+          remaining /= reshaped_input_dims[i];
+          output_row += (coord + reshaped_pad[i]) * outer_output_strides[i];
+        }
+
+        const T* src = input + row * inner_input_size;
+        T* dst = output + output_row * inner_output_size;
+
+        memcpy(dst + inner_pre_pad, src, inner_input_size * sizeof(T));
+
+        switch (mode) {
+          case Mode::Constant:
+            PadAxisConstant(dst, value, inner_pre_pad);
+            PadAxisConstant(dst + inner_pre_pad + inner_input_size, value, inner_post_pad);
+            break;
+          case Mode::Edge:
+            PadAxisConstant(dst, src[0], inner_pre_pad);
+            PadAxisConstant(dst + inner_pre_pad + inner_input_size, src[inner_input_size - 1], inner_post_pad);
+            break;
+          case Mode::Reflect:
+            PadInnermostAxis(dst, dst + inner_pre_pad * 2, -1 /* inputDelta */, inner_pre_pad);
+            PadInnermostAxis(dst + inner_pre_pad + inner_input_size,
+                             dst + inner_pre_pad + inner_input_size - 2, -1 /* inputDelta */, inner_post_pad);
+            break;
+        }
+      },
+      0);
+
+  // second pass: rows living in the padded outer region. filled for constant mode, whole-row
+  // copies of the interior row they map to for edge/reflect. interior rows are complete after
+  // the first pass, so every source row is already written.
+  concurrency::ThreadPool::TryBatchParallelFor(
+      tp, static_cast<ptrdiff_t>(outer_output_rows),
+      [&](ptrdiff_t row) {
+        int64_t remaining = row;
+        int64_t source_row = 0;
+        bool is_interior = true;
+
+        for (size_t i = inner_axis; i-- > 0;) {
+          const int64_t coord = remaining % outer_output_dims[i] - reshaped_pad[i];
+          remaining /= outer_output_dims[i];
+
+          int64_t source_coord = coord;
+          if (coord < 0 || coord >= reshaped_input_dims[i]) {
+            is_interior = false;
+            if (mode == Mode::Edge) {
+              source_coord = coord < 0 ? 0 : reshaped_input_dims[i] - 1;
+            } else if (mode == Mode::Reflect) {
+              source_coord = coord < 0 ? -coord : 2 * reshaped_input_dims[i] - 2 - coord;
+            }
+          }
+
+          source_row += (source_coord + reshaped_pad[i]) * outer_output_strides[i];
+        }
+
+        if (is_interior) {
+          return;  // written by the first pass
+        }
+
+        T* dst = output + row * inner_output_size;
+
+        if (mode == Mode::Constant) {
+          PadAxisConstant(dst, value, inner_output_size);
+        } else {
+          memcpy(dst, output + source_row * inner_output_size, inner_output_size * sizeof(T));
+        }
+      },
+      0);
+
+  return true;
+}
+
 Status PadBase::HandleDimValueZero(const Mode& mode, const TensorShape& input_shape, TensorShape& output_shape) {
   switch (mode) {
     case Mode::Constant: {
@@ -269,6 +407,18 @@ static Status PadImpl(OpKernelContext* ctx,
   auto& output_tensor = *ctx->Output(0, output_shape);
   auto* output = reinterpret_cast<T*>(output_tensor.MutableDataRaw());
 
+  // parallel fast path for the common case with no negative pads
+  bool has_slices = false;
+  for (int64_t s : slices) {
+    has_slices |= (s != 0);
+  }
+
+  if (!has_slices &&
+      PadParallel(ctx, reshaped_input_dims, reshaped_pad, inner_no_pad_size, mode, value,
+                  reinterpret_cast<const T*>(input_tensor.DataRaw()), output)) {
+    return Status::OK();
+  }
+
   TensorPitches output_pitches(reshaped_output_dims);
   size_t alignSkip = 0;  // Amount to skip to align to where the next input tensor data needs to be written
 
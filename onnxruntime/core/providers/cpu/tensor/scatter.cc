@@ -4,6 +4,7 @@
 //https://github.com/onnx/onnx/blob/master/docs/Operators.md#Scatter
 #include "core/common/common.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #if defined(ENABLE_TRAINING) || defined(ENABLE_TRAINING_OPS)
 #include "orttraining/training_ops/cpu/tensor/gather_elements_grad_impl.h"
@@ -62,7 +63,8 @@ struct Func_Assignment {
 
 template <class Tin, class Tdata, typename FuncT>
 Status CopyScatterData(const FuncT& func, const Tensor* data_input, const Tensor* indices_input, const Tensor* updates_input,
-                       const int64_t axis, Tensor* data_output) {
+                       const int64_t axis, Tensor* data_output,
+                       concurrency::ThreadPool* tp) {
   const TensorShape& input_data_shape = data_input->Shape();
   const Tin* indices_data_raw = indices_input->template Data<Tin>();
   const auto num_indices = indices_input->Shape().Size();
@@ -111,18 +113,6 @@ Status CopyScatterData(const FuncT& func, const Tensor* data_input, const Tensor
   const auto num_dims = input_data_shape.NumDimensions();
   assert(num_dims > 0);
 
-  // Allocate and zero out counts. The input/output is of the same rank as
-  // indices/updates but the actual dimensions of indices/updates must be less or equal
-  // than that of input/output because we can update no more elements than
-  // the input contains. As we walk through the indices/updates
-  // we maintain dimension count as we will need to use it
-  // to compute output offset but using input/output dim values.
-  // We treat the whole array as a number where each element having
-  // different cardinality according to the upd_shape dimensions.
-  // As each counter reaches its max (upd_shape) it resets to zero
-  // and we carry to the more significant dim (right to left)
-  std::vector<int64_t> dim_counters(num_dims);
-
   // This vector contains number of elements under the dimension.
   // For example, for the dimensions of [4, 2, 3] the vector
   // would contain [6, 3, 1] since for each count of dim 1 it
@@ -150,42 +140,52 @@ Status CopyScatterData(const FuncT& func, const Tensor* data_input, const Tensor
     }
   }
 
-  const auto* update_data = static_cast<const Tdata*>(updates_input->DataRaw());
-  // For every update we compute the destination offset and copy it there
-  for (int64_t index = 0; index < num_indices;) {
-    const Tin axis_idx = indices_data[index];
-
-    // Compute the offset
-    // See comments above for dim_block_size
-    size_t dst_offset = 0;
-    for (size_t i = 0; i < num_dims; ++i) {
-      if (i == size_t(axis)) {
-        // replace the counter with the update index for this dim
-        dst_offset += axis_idx * dim_block_size[i];
-      } else {
-        dst_offset += dim_counters[i] * dim_block_size[i];
-      }
+  // Element counts per dimension of the updates tensor, same layout as dim_block_size
+  // but built from upd_shape. Used to step through the updates along a single axis fiber.
+  std::vector<int64_t> upd_block_size(num_dims);
+  upd_block_size.back() = 1;
+  if (num_dims > 1) {
+    for (auto i = int64_t(num_dims - 2); i >= 0; --i) {
+      upd_block_size[i] = upd_shape[i + 1] * upd_block_size[i + 1];
     }
+  }
 
-    func(dst_base + dst_offset, update_data + index);
+  const auto* update_data = static_cast<const Tdata*>(updates_input->DataRaw());
+
+  // Updates are applied one axis fiber at a time. Two updates can only land on the same
+  // output element when all their non-axis coordinates match, i.e. when they belong to the
+  // same fiber, so distinct fibers write disjoint output regions and run in parallel without
+  // atomics. Within a fiber the elements are applied in index order, which preserves the
+  // serial last-write-wins semantics for duplicate indices exactly.
+  const int64_t upd_axis_dim = upd_shape[axis];
+  const int64_t num_fibers = upd_axis_dim > 0 ? num_indices / upd_axis_dim : 0;
+
+  concurrency::ThreadPool::TryBatchParallelFor(
+      tp, static_cast<ptrdiff_t>(num_fibers),
+      [&](ptrdiff_t fiber) {
+        // decompose the fiber id into the non-axis coordinates and derive both the fixed part
+        // of the destination offset and the fiber's base offset into indices/updates
+        int64_t remaining = fiber;
+        int64_t dst_fixed = 0;
+        int64_t upd_base = 0;
+        for (auto i = int64_t(num_dims - 1); i >= 0; --i) {
+          if (i == axis) {
+            continue;
+          }
+          const int64_t coord = remaining % upd_shape[i];
+          remaining /= upd_shape[i];
+          dst_fixed += coord * dim_block_size[i];
+          upd_base += coord * upd_block_size[i];
+        }
+
+        for (int64_t k = 0; k < upd_axis_dim; ++k) {
+          const int64_t index = upd_base + k * upd_block_size[axis];
+          const int64_t dst_offset = dst_fixed + indices_data[index] * dim_block_size[axis];
+          func(dst_base + dst_offset, update_data + index);
+        }
+      },
+      0);
 
-    if (++index == num_indices) {
-      break;
-    }
-    // Increment counters
-    // See comments for dim_counters above
-    for (auto i = int64_t(num_dims - 1); i >= 0; --i) {
-      auto v = ++dim_counters[i];
-      assert(v <= upd_shape[i]);
-      if (v < upd_shape[i]) {
-        // No carry, done
-        break;
-      }
-      // No carry for the most significant dim
-      assert(i > 0);
-      dim_counters[i] = 0;
-    }
-  }
   return Status::OK();
 }
 
@@ -245,10 +245,12 @@ Status Scatter::Compute(OpKernelContext* context) const {
 
   MLDataType Tdata_type = data_input->DataType();
   Status status;
+  concurrency::ThreadPool* tp = context->GetOperatorThreadPool();
+
   if (indices_input->IsDataType<int32_t>()) {
-    DispatchOnTensorTypeWithReturn(Tdata_type, status, CopyInt32Index, data_input, indices_input, updates_input, axis, data_output);
+    DispatchOnTensorTypeWithReturn(Tdata_type, status, CopyInt32Index, data_input, indices_input, updates_input, axis, data_output, tp);
   } else if (indices_input->IsDataType<int64_t>()) {
-    DispatchOnTensorTypeWithReturn(Tdata_type, status, CopyInt64Index, data_input, indices_input, updates_input, axis, data_output);
+    DispatchOnTensorTypeWithReturn(Tdata_type, status, CopyInt64Index, data_input, indices_input, updates_input, axis, data_output, tp);
   } else {
     return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Expecting indices to be either int32_t or int64_t");
   }
@@ -269,7 +271,8 @@ struct Func_Add {
 template <class Tin, class Tdata>
 Status GatherElementsGradImpl(const Tensor* indices_input, const Tensor* updates_input,
                               const int64_t axis, Tensor* data_output) {
-  return CopyScatterData<Tin, Tdata>(Func_Add<Tdata>(), data_output, indices_input, updates_input, axis, data_output);
+  return CopyScatterData<Tin, Tdata>(Func_Add<Tdata>(), data_output, indices_input, updates_input, axis, data_output,
+                                     nullptr);
 }
 
 #define GATHER_ELEMENTS_GRAD_IMPL_SPECIALIZED(Tin, Tdata)         \
@@ -6,6 +6,8 @@
 #include "core/providers/common.h"
 #include "core/providers/op_kernel_type_control.h"
 #include "core/providers/op_kernel_type_control_utils.h"
+#include "core/platform/threadpool.h"
+#include <cstring>
 #include <unordered_map>
 #include <limits>
 
@@ -300,6 +302,29 @@ Status SliceBase::FillVectorsFromInput(const Tensor& start_tensor,
   return Status::OK();
 }
 
+namespace {
+// Copies one innermost-dimension run. A run is contiguous in the output; it is contiguous in the
+// input too when 'step' is 1, in which case it collapses to a memcpy.
+template <typename T>
+void CopyRun(T* dst, const T* src, int64_t run_len, int64_t step) {
+  if (step == 1) {
+    memcpy(dst, src, run_len * sizeof(T));
+  } else {
+    for (int64_t i = 0; i < run_len; ++i) {
+      dst[i] = src[i * step];
+    }
+  }
+}
+
+// std::string elements need real assignments, never memcpy
+template <>
+void CopyRun<std::string>(std::string* dst, const std::string* src, int64_t run_len, int64_t step) {
+  for (int64_t i = 0; i < run_len; ++i) {
+    dst[i] = src[i * step];
+  }
+}
+}  // namespace
+
 template <typename T>
 static Status SliceImpl(OpKernelContext* ctx,
                         const Tensor& input_tensor,
@@ -311,40 +336,77 @@ static Status SliceImpl(OpKernelContext* ctx,
   if (output_shape.Size() == 0)
     return Status::OK();
 
-  // use MutableDataRaw as actual data type in tensor may not match as we templatize on data size
+  // work against the flattened dims when the innermost dims were combined, so the contiguous
+  // runs copied below are maximal.
+  // as we're combining the innermost dims and keeping all values we can just copy the size of the last dim
+  const std::vector<int64_t>* output_dims = &compute_metadata.output_dims_;
+  std::vector<int64_t> input_dims(input_tensor.Shape().GetDims());
+  if (compute_metadata.p_flattened_output_dims_) {
+    output_dims = compute_metadata.p_flattened_output_dims_;
+    input_dims.resize(output_dims->size());
+    input_dims.back() = output_dims->back();
+  }
+
+  const auto& starts = compute_metadata.starts_;
+  const auto& steps = compute_metadata.steps_;
+  const size_t rank = output_dims->size();
+
+  // input strides in elements
+  std::vector<int64_t> input_strides(rank);
+  input_strides[rank - 1] = 1;
+  for (size_t d = rank - 1; d > 0; --d) {
+    input_strides[d - 1] = input_strides[d] * input_dims[d];
+  }
+
+  // the output is a sequence of innermost-dimension runs, one per combination of outer indices
+  const int64_t run_len = output_dims->back();
+  const int64_t inner_step = steps[rank - 1];
+  int64_t num_runs = 1;
+  for (size_t d = 0; d + 1 < rank; ++d) {
+    num_runs *= (*output_dims)[d];
+  }
+
+  // use the raw data pointers as the actual data type in the tensor may not match since we
+  // templatize on data size
+  const T* input = reinterpret_cast<const T*>(input_tensor.DataRaw());
   T* output = reinterpret_cast<T*>(output_tensor.MutableDataRaw());
-  const auto* output_end = output + output_tensor.Shape().Size();
 
-  auto create_output = [&output, &output_end](SliceIterator<T>& input_iterator) {
-    if (input_iterator.SolitaryInnerStep()) {
-      while (output < output_end) {
-        output = input_iterator.CopyInnermostAxisSolitaryInnerStep(output);
-      }
-    } else {
-      while (output < output_end) {
-        output = input_iterator.CopyInnermostAxisNonSolitaryInnerStep(output);
-      }
+  auto copy_runs = [&, output_dims](std::ptrdiff_t first_run, std::ptrdiff_t last_run) {
+    // seek to first_run: decompose it into an index over the outer dims and accumulate the
+    // input offset of the run's first element
+    std::vector<int64_t> outer_idx(rank - 1, 0);
+    int64_t offset = starts[rank - 1];
+    int64_t remaining = first_run;
+    for (size_t d = rank - 1; d > 0; --d) {
+      const size_t outer = d - 1;
+      outer_idx[outer] = remaining % (*output_dims)[outer];
+      remaining /= (*output_dims)[outer];
+      offset += (starts[outer] + outer_idx[outer] * steps[outer]) * input_strides[outer];
     }
 
-    ORT_ENFORCE(output == output_end);
+    for (std::ptrdiff_t run = first_run; run != last_run; ++run) {
+      CopyRun(output + run * run_len, input + offset, run_len, inner_step);
+
+      // advance the outer index odometer-style and keep the input offset in sync
+      for (size_t d = rank - 1; d > 0; --d) {
+        const size_t outer = d - 1;
+        ++outer_idx[outer];
+        offset += steps[outer] * input_strides[outer];
+        if (outer_idx[outer] < (*output_dims)[outer])
+          break;
+        outer_idx[outer] = 0;
+        offset -= (*output_dims)[outer] * steps[outer] * input_strides[outer];
+      }
+    }
   };
 
-  if (compute_metadata.p_flattened_output_dims_) {
-    // if we have flattened output dims we need to also flatten the input dims.
-    // as we're combining the innermost dims and keeping all values we can just copy the size of the last dim
-    std::vector<int64_t> flattened_input_dims(input_tensor.Shape().GetDims());
-    flattened_input_dims.resize(compute_metadata.p_flattened_output_dims_->size());
-    flattened_input_dims.back() = compute_metadata.p_flattened_output_dims_->back();
-    TensorShape input_shape(std::move(flattened_input_dims));
-
-    auto input_iterator = SliceIterator<T>(input_tensor, input_shape, compute_metadata.starts_,
-                                           *compute_metadata.p_flattened_output_dims_, compute_metadata.steps_);
-    create_output(input_iterator);
-  } else {
-    auto input_iterator = SliceIterator<T>(input_tensor, compute_metadata.starts_, compute_metadata.output_dims_,
-                                           compute_metadata.steps_);
-    create_output(input_iterator);
-  }
+  // shard the runs across the intra-op pool. each run reads and writes run_len elements, so
+  // large slices parallelize while small ones stay on the calling thread.
+  concurrency::ThreadPool::TryParallelFor(
+      ctx->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(num_runs),
+      {static_cast<double>(run_len * sizeof(T)), static_cast<double>(run_len * sizeof(T)),
+       static_cast<double>(run_len)},
+      copy_runs);
 
   return Status::OK();
 }
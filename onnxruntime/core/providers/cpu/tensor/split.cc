@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #include "core/providers/cpu/tensor/split.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/util/math.h"
 #include "core/util/math_cpuonly.h"
@@ -10,6 +11,20 @@
 
 namespace onnxruntime {
 
+namespace {
+// A contiguous run of bytes to be moved into one of the output buffers
+struct CopySegment {
+  const uint8_t* src;
+  uint8_t* dst;
+  size_t bytes;
+};
+
+// Large copies are chunked into segments of at most this many bytes so that even a
+// split along the outermost axis (a single contiguous block per output) can be
+// spread across the threads of the thread pool
+constexpr size_t kMaxBytesPerCopySegment = 1 << 18;  // 256 KB
+}  // namespace
+
 ONNX_CPU_OPERATOR_VERSIONED_KERNEL(
     Split,
     2,
@@ -158,6 +173,18 @@ Status Split::ComputeImpl(OpKernelContext& context, const Tensor& input) const {
   int64_t input_offset = 0;
   const T* input_data = input.template Data<T>();
 
+  // For all types other than string the copies are raw byte moves. Flatten them into a
+  // list of contiguous segments (chunking large blocks) so that they may be handed to
+  // the thread pool - this way even a split along the outermost axis (a single
+  // contiguous block per output) gets split across threads.
+  // Strings need element-wise copy assignment and stay on the sequential path.
+  const bool is_string_type = std::is_same<T, std::string>::value;
+
+  std::vector<CopySegment> segments;
+  if (!is_string_type) {
+    segments.reserve(num_outputs);  // lower bound - each output contributes at least one segment
+  }
+
   for (int i = 0; i < num_outputs; ++i) {
     // update size of dimension for axis we're splitting on
     auto split_size = gsl::narrow<int>(split_sizes[i]);
@@ -166,20 +193,57 @@ Status Split::ComputeImpl(OpKernelContext& context, const Tensor& input) const {
     Tensor* output = context.Output(i, TensorShape{output_dimensions});
     T* output_data = output->template MutableData<T>();
 
-    ::onnxruntime::math::CopyMatrix<T>(
-        before_dims,                                       // M
-        split_size * after_dims_excluding_split,           // N
-        static_cast<const T*>(input_data + input_offset),  // A
-        after_dims_including_split_axis,                   // lda
-        static_cast<T*>(output_data),                      // B
-        split_size * after_dims_excluding_split,           // ldb
-        [](const T* src, T* dst, size_t count) {
-          copy_data<T>(src, dst, count);
-        });
+    if (is_string_type) {
+      ::onnxruntime::math::CopyMatrix<T>(
+          before_dims,                                       // M
+          split_size * after_dims_excluding_split,           // N
+          static_cast<const T*>(input_data + input_offset),  // A
+          after_dims_including_split_axis,                   // lda
+          static_cast<T*>(output_data),                      // B
+          split_size * after_dims_excluding_split,           // ldb
+          [](const T* src, T* dst, size_t count) {
+            copy_data<T>(src, dst, count);
+          });
+    } else {
+      const int64_t N = static_cast<int64_t>(split_size) * after_dims_excluding_split;
+      for (int row = 0; row < before_dims; ++row) {
+        const uint8_t* src =
+            reinterpret_cast<const uint8_t*>(input_data + input_offset + row * after_dims_including_split_axis);
+        uint8_t* dst = reinterpret_cast<uint8_t*>(output_data + row * N);
+
+        size_t remaining_bytes = static_cast<size_t>(N) * sizeof(T);
+        while (remaining_bytes > kMaxBytesPerCopySegment) {
+          segments.push_back({src, dst, kMaxBytesPerCopySegment});
+          src += kMaxBytesPerCopySegment;
+          dst += kMaxBytesPerCopySegment;
+          remaining_bytes -= kMaxBytesPerCopySegment;
+        }
+        segments.push_back({src, dst, remaining_bytes});
+      }
+    }
 
     input_offset += split_size * after_dims_excluding_split;  // offset by the N data we used in this iteration
   }
 
+  if (!is_string_type) {
+    // Only involve the thread pool if there is enough data being moved for the copies
+    // to be split across threads meaningfully
+    concurrency::ThreadPool* tp = context.GetOperatorThreadPool();
+    const size_t total_bytes = static_cast<size_t>(input_shape.Size()) * sizeof(T);
+    if (tp == nullptr || segments.size() == 1 || total_bytes <= kMaxBytesPerCopySegment) {
+      for (const auto& segment : segments) {
+        memcpy(segment.dst, segment.src, segment.bytes);
+      }
+    } else {
+      concurrency::ThreadPool::TrySimpleParallelFor(
+          tp, static_cast<std::ptrdiff_t>(segments.size()),
+          [&segments](std::ptrdiff_t segment_index) {
+            const auto& segment = segments[segment_index];
+            memcpy(segment.dst, segment.src, segment.bytes);
+          });
+    }
+  }
+
   return Status::OK();
 }
 
@@ -10,6 +10,7 @@
 #endif
 
 #include "gsl/gsl"
+#include "core/platform/threadpool.h"
 #include "core/providers/cpu/tensor/tile.h"
 #include "core/providers/cpu/tensor/utils.h"
 
@@ -134,6 +135,46 @@ bool IsTileMemcpy(const TensorShape& input_shape,
   }
   return false;
 }
+
+// Fill 'num_copies' consecutive copies of the 'block_bytes' sized block at 'input' into 'output'.
+// Each shard seeds itself with a single copy of the input block and then doubles the replicated
+// span (1 -> 2 -> 4 -> ... blocks per memcpy), so large outputs are built with a handful of wide
+// copies instead of one memcpy per repetition. The shards are distributed over the thread pool
+// when there are enough of them to be worth the dispatch.
+static void ReplicateBlock(concurrency::ThreadPool* thread_pool,
+                           const int8_t* input,
+                           int8_t* output,
+                           size_t block_bytes,
+                           size_t num_copies) {
+  auto replicate_fn =
+      [=](ptrdiff_t first, ptrdiff_t last) {
+        if (first == last) {
+          return;
+        }
+        int8_t* shard_output = output + first * static_cast<ptrdiff_t>(block_bytes);
+        memcpy(shard_output, input, block_bytes);
+        auto shard_copies = static_cast<size_t>(last - first);
+        size_t copied = 1;
+        while (copied < shard_copies) {
+          size_t copies_this_pass = std::min(copied, shard_copies - copied);
+          memcpy(shard_output + copied * block_bytes, shard_output, copies_this_pass * block_bytes);
+          copied += copies_this_pass;
+        }
+      };
+
+  auto per_thread_tasks =
+      num_copies / concurrency::ThreadPool::DegreeOfParallelism(thread_pool);
+
+  if (per_thread_tasks > 4) {
+    concurrency::ThreadPool::TryParallelFor(
+        thread_pool,
+        static_cast<std::ptrdiff_t>(num_copies),
+        static_cast<double>(block_bytes),
+        replicate_fn);
+  } else {
+    replicate_fn(0, static_cast<ptrdiff_t>(num_copies));
+  }
+}
 }  // namespace TileOp
 
 Status Tile::Compute(OpKernelContext* ctx) const {
@@ -195,25 +236,19 @@ Status Tile::Compute(OpKernelContext* ctx) const {
 
     int8_t* output_data_casted = reinterpret_cast<int8_t*>(output_tensor.MutableDataRaw());
     const int8_t* input_data_casted = reinterpret_cast<const int8_t*>(input_tensor.DataRaw());
-    const void* input_data_raw = input_tensor.DataRaw();
+    auto* thread_pool = ctx->GetOperatorThreadPool();
 
     if (!is_batched_memcpy) {
-      size_t copy_bytes = input_tensor.SizeInBytes();
-      // TODO: Add multi-threading logic if num_of_copies_per_batch is large enough
-      for (size_t i = 0; i < num_of_copies_per_batch; ++i) {
-        memcpy(static_cast<void*>(output_data_casted), input_data_raw, copy_bytes);
-        output_data_casted += copy_bytes;
-      }
+      TileOp::ReplicateBlock(thread_pool, input_data_casted, output_data_casted,
+                             input_tensor.SizeInBytes(), num_of_copies_per_batch);
     } else {
       size_t copy_bytes = num_of_elements_per_batch * input_tensor.DataType()->Size();
       size_t batch_count = static_cast<size_t>(input_tensor.Shape()[0]);  // The tensor is atleast 1-D- this is safe
 
-      // TODO: Multi-thread if needed
       for (size_t batch = 0; batch < batch_count; ++batch) {
-        for (size_t i = 0; i < num_of_copies_per_batch; ++i) {
-          memcpy(static_cast<void*>(output_data_casted), static_cast<const void*>(input_data_casted), copy_bytes);
-          output_data_casted += copy_bytes;
-        }
+        TileOp::ReplicateBlock(thread_pool, input_data_casted, output_data_casted,
+                               copy_bytes, num_of_copies_per_batch);
+        output_data_casted += copy_bytes * num_of_copies_per_batch;
         input_data_casted += copy_bytes;
       }
 
@@ -222,12 +257,8 @@ Status Tile::Compute(OpKernelContext* ctx) const {
         // reset some values
         output_data_casted = reinterpret_cast<int8_t*>(output_tensor.MutableDataRaw());
         copy_bytes *= num_of_copies_per_batch * batch_count;
-        int8_t* copy_ptr = output_data_casted + copy_bytes;
-
-        for (size_t i = 1; i < num_of_batch_copies; ++i) {
-          memcpy(static_cast<void*>(copy_ptr), static_cast<const void*>(output_data_casted), copy_bytes);
-          copy_ptr += copy_bytes;
-        }
+        TileOp::ReplicateBlock(thread_pool, output_data_casted, output_data_casted + copy_bytes,
+                               copy_bytes, num_of_batch_copies - 1);
       }
     }
 
@@ -302,64 +302,37 @@ Status UpsampleLinear(const T* input,
 // the scale values for the outermost 2 dimensions are 1.
 // This is the common use-case where the 4-D input (batched multi-channel images)
 // is usually of shape [N, C, H, W] and the scales are [1.0, 1.0, height_scale, width_scale]
-template <typename T>
-void UpsampleBilinear(int64_t batch_size,
-                      int64_t num_channels,
-                      int64_t input_height,
-                      int64_t input_width,
-                      int64_t output_height,
-                      int64_t output_width,
-                      float height_scale,
-                      float width_scale,
-                      const std::vector<float>& roi,
-                      bool use_extrapolation,
-                      float extrapolation_value,
-                      const T* XdataBase,
-                      T* YdataBase,
-                      AllocatorPtr& alloc,
-                      GetOriginalCoordinateFunc get_original_coordinate,
-                      concurrency::ThreadPool* tp) {
-  std::vector<float> y_original;
-  y_original.reserve(output_height);
-
-  std::vector<float> x_original;
-  x_original.reserve(output_width);
-
-  // For each index in the output height and output width, cache its corresponding indices in the input
-  // while multiplying it with the input stride for that dimension (cache because we don't have to re-compute
-  // each time we come across the output width/ output height value while iterating the output image tensor
-  SafeInt<size_t> idx_buffer_size = SafeInt<size_t>(2) * sizeof(int64_t) * (output_height + output_width);
-
-  // For each index in the output height and output width, cache its corresponding "weights/scales" for its
-  // corresponding indices in the input which proportionately indicates how much they will influence the final
-  // pixel value in the output
-  // (cache because we don't have to re-compute each time we come across the output width/ output height value while iterating the output image tensor
-  SafeInt<size_t> scale_buffer_size = SafeInt<size_t>(2) * sizeof(float_t) * (output_height + output_width);
-
-  // Limit number of allocations to just 1
-  auto inx_scale_data_buffer = alloc->Alloc(idx_buffer_size + scale_buffer_size);
-  BufferUniquePtr idx_scale_data_buffer_holder(inx_scale_data_buffer, BufferDeleter(alloc));
-
-  // Get pointers to appropriate memory locations in the scratch buffer
-  auto* idx_data = static_cast<int64_t*>(idx_scale_data_buffer_holder.get());
-
-  // input_width is the stride for the height dimension
-  int64_t* input_width_mul_y1 = idx_data;
-  int64_t* input_width_mul_y2 = input_width_mul_y1 + output_height;
-
-  // stride for width is 1 (no multiplication needed)
-  int64_t* in_x1 = input_width_mul_y1 + 2 * output_height;
-  int64_t* in_x2 = in_x1 + output_width;
-
-  auto* scale_data = reinterpret_cast<float*>(in_x2 + output_width);
-
-  float* dy1 = scale_data;
-  float* dy2 = dy1 + output_height;
-
-  float* dx1 = dy1 + 2 * output_height;
-  float* dx2 = dx1 + output_width;
+// Builds the per-axis index/weight tables for the bilinear path. For each index in the output
+// height and output width this caches the corresponding indices in the input (pre-multiplied by
+// the input stride for the height dimension) along with the interpolation weights that indicate
+// how much each input pixel influences the output pixel. The tables only depend on the shapes,
+// scales and roi, so the caller caches them across identically shaped calls.
+static void SetupUpsampleBilinear(int64_t input_height,
+                                  int64_t input_width,
+                                  int64_t output_height,
+                                  int64_t output_width,
+                                  float height_scale,
+                                  float width_scale,
+                                  const std::vector<float>& roi,
+                                  const GetOriginalCoordinateFunc& get_original_coordinate,
+                                  BilinearParams& p) {
+  p.SetKey(input_height, input_width, output_height, output_width, height_scale, width_scale, roi);
+
+  p.y_original.clear();
+  p.y_original.reserve(output_height);
+
+  p.x_original.clear();
+  p.x_original.reserve(output_width);
+
+  p.input_width_mul_y1.resize(output_height);
+  p.input_width_mul_y2.resize(output_height);
+  p.in_x1.resize(output_width);
+  p.in_x2.resize(output_width);
+  p.dy1.resize(output_height);
+  p.dy2.resize(output_height);
+  p.dx1.resize(output_width);
+  p.dx2.resize(output_width);
 
-  // Start processing
   auto roi_y_start = roi.size() / 2 - 2;
   auto roi_y_end = roi.size() - 2;
   for (int64_t y = 0; y < output_height; ++y) {
@@ -368,21 +341,21 @@ void UpsampleBilinear(int64_t batch_size,
                                                              static_cast<float>(output_height),
                                                              static_cast<float>(input_height),
                                                              roi[roi_y_start], roi[roi_y_end]);
-    y_original.emplace_back(in_y);
+    p.y_original.emplace_back(in_y);
     in_y = std::max(0.0f, std::min(in_y, static_cast<float>(input_height - 1)));
 
     const int64_t in_y1 = std::min(static_cast<int64_t>(in_y), input_height - 1);
     const int64_t in_y2 = std::min(in_y1 + 1, input_height - 1);
-    dy1[y] = std::fabs(in_y - in_y1);
-    dy2[y] = std::fabs(in_y - in_y2);
+    p.dy1[y] = std::fabs(in_y - in_y1);
+    p.dy2[y] = std::fabs(in_y - in_y2);
 
     if (in_y1 == in_y2) {
-      dy1[y] = 0.5f;
-      dy2[y] = 0.5f;
+      p.dy1[y] = 0.5f;
+      p.dy2[y] = 0.5f;
     }
 
-    input_width_mul_y1[y] = input_width * in_y1;
-    input_width_mul_y2[y] = input_width * in_y2;
+    p.input_width_mul_y1[y] = input_width * in_y1;
+    p.input_width_mul_y2[y] = input_width * in_y2;
   }
 
   auto roi_x_start = roi.size() / 2 - 1;
@@ -394,51 +367,97 @@ void UpsampleBilinear(int64_t batch_size,
                                                             static_cast<float>(output_width),
                                                             static_cast<float>(input_width),
                                                             roi[roi_x_start], roi[roi_x_end]);
-    x_original.emplace_back(in_x);
+    p.x_original.emplace_back(in_x);
     in_x = std::max(0.0f, std::min(in_x, static_cast<float>(input_width - 1)));
 
-    in_x1[x] = std::min(static_cast<int64_t>(in_x), input_width - 1);
-    in_x2[x] = std::min(in_x1[x] + 1, input_width - 1);
+    p.in_x1[x] = std::min(static_cast<int64_t>(in_x), input_width - 1);
+    p.in_x2[x] = std::min(p.in_x1[x] + 1, input_width - 1);
 
-    dx1[x] = std::fabs(in_x - in_x1[x]);
-    dx2[x] = std::fabs(in_x - in_x2[x]);
-    if (in_x1[x] == in_x2[x]) {
-      dx1[x] = 0.5f;
-      dx2[x] = 0.5f;
+    p.dx1[x] = std::fabs(in_x - p.in_x1[x]);
+    p.dx2[x] = std::fabs(in_x - p.in_x2[x]);
+    if (p.in_x1[x] == p.in_x2[x]) {
+      p.dx1[x] = 0.5f;
+      p.dx2[x] = 0.5f;
     }
   }
-  
- for (int64_t n = 0; n < batch_size; ++n) {
-    concurrency::ThreadPool::TrySimpleParallelFor(tp, num_channels,
-                                                  [&](std::ptrdiff_t c) {
-                                                    const T* Xdata = XdataBase + (n * num_channels + c) * (input_height * input_width);
-                                                    T* Ydata = YdataBase + (n * num_channels + c) * (output_height * output_width);
-                                                    for (int64_t y = 0; y < output_height; ++y) {
-                                                      for (int64_t x = 0; x < output_width; ++x) {
-                                                        // when use_extrapolation is set and original index of x or y is out of the dim range
-                                                        // then use extrapolation_value as the output value.
-                                                        if (use_extrapolation &&
-                                                            ((y_original[y] < 0 || y_original[y] > static_cast<float>(input_height - 1)) ||
-                                                             (x_original[x] < 0 || x_original[x] > static_cast<float>(input_width - 1)))) {
-                                                          Ydata[output_width * y + x] = static_cast<T>(extrapolation_value);
-                                                          continue;
-                                                        }
+}
 
-                                                        T X11 = Xdata[input_width_mul_y1[y] + in_x1[x]];
-                                                        T X21 = Xdata[input_width_mul_y1[y] + in_x2[x]];
-                                                        T X12 = Xdata[input_width_mul_y2[y] + in_x1[x]];
-                                                        T X22 = Xdata[input_width_mul_y2[y] + in_x2[x]];
+template <typename T>
+void UpsampleBilinear(int64_t batch_size,
+                      int64_t num_channels,
+                      int64_t input_height,
+                      int64_t input_width,
+                      int64_t output_height,
+                      int64_t output_width,
+                      bool use_extrapolation,
+                      float extrapolation_value,
+                      const T* XdataBase,
+                      T* YdataBase,
+                      const BilinearParams& p,
+                      concurrency::ThreadPool* tp) {
+  const int64_t input_plane = input_height * input_width;
+  const int64_t output_plane = output_height * output_width;
+
+  // parallelize across every output row of every image and channel so that inputs with few
+  // channels (e.g. 3-channel video frames) still spread across all threads
+  const int64_t total_rows = batch_size * num_channels * output_height;
+
+  concurrency::ThreadPool::TryParallelFor(
+      tp, total_rows, static_cast<double>(output_width) * 4.0,
+      [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (int64_t r = first; r < last; ++r) {
+          const int64_t y = r % output_height;
+          const int64_t nc = r / output_height;
+
+          const T* Xdata = XdataBase + nc * input_plane;
+          T* Ydata = YdataBase + nc * output_plane + y * output_width;
+
+          // when use_extrapolation is set and the original index of y is out of the dim range
+          // the whole output row takes the extrapolation_value.
+          if (use_extrapolation &&
+              (p.y_original[y] < 0 || p.y_original[y] > static_cast<float>(input_height - 1))) {
+            std::fill_n(Ydata, output_width, static_cast<T>(extrapolation_value));
+            continue;
+          }
 
-                                                        Ydata[output_width * y + x] = static_cast<T>(dx2[x] * dy2[y] * X11 +
-                                                                                                     dx1[x] * dy2[y] * X21 +
-                                                                                                     dx2[x] * dy1[y] * X12 +
-                                                                                                     dx1[x] * dy1[y] * X22);
-                                                      }
-                                                    }
-                                                    Xdata += input_height * input_width;
-                                                    Ydata += output_width * output_height;
-                                                  });
-  }
+          // hoist the row-invariant values so the inner loop only does the per-column work
+          const T* Xrow1 = Xdata + p.input_width_mul_y1[y];
+          const T* Xrow2 = Xdata + p.input_width_mul_y2[y];
+          const float dy1_value = p.dy1[y];
+          const float dy2_value = p.dy2[y];
+
+          if (use_extrapolation) {
+            for (int64_t x = 0; x < output_width; ++x) {
+              if (p.x_original[x] < 0 || p.x_original[x] > static_cast<float>(input_width - 1)) {
+                Ydata[x] = static_cast<T>(extrapolation_value);
+                continue;
+              }
+
+              T X11 = Xrow1[p.in_x1[x]];
+              T X21 = Xrow1[p.in_x2[x]];
+              T X12 = Xrow2[p.in_x1[x]];
+              T X22 = Xrow2[p.in_x2[x]];
+
+              Ydata[x] = static_cast<T>(p.dx2[x] * dy2_value * X11 +
+                                        p.dx1[x] * dy2_value * X21 +
+                                        p.dx2[x] * dy1_value * X12 +
+                                        p.dx1[x] * dy1_value * X22);
+            }
+          } else {
+            for (int64_t x = 0; x < output_width; ++x) {
+              T X11 = Xrow1[p.in_x1[x]];
+              T X21 = Xrow1[p.in_x2[x]];
+              T X12 = Xrow2[p.in_x1[x]];
+              T X22 = Xrow2[p.in_x2[x]];
+
+              Ydata[x] = static_cast<T>(p.dx2[x] * dy2_value * X11 +
+                                        p.dx1[x] * dy2_value * X21 +
+                                        p.dx2[x] * dy1_value * X12 +
+                                        p.dx1[x] * dy1_value * X22);
+            }
+          }
+        }
+      });
 }
 
 // The following method supports a 5-D input in 'Linear mode'
@@ -898,13 +917,28 @@ Status Upsample<T>::BaseCompute(OpKernelContext* context,
         const int64_t output_height = is_2D ? output_dims[0] : output_dims[2];
         const int64_t output_width = is_2D ? output_dims[1] : output_dims[3];
 
-        AllocatorPtr alloc;
-        ORT_RETURN_IF_ERROR(context->GetTempSpaceAllocator(&alloc));
+        const float height_scale = is_2D ? scales[0] : scales[2];
+        const float width_scale = is_2D ? scales[1] : scales[3];
+
+        // reuse the cached per-axis index/weight tables when the shapes, scales and roi are
+        // unchanged from the previous call, and copy them out so the interpolation below runs
+        // without holding the lock
+        BilinearParams params;
+        {
+          std::lock_guard<OrtMutex> lock(bilinear_params_mutex_);
+          if (!bilinear_params_cache_.SameAs(input_height, input_width, output_height, output_width,
+                                             height_scale, width_scale, roi)) {
+            SetupUpsampleBilinear(input_height, input_width, output_height, output_width,
+                                  height_scale, width_scale, roi, get_original_coordinate_,
+                                  bilinear_params_cache_);
+          }
+          params = bilinear_params_cache_;
+        }
+
         UpsampleBilinear(batch_size, num_channels, input_height, input_width, output_height, output_width,
-                         is_2D ? scales[0] : scales[2], is_2D ? scales[1] : scales[3], roi,
                          use_extrapolation_, extrapolation_value_, X->template Data<T>(),
-                         Y->template MutableData<T>(), alloc, get_original_coordinate_, 
-                         output_height*output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
+                         Y->template MutableData<T>(), params,
+                         output_height * output_width > 64 ? context->GetOperatorThreadPool() : nullptr);
         return Status::OK();
       } else if (dims.size() == 3 || dims.size() == 5) {
         //'trilinear' == 3-D input or 5-D input with outermost 2 scales as 1
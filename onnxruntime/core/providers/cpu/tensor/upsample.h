@@ -4,6 +4,7 @@
 #pragma once
 
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
 #include <cmath>
 
 namespace onnxruntime {
@@ -351,6 +352,49 @@ class UpsampleBase {
   }
 };  // UpsampleBase
 
+// Precomputed per-axis index/weight tables for the 2-D/4-D (NCHW) bilinear path. The tables only
+// depend on the shapes, scales and roi, so the kernel instance caches them across calls - video
+// style workloads resize many identically shaped frames per session.
+struct BilinearParams {
+  std::vector<float> y_original;
+  std::vector<float> x_original;
+  std::vector<int64_t> input_width_mul_y1;
+  std::vector<int64_t> input_width_mul_y2;
+  std::vector<int64_t> in_x1;
+  std::vector<int64_t> in_x2;
+  std::vector<float> dy1;
+  std::vector<float> dy2;
+  std::vector<float> dx1;
+  std::vector<float> dx2;
+
+  bool SameAs(int64_t input_height, int64_t input_width, int64_t output_height, int64_t output_width,
+              float height_scale, float width_scale, const std::vector<float>& roi) const {
+    return input_height_ == input_height && input_width_ == input_width &&
+           output_height_ == output_height && output_width_ == output_width &&
+           height_scale_ == height_scale && width_scale_ == width_scale && roi_ == roi;
+  }
+
+  void SetKey(int64_t input_height, int64_t input_width, int64_t output_height, int64_t output_width,
+              float height_scale, float width_scale, const std::vector<float>& roi) {
+    input_height_ = input_height;
+    input_width_ = input_width;
+    output_height_ = output_height;
+    output_width_ = output_width;
+    height_scale_ = height_scale;
+    width_scale_ = width_scale;
+    roi_ = roi;
+  }
+
+ private:
+  int64_t input_height_{-1};
+  int64_t input_width_{-1};
+  int64_t output_height_{-1};
+  int64_t output_width_{-1};
+  float height_scale_{0.f};
+  float width_scale_{0.f};
+  std::vector<float> roi_;
+};
+
 template <typename T>
 class Upsample : public UpsampleBase, public OpKernel {
  public:
@@ -361,6 +405,12 @@ class Upsample : public UpsampleBase, public OpKernel {
 
   Status BaseCompute(OpKernelContext* context, const std::vector<float>& roi, const std::vector<float>& scales,
                      const std::vector<int64_t>& output_dims) const;
+
+ private:
+  // cached per-axis bilinear index/weight tables. rebuilt under the lock when the shapes,
+  // scales or roi change, and copied out so the interpolation runs without holding the lock.
+  mutable OrtMutex bilinear_params_mutex_;
+  mutable BilinearParams bilinear_params_cache_;
 };
 
 }  // namespace onnxruntime
@@ -51,7 +51,8 @@ ONNX_OPERATOR_KERNEL_EX(Loop,
                             .TypeConstraint("V", DataTypeImpl::AllFixedSizeTensorTypes()),
                         Loop);
 
-static Status ConcatenateGpuOutput(void* stream, std::vector<OrtValue>& per_iteration_output,
+static Status ConcatenateGpuOutput(void* stream, concurrency::ThreadPool* /*tp*/,
+                                   std::vector<OrtValue>& per_iteration_output,
                                    void* output, ptrdiff_t output_size_in_bytes) {
   const auto& first_output = per_iteration_output.front().Get<Tensor>();
   const auto& per_iteration_shape = first_output.Shape();
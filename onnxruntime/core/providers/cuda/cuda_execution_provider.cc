@@ -13,6 +13,7 @@
 #include "core/providers/cuda/cuda_fence.h"
 #include "core/providers/cuda/cuda_fwd.h"
 #include "core/providers/cuda/gpu_data_transfer.h"
+#include "core/providers/cuda/nn/cudnn_conv_algo_cache.h"
 
 #ifndef DISABLE_CONTRIB_OPS
 #include "contrib_ops/cuda/cuda_contrib_kernels.h"
@@ -88,9 +89,18 @@ AllocatorPtr CUDAExecutionProvider::CreateCudaAllocator(OrtDevice::DeviceId devi
 }
 
 CUDAExecutionProvider::PerThreadContext::PerThreadContext(OrtDevice::DeviceId device_id, cudaStream_t stream, size_t cuda_mem_limit,
-                                                          ArenaExtendStrategy arena_extend_strategy, CUDAExecutionProviderExternalAllocatorInfo external_allocator_info) {
+                                                          ArenaExtendStrategy arena_extend_strategy, CUDAExecutionProviderExternalAllocatorInfo external_allocator_info,
+                                                          bool use_own_stream) {
   CUDA_CALL_THROW(cudaSetDevice(device_id));
-  stream_ = stream;
+  if (use_own_stream) {
+    // stream pool mode: this context's stream carries the work of whichever
+    // Run() thread has the context checked out, so concurrent runs overlap
+    CUDA_CALL_THROW(cudaStreamCreateWithFlags(&stream_, cudaStreamNonBlocking));
+    owns_stream_ = true;
+    stream = stream_;
+  } else {
+    stream_ = stream;
+  }
 
   CUBLAS_CALL_THROW(cublasCreate(&cublas_handle_));
   CUBLAS_CALL_THROW(cublasSetStream(cublas_handle_, stream));
@@ -117,6 +127,10 @@ CUDAExecutionProvider::PerThreadContext::~PerThreadContext() {
   } catch (const std::exception& ex) {
     LOGS_DEFAULT(ERROR) << "cudnnDestroy threw:" << ex.what();
   }
+
+  if (owns_stream_ && stream_) {
+    CUDA_CALL(cudaStreamDestroy(stream_));
+  }
 }
 
 CUDAExecutionProvider::CUDAExecutionProvider(const CUDAExecutionProviderInfo& info)
@@ -142,6 +156,18 @@ CUDAExecutionProvider::CUDAExecutionProvider(const CUDAExecutionProviderInfo& in
     }
   }
 
+  if (info_.use_stream_pool && info_.has_user_compute_stream) {
+    LOGS_DEFAULT(WARNING) << "use_stream_pool is ignored when a user compute stream is provided.";
+    info_.use_stream_pool = false;
+  }
+
+  if (!info_.cudnn_conv_algo_cache_dir.empty()) {
+    // preload previously searched conv algorithms so a fresh process skips the
+    // exhaustive search for configurations another process already measured
+    conv_algo_disk_cache_ = onnxruntime::make_unique<cuda::CudnnConvAlgoDiskCache>(
+        info_.cudnn_conv_algo_cache_dir, device_prop_.name);
+  }
+
   size_t free = 0;
   size_t total = 0;
   CUDA_CALL_THROW(cudaMemGetInfo(&free, &total));
@@ -198,7 +224,7 @@ CUDAExecutionProvider::PerThreadContext& CUDAExecutionProvider::GetPerThreadCont
 
     // get or create a context
     if (context_state_.retired_context_pool.empty()) {
-      context = std::make_shared<PerThreadContext>(info_.device_id, static_cast<cudaStream_t>(GetComputeStream()), info_.cuda_mem_limit, info_.arena_extend_strategy, info_.external_allocator_info);
+      context = std::make_shared<PerThreadContext>(info_.device_id, static_cast<cudaStream_t>(GetComputeStream()), info_.cuda_mem_limit, info_.arena_extend_strategy, info_.external_allocator_info, info_.use_stream_pool);
     } else {
       context = context_state_.retired_context_pool.back();
       context_state_.retired_context_pool.pop_back();
@@ -290,14 +316,37 @@ Status CUDAExecutionProvider::OnRunStart() {
   auto& current_deferred_release_event = GetPerThreadContext().GetCurrentDeferredReleaseEvent();
   CUDA_RETURN_IF_ERROR(cudaEventCreate(&current_deferred_release_event, cudaEventDisableTiming));
   deferred_release_cpu_ptr_.emplace(current_deferred_release_event, DeferredReleaseCPUPtrs());
+
+  if (IsGraphCaptureEnabled() && GraphCaptureAllowed() && !IsGraphCaptured()) {
+    LOGS_DEFAULT(INFO) << "Capturing the cuda graph for this model";
+    cuda_graph_.SetStream(PerThreadDefaultStream());
+    cuda_graph_.CaptureBegin();
+  }
   return Status::OK();
 }
 
 Status CUDAExecutionProvider::OnRunEnd() {
+  // end the graph capture before any synchronization below: event record and
+  // stream synchronize are not allowed on a stream that is still capturing
+  if (IsGraphCaptureEnabled() && !IsGraphCaptured()) {
+    if (GraphCaptureAllowed()) {
+      cuda_graph_.CaptureEnd();
+      is_graph_captured_ = true;
+    } else {
+      IncrementRegularRunCountBeforeGraphCapture();
+    }
+  }
+
   // record deferred release event on default stream, and release per_thread_context
   auto current_deferred_release_event = GetPerThreadContext().GetCurrentDeferredReleaseEvent();
-  CUDA_RETURN_IF_ERROR(cudaEventRecord(current_deferred_release_event, static_cast<cudaStream_t>(GetComputeStream())));
-  CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(static_cast<cudaStream_t>(GetComputeStream())));
+  CUDA_RETURN_IF_ERROR(cudaEventRecord(current_deferred_release_event, PerThreadDefaultStream()));
+  CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(PerThreadDefaultStream()));
+  if (info_.use_stream_pool && stream_ != nullptr) {
+    // a few construction-time consumers (e.g. Loop's output concatenation)
+    // still submit to the shared stream; drain it as well before this run's
+    // results are handed back
+    CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(stream_));
+  }
   ReleasePerThreadContext();
   std::lock_guard<OrtMutex> lock(deferred_release_cpu_ptr_mutex_);
   deferred_release_cpu_ptr_[current_deferred_release_event].recorded = true;
@@ -305,6 +354,29 @@ Status CUDAExecutionProvider::OnRunEnd() {
   return Status::OK();
 }
 
+bool CUDAExecutionProvider::GraphCaptureAllowed() const {
+  return regular_run_count_before_graph_capture_ >= min_num_runs_before_cuda_graph_capture_;
+}
+
+void CUDAExecutionProvider::IncrementRegularRunCountBeforeGraphCapture() {
+  ++regular_run_count_before_graph_capture_;
+}
+
+bool CUDAExecutionProvider::IsGraphCaptureEnabled() const {
+  return info_.enable_cuda_graph;
+}
+
+bool CUDAExecutionProvider::IsGraphCaptured() const {
+  return is_graph_captured_;
+}
+
+Status CUDAExecutionProvider::ReplayGraph() {
+  ORT_ENFORCE(IsGraphCaptured());
+  // replay the captured sequence on the same stream, with the buffer addresses
+  // that were recorded at capture time
+  return cuda_graph_.Replay();
+}
+
 Status CUDAExecutionProvider::SetComputeStream(void* stream) {
   if (stream != stream_) {
     if (stream_) {
@@ -1960,7 +2032,13 @@ static bool CastNeedFallbackToCPU(const onnxruntime::Node& node) {
 }
 
 std::unique_ptr<onnxruntime::IDataTransfer> CUDAExecutionProvider::GetDataTransfer() const {
-  return onnxruntime::make_unique<onnxruntime::GPUDataTransfer>(static_cast<cudaStream_t>(GetComputeStream()), info_.do_copy_in_default_stream);
+  GPUDataTransfer::DefaultStreamGetter default_stream_getter;
+  if (info_.use_stream_pool) {
+    // copies issued by a Run() thread follow that thread's compute stream so
+    // they stay ordered with its kernels without cross-stream events
+    default_stream_getter = [this]() { return PerThreadDefaultStream(); };
+  }
+  return onnxruntime::make_unique<onnxruntime::GPUDataTransfer>(static_cast<cudaStream_t>(GetComputeStream()), info_.do_copy_in_default_stream, std::move(default_stream_getter));
 }
 
 std::vector<std::unique_ptr<ComputeCapability>>
@@ -12,12 +12,17 @@
 #include "core/framework/execution_provider.h"
 #include "core/platform/ort_mutex.h"
 #include "core/providers/cuda/cuda_execution_provider_info.h"
+#include "core/providers/cuda/cuda_graph.h"
 #include "core/providers/cuda/cuda_pch.h"
 #include "core/providers/cuda/shared_inc/cuda_utils.h"
 #include "core/providers/cuda/shared_inc/cuda_call.h"
 
 namespace onnxruntime {
 
+namespace cuda {
+class CudnnConvAlgoDiskCache;
+}
+
 // Logical device representation.
 class CUDAExecutionProvider : public IExecutionProvider {
  public:
@@ -41,6 +46,12 @@ class CUDAExecutionProvider : public IExecutionProvider {
 
   void* GetComputeStream() const override { return static_cast<void*>(stream_); }
 
+  // stream the calling thread's kernels should be launched on: the per-thread
+  // stream when the stream pool is enabled, else the shared compute stream
+  cudaStream_t PerThreadDefaultStream() const {
+    return info_.use_stream_pool ? GetPerThreadContext().Stream() : stream_;
+  }
+
   cublasHandle_t PerThreadCublasHandle() {
     return GetPerThreadContext().CublasHandle();
   }
@@ -74,6 +85,8 @@ class CUDAExecutionProvider : public IExecutionProvider {
   int GetDeviceId() const override { return info_.device_id; }
   const cudaDeviceProp& GetDeviceProp() const { return device_prop_; };
   int GetCudnnConvAlgo() const { return info_.cudnn_conv_algo_search; }
+  // nullptr unless cudnn_conv_algo_cache_dir is set
+  cuda::CudnnConvAlgoDiskCache* GetCudnnConvAlgoCache() const { return conv_algo_disk_cache_.get(); }
 
   ProviderOptions GetProviderOptions() const override {
     return CUDAExecutionProviderInfo::ToProviderOptions(info_);
@@ -83,12 +96,29 @@ class CUDAExecutionProvider : public IExecutionProvider {
   static AllocatorPtr CreateCudaAllocator(OrtDevice::DeviceId device_id, size_t cuda_mem_limit, ArenaExtendStrategy arena_extend_strategy,
                                           CUDAExecutionProviderExternalAllocatorInfo external_alloc_info);
 
+  bool IsGraphCaptureEnabled() const override;
+  bool IsGraphCaptured() const override;
+  Status ReplayGraph() override;
+
  private:
   CUDAExecutionProviderInfo info_;
   cudaDeviceProp device_prop_;
   bool external_stream_ = false;
   cudaStream_t stream_ = nullptr;
 
+  std::unique_ptr<cuda::CudnnConvAlgoDiskCache> conv_algo_disk_cache_;
+
+  // CUDA graph capture for Run(). The first regular runs warm up the kernels
+  // and let the arena grow to its steady-state allocations so that the buffer
+  // addresses recorded during capture stay stable for later replays.
+  CUDAGraph cuda_graph_;
+  bool is_graph_captured_ = false;
+  int regular_run_count_before_graph_capture_ = 0;
+  const int min_num_runs_before_cuda_graph_capture_ = 1;
+
+  bool GraphCaptureAllowed() const;
+  void IncrementRegularRunCountBeforeGraphCapture();
+
   struct DeferredReleaseCPUPtrs {
     bool recorded = false;
     std::vector<void*> cpu_ptrs;
@@ -100,9 +130,13 @@ class CUDAExecutionProvider : public IExecutionProvider {
   class PerThreadContext final {
    public:
     PerThreadContext(OrtDevice::DeviceId device_id, cudaStream_t stream, size_t cuda_mem_limit, ArenaExtendStrategy arena_extend_strategy,
-                     CUDAExecutionProviderExternalAllocatorInfo external_alloc_info);
+                     CUDAExecutionProviderExternalAllocatorInfo external_alloc_info, bool use_own_stream);
     ~PerThreadContext();
 
+    cudaStream_t Stream() const {
+      return stream_;
+    }
+
     cublasHandle_t CublasHandle() const {
       return cublas_handle_;
     }
@@ -150,6 +184,9 @@ class CUDAExecutionProvider : public IExecutionProvider {
 
    private:
     cudaStream_t stream_ = nullptr;
+    // set when the context created its own stream (stream pool mode); the
+    // shared compute stream is owned by the provider instead
+    bool owns_stream_ = false;
     cublasHandle_t cublas_handle_ = nullptr;
     cudnnHandle_t cudnn_handle_ = nullptr;
 
@@ -18,6 +18,9 @@ constexpr const char* kCudnnConvAlgoSearch = "cudnn_conv_algo_search";
 constexpr const char* kDoCopyInDefaultStream = "do_copy_in_default_stream";
 constexpr const char* kcudaExternalAlloc = "cuda_external_alloc";
 constexpr const char* kcudaExternalFree = "cuda_external_free";
+constexpr const char* kEnableCudaGraph = "enable_cuda_graph";
+constexpr const char* kUseStreamPool = "use_stream_pool";
+constexpr const char* kCudnnConvAlgoCacheDir = "cudnn_conv_algo_cache_dir";
 }  // namespace provider_option_names
 }  // namespace cuda
 
@@ -78,6 +81,9 @@ CUDAExecutionProviderInfo CUDAExecutionProviderInfo::FromProviderOptions(const P
               cuda::provider_option_names::kCudnnConvAlgoSearch,
               ort_cudnn_conv_algo_search_mapping, info.cudnn_conv_algo_search)
           .AddAssignmentToReference(cuda::provider_option_names::kDoCopyInDefaultStream, info.do_copy_in_default_stream)
+          .AddAssignmentToReference(cuda::provider_option_names::kEnableCudaGraph, info.enable_cuda_graph)
+          .AddAssignmentToReference(cuda::provider_option_names::kUseStreamPool, info.use_stream_pool)
+          .AddAssignmentToReference(cuda::provider_option_names::kCudnnConvAlgoCacheDir, info.cudnn_conv_algo_cache_dir)
           .Parse(options));
 
   CUDAExecutionProviderExternalAllocatorInfo alloc_info{alloc, free};
@@ -96,6 +102,9 @@ ProviderOptions CUDAExecutionProviderInfo::ToProviderOptions(const CUDAExecution
       {cuda::provider_option_names::kCudnnConvAlgoSearch,
        EnumToName(ort_cudnn_conv_algo_search_mapping, info.cudnn_conv_algo_search)},
       {cuda::provider_option_names::kDoCopyInDefaultStream, MakeStringWithClassicLocale(info.do_copy_in_default_stream)},
+      {cuda::provider_option_names::kEnableCudaGraph, MakeStringWithClassicLocale(info.enable_cuda_graph)},
+      {cuda::provider_option_names::kUseStreamPool, MakeStringWithClassicLocale(info.use_stream_pool)},
+      {cuda::provider_option_names::kCudnnConvAlgoCacheDir, info.cudnn_conv_algo_cache_dir},
   };
 
   return options;
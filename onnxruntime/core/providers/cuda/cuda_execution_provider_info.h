@@ -4,6 +4,7 @@
 #pragma once
 
 #include <limits>
+#include <string>
 
 #include "core/framework/arena_extend_strategy.h"
 #include "core/framework/ortdevice.h"
@@ -36,10 +37,25 @@ struct CUDAExecutionProviderInfo {
   size_t cuda_mem_limit{std::numeric_limits<size_t>::max()};
   ArenaExtendStrategy arena_extend_strategy{ArenaExtendStrategy::kNextPowerOfTwo};
   OrtCudnnConvAlgoSearch cudnn_conv_algo_search{OrtCudnnConvAlgoSearch::EXHAUSTIVE};
+  // Directory for the on-disk cudnn conv algorithm cache, keyed by GPU model
+  // and cudnn version and shared across processes. Empty disables persistence
+  // and keeps the per-node in-memory cache only.
+  std::string cudnn_conv_algo_cache_dir{};
   bool do_copy_in_default_stream{true};
   bool has_user_compute_stream{false};
   void* user_compute_stream{nullptr};
   CUDAExecutionProviderExternalAllocatorInfo external_allocator_info{};
+  // Give each thread calling Run() its own non-blocking compute stream (pooled
+  // together with the per-thread cublas/cudnn handles and arena), so concurrent
+  // runs on the same session can overlap on the GPU instead of serializing on
+  // the shared stream. Ignored when a user compute stream is supplied. Models
+  // with subgraph-bearing nodes (Scan/Loop/If) should leave this off: their
+  // construction-time stream plumbing still targets the shared stream.
+  bool use_stream_pool{false};
+  // Capture the kernel launch sequence into a CUDA graph on an early Run() and
+  // replay the graph on subsequent runs. Requires stable input/output shapes
+  // and buffer addresses across runs.
+  bool enable_cuda_graph{false};
 
   static CUDAExecutionProviderInfo FromProviderOptions(const ProviderOptions& options);
   static ProviderOptions ToProviderOptions(const CUDAExecutionProviderInfo& info);
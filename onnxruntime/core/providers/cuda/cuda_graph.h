@@ -0,0 +1,39 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include "core/common/common.h"
+#include "core/providers/cuda/cuda_pch.h"
+
+namespace onnxruntime {
+
+// Wraps cudaGraph_t/cudaGraphExec_t for stream capture and replay. The kernel
+// launch sequence recorded between CaptureBegin() and CaptureEnd() can be
+// re-launched as a whole with Replay(), which skips the per-kernel launch
+// overhead of a regular run. All buffer addresses baked into the captured
+// launches must remain valid and unchanged for the replays to be correct.
+class CUDAGraph {
+ public:
+  CUDAGraph() = default;
+  ~CUDAGraph();
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CUDAGraph);
+
+  void SetStream(cudaStream_t stream);
+  void CaptureBegin();
+  void CaptureEnd();
+  Status Replay();
+  void Reset();
+
+ private:
+  cudaGraph_t graph_ = nullptr;
+  cudaGraphExec_t graph_exec_ = nullptr;
+
+  bool has_graph_ = false;
+  bool has_graph_exec_ = false;
+
+  cudaStream_t stream_ = nullptr;  // capture and replay stream
+};
+
+}  // namespace onnxruntime
@@ -9,7 +9,16 @@
 // so we leave it as optional, in case user need the previous behavior
 // a full fix to BFC arena is being looked at, and once it's in, we can revert this change
 namespace onnxruntime {
-GPUDataTransfer::GPUDataTransfer(cudaStream_t stream, bool do_copy_in_default_stream) {
+namespace {
+// below this size the driver's internal staging is cheap enough that routing through the pinned
+// pool only adds latency
+constexpr size_t kMinStagedCopyBytes = 64 * 1024;
+}  // namespace
+
+GPUDataTransfer::GPUDataTransfer(cudaStream_t stream, bool do_copy_in_default_stream,
+                                 DefaultStreamGetter default_stream_getter)
+    : staging_pool_(onnxruntime::make_unique<PinnedStagingPool>()),
+      default_stream_getter_(std::move(default_stream_getter)) {
   // create streams, default is nullptr
   do_copy_in_default_stream_ = do_copy_in_default_stream;
   streams_[kCudaStreamDefault] = stream;
@@ -55,16 +64,51 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int e
         CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToDevice, GetStream(kCudaStreamDefault)));
       }
     } else {
-      // copy from other CPU memory to GPU, this is blocking
-      CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyHostToDevice, GetStream(kCudaStreamDefault)));
-      CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(GetStream(kCudaStreamDefault)));
+      // copy from pageable CPU memory to GPU
+      if (bytes >= kMinStagedCopyBytes) {
+        // stage through a pooled pinned buffer: the source is fully consumed by the host memcpy,
+        // and stream ordering protects the device buffer, so the DMA can stay asynchronous.
+        // honoring the exec queue puts MemcpyFromHost transfers on the copy-in stream, where
+        // they overlap with compute already in flight instead of queueing behind it
+        PinnedStagingPool::Buffer staging;
+        if (staging_pool_->Acquire(bytes, staging).IsOK()) {
+          memcpy(staging.ptr, src_data, bytes);
+          cudaError_t copy_status = cudaMemcpyAsync(dst_data, staging.ptr, bytes, cudaMemcpyHostToDevice,
+                                                    GetStream(exec_queue_id));
+          staging_pool_->Release(std::move(staging), GetStream(exec_queue_id));
+          CUDA_RETURN_IF_ERROR(copy_status);
+          return Status::OK();
+        }
+        // pinned allocation failed; fall through to the blocking pageable copy
+      }
+      CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyHostToDevice, GetStream(exec_queue_id)));
+      CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(GetStream(exec_queue_id)));
     }
   } else if (src_device.Type() == OrtDevice::GPU) {
     if (dst_device.Type() == OrtDevice::CPU && dst_device.MemType() == OrtDevice::MemType::CUDA_PINNED) {
       // copying from GPU to pinned memory, this is non-blocking
       CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToHost, GetStream(exec_queue_id)));
     } else {
-      // copying from GPU to CPU memory, this is blocking
+      // copying from GPU to pageable CPU memory. the caller reads the destination on return, so
+      // this stays blocking, but staging through pinned memory keeps the D2H leg a single
+      // full-bandwidth DMA.
+      if (bytes >= kMinStagedCopyBytes) {
+        PinnedStagingPool::Buffer staging;
+        if (staging_pool_->Acquire(bytes, staging).IsOK()) {
+          cudaError_t copy_status = cudaMemcpyAsync(staging.ptr, src_data, bytes, cudaMemcpyDeviceToHost,
+                                                    GetStream(kCudaStreamDefault));
+          if (copy_status == cudaSuccess) {
+            copy_status = cudaStreamSynchronize(GetStream(kCudaStreamDefault));
+          }
+          if (copy_status == cudaSuccess) {
+            memcpy(dst_data, staging.ptr, bytes);
+          }
+          staging_pool_->Release(std::move(staging), GetStream(kCudaStreamDefault));
+          CUDA_RETURN_IF_ERROR(copy_status);
+          return Status::OK();
+        }
+        // pinned allocation failed; fall through to the blocking pageable copy
+      }
       CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(dst_data, src_data, bytes, cudaMemcpyDeviceToHost, GetStream(kCudaStreamDefault)));
       CUDA_RETURN_IF_ERROR(cudaStreamSynchronize(GetStream(kCudaStreamDefault)));
     }
@@ -75,4 +119,81 @@ common::Status GPUDataTransfer::CopyTensor(const Tensor& src, Tensor& dst, int e
 
   return Status::OK();
 }
+common::Status GPUDataTransfer::CopyTensors(const std::vector<SrcDstPair>& src_dst_pairs) const {
+  // separate the device-to-pageable-host fetches, which the per-tensor path
+  // would otherwise execute as one blocking copy each, from everything else
+  std::vector<size_t> d2h_pageable;
+  d2h_pageable.reserve(src_dst_pairs.size());
+
+  for (size_t i = 0; i < src_dst_pairs.size(); ++i) {
+    const auto& pair = src_dst_pairs[i];
+    const auto& src_device = pair.src.get().Location().device;
+    const auto& dst_device = pair.dst.get().Location().device;
+    if (src_device.Type() == OrtDevice::GPU && dst_device.Type() == OrtDevice::CPU &&
+        dst_device.MemType() != OrtDevice::MemType::CUDA_PINNED &&
+        pair.src.get().SizeInBytes() >= kMinStagedCopyBytes) {
+      d2h_pageable.push_back(i);
+    } else {
+      ORT_RETURN_IF_ERROR(CopyTensor(pair.src, pair.dst, pair.exec_queue_id));
+    }
+  }
+
+  if (d2h_pageable.empty()) {
+    return Status::OK();
+  }
+
+  // order the copy-out stream after the work already submitted on the compute
+  // stream, then enqueue every DMA before waiting once for the whole batch
+  cudaStream_t copy_stream = GetStream(kCudaStreamCopyOut);
+  cudaStream_t compute_stream = GetStream(kCudaStreamDefault);
+
+  if (copy_stream != compute_stream) {
+    cudaEvent_t outputs_ready = nullptr;
+    CUDA_RETURN_IF_ERROR(cudaEventCreateWithFlags(&outputs_ready, cudaEventDisableTiming));
+    cudaError_t sync_status = cudaEventRecord(outputs_ready, compute_stream);
+    if (sync_status == cudaSuccess) {
+      sync_status = cudaStreamWaitEvent(copy_stream, outputs_ready, 0);
+    }
+    CUDA_CALL(cudaEventDestroy(outputs_ready));
+    CUDA_RETURN_IF_ERROR(sync_status);
+  }
+
+  std::vector<PinnedStagingPool::Buffer> staging_buffers(d2h_pageable.size());
+  cudaError_t copy_status = cudaSuccess;
+  for (size_t i = 0; i < d2h_pageable.size() && copy_status == cudaSuccess; ++i) {
+    const auto& pair = src_dst_pairs[d2h_pageable[i]];
+    size_t bytes = pair.src.get().SizeInBytes();
+    if (!staging_pool_->Acquire(bytes, staging_buffers[i]).IsOK()) {
+      // pinned allocation failed; finish this tensor with the blocking path
+      ORT_RETURN_IF_ERROR(CopyTensor(pair.src, pair.dst, pair.exec_queue_id));
+      continue;
+    }
+    copy_status = cudaMemcpyAsync(staging_buffers[i].ptr, pair.src.get().DataRaw(), bytes,
+                                  cudaMemcpyDeviceToHost, copy_stream);
+  }
+
+  if (copy_status == cudaSuccess) {
+    copy_status = cudaStreamSynchronize(copy_stream);
+  }
+
+  if (copy_status == cudaSuccess) {
+    for (size_t i = 0; i < d2h_pageable.size(); ++i) {
+      if (staging_buffers[i].ptr == nullptr) {
+        continue;  // fell back to the blocking path above
+      }
+      const auto& pair = src_dst_pairs[d2h_pageable[i]];
+      memcpy(pair.dst.get().MutableDataRaw(), staging_buffers[i].ptr, pair.src.get().SizeInBytes());
+    }
+  }
+
+  for (auto& staging : staging_buffers) {
+    if (staging.ptr != nullptr) {
+      staging_pool_->Release(std::move(staging), copy_stream);
+    }
+  }
+  CUDA_RETURN_IF_ERROR(copy_status);
+
+  return Status::OK();
+}
+
 }  // namespace onnxruntime
@@ -3,8 +3,12 @@
 
 #pragma once
 
+#include <functional>
+#include <memory>
+
 #include "cuda_pch.h"
 #include "core/framework/data_transfer.h"
+#include "core/providers/cuda/pinned_staging_pool.h"
 
 namespace onnxruntime {
 
@@ -17,7 +21,12 @@ enum CUDAStreamType : int {
 
 class GPUDataTransfer : public IDataTransfer {
  public:
-  GPUDataTransfer(cudaStream_t stream, bool do_copy_in_default_stream = true);
+  // returns the stream the calling thread's kernels run on, for providers that
+  // assign a stream per Run() thread
+  using DefaultStreamGetter = std::function<cudaStream_t()>;
+
+  GPUDataTransfer(cudaStream_t stream, bool do_copy_in_default_stream = true,
+                  DefaultStreamGetter default_stream_getter = nullptr);
   ~GPUDataTransfer();
 
   bool CanCopy(const OrtDevice& src_device, const OrtDevice& dst_device) const override;
@@ -26,14 +35,28 @@ class GPUDataTransfer : public IDataTransfer {
   using IDataTransfer::CopyTensor;
   common::Status CopyTensor(const Tensor& src, Tensor& dst, int exec_queue_id) const override;
 
+  // Pipelines batched device-to-host fetches: the copy-out stream waits on an
+  // event recorded on the compute stream, all DMAs into pinned staging buffers
+  // are enqueued back to back, and a single stream synchronize covers the
+  // whole batch instead of one blocking copy per output.
+  common::Status CopyTensors(const std::vector<SrcDstPair>& src_dst_pairs) const override;
+
   cudaStream_t GetStream(int queue_id) const {
     ORT_ENFORCE(queue_id >= 0 && queue_id < kTotalCudaStreams);
+    // route queues that would land on the shared compute stream to the calling
+    // thread's stream instead, so copies stay ordered with that run's kernels
+    if (default_stream_getter_ && (queue_id == kCudaStreamDefault || do_copy_in_default_stream_)) {
+      return default_stream_getter_();
+    }
     return streams_[queue_id];
   }
 
  private:
   bool do_copy_in_default_stream_;
   cudaStream_t streams_[kTotalCudaStreams];
+  DefaultStreamGetter default_stream_getter_;
+  // stages copies involving pageable host memory through pinned buffers
+  std::unique_ptr<PinnedStagingPool> staging_pool_;
 };
 
 }  // namespace onnxruntime
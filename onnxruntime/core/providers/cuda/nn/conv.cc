@@ -4,6 +4,7 @@
 #include "core/providers/common.h"
 #include "core/providers/cuda/cuda_common.h"
 #include "core/providers/cuda/nn/conv.h"
+#include "core/providers/cuda/nn/cudnn_conv_algo_cache.h"
 #include "core/providers/cuda/shared_inc/fpgeneric.h"
 #include "core/providers/cuda/tensor/slice.h"
 
@@ -200,62 +201,88 @@ Status Conv<T>::UpdateState(OpKernelContext* context, bool bias_expected) const
     }
 
     if (!s_.cached_benchmark_results.contains(x_dims_cudnn)) {
-      IAllocatorUniquePtr<void> algo_search_workspace = GetScratchBuffer<void>(AlgoSearchWorkspaceSize);
-
-      // set math type to tensor core before algorithm search
-      if (std::is_same<T, MLFloat16>::value)
-        CUDNN_RETURN_IF_ERROR(cudnnSetConvolutionMathType(s_.conv_desc, CUDNN_TENSOR_OP_MATH));
-
-      cudnnConvolutionFwdAlgoPerf_t perf;
-      int algo_count = 1;
       const CUDAExecutionProvider* cuda_ep = static_cast<const CUDAExecutionProvider*>(this->Info().GetExecutionProvider());
       int cudnn_conv_algo = cuda_ep->GetCudnnConvAlgo();
       ORT_ENFORCE(cudnn_conv_algo > -1 && cudnn_conv_algo < 3, "cudnn_conv_algo should be 0, 1 or 2, but got ", cudnn_conv_algo);
-      switch (cudnn_conv_algo) {
-        case 0:
-          CUDNN_RETURN_IF_ERROR(cudnnFindConvolutionForwardAlgorithmEx(
-              CudnnHandle(),
-              s_.x_tensor,
-              s_.x_data,
-              s_.w_desc,
-              s_.w_data,
-              s_.conv_desc,
-              s_.y_tensor,
-              s_.y_data,
-              1,
-              &algo_count,
-              &perf,
-              algo_search_workspace.get(),
-              AlgoSearchWorkspaceSize));
-          break;
-
-        case 1:
-          CUDNN_RETURN_IF_ERROR(cudnnGetConvolutionForwardAlgorithm_v7(
-              CudnnHandle(),
-              s_.x_tensor,
-              s_.w_desc,
-              s_.conv_desc,
-              s_.y_tensor,
-              1,
-              &algo_count,
-              &perf));
-          break;
-
-        default:
-          perf.algo = kDefaultConvAlgo;
-          CUDNN_RETURN_IF_ERROR(cudnnGetConvolutionForwardWorkspaceSize(
-              CudnnHandle(),
-              s_.x_tensor,
-              s_.w_desc,
-              s_.conv_desc,
-              s_.y_tensor,
-              perf.algo,
-              &perf.memory));
-          if (std::is_same<T, MLFloat16>::value) {
-            perf.mathType = CUDNN_TENSOR_OP_MATH;
-          } else {
-            perf.mathType = CUDNN_DEFAULT_MATH;
-          }
+
+      // an algorithm persisted by an earlier process skips the search entirely
+      CudnnConvAlgoDiskCache* algo_disk_cache = cuda_ep->GetCudnnConvAlgoCache();
+      std::string algo_disk_key;
+      bool found_on_disk = false;
+      cudnnConvolutionFwdAlgoPerf_t perf;
+      if (algo_disk_cache != nullptr) {
+        algo_disk_key = CudnnConvAlgoDiskCache::MakeKey("ConvFwd", CudnnTensor::GetDataType<CudaT>(),
+                                                        cudnn_conv_algo, x_dims_cudnn, w_dims,
+                                                        pads, strides, dilations, conv_attrs_.group);
+        int algo, math_type;
+        size_t memory;
+        if (algo_disk_cache->Lookup(algo_disk_key, algo, memory, math_type)) {
+          perf.algo = static_cast<cudnnConvolutionFwdAlgo_t>(algo);
+          perf.memory = memory;
+          perf.mathType = static_cast<cudnnMathType_t>(math_type);
+          found_on_disk = true;
+        }
+      }
+
+      if (!found_on_disk) {
+        IAllocatorUniquePtr<void> algo_search_workspace = GetScratchBuffer<void>(AlgoSearchWorkspaceSize);
+
+        // set math type to tensor core before algorithm search
+        if (std::is_same<T, MLFloat16>::value)
+          CUDNN_RETURN_IF_ERROR(cudnnSetConvolutionMathType(s_.conv_desc, CUDNN_TENSOR_OP_MATH));
+
+        int algo_count = 1;
+        switch (cudnn_conv_algo) {
+          case 0:
+            CUDNN_RETURN_IF_ERROR(cudnnFindConvolutionForwardAlgorithmEx(
+                CudnnHandle(),
+                s_.x_tensor,
+                s_.x_data,
+                s_.w_desc,
+                s_.w_data,
+                s_.conv_desc,
+                s_.y_tensor,
+                s_.y_data,
+                1,
+                &algo_count,
+                &perf,
+                algo_search_workspace.get(),
+                AlgoSearchWorkspaceSize));
+            break;
+
+          case 1:
+            CUDNN_RETURN_IF_ERROR(cudnnGetConvolutionForwardAlgorithm_v7(
+                CudnnHandle(),
+                s_.x_tensor,
+                s_.w_desc,
+                s_.conv_desc,
+                s_.y_tensor,
+                1,
+                &algo_count,
+                &perf));
+            break;
+
+          default:
+            perf.algo = kDefaultConvAlgo;
+            CUDNN_RETURN_IF_ERROR(cudnnGetConvolutionForwardWorkspaceSize(
+                CudnnHandle(),
+                s_.x_tensor,
+                s_.w_desc,
+                s_.conv_desc,
+                s_.y_tensor,
+                perf.algo,
+                &perf.memory));
+            if (std::is_same<T, MLFloat16>::value) {
+              perf.mathType = CUDNN_TENSOR_OP_MATH;
+            } else {
+              perf.mathType = CUDNN_DEFAULT_MATH;
+            }
+        }
+
+        if (algo_disk_cache != nullptr) {
+          algo_disk_cache->Insert(algo_disk_key, static_cast<int>(perf.algo), perf.memory,
+                                  static_cast<int>(perf.mathType));
+        }
       }
       s_.cached_benchmark_results.insert(x_dims_cudnn, {perf.algo, perf.memory, perf.mathType});
     }
@@ -3,6 +3,8 @@
 
 #include "conv_transpose.h"
 
+#include "core/providers/cuda/nn/cudnn_conv_algo_cache.h"
+
 namespace onnxruntime {
 namespace cuda {
 
@@ -127,28 +129,56 @@ Status ConvTranspose<T>::DoConvTranspose(OpKernelContext* context, bool dynamic_
       y_data = reinterpret_cast<CudaT*>(p.Y->template MutableData<T>());
 
       if (!s_.cached_benchmark_results.contains(x_dims)) {
-        IAllocatorUniquePtr<void> algo_search_workspace = GetScratchBuffer<void>(AlgoSearchWorkspaceSize);
-
-        // set math type to tensor core before algorithm search
-        if (std::is_same<T, MLFloat16>::value)
-          CUDNN_RETURN_IF_ERROR(cudnnSetConvolutionMathType(s_.conv_desc, CUDNN_TENSOR_OP_MATH));
+        const CUDAExecutionProvider* cuda_ep = static_cast<const CUDAExecutionProvider*>(this->Info().GetExecutionProvider());
 
+        // an algorithm persisted by an earlier process skips the search entirely
+        CudnnConvAlgoDiskCache* algo_disk_cache = cuda_ep->GetCudnnConvAlgoCache();
+        std::string algo_disk_key;
+        bool found_on_disk = false;
         cudnnConvolutionBwdDataAlgoPerf_t perf;
-        int algo_count = 1;
-        CUDNN_RETURN_IF_ERROR(cudnnFindConvolutionBackwardDataAlgorithmEx(
-            CudnnHandle(),
-            s_.w_desc,
-            w_data,
-            s_.x_tensor,
-            x_data,
-            s_.conv_desc,
-            s_.y_tensor,
-            y_data,
-            1,
-            &algo_count,
-            &perf,
-            algo_search_workspace.get(),
-            AlgoSearchWorkspaceSize));
+        if (algo_disk_cache != nullptr) {
+          algo_disk_key = CudnnConvAlgoDiskCache::MakeKey("ConvTranspose", CudnnTensor::GetDataType<CudaT>(),
+                                                          0, x_dims, w_dims,
+                                                          p.pads, p.strides, p.dilations,
+                                                          conv_transpose_attrs_.group);
+          int algo, math_type;
+          size_t memory;
+          if (algo_disk_cache->Lookup(algo_disk_key, algo, memory, math_type)) {
+            perf.algo = static_cast<cudnnConvolutionBwdDataAlgo_t>(algo);
+            perf.memory = memory;
+            perf.mathType = static_cast<cudnnMathType_t>(math_type);
+            found_on_disk = true;
+          }
+        }
+
+        if (!found_on_disk) {
+          IAllocatorUniquePtr<void> algo_search_workspace = GetScratchBuffer<void>(AlgoSearchWorkspaceSize);
+
+          // set math type to tensor core before algorithm search
+          if (std::is_same<T, MLFloat16>::value)
+            CUDNN_RETURN_IF_ERROR(cudnnSetConvolutionMathType(s_.conv_desc, CUDNN_TENSOR_OP_MATH));
+
+          int algo_count = 1;
+          CUDNN_RETURN_IF_ERROR(cudnnFindConvolutionBackwardDataAlgorithmEx(
+              CudnnHandle(),
+              s_.w_desc,
+              w_data,
+              s_.x_tensor,
+              x_data,
+              s_.conv_desc,
+              s_.y_tensor,
+              y_data,
+              1,
+              &algo_count,
+              &perf,
+              algo_search_workspace.get(),
+              AlgoSearchWorkspaceSize));
+
+          if (algo_disk_cache != nullptr) {
+            algo_disk_cache->Insert(algo_disk_key, static_cast<int>(perf.algo), perf.memory,
+                                    static_cast<int>(perf.mathType));
+          }
+        }
         s_.cached_benchmark_results.insert(x_dims, {perf.algo, perf.memory, perf.mathType});
       }
 
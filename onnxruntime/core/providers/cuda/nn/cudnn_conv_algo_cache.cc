@@ -0,0 +1,115 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cuda/nn/cudnn_conv_algo_cache.h"
+
+#include <cctype>
+#include <fstream>
+#include <sstream>
+
+#include "core/common/logging/logging.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+namespace {
+
+// GPU model names contain spaces; keep the file name shell friendly
+std::string SanitizeForFileName(const std::string& name) {
+  std::string sanitized = name;
+  for (auto& c : sanitized) {
+    if (!isalnum(static_cast<unsigned char>(c)) && c != '-' && c != '.') {
+      c = '_';
+    }
+  }
+  return sanitized;
+}
+
+void AppendDims(std::ostringstream& key, char tag, const std::vector<int64_t>& dims) {
+  key << ',' << tag << ':';
+  for (size_t i = 0; i < dims.size(); ++i) {
+    if (i > 0) {
+      key << 'x';
+    }
+    key << dims[i];
+  }
+}
+
+}  // namespace
+
+CudnnConvAlgoDiskCache::CudnnConvAlgoDiskCache(const std::string& directory, const std::string& device_name) {
+  std::ostringstream path;
+  path << directory << '/' << "cudnn_conv_algo_" << SanitizeForFileName(device_name)
+       << "_v" << cudnnGetVersion() << ".txt";
+  file_path_ = path.str();
+  Load();
+}
+
+std::string CudnnConvAlgoDiskCache::MakeKey(const char* op_tag,
+                                            int data_type,
+                                            int algo_search_mode,
+                                            const std::vector<int64_t>& x_dims,
+                                            const std::vector<int64_t>& w_dims,
+                                            const std::vector<int64_t>& pads,
+                                            const std::vector<int64_t>& strides,
+                                            const std::vector<int64_t>& dilations,
+                                            int64_t group) {
+  std::ostringstream key;
+  key << op_tag << ",dt" << data_type << ",mode" << algo_search_mode;
+  AppendDims(key, 'x', x_dims);
+  AppendDims(key, 'w', w_dims);
+  AppendDims(key, 'p', pads);
+  AppendDims(key, 's', strides);
+  AppendDims(key, 'd', dilations);
+  key << ",g" << group;
+  return key.str();
+}
+
+bool CudnnConvAlgoDiskCache::Lookup(const std::string& key, int& algo, size_t& memory, int& math_type) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  auto it = entries_.find(key);
+  if (it == entries_.end()) {
+    return false;
+  }
+  algo = it->second.algo;
+  memory = it->second.memory;
+  math_type = it->second.math_type;
+  return true;
+}
+
+void CudnnConvAlgoDiskCache::Insert(const std::string& key, int algo, size_t memory, int math_type) {
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (!entries_.emplace(key, Entry{algo, memory, math_type}).second) {
+    return;
+  }
+
+  // single-line appends so concurrent processes extending the same file do not
+  // corrupt each other's entries; a failed write only loses the persistence,
+  // not the in-memory entry
+  std::ofstream file(file_path_, std::ios::app);
+  if (file) {
+    file << key << ' ' << algo << ' ' << memory << ' ' << math_type << '\n';
+  } else {
+    LOGS_DEFAULT(WARNING) << "Failed to append to cudnn conv algo cache file: " << file_path_;
+  }
+}
+
+void CudnnConvAlgoDiskCache::Load() {
+  std::ifstream file(file_path_);
+  if (!file) {
+    return;  // nothing cached yet
+  }
+
+  std::string key;
+  Entry entry;
+  size_t loaded = 0;
+  while (file >> key >> entry.algo >> entry.memory >> entry.math_type) {
+    // last entry wins so a file with duplicate appends stays usable
+    entries_[key] = entry;
+    ++loaded;
+  }
+  LOGS_DEFAULT(INFO) << "Loaded " << loaded << " cudnn conv algo cache entries from " << file_path_;
+}
+
+}  // namespace cuda
+}  // namespace onnxruntime
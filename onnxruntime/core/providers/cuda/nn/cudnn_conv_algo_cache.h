@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
+#include "core/providers/cuda/cuda_pch.h"
+
+namespace onnxruntime {
+namespace cuda {
+
+// Disk-backed cache of cudnn convolution algorithm choices, shared across
+// processes. Exhaustive algorithm search can take seconds per new shape, and a
+// freshly started process repeats it for every configuration the previous
+// process already searched. The cache file lives under a user-supplied
+// directory, is named after the GPU model and cudnn version so entries are
+// only replayed on matching hardware and library, and is loaded once at
+// provider construction. New entries are appended as they are found, so
+// concurrent processes converge on a warm cache.
+class CudnnConvAlgoDiskCache {
+ public:
+  CudnnConvAlgoDiskCache(const std::string& directory, const std::string& device_name);
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(CudnnConvAlgoDiskCache);
+
+  // Builds the lookup key from everything that determines the algorithm
+  // choice for a node: operator variant, data type, search mode and the full
+  // convolution geometry.
+  static std::string MakeKey(const char* op_tag,
+                             int data_type,
+                             int algo_search_mode,
+                             const std::vector<int64_t>& x_dims,
+                             const std::vector<int64_t>& w_dims,
+                             const std::vector<int64_t>& pads,
+                             const std::vector<int64_t>& strides,
+                             const std::vector<int64_t>& dilations,
+                             int64_t group);
+
+  bool Lookup(const std::string& key, int& algo, size_t& memory, int& math_type);
+
+  void Insert(const std::string& key, int algo, size_t memory, int math_type);
+
+ private:
+  struct Entry {
+    int algo;
+    size_t memory;
+    int math_type;
+  };
+
+  void Load();
+
+  std::string file_path_;
+  OrtMutex mutex_;
+  std::unordered_map<std::string, Entry> entries_;
+};
+
+}  // namespace cuda
+}  // namespace onnxruntime
@@ -0,0 +1,87 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/providers/cuda/pinned_staging_pool.h"
+#include "cuda_common.h"
+
+namespace onnxruntime {
+
+PinnedStagingPool::~PinnedStagingPool() {
+  for (auto& buffer : free_buffers_) {
+    if (buffer.ready != nullptr) {
+      CUDA_CALL(cudaEventSynchronize(buffer.ready));
+    }
+    FreeBuffer(buffer);
+  }
+}
+
+void PinnedStagingPool::FreeBuffer(Buffer& buffer) {
+  if (buffer.ready != nullptr) {
+    CUDA_CALL(cudaEventDestroy(buffer.ready));
+    buffer.ready = nullptr;
+  }
+  CUDA_CALL(cudaFreeHost(buffer.ptr));
+  buffer.ptr = nullptr;
+}
+
+common::Status PinnedStagingPool::Acquire(size_t size, Buffer& buffer) {
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    for (auto it = free_buffers_.begin(); it != free_buffers_.end(); ++it) {
+      if (it->capacity < size) continue;
+      // skip buffers whose previous copies are still in flight
+      if (it->ready != nullptr && cudaEventQuery(it->ready) != cudaSuccess) continue;
+      buffer = *it;
+      cached_bytes_ -= it->capacity;
+      free_buffers_.erase(it);
+      return Status::OK();
+    }
+  }
+
+  // round the allocation up to the next power of two so recurring feed sizes that vary slightly
+  // still share cached buffers
+  size_t capacity = 256;
+  while (capacity < size) capacity <<= 1;
+
+  buffer = Buffer{};
+  CUDA_RETURN_IF_ERROR(cudaHostAlloc(&buffer.ptr, capacity, cudaHostAllocDefault));
+  buffer.capacity = capacity;
+  return Status::OK();
+}
+
+void PinnedStagingPool::Release(Buffer&& buffer, cudaStream_t stream) {
+  if (buffer.ready == nullptr) {
+    if (!CUDA_CALL(cudaEventCreateWithFlags(&buffer.ready, cudaEventDisableTiming))) {
+      // without an event the buffer can't be tracked; wait for the copy and free it
+      CUDA_CALL(cudaStreamSynchronize(stream));
+      FreeBuffer(buffer);
+      return;
+    }
+  }
+  CUDA_CALL(cudaEventRecord(buffer.ready, stream));
+
+  if (buffer.capacity > kMaxPooledBufferBytes) {
+    // oversized one-off transfer; not worth holding that much pinned memory
+    CUDA_CALL(cudaEventSynchronize(buffer.ready));
+    FreeBuffer(buffer);
+    return;
+  }
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  cached_bytes_ += buffer.capacity;
+  free_buffers_.push_back(std::move(buffer));
+
+  // trim completed buffers, oldest first, if the cache grew past its cap. in-flight buffers are
+  // left alone; they will be considered the next time the cache is over budget.
+  for (auto it = free_buffers_.begin(); it != free_buffers_.end() && cached_bytes_ > kMaxCachedBytes;) {
+    if (it->ready != nullptr && cudaEventQuery(it->ready) != cudaSuccess) {
+      ++it;
+      continue;
+    }
+    cached_bytes_ -= it->capacity;
+    FreeBuffer(*it);
+    it = free_buffers_.erase(it);
+  }
+}
+
+}  // namespace onnxruntime
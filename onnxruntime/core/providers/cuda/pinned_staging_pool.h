@@ -0,0 +1,55 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <list>
+
+#include "cuda_pch.h"
+#include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+// Cache of cudaHostAlloc'd buffers used to stage copies between pageable host memory and the GPU
+// through pinned memory. A pageable cudaMemcpy serializes on a small driver-internal staging
+// buffer; copying through a pooled pinned buffer instead keeps the transfer a single
+// full-bandwidth DMA. Buffers carry a completion event so they are only handed out again once the
+// copies that used them have finished. All methods are thread safe.
+class PinnedStagingPool {
+ public:
+  struct Buffer {
+    void* ptr{nullptr};
+    size_t capacity{0};
+    // pending copies through this buffer have completed once this event has fired
+    cudaEvent_t ready{nullptr};
+  };
+
+  PinnedStagingPool() = default;
+  ~PinnedStagingPool();
+
+  // Returns a pinned buffer with capacity of at least `size` bytes, reusing a cached buffer whose
+  // pending copies have completed when one fits, and allocating otherwise.
+  common::Status Acquire(size_t size, Buffer& buffer);
+
+  // Records completion of the buffer's pending copies on `stream` and returns the buffer to the
+  // cache. Call after the last copy using the buffer has been enqueued.
+  void Release(Buffer&& buffer, cudaStream_t stream);
+
+  // buffers larger than this are freed on release instead of cached
+  static constexpr size_t kMaxPooledBufferBytes = 64 * 1024 * 1024;
+  // cap on bytes kept in the cache; completed buffers beyond it are freed eagerly
+  static constexpr size_t kMaxCachedBytes = 256 * 1024 * 1024;
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(PinnedStagingPool);
+
+  // destroys the buffer's event and frees its pinned allocation
+  static void FreeBuffer(Buffer& buffer);
+
+  OrtMutex mutex_;
+  std::list<Buffer> free_buffers_;
+  size_t cached_bytes_{0};
+};
+
+}  // namespace onnxruntime
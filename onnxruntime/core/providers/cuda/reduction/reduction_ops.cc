@@ -414,7 +414,8 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
                          /*out*/ Tensor& output, cudnnReduceTensorOp_t cudnn_reduce_op,
                          const std::vector<int64_t>& axes,
                          bool calculate_log, bool calculate_sqt, bool log_sum_exp, bool fast_reduction,
-                         const TensorShape* input_shape_override) {
+                         const TensorShape* input_shape_override,
+                         CudnnReduceState* reduce_state) {
   typedef typename ToCudaType<T>::MappedType CudaT;
   const TensorShape& input_shape = input_shape_override ? *input_shape_override : input.Shape();
 
@@ -423,7 +424,7 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
   std::vector<int64_t>& output_dims = prepare_reduce_metadata.output_dims;
   std::vector<int64_t>& input_dims_cudnn = prepare_reduce_metadata.input_dims_cudnn;
   std::vector<int64_t>& output_dims_cudnn = prepare_reduce_metadata.output_dims_cudnn;
-  cudaStream_t stream = static_cast<cudaStream_t>(cuda_ep.GetComputeStream());
+  cudaStream_t stream = cuda_ep.PerThreadDefaultStream();
   // special case when there is a dim value of 0 in the shape.
   if (input_count == 0) {
     assert(output.Shape().Size() == 0);
@@ -471,28 +472,42 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
     Impl_Cast<CudaT, float>(stream, reinterpret_cast<const CudaT*>(input.template Data<T>()), temp_X.get(), input_shape.Size());
   }
 
-  CudnnReduceDescriptor reduce_desc;
-  if (std::is_same<T, MLFloat16>::value) {
-    ORT_RETURN_IF_ERROR(reduce_desc.Set(cudnn_reduce_op, CudnnTensor::GetDataType<float>(), ReduceTensorIndices));
-  } else {
-    ORT_RETURN_IF_ERROR(reduce_desc.Set(cudnn_reduce_op, cudnn_type_X, ReduceTensorIndices));
+  // Use the kernel instance's cached state when provided so steady-state calls with stable
+  // shapes reuse the cudnn descriptors and workspace size queries instead of redoing them per
+  // call.
+  CudnnReduceState local_state;
+  CudnnReduceState& s = (reduce_state != nullptr) ? *reduce_state : local_state;
+  std::lock_guard<OrtMutex> lock(s.mutex);
+
+  if (s.last_input_dims_cudnn != input_dims_cudnn ||
+      s.last_output_dims_cudnn != output_dims_cudnn ||
+      s.last_cudnn_type != cudnn_type_X) {
+    if (std::is_same<T, MLFloat16>::value) {
+      ORT_RETURN_IF_ERROR(s.reduce_desc.Set(cudnn_reduce_op, CudnnTensor::GetDataType<float>(), ReduceTensorIndices));
+    } else {
+      ORT_RETURN_IF_ERROR(s.reduce_desc.Set(cudnn_reduce_op, cudnn_type_X, ReduceTensorIndices));
+    }
+    ORT_RETURN_IF_ERROR(s.input_tensor.Set(input_dims_cudnn, cudnn_type_X));
+    ORT_RETURN_IF_ERROR(s.output_tensor.Set(output_dims_cudnn, cudnn_type_X));
+    CUDNN_RETURN_IF_ERROR(cudnnGetReductionWorkspaceSize(cuda_ep.PerThreadCudnnHandle(), s.reduce_desc,
+                                                         s.input_tensor, s.output_tensor, &s.workspace_bytes));
+    CUDNN_RETURN_IF_ERROR(cudnnGetReductionIndicesSize(cuda_ep.PerThreadCudnnHandle(), s.reduce_desc,
+                                                       s.input_tensor, s.output_tensor, &s.indices_bytes));
+    s.last_input_dims_cudnn = input_dims_cudnn;
+    s.last_output_dims_cudnn = output_dims_cudnn;
+    s.last_cudnn_type = cudnn_type_X;
   }
 
+  // the workspace and indices buffers are allocated per call on purpose: cudnnReduceTensor runs
+  // asynchronously after the lock is released, so a buffer shared between calls would race on
+  // the GPU when concurrent Run threads enqueue on different streams, and a buffer retained in
+  // the kernel would be freed from a different thread's arena than it was allocated from. the
+  // per-context arena makes these allocations contention free.
+  auto workspace_cuda = cuda_ep.GetScratchBuffer<void>(s.workspace_bytes);
+  auto indices_cuda = cuda_ep.GetScratchBuffer<uint32_t>(s.indices_bytes);
+
   const auto one = Consts<CudaT>::One;
   const auto zero = Consts<CudaT>::Zero;
-  CudnnTensor input_tensor;
-  CudnnTensor output_tensor;
-  ORT_RETURN_IF_ERROR(input_tensor.Set(input_dims_cudnn, cudnn_type_X));
-  ORT_RETURN_IF_ERROR(output_tensor.Set(output_dims_cudnn, cudnn_type_X));
-  size_t workspace_bytes = 0;
-  CUDNN_RETURN_IF_ERROR(cudnnGetReductionWorkspaceSize(cuda_ep.PerThreadCudnnHandle(), reduce_desc,
-                                                       input_tensor, output_tensor, &workspace_bytes));
-  auto workspace_cuda = cuda_ep.GetScratchBuffer<CudaT>(workspace_bytes);
-
-  size_t indices_bytes = 0;
-  CUDNN_RETURN_IF_ERROR(cudnnGetReductionIndicesSize(cuda_ep.PerThreadCudnnHandle(), reduce_desc,
-                                                     input_tensor, output_tensor, &indices_bytes));
-  auto indices_cuda = cuda_ep.GetScratchBuffer<uint32_t>(indices_bytes);
 
   if (ReduceTensorIndices == CUDNN_REDUCE_TENSOR_NO_INDICES) {
     IAllocatorUniquePtr<T> input_data_buffer(nullptr, [](T*) {});
@@ -524,13 +539,13 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
         ORT_RETURN_IF_ERROR(reduce_max_desc.Set(CUDNN_REDUCE_TENSOR_MAX, cudnn_reduce_max_type, CUDNN_REDUCE_TENSOR_NO_INDICES));
         size_t indices_bytes_max = 0;
         CUDNN_RETURN_IF_ERROR(cudnnGetReductionIndicesSize(cuda_ep.PerThreadCudnnHandle(), reduce_max_desc,
-                                                           input_tensor, output_tensor, &indices_bytes_max));
-        auto indices_cuda_max = cuda_ep.GetScratchBuffer<uint32_t>(indices_bytes);
+                                                           s.input_tensor, s.output_tensor, &indices_bytes_max));
+        auto indices_cuda_max = cuda_ep.GetScratchBuffer<uint32_t>(s.indices_bytes);
         CUDNN_RETURN_IF_ERROR(cudnnReduceTensor(
             cuda_ep.PerThreadCudnnHandle(), reduce_max_desc, indices_cuda_max.get(), indices_bytes_max,
-            workspace_cuda.get(), workspace_bytes,
-            &one, input_tensor, reinterpret_cast<const CudaT*>(input.template Data<T>()),
-            &zero, output_tensor, reinterpret_cast<CudaT*>(output.template MutableData<T>())));
+            workspace_cuda.get(), s.workspace_bytes,
+            &one, s.input_tensor, reinterpret_cast<const CudaT*>(input.template Data<T>()),
+            &zero, s.output_tensor, reinterpret_cast<CudaT*>(output.template MutableData<T>())));
       }
 
       // Exp(X-ReduceMax)
@@ -563,10 +578,10 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
       } else {
         // ReduceSum
         CUDNN_RETURN_IF_ERROR(cudnnReduceTensor(
-            cuda_ep.PerThreadCudnnHandle(), reduce_desc, indices_cuda.get(), indices_bytes,
-            workspace_cuda.get(), workspace_bytes,
-            &one, input_tensor, exp_result,
-            &zero, output_tensor, reinterpret_cast<CudaT*>(log_sum_result)));
+            cuda_ep.PerThreadCudnnHandle(), s.reduce_desc, indices_cuda.get(), s.indices_bytes,
+            workspace_cuda.get(), s.workspace_bytes,
+            &one, s.input_tensor, exp_result,
+            &zero, s.output_tensor, reinterpret_cast<CudaT*>(log_sum_result)));
       }
 
       // Log(Sum)
@@ -591,10 +606,10 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
         CUDA_RETURN_IF_ERROR(cudaMemcpyAsync(reinterpret_cast<CudaT*>(output.template MutableData<T>()), input_data, input_count * sizeof(T), cudaMemcpyDeviceToDevice, stream));
       } else {
         CUDNN_RETURN_IF_ERROR(cudnnReduceTensor(
-            cuda_ep.PerThreadCudnnHandle(), reduce_desc, indices_cuda.get(), indices_bytes,
-            workspace_cuda.get(), workspace_bytes,
-            &one, input_tensor, input_data,
-            &zero, output_tensor, reinterpret_cast<CudaT*>(output.template MutableData<T>())));
+            cuda_ep.PerThreadCudnnHandle(), s.reduce_desc, indices_cuda.get(), s.indices_bytes,
+            workspace_cuda.get(), s.workspace_bytes,
+            &one, s.input_tensor, input_data,
+            &zero, s.output_tensor, reinterpret_cast<CudaT*>(output.template MutableData<T>())));
       }
     } else {
       // cudnnReduceTensor for ReduceSum has issue if input and output has same size, we just need to copy the data for this case
@@ -604,10 +619,10 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
         }
       } else {
         CUDNN_RETURN_IF_ERROR(cudnnReduceTensor(
-            cuda_ep.PerThreadCudnnHandle(), reduce_desc, indices_cuda.get(), indices_bytes,
-            workspace_cuda.get(), workspace_bytes,
-            &one, input_tensor, reinterpret_cast<const CudaT*>(input.template Data<T>()),
-            &zero, output_tensor, reinterpret_cast<CudaT*>(output.template MutableData<T>())));
+            cuda_ep.PerThreadCudnnHandle(), s.reduce_desc, indices_cuda.get(), s.indices_bytes,
+            workspace_cuda.get(), s.workspace_bytes,
+            &one, s.input_tensor, reinterpret_cast<const CudaT*>(input.template Data<T>()),
+            &zero, s.output_tensor, reinterpret_cast<CudaT*>(output.template MutableData<T>())));
       }
     }
   } else {
@@ -620,21 +635,21 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
       if (temp_X) {
         auto temp_output = cuda_ep.GetScratchBuffer<float>(output_count);
         CUDNN_RETURN_IF_ERROR(cudnnReduceTensor(
-            cuda_ep.PerThreadCudnnHandle(), reduce_desc, indices_cuda.get(), indices_bytes,
-            workspace_cuda.get(), workspace_bytes,
-            &one, input_tensor, temp_X.get(),
-            &zero, output_tensor, temp_output.get()));
+            cuda_ep.PerThreadCudnnHandle(), s.reduce_desc, indices_cuda.get(), s.indices_bytes,
+            workspace_cuda.get(), s.workspace_bytes,
+            &one, s.input_tensor, temp_X.get(),
+            &zero, s.output_tensor, temp_output.get()));
       } else {
         auto temp_output = cuda_ep.GetScratchBuffer<CudaT>(output_count);
         CUDNN_RETURN_IF_ERROR(cudnnReduceTensor(
-            cuda_ep.PerThreadCudnnHandle(), reduce_desc, indices_cuda.get(), indices_bytes,
-            workspace_cuda.get(), workspace_bytes,
-            &one, input_tensor, reinterpret_cast<const CudaT*>(input.template Data<T>()),
-            &zero, output_tensor, temp_output.get()));
+            cuda_ep.PerThreadCudnnHandle(), s.reduce_desc, indices_cuda.get(), s.indices_bytes,
+            workspace_cuda.get(), s.workspace_bytes,
+            &one, s.input_tensor, reinterpret_cast<const CudaT*>(input.template Data<T>()),
+            &zero, s.output_tensor, temp_output.get()));
       }
 
       // CUDA reduction index is uint32_t for now, cast it to int64_t according to ONNX spec
-      Impl_Cast<uint32_t, int64_t>(stream, reinterpret_cast<uint32_t*>(indices_cuda.get()), output.template MutableData<int64_t>(), output_count);
+      Impl_Cast<uint32_t, int64_t>(stream, indices_cuda.get(), output.template MutableData<int64_t>(), output_count);
     }
   }
 
@@ -683,7 +698,8 @@ Status ReduceKernel<allow_multi_axes>::ComputeImpl(OpKernelContext* ctx, cudnnRe
   const bool fast_reduction = fast_reduction_ && !ctx->GetUseDeterministicCompute();
 
   return ReduceComputeCore<T, ReduceTensorIndices>(*cuda_ep_, *X, prepare_reduce_metadata, *Y, cudnn_reduce_op, axes,
-                                                   calculate_log_, calculate_sqt_, log_sum_exp_, fast_reduction);
+                                                   calculate_log_, calculate_sqt_, log_sum_exp_, fast_reduction,
+                                                   nullptr, &reduce_state_);
 }
 
 #define SPECIALIZED_REDUCEKERNEL_COMPUTEIMPL(T)                                                                      \
@@ -3,7 +3,9 @@
 
 #pragma once
 #include "core/common/optional.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/cuda/cuda_kernel.h"
+#include "core/providers/cuda/cudnn_common.h"
 #include "core/providers/cpu/reduction/reduction_ops.h"
 #include "core/providers/cuda/reduction/reduction_functions.h"
 
@@ -35,6 +37,71 @@ struct PrepareReduceMetadata {
   std::vector<int64_t> output_dims_cudnn;
 };
 
+// CUDA's reduction descriptor cudnnReduceTensorDescriptor_t is a pointer so
+// it's safer to wrap it with automatically memory deleter as CudnnReduceDescriptor.
+// An implicit caster from CudnnReduceDescriptor to cudnnReduceTensorDescriptor_t
+// is implemented below, so CUDA can seamlessly work.
+class CudnnReduceDescriptor final {
+ public:
+  CudnnReduceDescriptor() : desc_(nullptr) {
+  }
+
+  ~CudnnReduceDescriptor() {
+    if (desc_ != nullptr) {
+      cudnnDestroyReduceTensorDescriptor(desc_);
+      desc_ = nullptr;
+    }
+  }
+
+  CudnnReduceDescriptor(const CudnnReduceDescriptor&) = delete;
+  CudnnReduceDescriptor& operator=(const CudnnReduceDescriptor&) = delete;
+
+  Status Set(cudnnReduceTensorOp_t op, cudnnDataType_t type, cudnnReduceTensorIndices_t indices) {
+    if (!desc_)
+      CUDNN_RETURN_IF_ERROR(cudnnCreateReduceTensorDescriptor(&desc_));
+
+    CUDNN_RETURN_IF_ERROR(cudnnSetReduceTensorDescriptor(
+        desc_,
+        op,
+        type,
+        CUDNN_PROPAGATE_NAN,
+        indices,
+        CUDNN_32BIT_INDICES));  // currently only the 32-bit (unsigned int) type is supported.
+    return Status::OK();
+  }
+
+  operator cudnnReduceTensorDescriptor_t() const { return desc_; }
+
+ private:
+  cudnnReduceTensorDescriptor_t desc_;
+};
+
+// Per kernel-instance state for the cudnn reduction path. The descriptors and workspace sizes
+// only depend on the cudnn input/output dims and data type, so they are recomputed on shape
+// change and reused otherwise. The workspace buffers are resized monotonically, so
+// steady-state calls with stable shapes make no allocator round-trips.
+struct CudnnReduceState {
+  // if these changed, descriptors and workspace sizes are recomputed
+  std::vector<int64_t> last_input_dims_cudnn;
+  std::vector<int64_t> last_output_dims_cudnn;
+  cudnnDataType_t last_cudnn_type = CUDNN_DATA_FLOAT;
+
+  CudnnReduceDescriptor reduce_desc;
+  CudnnTensor input_tensor;
+  CudnnTensor output_tensor;
+  size_t workspace_bytes = 0;
+  size_t indices_bytes = 0;
+
+  // no device buffers are cached here: the reduction executes asynchronously after the lock is
+  // released, so a workspace shared between calls would race on the GPU when concurrent Run
+  // threads enqueue on different streams. workspaces are allocated per call from the per-context
+  // arena instead.
+
+  // note that reduce kernel objects are shared between execution frames, and a lock is needed
+  // to avoid multi-thread racing
+  OrtMutex mutex;
+};
+
 template <bool allow_multi_axes>
 class ReduceKernel : public CudaKernel, public ReduceKernelBase<allow_multi_axes> {
  protected:
@@ -83,6 +150,9 @@ class ReduceKernel : public CudaKernel, public ReduceKernelBase<allow_multi_axes
 
   // We need to access to the CUDA EP instance to get the cudnn handle
   CUDAExecutionProvider* cuda_ep_;
+
+  // Cached cudnn descriptors and workspaces, reused across Compute calls
+  mutable CudnnReduceState reduce_state_;
 };
 
 template <typename T>
@@ -224,46 +294,8 @@ Status ReduceComputeCore(CUDAExecutionProvider& cuda_ep, const Tensor& input, Pr
                          /*out*/ Tensor& output, cudnnReduceTensorOp_t cudnn_reduce_op,
                          const std::vector<int64_t>& axes,
                          bool calculate_log, bool calculate_sqt, bool log_sum_exp, bool fast_reduction,
-                         const TensorShape* input_shape_override = nullptr);
-
-// CUDA's reduction descriptor cudnnReduceTensorDescriptor_t is a pointer so
-// it's safer to wrap it with automatically memory deleter as CudnnReduceDescriptor.
-// An implicit caster from CudnnReduceDescriptor to cudnnReduceTensorDescriptor_t
-// is implemented below, so CUDA can seamlessly work.
-class CudnnReduceDescriptor final {
- public:
-  CudnnReduceDescriptor() : desc_(nullptr) {
-  }
-
-  ~CudnnReduceDescriptor() {
-    if (desc_ != nullptr) {
-      cudnnDestroyReduceTensorDescriptor(desc_);
-      desc_ = nullptr;
-    }
-  }
-
-  CudnnReduceDescriptor(const CudnnReduceDescriptor&) = delete;
-  CudnnReduceDescriptor& operator=(const CudnnReduceDescriptor&) = delete;
-
-  Status Set(cudnnReduceTensorOp_t op, cudnnDataType_t type, cudnnReduceTensorIndices_t indices) {
-    if (!desc_)
-      CUDNN_RETURN_IF_ERROR(cudnnCreateReduceTensorDescriptor(&desc_));
-
-    CUDNN_RETURN_IF_ERROR(cudnnSetReduceTensorDescriptor(
-        desc_,
-        op,
-        type,
-        CUDNN_PROPAGATE_NAN,
-        indices,
-        CUDNN_32BIT_INDICES));  // currently only the 32-bit (unsigned int) type is supported.
-    return Status::OK();
-  }
-
-  operator cudnnReduceTensorDescriptor_t() const { return desc_; }
-
- private:
-  cudnnReduceTensorDescriptor_t desc_;
-};
+                         const TensorShape* input_shape_override = nullptr,
+                         CudnnReduceState* reduce_state = nullptr);
 
 }  // namespace cuda
 }  // namespace onnxruntime
@@ -48,32 +48,38 @@ Status Concat::ComputeInternal(OpKernelContext* ctx) const {
   if (p.output_num_elements == 0)
     return Status::OK();
 
-  std::vector<int64_t> concat_sizes(input_count);
+  // Pack the per-input metadata (sizes, running size prefix, axis-to-input mapping and the
+  // input pointer table) into one pinned buffer so a single H2D copy services the whole
+  // launch, instead of one copy per metadata array.
+  static_assert(sizeof(void*) == sizeof(int64_t), "input pointers are packed into int64_t slots");
+  size_t axis_size = static_cast<size_t>(p.output_tensor->Shape()[p.axis]);
+  size_t count = static_cast<size_t>(input_count);
+  CudaAsyncBuffer<int64_t> concat_metadata(this, 3 * count + axis_size);
+  gsl::span<int64_t> metadata_span = concat_metadata.CpuSpan();
+  gsl::span<int64_t> concat_sizes = metadata_span.subspan(0, count);
+  gsl::span<int64_t> concat_sizes_range = metadata_span.subspan(count, count);
+  gsl::span<int64_t> axis_dimension_input_output_mapping = metadata_span.subspan(2 * count, axis_size);
+  gsl::span<int64_t> input_ptr = metadata_span.subspan(2 * count + axis_size, count);
 
-  CudaAsyncBuffer<const void*> input_ptr(this, input_count);
-  gsl::span<const void*> input_ptr_cpuspan = input_ptr.CpuSpan();
-  std::vector<int64_t> axis_dimension_input_output_mapping(p.output_tensor->Shape()[p.axis]);
   int index = 0;
   for (int i = 0; i < input_count; ++i) {
     auto input = p.inputs[i];
     concat_sizes[i] = input.tensor->Shape()[p.axis];
-    input_ptr_cpuspan[i] = input.tensor->DataRaw();
+    input_ptr[i] = reinterpret_cast<int64_t>(input.tensor->DataRaw());
     for (int j = 0; j < input.tensor->Shape()[p.axis]; ++j) {
-      axis_dimension_input_output_mapping.at(index++) = i;
+      axis_dimension_input_output_mapping[index++] = i;
     }
   }
-  std::vector<int64_t> concat_sizes_range(concat_sizes);
-  for (size_t i = 1; i < concat_sizes_range.size(); ++i) {
-    concat_sizes_range[i] += concat_sizes_range[i - 1];
+  concat_sizes_range[0] = concat_sizes[0];
+  for (size_t i = 1; i < count; ++i) {
+    concat_sizes_range[i] = concat_sizes_range[i - 1] + concat_sizes[i];
   }
 
-  CudaAsyncBuffer<int64_t> concat_sizes_gpu(this, concat_sizes);
-  CudaAsyncBuffer<int64_t> axis_dimension_input_output_mapping_gpu(this, axis_dimension_input_output_mapping);
-  CudaAsyncBuffer<int64_t> concat_sizes_range_gpu(this, concat_sizes_range);
-  concat_sizes_gpu.CopyToGpu();
-  axis_dimension_input_output_mapping_gpu.CopyToGpu();
-  concat_sizes_range_gpu.CopyToGpu();
-  input_ptr.CopyToGpu();
+  ORT_RETURN_IF_ERROR(concat_metadata.CopyToGpu());
+  const int64_t* concat_sizes_gpu = concat_metadata.GpuPtr();
+  const int64_t* concat_sizes_range_gpu = concat_sizes_gpu + count;
+  const int64_t* axis_dimension_input_output_mapping_gpu = concat_sizes_range_gpu + count;
+  const void** input_ptr_gpu = reinterpret_cast<const void**>(concat_metadata.GpuPtr() + 2 * count + axis_size);
   int block_size_inside_axis_dim = static_cast<int>(p.output_axis_pitch / p.output_tensor->Shape()[p.axis]);
   int block_size_including_axis_dim = static_cast<int>(p.output_axis_pitch);
   auto element_bytes = p.output_tensor->DataType()->Size();
@@ -81,11 +87,11 @@ Status Concat::ComputeInternal(OpKernelContext* ctx) const {
                                  element_bytes,
                                  block_size_including_axis_dim,
                                  block_size_inside_axis_dim,
-                                 concat_sizes_gpu.GpuPtr(),
-                                 concat_sizes_range_gpu.GpuPtr(),
-                                 axis_dimension_input_output_mapping_gpu.GpuPtr(),
+                                 concat_sizes_gpu,
+                                 concat_sizes_range_gpu,
+                                 axis_dimension_input_output_mapping_gpu,
                                  p.output_tensor->MutableDataRaw(),
-                                 input_ptr.GpuPtr(),
+                                 input_ptr_gpu,
                                  p.output_num_elements));
   return Status::OK();
 }
@@ -68,9 +68,19 @@ Status Split::ComputeInternal(OpKernelContext* ctx) const {
   auto& input_dims = input_shape.GetDims();
   std::vector<int64_t> output_dimensions{input_dims};
 
-  CudaAsyncBuffer<void*> output_ptr(this, num_outputs);
-  gsl::span<void*> output_ptr_span = output_ptr.CpuSpan();
-  std::vector<int64_t> axis_dimension_input_output_mapping(input_dims[axis]);
+  // Pack the per-output metadata (sizes, running size prefix, axis-to-output mapping and the
+  // output pointer table) into one pinned buffer so a single H2D copy services the whole
+  // launch, instead of one copy per metadata array.
+  static_assert(sizeof(void*) == sizeof(int64_t), "output pointers are packed into int64_t slots");
+  size_t axis_size = static_cast<size_t>(input_dims[axis]);
+  size_t count = static_cast<size_t>(num_outputs);
+  CudaAsyncBuffer<int64_t> split_metadata(this, 3 * count + axis_size);
+  gsl::span<int64_t> metadata_span = split_metadata.CpuSpan();
+  gsl::span<int64_t> split_sizes_span = metadata_span.subspan(0, count);
+  gsl::span<int64_t> split_sizes_range = metadata_span.subspan(count, count);
+  gsl::span<int64_t> axis_dimension_input_output_mapping = metadata_span.subspan(2 * count, axis_size);
+  gsl::span<int64_t> output_ptr = metadata_span.subspan(2 * count + axis_size, count);
+
   int index = 0;
   for (int i = 0; i < num_outputs; ++i) {
     // update size of dimension for axis we're splitting on
@@ -78,41 +88,32 @@ Status Split::ComputeInternal(OpKernelContext* ctx) const {
     output_dimensions[axis] = split_size;
 
     Tensor* output = ctx->Output(i, TensorShape{output_dimensions});
-    auto output_data = output->MutableDataRaw();
-    output_ptr_span[i] = output_data;
+    output_ptr[i] = reinterpret_cast<int64_t>(output->MutableDataRaw());
+    split_sizes_span[i] = split_size;
+    split_sizes_range[i] = (i == 0) ? split_size : split_sizes_range[i - 1] + split_size;
     for (int j = 0; j < split_size; ++j) {
-      axis_dimension_input_output_mapping.at(index++) = i;
+      axis_dimension_input_output_mapping[index++] = i;
     }
   }
 
   if (input_tensor->Shape().Size() > 0) {
-    output_ptr.CopyToGpu();
-
-    CudaAsyncBuffer<int64_t> split_sizes_gpu(this, split_sizes);
-    split_sizes_gpu.CopyToGpu();
-
-    std::vector<int64_t> split_sizes_range(split_sizes);
-    for (size_t i = 1; i < split_sizes_range.size(); ++i) {
-      split_sizes_range[i] += split_sizes_range[i - 1];
-    }
-
-    CudaAsyncBuffer<int64_t> split_sizes_range_gpu(this, split_sizes_range);
-    split_sizes_range_gpu.CopyToGpu();
-
-    CudaAsyncBuffer<int64_t> axis_dimension_input_output_mapping_gpu(this, axis_dimension_input_output_mapping);
-    axis_dimension_input_output_mapping_gpu.CopyToGpu();
+    ORT_RETURN_IF_ERROR(split_metadata.CopyToGpu());
+    const int64_t* split_sizes_gpu = split_metadata.GpuPtr();
+    const int64_t* split_sizes_range_gpu = split_sizes_gpu + count;
+    const int64_t* axis_dimension_input_output_mapping_gpu = split_sizes_range_gpu + count;
+    void** output_ptr_gpu = reinterpret_cast<void**>(split_metadata.GpuPtr() + 2 * count + axis_size);
 
     size_t element_size = input_tensor->DataType()->Size();
     ORT_RETURN_IF_ERROR(SplitImpl(Stream(),
                                   element_size,
                                   block_size_including_axis_dim,
                                   block_size_inside_axis_dim,
-                                  split_sizes_gpu.GpuPtr(),
-                                  split_sizes_range_gpu.GpuPtr(),
-                                  axis_dimension_input_output_mapping_gpu.GpuPtr(),
+                                  split_sizes_gpu,
+                                  split_sizes_range_gpu,
+                                  axis_dimension_input_output_mapping_gpu,
                                   num_outputs,
                                   input_data,
-                                  output_ptr.GpuPtr(),
+                                  output_ptr_gpu,
                                   input_shape.Size()));
   }
 
@@ -0,0 +1,90 @@
+// Copyright(C) 2021 Intel Corporation
+// Licensed under the MIT License
+
+#pragma once
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "dnnl.hpp"
+#include "core/framework/allocator.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+namespace ort_dnnl {
+
+// Process-wide cache of reordered weight blobs, shared across DNNL execution provider
+// instances. Every session that loads the same model reorders identical weights into the same
+// blocked layout; the first session publishes the reordered blob here and later sessions reuse
+// it instead of redoing the reorder and holding their own copy. (The oneDNN primitives
+// themselves are already deduplicated process-wide by the library's built-in primitive cache,
+// since all sessions create them from identical primitive descriptors.)
+//
+// The key combines the weight name, the destination memory descriptor and a content hash of the
+// source bytes, so equally named weights from different models - or the same weight reordered
+// for a different blocked layout - never alias. Entries live for the lifetime of the process;
+// the backing buffers are owned here and their allocators are kept alive by the buffer deleters,
+// so a cached blob stays valid after the session that published it is destroyed.
+class DnnlSharedWeightCache {
+ public:
+  static DnnlSharedWeightCache& Instance() {
+    static DnnlSharedWeightCache instance;
+    return instance;
+  }
+
+  std::shared_ptr<dnnl::memory> Lookup(const std::string& key) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto iter = weights_.find(key);
+    if (iter != weights_.end())
+      return iter->second;
+    return nullptr;
+  }
+
+  // Publish a reordered blob. First writer wins: the returned entry may differ from weight_mem
+  // if another session published the same key concurrently, and callers must use the returned
+  // memory. The buffer backing weight_mem is kept alive here when it is inserted.
+  std::shared_ptr<dnnl::memory> Insert(const std::string& key,
+                                       const std::shared_ptr<dnnl::memory>& weight_mem,
+                                       IAllocatorUniquePtr<void> buffer) {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto iter = weights_.find(key);
+    if (iter != weights_.end())
+      return iter->second;
+    buffers_.push_back(std::move(buffer));
+    weights_.insert(std::make_pair(key, weight_mem));
+    return weight_mem;
+  }
+
+  // Build the cache key for a weight from its name, destination layout and a FNV-1a hash of the
+  // source bytes. Hashing reads the weight once, which only happens on the per-provider cache
+  // miss (once per session per weight) and is cheap next to the reorder it can replace.
+  static std::string BuildKey(const std::string& weight_name, const dnnl::memory::desc& dst_desc,
+                              const void* src_data, size_t src_size_bytes) {
+    uint64_t hash = HashBytes(src_data, src_size_bytes, 0xCBF29CE484222325ULL);
+    hash = HashBytes(&dst_desc.data, sizeof(dst_desc.data), hash);
+    return weight_name + "_" + std::to_string(hash);
+  }
+
+ private:
+  DnnlSharedWeightCache() = default;
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(DnnlSharedWeightCache);
+
+  static uint64_t HashBytes(const void* data, size_t num_bytes, uint64_t hash) {
+    const unsigned char* bytes = static_cast<const unsigned char*>(data);
+    for (size_t i = 0; i < num_bytes; ++i) {
+      hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+  }
+
+  OrtMutex mutex_;
+  std::unordered_map<std::string, std::shared_ptr<dnnl::memory>> weights_;
+  // keeps the blobs backing the cached dnnl::memory objects alive.
+  std::vector<IAllocatorUniquePtr<void>> buffers_;
+};
+
+}  // namespace ort_dnnl
+}  // namespace onnxruntime
@@ -5,6 +5,7 @@
 #include "mkldnn_types.h"
 #include "core/providers/dnnl/dnnl_fwd.h"
 #include "core/providers/dnnl/dnnl_execution_provider.h"
+#include "core/providers/dnnl/dnnl_shared_weight_cache.h"
 #include "core/providers/dnnl/subgraph/dnnl_kernel.h"
 
 namespace onnxruntime {
@@ -471,8 +472,26 @@ class DnnlConv : public DnnlKernel {
 
       if (filter_dst_mem == nullptr) {
         dnnl::memory src = dnnl::memory({{filter_dims_mkl}, DnnnType<T>(), filter_format_}, cpu_engine, (void*)filter_data);
-        IAllocatorUniquePtr<void> filter_reorder_buffer = IAllocator::MakeUniquePtr<void>(alloc_, filter_size_);
         if (!gpu_available_) {
+#ifndef ENABLE_TRAINING
+          // consult the process-wide cache first, so sessions that loaded the same model share
+          // one reordered blob instead of each redoing the reorder
+          const std::string shared_key = DnnlSharedWeightCache::BuildKey(
+              mklnode_ptr_->weight_name, conv_fwd_pd_->weights_desc(), filter_data, src.get_desc().get_size());
+          filter_dst_mem = DnnlSharedWeightCache::Instance().Lookup(shared_key);
+          if (filter_dst_mem == nullptr) {
+            IAllocatorUniquePtr<void> filter_reorder_buffer = IAllocator::MakeUniquePtr<void>(alloc_, filter_size_);
+            filter_dst_mem = std::make_shared<dnnl::memory>(
+                dnnl::memory(conv_fwd_pd_->weights_desc(), cpu_engine, filter_reorder_buffer.get()));
+
+            dnnl::reorder(src, *filter_dst_mem)
+                .execute(cpu_engine, src, *filter_dst_mem);
+
+            filter_dst_mem = DnnlSharedWeightCache::Instance().Insert(shared_key, filter_dst_mem,
+                                                                      std::move(filter_reorder_buffer));
+          }
+#else
+          IAllocatorUniquePtr<void> filter_reorder_buffer = IAllocator::MakeUniquePtr<void>(alloc_, filter_size_);
           filter_dst_mem = onnxruntime::make_unique<dnnl::memory>(
               dnnl::memory(conv_fwd_pd_->weights_desc(), cpu_engine, filter_reorder_buffer.get()));
 
@@ -480,6 +499,7 @@ class DnnlConv : public DnnlKernel {
               .execute(cpu_engine, src, *filter_dst_mem);
 
           provider_->SaveAllocatedMemory(std::move(filter_reorder_buffer));
+#endif  // !ENABLE_TRAINING
           filter_data = static_cast<T*>(filter_dst_mem->get_data_handle());
         } else {  // gpu_available_
           filter_dst_mem = onnxruntime::make_unique<dnnl::memory>(
@@ -570,6 +570,22 @@ Status ModelBuilder::Compile(std::unique_ptr<Model>& model) {
           nnapi_model_->compilation_, static_cast<int32_t>(exe_pref_)),
       "on setPreference");
 
+  if (!compilation_cache_dir_.empty()) {
+    if (GetAndroidSdkVer() >= 29) {
+      // let the driver reuse a previously compiled model across sessions/processes. the cache
+      // files are keyed by the token, which covers everything that shapes the compiled artifact
+      const auto token = ComputeCompilationCacheToken();
+      RETURN_STATUS_ON_ERROR_WITH_NOTE(
+          nnapi_->ANeuralNetworksCompilation_setCaching(
+              nnapi_model_->compilation_, compilation_cache_dir_.c_str(), token.data()),
+          "on setCaching");
+    } else {
+      LOGS_DEFAULT(WARNING) << "NNAPI compilation caching requires Android API level 29+, "
+                            << "system API level: " << GetAndroidSdkVer()
+                            << ", the cache directory is ignored";
+    }
+  }
+
   RETURN_STATUS_ON_ERROR_WITH_NOTE(
       nnapi_->ANeuralNetworksCompilation_finish(nnapi_model_->compilation_),
       "on compilation finish");
@@ -578,6 +594,75 @@ Status ModelBuilder::Compile(std::unique_ptr<Model>& model) {
   return Status::OK();
 }
 
+std::vector<uint8_t> ModelBuilder::ComputeCompilationCacheToken() const {
+  // FNV-1a over everything that determines the compiled artifact: graph topology, node
+  // attributes, initializer contents and the build options. NNAPI trusts the token completely -
+  // a stale or colliding token would let a driver hand back a mismatched binary - so the
+  // initializer bytes are hashed rather than just their names.
+  auto hash_bytes = [](const void* data, size_t num_bytes, uint64_t hash) {
+    const auto* bytes = static_cast<const uint8_t*>(data);
+    for (size_t i = 0; i < num_bytes; ++i) {
+      hash = (hash ^ bytes[i]) * 0x100000001B3ULL;
+    }
+    return hash;
+  };
+  auto hash_string = [&hash_bytes](const std::string& str, uint64_t hash) {
+    return hash_bytes(str.data(), str.size(), hash);
+  };
+
+  uint64_t hash = 0xCBF29CE484222325ULL;
+
+  const uint8_t options[] = {static_cast<uint8_t>(use_nchw_), static_cast<uint8_t>(use_fp16_),
+                             static_cast<uint8_t>(target_device_option_),
+                             static_cast<uint8_t>(exe_pref_)};
+  hash = hash_bytes(options, sizeof(options), hash);
+
+  for (const auto* input : graph_viewer_.GetInputs()) {
+    hash = hash_string(input->Name(), hash);
+    if (const auto* type_proto = input->TypeAsProto()) {
+      hash = hash_string(type_proto->SerializeAsString(), hash);
+    }
+  }
+
+  for (const auto node_idx : graph_viewer_.GetNodesInTopologicalOrder()) {
+    const auto* node = graph_viewer_.GetNode(node_idx);
+    hash = hash_string(node->Domain(), hash);
+    hash = hash_string(node->OpType(), hash);
+    for (const auto* def : node->InputDefs()) {
+      hash = hash_string(def->Name(), hash);
+    }
+    for (const auto* def : node->OutputDefs()) {
+      hash = hash_string(def->Name(), hash);
+    }
+    for (const auto& attr : node->GetAttributes()) {
+      hash = hash_string(attr.first, hash);
+      hash = hash_string(attr.second.SerializeAsString(), hash);
+    }
+  }
+
+  // initializers in sorted order, the InitializedTensorSet iteration order is unspecified
+  std::vector<std::string> initializer_names;
+  const auto& initializers = GetInitializerTensors();
+  initializer_names.reserve(initializers.size());
+  for (const auto& pair : initializers) {
+    initializer_names.push_back(pair.first);
+  }
+  std::sort(initializer_names.begin(), initializer_names.end());
+  for (const auto& name : initializer_names) {
+    hash = hash_string(name, hash);
+    hash = hash_string(initializers.at(name)->SerializeAsString(), hash);
+  }
+
+  // the token must be ANEURALNETWORKS_BYTE_SIZE_OF_CACHE_TOKEN (32) bytes; chain the 64-bit hash
+  std::vector<uint8_t> token(32);
+  for (size_t i = 0; i < token.size(); i += sizeof(hash)) {
+    memcpy(token.data() + i, &hash, sizeof(hash));
+    hash = hash_bytes(&hash, sizeof(hash), hash);
+  }
+
+  return token;
+}
+
 int32_t ModelBuilder::FindActivation(const Node& node, const NodeArg& output) {
   int32_t fuse_code = ANEURALNETWORKS_FUSED_NONE;
 
@@ -79,6 +79,12 @@ class ModelBuilder {
 
   void SetTargetDeviceOption(TargetDeviceOption option) { target_device_option_ = option; }
 
+  // Directory for the NNAPI vendor compilation cache (ANeuralNetworksCompilation_setCaching).
+  // When set (and the device runs Android API level 29+), drivers can reuse a previously
+  // compiled model across sessions and processes instead of recompiling it.
+  // The directory must exist and be writable by the process. Off (empty) by default.
+  void SetCompilationCacheDir(const std::string& dir) { compilation_cache_dir_ = dir; }
+
   // Set NNAPI execution preference
   // Default preference is PREFER_SUSTAINED_SPEED
   void ExecutePreference(
@@ -155,6 +161,8 @@ class ModelBuilder {
   std::vector<ANeuralNetworksDevice*> nnapi_target_devices_;
   std::string nnapi_target_devices_detail_;  // Debug info for target devices
 
+  std::string compilation_cache_dir_;
+
   // The number of nnapi operations in this model
   size_t num_nnapi_ops_ = 0;
   uint32_t next_index_ = 0;
@@ -164,6 +172,10 @@ class ModelBuilder {
 
   Status GetTargetDevices() ORT_MUST_USE_RESULT;
 
+  // 32-byte token identifying this model for the vendor compilation cache, derived from the
+  // graph contents and the build options that affect the compiled artifact
+  std::vector<uint8_t> ComputeCompilationCacheToken() const;
+
   // If a NNAPI operation will use initializers directly, we will add the initializers to the skip list
   void PreprocessInitializers();
   // Preprocess all the activation nodes (Relu/Relu1/Relu6) for easy query later
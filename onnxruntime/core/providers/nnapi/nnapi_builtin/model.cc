@@ -7,6 +7,7 @@
 #include "core/providers/common.h"
 #include "core/providers/nnapi/nnapi_builtin/builders/helper.h"
 #include "core/providers/nnapi/nnapi_builtin/nnapi_lib/nnapi_implementation.h"
+#include "core/providers/nnapi/nnapi_builtin/nnapi_shared_mem_allocator.h"
 
 #ifdef USENNAPISHAREDMEM
 #include <sys/mman.h>
@@ -176,8 +177,20 @@ Status Execution::SetOutputBuffers(const std::vector<OutputBuffer>& outputs) {
 }
 
 Status Execution::SetInputBuffer(const int32_t index, const InputBuffer& input) {
+  const size_t byte_size = input.type.GetOperandBlobByteSize();
+
+  // buffers allocated by the NNAPI EP live in NNAPI shared memory; hand the memory object to
+  // the execution so the runtime maps it into the driver instead of copying the bytes each run
+  size_t offset = 0;
+  if (ANeuralNetworksMemory* memory_handle =
+          NnapiSharedMemAllocator::GetMemoryHandle(input.buffer, byte_size, offset)) {
+    RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_setInputFromMemory(
+        execution_, index, &input.type.operandType, memory_handle, offset, byte_size));
+    return Status::OK();
+  }
+
   RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_setInput(
-      execution_, index, &input.type.operandType, input.buffer, input.type.GetOperandBlobByteSize()));
+      execution_, index, &input.type.operandType, input.buffer, byte_size));
 
   return Status::OK();
 }
@@ -186,6 +199,14 @@ Status Execution::SetOutputBuffer(const int32_t index, const OutputBuffer& outpu
   LOGS_DEFAULT(VERBOSE) << "Model::SetOutputBuffer, output shape "
                         << Shape2String(output.type.dimensions);
 
+  size_t offset = 0;
+  if (ANeuralNetworksMemory* memory_handle =
+          NnapiSharedMemAllocator::GetMemoryHandle(output.buffer, output.buffer_byte_size, offset)) {
+    RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_setOutputFromMemory(
+        execution_, index, &output.type.operandType, memory_handle, offset, output.buffer_byte_size));
+    return Status::OK();
+  }
+
   RETURN_STATUS_ON_ERROR(nnapi_->ANeuralNetworksExecution_setOutput(
       execution_, index, &output.type.operandType, output.buffer, output.buffer_byte_size));
 
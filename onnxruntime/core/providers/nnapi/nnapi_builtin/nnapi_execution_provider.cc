@@ -14,6 +14,8 @@
 #ifdef __ANDROID__
 #include "model.h"
 #include "builders/model_builder.h"
+#include "core/platform/env.h"
+#include "nnapi_shared_mem_allocator.h"
 #endif
 
 namespace onnxruntime {
@@ -24,8 +26,14 @@ NnapiExecutionProvider::NnapiExecutionProvider(uint32_t nnapi_flags)
     : IExecutionProvider{onnxruntime::kNnapiExecutionProvider},
       nnapi_flags_(nnapi_flags) {
   AllocatorCreationInfo device_info(
-      [](int) {
+      [](int) -> std::unique_ptr<IAllocator> {
+#ifdef __ANDROID__
+        // back the EP's tensors with NNAPI shared memory so executions can consume them through
+        // setInputFromMemory/setOutputFromMemory without the runtime's per-run pointer copies
+        return onnxruntime::make_unique<nnapi::NnapiSharedMemAllocator>();
+#else
         return onnxruntime::make_unique<CPUAllocator>(OrtMemoryInfo(NNAPI, OrtAllocatorType::OrtDeviceAllocator));
+#endif
       });
 
   InsertAllocator(CreateAllocator(device_info));
@@ -260,6 +268,14 @@ common::Status NnapiExecutionProvider::Compile(const std::vector<FusedNodeAndGra
       builder.SetTargetDeviceOption(nnapi::ModelBuilder::TargetDeviceOption::CPU_DISABLED);
     }
 
+    // Opt-in vendor compilation cache, so drivers reuse previously compiled models across
+    // sessions and processes sharing the directory instead of recompiling at every startup.
+    const std::string compilation_cache_dir =
+        Env::Default().GetEnvironmentVar("ORT_NNAPI_COMPILATION_CACHE_DIR");
+    if (!compilation_cache_dir.empty()) {
+      builder.SetCompilationCacheDir(compilation_cache_dir);
+    }
+
     std::unique_ptr<nnapi::Model> nnapi_model;
     ORT_RETURN_IF_ERROR(builder.Compile(nnapi_model));
 
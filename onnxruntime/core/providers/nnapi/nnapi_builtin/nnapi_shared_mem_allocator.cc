@@ -0,0 +1,95 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "nnapi_shared_mem_allocator.h"
+
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <core/common/logging/logging.h>
+
+#include "core/framework/utils.h"
+#include "core/providers/nnapi/nnapi_builtin/nnapi_lib/nnapi_implementation.h"
+
+namespace onnxruntime {
+namespace nnapi {
+
+OrtMutex NnapiSharedMemAllocator::mutex_;
+std::map<const void*, NnapiSharedMemAllocator::Region> NnapiSharedMemAllocator::regions_;
+
+NnapiSharedMemAllocator::NnapiSharedMemAllocator()
+    : IAllocator(OrtMemoryInfo("Nnapi", OrtAllocatorType::OrtDeviceAllocator)),
+      nnapi_(NnApiImplementation()) {}
+
+void* NnapiSharedMemAllocator::Alloc(size_t size) {
+  if (size == 0)
+    return nullptr;
+
+  int fd = nnapi_->ASharedMemory_create("ort_shared_mem", size);
+  if (fd <= 0)
+    return utils::DefaultAlloc(size);
+
+  void* data_ptr = mmap(nullptr, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+  if (data_ptr == MAP_FAILED) {
+    close(fd);
+    return utils::DefaultAlloc(size);
+  }
+
+  ANeuralNetworksMemory* nn_memory_handle = nullptr;
+  if (nnapi_->ANeuralNetworksMemory_createFromFd(size, PROT_READ | PROT_WRITE, fd, 0,
+                                                 &nn_memory_handle) != ANEURALNETWORKS_NO_ERROR) {
+    munmap(data_ptr, size);
+    close(fd);
+    return utils::DefaultAlloc(size);
+  }
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  regions_.emplace(data_ptr, Region{size, fd, nn_memory_handle});
+  return data_ptr;
+}
+
+void NnapiSharedMemAllocator::Free(void* p) {
+  if (p == nullptr)
+    return;
+
+  Region region;
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    auto iter = regions_.find(p);
+    if (iter == regions_.end()) {
+      // fallback allocation from DefaultAlloc
+      utils::DefaultFree(p);
+      return;
+    }
+    region = iter->second;
+    regions_.erase(iter);
+  }
+
+  nnapi_->ANeuralNetworksMemory_free(region.nn_memory_handle);
+  munmap(p, region.byte_size);
+  close(region.fd);
+}
+
+ANeuralNetworksMemory* NnapiSharedMemAllocator::GetMemoryHandle(const void* p, size_t size,
+                                                                size_t& offset) {
+  if (p == nullptr)
+    return nullptr;
+
+  std::lock_guard<OrtMutex> lock(mutex_);
+  // find the last region starting at or before p and check p + size stays within it
+  auto iter = regions_.upper_bound(p);
+  if (iter == regions_.begin())
+    return nullptr;
+  --iter;
+
+  const auto* base = static_cast<const uint8_t*>(iter->first);
+  const auto* ptr = static_cast<const uint8_t*>(p);
+  if (ptr + size > base + iter->second.byte_size)
+    return nullptr;
+
+  offset = static_cast<size_t>(ptr - base);
+  return iter->second.nn_memory_handle;
+}
+
+}  // namespace nnapi
+}  // namespace onnxruntime
@@ -0,0 +1,56 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+
+#include "core/framework/allocator.h"
+#include "core/platform/ort_mutex.h"
+
+struct NnApi;
+typedef struct ANeuralNetworksMemory ANeuralNetworksMemory;
+
+namespace onnxruntime {
+namespace nnapi {
+
+// CPU-visible allocator backed by NNAPI shared memory (ASharedMemory). Tensors allocated here
+// are ordinary host memory as far as ORT kernels are concerned, but each allocation also carries
+// an ANeuralNetworksMemory handle, so the execution path can hand the buffer to
+// setInputFromMemory/setOutputFromMemory and the NNAPI runtime maps the region into the driver
+// instead of copying pointer-based I/O on every run.
+//
+// Registered as the NNAPI EP's default allocator, so the compiled nodes' outputs (and the inputs
+// of any downstream NNAPI node they feed) land in shared memory. Buffers from other allocators
+// (regular CPU tensors, user-provided inputs) are simply not found by GetMemoryHandle and take
+// the existing pointer-based path.
+class NnapiSharedMemAllocator : public IAllocator {
+ public:
+  NnapiSharedMemAllocator();
+
+  void* Alloc(size_t size) override;
+  void Free(void* p) override;
+
+  // If [p, p + size) lies inside a live shared-memory allocation, returns its
+  // ANeuralNetworksMemory handle and sets offset to the byte offset of p within the region.
+  // Interior pointers are supported since an arena may sub-allocate from the regions.
+  // Returns nullptr for foreign buffers.
+  static ANeuralNetworksMemory* GetMemoryHandle(const void* p, size_t size, size_t& offset);
+
+ private:
+  struct Region {
+    size_t byte_size;
+    int fd;
+    ANeuralNetworksMemory* nn_memory_handle;
+  };
+
+  // process-wide so the execution path can resolve a tensor's buffer without access to the
+  // allocator instance that produced it
+  static OrtMutex mutex_;
+  static std::map<const void*, Region> regions_;  // keyed by mapped base address
+
+  const NnApi* nnapi_{nullptr};
+};
+
+}  // namespace nnapi
+}  // namespace onnxruntime
@@ -18,8 +18,10 @@
 #define _SILENCE_EXPERIMENTAL_FILESYSTEM_DEPRECATION_WARNING  // required by VS 2019
 #include <experimental/filesystem>
 #undef _SILENCE_EXPERIMENTAL_FILESYSTEM_DEPRECATION_WARNING
+#include <algorithm>
 #include <atomic>
 #include <fstream>
+#include <sstream>
 namespace fs = std::experimental::filesystem;
 
 namespace onnxruntime {
@@ -49,6 +51,22 @@ static bool GetOrCreateTVMModuleCacheDirectory(fs::path& path, bool create) {
       throw std::runtime_error("Failed to create directory " + path.string());
     }
 
+  // generated object code is specific to the TVM used to produce it, so key the
+  // cache directory by TVM version as well to avoid picking up stale artifacts
+  // after a TVM upgrade
+#ifdef TVM_VERSION
+  path.append(std::string("tvm_") + TVM_VERSION);
+#else
+  path.append("tvm_unknown");
+#endif
+  if (!create && !fs::is_directory(path))
+    return false;
+
+  if (!fs::is_directory(path))
+    if (!fs::create_directory(path)) {
+      throw std::runtime_error("Failed to create directory " + path.string());
+    }
+
   return true;
 }
 
@@ -67,6 +85,19 @@ static bool GetCacheSoFilePath(std::string& so_path) {
   return false;
 }
 
+static bool GetPerFuncSoFilePath(std::string& so_path, const std::string& func_name) {
+  fs::path path;
+  if (!GetOrCreateTVMModuleCacheDirectory(path, /*create*/ false))
+    return false;
+
+  path.append(func_name + ".so");
+  if (fs::is_regular_file(path)) {
+    so_path = path.string();
+    return true;
+  }
+  return false;
+}
+
 static void* GetFuncFromLibrary(const std::string& so_path, const std::string& func_name, bool throw_if_not_found = true) {
   void* so_handle;
   ORT_ENFORCE(Env::Default().LoadDynamicLibrary(so_path, &so_handle).IsOK());
@@ -164,6 +195,18 @@ static bool VerifyTVMModuleChecksum(const std::string& so_path) {
 }
 
 CacheStatus LoadTVMPackedFuncFromCache(const std::string& func_name, tvm::runtime::PackedFunc& func) {
+  // prefer a per-function shared object: its file name already carries the subgraph content
+  // hash and codegen target, and its directory the cache and TVM versions, so no embedded
+  // version/checksum validation is needed
+  std::string per_func_so_path;
+  if (GetPerFuncSoFilePath(per_func_so_path, func_name)) {
+    tvm::runtime::Module module = tvm::runtime::Module::LoadFromFile(per_func_so_path);
+    func = module.GetFunction(func_name);
+    if (func != nullptr)
+      return CacheStatus::Found;
+    LOGS_DEFAULT(CODEGEN_SETTINGS_LOG_LEVEL) << "Cannot find " << func_name << " in " << per_func_so_path << ", using JIT...";
+  }
+
   std::string so_path;
   if (!GetCacheSoFilePath(so_path)) {
     if (codegen::CodeGenSettings::Instance().HasOption(kNupharCachePath)) {
@@ -204,9 +247,78 @@ void SaveTVMModuleToCache(const std::string& filename, tvm::runtime::Module& mod
   }
 }
 
+// FNV-1a over raw bytes, used to derive a content hash of a subgraph so cached artifacts
+// from a different (or edited) model can never be picked up by mistake
+static uint64_t HashBytes(const void* data, size_t num_bytes, uint64_t h) {
+  const uint8_t* bytes = static_cast<const uint8_t*>(data);
+  for (size_t i = 0; i < num_bytes; ++i) {
+    h = (h ^ bytes[i]) * 1099511628211ULL;
+  }
+  return h;
+}
+
+static uint64_t HashString(const std::string& s, uint64_t h) {
+  return HashBytes(s.data(), s.size(), h);
+}
+
+static uint64_t HashSubgraphContent(const nuphar::NupharSubgraphUnit& subgraph) {
+  uint64_t h = 14695981039346656037ULL;  // FNV-1a offset basis
+
+  auto hash_node_arg = [&h](const NodeArg& def) {
+    h = HashString(def.Name(), h);
+    if (def.TypeAsProto() != nullptr)
+      h = HashString(def.TypeAsProto()->SerializeAsString(), h);
+  };
+
+  for (const NodeArg* def : subgraph.inputs)
+    hash_node_arg(*def);
+  for (const NodeArg* def : subgraph.outputs)
+    hash_node_arg(*def);
+
+  for (const Node* node : subgraph.nodes) {
+    h = HashString(node->Domain(), h);
+    h = HashString(node->OpType(), h);
+    node->ForEachDef([&hash_node_arg](const NodeArg& def, bool /*is_input*/) {
+      hash_node_arg(def);
+    });
+
+    // NodeAttributes is unordered, so hash attributes in sorted name order.
+    // For Scan this covers the body subgraph via its GraphProto attribute.
+    const auto& attrs = node->GetAttributes();
+    std::vector<std::string> attr_names;
+    attr_names.reserve(attrs.size());
+    for (const auto& attr : attrs)
+      attr_names.push_back(attr.first);
+    std::sort(attr_names.begin(), attr_names.end());
+    for (const auto& attr_name : attr_names) {
+      h = HashString(attr_name, h);
+      h = HashString(attrs.at(attr_name).SerializeAsString(), h);
+    }
+  }
+
+  // initializer values may be folded into the generated code as constants,
+  // so hash the actual bytes, not just names and shapes
+  for (const auto& item : subgraph.initializers) {
+    h = HashString(item.first, h);
+    const Tensor* tensor = item.second;
+    h = HashBytes(tensor->DataRaw(), tensor->SizeInBytes(), h);
+  }
+
+  return h;
+}
+
 std::string GetPackedFuncName(const nuphar::NupharSubgraphUnit& subgraph, const CodeGenTarget& codegen_target, int64_t parallel_min_workloads) {
+  // The name keys the cached artifact: the subgraph ordinal keeps names unique within a
+  // model, the content hash ties the artifact to the subgraph it was generated from, and
+  // the codegen target and parallel schedule setting cover the options that change the
+  // generated code.
   // in C, a function does not allow its name starting with a digit.
-  return NormalizeCppName("_" + subgraph.UniqueId() + "_" + codegen_target.GetTargetName() + "_p" + std::to_string(parallel_min_workloads));
+  std::ostringstream oss;
+  oss << "_" << subgraph.UniqueId()
+      << "_" << std::hex << HashSubgraphContent(subgraph)
+      << "_" << codegen_target.GetTargetName()
+      << "_p" << parallel_min_workloads;
+  return NormalizeCppName(oss.str());
 }
 
 bool TryCreateConstantScalar(
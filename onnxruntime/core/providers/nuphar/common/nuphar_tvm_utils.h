@@ -19,6 +19,11 @@ struct NupharSubgraphUnit;  //forward
 // Helper functions to create or load from offline cached dll
 // note after saving to obj file, we need to use tvm Python to create dll
 // using script at onnxruntime/core/codegen/mti/scripts/create_shared.py
+// Cached artifacts are keyed by subgraph content hash, codegen target and
+// parallel schedule setting (all part of the function/file name) plus cache
+// and TVM versions (part of the cache directory). A per-function shared
+// object named <func_name>.so in the cache directory is loaded directly;
+// otherwise the aggregate dll named by nuphar_cache_so_name is used.
 
 enum class CacheStatus {
   NotInUse,
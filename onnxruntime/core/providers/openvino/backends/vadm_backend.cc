@@ -115,24 +115,20 @@ VADMBackend::VADMBackend(const Provider_ModelProto& model_proto,
       ORT_THROW(log_tag + " Exception while Loading Network for graph " + subgraph_context_.subgraph_name);
     }
     LOGS_DEFAULT(INFO) << log_tag << "Loaded model to the plugin";
-    InferenceEngine::InferRequest::Ptr infRequest;
-    try {
-      infRequest = exe_network.CreateInferRequestPtr();
-    } catch (const InferenceEngine::details::InferenceEngineException& e) {
-      ORT_THROW(log_tag + "Exception while creating InferRequest object: " + e.what());
-    } catch (...) {
-      ORT_THROW(log_tag + "Exception while creating InferRequest object.");
-    }
-    infer_requests_.push_back(infRequest);
-    LOGS_DEFAULT(INFO) << log_tag << "Infer Requests created: 1" << std::endl;
+    // Create a pool of Infer Requests on the single device so that multiple in-flight
+    // Run calls pipeline through it instead of serializing on one request
+    size_t nireq = global_context_.num_of_threads;
+    LOGS_DEFAULT(INFO) << log_tag << "The value of nireq being used is: " << nireq;
+    inferRequestsQueue_ = std::unique_ptr<InferRequestsQueue>(new InferRequestsQueue(exe_network, nireq));
+    LOGS_DEFAULT(INFO) << log_tag << "Infer Requests created: " << nireq << std::endl;
   }
 }
 
 // Starts an asynchronous inference request for data in slice indexed by batch_slice_idx on
 // an Infer Request indexed by infer_req_idx
 void VADMBackend::StartAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext* context,
-                                      size_t batch_slice_idx, size_t infer_req_idx) {
-  auto infer_request = infer_requests_[infer_req_idx];
+                                      size_t batch_slice_idx,
+                                      InferenceEngine::InferRequest::Ptr infer_request) {
   auto graph_input_info = ie_cnn_network_->getInputsInfo();
 
   size_t index = 0;
@@ -165,10 +161,9 @@ void VADMBackend::StartAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext* c
 // Wait for asynchronous inference completion on an Infer Request object indexed by infer_req_idx
 // and copy the results into a slice location within the batched output buffer indexed by batch_slice_idx
 void VADMBackend::CompleteAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext* context,
-                                         size_t batch_slice_idx, size_t infer_req_idx,
+                                         size_t batch_slice_idx,
+                                         InferenceEngine::InferRequest::Ptr infer_request,
                                          size_t batch_size) {
-  auto infer_request = infer_requests_[infer_req_idx];
-
   // Wait for Async inference completion
   try {
     infer_request->Wait(InferenceEngine::IInferRequest::WaitMode::RESULT_READY);
@@ -226,24 +221,8 @@ size_t DeduceBatchSize(Ort::CustomOpApi ort, const OrtValue* input_tensor,
 }
 
 void VADMBackend::Infer(Ort::CustomOpApi& ort, OrtKernelContext* context) {
-  // Preliminary Thread safety mechanism
-  // Currently allows only one Infer execution at a time
   LOGS_DEFAULT(INFO) << log_tag << "Running graph " << subgraph_context_.subgraph_name;
   LOGS_DEFAULT(INFO) << log_tag << "In Infer";
-  std::lock_guard<std::mutex> lock(compute_lock_);
-
-  size_t batch_size = 1;
-
-  if (subgraph_context_.enable_batching) {
-    // Calculate the batch_size from the input tensor shape.
-    const OrtValue* tensor = ort.KernelContext_GetInput(context, subgraph_context_.input_indexes[0]);
-
-    batch_size = DeduceBatchSize(ort, tensor,
-                                 ie_cnn_network_->getInputsInfo().begin()->second->getTensorDesc().getDims());
-  }
-
-  size_t full_parallel_runs = batch_size / num_inf_reqs_;
-  size_t remainder_parallel_runs = batch_size % num_inf_reqs_;
 
   if (subgraph_context_.is_constant) {
 #if defined(OPENVINO_2020_4) || defined(OPENVINO_2021_1) || defined(OPENVINO_2021_2)
@@ -254,7 +233,24 @@ void VADMBackend::Infer(Ort::CustomOpApi& ort, OrtKernelContext* context) {
       FillOutputsWithConstantData(ort, node, output_tensor);
     }
 #endif
-  } else {
+  } else if (!infer_requests_.empty()) {
+    // Batched multi-VPU path. The batch slices are distributed across the Infer Requests
+    // by index, so only one Infer execution is allowed at a time.
+    std::lock_guard<std::mutex> lock(compute_lock_);
+
+    size_t batch_size = 1;
+
+    if (subgraph_context_.enable_batching) {
+      // Calculate the batch_size from the input tensor shape.
+      const OrtValue* tensor = ort.KernelContext_GetInput(context, subgraph_context_.input_indexes[0]);
+
+      batch_size = DeduceBatchSize(ort, tensor,
+                                   ie_cnn_network_->getInputsInfo().begin()->second->getTensorDesc().getDims());
+    }
+
+    size_t full_parallel_runs = batch_size / num_inf_reqs_;
+    size_t remainder_parallel_runs = batch_size % num_inf_reqs_;
+
     // Distribute the batched inputs among available Infer Requests
     // for parallel inference.
 
@@ -262,11 +258,11 @@ void VADMBackend::Infer(Ort::CustomOpApi& ort, OrtKernelContext* context) {
     for (size_t set = 0; set < full_parallel_runs; set++) {
       for (size_t inf_req_idx = 0; inf_req_idx < num_inf_reqs_; inf_req_idx++) {
         size_t batch_slice_idx = set * num_inf_reqs_ + inf_req_idx;
-        StartAsyncInference(ort, context, batch_slice_idx, inf_req_idx);
+        StartAsyncInference(ort, context, batch_slice_idx, infer_requests_[inf_req_idx]);
       }
       for (size_t inf_req_idx = 0; inf_req_idx < num_inf_reqs_; inf_req_idx++) {
         size_t batch_slice_idx = set * num_inf_reqs_ + inf_req_idx;
-        CompleteAsyncInference(ort, context, batch_slice_idx, inf_req_idx, batch_size);
+        CompleteAsyncInference(ort, context, batch_slice_idx, infer_requests_[inf_req_idx], batch_size);
 #ifndef NDEBUG
         if (openvino_ep::backend_utils::IsDebugEnabled()) {
           std::string& hw_target = (global_context_.device_id != "") ? global_context_.device_id : global_context_.device_type;
@@ -279,11 +275,11 @@ void VADMBackend::Infer(Ort::CustomOpApi& ort, OrtKernelContext* context) {
     // Run parallel inferences for remaining batch slices
     for (size_t inf_req_idx = 0; inf_req_idx < remainder_parallel_runs; inf_req_idx++) {
       size_t batch_slice_idx = full_parallel_runs * num_inf_reqs_ + inf_req_idx;
-      StartAsyncInference(ort, context, batch_slice_idx, inf_req_idx);
+      StartAsyncInference(ort, context, batch_slice_idx, infer_requests_[inf_req_idx]);
     }
     for (size_t inf_req_idx = 0; inf_req_idx < remainder_parallel_runs; inf_req_idx++) {
       size_t batch_slice_idx = full_parallel_runs * num_inf_reqs_ + inf_req_idx;
-      CompleteAsyncInference(ort, context, batch_slice_idx, inf_req_idx, batch_size);
+      CompleteAsyncInference(ort, context, batch_slice_idx, infer_requests_[inf_req_idx], batch_size);
 #ifndef NDEBUG
       if (openvino_ep::backend_utils::IsDebugEnabled()) {
         std::string& hw_target = (global_context_.device_id != "") ? global_context_.device_id : global_context_.device_type;
@@ -291,6 +287,27 @@ void VADMBackend::Infer(Ort::CustomOpApi& ort, OrtKernelContext* context) {
       }
 #endif
     }
+  } else {
+    // Single device path. Each Run pulls an idle Infer Request from the pool of
+    // infer_request's, so multiple in-flight Run calls pipeline through the device
+    // instead of serializing on a single request.
+    InferenceEngine::InferRequest::Ptr infer_request = inferRequestsQueue_->getIdleRequest();
+    if (!infer_request) {
+      LOGS_DEFAULT(INFO) << "No idle Infer Requests found from the infer_requests_ pool!";
+      THROW_IE_EXCEPTION << "No idle Infer Requests!";
+    }
+    size_t batch_slice_idx = 0;
+    StartAsyncInference(ort, context, batch_slice_idx, infer_request);
+    CompleteAsyncInference(ort, context, batch_slice_idx, infer_request, 1);
+    //Once the inference is completed, the infer_request becomes free and is placed back into pool of infer_requests_
+    inferRequestsQueue_->putIdleRequest(infer_request);
+#ifndef NDEBUG
+    if (openvino_ep::backend_utils::IsDebugEnabled()) {
+      inferRequestsQueue_->printstatus();  //Printing the elements of infer_requests_ vector pool only in debug mode
+      std::string& hw_target = (global_context_.device_id != "") ? global_context_.device_id : global_context_.device_type;
+      printPerformanceCounts(infer_request, std::cout, hw_target);
+    }
+#endif
   }
   LOGS_DEFAULT(INFO) << log_tag << "Inference successful";
 }
@@ -8,6 +8,7 @@
 #include "core/session/onnxruntime_cxx_api.h"
 #include "core/providers/openvino/contexts.h"
 #include "core/providers/openvino/ibackend.h"
+#include "core/providers/openvino/backends/basic_backend.h"
 
 namespace onnxruntime {
 namespace openvino_ep {
@@ -23,18 +24,23 @@ class VADMBackend : public IBackend {
  private:
   void StartAsyncInference(Ort::CustomOpApi& ort,
                            OrtKernelContext* context,
-                           size_t batch_slice_idx, size_t infer_req_idx);
+                           size_t batch_slice_idx,
+                           InferenceEngine::InferRequest::Ptr infer_request);
 
   void CompleteAsyncInference(Ort::CustomOpApi& ort, OrtKernelContext* context,
-                              size_t batch_slice_idx, size_t infer_req_idx,
+                              size_t batch_slice_idx,
+                              InferenceEngine::InferRequest::Ptr infer_request,
                               size_t batch_size);
 
   GlobalContext& global_context_;
   SubGraphContext subgraph_context_;
   std::shared_ptr<InferenceEngine::CNNNetwork> ie_cnn_network_;
   std::map<std::string, std::shared_ptr<ngraph::Node>> const_outputs_map_;
+  // Used by the batched path, which distributes batch slices across Infer Requests by index
   std::vector<InferenceEngine::InferRequest::Ptr> infer_requests_;
   size_t num_inf_reqs_;
+  // Used by the non-batched path, so concurrent Run calls pipeline through the device
+  std::unique_ptr<InferRequestsQueue> inferRequestsQueue_;
   mutable std::mutex compute_lock_;
 };
 }  // namespace openvino_ep
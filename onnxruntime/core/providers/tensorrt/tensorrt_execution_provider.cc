@@ -1,7 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
+#include <array>
 #include <fstream>
 #include <list>
+#include <sstream>
 #include <unordered_set>
 #include "core/providers/shared_library/provider_api.h"
 #define ORT_API_MANUAL_INIT
@@ -122,6 +124,45 @@ std::unordered_map<std::string, std::unordered_map<int, std::pair<int64_t, int64
   return shape_ranges;
 }
 
+/*
+* Parse explicit min/opt/max shape ranges supplied through ORT_TENSORRT_SHAPE_RANGES.
+* The value is a comma separated list of input_name:dim_index:min:opt:max entries, e.g.
+* "input_ids:0:1:8:64,input_ids:1:1:128:512". Seeding the optimization profile with the
+* expected ranges up front keeps shape changes inside the range from triggering an
+* engine rebuild.
+*/
+std::unordered_map<std::string, std::unordered_map<int, std::array<int64_t, 3>>> ParseExplicitShapeRanges(const std::string& ranges_str) {
+  std::unordered_map<std::string, std::unordered_map<int, std::array<int64_t, 3>>> ranges;
+  std::stringstream entries(ranges_str);
+  std::string entry;
+  while (std::getline(entries, entry, ',')) {
+    std::stringstream entry_stream(entry);
+    std::string field;
+    std::vector<std::string> fields;
+    while (std::getline(entry_stream, field, ':')) {
+      fields.push_back(field);
+    }
+    if (fields.size() != 5) {
+      LOGS_DEFAULT(WARNING) << "[TensorRT EP] Ignoring malformed shape range entry: " << entry;
+      continue;
+    }
+    try {
+      int dim_index = std::stoi(fields[1]);
+      int64_t min_shape = std::stoll(fields[2]);
+      int64_t opt_shape = std::stoll(fields[3]);
+      int64_t max_shape = std::stoll(fields[4]);
+      if (min_shape < 0 || min_shape > opt_shape || opt_shape > max_shape) {
+        LOGS_DEFAULT(WARNING) << "[TensorRT EP] Ignoring shape range entry that is not min <= opt <= max: " << entry;
+        continue;
+      }
+      ranges[fields[0]][dim_index] = {{min_shape, opt_shape, max_shape}};
+    } catch (const std::exception&) {
+      LOGS_DEFAULT(WARNING) << "[TensorRT EP] Ignoring malformed shape range entry: " << entry;
+    }
+  }
+  return ranges;
+}
+
 // Check if cycle exists in the graph after partitioning
 bool FindCycleHelper(int i, const std::list<int>* adjacency_map, bool visited[], bool* st, std::vector<int>& cycles) {
   if (!visited[i]) {
@@ -441,6 +482,11 @@ TensorrtExecutionProvider::TensorrtExecutionProvider(const TensorrtExecutionProv
     engine_cache_enable_ = (std::stoi(engine_cache_enable_env) == 0 ? false : true);
   }
 
+  const std::string shape_ranges_env = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kShapeRanges);
+  if (!shape_ranges_env.empty()) {
+    explicit_shape_ranges_ = ParseExplicitShapeRanges(shape_ranges_env);
+  }
+
   if (engine_cache_enable_ || int8_enable_) {
     const std::string engine_cache_path = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kEngineCachePath);
     cache_path_ = onnxruntime::GetEnvironmentVar(tensorrt_env_vars::kCachePath);
@@ -1054,33 +1100,52 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
       const std::string& input_name = input->getName();
       nvinfer1::Dims dims = input->getDimensions();
       int nb_dims = dims.nbDims;
+      // Seed ranges configured through ORT_TENSORRT_SHAPE_RANGES so shapes inside them
+      // never widen the profile and force an engine rebuild
+      const auto explicit_iter = explicit_shape_ranges_.find(input_name);
       if (input->isShapeTensor()) {
         // Shape tensor
         input_shape_ranges[input_name][0] = std::make_pair(INT_MAX, INT_MIN);
+        if (explicit_iter != explicit_shape_ranges_.end()) {
+          for (const auto& dim_range : explicit_iter->second) {
+            input_shape_ranges[input_name][dim_range.first] = std::make_pair(dim_range.second[0], dim_range.second[2]);
+          }
+        }
         has_dynamic_shape = true;
       } else {
         // Execution tensor
         for (int j = 0, end = nb_dims; j < end; ++j) {
           if (dims.d[j] == -1) {
-            input_shape_ranges[input_name][j] = std::make_pair(INT_MAX, INT_MIN);
+            std::pair<int64_t, int64_t> range = std::make_pair(INT_MAX, INT_MIN);
+            if (explicit_iter != explicit_shape_ranges_.end()) {
+              const auto dim_iter = explicit_iter->second.find(j);
+              if (dim_iter != explicit_iter->second.end()) {
+                range = std::make_pair(dim_iter->second[0], dim_iter->second[2]);
+              }
+            }
+            input_shape_ranges[input_name][j] = range;
             has_dynamic_shape = true;
           }
         }
       }
     }
 
-    // Check platform availability for low precision
-    if (fp16_enable_) {
-      if (!trt_builder->platformHasFastFp16()) {
-        fp16_enable_ = false;
-        LOGS_DEFAULT(WARNING) << "[TensorRT EP] ORT_TENSORRT_FP16_ENABLE is set, but platform doesn't support fast native fp16";
+    // Check platform availability for low precision. Guarded since Compile may run concurrently
+    // for different fused nodes and these flags are shared.
+    {
+      std::lock_guard<OrtMutex> lock(tensorrt_mu_);
+      if (fp16_enable_) {
+        if (!trt_builder->platformHasFastFp16()) {
+          fp16_enable_ = false;
+          LOGS_DEFAULT(WARNING) << "[TensorRT EP] ORT_TENSORRT_FP16_ENABLE is set, but platform doesn't support fast native fp16";
+        }
       }
-    }
 
-    if (int8_enable_) {
-      if (!trt_builder->platformHasFastInt8()) {
-        int8_enable_ = false;
-        LOGS_DEFAULT(WARNING) << "[TensorRT EP] ORT_TENSORRT_INT8_ENABLE is set, but platform doesn't support fast native int8";
+      if (int8_enable_) {
+        if (!trt_builder->platformHasFastInt8()) {
+          int8_enable_ = false;
+          LOGS_DEFAULT(WARNING) << "[TensorRT EP] ORT_TENSORRT_INT8_ENABLE is set, but platform doesn't support fast native int8";
+        }
       }
     }
 
@@ -1203,16 +1268,21 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
       output_types[output_name] = tensor_type.elem_type();
     }
 
-    // Save engine, context and input/output info to map
-    parsers_.emplace(fused_node->Name(), std::move(trt_parser));
-    engines_.emplace(fused_node->Name(), std::move(trt_engine));
-    contexts_.emplace(fused_node->Name(), std::move(trt_context));
-    builders_.emplace(fused_node->Name(), std::move(trt_builder));
-    networks_.emplace(fused_node->Name(), std::move(trt_network));
-    input_info_[fused_node->Name()].push_back(input_indexes);
-    output_info_[fused_node->Name()].push_back(output_indexes);
-    output_info_[fused_node->Name()].push_back(output_types);
-    input_shape_ranges_[fused_node->Name()] = input_shape_ranges;
+    // Save engine, context and input/output info to map. The maps are shared across fused nodes
+    // and Compile may run concurrently for different nodes, so publishing is serialized; the
+    // engine build above stays outside the lock.
+    {
+      std::lock_guard<OrtMutex> lock(tensorrt_mu_);
+      parsers_.emplace(fused_node->Name(), std::move(trt_parser));
+      engines_.emplace(fused_node->Name(), std::move(trt_engine));
+      contexts_.emplace(fused_node->Name(), std::move(trt_context));
+      builders_.emplace(fused_node->Name(), std::move(trt_builder));
+      networks_.emplace(fused_node->Name(), std::move(trt_network));
+      input_info_[fused_node->Name()].push_back(input_indexes);
+      output_info_[fused_node->Name()].push_back(output_indexes);
+      output_info_[fused_node->Name()].push_back(output_types);
+      input_shape_ranges_[fused_node->Name()] = input_shape_ranges;
+    }
 
     // Create function state
     // TODO: remove default capture
@@ -1224,7 +1294,7 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
             &networks_[context->node_name], input_info_[context->node_name], output_info_[context->node_name],
             input_shape_ranges_[context->node_name], &tensorrt_mu_, &fp16_enable_, &int8_enable_, &max_workspace_size_,
             trt_node_name_with_precision, engine_cache_enable_, cache_path_, runtime_,
-            allocator_, dynamic_range_map, engine_decryption_enable_, engine_decryption_};
+            allocator_, dynamic_range_map, engine_decryption_enable_, engine_decryption_, &explicit_shape_ranges_};
       *state = p.release();
       return 0;
     };
@@ -1343,6 +1413,15 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
           const auto& tensor_shapes = ort.GetTensorShape(tensor_info);
           auto& shape_range = shape_ranges[input_name];
 
+          // Explicit ranges configured through ORT_TENSORRT_SHAPE_RANGES, used for the opt shape
+          const std::unordered_map<int, std::array<int64_t, 3>>* explicit_range = nullptr;
+          if (trt_state->explicit_shape_ranges != nullptr) {
+            const auto explicit_iter = trt_state->explicit_shape_ranges->find(input_name);
+            if (explicit_iter != trt_state->explicit_shape_ranges->end()) {
+              explicit_range = &explicit_iter->second;
+            }
+          }
+
           // Create shape profile
           if (input->isShapeTensor()) {
             // Get shape values for shape tensor input
@@ -1400,6 +1479,15 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
                   shapes_opt[j] = tensor_shape_value;
                   dimension_update[input_name] = true;
                 }
+
+                // Prefer the configured optimal value while it stays inside the range
+                if (explicit_range != nullptr) {
+                  const auto dim_iter = explicit_range->find(j);
+                  if (dim_iter != explicit_range->end() &&
+                      dim_iter->second[1] >= shape_range[j].first && dim_iter->second[1] <= shape_range[j].second) {
+                    shapes_opt[j] = static_cast<int32_t>(dim_iter->second[1]);
+                  }
+                }
               }
             } else {
               // If shape size doesn't match, initialize shape_range with the new shape value
@@ -1442,6 +1530,15 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
                   dims_opt.d[j] = tensor_shape;
                   dimension_update[input_name] = true;
                 }
+
+                // Prefer the configured optimal value while it stays inside the range
+                if (explicit_range != nullptr) {
+                  const auto dim_iter = explicit_range->find(j);
+                  if (dim_iter != explicit_range->end() &&
+                      dim_iter->second[1] >= shape_range[j].first && dim_iter->second[1] <= shape_range[j].second) {
+                    dims_opt.d[j] = dim_iter->second[1];
+                  }
+                }
               }
             }
 
@@ -1460,6 +1557,12 @@ common::Status TensorrtExecutionProvider::Compile(const std::vector<Node*>& fuse
         }
       }
 
+      // With pre-seeded explicit ranges the first call may leave every dimension inside the
+      // profile, so also build when no engine has been created or deserialized yet
+      if (trt_engine == nullptr && !shape_ranges.empty()) {
+        engine_update = true;
+      }
+
       // Regenerate engine
       // Only one profile is generated, so no need to explicitly set optimization profile
       if (engine_update) {
@@ -2,6 +2,7 @@
 // Licensed under the MIT License.
 
 #pragma once
+#include <array>
 #include <ctime>
 #include "NvInfer.h"
 #include "NvOnnxParser.h"
@@ -24,6 +25,8 @@ static const std::string kCachePath = "ORT_TENSORRT_CACHE_PATH";
 static const std::string kEngineCachePath = "ORT_TENSORRT_ENGINE_CACHE_PATH";
 static const std::string kDecryptionEnable = "ORT_TENSORRT_ENGINE_DECRYPTION_ENABLE";
 static const std::string kDecryptionLibPath = "ORT_TENSORRT_ENGINE_DECRYPTION_LIB_PATH";
+// Explicit min/opt/max shape ranges, as comma separated input_name:dim_index:min:opt:max entries
+static const std::string kShapeRanges = "ORT_TENSORRT_SHAPE_RANGES";
 }  // namespace tensorrt_env_vars
 
 class TensorrtLogger : public nvinfer1::ILogger {
@@ -98,6 +101,8 @@ struct TensorrtFuncState {
   std::unordered_map<std::string, float> dynamic_range_map;
   bool engine_decryption_enable;
   int (*engine_decryption)(const char*, char*, size_t*);
+  // explicit min/opt/max ranges configured through ORT_TENSORRT_SHAPE_RANGES
+  std::unordered_map<std::string, std::unordered_map<int, std::array<int64_t, 3>>>* explicit_shape_ranges = nullptr;
 };
 
 // Logical device representation.
@@ -118,6 +123,10 @@ class TensorrtExecutionProvider : public IExecutionProvider {
   common::Status Compile(const std::vector<Node*>& fused_nodes,
                          std::vector<NodeComputeInfo>& node_compute_funcs) override;
 
+  // engine building dominates Compile and each fused node builds an independent engine, so
+  // subgraphs can be compiled concurrently. the shared per-node maps are guarded by tensorrt_mu_.
+  bool ConcurrentCompileSupported() const override { return true; }
+
   AllocatorPtr GetAllocator(int id, OrtMemType mem_type) const override;
 
   void RegisterAllocator(std::shared_ptr<AllocatorManager> allocator_manager) override;
@@ -157,6 +166,7 @@ class TensorrtExecutionProvider : public IExecutionProvider {
   std::unordered_map<std::string, std::vector<std::unordered_map<std::string, int>>> input_info_;
   std::unordered_map<std::string, std::vector<std::unordered_map<std::string, int>>> output_info_;
   std::unordered_map<std::string, std::unordered_map<std::string, std::unordered_map<int, std::pair<int64_t, int64_t>>>> input_shape_ranges_;
+  std::unordered_map<std::string, std::unordered_map<int, std::array<int64_t, 3>>> explicit_shape_ranges_;
 
   /**Get IndexedSubGraph based on node list of the subgraph*/
   std::unique_ptr<IndexedSubGraph> GetSubGraph(SubGraph_t graph_nodes_index,
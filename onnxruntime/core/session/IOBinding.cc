@@ -42,6 +42,20 @@ common::Status IOBinding::BindInput(const std::string& name, const OrtValue& ml_
   return Status::OK();
 }
 
+common::Status IOBinding::SetInputShape(const std::string& name, const TensorShape& shape) {
+  auto rc = Contains(feed_names_, name);
+  if (!rc.first) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "No input was bound with the name: ", name);
+  }
+
+  OrtValue& ml_value = feeds_[rc.second];
+  if (!ml_value.IsTensor()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Only tensor inputs support shape updates: ", name);
+  }
+
+  return ml_value.GetMutable<Tensor>()->SetShapeWithinCapacity(shape);
+}
+
 void IOBinding::ClearInputs() {
   feed_names_.clear();
   feeds_.clear();
@@ -49,6 +49,14 @@ class IOBinding {
    */
   common::Status BindInput(const std::string& name, const OrtValue& ml_value);
 
+  /**
+   * Update the effective shape of an already bound input without re-binding or re-allocating.
+   * The input must have been bound with a buffer whose capacity covers the new shape, so a
+   * tensor sized for the maximum expected shape can be bound once and shrunk per run.
+   * Only supported for tensor inputs.
+   */
+  common::Status SetInputShape(const std::string& name, const TensorShape& shape);
+
   /**
     * If the BindInput calls are async this function acts as a barrier to ensure all inputs are fully copied
     * before you call the Run() method. There is no point calling Run() if you're inputs are not ready at the 
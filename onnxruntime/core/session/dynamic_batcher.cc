@@ -0,0 +1,267 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/session/dynamic_batcher.h"
+
+#include <algorithm>
+#include <cstring>
+
+#include "core/framework/allocator.h"
+#include "core/framework/data_types.h"
+#include "core/framework/tensor.h"
+#include "core/session/inference_session.h"
+
+namespace onnxruntime {
+
+namespace {
+
+// staging allocator for the concatenated feeds and the per-request output slices
+AllocatorPtr StagingAllocator() {
+  static AllocatorPtr allocator = std::make_shared<CPUAllocator>();
+  return allocator;
+}
+
+OrtValue MakeTensorValue(std::unique_ptr<Tensor> tensor) {
+  OrtValue value;
+  value.Init(tensor.release(), DataTypeImpl::GetType<Tensor>(),
+             DataTypeImpl::GetType<Tensor>()->GetDeleteFunc());
+  return value;
+}
+
+}  // namespace
+
+DynamicBatcher::DynamicBatcher(InferenceSession& session, const Config& config)
+    : session_(session), config_(config) {
+  batch_thread_ = std::thread{[this]() { BatchLoop(); }};
+}
+
+DynamicBatcher::~DynamicBatcher() {
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    shutdown_ = true;
+  }
+  pending_cv_.notify_all();
+  batch_thread_.join();
+}
+
+common::Status DynamicBatcher::Enqueue(const RunOptions& run_options,
+                                       std::vector<std::string> feed_names,
+                                       std::vector<OrtValue> feeds,
+                                       std::vector<std::string> output_names,
+                                       Callback callback) {
+  if (!callback) {
+    return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "Enqueue requires a callback.");
+  }
+
+  if (feeds.empty() || feed_names.size() != feeds.size()) {
+    return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                          "Feed names and feeds must be non-empty and of equal size.");
+  }
+
+  int64_t batch_rows = -1;
+  for (size_t i = 0; i < feeds.size(); ++i) {
+    if (!feeds[i].IsTensor()) {
+      return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                            "Feed '" + feed_names[i] + "' is not a tensor. Only tensor feeds can be batched.");
+    }
+
+    const Tensor& tensor = feeds[i].Get<Tensor>();
+    if (tensor.IsDataTypeString() || tensor.Location().device.Type() != OrtDevice::CPU ||
+        tensor.Shape().NumDimensions() == 0) {
+      return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                            "Feed '" + feed_names[i] +
+                                "' cannot be batched. Feeds must be non-string CPU tensors with a batch dimension.");
+    }
+
+    const int64_t rows = tensor.Shape()[0];
+    if (batch_rows == -1) {
+      batch_rows = rows;
+    } else if (batch_rows != rows) {
+      return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT,
+                            "All feeds of a request must agree on their axis-0 size.");
+    }
+  }
+
+  PendingRequest request;
+  request.run_options = run_options;
+  request.feed_names = std::move(feed_names);
+  request.feeds = std::move(feeds);
+  request.output_names = std::move(output_names);
+  request.callback = std::move(callback);
+  request.batch_rows = batch_rows;
+
+  {
+    std::lock_guard<OrtMutex> lock(mutex_);
+    if (shutdown_) {
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "DynamicBatcher is shutting down.");
+    }
+    pending_.push_back(std::move(request));
+  }
+  pending_cv_.notify_all();
+
+  return common::Status::OK();
+}
+
+bool DynamicBatcher::Compatible(const PendingRequest& a, const PendingRequest& b) {
+  if (a.feed_names != b.feed_names || a.output_names != b.output_names) {
+    return false;
+  }
+
+  for (size_t i = 0; i < a.feeds.size(); ++i) {
+    const Tensor& ta = a.feeds[i].Get<Tensor>();
+    const Tensor& tb = b.feeds[i].Get<Tensor>();
+    if (ta.DataType() != tb.DataType()) {
+      return false;
+    }
+
+    const auto& dims_a = ta.Shape().GetDims();
+    const auto& dims_b = tb.Shape().GetDims();
+    if (dims_a.size() != dims_b.size() ||
+        !std::equal(dims_a.begin() + 1, dims_a.end(), dims_b.begin() + 1)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+void DynamicBatcher::BatchLoop() {
+  std::unique_lock<OrtMutex> lock(mutex_);
+
+  while (true) {
+    pending_cv_.wait(lock, [this]() { return shutdown_ || !pending_.empty(); });
+
+    if (pending_.empty()) {
+      if (shutdown_) {
+        return;
+      }
+      continue;
+    }
+
+    // hold the head of the queue open for the batch window (skipped when draining on shutdown)
+    const auto deadline = std::chrono::steady_clock::now() + config_.batch_window;
+    while (!shutdown_) {
+      int64_t rows = 0;
+      for (const auto& request : pending_) {
+        if (Compatible(pending_.front(), request)) {
+          rows += request.batch_rows;
+        }
+      }
+      if (rows >= config_.max_batch_size) {
+        break;
+      }
+
+      const auto now = std::chrono::steady_clock::now();
+      if (now >= deadline) {
+        break;
+      }
+      pending_cv_.wait_for(lock, std::chrono::duration_cast<std::chrono::microseconds>(deadline - now));
+    }
+
+    // gather everything compatible with the head, leaving other requests for the next round
+    std::vector<PendingRequest> batch;
+    batch.push_back(std::move(pending_.front()));
+    pending_.pop_front();
+    int64_t rows = batch.front().batch_rows;
+
+    for (auto it = pending_.begin(); it != pending_.end() && rows < config_.max_batch_size;) {
+      if (Compatible(batch.front(), *it) && rows + it->batch_rows <= config_.max_batch_size) {
+        rows += it->batch_rows;
+        batch.push_back(std::move(*it));
+        it = pending_.erase(it);
+      } else {
+        ++it;
+      }
+    }
+
+    lock.unlock();
+    RunBatch(batch);
+    lock.lock();
+  }
+}
+
+void DynamicBatcher::RunBatch(std::vector<PendingRequest>& batch) {
+  auto& head = batch.front();
+
+  if (batch.size() == 1) {
+    std::vector<OrtValue> fetches;
+    auto status = session_.Run(head.run_options, head.feed_names, head.feeds, head.output_names,
+                               &fetches, nullptr);
+    head.callback(std::move(status), std::move(fetches));
+    return;
+  }
+
+  int64_t total_rows = 0;
+  for (const auto& request : batch) {
+    total_rows += request.batch_rows;
+  }
+
+  // concatenate each feed along axis 0. rows are contiguous since axis 0 is outermost.
+  std::vector<OrtValue> batched_feeds;
+  batched_feeds.reserve(head.feeds.size());
+
+  for (size_t i = 0; i < head.feeds.size(); ++i) {
+    const Tensor& first = head.feeds[i].Get<Tensor>();
+    std::vector<int64_t> dims = first.Shape().GetDims();
+    dims[0] = total_rows;
+
+    auto batched = onnxruntime::make_unique<Tensor>(first.DataType(), TensorShape(dims), StagingAllocator());
+    char* dst = static_cast<char*>(batched->MutableDataRaw());
+    for (const auto& request : batch) {
+      const Tensor& tensor = request.feeds[i].Get<Tensor>();
+      memcpy(dst, tensor.DataRaw(), tensor.SizeInBytes());
+      dst += tensor.SizeInBytes();
+    }
+
+    batched_feeds.push_back(MakeTensorValue(std::move(batched)));
+  }
+
+  std::vector<OrtValue> fetches;
+  auto status = session_.Run(head.run_options, head.feed_names, batched_feeds, head.output_names,
+                             &fetches, nullptr);
+
+  if (!status.IsOK()) {
+    for (auto& request : batch) {
+      request.callback(status, {});
+    }
+    return;
+  }
+
+  // split the outputs back per request. outputs that do not carry the batch dimension
+  // (e.g. scalars or reductions) are handed to every request as-is.
+  int64_t row_offset = 0;
+  for (auto& request : batch) {
+    std::vector<OrtValue> request_fetches;
+    request_fetches.reserve(fetches.size());
+
+    for (auto& fetched : fetches) {
+      if (!fetched.IsTensor()) {
+        request_fetches.push_back(fetched);
+        continue;
+      }
+
+      const Tensor& tensor = fetched.Get<Tensor>();
+      if (tensor.Shape().NumDimensions() == 0 || tensor.Shape()[0] != total_rows ||
+          tensor.IsDataTypeString()) {
+        request_fetches.push_back(fetched);
+        continue;
+      }
+
+      std::vector<int64_t> dims = tensor.Shape().GetDims();
+      dims[0] = request.batch_rows;
+
+      auto slice = onnxruntime::make_unique<Tensor>(tensor.DataType(), TensorShape(dims), StagingAllocator());
+      const size_t bytes_per_row = tensor.SizeInBytes() / total_rows;
+      memcpy(slice->MutableDataRaw(),
+             static_cast<const char*>(tensor.DataRaw()) + row_offset * bytes_per_row,
+             slice->SizeInBytes());
+
+      request_fetches.push_back(MakeTensorValue(std::move(slice)));
+    }
+
+    request.callback(common::Status::OK(), std::move(request_fetches));
+    row_offset += request.batch_rows;
+  }
+}
+
+}  // namespace onnxruntime
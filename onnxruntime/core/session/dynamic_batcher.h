@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <deque>
+#include <functional>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "core/common/common.h"
+#include "core/common/status.h"
+#include "core/framework/ml_value.h"
+#include "core/framework/run_options.h"
+#include "core/platform/ort_mutex.h"
+
+namespace onnxruntime {
+
+class InferenceSession;
+
+/**
+ * Coalesces concurrent Run requests against a shared InferenceSession into larger batches.
+ *
+ * Requests enqueued within the configured batch window whose feed names, output names, element
+ * types and trailing dimensions match are concatenated along axis 0, executed as a single Run,
+ * and the outputs are split back per request before each callback is invoked. Models served this
+ * way see a small set of batched input shapes instead of one shape per client, which both
+ * amortizes per-Run overhead and keeps the shape-bucketed memory pattern cache hot.
+ *
+ * Feeds must be CPU tensors of non-string type with at least one dimension; axis 0 is treated as
+ * the batch dimension. Requests that cannot be batched with the current head of the queue are
+ * simply run in a later batch (or alone), so enqueueing incompatible shapes is safe.
+ */
+class DynamicBatcher {
+ public:
+  struct Config {
+    // maximum total rows (sum of the requests' axis-0 sizes) coalesced into one Run
+    int64_t max_batch_size{32};
+    // how long to hold the first request of a batch while waiting for compatible ones
+    std::chrono::microseconds batch_window{1000};
+  };
+
+  /**
+   * The session must be initialized and must outlive the batcher. The model's batched inputs
+   * need a dynamic axis-0 dimension, otherwise coalesced shapes will fail shape inference.
+   */
+  DynamicBatcher(InferenceSession& session, const Config& config = Config());
+
+  // drains: blocks until all enqueued requests have completed
+  ~DynamicBatcher();
+
+  using Callback = std::function<void(common::Status status, std::vector<OrtValue> fetches)>;
+
+  /**
+   * Enqueue a request to be coalesced with compatible requests along axis 0. The callback is
+   * invoked from the batching thread with this request's slice of the batched outputs, or with
+   * the failure status of the batched Run. All feeds of one request must agree on their axis-0
+   * size. Returns a failure status (and never invokes the callback) if the request is malformed.
+   */
+  common::Status Enqueue(const RunOptions& run_options, std::vector<std::string> feed_names,
+                         std::vector<OrtValue> feeds, std::vector<std::string> output_names,
+                         Callback callback);
+
+ private:
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(DynamicBatcher);
+
+  struct PendingRequest {
+    RunOptions run_options;
+    std::vector<std::string> feed_names;
+    std::vector<OrtValue> feeds;
+    std::vector<std::string> output_names;
+    Callback callback;
+    int64_t batch_rows;  // axis-0 size shared by all feeds of this request
+  };
+
+  static bool Compatible(const PendingRequest& a, const PendingRequest& b);
+
+  void BatchLoop();
+  void RunBatch(std::vector<PendingRequest>& batch);
+
+  InferenceSession& session_;
+  const Config config_;
+
+  OrtMutex mutex_;
+  OrtCondVar pending_cv_;
+  std::deque<PendingRequest> pending_;  // protected by mutex_
+  bool shutdown_{false};                // protected by mutex_
+
+  std::thread batch_thread_;
+};
+
+}  // namespace onnxruntime
@@ -3,8 +3,10 @@
 
 #include "core/session/environment.h"
 #include "core/framework/allocatormgr.h"
+#include "core/framework/shared_weight_cache.h"
 #include "core/graph/constants.h"
 #include "core/graph/op.h"
+#include "core/graph/schema_registry.h"
 #if !defined(ORT_MINIMAL_BUILD)
 #include "onnx/defs/operator_sets.h"
 #include "onnx/defs/operator_sets_ml.h"
@@ -133,6 +135,7 @@ Status Environment::Initialize(std::unique_ptr<logging::LoggingManager> logging_
   auto status = Status::OK();
 
   logging_manager_ = std::move(logging_manager);
+  shared_weight_cache_ = onnxruntime::make_unique<SharedWeightCache>();
 
   // create thread pools
   if (create_global_thread_pools) {
@@ -151,8 +154,12 @@ Status Environment::Initialize(std::unique_ptr<logging::LoggingManager> logging_
 
   ORT_TRY {
 #if !defined(ORT_MINIMAL_BUILD)
-    // Register Microsoft domain with min/max op_set version as 1/1.
+    // Materializing every schema costs a noticeable amount of time and memory, and sessions
+    // that only load ORT format models never consult them, so the registration is deferred
+    // until the first schema lookup. ONNX model loading triggers it transparently.
     std::call_once(schemaRegistrationOnceFlag, []() {
+      SchemaRegistryManager::SetDeferredRegistrationFn([]() {
+      // Register Microsoft domain with min/max op_set version as 1/1.
       ONNX_NAMESPACE::OpSchemaRegistry::DomainToVersionRange::Instance().AddDomainToVersion(onnxruntime::kMSDomain, 1, 1);
       ONNX_NAMESPACE::OpSchemaRegistry::DomainToVersionRange::Instance().AddDomainToVersion(onnxruntime::kMSExperimentalDomain, 1, 1);
       ONNX_NAMESPACE::OpSchemaRegistry::DomainToVersionRange::Instance().AddDomainToVersion(onnxruntime::kMSNchwcDomain, 1, 1);
@@ -188,6 +195,13 @@ Status Environment::Initialize(std::unique_ptr<logging::LoggingManager> logging_
       training::LossFunctionRegistry::GetInstance().RegisterNonOperatorLossFunctions();
       training::OptimizerBuilderRegistry::GetInstance().RegisterBuilders();
       training::OptimizerGraphBuilderRegistry::GetInstance().RegisterGraphBuilders();
+#endif
+      });
+
+#ifdef ENABLE_TRAINING
+      // training session setup reads the schema and gradient registries directly,
+      // so keep registration eager in training builds
+      SchemaRegistryManager::EnsureDeferredRegistration();
 #endif
     });
 
@@ -234,4 +248,7 @@ Internal copy node
   return status;
 }
 
+// out of line because of the unique_ptr to the forward declared SharedWeightCache
+Environment::~Environment() = default;
+
 }  // namespace onnxruntime
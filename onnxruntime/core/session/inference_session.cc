@@ -4,6 +4,9 @@
 #include "core/graph/onnx_protobuf.h"
 #include "core/session/inference_session.h"
 
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
 #include <memory>
 #include <sstream>
 #include <unordered_set>
@@ -13,19 +16,25 @@
 
 #include "core/common/denormal.h"
 #include "core/common/logging/logging.h"
+#include "core/common/parse_string.h"
 #include "core/framework/allocatormgr.h"
+#include "core/framework/arena.h"
 #include "core/framework/error_code_helper.h"
 #include "core/framework/execution_frame.h"
 #include "core/framework/feeds_fetches_manager.h"
 #include "core/framework/graph_partitioner.h"
 #include "core/framework/kernel_def_builder.h"
 #include "core/framework/kernel_registry.h"
+#include "core/framework/mem_buffer.h"
 #include "core/framework/mldata_type_utils.h"
 #include "core/framework/TensorSeq.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/tensor_type_and_shape.h"
+#include "core/platform/path_lib.h"
 #include "core/framework/op_kernel_context_internal.h"
 #include "core/framework/ort_value_pattern_planner.h"
+#include "core/framework/shared_weight_cache.h"
+#include "core/framework/startup_memory_profiler.h"
 #include "core/framework/utils.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
@@ -229,6 +238,46 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
 
   use_per_session_threads_ = session_options.use_per_session_threads;
 
+  int numa_node = -1;
+  {
+    const std::string numa_node_str = session_options_.GetConfigOrDefault(kOrtSessionOptionsSessionNumaNode, "-1");
+    if (!TryParseStringWithClassicLocale(numa_node_str, numa_node)) {
+      LOGS(*session_logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsSessionNumaNode
+                                      << ": '" << numa_node_str << "'. No NUMA node binding will be applied.";
+      numa_node = -1;
+    }
+  }
+
+  int spin_loop_iterations = -1;
+  {
+    const std::string spin_str =
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsThreadSpinLoopIterations, "-1");
+    if (!TryParseStringWithClassicLocale(spin_str, spin_loop_iterations)) {
+      LOGS(*session_logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsThreadSpinLoopIterations
+                                      << ": '" << spin_str << "'. The default spin bound will be used.";
+      spin_loop_iterations = -1;
+    }
+  }
+
+  // explicit per-thread processor binding for the intra-op pool, e.g. "0;2;4;6"
+  std::vector<size_t> intra_op_affinities;
+  {
+    const std::string affinity_str =
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsIntraOpThreadAffinities, "");
+    std::istringstream parser(affinity_str);
+    std::string token;
+    while (std::getline(parser, token, ';')) {
+      int cpu = -1;
+      if (!TryParseStringWithClassicLocale(token, cpu) || cpu < 0) {
+        LOGS(*session_logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsIntraOpThreadAffinities
+                                        << ": '" << affinity_str << "'. No explicit binding will be applied.";
+        intra_op_affinities.clear();
+        break;
+      }
+      intra_op_affinities.push_back(static_cast<size_t>(cpu));
+    }
+  }
+
   if (use_per_session_threads_) {
     LOGS(*session_logger_, INFO) << "Creating and using per session threadpools since use_per_session_threads_ is true";
     {
@@ -237,6 +286,21 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
         to.name = ORT_TSTR("intra-op");
       }
       to.set_denormal_as_zero = set_denormal_as_zero;
+      to.enable_loop_cost_calibration =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsLoopCostCalibration, "0") == "1";
+      to.spin_loop_iterations = spin_loop_iterations;
+      to.prefer_performance_cores =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsPreferPerformanceCores, "0") == "1";
+      to.prefer_efficiency_cores =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsPreferEfficiencyCores, "0") == "1";
+      if (numa_node >= 0) {
+        to.numa_node = numa_node;
+      }
+      if (!intra_op_affinities.empty() && to.affinity_vec_len == 0) {
+        to.affinity_vec = intra_op_affinities.data();
+        to.affinity_vec_len = intra_op_affinities.size();
+        to.thread_pool_size = static_cast<int>(intra_op_affinities.size());
+      }
       // If the thread pool can use all the processors, then
       // we set affinity of each thread to each processor.
       to.auto_set_affinity = to.thread_pool_size == 0 &&
@@ -247,6 +311,10 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
     }
     if (session_options_.execution_mode == ExecutionMode::ORT_PARALLEL) {
       OrtThreadPoolParams to = session_options_.inter_op_param;
+      to.spin_loop_iterations = spin_loop_iterations;
+      if (numa_node >= 0) {
+        to.numa_node = numa_node;
+      }
       // If the thread pool can use all the processors, then
       // we set thread affinity.
       to.auto_set_affinity =
@@ -271,6 +339,8 @@ void InferenceSession::ConstructorCommon(const SessionOptions& session_options,
   }
 
   session_profiler_.Initialize(session_logger_);
+  session_profiler_.SetStreamingMode(
+      session_options_.GetConfigOrDefault(kOrtSessionOptionsProfilerStreamingMode, "0") == "1");
   if (session_options_.enable_profiling) {
     StartProfiling(session_options_.profile_file_prefix);
   }
@@ -381,6 +451,7 @@ InferenceSession::~InferenceSession() {
 #endif
 #if !defined(ORT_MINIMAL_BUILD) && defined(ORT_MEMORY_PROFILE)
   MemoryInfo::GenerateMemoryProfile();
+  MemoryInfo::GenerateNodeMemoryTimeline();
 #endif
 }
 
@@ -543,6 +614,98 @@ common::Status InferenceSession::SaveToOrtFormat(const std::basic_string<ORTCHAR
   return Status::OK();
 }
 
+namespace {
+
+// Helpers for hashing a graph's structure while ignoring initializer payloads, so two models
+// with identical architecture but different weights hash equally. FNV-1a style folding; the hash
+// is only ever compared within the lifetime of one process.
+void HashCombine(uint64_t value, uint64_t& hash) {
+  hash = (hash ^ value) * 1099511628211ULL;
+}
+
+void HashString(const std::string& str, uint64_t& hash) {
+  for (unsigned char c : str) {
+    HashCombine(c, hash);
+  }
+  HashCombine(str.size(), hash);
+}
+
+void HashGraphStructure(const Graph& graph, uint64_t& hash) {
+  for (const auto* def : graph.GetInputsIncludingInitializers()) {
+    HashString(def->Name(), hash);
+  }
+  for (const auto* def : graph.GetOutputs()) {
+    HashString(def->Name(), hash);
+  }
+
+  // the initializer map is unordered, so hash names/types/shapes in sorted order
+  std::vector<const ONNX_NAMESPACE::TensorProto*> initializers;
+  initializers.reserve(graph.GetAllInitializedTensors().size());
+  for (const auto& entry : graph.GetAllInitializedTensors()) {
+    initializers.push_back(entry.second);
+  }
+  std::sort(initializers.begin(), initializers.end(),
+            [](const ONNX_NAMESPACE::TensorProto* a, const ONNX_NAMESPACE::TensorProto* b) {
+              return a->name() < b->name();
+            });
+  for (const auto* initializer : initializers) {
+    HashString(initializer->name(), hash);
+    HashCombine(static_cast<uint64_t>(initializer->data_type()), hash);
+    for (int64_t dim : initializer->dims()) {
+      HashCombine(static_cast<uint64_t>(dim), hash);
+    }
+  }
+
+  for (const auto& node : graph.Nodes()) {
+    HashString(node.OpType(), hash);
+    HashString(node.Domain(), hash);
+    for (const auto* def : node.InputDefs()) {
+      HashString(def->Exists() ? def->Name() : std::string(), hash);
+    }
+    for (const auto* def : node.OutputDefs()) {
+      HashString(def->Exists() ? def->Name() : std::string(), hash);
+    }
+
+    // attributes in sorted order. subgraph attributes are hashed structurally so their
+    // initializer payloads are ignored too; other attributes by value, since a weight-only
+    // retrain must not change them.
+    std::vector<std::string> attribute_names;
+    attribute_names.reserve(node.GetAttributes().size());
+    for (const auto& attribute : node.GetAttributes()) {
+      attribute_names.push_back(attribute.first);
+    }
+    std::sort(attribute_names.begin(), attribute_names.end());
+    for (const auto& attribute_name : attribute_names) {
+      HashString(attribute_name, hash);
+      const Graph* subgraph = node.GetGraphAttribute(attribute_name);
+      if (subgraph != nullptr) {
+        HashGraphStructure(*subgraph, hash);
+      } else {
+        HashString(node.GetAttributes().at(attribute_name).SerializeAsString(), hash);
+      }
+    }
+  }
+}
+
+uint64_t ComputeModelStructureHash(const onnxruntime::Model& model) {
+  uint64_t hash = 14695981039346656037ULL;  // FNV offset basis
+  HashGraphStructure(model.MainGraph(), hash);
+  return hash;
+}
+
+bool SubgraphsHaveInitializers(const Graph& graph) {
+  for (const auto& node : graph.Nodes()) {
+    for (const auto& subgraph : node.GetSubgraphs()) {
+      if (!subgraph->GetAllInitializedTensors().empty() || SubgraphsHaveInitializers(*subgraph)) {
+        return true;
+      }
+    }
+  }
+  return false;
+}
+
+}  // namespace
+
 common::Status InferenceSession::Load(std::function<common::Status(std::shared_ptr<Model>&)> loader,
                                       const std::string& event_name) {
   Status status = Status::OK();
@@ -557,6 +720,8 @@ common::Status InferenceSession::Load(std::function<common::Status(std::shared_p
       return common::Status(common::ONNXRUNTIME, common::MODEL_LOADED, "This session already contains a loaded model.");
     }
 
+    startup_profile::ScopedPhase load_phase(startup_profile::Phase::Load);
+
     std::shared_ptr<onnxruntime::Model> p_tmp_model;
     status = loader(p_tmp_model);
     ORT_RETURN_IF_ERROR_SESSIONID_(status);
@@ -566,6 +731,10 @@ common::Status InferenceSession::Load(std::function<common::Status(std::shared_p
     status = DoPostLoadProcessing(*model_);
     ORT_RETURN_IF_ERROR_SESSIONID_(status);
 
+    // captured before graph transforms run so a retrained model file can be validated against
+    // the original structure by RefreshModelWeights
+    model_structure_hash_ = ComputeModelStructureHash(*model_);
+
     // all steps complete, mark the model as loaded.
     is_model_loaded_ = true;
 
@@ -613,6 +782,61 @@ common::Status InferenceSession::Load(const std::basic_string<T>& model_uri) {
 
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+#if !defined(ORT_MINIMAL_BUILD)
+std::basic_string<ORTCHAR_T> InferenceSession::GetOptimizedModelCachePath(
+    const std::basic_string<ORTCHAR_T>& model_uri) const {
+  std::string cache_dir = session_options_.GetConfigOrDefault(kOrtSessionOptionsOptimizedModelCacheDir, "");
+  if (cache_dir.empty()) {
+    return {};
+  }
+
+  size_t file_length = 0;
+  if (!Env::Default().GetFileLength(model_uri.c_str(), file_length).IsOK()) {
+    return {};
+  }
+
+  // fingerprint the model bytes so updating the file in place invalidates the cache entry even
+  // when the byte length is unchanged (e.g. a weight-only redeploy of a retrained model)
+  uint64_t content_hash = 14695981039346656037ULL;
+  {
+    constexpr size_t kChunkSize = 1 << 20;
+    std::vector<char> chunk(std::min(kChunkSize, std::max<size_t>(file_length, 1)));
+    size_t offset = 0;
+    while (offset < file_length) {
+      const size_t read_length = std::min(kChunkSize, file_length - offset);
+      if (!Env::Default()
+               .ReadFileIntoBuffer(model_uri.c_str(), static_cast<FileOffsetType>(offset), read_length,
+                                   gsl::make_span(chunk.data(), read_length))
+               .IsOK()) {
+        return {};
+      }
+      for (size_t i = 0; i < read_length; ++i) {
+        content_hash = (content_hash ^ static_cast<unsigned char>(chunk[i])) * 1099511628211ULL;
+      }
+      offset += read_length;
+    }
+  }
+
+  // fold everything that changes the optimized graph into the key: the model file (path, length
+  // and content hash), the registered execution providers, the optimization level and the ORT
+  // version
+  std::ostringstream key;
+  key << ToMBString(model_uri) << '|' << file_length << '|' << content_hash << '|'
+      << static_cast<int>(session_options_.graph_optimization_level) << '|' << ORT_VERSION;
+  for (const auto& provider_id : execution_providers_.GetIds()) {
+    key << '|' << provider_id;
+  }
+
+  std::ostringstream file_name;
+  // '.ort' selects the ORT format for both saving and loading the cache entry
+  file_name << std::hex << std::hash<std::string>{}(key.str()) << ".ort";
+
+  return ConcatPathComponent<ORTCHAR_T>(ToWideString(cache_dir), ToWideString(file_name.str()));
+}
+#endif  // !defined(ORT_MINIMAL_BUILD)
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD)
+
 common::Status InferenceSession::Load(const std::string& model_uri) {
   std::string model_type = session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigLoadModelFormat, "");
   bool has_explicit_type = !model_type.empty();
@@ -633,6 +857,9 @@ common::Status InferenceSession::Load(const std::string& model_uri) {
                            "Invoke Load().");
   }
 
+  // note: a cached optimized graph, if one exists, is picked up in Initialize. the cache key
+  // folds in the registered execution providers and those are not known until then.
+
   return Load<char>(model_uri);
 #else
   return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "ONNX format model is not supported in this build.");
@@ -660,6 +887,9 @@ common::Status InferenceSession::Load(const std::wstring& model_uri) {
                            "Invoke Load().");
   }
 
+  // note: a cached optimized graph, if one exists, is picked up in Initialize. the cache key
+  // folds in the registered execution providers and those are not known until then.
+
   return Load<PATH_CHAR_TYPE>(model_uri);
 #else
   return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "ONNX format model is not supported in this build.");
@@ -806,6 +1036,165 @@ common::Status InferenceSession::Load() {
   return Load(loader, "model_loading_from_saved_proto");
 }
 
+template <typename T>
+common::Status InferenceSession::RefreshModelWeightsImpl(const std::basic_string<T>& model_uri) {
+  std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  // the swap writes into the weight buffers in-flight runs read from, so runs must be drained
+  // first. this detects stragglers but cannot block new Run calls: that remains the caller's
+  // responsibility.
+  if (current_num_runs_.load() > 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                           "Cannot refresh model weights while Run calls are in flight. Drain them first.");
+  }
+
+  if (model_structure_hash_ == 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Weight refresh is only supported for sessions loaded from ONNX models.");
+  }
+
+  const PathString model_path = ToPathString(model_uri);
+  std::shared_ptr<onnxruntime::Model> new_model;
+  ORT_RETURN_IF_ERROR_SESSIONID_(onnxruntime::Model::Load(model_path, new_model,
+                                                          HasLocalSchema() ? &custom_schema_registries_ : nullptr,
+                                                          *session_logger_));
+
+  if (ComputeModelStructureHash(*new_model) != model_structure_hash_) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                           "The graph structure of the new model does not match the loaded model. "
+                           "Weight refresh requires a retrained copy of the same model.");
+  }
+
+  const Graph& new_graph = new_model->MainGraph();
+  if (SubgraphsHaveInitializers(new_graph)) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
+                           "Weight refresh does not support models whose subgraphs hold initializers.");
+  }
+
+  const bool run_prepacking =
+      session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigDisablePrepacking, "0") != "1";
+  const auto& name_idx_map = session_state_->GetOrtValueNameIdxMap();
+  AllocatorPtr cpu_allocator =
+      session_state_->GetAllocator(session_state_->GetExecutionProviders().GetDefaultCpuMemoryInfo());
+  ORT_ENFORCE(cpu_allocator != nullptr, "Failed to get the default CPU allocator.");
+
+  // stage and swap: every new value is validated and deserialized into a scratch buffer before
+  // any live buffer is touched, so a mid-stream failure (unresolvable name, type/shape mismatch,
+  // read error) leaves the serving session on a consistent weight set instead of a mix of old
+  // and new values.
+  struct StagedWeight {
+    std::string name;
+    int idx = -1;
+    OrtValue* existing_value = nullptr;
+    MLDataType element_type = nullptr;
+    TensorShape shape;
+    size_t len = 0;
+    BufferUniquePtr data;
+  };
+  std::vector<StagedWeight> staged;
+  staged.reserve(new_graph.GetAllInitializedTensors().size());
+
+  for (const auto& entry : new_graph.GetAllInitializedTensors()) {
+    const std::string& name = entry.first;
+    const ONNX_NAMESPACE::TensorProto& tensor_proto = *entry.second;
+
+    if (tensor_proto.data_type() == ONNX_NAMESPACE::TensorProto_DataType_STRING) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Weight refresh does not support string initializer '", name, "'.");
+    }
+
+    StagedWeight weight;
+    weight.name = name;
+    if (!name_idx_map.GetIdx(name, weight.idx).IsOK()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Initializer '", name,
+                             "' no longer exists in the optimized graph (e.g. it was folded by a graph "
+                             "transform), so its new value cannot be applied consistently.");
+    }
+
+    ORT_RETURN_IF_ERROR_SESSIONID_(utils::GetSizeInBytesFromTensorProto<0>(tensor_proto, &weight.len));
+    weight.element_type = DataTypeImpl::TensorTypeFromONNXEnum(tensor_proto.data_type())->GetElementType();
+    std::vector<int64_t> proto_dims(tensor_proto.dims().begin(), tensor_proto.dims().end());
+    weight.shape = TensorShape(proto_dims);
+
+    weight.existing_value = session_state_->GetMutableInitializedTensor(weight.idx);
+    if (weight.existing_value != nullptr) {
+      const Tensor& existing_tensor = *weight.existing_value->GetMutable<Tensor>();
+
+      if (existing_tensor.GetElementType() != tensor_proto.data_type()) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Initializer '", name, "' changed element type.");
+      }
+      if (existing_tensor.Shape() != weight.shape || existing_tensor.SizeInBytes() != weight.len) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Initializer '", name, "' changed shape.");
+      }
+      if (existing_tensor.Location().device.Type() != OrtDevice::CPU) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "Initializer '", name,
+                               "' is not CPU resident. Weight refresh only supports CPU initializers.");
+      }
+    }
+    // when the tensor was released after its kernels prepacked it there is nothing to validate
+    // against; the staged value is only fed back through prepacking below
+
+    weight.data = BufferUniquePtr(cpu_allocator->Alloc(weight.len), BufferDeleter(cpu_allocator));
+    MemBuffer buffer(weight.data.get(), weight.len, cpu_allocator->Info());
+    OrtValue scratch_value;
+    OrtCallback deleter{nullptr, nullptr};
+    ORT_RETURN_IF_ERROR_SESSIONID_(utils::TensorProtoToMLValue(Env::Default(), model_path.c_str(), tensor_proto,
+                                                               buffer, scratch_value, deleter));
+    // externally stored data may come back referencing its own (e.g. mmapped) memory
+    const Tensor& scratch_tensor = scratch_value.Get<Tensor>();
+    if (scratch_tensor.DataRaw() != weight.data.get()) {
+      memcpy(weight.data.get(), scratch_tensor.DataRaw(), weight.len);
+    }
+    if (deleter.f != nullptr) {
+      deleter.f(deleter.param);
+    }
+
+    staged.push_back(std::move(weight));
+  }
+
+  // commit: plain copies into the existing buffers, which cannot fail. every OrtValue that
+  // references an initializer shares the tensor, so the swap is memory-flat and needs no map
+  // updates.
+  for (const auto& weight : staged) {
+    if (weight.existing_value != nullptr) {
+      Tensor& existing_tensor = *weight.existing_value->GetMutable<Tensor>();
+      memcpy(existing_tensor.MutableDataRaw(), weight.data.get(), weight.len);
+    }
+  }
+
+  // re-run prepacking only after every buffer holds its new value: should a PrePack call fail,
+  // the weights themselves are still a consistent set and only kernel-owned packed copies may
+  // be stale
+  for (const auto& weight : staged) {
+    if (weight.existing_value != nullptr) {
+      if (run_prepacking && session_state_->IsConstantInitializedTensor(weight.idx)) {
+        const Tensor& existing_tensor = *weight.existing_value->GetMutable<Tensor>();
+        ORT_RETURN_IF_ERROR_SESSIONID_(session_state_->RepackConstantInitializer(weight.name, existing_tensor));
+      }
+    } else {
+      // the tensor was released after its kernels prepacked it; feed the staged value through
+      // prepacking, which copies what it needs into kernel-owned buffers
+      Tensor scratch_tensor(weight.element_type, weight.shape, weight.data.get(), cpu_allocator->Info());
+      ORT_RETURN_IF_ERROR_SESSIONID_(session_state_->RepackConstantInitializer(weight.name, scratch_tensor));
+    }
+  }
+
+  LOGS(*session_logger_, INFO) << "Refreshed " << staged.size() << " initializers from " << ToMBString(model_path);
+  return Status::OK();
+}
+
+common::Status InferenceSession::RefreshModelWeights(const std::string& model_uri) {
+  return RefreshModelWeightsImpl(model_uri);
+}
+
+#ifdef _WIN32
+common::Status InferenceSession::RefreshModelWeights(const std::wstring& model_uri) {
+  return RefreshModelWeightsImpl(model_uri);
+}
+#endif
+
 common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph,
                                                 const onnxruntime::GraphTransformerManager& graph_transformer_mgr,
                                                 const ExecutionProviders& providers,
@@ -848,8 +1237,21 @@ common::Status InferenceSession::TransformGraph(onnxruntime::Graph& graph,
   auto mode = saving_model_in_ort_format ? GraphPartitioner::Mode::kAssignOnly
                                          : GraphPartitioner::Mode::kNormal;
 
+  // EPs that declare concurrent compilation safe can compile independent fused subgraphs in
+  // parallel on the inter-op pool.
+  int max_compile_parallelism = 1;
+  const std::string compile_parallelism_str =
+      session_options_.GetConfigOrDefault(kOrtSessionOptionsCompileParallelism, "1");
+  if (!TryParseStringWithClassicLocale(compile_parallelism_str, max_compile_parallelism) ||
+      max_compile_parallelism < 1) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                           "Invalid value for ", kOrtSessionOptionsCompileParallelism, ": ",
+                           compile_parallelism_str);
+  }
+
   // Do partitioning based on execution providers' capability.
-  GraphPartitioner partitioner(kernel_registry_manager, providers);
+  GraphPartitioner partitioner(kernel_registry_manager, providers,
+                               session_state.GetInterOpThreadPool(), max_compile_parallelism);
   ORT_RETURN_IF_ERROR_SESSIONID_(partitioner.Partition(graph, session_state.ExportDll(),
                                                        session_state.GetMutableFuncMgr(), mode));
 
@@ -941,15 +1343,28 @@ Status InferenceSession::PartitionOrtFormatModel(onnxruntime::Graph& graph,
 template <typename T>
 static Status LoadOrtModelBytes(const std::basic_string<T>& model_uri,
                                 std::basic_string<ORTCHAR_T>& model_location,
-                                std::vector<uint8_t>& bytes) {
+                                Env::MappedMemoryPtr& mapped_memory,
+                                std::vector<uint8_t>& bytes_data_holder,
+                                gsl::span<const uint8_t>& bytes) {
   size_t num_bytes = 0;
   model_location = ToWideString(model_uri);
   ORT_RETURN_IF_ERROR(Env::Default().GetFileLength(model_location.c_str(), num_bytes));
 
-  bytes.resize(num_bytes);
+  // Flatbuffers is designed for in-place access, so prefer mapping the file and deserializing
+  // straight from the page cache over copying it into a heap buffer.
+  {
+    Env::MappedMemoryPtr local_mapped_memory{};
+    if (Env::Default().MapFileIntoMemory(model_location.c_str(), 0, num_bytes, local_mapped_memory).IsOK()) {
+      mapped_memory = std::move(local_mapped_memory);
+      bytes = gsl::make_span(reinterpret_cast<const uint8_t*>(mapped_memory.get()), num_bytes);
+      return Status::OK();
+    }
+  }
+
+  bytes_data_holder.resize(num_bytes);
 
   std::ifstream bytes_stream(model_uri, std::ifstream::in | std::ifstream::binary);
-  bytes_stream.read(reinterpret_cast<char*>(bytes.data()), num_bytes);
+  bytes_stream.read(reinterpret_cast<char*>(bytes_data_holder.data()), num_bytes);
 
   if (!bytes_stream) {
     return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL,
@@ -957,13 +1372,18 @@ static Status LoadOrtModelBytes(const std::basic_string<T>& model_uri,
                            bytes_stream.gcount(), "/", num_bytes, " bytes were able to be read.");
   }
 
+  bytes = gsl::make_span(bytes_data_holder.data(), num_bytes);
+
   return Status::OK();
 }
 
 Status InferenceSession::LoadOrtModel(const std::string& model_uri) {
   return LoadOrtModel(
       [&]() {
-        ORT_RETURN_IF_ERROR(LoadOrtModelBytes(model_uri, model_location_, ort_format_model_bytes_));
+        ORT_RETURN_IF_ERROR(LoadOrtModelBytes(model_uri, model_location_,
+                                              ort_format_model_mapped_memory_,
+                                              ort_format_model_bytes_data_holder_,
+                                              ort_format_model_bytes_));
         return Status::OK();
       });
 }
@@ -972,7 +1392,10 @@ Status InferenceSession::LoadOrtModel(const std::string& model_uri) {
 Status InferenceSession::LoadOrtModel(const std::wstring& model_uri) {
   return LoadOrtModel(
       [&]() {
-        ORT_RETURN_IF_ERROR(LoadOrtModelBytes(model_uri, model_location_, ort_format_model_bytes_));
+        ORT_RETURN_IF_ERROR(LoadOrtModelBytes(model_uri, model_location_,
+                                              ort_format_model_mapped_memory_,
+                                              ort_format_model_bytes_data_holder_,
+                                              ort_format_model_bytes_));
         return Status::OK();
       });
 }
@@ -980,12 +1403,20 @@ Status InferenceSession::LoadOrtModel(const std::wstring& model_uri) {
 
 Status InferenceSession::LoadOrtModel(const void* model_data, int model_data_len) {
   return LoadOrtModel([&]() {
-    // copy bytes as we need them to be available when InferenceSession::Initialize is called later.
-    //
-    // TODO: Provide Load API where we can take ownership of memory to avoid the copy,
-    // and/or a combined Load+Initialize where we don't need this temporary copy.
-    ort_format_model_bytes_.resize(model_data_len);
-    std::copy_n(reinterpret_cast<const uint8_t*>(model_data), model_data_len, ort_format_model_bytes_.data());
+    const auto use_bytes_directly =
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsConfigUseORTModelBytesDirectly, "0");
+    if (use_bytes_directly == "1") {
+      // the caller guarantees the bytes outlive InferenceSession::Initialize, so use them in place
+      ort_format_model_bytes_ = gsl::make_span(reinterpret_cast<const uint8_t*>(model_data),
+                                               static_cast<size_t>(model_data_len));
+    } else {
+      // copy bytes as we need them to be available when InferenceSession::Initialize is called later.
+      ort_format_model_bytes_data_holder_.resize(model_data_len);
+      std::copy_n(reinterpret_cast<const uint8_t*>(model_data), model_data_len,
+                  ort_format_model_bytes_data_holder_.data());
+      ort_format_model_bytes_ = gsl::make_span(ort_format_model_bytes_data_holder_.data(),
+                                               static_cast<size_t>(model_data_len));
+    }
 
     return Status::OK();
   });
@@ -1010,8 +1441,16 @@ Status InferenceSession::LoadOrtModel(std::function<Status()> load_ort_format_mo
 
   ORT_RETURN_IF_ERROR(load_ort_format_model_bytes());
 
+  ORT_RETURN_IF_ERROR(ParseOrtModelBytes());
+
+  is_model_loaded_ = true;
+
+  return Status::OK();
+}
+
+Status InferenceSession::ParseOrtModelBytes() {
   // Verify the ort_format_model_bytes_ is a valid InferenceSessionBuffer before we access the data
-  flatbuffers::Verifier verifier(ort_format_model_bytes_.data(), ort_format_model_bytes_.size());
+  flatbuffers::Verifier verifier(ort_format_model_bytes_.data(), static_cast<size_t>(ort_format_model_bytes_.size()));
   ORT_RETURN_IF_NOT(fbs::VerifyInferenceSessionBuffer(verifier), "ORT model verification failed.");
 
   const auto* fbs_session = fbs::GetInferenceSession(ort_format_model_bytes_.data());
@@ -1027,28 +1466,83 @@ Status InferenceSession::LoadOrtModel(std::function<Status()> load_ort_format_mo
   const auto* fbs_model = fbs_session->model();
   ORT_RETURN_IF(nullptr == fbs_model, "Missing Model. Invalid ORT format model.");
 
+  // Initialize reads the session state from the bytes later, so reject its absence up front while
+  // any previously loaded model is still intact
+  const auto* fbs_sess_state = fbs_session->session_state();
+  ORT_RETURN_IF(nullptr == fbs_sess_state, "SessionState is null. Invalid ORT format model.");
+
+  // suitably aligned initializers reference the model bytes in place instead of being copied into
+  // session-owned buffers. the bytes are then kept alive for the session's lifetime instead of
+  // being released after Initialize.
+  using_ort_model_bytes_for_initializers_ =
+      session_options_.GetConfigOrDefault(kOrtSessionOptionsUseOrtModelBytesForInitializers, "0") == "1";
+
   // need to go from unique_ptr to shared_ptr when moving into model_
   std::unique_ptr<Model> tmp_model;
 #if !defined(ORT_MINIMAL_BUILD)
   ORT_RETURN_IF_ERROR(Model::LoadFromOrtFormat(*fbs_model,
                                                HasLocalSchema() ? &custom_schema_registries_ : nullptr,
-                                               *session_logger_, tmp_model));
+                                               *session_logger_, tmp_model,
+                                               using_ort_model_bytes_for_initializers_));
 
 #else
-  ORT_RETURN_IF_ERROR(Model::LoadFromOrtFormat(*fbs_model, *session_logger_, tmp_model));
+  ORT_RETURN_IF_ERROR(Model::LoadFromOrtFormat(*fbs_model, *session_logger_, tmp_model,
+                                               using_ort_model_bytes_for_initializers_));
 #endif
 
   ORT_RETURN_IF_ERROR(SaveModelMetadata(*tmp_model));
   model_ = std::move(tmp_model);
 
-  // Initialize takes the session_mutex_ as well so we need to have released it prior to calling this
-  const auto* fbs_sess_state = fbs_session->session_state();
-  ORT_RETURN_IF(nullptr == fbs_sess_state, "SessionState is null. Invalid ORT format model.");
+  return Status::OK();
+}
 
-  is_model_loaded_ = true;
+#if !defined(ORT_MINIMAL_BUILD)
+Status InferenceSession::TryLoadCachedOptimizedModel() {
+  // models fed in as bytes have no stable identity to key the cache on
+  if (model_location_.empty()) {
+    return Status::OK();
+  }
+
+  const auto cache_path = GetOptimizedModelCachePath(model_location_);
+  if (cache_path.empty()) {
+    return Status::OK();
+  }
+
+  size_t cached_length = 0;
+  if (Env::Default().GetFileLength(cache_path.c_str(), cached_length).IsOK() && cached_length > 0) {
+    LOGS(*session_logger_, INFO) << "Loading cached optimized model from " << ToMBString(cache_path);
+
+    const auto original_model_location = model_location_;
+    auto cached_load_status = [&]() -> Status {
+      ORT_RETURN_IF_ERROR(LoadOrtModelBytes(cache_path, model_location_,
+                                            ort_format_model_mapped_memory_,
+                                            ort_format_model_bytes_data_holder_,
+                                            ort_format_model_bytes_));
+      return ParseOrtModelBytes();
+    }();
+    if (cached_load_status.IsOK()) {
+      return Status::OK();
+    }
+
+    // a damaged cache entry must not take the session down: discard the partially loaded state
+    // and continue with the already loaded model, which rewrites the entry
+    LOGS(*session_logger_, WARNING) << "Failed to load cached optimized model from " << ToMBString(cache_path)
+                                    << ": " << cached_load_status.ErrorMessage()
+                                    << ". Falling back to the already loaded model.";
+    ort_format_model_bytes_ = gsl::span<const uint8_t>();
+    ort_format_model_mapped_memory_.reset();
+    ort_format_model_bytes_data_holder_.clear();
+    model_location_ = original_model_location;
+  }
+
+  if (session_options_.optimized_model_filepath.empty()) {
+    session_options_.optimized_model_filepath = cache_path;
+    optimized_model_cache_path_ = cache_path;
+  }
 
   return Status::OK();
 }
+#endif  // !defined(ORT_MINIMAL_BUILD)
 #endif  // defined(ENABLE_ORT_FORMAT_LOAD)
 
 bool InferenceSession::IsInitialized() const {
@@ -1131,6 +1625,14 @@ common::Status InferenceSession::Initialize() {
     if (!have_cpu_ep) {
       LOGS(*session_logger_, INFO) << "Adding default CPU execution provider.";
       CPUExecutionProviderInfo epi{session_options_.enable_cpu_mem_arena};
+      epi.use_huge_pages =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsArenaUseHugePages, "0") == "1";
+#if defined(USE_MIMALLOC_ARENA_ALLOCATOR)
+      // mimalloc builds default to the mimalloc arena; the config entry is the BFCArena fallback
+      // for A/B comparisons within one binary.
+      epi.use_mimalloc_arena =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsUseMimallocArena, "1") == "1";
+#endif
       auto p_cpu_exec_provider = onnxruntime::make_unique<CPUExecutionProvider>(epi);
       ORT_RETURN_IF_ERROR_SESSIONID_(RegisterExecutionProvider(std::move(p_cpu_exec_provider)));
     }
@@ -1157,13 +1659,60 @@ common::Status InferenceSession::Initialize() {
       UpdateProvidersWithSharedAllocators();
     }
 
+#if defined(ENABLE_ORT_FORMAT_LOAD) && !defined(ORT_MINIMAL_BUILD)
+    // warm restart: only now that every execution provider is registered can the cache key
+    // distinguish provider configurations, so this is the earliest point a cached optimized
+    // graph can be matched. on a hit the loaded model is replaced with the cached ORT format
+    // graph and the transform/partition work below is skipped; on a miss the optimized graph
+    // is written to the cache further down.
+    if (ort_format_model_bytes_.empty()) {
+      ORT_RETURN_IF_ERROR_SESSIONID_(TryLoadCachedOptimizedModel());
+    }
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD) && !defined(ORT_MINIMAL_BUILD)
+
 #ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
     TraceLoggingWriteStart(session_activity, "OrtInferenceSessionActivity");
     session_activity_started_ = true;
 #endif
 
+    int64_t mem_pattern_bucket_size = 0;
+    {
+      const std::string bucket_size_str =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsMemoryPatternShapeBucketSize, "0");
+      if (!TryParseStringWithClassicLocale(bucket_size_str, mem_pattern_bucket_size) ||
+          mem_pattern_bucket_size < 0) {
+        LOGS(*session_logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsMemoryPatternShapeBucketSize
+                                        << ": '" << bucket_size_str << "'. Using exact shape keys.";
+        mem_pattern_bucket_size = 0;
+      }
+    }
+
+    int64_t mem_pattern_min_stable_runs = 1;
+    {
+      const std::string min_stable_runs_str =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsMemoryPatternMinStableRuns, "1");
+      if (!TryParseStringWithClassicLocale(min_stable_runs_str, mem_pattern_min_stable_runs) ||
+          mem_pattern_min_stable_runs < 1) {
+        LOGS(*session_logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsMemoryPatternMinStableRuns
+                                        << ": '" << min_stable_runs_str << "'. Tracing on first run.";
+        mem_pattern_min_stable_runs = 1;
+      }
+    }
+
+    int64_t node_timing_sample_interval = 0;
+    {
+      const std::string sample_interval_str =
+          session_options_.GetConfigOrDefault(kOrtSessionOptionsNodeTimingSampleInterval, "0");
+      if (!TryParseStringWithClassicLocale(sample_interval_str, node_timing_sample_interval) ||
+          node_timing_sample_interval < 0) {
+        LOGS(*session_logger_, WARNING) << "Invalid value for " << kOrtSessionOptionsNodeTimingSampleInterval
+                                        << ": '" << sample_interval_str << "'. Node timing sampling is disabled.";
+        node_timing_sample_interval = 0;
+      }
+    }
+
     // now that we have all the execution providers, create the session state
-    session_state_ = onnxruntime::make_unique<SessionState>(
+    session_state_ = std::make_shared<SessionState>(
         model_->MainGraph(),
         execution_providers_,
         session_options_.enable_mem_pattern && session_options_.execution_mode == ExecutionMode::ORT_SEQUENTIAL,
@@ -1172,7 +1721,12 @@ common::Status InferenceSession::Initialize() {
         data_transfer_mgr_,
         *session_logger_,
         session_profiler_,
-        session_options_.use_deterministic_compute);
+        session_options_.use_deterministic_compute,
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsUseRunScopedScratchArena, "0") == "1",
+        mem_pattern_bucket_size,
+        mem_pattern_min_stable_runs,
+        node_timing_sample_interval,
+        session_options_.GetConfigOrDefault(kOrtSessionOptionsUseHighPriorityScheduling, "0") == "1");
 
     onnxruntime::Graph& graph = model_->MainGraph();
 
@@ -1204,14 +1758,20 @@ common::Status InferenceSession::Initialize() {
                                 transformers_to_enable_);
 
       // apply any transformations to the main graph and any subgraphs
-      ORT_RETURN_IF_ERROR_SESSIONID_(TransformGraph(graph, graph_transformation_mgr_,
-                                                    execution_providers_, kernel_registry_manager_,
-                                                    insert_cast_transformer_,
-                                                    *session_state_,
-                                                    saving_ort_format));
+      {
+        startup_profile::ScopedPhase transform_phase(startup_profile::Phase::Transform);
+        ORT_RETURN_IF_ERROR_SESSIONID_(TransformGraph(graph, graph_transformation_mgr_,
+                                                      execution_providers_, kernel_registry_manager_,
+                                                      insert_cast_transformer_,
+                                                      *session_state_,
+                                                      saving_ort_format));
+      }
 
       // now that all the transforms are done, call Resolve on the main graph. this will recurse into the subgraphs.
-      ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+      {
+        startup_profile::ScopedPhase resolve_phase(startup_profile::Phase::Resolve);
+        ORT_RETURN_IF_ERROR_SESSIONID_(graph.Resolve());
+      }
 
       // Update temporary copies of metadata, input- and output definitions to the same state as the resolved graph
       ORT_RETURN_IF_ERROR_SESSIONID_(SaveModelMetadata(*model_));
@@ -1235,13 +1795,28 @@ common::Status InferenceSession::Initialize() {
             ? fbs::GetInferenceSession(ort_format_model_bytes_.data())->session_state()
             : nullptr;
 
+    // resolve the environment level weight store when cross-session weight sharing is requested.
+    // the model path keys the store; models fed in as bytes have no stable identity, so they
+    // cannot participate.
+    SharedModelWeights* shared_weights = nullptr;
+    if (session_options_.GetConfigOrDefault(kOrtSessionOptionsCrossSessionWeightSharing, "0") == "1") {
+      if (model_location_.empty()) {
+        LOGS(*session_logger_, WARNING)
+            << "Cross-session weight sharing requires a model loaded from a file path. Ignoring "
+            << kOrtSessionOptionsCrossSessionWeightSharing << ".";
+      } else {
+        shared_weights = &environment_.GetSharedWeightCache().GetOrCreateModelWeights(ToMBString(model_location_));
+      }
+    }
+
     ORT_RETURN_IF_ERROR_SESSIONID_(
         session_state_->FinalizeSessionState(model_location_, kernel_registry_manager_,
                                              session_options_,
                                              serialized_session_state,
                                              // need to keep the initializers if saving the optimized model
                                              !saving_model,
-                                             saving_ort_format));
+                                             saving_ort_format,
+                                             shared_weights));
 
 #if !defined(ORT_MINIMAL_BUILD)
     if (saving_model) {
@@ -1259,19 +1834,60 @@ common::Status InferenceSession::Initialize() {
                "and should only be used in the same environment the model was optimized for.";
       }
 
+      std::basic_string<ORTCHAR_T> save_path = session_options_.optimized_model_filepath;
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+      // when populating the optimized model cache, write to a temporary file and rename it into
+      // place so concurrent cold starts never observe a partially written entry
+      const bool saving_to_cache =
+          !optimized_model_cache_path_.empty() && save_path == optimized_model_cache_path_;
+      if (saving_to_cache) {
+        save_path += ToWideString("." + std::to_string(Env::Default().GetSelfPid()) + ".tmp");
+      }
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD)
+
       if (saving_ort_format) {
-        ORT_RETURN_IF_ERROR_SESSIONID_(SaveToOrtFormat(session_options_.optimized_model_filepath));
+        ORT_RETURN_IF_ERROR_SESSIONID_(SaveToOrtFormat(save_path));
       } else {
-        ORT_RETURN_IF_ERROR_SESSIONID_(Model::Save(*model_, session_options_.optimized_model_filepath));
+        ORT_RETURN_IF_ERROR_SESSIONID_(Model::Save(*model_, save_path));
       }
+
+#if defined(ENABLE_ORT_FORMAT_LOAD)
+      if (saving_to_cache) {
+#ifdef _WIN32
+        const int rename_result = _wrename(save_path.c_str(), optimized_model_cache_path_.c_str());
+#else
+        const int rename_result = std::rename(save_path.c_str(), optimized_model_cache_path_.c_str());
+#endif
+        if (rename_result != 0) {
+          // another cold start may have populated the entry first. the session itself is
+          // unaffected, so drop the temporary file and keep going
+          LOGS(*session_logger_, WARNING) << "Failed to move optimized model cache entry into place at "
+                                          << ToMBString(optimized_model_cache_path_) << ".";
+#ifdef _WIN32
+          _wremove(save_path.c_str());
+#else
+          std::remove(save_path.c_str());
+#endif
+        }
+      }
+#endif  // defined(ENABLE_ORT_FORMAT_LOAD)
     }
 #endif  // !defined(ORT_MINIMAL_BUILD)
 
     session_state_->ResolveMemoryPatternFlag();
     is_inited_ = true;
 
-    // we don't directly use the ORT format bytes currently, so free those now
-    std::vector<uint8_t>().swap(ort_format_model_bytes_);
+    if (startup_profile::IsEnabled()) {
+      LOGS(*session_logger_, INFO) << startup_profile::Report();
+    }
+
+    // release the ORT format bytes and any backing storage, unless initializers reference the
+    // bytes in place, in which case they must stay alive as long as the session
+    if (!using_ort_model_bytes_for_initializers_) {
+      ort_format_model_bytes_ = gsl::span<const uint8_t>();
+      std::vector<uint8_t>().swap(ort_format_model_bytes_data_holder_);
+      ort_format_model_mapped_memory_.reset();
+    }
 
     // and log telemetry
     bool model_has_fp16_inputs = ModelHasFP16Inputs(graph);
@@ -1314,6 +1930,156 @@ common::Status InferenceSession::Initialize() {
   return status;
 }
 
+common::Status InferenceSession::Clone(std::unique_ptr<InferenceSession>& cloned_session) {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  // the clone gets its own session id, logger and profiler via the regular constructor, then
+  // adopts this session's immutable initialized state instead of loading and initializing itself
+  cloned_session = onnxruntime::make_unique<InferenceSession>(session_options_, environment_);
+
+  cloned_session->model_ = model_;
+  cloned_session->session_state_ = session_state_;
+  cloned_session->model_location_ = model_location_;
+  // ModelMetadata is copy constructible but not copy assignable, so copy the fields
+  cloned_session->model_metadata_.producer_name = model_metadata_.producer_name;
+  cloned_session->model_metadata_.graph_name = model_metadata_.graph_name;
+  cloned_session->model_metadata_.domain = model_metadata_.domain;
+  cloned_session->model_metadata_.description = model_metadata_.description;
+  cloned_session->model_metadata_.graph_description = model_metadata_.graph_description;
+  cloned_session->model_metadata_.version = model_metadata_.version;
+  cloned_session->model_metadata_.custom_metadata_map = model_metadata_.custom_metadata_map;
+  cloned_session->input_def_map_ = input_def_map_;
+  cloned_session->output_def_list_ = output_def_list_;
+  cloned_session->required_inputs_ = required_inputs_;
+  // memory patterns and provider caches live in the shared session state, so warmup carries over
+  cloned_session->warmed_up_ = warmed_up_.load();
+
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(cloned_session->session_mutex_);
+    cloned_session->is_model_loaded_ = true;
+    cloned_session->is_inited_ = true;
+  }
+
+  return Status::OK();
+}
+
+common::Status InferenceSession::ShrinkMemoryArenas() {
+  Status status = Status::OK();
+
+  for (auto& provider : execution_providers_) {
+    for (auto& allocator : provider->GetAllocators()) {
+      if (allocator->Info().alloc_type != OrtArenaAllocator) {
+        continue;
+      }
+
+      auto shrink_status = static_cast<IArenaAllocator*>(allocator.get())->Shrink();
+      // an arena implementation without shrink support is not an error; report anything else
+      if (!shrink_status.IsOK() && shrink_status.Code() != common::NOT_IMPLEMENTED && status.IsOK()) {
+        status = shrink_status;
+      }
+    }
+  }
+
+  return status;
+}
+
+common::Status InferenceSession::Warmup(
+    const std::vector<std::unordered_map<std::string, TensorShape>>& input_shape_sets) {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+  }
+
+  // feeds are created on CPU; Run copies them to other devices as needed, which also exercises
+  // the data transfer path the real requests will take. go through the session state for the
+  // execution providers so this works for cloned sessions too.
+  AllocatorPtr cpu_allocator = session_state_->GetExecutionProviders()
+                                   .Get(onnxruntime::kCpuExecutionProvider)
+                                   ->GetAllocator(0, OrtMemTypeDefault);
+
+  std::vector<std::string> output_names;
+  output_names.reserve(output_def_list_.size());
+  for (const auto* def : output_def_list_) {
+    output_names.push_back(def->Name());
+  }
+
+  // an empty request warms up with just the shapes from the model
+  static const std::vector<std::unordered_map<std::string, TensorShape>> model_shapes_only(1);
+  const auto& shape_sets = input_shape_sets.empty() ? model_shapes_only : input_shape_sets;
+
+  RunOptions run_options;
+  run_options.run_tag = "warmup";
+
+  for (const auto& shape_set : shape_sets) {
+    std::vector<std::string> feed_names;
+    std::vector<OrtValue> feeds;
+    feed_names.reserve(input_def_map_.size());
+    feeds.reserve(input_def_map_.size());
+
+    for (const auto& pair : input_def_map_) {
+      const auto& name = pair.first;
+      const auto& input_def = pair.second;
+
+      auto shape_iter = shape_set.find(name);
+      if (shape_iter == shape_set.end() && required_inputs_.count(name) == 0) {
+        // overridable initializer with no explicit shape. the stored value is used.
+        continue;
+      }
+
+      const TensorTypeBase* tensor_type = input_def.ml_data_type->AsTensorType();
+      if (tensor_type == nullptr) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "Warmup only supports tensor inputs. Input: ", name);
+      }
+
+      if (shape_iter == shape_set.end() && input_def.node_arg->Shape() == nullptr) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                               "Warmup requires a shape for input '", name,
+                               "' as the model does not define one.");
+      }
+
+      const TensorShape& shape = shape_iter != shape_set.end() ? shape_iter->second : input_def.tensor_shape;
+      for (size_t i = 0, end = shape.NumDimensions(); i < end; ++i) {
+        if (shape[i] < 0) {
+          return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                                 "Warmup requires a concrete shape for input '", name,
+                                 "' as the model does not fully define one.");
+        }
+      }
+
+      auto tensor = onnxruntime::make_unique<Tensor>(tensor_type->GetElementType(), shape, cpu_allocator);
+      if (!tensor->IsDataTypeString() && tensor->SizeInBytes() > 0) {
+        memset(tensor->MutableDataRaw(), 0, tensor->SizeInBytes());
+      }
+
+      OrtValue ort_value;
+      ort_value.Init(tensor.release(), DataTypeImpl::GetType<Tensor>(),
+                     DataTypeImpl::GetType<Tensor>()->GetDeleteFunc());
+      feed_names.push_back(name);
+      feeds.push_back(std::move(ort_value));
+    }
+
+    std::vector<OrtValue> fetches;
+    ORT_RETURN_IF_ERROR(Run(run_options, feed_names, feeds, output_names, &fetches));
+  }
+
+  warmed_up_.store(true, std::memory_order_release);
+  return Status::OK();
+}
+
+bool InferenceSession::IsWarmedUp() const {
+  return warmed_up_.load(std::memory_order_acquire);
+}
+
 // This method should be called from within Initialize() only and before the creation of the session state.
 // This ensures all providers have been registered in the session and the session state is consistent with the providers.
 void InferenceSession::UpdateProvidersWithSharedAllocators() {
@@ -1414,51 +2180,56 @@ common::Status InferenceSession::ValidateInputs(const std::vector<std::string>&
       return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid Feed Input Name:", feed_name);
     }
 
-    auto expected_type = iter->second.ml_data_type;
-    auto& input_ml_value = feeds.at(i);
-    if (input_ml_value.IsTensor()) {
-      // check for type
-      if (!expected_type->IsTensorType()) {
-        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input with name: ", feed_name,
-                               " is not expected to be of type tensor.");
-      }
-      auto expected_element_type = expected_type->AsTensorType()->GetElementType();
-      auto input_element_type = input_ml_value.Get<Tensor>().DataType();
-      ORT_RETURN_IF_ERROR_SESSIONID_(CheckTypes(input_element_type, expected_element_type, "tensor"));
-
-      // check for shape
-      const auto& expected_shape = iter->second.tensor_shape;
-      if (expected_shape.NumDimensions() > 0) {
-        const auto& input_shape = input_ml_value.Get<Tensor>().Shape();
-        ORT_RETURN_IF_ERROR_SESSIONID_(CheckShapes(feed_name, input_shape, expected_shape));
-      }
-    } else if (input_ml_value.IsSparseTensor()) {
-      if (!expected_type->IsSparseTensorType()) {
-        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input with name: ", feed_name,
-                               " is not expected to be of type sparse tensor.");
-      }
-      auto expected_element_type = expected_type->AsSparseTensorType()->GetElementType();
-      const SparseTensor& sparse_tensor = input_ml_value.Get<SparseTensor>();
-      auto input_element_type = sparse_tensor.Values().DataType();
-      ORT_RETURN_IF_ERROR_SESSIONID_(CheckTypes(input_element_type, expected_element_type, "sparse_tensor"));
-      // Check shape
-      const auto& expected_shape = iter->second.tensor_shape;
-      if (expected_shape.NumDimensions() > 0) {
-        const auto& input_shape = sparse_tensor.Shape();
-        ORT_RETURN_IF_ERROR_SESSIONID_(CheckShapes(feed_name, input_shape, expected_shape));
-      }
-    } else if (input_ml_value.IsTensorSequence()) {
-      if (!expected_type->IsTensorSequenceType()) {
-        return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input with name: ", feed_name,
-                               " is not expected to be of type tensor sequence.");
-      }
-      auto expected_element_type = expected_type->AsSequenceTensorBase()->GetElementType();
-      auto input_element_type = input_ml_value.Get<TensorSeq>().DataType();
-      ORT_RETURN_IF_ERROR_SESSIONID_(CheckTypes(input_element_type, expected_element_type, "seq"));
-    } else {
-      auto input_type = input_ml_value.Type();
-      ORT_RETURN_IF_ERROR_SESSIONID_(CheckTypes(input_type, expected_type, ""));
+    ORT_RETURN_IF_ERROR_SESSIONID_(ValidateFeedValue(feed_name, iter->second.ml_data_type,
+                                                     iter->second.tensor_shape, feeds.at(i)));
+  }
+
+  return Status::OK();
+}
+
+common::Status InferenceSession::ValidateFeedValue(const std::string& feed_name, MLDataType expected_type,
+                                                   const TensorShape& expected_shape,
+                                                   const OrtValue& input_ml_value) const {
+  if (input_ml_value.IsTensor()) {
+    // check for type
+    if (!expected_type->IsTensorType()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input with name: ", feed_name,
+                             " is not expected to be of type tensor.");
+    }
+    auto expected_element_type = expected_type->AsTensorType()->GetElementType();
+    auto input_element_type = input_ml_value.Get<Tensor>().DataType();
+    ORT_RETURN_IF_ERROR_SESSIONID_(CheckTypes(input_element_type, expected_element_type, "tensor"));
+
+    // check for shape
+    if (expected_shape.NumDimensions() > 0) {
+      const auto& input_shape = input_ml_value.Get<Tensor>().Shape();
+      ORT_RETURN_IF_ERROR_SESSIONID_(CheckShapes(feed_name, input_shape, expected_shape));
+    }
+  } else if (input_ml_value.IsSparseTensor()) {
+    if (!expected_type->IsSparseTensorType()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input with name: ", feed_name,
+                             " is not expected to be of type sparse tensor.");
     }
+    auto expected_element_type = expected_type->AsSparseTensorType()->GetElementType();
+    const SparseTensor& sparse_tensor = input_ml_value.Get<SparseTensor>();
+    auto input_element_type = sparse_tensor.Values().DataType();
+    ORT_RETURN_IF_ERROR_SESSIONID_(CheckTypes(input_element_type, expected_element_type, "sparse_tensor"));
+    // Check shape
+    if (expected_shape.NumDimensions() > 0) {
+      const auto& input_shape = sparse_tensor.Shape();
+      ORT_RETURN_IF_ERROR_SESSIONID_(CheckShapes(feed_name, input_shape, expected_shape));
+    }
+  } else if (input_ml_value.IsTensorSequence()) {
+    if (!expected_type->IsTensorSequenceType()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Input with name: ", feed_name,
+                             " is not expected to be of type tensor sequence.");
+    }
+    auto expected_element_type = expected_type->AsSequenceTensorBase()->GetElementType();
+    auto input_element_type = input_ml_value.Get<TensorSeq>().DataType();
+    ORT_RETURN_IF_ERROR_SESSIONID_(CheckTypes(input_element_type, expected_element_type, "seq"));
+  } else {
+    auto input_type = input_ml_value.Type();
+    ORT_RETURN_IF_ERROR_SESSIONID_(CheckTypes(input_type, expected_type, ""));
   }
 
   return Status::OK();
@@ -1496,21 +2267,7 @@ Status InferenceSession::Run(const RunOptions& run_options,
                              const std::vector<std::string>& feed_names, const std::vector<OrtValue>& feeds,
                              const std::vector<std::string>& output_names, std::vector<OrtValue>* p_fetches,
                              const std::vector<OrtDevice>* p_fetches_device_info) {
-  TimePoint tp;
-  if (session_profiler_.IsEnabled()) {
-    tp = session_profiler_.StartTime();
-  }
-
-#ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
-  TraceLoggingActivity<telemetry_provider_handle> ortrun_activity;
-  ortrun_activity.SetRelatedActivity(session_activity);
-  TraceLoggingWriteStart(ortrun_activity, "OrtRun");
-#endif
   Status retval = Status::OK();
-  const Env& env = Env::Default();
-
-  std::vector<IExecutionProvider*> exec_providers_to_stop;
-  exec_providers_to_stop.reserve(execution_providers_.NumProviders());
 
   ORT_TRY {
     if (!is_inited_) {
@@ -1518,9 +2275,6 @@ Status InferenceSession::Run(const RunOptions& run_options,
       return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
     }
 
-    // log evaluation start to trace logging provider
-    env.GetTelemetryProvider().LogEvaluationStart();
-
     ORT_RETURN_IF_ERROR_SESSIONID_(ValidateInputs(feed_names, feeds));
     ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(output_names, p_fetches));
 
@@ -1537,6 +2291,75 @@ Status InferenceSession::Run(const RunOptions& run_options,
       }
     }
 
+    retval = RunWithFeedsFetchesManager(run_options, feeds_fetches_manager, feeds, p_fetches);
+  }
+  ORT_CATCH(const std::exception& e) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      retval = Status(common::ONNXRUNTIME, common::FAIL, e.what());
+    });
+  }
+  ORT_CATCH(...) {
+    retval = Status(common::ONNXRUNTIME, common::RUNTIME_EXCEPTION, "Encountered unknown exception in Run()");
+  }
+
+  return retval;
+}
+
+common::Status InferenceSession::RunWithFeedsFetchesManager(const RunOptions& run_options,
+                                                            FeedsFetchesManager& feeds_fetches_manager,
+                                                            const std::vector<OrtValue>& feeds,
+                                                            std::vector<OrtValue>* p_fetches) {
+  TimePoint tp;
+  if (session_profiler_.IsEnabled()) {
+    tp = session_profiler_.StartTime();
+  }
+
+#ifdef ONNXRUNTIME_ENABLE_INSTRUMENT
+  TraceLoggingActivity<telemetry_provider_handle> ortrun_activity;
+  ortrun_activity.SetRelatedActivity(session_activity);
+  TraceLoggingWriteStart(ortrun_activity, "OrtRun");
+#endif
+  Status retval = Status::OK();
+  const Env& env = Env::Default();
+
+  // resolve the optional run timeout into a deadline up front so that validation and device
+  // copies count against it too
+  auto deadline = std::chrono::steady_clock::time_point::max();
+  if (run_options.timeout_in_ms > 0) {
+    deadline = std::chrono::steady_clock::now() + std::chrono::milliseconds(run_options.timeout_in_ms);
+  }
+
+  // run trace span covering the whole call; the feed copy / execute / fetch copy sub-spans are
+  // emitted from utils::ExecuteGraph through the context
+  const bool run_trace_enabled = static_cast<bool>(run_trace_callback_);
+  RunTraceContext run_trace_context;
+  std::chrono::steady_clock::time_point run_span_start;
+  if (run_trace_enabled) {
+    run_trace_context.callback = &run_trace_callback_;
+    run_trace_context.run_tag = &run_options.run_tag;
+    run_span_start = std::chrono::steady_clock::now();
+  }
+
+  std::vector<IExecutionProvider*> exec_providers_to_stop;
+  exec_providers_to_stop.reserve(execution_providers_.NumProviders());
+
+  // look for a provider with graph capturing mode enabled (e.g. CUDA graph):
+  // once such a provider has captured a graph, replaying it is preferred over
+  // launching the kernels one by one
+  IExecutionProvider* graph_replay_provider = nullptr;
+  for (auto& xp : execution_providers_) {
+    if (xp->IsGraphCaptureEnabled()) {
+      graph_replay_provider = xp.get();
+      break;
+    }
+  }
+  const bool graph_captured_before_run =
+      graph_replay_provider != nullptr && graph_replay_provider->IsGraphCaptured();
+
+  ORT_TRY {
+    // log evaluation start to trace logging provider
+    env.GetTelemetryProvider().LogEvaluationStart();
+
     if (!run_options.run_tag.empty()) {
       LOGS(*session_logger_, INFO) << "Running with tag: " << run_options.run_tag;
     }
@@ -1569,10 +2392,18 @@ Status InferenceSession::Run(const RunOptions& run_options,
     }
 #endif
 
-    // execute the graph
-    ORT_CHECK_AND_SET_RETVAL(utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
-                                                 session_options_.execution_mode, run_options.terminate, run_logger,
-                                                 run_options.only_execute_path_to_fetches));
+    if (graph_captured_before_run) {
+      // the feeds must occupy the same device buffers as the run that was
+      // captured, so bind the inputs/outputs to fixed device memory when
+      // enabling graph capture
+      ORT_CHECK_AND_SET_RETVAL(graph_replay_provider->ReplayGraph());
+    } else {
+      // execute the graph
+      ORT_CHECK_AND_SET_RETVAL(utils::ExecuteGraph(*session_state_, feeds_fetches_manager, feeds, *p_fetches,
+                                                   session_options_.execution_mode, run_options.terminate, run_logger,
+                                                   run_options.only_execute_path_to_fetches, deadline,
+                                                   run_trace_enabled ? &run_trace_context : nullptr));
+    }
   }
   ORT_CATCH(const std::exception& e) {
     ORT_HANDLE_EXCEPTION([&]() {
@@ -1589,6 +2420,14 @@ Status InferenceSession::Run(const RunOptions& run_options,
     ORT_CHECK_AND_SET_RETVAL(status);
   }
 
+  // the graph is captured in OnRunEnd(), and a capturing run only records the
+  // kernel launches without executing them, so replay the freshly captured
+  // graph once to populate this run's fetches
+  if (retval.IsOK() && !graph_captured_before_run &&
+      graph_replay_provider != nullptr && graph_replay_provider->IsGraphCaptured()) {
+    ORT_CHECK_AND_SET_RETVAL(graph_replay_provider->ReplayGraph());
+  }
+
   --current_num_runs_;
 
   // keep track of telemetry
@@ -1609,6 +2448,10 @@ Status InferenceSession::Run(const RunOptions& run_options,
   // log evaluation stop to trace logging provider
   env.GetTelemetryProvider().LogEvaluationStop();
 
+  if (run_trace_enabled) {
+    run_trace_context.Emit(RunTraceSpanKind::kRun, run_span_start, std::chrono::steady_clock::now());
+  }
+
   // send out profiling events (optional)
   if (session_profiler_.IsEnabled()) {
     session_profiler_.EndTimeAndRecordEvent(profiling::SESSION_EVENT, "model_run", tp);
@@ -1619,6 +2462,131 @@ Status InferenceSession::Run(const RunOptions& run_options,
   return retval;
 }
 
+common::Status InferenceSession::RunAsync(const RunOptions& run_options,
+                                          const std::vector<std::string>& feed_names,
+                                          const std::vector<OrtValue>& feeds,
+                                          const std::vector<std::string>& output_names,
+                                          RunAsyncCallback callback) {
+  if (!callback) {
+    return common::Status(common::ONNXRUNTIME, common::INVALID_ARGUMENT, "RunAsync requires a callback.");
+  }
+
+  auto* tp = GetInterOpThreadPoolToUse();
+  if (tp == nullptr || concurrency::ThreadPool::DegreeOfParallelism(tp) < 2) {
+    return common::Status(common::ONNXRUNTIME, common::FAIL,
+                          "RunAsync requires an inter-op thread pool with more than one thread. "
+                          "Configure per-session threads or global thread pools accordingly.");
+  }
+
+  // copy the feeds and names so the caller's vectors need not outlive the run
+  concurrency::ThreadPool::Schedule(
+      tp, [this, run_options, feed_names, feeds, output_names, callback = std::move(callback)]() {
+        std::vector<OrtValue> fetches;
+        auto status = Run(run_options, feed_names, feeds, output_names, &fetches, nullptr);
+        callback(std::move(status), std::move(fetches));
+      });
+
+  return common::Status::OK();
+}
+
+common::Status InferenceSession::PrepareRun(const std::vector<std::string>& feed_names,
+                                            const std::vector<std::string>& output_names,
+                                            std::unique_ptr<PreparedRun>& prepared) {
+  prepared.reset();
+
+  if (!is_inited_) {
+    LOGS(*session_logger_, ERROR) << "Session was not initialized";
+    return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+  }
+
+  // validate the names up front so Run with the prepared object only has to check the values
+  std::vector<OrtValue> no_fetches;
+  ORT_RETURN_IF_ERROR_SESSIONID_(ValidateOutputs(output_names, &no_fetches));
+
+  auto result = onnxruntime::make_unique<PreparedRun>();
+  result->feed_names = feed_names;
+  result->output_names = output_names;
+  result->feed_types.reserve(feed_names.size());
+  result->feed_shapes.reserve(feed_names.size());
+
+  for (const auto& feed_name : feed_names) {
+    auto iter = input_def_map_.find(feed_name);
+    if (input_def_map_.end() == iter) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Invalid Feed Input Name:", feed_name);
+    }
+
+    result->feed_types.push_back(iter->second.ml_data_type);
+    result->feed_shapes.push_back(iter->second.tensor_shape);
+  }
+
+  Status retval = Status::OK();
+
+  ORT_TRY {
+    FeedsFetchesInfo info(feed_names, output_names, session_state_->GetOrtValueNameIdxMap());
+    result->feeds_fetches_manager = onnxruntime::make_unique<FeedsFetchesManager>(std::move(info));
+  }
+  ORT_CATCH(const std::exception& e) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      retval = Status(common::ONNXRUNTIME, common::FAIL, e.what());
+    });
+  }
+
+  if (retval.IsOK()) {
+    prepared = std::move(result);
+  }
+
+  return retval;
+}
+
+common::Status InferenceSession::Run(const RunOptions& run_options, PreparedRun& prepared,
+                                     const std::vector<OrtValue>& feeds, std::vector<OrtValue>* p_fetches) {
+  Status retval = Status::OK();
+
+  ORT_TRY {
+    if (!is_inited_) {
+      LOGS(*session_logger_, ERROR) << "Session was not initialized";
+      return Status(common::ONNXRUNTIME, common::FAIL, "Session not initialized.");
+    }
+
+    if (!prepared.feeds_fetches_manager) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "PreparedRun instance was not created by PrepareRun.");
+    }
+
+    if (feeds.size() != prepared.feed_names.size()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Got ", feeds.size(), " feeds but PreparedRun expects ", prepared.feed_names.size());
+    }
+
+    if (!p_fetches) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT, "Output vector pointer is NULL");
+    }
+
+    if (!p_fetches->empty() && p_fetches->size() != prepared.output_names.size()) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, INVALID_ARGUMENT,
+                             "Output vector incorrectly sized: output_names.size(): ", prepared.output_names.size(),
+                             "p_fetches->size(): ", p_fetches->size());
+    }
+
+    // the names were resolved by PrepareRun; only the values need checking here
+    for (size_t i = 0, end = feeds.size(); i < end; ++i) {
+      ORT_RETURN_IF_ERROR_SESSIONID_(ValidateFeedValue(prepared.feed_names[i], prepared.feed_types[i],
+                                                       prepared.feed_shapes[i], feeds[i]));
+    }
+
+    retval = RunWithFeedsFetchesManager(run_options, *prepared.feeds_fetches_manager, feeds, p_fetches);
+  }
+  ORT_CATCH(const std::exception& e) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      retval = Status(common::ONNXRUNTIME, common::FAIL, e.what());
+    });
+  }
+  ORT_CATCH(...) {
+    retval = Status(common::ONNXRUNTIME, common::RUNTIME_EXCEPTION, "Encountered unknown exception in Run()");
+  }
+
+  return retval;
+}
+
 common::Status InferenceSession::Run(const NameMLValMap& feeds, const std::vector<std::string>& output_names,
                                      std::vector<OrtValue>* p_fetches) {
   return Run(RunOptions(), feeds, output_names, p_fetches);
@@ -1755,6 +2723,41 @@ const profiling::Profiler& InferenceSession::GetProfiling() const {
   return session_profiler_;
 }
 
+common::Status InferenceSession::RegisterRunTraceCallback(RunTraceCallback callback) {
+  if (current_num_runs_.load() > 0) {
+    return common::Status(common::ONNXRUNTIME, common::FAIL,
+                          "RegisterRunTraceCallback must not be called while Run calls are in flight.");
+  }
+
+  run_trace_callback_ = std::move(callback);
+  return Status::OK();
+}
+
+common::Status InferenceSession::GetNodeTimingStats(std::string& report) const {
+  {
+    std::lock_guard<onnxruntime::OrtMutex> l(session_mutex_);
+    if (!is_inited_) {
+      return common::Status(common::ONNXRUNTIME, common::FAIL, "Session was not initialized");
+    }
+  }
+
+  if (!session_state_->NodeTimingSamplingEnabled()) {
+    return common::Status(common::ONNXRUNTIME, common::FAIL,
+                          "Node timing sampling is not enabled. Set the session config entry '" +
+                              std::string(kOrtSessionOptionsNodeTimingSampleInterval) + "' to enable it.");
+  }
+
+  std::ostringstream oss;
+  oss << "node_name,op_type,provider,sampled_runs,cumulative_ns\n";
+  for (const auto& stat : session_state_->GetNodeTimingStats()) {
+    oss << stat.node_name << "," << stat.op_type << "," << stat.provider << ","
+        << stat.sampled_runs << "," << stat.cumulative_ns << "\n";
+  }
+
+  report = oss.str();
+  return Status::OK();
+}
+
 AllocatorPtr InferenceSession::GetAllocator(const OrtMemoryInfo& mem_info) const {
   return session_state_->GetAllocator(mem_info);
 }
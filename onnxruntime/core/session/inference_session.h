@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <functional>
 #include <string>
 #include <unordered_map>
 
@@ -14,6 +15,7 @@
 #include "core/framework/framework_common.h"
 #include "core/framework/iexecutor.h"
 #include "core/framework/kernel_registry_manager.h"
+#include "core/framework/run_trace.h"
 #include "core/framework/session_state.h"
 #include "core/graph/basic_types.h"
 #include "core/optimizer/graph_transformer_level.h"
@@ -21,6 +23,7 @@
 #include "core/optimizer/insert_cast_transformer.h"
 #include "core/framework/session_options.h"
 #include "core/framework/allocatormgr.h"
+#include "core/platform/env.h"
 #ifdef ENABLE_LANGUAGE_INTEROP_OPS
 #include "core/language_interop_ops/language_interop_ops.h"
 #endif
@@ -260,11 +263,127 @@ class InferenceSession {
     */
   common::Status Initialize() ORT_MUST_USE_RESULT;
 
+#if !defined(ORT_MINIMAL_BUILD)
+  /**
+    * Replaces the weights of the loaded and initialized model with those of a retrained copy of
+    * the same model, without rebuilding the session. The new model must have the same graph
+    * structure as the one this session was created from (validated via a structural hash that
+    * ignores initializer payloads); its initializer contents are then copied into the existing
+    * weight buffers in place - so memory stays flat - and OpKernel::PrePack is re-run for kernels
+    * that packed the old weights.
+    * All new values are validated and staged in scratch buffers before any live buffer is
+    * written, so a failure leaves the session on the weight set it had before the call.
+    * Limitations: only CPU-resident, non-string initializers of the main graph can be refreshed;
+    * an error is returned if a weight was folded away by a graph transform (e.g. constant
+    * folding) or lives in a subgraph, since it cannot be swapped consistently.
+    * Must not be called concurrently with Run: callers must drain in-flight runs first, and the
+    * call fails if any are detected.
+    * @param model_uri path to the retrained model file.
+    * @return OK if all weights were refreshed.
+    */
+  common::Status RefreshModelWeights(const std::string& model_uri) ORT_MUST_USE_RESULT;
+#ifdef _WIN32
+  common::Status RefreshModelWeights(const std::wstring& model_uri) ORT_MUST_USE_RESULT;
+#endif
+#endif  // !defined(ORT_MINIMAL_BUILD)
+
+  /**
+    * Creates a new session that shares this session's immutable initialized state - the loaded and
+    * optimized model, and the SessionState holding the kernels, initialized tensors and execution
+    * plan - instead of repeating load, optimization and kernel creation. Only per-session mutable
+    * state (logger, profiler, session id) is created fresh, so cloning is cheap and the clone adds
+    * almost no memory.
+    * Can only be called on an initialized session. The cloned session is immediately usable for
+    * Run and must not outlive this session: the shared state references this session's execution
+    * providers and thread pools.
+    * @return OK if success
+    */
+  common::Status Clone(std::unique_ptr<InferenceSession>& cloned_session) ORT_MUST_USE_RESULT;
+
+  /**
+    * Asks the arena based allocators of all registered execution providers to release memory they
+    * are holding but no longer using. Useful in long-running services to drop memory grown while
+    * serving a large request. Safe to call concurrently with Run, which may re-grow the arenas.
+    * @return OK if success
+    */
+  common::Status ShrinkMemoryArenas() ORT_MUST_USE_RESULT;
+
+  /**
+    * Runs the model once per provided shape set with zero-filled CPU input tensors, exercising
+    * the full Run pipeline to pay lazy initialization costs up front: memory pattern creation
+    * for each shape bucket, first-touch paging of weights, and execution provider caches keyed
+    * on input shapes. A serving frontend can route traffic to the session only once warmup has
+    * succeeded instead of priming it with fake requests.
+    * Each shape set maps input names to concrete shapes. Inputs missing from a set use the
+    * shape from the model, which must then be fully defined; overridable initializers missing
+    * from a set keep their stored value. An empty vector runs a single warmup with just the
+    * model's shapes. Only tensor inputs are supported.
+    * Can only be called on an initialized session.
+    * @return OK if every warmup run succeeded.
+    */
+  common::Status Warmup(const std::vector<std::unordered_map<std::string, TensorShape>>& input_shape_sets)
+      ORT_MUST_USE_RESULT;
+
+  /**
+    * @return true once a Warmup call has completed successfully.
+    */
+  bool IsWarmedUp() const;
+
   common::Status Run(const RunOptions& run_options, const std::vector<std::string>& feed_names,
                      const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
                      std::vector<OrtValue>* p_fetches,
                      const std::vector<OrtDevice>* p_fetches_device_info = nullptr) ORT_MUST_USE_RESULT;
 
+  /**
+    * Callback invoked when an asynchronous Run completes. Receives the final status of the run
+    * and the fetched outputs (empty if the run failed). Invoked from an inter-op pool thread.
+    */
+  using RunAsyncCallback = std::function<void(common::Status status, std::vector<OrtValue> fetches)>;
+
+  /**
+    * Run a pre-loaded and pre-initialized model asynchronously. The run is enqueued onto the
+    * inter-op thread pool and the callback is invoked when it completes, so callers do not need
+    * to dedicate a thread per in-flight request. The feed and output name vectors are copied and
+    * need not outlive the call. Requires an inter-op thread pool, i.e. per-session threads or
+    * global thread pools configured with more than one inter-op thread.
+    * @return OK if the run was enqueued; the run's own status is reported through the callback.
+    */
+  common::Status RunAsync(const RunOptions& run_options, const std::vector<std::string>& feed_names,
+                          const std::vector<OrtValue>& feeds, const std::vector<std::string>& output_names,
+                          RunAsyncCallback callback) ORT_MUST_USE_RESULT;
+
+  /**
+    * State for repeated Run calls that use the same feed and output names. Created once by
+    * PrepareRun; carries the validated names, the expected feed types/shapes and the resolved
+    * FeedsFetchesManager so steady-state Run calls do no name hashing or string compares.
+    * A PreparedRun belongs to the session that created it, must not outlive it, and must not
+    * be used by concurrent Run calls.
+    */
+  struct PreparedRun {
+    std::vector<std::string> feed_names;
+    std::vector<std::string> output_names;
+    // expected type and (possibly partial) shape per feed, in feed_names order
+    std::vector<MLDataType> feed_types;
+    std::vector<TensorShape> feed_shapes;
+    std::unique_ptr<FeedsFetchesManager> feeds_fetches_manager;
+  };
+
+  /**
+    * Resolve feed and output names once for reuse across Run calls.
+    * Can only be called on an initialized session.
+    * @return OK if all names are valid for the loaded model.
+    */
+  common::Status PrepareRun(const std::vector<std::string>& feed_names,
+                            const std::vector<std::string>& output_names,
+                            std::unique_ptr<PreparedRun>& prepared) ORT_MUST_USE_RESULT;
+
+  /**
+    * Run with the bindings resolved by PrepareRun. Feed values are validated positionally
+    * against the prepared metadata; no per-call name lookups are performed.
+    */
+  common::Status Run(const RunOptions& run_options, PreparedRun& prepared, const std::vector<OrtValue>& feeds,
+                     std::vector<OrtValue>* p_fetches) ORT_MUST_USE_RESULT;
+
   /**
     * Run a pre-loaded and pre-intialized model.
     * Multiple threads are allowed to run this function; hence its thread-safe.
@@ -380,6 +499,26 @@ class InferenceSession {
     */
   const profiling::Profiler& GetProfiling() const;
 
+  /**
+    * Register a callback that receives run lifecycle spans (whole run, feed copy, execute,
+    * fetch copy) with timestamps and byte counts, e.g. to attach them to a distributed tracing
+    * system. The callback is invoked synchronously on the thread completing the span and must be
+    * thread safe. Pass nullptr to unregister. When no callback is registered the run path only
+    * pays for a null check.
+    * @param callback the callback to register, or nullptr to unregister.
+    * @return OK if successful; fails if Run calls are in flight.
+    */
+  common::Status RegisterRunTraceCallback(RunTraceCallback callback);
+
+  /**
+    * Get the sampled per-node timing counters as a CSV report with one row per node
+    * (node_name,op_type,provider,sampled_runs,cumulative_ns). Requires the session config entry
+    * "session.node_timing_sample_interval" to have been set to a value >= 1 before Initialize.
+    * @param report filled with the CSV report.
+    * @return OK if successful.
+    */
+  common::Status GetNodeTimingStats(std::string& report) const;
+
   /**
     * Search registered execution providers for an allocator that has characteristics
     * specified within mem_info
@@ -469,6 +608,9 @@ class InferenceSession {
   template <typename T>
   common::Status Load(const std::basic_string<T>& model_uri) ORT_MUST_USE_RESULT;
 
+  template <typename T>
+  common::Status RefreshModelWeightsImpl(const std::basic_string<T>& model_uri) ORT_MUST_USE_RESULT;
+
   bool HasLocalSchema() const {
     return !custom_schema_registries_.empty();
   }
@@ -499,6 +641,26 @@ class InferenceSession {
 
   common::Status LoadOrtModel(std::function<Status()> load_ort_format_model_bytes) ORT_MUST_USE_RESULT;
 
+  // Verifies ort_format_model_bytes_ and replaces model_ with the model they contain.
+  common::Status ParseOrtModelBytes() ORT_MUST_USE_RESULT;
+
+#if !defined(ORT_MINIMAL_BUILD)
+  /**
+    * Returns the optimized model cache file path for the given model, or an empty string when the
+    * cache is disabled. The path is keyed on the model file path and contents, the registered
+    * execution providers, the optimization level and the ORT version, so it must not be computed
+    * before every execution provider is registered.
+    */
+  std::basic_string<ORTCHAR_T> GetOptimizedModelCachePath(const std::basic_string<ORTCHAR_T>& model_uri) const;
+
+  /**
+    * Replaces the loaded model with a cached optimized graph when a matching cache entry exists,
+    * otherwise arranges for Initialize to write one. Called from Initialize once all execution
+    * providers are registered (the cache key depends on them); expects session_mutex_ to be held.
+    */
+  common::Status TryLoadCachedOptimizedModel() ORT_MUST_USE_RESULT;
+#endif
+
 #endif  // defined(ENABLE_ORT_FORMAT_LOAD)
 
   // Create a Logger for a single execution if possible. Otherwise use the default logger.
@@ -517,9 +679,21 @@ class InferenceSession {
   common::Status ValidateInputs(const std::vector<std::string>& feed_names,
                                 const std::vector<OrtValue>& feeds) const ORT_MUST_USE_RESULT;
 
+  // validate a single feed value against the expected type and shape from the model inputs
+  common::Status ValidateFeedValue(const std::string& feed_name, MLDataType expected_type,
+                                   const TensorShape& expected_shape,
+                                   const OrtValue& input_ml_value) const ORT_MUST_USE_RESULT;
+
   common::Status ValidateOutputs(const std::vector<std::string>& output_names,
                                  const std::vector<OrtValue>* p_fetches) const ORT_MUST_USE_RESULT;
 
+  // execute the graph for a Run call once the feeds, fetches and names have been validated and
+  // resolved into the FeedsFetchesManager
+  common::Status RunWithFeedsFetchesManager(const RunOptions& run_options,
+                                            FeedsFetchesManager& feeds_fetches_manager,
+                                            const std::vector<OrtValue>& feeds,
+                                            std::vector<OrtValue>* p_fetches) ORT_MUST_USE_RESULT;
+
   common::Status WaitForNotification(Notification* p_executor_done, int64_t timeout_in_ms) ORT_MUST_USE_RESULT;
 
   template <typename T>
@@ -566,9 +740,9 @@ class InferenceSession {
   // Profiler for this session.
   profiling::Profiler session_profiler_;
 
-  // Immutable state for each op in the model. Shared by all executors.
-  // It has a dependency on execution_providers_.
-  std::unique_ptr<SessionState> session_state_;
+  // Immutable state for each op in the model. Shared by all executors, and with any sessions
+  // created via Clone. It has a dependency on execution_providers_.
+  std::shared_ptr<SessionState> session_state_;
 
   // Threadpools per session. These are initialized and used for the entire duration of the session
   // when use_per_session_threads is true.
@@ -619,10 +793,21 @@ class InferenceSession {
   // Number of concurrently running executors
   std::atomic<int> current_num_runs_;
 
+  // run lifecycle trace callback; empty unless registered via RegisterRunTraceCallback
+  RunTraceCallback run_trace_callback_;
+
+  // set once a Warmup call has completed successfully
+  std::atomic<bool> warmed_up_{false};
+
   mutable onnxruntime::OrtMutex session_mutex_;  // to ensure only one thread can invoke Load/Initialize
   bool is_model_loaded_ = false;                 // GUARDED_BY(session_mutex_)
   bool is_inited_ = false;                       // GUARDED_BY(session_mutex_)
 
+  // structural hash of the loaded model's graph, ignoring initializer payloads. computed at load
+  // time and used by RefreshModelWeights to validate that a retrained model matches. 0 when no
+  // ONNX model has been loaded (e.g. ORT format models, which don't support weight refresh).
+  uint64_t model_structure_hash_ = 0;  // GUARDED_BY(session_mutex_)
+
 #ifdef ENABLE_LANGUAGE_INTEROP_OPS
   InterOpDomains interop_domains_;
 #endif
@@ -656,10 +841,26 @@ class InferenceSession {
   // Bytes from an ORT format model.
   // We store them currently to make the Load + Initialize behave the same way as for an ONNX model
   // as we need some of the bytes for the Load (create the Model) and some for the Initialize (create SessionState).
-  // Short term we free them after Initialize.
-  // Longer term we may want to directly refer to offsets in this buffer for initializers so we don't need to copy
-  // those into new OrtValue instances, at which point we won't free them until the InferenceSession goes away.
-  std::vector<uint8_t> ort_format_model_bytes_;
+  // By default we free them after Initialize; when initializers refer to the buffer in place
+  // (see using_ort_model_bytes_for_initializers_ below) they stay alive until the
+  // InferenceSession goes away.
+  // The flatbuffers data is accessed in place, so this is a view. The bytes are backed by (in order of preference)
+  // a memory mapping of the model file, storage read from disk or copied from the caller, or (opt-in via
+  // session config) the caller's own buffer.
+  gsl::span<const uint8_t> ort_format_model_bytes_;
+  Env::MappedMemoryPtr ort_format_model_mapped_memory_{};
+  std::vector<uint8_t> ort_format_model_bytes_data_holder_;
+
+  // set when initializers reference the ORT format model bytes in place (see
+  // kOrtSessionOptionsUseOrtModelBytesForInitializers); the bytes are then kept alive for the
+  // session's lifetime instead of being released after Initialize.
+  bool using_ort_model_bytes_for_initializers_ = false;
+
+#if defined(ENABLE_ORT_FORMAT_LOAD) && !defined(ORT_MINIMAL_BUILD)
+  // set when Initialize will populate an optimized model cache entry. the entry is written to a
+  // temporary file and renamed into place so concurrent cold starts never observe a partial write.
+  std::basic_string<ORTCHAR_T> optimized_model_cache_path_;
+#endif
 
   std::shared_ptr<onnxruntime::AllocatorManager> allocator_manager_;
 };
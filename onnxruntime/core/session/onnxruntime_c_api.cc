@@ -53,6 +53,13 @@ using onnxruntime::common::Status;
 
 using namespace onnxruntime;
 
+// Pool of OrtValue tensor wrappers for re-use across requests. Only the wrapper objects are
+// pooled; the tensor data buffers they reference are always owned elsewhere.
+struct OrtValuePool {
+  onnxruntime::OrtMutex mutex;
+  std::vector<std::unique_ptr<OrtValue>> free_values;
+};
+
 #ifndef ORT_STATUS_PTR
 #ifdef _WIN32
 #define ORT_STATUS_PTR _Check_return_ _Ret_maybenull_ OrtStatusPtr
@@ -597,6 +604,69 @@ ORT_API_STATUS_IMPL(OrtApis::Run, _Inout_ OrtSession* sess, _In_opt_ const OrtRu
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::RunAsync, _Inout_ OrtSession* sess, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names1, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  const int queue_id = 0;
+
+  if (run_async_callback == nullptr) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "run_async_callback cannot be null");
+  }
+
+  std::vector<std::string> feed_names(input_len);
+  std::vector<OrtValue> feeds(input_len);
+
+  for (size_t i = 0; i != input_len; ++i) {
+    if (input_names[i] == nullptr || input_names[i][0] == '\0') {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "input name cannot be empty");
+    }
+
+    feed_names[i] = input_names[i];
+    auto& ort_value = feeds[i] = *reinterpret_cast<const ::OrtValue*>(input[i]);
+
+    if (ort_value.Fence()) ort_value.Fence()->BeforeUsingAsInput(onnxruntime::kCpuExecutionProvider, queue_id);
+  }
+
+  std::vector<std::string> output_names(output_names_len);
+  for (size_t i = 0; i != output_names_len; ++i) {
+    if (output_names1[i] == nullptr || output_names1[i][0] == '\0') {
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "output name cannot be empty");
+    }
+    output_names[i] = output_names1[i];
+  }
+
+  auto status = session->RunAsync(
+      run_options != nullptr ? *run_options : OrtRunOptions(), feed_names, feeds, output_names,
+      [output, output_names_len, run_async_callback, user_data](onnxruntime::common::Status status,
+                                                                std::vector<OrtValue> fetches) {
+        if (!status.IsOK()) {
+          run_async_callback(user_data, output, 0, ToOrtStatus(status));
+          return;
+        }
+
+        for (size_t i = 0; i != output_names_len; ++i) {
+          ::OrtValue& value = fetches[i];
+          if (value.Fence())
+            value.Fence()->BeforeUsingAsInput(onnxruntime::kCpuExecutionProvider, 0);
+          if (output[i] == nullptr) {
+            output[i] = new OrtValue(std::move(value));
+          } else {
+            *output[i] = std::move(value);
+          }
+        }
+
+        run_async_callback(user_data, output, output_names_len, nullptr);
+      });
+
+  return ToOrtStatus(status);
+  API_IMPL_END
+}
+
 struct OrtIoBinding {
   std::unique_ptr<::onnxruntime::IOBinding> binding_;
   explicit OrtIoBinding(std::unique_ptr<::onnxruntime::IOBinding>&& binding) : binding_(std::move(binding)) {}
@@ -978,6 +1048,19 @@ ORT_API_STATUS_IMPL(OrtApis::SessionEndProfiling, _In_ OrtSession* sess, _Inout_
   API_IMPL_END
 }
 
+ORT_API_STATUS_IMPL(OrtApis::SessionGetNodeTimingStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<const ::onnxruntime::InferenceSession*>(sess);
+  std::string report;
+  auto status = session->GetNodeTimingStats(report);
+  if (!status.IsOK())
+    return ToOrtStatus(status);
+  *out = StrDup(report, allocator);
+  return nullptr;
+  API_IMPL_END
+}
+
 ORT_API_STATUS_IMPL(OrtApis::SessionGetModelMetadata, _In_ const OrtSession* sess,
                     _Outptr_ OrtModelMetadata** out) {
   API_IMPL_BEGIN
@@ -2109,12 +2192,113 @@ static constexpr OrtApi ort_api_1_to_7 = {
     &OrtApis::SetCurrentGpuDeviceId,
     &OrtApis::GetCurrentGpuDeviceId,
     // End of Version 7 - DO NOT MODIFY ABOVE (see above text for more information)
+
+    &OrtApis::ShrinkSessionMemoryArenas,
+    &OrtApis::RunAsync,
+    &OrtApis::CreateValuePool,
+    &OrtApis::CreateTensorWithDataAsPooledOrtValue,
+    &OrtApis::ReleaseValueToPool,
+    &OrtApis::ReleaseValuePool,
+    &OrtApis::RunOptionsSetTimeout,
+    &OrtApis::SessionGetNodeTimingStats,
 };
 
 // Assert to do a limited check to ensure Version 1 of OrtApi never changes (will detect an addition or deletion but not if they cancel out each other)
 // If this assert hits, read the above 'Rules on how to add a new Ort API version'
 static_assert(offsetof(OrtApi, ReleaseCustomOpDomain) / sizeof(void*) == 101, "Size of version 1 API cannot change");
 
+ORT_API_STATUS_IMPL(OrtApis::ShrinkSessionMemoryArenas, _Inout_ OrtSession* sess) {
+  API_IMPL_BEGIN
+  auto session = reinterpret_cast<::onnxruntime::InferenceSession*>(sess);
+  auto status = session->ShrinkMemoryArenas();
+  if (!status.IsOK()) {
+    return ToOrtStatus(status);
+  }
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateValuePool, _Outptr_ OrtValuePool** out) {
+  API_IMPL_BEGIN
+  *out = new OrtValuePool();
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::CreateTensorWithDataAsPooledOrtValue, _Inout_ OrtValuePool* pool,
+                    _In_ const OrtMemoryInfo* info, _Inout_ void* p_data, size_t p_data_len,
+                    _In_ const int64_t* shape, size_t shape_len, ONNXTensorElementDataType type,
+                    _Outptr_ OrtValue** out) {
+  API_IMPL_BEGIN
+  // throws for enum values that don't map to a tensor element type
+  MLDataType ml_type = DataTypeImpl::TensorTypeFromONNXEnum(static_cast<int>(type))->GetElementType();
+
+  size_t elem_count = 1;
+  std::vector<int64_t> shapes(shape_len);
+  for (size_t i = 0; i != shape_len; ++i) {
+    if (shape[i] < 0)
+      return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "tried creating tensor with negative value in shape");
+    elem_count *= static_cast<size_t>(shape[i]);
+    shapes[i] = shape[i];
+  }
+
+  size_t size_to_allocate;
+  if (!IAllocator::CalcMemSizeForArray(ml_type->Size(), elem_count, &size_to_allocate)) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "size overflow");
+  }
+  if (size_to_allocate > p_data_len) {
+    std::ostringstream oss;
+    oss << "not enough space: expected " << size_to_allocate << ", got " << p_data_len;
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, oss.str().c_str());
+  }
+
+  std::unique_ptr<OrtValue> value;
+  {
+    std::lock_guard<OrtMutex> lock(pool->mutex);
+    if (!pool->free_values.empty()) {
+      value = std::move(pool->free_values.back());
+      pool->free_values.pop_back();
+    }
+  }
+
+  if (value != nullptr) {
+    // re-use both the OrtValue and the Tensor object it holds; the previous tensor contents
+    // (and any buffer it referenced) are released by the move assignment
+    *value->GetMutable<Tensor>() = Tensor(ml_type, onnxruntime::TensorShape(shapes), p_data, *info);
+  } else {
+    auto tensor = onnxruntime::make_unique<Tensor>(ml_type, onnxruntime::TensorShape(shapes), p_data, *info);
+    value = onnxruntime::make_unique<OrtValue>();
+    auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+    value->Init(tensor.release(),
+                ml_tensor,
+                ml_tensor->GetDeleteFunc());
+  }
+
+  *out = value.release();
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API_STATUS_IMPL(OrtApis::ReleaseValueToPool, _Inout_ OrtValuePool* pool, _In_ OrtValue* value) {
+  API_IMPL_BEGIN
+  if (value == nullptr) {
+    return nullptr;
+  }
+
+  if (!value->IsTensor()) {
+    return OrtApis::CreateStatus(ORT_INVALID_ARGUMENT, "only tensor OrtValues can be pooled");
+  }
+
+  std::lock_guard<OrtMutex> lock(pool->mutex);
+  pool->free_values.emplace_back(value);
+  return nullptr;
+  API_IMPL_END
+}
+
+ORT_API(void, OrtApis::ReleaseValuePool, _Frees_ptr_opt_ OrtValuePool* ptr) {
+  delete ptr;
+}
+
 ORT_API(const OrtApi*, OrtApis::GetApi, uint32_t version) {
   if (version >= 1 && version <= ORT_API_VERSION)
     return &ort_api_1_to_7;
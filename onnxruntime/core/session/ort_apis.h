@@ -259,4 +259,25 @@ ORT_API_STATUS_IMPL(SessionOptionsAppendExecutionProvider_TensorRT,
                     _In_ OrtSessionOptions* options, _In_ const OrtTensorRTProviderOptions* tensorrt_options);
 ORT_API_STATUS_IMPL(SetCurrentGpuDeviceId, _In_ int device_id);
 ORT_API_STATUS_IMPL(GetCurrentGpuDeviceId, _In_ int* device_id);
+
+ORT_API_STATUS_IMPL(ShrinkSessionMemoryArenas, _Inout_ OrtSession* session);
+ORT_API_STATUS_IMPL(RunAsync, _Inout_ OrtSession* session, _In_opt_ const OrtRunOptions* run_options,
+                    _In_reads_(input_len) const char* const* input_names,
+                    _In_reads_(input_len) const OrtValue* const* input, size_t input_len,
+                    _In_reads_(output_names_len) const char* const* output_names, size_t output_names_len,
+                    _Inout_updates_all_(output_names_len) OrtValue** output,
+                    _In_ RunAsyncCallbackFn run_async_callback, _In_opt_ void* user_data);
+
+ORT_API_STATUS_IMPL(CreateValuePool, _Outptr_ OrtValuePool** out);
+ORT_API_STATUS_IMPL(CreateTensorWithDataAsPooledOrtValue, _Inout_ OrtValuePool* pool,
+                    _In_ const OrtMemoryInfo* info, _Inout_ void* p_data, size_t p_data_len,
+                    _In_ const int64_t* shape, size_t shape_len, ONNXTensorElementDataType type,
+                    _Outptr_ OrtValue** out);
+ORT_API_STATUS_IMPL(ReleaseValueToPool, _Inout_ OrtValuePool* pool, _In_ OrtValue* value);
+ORT_API(void, ReleaseValuePool, _Frees_ptr_opt_ OrtValuePool*);
+
+ORT_API_STATUS_IMPL(RunOptionsSetTimeout, _Inout_ OrtRunOptions* options, int64_t timeout_in_ms);
+
+ORT_API_STATUS_IMPL(SessionGetNodeTimingStats, _In_ const OrtSession* sess, _Inout_ OrtAllocator* allocator,
+                    _Outptr_ char** out);
 }  // namespace OrtApis
@@ -31,10 +31,11 @@ template <typename QType,
           bool ReduceRange = false,
           bool Symmetric = false,
           typename std::enable_if<is_quant_type<QType>::value, int>::type = 0>
-void GetQuantizationParameter(const float* data, int64_t num_of_elements, float& scale, QType& zp) {
+void GetQuantizationParameter(const float* data, int64_t num_of_elements, float& scale, QType& zp,
+                              MLAS_THREADPOOL* thread_pool = nullptr) {
   // find input range min and max
   float min, max;
-  MlasFindMinMaxElement(data, &min, &max, num_of_elements);
+  MlasFindMinMaxElement(data, &min, &max, num_of_elements, thread_pool);
 
   // ensure the input range includes zero
   min = std::min(min, 0.0f);
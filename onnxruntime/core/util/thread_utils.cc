@@ -1,6 +1,8 @@
 #include "thread_utils.h"
 #include <algorithm>
 
+#include "core/common/cpuid_info.h"
+
 #include <core/common/make_unique.h>
 #ifdef _WIN32
 #include <Windows.h>
@@ -18,6 +20,41 @@ CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
   ThreadOptions to;
   if (options.affinity_vec_len != 0) {
     to.affinity.assign(options.affinity_vec, options.affinity_vec + options.affinity_vec_len);
+  } else if (options.numa_node < 0 &&
+             (options.prefer_performance_cores || options.prefer_efficiency_cores) &&
+             CPUIDInfo::GetCPUIDInfo().IsHybrid()) {
+    // pin the pool to one core class of a hybrid CPU. if the platform exposes no
+    // core-type information the request is ignored and the pool is created as usual.
+    std::vector<size_t> class_cpus = options.prefer_performance_cores
+                                         ? Env::Default().GetPerformanceCoreProcessors()
+                                         : Env::Default().GetEfficiencyCoreProcessors();
+    if (!class_cpus.empty()) {
+      if (options.thread_pool_size <= 0) {
+        to.affinity = class_cpus;
+        options.thread_pool_size = static_cast<int>(class_cpus.size());
+      } else {
+        to.affinity.resize(static_cast<size_t>(options.thread_pool_size));
+        for (size_t i = 0; i != to.affinity.size(); ++i) {
+          to.affinity[i] = class_cpus[i % class_cpus.size()];
+        }
+      }
+    }
+  } else if (options.numa_node >= 0) {
+    // pin the pool to the requested NUMA node. if the platform has no topology information the
+    // request is ignored and the pool is created as usual.
+    std::vector<size_t> node_cpus = Env::Default().GetNumaNodeProcessors(options.numa_node);
+    if (!node_cpus.empty()) {
+      if (options.thread_pool_size <= 0) {
+        to.affinity = node_cpus;
+        options.thread_pool_size = static_cast<int>(node_cpus.size());
+      } else {
+        // more threads requested than the node has processors: cycle over the node's processors
+        to.affinity.resize(static_cast<size_t>(options.thread_pool_size));
+        for (size_t i = 0; i != to.affinity.size(); ++i) {
+          to.affinity[i] = node_cpus[i % node_cpus.size()];
+        }
+      }
+    }
   }
   if (options.thread_pool_size <= 0) {  // default
     cpu_list = Env::Default().GetThreadAffinityMasks();
@@ -28,9 +65,14 @@ CreateThreadPoolHelper(Env* env, OrtThreadPoolParams options) {
       to.affinity = cpu_list;
   }
   to.set_denormal_as_zero = options.set_denormal_as_zero;
+  to.spin_loop_iterations = options.spin_loop_iterations;
 
-  return onnxruntime::make_unique<ThreadPool>(env, to, options.name, options.thread_pool_size,
-                                              options.allow_spinning);
+  auto tp = onnxruntime::make_unique<ThreadPool>(env, to, options.name, options.thread_pool_size,
+                                                 options.allow_spinning);
+  if (options.enable_loop_cost_calibration) {
+    tp->EnableCostCalibration();
+  }
+  return tp;
 }
 
 std::unique_ptr<ThreadPool>
@@ -24,10 +24,33 @@ struct OrtThreadPoolParams {
   //If the vector is empty, no explict affinity binding
   size_t* affinity_vec = nullptr;
   size_t affinity_vec_len = 0;
+
+  //If >= 0 and no explicit affinity vector is given, pin every thread in the pool to the
+  //processors of this NUMA node. With thread_pool_size = 0 the pool gets one thread per
+  //processor on the node. Ignored on platforms without NUMA topology information.
+  int numa_node = -1;
   const ORTCHAR_T* name = nullptr;
 
   // Set or unset denormal as zero
   bool set_denormal_as_zero = false;
+
+  //If true, the pool measures the real per-iteration cost of parallel loops during warmup and
+  //uses the measurements instead of the kernels' static cost guesses thereafter.
+  bool enable_loop_cost_calibration = false;
+
+  //Upper bound on the number of spin iterations a worker performs while waiting for work before
+  //blocking. Negative keeps the default; 0 disables spinning. See ThreadOptions.
+  int spin_loop_iterations = -1;
+
+  //If true and the CPU is hybrid, pin the pool to the performance (big) cores (when the
+  //platform exposes core-type information) so latency-sensitive work does not land on
+  //efficiency cores. An explicit affinity vector or NUMA node binding takes precedence.
+  bool prefer_performance_cores = false;
+
+  //If true and the CPU is hybrid, pin the pool to the efficiency (LITTLE) cores instead, for
+  //background work that should stay off the performance cores. Ignored when
+  //prefer_performance_cores is also set.
+  bool prefer_efficiency_cores = false;
 };
 
 struct OrtThreadingOptions {
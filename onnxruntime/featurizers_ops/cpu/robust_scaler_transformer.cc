@@ -5,6 +5,8 @@
 #include "core/framework/data_types.h"
 #include "core/framework/data_types_internal.h"
 #include "core/framework/op_kernel.h"
+#include "core/platform/ort_mutex.h"
+#include "core/platform/threadpool.h"
 
 #include "Featurizers/RobustScalerFeaturizer.h"
 #include "Featurizers/../Archive.h"
@@ -37,16 +39,31 @@ struct OutputTypeMapper<double> { using type = double; };
 
 template <typename InputT>
 struct RobustScalerTransformerImpl {
-  void operator()(OpKernelContext* ctx) const {
-    // Create the transformer
-    Microsoft::Featurizer::Featurizers::RobustScalerTransformer<InputT, typename OutputTypeMapper<InputT>::type> transformer(
-        [ctx](void) {
-          const auto* state_tensor(ctx->Input<Tensor>(0));
-          const uint8_t* const state_data(state_tensor->Data<uint8_t>());
+  void operator()(OpKernelContext* ctx, bool state_is_constant,
+                  std::shared_ptr<void>& cached_transformer, OrtMutex& cache_mutex) const {
+    using OutputT = typename OutputTypeMapper<InputT>::type;
+    using Transformer = Microsoft::Featurizer::Featurizers::RobustScalerTransformer<InputT, OutputT>;
 
-          Microsoft::Featurizer::Archive archive(state_data, state_tensor->Shape().Size());
-          return Microsoft::Featurizer::Featurizers::RobustScalerTransformer<InputT, typename OutputTypeMapper<InputT>::type>(archive);
-        }());
+    auto deserialize = [ctx](void) {
+      const auto* state_tensor(ctx->Input<Tensor>(0));
+      const uint8_t* const state_data(state_tensor->Data<uint8_t>());
+
+      Microsoft::Featurizer::Archive archive(state_data, state_tensor->Shape().Size());
+      return std::make_shared<Transformer>(archive);
+    };
+
+    // Create the transformer, deserializing the state only once per kernel instance
+    // when it comes from a constant initializer
+    std::shared_ptr<Transformer> transformer;
+    if (state_is_constant) {
+      std::lock_guard<OrtMutex> lock(cache_mutex);
+      if (!cached_transformer) {
+        cached_transformer = deserialize();
+      }
+      transformer = std::static_pointer_cast<Transformer>(cached_transformer);
+    } else {
+      transformer = deserialize();
+    }
 
     // Get the input
     const auto* input_tensor(ctx->Input<Tensor>(1));
@@ -54,29 +71,44 @@ struct RobustScalerTransformerImpl {
 
     // Prepare the output
     Tensor* output_tensor(ctx->Output(0, input_tensor->Shape()));
-    typename OutputTypeMapper<InputT>::type* output_data(output_tensor->MutableData<typename OutputTypeMapper<InputT>::type>());
+    OutputT* output_data(output_tensor->MutableData<OutputT>());
 
-    // Execute
+    // Execute. The scaling transform carries no per-row state, so rows can be
+    // partitioned across the intra-op pool against a shared transformer.
     const int64_t length(input_tensor->Shape().Size());
 
-    for (int64_t i = 0; i < length; ++i) {
-      output_data[i] = transformer.execute(input_data[i]);
-    }
+    concurrency::ThreadPool::TryParallelFor(
+        ctx->GetOperatorThreadPool(), static_cast<std::ptrdiff_t>(length),
+        {static_cast<float>(sizeof(InputT)), static_cast<float>(sizeof(OutputT)), 1.0f},
+        [transformer, input_data, output_data](std::ptrdiff_t first, std::ptrdiff_t last) {
+          for (std::ptrdiff_t i = first; i != last; ++i) {
+            output_data[i] = transformer->execute(input_data[i]);
+          }
+        });
   }
 };
 
 class RobustScalerTransformer final : public OpKernel {
  public:
   explicit RobustScalerTransformer(const OpKernelInfo& info) : OpKernel(info) {
+    const Tensor* state_tensor = nullptr;
+    state_is_constant_ = info.TryGetConstantInput(0, &state_tensor);
   }
 
   Status Compute(OpKernelContext* ctx) const override {
     utils::MLTypeCallDispatcher<int8_t, uint8_t, int16_t, uint16_t, int32_t, uint32_t,
                                 int64_t, uint64_t, float, double>
         t_disp(ctx->Input<Tensor>(1)->GetElementType());
-    t_disp.Invoke<RobustScalerTransformerImpl>(ctx);
+    t_disp.Invoke<RobustScalerTransformerImpl>(ctx, state_is_constant_, cached_transformer_, cache_mutex_);
     return Status::OK();
   }
+
+ private:
+  bool state_is_constant_;
+  // Transformer deserialized from the constant state initializer on first use;
+  // type-erased because the concrete transformer type depends on the input type
+  mutable std::shared_ptr<void> cached_transformer_;
+  mutable OrtMutex cache_mutex_;
 };
 
 ONNX_OPERATOR_KERNEL_EX(
@@ -22,6 +22,7 @@
 #include "core/framework/tensorprotoutils.h"
 #include "core/framework/TensorSeq.h"
 #include "core/graph/graph_viewer.h"
+#include "core/graph/schema_registry.h"
 #include "core/platform/env.h"
 #include "core/session/IOBinding.h"
 #include "core/session/abi_session_options_impl.h"
@@ -424,6 +425,49 @@ static void AddTensorAsPyObj(const OrtValue& val, std::vector<py::object>& pyobj
   pyobjs.push_back(obj);
 }
 
+// Tries to return a numeric, CPU-resident tensor output as a numpy array that wraps the
+// tensor's own buffer instead of copying it. A capsule holding a reference to the OrtValue
+// is installed as the array's base object, so the buffer stays alive for the lifetime of
+// the array even after the fetches vector is destroyed. Returns false when the tensor
+// cannot be wrapped (strings, non-CPU memory, empty tensors) and a copy is needed instead.
+static bool TryWrapTensorAsNumpyArray(const OrtValue& val, py::object& obj) {
+  const Tensor& rtensor = val.Get<Tensor>();
+  const int numpy_type = OnnxRuntimeTensorToNumpyType(rtensor.DataType());
+  if (numpy_type == NPY_OBJECT ||
+      rtensor.Location().device.Type() != OrtDevice::CPU ||
+      rtensor.Shape().Size() == 0) {
+    return false;
+  }
+
+  std::vector<npy_intp> npy_dims;
+  const TensorShape& shape = rtensor.Shape();
+  for (size_t n = 0; n < shape.NumDimensions(); ++n) {
+    npy_dims.push_back(shape[n]);
+  }
+
+  // Output tensors are freshly allocated, C-contiguous and solely owned by the OrtValue,
+  // so handing out a writable view of the buffer is safe.
+  void* data = const_cast<void*>(rtensor.DataRaw());
+  obj = py::reinterpret_steal<py::object>(PyArray_SimpleNewFromData(
+      static_cast<int>(shape.NumDimensions()), npy_dims.data(), numpy_type, data));
+  if (obj.ptr() == nullptr) {
+    PyErr_Clear();
+    return false;
+  }
+
+  py::capsule base(new OrtValue(val),
+                   [](void* p) { delete reinterpret_cast<OrtValue*>(p); });
+  // PyArray_SetBaseObject steals the capsule reference on success
+  PyObject* base_ptr = base.release().ptr();
+  if (PyArray_SetBaseObject(reinterpret_cast<PyArrayObject*>(obj.ptr()), base_ptr) != 0) {
+    Py_DECREF(base_ptr);
+    obj = py::object();
+    return false;
+  }
+
+  return true;
+}
+
 static inline void RegisterExecutionProvider(InferenceSession* sess, onnxruntime::IExecutionProviderFactory& f) {
   auto p = f.CreateProvider();
   OrtPybindThrowIfError(sess->RegisterExecutionProvider(std::move(p)));
@@ -802,6 +846,8 @@ void addGlobalMethods(py::module& m, Environment& env) {
 #ifdef onnxruntime_PYBIND_EXPORT_OPSCHEMA
   m.def(
       "get_all_operator_schema", []() -> const std::vector<ONNX_NAMESPACE::OpSchema> {
+        // schema registration is deferred until first use, so force it before enumerating
+        SchemaRegistryManager::EnsureDeferredRegistration();
         return ONNX_NAMESPACE::OpSchemaRegistry::get_all_schemas_with_history();
       },
       "Return a vector of OpSchema all registed operators");
@@ -1586,7 +1632,10 @@ RunOptions instance. The individual calls will exit gracefully and return an err
                      R"pbdoc(Choose to run in training or inferencing mode)pbdoc")
 #endif
       .def_readwrite("only_execute_path_to_fetches", &RunOptions::only_execute_path_to_fetches,
-                     R"pbdoc(Only execute the nodes needed by fetch list)pbdoc");
+                     R"pbdoc(Only execute the nodes needed by fetch list)pbdoc")
+      .def_readwrite("timeout_in_ms", &RunOptions::timeout_in_ms,
+                     R"pbdoc(Maximum wall clock time in milliseconds a Run() invocation may take before it is
+cooperatively cancelled and fails like a terminated run. 0 (the default) means no limit.)pbdoc");
 
   py::class_<ModelMetadata>(m, "ModelMetadata", R"pbdoc(Pre-defined and custom metadata about the model.
 It is usually used to identify the model used to run the prediction and
@@ -1731,11 +1780,33 @@ including arg name, arg type (contains both type and shape).)pbdoc")
                }
              }
 
+             // A fetch that passes a graph input straight through aliases the feed buffer,
+             // which is owned by the calling python code rather than by the OrtValue.
+             // Such fetches must be copied out instead of wrapped.
+             std::vector<const void*> feed_buffers;
+             feed_buffers.reserve(feeds.size());
+             for (const auto& feed : feeds) {
+               if (feed.second.IsTensor()) {
+                 feed_buffers.push_back(feed.second.Get<Tensor>().DataRaw());
+               }
+             }
+
              std::vector<py::object> rfetch;
              rfetch.reserve(fetches.size());
-             for (auto _ : fetches) {
+             for (auto& _ : fetches) {
                if (_.IsTensor()) {
-                 AddTensorAsPyObj(_, rfetch, nullptr, nullptr);
+                 // Return CPU tensor outputs as views over the ORT-owned buffers where
+                 // possible, so conversion back to numpy does not copy the data and the
+                 // GIL is only held for the constant-size array bookkeeping.
+                 const bool aliases_feed =
+                     std::find(feed_buffers.begin(), feed_buffers.end(),
+                               _.Get<Tensor>().DataRaw()) != feed_buffers.end();
+                 py::object obj;
+                 if (!aliases_feed && TryWrapTensorAsNumpyArray(_, obj)) {
+                   rfetch.push_back(obj);
+                 } else {
+                   AddTensorAsPyObj(_, rfetch, nullptr, nullptr);
+                 }
                } else {
                  AddNonTensorAsPyObj(_, rfetch, nullptr, nullptr);
                }
@@ -5,6 +5,7 @@
 #include "gtest/gtest.h"
 #include "gmock/gmock.h"
 #include <cstdlib>
+#include <thread>
 
 namespace onnxruntime {
 namespace test {
@@ -138,6 +139,33 @@ TEST(BFCArenaTest, ExerciseCoalescing) {
   a.Free(first_ptr_after);
 }
 
+TEST(BFCArenaTest, SmallChunkThreadCache) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30,
+             BFCArena::DEFAULT_ARENA_EXTEND_STRATEGY,
+             BFCArena::DEFAULT_INITIAL_CHUNK_SIZE_BYTES,
+             BFCArena::DEFAULT_MAX_DEAD_BYTES_PER_CHUNK,
+             /*use_small_chunk_thread_cache*/ true);
+
+  // freeing and re-allocating the same size class on one thread reuses the cached chunk
+  void* p1 = a.Alloc(512);
+  a.Free(p1);
+  void* p2 = a.Alloc(512);
+  EXPECT_EQ(p1, p2);
+
+  void* p3 = a.Alloc(1024);
+  EXPECT_NE(p2, p3);
+
+  // a free from another thread takes the locked path, so the backend reclaims the chunk
+  std::thread([&a, p2]() { a.Free(p2); }).join();
+
+  // a same-thread free parks the chunk in the cache; the backend still counts it as in use
+  a.Free(p3);
+
+  AllocatorStats stats;
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.bytes_in_use, 1024);
+}
+
 TEST(BFCArenaTest, AllocateZeroBufSize) {
   BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
   void* ptr = a.Alloc(0);
@@ -271,6 +299,33 @@ TEST(BFCArenaTest, AllocationsAndDeallocationsWithGrowth) {
   }
 }
 
+TEST(BFCArenaTest, TestShrink) {
+  BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
+  // the initial region is 1MB; a much larger allocation forces an additional region
+  void* p_small = a.Alloc(1024);
+  void* p_large = a.Alloc(20 * 1024 * 1024);
+
+  AllocatorStats stats;
+  a.GetStats(&stats);
+  const int64_t allocated_before = stats.total_allocated_bytes;
+  ASSERT_GT(allocated_before, 20 * 1024 * 1024);
+
+  // the large region is still in use, so Shrink must not release anything
+  EXPECT_TRUE(a.Shrink().IsOK());
+  a.GetStats(&stats);
+  EXPECT_EQ(stats.total_allocated_bytes, allocated_before);
+
+  // once the allocation is freed and coalesced, the region is returned to the device allocator
+  a.Free(p_large);
+  EXPECT_TRUE(a.Shrink().IsOK());
+  a.GetStats(&stats);
+  EXPECT_LT(stats.total_allocated_bytes, allocated_before);
+
+  // the initial region is kept as the steady-state pool and its allocations remain valid
+  EXPECT_EQ(1024u, a.RequestedSize(p_small));
+  a.Free(p_small);
+}
+
 TEST(BFCArenaTest, TestReserve) {
   // Configure a 1MiB byte limit
   BFCArena a(std::unique_ptr<IAllocator>(new CPUAllocator()), 1 << 30);
@@ -452,6 +452,22 @@ TEST_F(DataTypeTest, BFloat16Test) {
   }
 }
 
+TEST_F(DataTypeTest, GeneralTypeTest) {
+  // each registered type singleton carries its category as a compact integer id
+  EXPECT_EQ(DataTypeImpl::GetTensorType<float>()->type(), DataTypeImpl::GeneralType::kTensor);
+  EXPECT_EQ(DataTypeImpl::GetSparseTensorType<float>()->type(), DataTypeImpl::GeneralType::kSparseTensor);
+  EXPECT_EQ(DataTypeImpl::GetSequenceTensorType<float>()->type(), DataTypeImpl::GeneralType::kTensorSequence);
+  EXPECT_EQ(DataTypeImpl::GetType<float>()->type(), DataTypeImpl::GeneralType::kPrimitive);
+#if !defined(DISABLE_ML_OPS)
+  EXPECT_EQ(DataTypeImpl::GetType<MapInt64ToFloat>()->type(), DataTypeImpl::GeneralType::kNonTensor);
+#endif
+
+  EXPECT_TRUE(DataTypeImpl::GetTensorType<float>()->IsTensorType());
+  EXPECT_FALSE(DataTypeImpl::GetTensorType<float>()->IsSparseTensorType());
+  EXPECT_TRUE(DataTypeImpl::GetSparseTensorType<float>()->IsSparseTensorType());
+  EXPECT_TRUE(DataTypeImpl::GetSequenceTensorType<float>()->IsTensorSequenceType());
+}
+
 TEST_F(DataTypeTest, DataUtilsTest) {
   using namespace ONNX_NAMESPACE::Utils;
   // Test simple seq
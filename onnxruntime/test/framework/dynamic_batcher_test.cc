@@ -0,0 +1,174 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/session/dynamic_batcher.h"
+
+#include <future>
+#include <sstream>
+
+#include "asserts.h"
+#include "core/framework/tensor.h"
+#include "core/graph/model.h"
+#include "core/session/inference_session.h"
+#include "gtest/gtest.h"
+#include "test/framework/test_utils.h"
+#include "test/test_environment.h"
+
+using namespace ONNX_NAMESPACE;
+using namespace std;
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+// single-input Relu model with a symbolic batch dimension so coalesced shapes pass shape inference
+void CreateReluModel(std::unique_ptr<Model>& p_model) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 11;
+  p_model = onnxruntime::make_unique<Model>("batcher_test", true, ModelMetaData(), PathString(),
+                                            IOnnxRuntimeOpSchemaRegistryList(), domain_to_version,
+                                            std::vector<ONNX_NAMESPACE::FunctionProto>{},
+                                            DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = p_model->MainGraph();
+
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto* shape = tensor_float.mutable_tensor_type()->mutable_shape();
+  shape->add_dim()->set_dim_param("N");
+  shape->add_dim()->set_dim_param("M");
+
+  auto& input_arg = graph.GetOrCreateNodeArg("X", &tensor_float);
+  auto& output_arg = graph.GetOrCreateNodeArg("Y", &tensor_float);
+  graph.AddNode("relu", "Relu", "relu", {&input_arg}, {&output_arg});
+  ASSERT_STATUS_OK(graph.Resolve());
+}
+
+void LoadReluModel(InferenceSession& session) {
+  std::unique_ptr<Model> p_model;
+  CreateReluModel(p_model);
+
+  std::string serialized;
+  p_model->ToProto().SerializeToString(&serialized);
+  std::stringstream sstr(serialized);
+  ASSERT_STATUS_OK(session.Load(sstr));
+  ASSERT_STATUS_OK(session.Initialize());
+}
+
+void VerifyReluOutput(const Status& status, const std::vector<OrtValue>& fetches,
+                      const std::vector<int64_t>& expected_dims, const std::vector<float>& expected_values) {
+  ASSERT_STATUS_OK(status);
+  ASSERT_EQ(1u, fetches.size());
+  const Tensor& tensor = fetches.front().Get<Tensor>();
+  ASSERT_EQ(TensorShape(expected_dims), tensor.Shape());
+  const std::vector<float> found(tensor.Data<float>(), tensor.Data<float>() + expected_values.size());
+  ASSERT_EQ(expected_values, found);
+}
+
+}  // namespace
+
+TEST(DynamicBatcherTest, BatchesCompatibleRequests) {
+  SessionOptions so;
+  so.session_logid = "DynamicBatcherTest.BatchesCompatibleRequests";
+  InferenceSession session{so, GetEnvironment()};
+  LoadReluModel(session);
+
+  DynamicBatcher::Config config;
+  config.batch_window = std::chrono::milliseconds(50);
+  DynamicBatcher batcher{session, config};
+
+  Status status_1, status_2;
+  std::vector<OrtValue> fetches_1, fetches_2;
+  std::promise<void> done_1, done_2;
+
+  auto enqueue = [&](const std::vector<int64_t>& dims, const std::vector<float>& values,
+                     Status& status_out, std::vector<OrtValue>& fetches_out, std::promise<void>& done) {
+    OrtValue feed;
+    CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims, values, &feed);
+    ASSERT_STATUS_OK(batcher.Enqueue(RunOptions(), {"X"}, {feed}, {"Y"},
+                                     [&](Status status, std::vector<OrtValue> fetches) {
+                                       status_out = std::move(status);
+                                       fetches_out = std::move(fetches);
+                                       done.set_value();
+                                     }));
+  };
+
+  enqueue({1, 2}, {-1.0f, 2.0f}, status_1, fetches_1, done_1);
+  enqueue({2, 2}, {3.0f, -4.0f, -5.0f, 6.0f}, status_2, fetches_2, done_2);
+
+  done_1.get_future().wait();
+  done_2.get_future().wait();
+
+  VerifyReluOutput(status_1, fetches_1, {1, 2}, {0.0f, 2.0f});
+  VerifyReluOutput(status_2, fetches_2, {2, 2}, {3.0f, 0.0f, 0.0f, 6.0f});
+}
+
+TEST(DynamicBatcherTest, IncompatibleRequestsRunSeparately) {
+  SessionOptions so;
+  so.session_logid = "DynamicBatcherTest.IncompatibleRequestsRunSeparately";
+  InferenceSession session{so, GetEnvironment()};
+  LoadReluModel(session);
+
+  DynamicBatcher::Config config;
+  config.batch_window = std::chrono::milliseconds(10);
+  DynamicBatcher batcher{session, config};
+
+  Status status_1, status_2;
+  std::vector<OrtValue> fetches_1, fetches_2;
+  std::promise<void> done_1, done_2;
+
+  OrtValue feed_1;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {1, 2},
+                       std::vector<float>{-1.0f, 1.0f}, &feed_1);
+  ASSERT_STATUS_OK(batcher.Enqueue(RunOptions(), {"X"}, {feed_1}, {"Y"},
+                                   [&](Status status, std::vector<OrtValue> fetches) {
+                                     status_1 = std::move(status);
+                                     fetches_1 = std::move(fetches);
+                                     done_1.set_value();
+                                   }));
+
+  // different trailing dimension, so this cannot be coalesced with the request above
+  OrtValue feed_2;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {1, 3},
+                       std::vector<float>{-2.0f, 2.0f, 3.0f}, &feed_2);
+  ASSERT_STATUS_OK(batcher.Enqueue(RunOptions(), {"X"}, {feed_2}, {"Y"},
+                                   [&](Status status, std::vector<OrtValue> fetches) {
+                                     status_2 = std::move(status);
+                                     fetches_2 = std::move(fetches);
+                                     done_2.set_value();
+                                   }));
+
+  done_1.get_future().wait();
+  done_2.get_future().wait();
+
+  VerifyReluOutput(status_1, fetches_1, {1, 2}, {0.0f, 1.0f});
+  VerifyReluOutput(status_2, fetches_2, {1, 3}, {0.0f, 2.0f, 3.0f});
+}
+
+TEST(DynamicBatcherTest, RejectsMalformedRequests) {
+  SessionOptions so;
+  so.session_logid = "DynamicBatcherTest.RejectsMalformedRequests";
+  InferenceSession session{so, GetEnvironment()};
+  LoadReluModel(session);
+
+  DynamicBatcher batcher{session};
+
+  auto callback = [](Status, std::vector<OrtValue>) { FAIL(); };
+
+  // no feeds
+  ASSERT_FALSE(batcher.Enqueue(RunOptions(), {}, {}, {"Y"}, callback).IsOK());
+
+  // scalar feed has no batch dimension
+  OrtValue scalar;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {},
+                       std::vector<float>{1.0f}, &scalar);
+  ASSERT_FALSE(batcher.Enqueue(RunOptions(), {"X"}, {scalar}, {"Y"}, callback).IsOK());
+
+  // no callback
+  OrtValue feed;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {1, 2},
+                       std::vector<float>{1.0f, 2.0f}, &feed);
+  ASSERT_FALSE(batcher.Enqueue(RunOptions(), {"X"}, {feed}, {"Y"}, nullptr).IsOK());
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -101,6 +101,49 @@ TEST_F(ExecutionFrameTest, TensorAllocationTest) {
   ASSERT_EQ(tensor2->template Data<float>(), p_tensor->template Data<float>());
 }
 
+TEST_F(ExecutionFrameTest, ValueStoragePooling) {
+  onnxruntime::Model model("test", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(), {{kOnnxDomain, 12}}, {}, DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  onnxruntime::NodeArg input_def("X", &tensor_float), output_def("Y", &tensor_float);
+
+  onnxruntime::Node* node = &graph.AddNode("node1", "Relu", "Relu operator", ArgMap{&input_def}, ArgMap{&output_def});
+  node->SetExecutionProviderType(kCpuExecutionProvider);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  auto cpu_xp = CreateCPUExecutionProvider();
+  auto xp_typ = cpu_xp->Type();
+  ExecutionProviders execution_providers;
+  execution_providers.Add(xp_typ, std::move(cpu_xp));
+  KernelRegistryManager kernel_registry_manager;
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState state(graph, execution_providers, true, &tp_, nullptr, dtm,
+                     DefaultLoggingManager().DefaultLogger(), profiler);
+
+  ASSERT_STATUS_OK(state.FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager));
+
+  vector<OrtValue> outputs;
+  {
+    ExecutionFrame frame({}, {}, {}, outputs, {}, state);
+  }
+
+  // the destroyed frame's OrtValue vector goes back to the session for the next Run
+  std::vector<OrtValue> recycled = state.AcquireFrameValueStorage();
+  ASSERT_TRUE(recycled.empty());
+  ASSERT_GT(recycled.capacity(), 0u);
+  state.RecycleFrameValueStorage(std::move(recycled));
+
+  // a new frame drains the pool
+  {
+    ExecutionFrame frame({}, {}, {}, outputs, {}, state);
+    EXPECT_EQ(state.AcquireFrameValueStorage().capacity(), 0u);
+  }
+}
+
 TEST_F(ExecutionFrameTest, FeedInDataTest) {
   onnxruntime::Model model("test", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
                            std::unordered_map<std::string, int>{{"", 10}}, {},
@@ -254,6 +297,75 @@ TEST_F(ExecutionFrameTest, MemPatternTest) {
   ASSERT_EQ(p->GetBlock(4)->offset_, kAllocAlignment);
 }
 
+TEST_F(ExecutionFrameTest, ScratchArenaForRunLocalValues) {
+  auto cpu_xp = CreateCPUExecutionProvider();
+  auto xp_type = cpu_xp->Type();
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[onnxruntime::kOnnxDomain] = 7;
+  onnxruntime::Model model("test", true, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                           domain_to_version, {}, DefaultLoggingManager().DefaultLogger());
+  onnxruntime::Graph& graph = model.MainGraph();
+  TypeProto tensor_float;
+  tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  onnxruntime::NodeArg input_def1("X1", &tensor_float),
+      input_def2("X2", &tensor_float),
+      gemm_out_def("T1", &tensor_float),
+      clip_out_def("T2", &tensor_float);
+
+  onnxruntime::Node& node1 =
+      graph.AddNode("node1", "MatMul", "gemm", ArgMap{&input_def1, &input_def2}, ArgMap{&gemm_out_def});
+  node1.SetExecutionProviderType(xp_type);
+  onnxruntime::Node& node2 = graph.AddNode("node2", "Clip", "clip", ArgMap{&gemm_out_def}, ArgMap{&clip_out_def});
+  node2.SetExecutionProviderType(xp_type);
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  KernelRegistryManager kernel_registry_manager;
+  ExecutionProviders execution_providers;
+  execution_providers.Add(xp_type, std::move(cpu_xp));
+  ASSERT_STATUS_OK(kernel_registry_manager.RegisterKernels(execution_providers));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState state(graph, execution_providers, /*enable_mem_pattern*/ false, &tp_, nullptr, dtm,
+                     DefaultLoggingManager().DefaultLogger(), profiler,
+                     /*use_deterministic_compute*/ false, /*use_scratch_arena*/ true);
+
+  ASSERT_STATUS_OK(state.FinalizeSessionState(ORT_TSTR(""), kernel_registry_manager));
+
+  const OrtValueNameIdxMap& mlvalue_name_idx_map(state.GetOrtValueNameIdxMap());
+  int x1_idx = -1, x2_idx = -1, t1_idx = -1, t2_idx = -1;
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("X1", x1_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("X2", x2_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("T1", t1_idx).IsOK());
+  ASSERT_TRUE(mlvalue_name_idx_map.GetIdx("T2", t2_idx).IsOK());
+
+  auto cpu_allocator = execution_providers.Get(xp_type)->GetAllocator(0, OrtMemTypeDefault);
+
+  OrtValue v1, v2;
+  CreateMLValue<float>(cpu_allocator, std::vector<int64_t>{2, 2}, std::vector<float>(4, 1.0f), &v1);
+  CreateMLValue<float>(cpu_allocator, std::vector<int64_t>{2, 2}, std::vector<float>(4, 1.0f), &v2);
+
+  vector<OrtValue> outputs;
+  ExecutionFrame frame({x1_idx, x2_idx}, {v1, v2}, {t2_idx}, outputs, {}, state);
+
+  // T1 dies inside the run, so its buffer comes from the scratch arena and the tensor doesn't own it
+  OrtValue& mlvalue_t1 = *frame.GetMutableNodeInputOrOutputMLValue(frame.GetNodeOffset(node1.Index()) + 2);
+  ASSERT_STATUS_OK(frame.AllocateMLValueTensorSelfOwnBuffer(mlvalue_t1, t1_idx,
+                                                            DataTypeImpl::GetType<float>(),
+                                                            cpu_allocator->Info(),
+                                                            TensorShape(std::vector<int64_t>{2, 2})));
+  EXPECT_FALSE(mlvalue_t1.Get<Tensor>().OwnsBuffer());
+
+  // T2 is fetched so it must outlive the frame and keeps a self-owned buffer
+  OrtValue& mlvalue_t2 = *frame.GetMutableNodeInputOrOutputMLValue(frame.GetNodeOffset(node2.Index()) + 1);
+  ASSERT_STATUS_OK(frame.AllocateMLValueTensorSelfOwnBuffer(mlvalue_t2, t2_idx,
+                                                            DataTypeImpl::GetType<float>(),
+                                                            cpu_allocator->Info(),
+                                                            TensorShape(std::vector<int64_t>{2, 2})));
+  EXPECT_TRUE(mlvalue_t2.Get<Tensor>().OwnsBuffer());
+}
+
 TEST(ExecutionFrameTestWithoutSessionState, BadModelInvalidDimParamUsage) {
   // load model with 2 Scan ops that both incorrectly use shapes of { 'None', 'None' } for their outputs.
   // as 'None' is not a special value it's treated as a variable name, leading to a runtime error when we
@@ -6,6 +6,7 @@
 #include <algorithm>
 #include <cfloat>
 #include <functional>
+#include <future>
 #include <iterator>
 #include <thread>
 #include <fstream>
@@ -364,6 +365,193 @@ TEST(InferenceSessionTests, NoTimeout) {
   RunModel(session_object, run_options);
 }
 
+TEST(InferenceSessionTests, RunAsync) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunAsync";
+  // RunAsync needs an inter-op thread pool, which per-session threads only create in parallel mode
+  so.execution_mode = ExecutionMode::ORT_PARALLEL;
+  so.inter_op_param.thread_pool_size = 2;
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &ml_value);
+
+  Status run_status;
+  std::vector<OrtValue> run_fetches;
+  std::promise<void> done;
+
+  RunOptions run_options;
+  run_options.run_tag = "async run";
+  ASSERT_STATUS_OK(session_object.RunAsync(run_options, {"X"}, {ml_value}, {"Y"},
+                                           [&](Status status, std::vector<OrtValue> fetches) {
+                                             run_status = std::move(status);
+                                             run_fetches = std::move(fetches);
+                                             done.set_value();
+                                           }));
+
+  done.get_future().wait();
+  ASSERT_STATUS_OK(run_status);
+  VerifyOutputs(run_fetches, {3, 2}, {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f});
+}
+
+TEST(InferenceSessionTests, RunAsyncRequiresInterOpThreads) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunAsyncRequiresInterOpThreads";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &ml_value);
+
+  // sequential sessions with per-session threads have no inter-op pool to enqueue onto
+  RunOptions run_options;
+  auto status = session_object.RunAsync(run_options, {"X"}, {ml_value}, {"Y"},
+                                        [](Status, std::vector<OrtValue>) { FAIL(); });
+  ASSERT_FALSE(status.IsOK());
+}
+
+TEST(InferenceSessionTests, PreparedRunReuse) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.PreparedRunReuse";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // names that don't exist in the model are rejected when preparing
+  std::unique_ptr<InferenceSession::PreparedRun> bad_prepared;
+  ASSERT_FALSE(session_object.PrepareRun({"bogus"}, {"Y"}, bad_prepared).IsOK());
+  ASSERT_FALSE(session_object.PrepareRun({"X"}, {"bogus"}, bad_prepared).IsOK());
+
+  std::unique_ptr<InferenceSession::PreparedRun> prepared;
+  ASSERT_STATUS_OK(session_object.PrepareRun({"X"}, {"Y"}, prepared));
+  ASSERT_TRUE(prepared != nullptr);
+
+  std::vector<int64_t> dims_mul_x = {3, 2};
+  std::vector<float> values_mul_x = {1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f};
+  OrtValue ml_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_mul_x, values_mul_x,
+                       &ml_value);
+
+  RunOptions run_options;
+  run_options.run_tag = "prepared run";
+
+  // the prepared bindings can be reused across calls
+  for (int i = 0; i < 2; ++i) {
+    std::vector<OrtValue> fetches;
+    ASSERT_STATUS_OK(session_object.Run(run_options, *prepared, {ml_value}, &fetches));
+    VerifyOutputs(fetches, {3, 2}, {1.0f, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f});
+  }
+
+  // feed count must match what was prepared
+  std::vector<OrtValue> fetches;
+  ASSERT_FALSE(session_object.Run(run_options, *prepared, {ml_value, ml_value}, &fetches).IsOK());
+}
+
+TEST(InferenceSessionTests, CloneSharesInitializedState) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.CloneSharesInitializedState";
+
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // cloning before Initialize must fail
+  std::unique_ptr<InferenceSession> cloned_session;
+  ASSERT_FALSE(session_object.Clone(cloned_session).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  ASSERT_STATUS_OK(session_object.Clone(cloned_session));
+  ASSERT_NE(cloned_session, nullptr);
+
+  // the clone shares the session state rather than building its own
+  ASSERT_EQ(&cloned_session->GetSessionState(), &session_object.GetSessionState());
+
+  // both sessions are usable
+  RunOptions run_options;
+  run_options.run_tag = "original session";
+  RunModel(session_object, run_options);
+  run_options.run_tag = "cloned session";
+  RunModel(*cloned_session, run_options);
+}
+
+TEST(InferenceSessionTests, RefreshModelWeights) {
+  // write two copies of a small Add model that differ only in the value of initializer W
+  auto build_model = [](const std::string& file_path, const std::vector<float>& weights) {
+    std::unordered_map<std::string, int> domain_to_version;
+    domain_to_version[onnxruntime::kOnnxDomain] = 11;
+    Model model("refresh_weights_test", true, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+                domain_to_version, {}, DefaultLoggingManager().DefaultLogger());
+    onnxruntime::Graph& graph = model.MainGraph();
+
+    TypeProto tensor_float;
+    tensor_float.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    tensor_float.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+    auto& input_arg = graph.GetOrCreateNodeArg("X", &tensor_float);
+    auto& weight_arg = graph.GetOrCreateNodeArg("W", &tensor_float);
+    auto& output_arg = graph.GetOrCreateNodeArg("Y", &tensor_float);
+
+    ONNX_NAMESPACE::TensorProto weight;
+    weight.set_name("W");
+    weight.add_dims(2);
+    weight.set_data_type(TensorProto_DataType_FLOAT);
+    weight.set_raw_data(weights.data(), weights.size() * sizeof(float));
+    graph.AddInitializedTensor(weight);
+
+    graph.AddNode("add", "Add", "Add", {&input_arg, &weight_arg}, {&output_arg});
+    ASSERT_STATUS_OK(graph.Resolve());
+    ASSERT_STATUS_OK(Model::Save(model, file_path));
+  };
+
+  const std::string model_v1 = "testdata/refresh_weights_v1.onnx";
+  const std::string model_v2 = "testdata/refresh_weights_v2.onnx";
+  build_model(model_v1, {10.f, 20.f});
+  build_model(model_v2, {100.f, 200.f});
+
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RefreshModelWeights";
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // refreshing before the session is initialized must fail
+  ASSERT_FALSE(session_object.RefreshModelWeights(model_v2).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(model_v1));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  OrtValue ml_value;
+  std::vector<int64_t> dims_x = {2};
+  std::vector<float> values_x = {1.f, 2.f};
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), dims_x, values_x,
+                       &ml_value);
+  NameMLValMap feeds;
+  feeds.insert(std::make_pair("X", ml_value));
+  std::vector<std::string> output_names{"Y"};
+  RunOptions run_options;
+
+  std::vector<OrtValue> fetches;
+  ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+  VerifyOutputs(fetches, {2}, {11.f, 22.f});
+
+  // swap in the retrained weights and verify the same session picks them up
+  ASSERT_STATUS_OK(session_object.RefreshModelWeights(model_v2));
+
+  fetches.clear();
+  ASSERT_STATUS_OK(session_object.Run(run_options, feeds, output_names, &fetches));
+  VerifyOutputs(fetches, {2}, {101.f, 202.f});
+}
+
 TEST(InferenceSessionTests, OnlyExecutePathToFetches) {
   SessionOptions so;
 
@@ -623,6 +811,123 @@ TEST(InferenceSessionTests, CheckRunProfilerWithSessionOptions) {
   }
 }
 
+TEST(InferenceSessionTests, CheckRunProfilerStreamingMode) {
+  // in streaming mode events are appended to the profile file incrementally rather than held
+  // in memory until EndProfiling; the resulting file must still be a well-formed trace.
+  SessionOptions so;
+
+  so.session_logid = "CheckRunProfiler";
+  so.enable_profiling = true;
+  so.profile_file_prefix = ORT_TSTR("onnxprofile_profile_streaming_test");
+  so.AddConfigEntry(kOrtSessionOptionsProfilerStreamingMode, "1");
+
+  InferenceSession session_object(so, GetEnvironment());
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "RunTag";
+
+  RunModel(session_object, run_options);
+  std::string profile_file = session_object.EndProfiling();
+
+  std::ifstream profile(profile_file);
+  ASSERT_TRUE(profile);
+  std::string line;
+
+  std::vector<std::string> tags = {"pid", "dur", "ts", "ph", "X", "name", "args"};
+  int count = 0;
+  while (std::getline(profile, line)) {
+    if (count == 0) {
+      ASSERT_TRUE(line.find("[") != string::npos);
+    } else if (count <= 7) {
+      for (auto& s : tags) {
+        ASSERT_TRUE(line.find(s) != string::npos);
+      }
+    } else {
+      ASSERT_TRUE(line.find("]") != string::npos);
+    }
+    count++;
+  }
+}
+
+TEST(InferenceSessionTests, NodeTimingSampling) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.NodeTimingSampling";
+  // sample every run so two runs are guaranteed to show up in the counters
+  so.AddConfigEntry(kOrtSessionOptionsNodeTimingSampleInterval, "1");
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+
+  // stats are not available before the session is initialized
+  std::string report;
+  ASSERT_FALSE(session_object.GetNodeTimingStats(report).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+  RunModel(session_object, run_options);
+
+  ASSERT_STATUS_OK(session_object.GetNodeTimingStats(report));
+  // the model has a single Mul node; both runs should have been sampled
+  ASSERT_NE(report.find("node_name,op_type,provider,sampled_runs,cumulative_ns"), std::string::npos);
+  ASSERT_NE(report.find(",Mul,CPUExecutionProvider,2,"), std::string::npos);
+}
+
+TEST(InferenceSessionTests, RunTraceCallback) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.RunTraceCallback";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  std::vector<RunTraceSpan> spans;
+  ASSERT_STATUS_OK(session_object.RegisterRunTraceCallback(
+      [&spans](const RunTraceSpan& span) { spans.push_back(span); }));
+
+  RunOptions run_options;
+  run_options.run_tag = "trace me";
+  RunModel(session_object, run_options);
+
+  // a CPU-only model needs no device copies, so expect one execute span nested in the run span
+  ASSERT_EQ(spans.size(), 2u);
+  EXPECT_EQ(spans[0].kind, RunTraceSpanKind::kExecute);
+  EXPECT_EQ(spans[1].kind, RunTraceSpanKind::kRun);
+  for (const auto& span : spans) {
+    EXPECT_EQ(span.run_tag, "trace me");
+    EXPECT_LE(span.start, span.end);
+  }
+  EXPECT_LE(spans[1].start, spans[0].start);
+  EXPECT_LE(spans[0].end, spans[1].end);
+
+  // unregistering stops span delivery
+  ASSERT_STATUS_OK(session_object.RegisterRunTraceCallback(nullptr));
+  RunModel(session_object, run_options);
+  ASSERT_EQ(spans.size(), 2u);
+}
+
+TEST(InferenceSessionTests, NodeTimingSamplingDisabledByDefault) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.NodeTimingSamplingDisabledByDefault";
+
+  InferenceSession session_object{so, GetEnvironment()};
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  RunOptions run_options;
+  run_options.run_tag = "one session/one tag";
+  RunModel(session_object, run_options);
+
+  std::string report;
+  auto status = session_object.GetNodeTimingStats(report);
+  ASSERT_FALSE(status.IsOK());
+  ASSERT_NE(status.ErrorMessage().find("Node timing sampling is not enabled"), std::string::npos);
+}
+
 TEST(InferenceSessionTests, CheckRunProfilerWithStartProfile) {
   SessionOptions so;
 
@@ -898,6 +1203,102 @@ TEST(InferenceSessionTests, TestIOBindingReuse) {
   }
 }
 
+TEST(InferenceSessionTests, Warmup) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.Warmup";
+  InferenceSession session_object{so, GetEnvironment()};
+
+  // warmup before initialization is rejected
+  ASSERT_FALSE(session_object.Warmup({}).IsOK());
+
+  ASSERT_STATUS_OK(session_object.Load(MODEL_URI));
+  ASSERT_STATUS_OK(session_object.Initialize());
+  ASSERT_FALSE(session_object.IsWarmedUp());
+
+  // the model fully defines the input shape so an empty request is enough
+  ASSERT_STATUS_OK(session_object.Warmup({}));
+  ASSERT_TRUE(session_object.IsWarmedUp());
+
+  // explicit shape buckets are also accepted
+  ASSERT_STATUS_OK(session_object.Warmup({{{"X", TensorShape({3, 2})}}}));
+
+  // the session is still usable for real requests afterwards
+  RunOptions run_options;
+  run_options.run_tag = "after warmup";
+  RunModel(session_object, run_options);
+}
+
+TEST(InferenceSessionTests, WarmupRequiresShapesForUndefinedInputs) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.WarmupRequiresShapesForUndefinedInputs";
+  InferenceSession session_object(so, GetEnvironment());
+  std::unique_ptr<Model> p_model;
+  CreateMatMulModel(p_model, kCpuExecutionProvider);
+
+  std::string s1;
+  p_model->ToProto().SerializeToString(&s1);
+  std::stringstream sstr(s1);
+  ASSERT_STATUS_OK(session_object.Load(sstr));
+  ASSERT_STATUS_OK(session_object.Initialize());
+
+  // the matmul model does not define input shapes, so they must be provided
+  ASSERT_FALSE(session_object.Warmup({}).IsOK());
+  ASSERT_FALSE(session_object.IsWarmedUp());
+
+  ASSERT_STATUS_OK(session_object.Warmup({{{"A", TensorShape({3, 4})}, {"B", TensorShape({4, 3})}},
+                                          {{"A", TensorShape({2, 4})}, {"B", TensorShape({4, 3})}}}));
+  ASSERT_TRUE(session_object.IsWarmedUp());
+}
+
+TEST(InferenceSessionTests, TestIOBindingShapeMorphing) {
+  SessionOptions so;
+  so.session_logid = "InferenceSessionTests.TestIOBindingShapeMorphing";
+  InferenceSession session_object(so, GetEnvironment());
+  std::unique_ptr<Model> p_model;
+  CreateMatMulModel(p_model, kCpuExecutionProvider);
+
+  std::string s1;
+  p_model->ToProto().SerializeToString(&s1);
+  std::stringstream sstr(s1);
+  ASSERT_STATUS_OK(session_object.Load(sstr));
+  ASSERT_STATUS_OK(session_object.Initialize());
+  unique_ptr<IOBinding> io_binding;
+  ASSERT_STATUS_OK(session_object.NewIOBinding(&io_binding));
+
+  // bind inputs and a pre-allocated output once, sized for the maximum expected shapes
+  std::vector<float> values_mul_x = {0.0f, 1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f};
+  auto cpu_allocator = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+
+  OrtValue input_ml_value_A;
+  CreateMLValue<float>(cpu_allocator, {3, 4}, values_mul_x, &input_ml_value_A);
+  ASSERT_STATUS_OK(io_binding->BindInput("A", input_ml_value_A));
+
+  OrtValue input_ml_value_B;
+  CreateMLValue<float>(cpu_allocator, {4, 3}, values_mul_x, &input_ml_value_B);
+  ASSERT_STATUS_OK(io_binding->BindInput("B", input_ml_value_B));
+
+  OrtValue output_ml_value;
+  AllocateMLValue<float>(cpu_allocator, {3, 3}, &output_ml_value);
+  ASSERT_STATUS_OK(io_binding->BindOutput("Y", output_ml_value));
+  const void* output_buffer = output_ml_value.Get<Tensor>().DataRaw();
+
+  RunOptions run_options;
+  run_options.run_tag = so.session_logid;
+
+  ASSERT_STATUS_OK(session_object.Run(run_options, *io_binding));
+  VerifyOutputs(io_binding->GetOutputs(), {3, 3}, {42, 48, 54, 114, 136, 158, 186, 224, 262});
+
+  // shrink the effective shape of 'A' in place and run again. the bound buffers are reused and
+  // the output morphs to the smaller result shape without re-binding.
+  ASSERT_STATUS_OK(io_binding->SetInputShape("A", TensorShape({2, 4})));
+  ASSERT_STATUS_OK(session_object.Run(run_options, *io_binding));
+  VerifyOutputs(io_binding->GetOutputs(), {2, 3}, {42, 48, 54, 114, 136, 158});
+  ASSERT_EQ(io_binding->GetOutputs()[0].Get<Tensor>().DataRaw(), output_buffer);
+
+  // growing an input beyond the capacity of its bound buffer is rejected
+  ASSERT_FALSE(io_binding->SetInputShape("A", TensorShape({4, 4})).IsOK());
+}
+
 TEST(InferenceSessionTests, InvalidInputTypeOfTensorElement) {
   SessionOptions so;
 
@@ -7,6 +7,7 @@
 #include "core/framework/execution_providers.h"
 #include "core/framework/graph_partitioner.h"
 #include "core/framework/kernel_registry.h"
+#include "core/framework/mem_pattern_planner.h"
 #include "core/framework/op_kernel.h"
 #include "core/framework/session_state.h"
 #include "core/graph/graph_utils.h"
@@ -97,6 +98,61 @@ TEST_P(SessionStateAddGetKernelTest, AddGetKernelTest) {
 
 INSTANTIATE_TEST_SUITE_P(SessionStateTests, SessionStateAddGetKernelTest, testing::Values(0, 1));
 
+TEST(SessionStateTest, BucketedMemoryPatternCache) {
+  onnxruntime::Model model("graph_1", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ExecutionProviders execution_providers;
+  ASSERT_STATUS_OK(execution_providers.Add(
+      kCpuExecutionProvider, onnxruntime::make_unique<CPUExecutionProvider>(CPUExecutionProviderInfo(false))));
+
+  DataTransferManager dtm;
+  profiling::Profiler profiler;
+  SessionState s(graph, execution_providers, true, nullptr, nullptr, dtm,
+                 DefaultLoggingManager().DefaultLogger(), profiler,
+                 /*use_deterministic_compute*/ false, /*use_scratch_arena*/ false,
+                 /*mem_pattern_bucket_size*/ 32);
+
+  auto make_group = [](size_t bytes) {
+    auto group = onnxruntime::make_unique<MemoryPatternGroup>();
+    group->locations.push_back(OrtMemoryInfo(CPU, OrtArenaAllocator));
+    MemPatternPlanner planner{/*using_counters*/ false};
+    planner.TraceAllocation(0, bytes);
+    group->patterns.push_back(planner.GenerateMemPattern());
+    return group;
+  };
+
+  TensorShape shape_a({1, 100});
+  TensorShape shape_b({1, 120});  // same 32-wide bucket as shape_a
+  TensorShape shape_c({1, 130});  // next bucket
+  std::vector<std::reference_wrapper<const TensorShape>> shapes_a{std::cref(shape_a)};
+  std::vector<std::reference_wrapper<const TensorShape>> shapes_b{std::cref(shape_b)};
+  std::vector<std::reference_wrapper<const TensorShape>> shapes_c{std::cref(shape_c)};
+
+  ASSERT_STATUS_OK(s.UpdateMemoryPatternGroupCache(shapes_a, make_group(100 * 256)));
+
+  // a different shape in the same bucket hits the cached pattern
+  std::unordered_map<int, TensorShape> inferred_shapes;
+  const MemoryPatternGroup* hit = s.GetMemoryPatternGroup(shapes_b, {}, inferred_shapes);
+  ASSERT_NE(hit, nullptr);
+  EXPECT_EQ(hit->patterns[0].PeakSize(), 100u * 256u);
+
+  // a shape in a different bucket misses
+  EXPECT_EQ(s.GetMemoryPatternGroup(shapes_c, {}, inferred_shapes), nullptr);
+
+  // a larger trace within the bucket upgrades the cached pattern
+  ASSERT_STATUS_OK(s.UpdateMemoryPatternGroupCache(shapes_b, make_group(120 * 256)));
+  hit = s.GetMemoryPatternGroup(shapes_a, {}, inferred_shapes);
+  ASSERT_NE(hit, nullptr);
+  EXPECT_EQ(hit->patterns[0].PeakSize(), 120u * 256u);
+
+  // a smaller trace does not replace it
+  ASSERT_STATUS_OK(s.UpdateMemoryPatternGroupCache(shapes_a, make_group(100 * 256)));
+  hit = s.GetMemoryPatternGroup(shapes_b, {}, inferred_shapes);
+  ASSERT_NE(hit, nullptr);
+  EXPECT_EQ(hit->patterns[0].PeakSize(), 120u * 256u);
+}
+
 namespace {
 class TestParam {
  public:
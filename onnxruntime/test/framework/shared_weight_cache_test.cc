@@ -0,0 +1,94 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/shared_weight_cache.h"
+
+#include "core/framework/allocator.h"
+#include "core/framework/tensor.h"
+#include "test_utils.h"
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+namespace {
+OrtValue CreateScalarValue(float value) {
+  auto cpu_allocator = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  auto tensor = onnxruntime::make_unique<Tensor>(DataTypeImpl::GetType<float>(), TensorShape({1}), cpu_allocator);
+  *tensor->MutableData<float>() = value;
+
+  OrtValue ort_value;
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  ort_value.Init(tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+  return ort_value;
+}
+// fabricates a value whose location claims the given device; only the cache keying is under
+// test, so the payload can live in host memory
+OrtValue CreateScalarValueOnDevice(float* payload, const OrtDevice& device) {
+  OrtMemoryInfo mem_info("Cuda", OrtDeviceAllocator, device, device.Id());
+  auto tensor = onnxruntime::make_unique<Tensor>(DataTypeImpl::GetType<float>(), TensorShape({1}),
+                                                 payload, mem_info);
+  OrtValue ort_value;
+  auto ml_tensor = DataTypeImpl::GetType<Tensor>();
+  ort_value.Init(tensor.release(), ml_tensor, ml_tensor->GetDeleteFunc());
+  return ort_value;
+}
+}  // namespace
+
+TEST(SharedWeightCacheTest, LookupMissReturnsNullptr) {
+  SharedWeightCache cache;
+  auto& weights = cache.GetOrCreateModelWeights("model_a");
+  EXPECT_EQ(weights.Lookup("weight", OrtDevice()), nullptr);
+}
+
+TEST(SharedWeightCacheTest, FirstInsertWins) {
+  SharedWeightCache cache;
+  auto& weights = cache.GetOrCreateModelWeights("model_a");
+
+  const OrtValue& stored = weights.Insert("weight", CreateScalarValue(1.f));
+  EXPECT_EQ(stored.Get<Tensor>().Data<float>()[0], 1.f);
+
+  // a racing second insert must yield the value that was stored first
+  const OrtValue& stored_again = weights.Insert("weight", CreateScalarValue(2.f));
+  EXPECT_EQ(stored_again.Get<Tensor>().Data<float>()[0], 1.f);
+  EXPECT_EQ(weights.Lookup("weight", OrtDevice()), &stored);
+}
+
+TEST(SharedWeightCacheTest, EntriesAreKeyedPerDevice) {
+  SharedWeightCache cache;
+  auto& weights = cache.GetOrCreateModelWeights("model_a");
+
+  const OrtDevice gpu0(OrtDevice::GPU, OrtDevice::MemType::DEFAULT, 0);
+  const OrtDevice gpu1(OrtDevice::GPU, OrtDevice::MemType::DEFAULT, 1);
+  float payload0 = 1.f;
+  float payload1 = 2.f;
+
+  const OrtValue& stored_cpu = weights.Insert("weight", CreateScalarValue(0.f));
+  const OrtValue& stored_gpu0 = weights.Insert("weight", CreateScalarValueOnDevice(&payload0, gpu0));
+  const OrtValue& stored_gpu1 = weights.Insert("weight", CreateScalarValueOnDevice(&payload1, gpu1));
+
+  // one entry per device: a session planned on another GPU must not be handed this GPU's buffer
+  EXPECT_NE(&stored_gpu0, &stored_gpu1);
+  EXPECT_EQ(weights.Lookup("weight", OrtDevice()), &stored_cpu);
+  EXPECT_EQ(weights.Lookup("weight", gpu0), &stored_gpu0);
+  EXPECT_EQ(weights.Lookup("weight", gpu1), &stored_gpu1);
+
+  // per-device first-writer-wins
+  float payload2 = 3.f;
+  EXPECT_EQ(&weights.Insert("weight", CreateScalarValueOnDevice(&payload2, gpu0)), &stored_gpu0);
+}
+
+TEST(SharedWeightCacheTest, ModelsAreIsolated) {
+  SharedWeightCache cache;
+  auto& weights_a = cache.GetOrCreateModelWeights("model_a");
+  auto& weights_b = cache.GetOrCreateModelWeights("model_b");
+  EXPECT_NE(&weights_a, &weights_b);
+
+  weights_a.Insert("weight", CreateScalarValue(1.f));
+  EXPECT_EQ(weights_b.Lookup("weight", OrtDevice()), nullptr);
+
+  // re-requesting a model key returns the same store
+  EXPECT_EQ(&cache.GetOrCreateModelWeights("model_a"), &weights_a);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -810,5 +810,87 @@ TEST(SparseTensorConversionTests, TestDenseToSparseConversion) {
 
 #endif // !ORT_MINIMAL_BUILD
 
+#if !defined(ORT_MINIMAL_BUILD) && !defined(DISABLE_CONTRIB_OPS)
+
+// Runs the contrib SparseMatMul op with the given sparse A feed and checks the dense product.
+static void RunSparseMatMul(MLValue& a_value, const std::vector<float>& expected_output) {
+  // Y <- SparseMatMul(A, B) where A is a [2, 3] sparse matrix and B is a [3, 2] dense matrix
+  Model model("SparseMatMulTest", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              {{kOnnxDomain, 12}, {kMSDomain, 1}}, {}, DefaultLoggingManager().DefaultLogger());
+  Graph& graph = model.MainGraph();
+
+  TypeProto sparse_float(*DataTypeImpl::GetSparseTensorType<float>()->GetTypeProto());
+  TypeProto dense_float(*DataTypeImpl::GetTensorType<float>()->GetTypeProto());
+  auto& a_arg = graph.GetOrCreateNodeArg("A", &sparse_float);
+  auto& b_arg = graph.GetOrCreateNodeArg("B", &dense_float);
+  auto& y_arg = graph.GetOrCreateNodeArg("Y", nullptr);
+  graph.AddNode("", "SparseMatMul", "", {&a_arg, &b_arg}, {&y_arg}, nullptr, kMSDomain);
+  EXPECT_TRUE(graph.Resolve().IsOK());
+
+  // Serialize model and deserialize it back
+  std::string serialized_model;
+  auto model_proto = model.ToProto();
+  EXPECT_TRUE(model_proto.SerializeToString(&serialized_model));
+  std::stringstream sstr(serialized_model);
+
+  InferenceSession session_object(SessionOptions(), GetEnvironment());
+  EXPECT_TRUE(session_object.Load(sstr).IsOK());
+  EXPECT_TRUE(session_object.Initialize().IsOK());
+
+  MLValue b_value;
+  CreateMLValue<float>(TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault), {3, 2},
+                       {1.f, 2.f, 3.f, 4.f, 5.f, 6.f}, &b_value);
+
+  NameMLValMap feeds{{"A", a_value}, {"B", b_value}};
+  std::vector<MLValue> fetches;
+  EXPECT_TRUE(session_object.Run(RunOptions(), feeds, {"Y"}, &fetches).IsOK());
+
+  ASSERT_EQ(fetches.size(), 1u);
+  const auto& y_tensor = fetches[0].Get<Tensor>();
+  ASSERT_EQ(y_tensor.Shape(), TensorShape({2, 2}));
+  const float* y_data = y_tensor.Data<float>();
+  for (size_t i = 0; i < expected_output.size(); ++i) {
+    EXPECT_EQ(y_data[i], expected_output[i]);
+  }
+}
+
+// A = [[1, 0, 2],       B = [[1, 2],       Y = [[11, 14],
+//      [0, 3, 0]]            [3, 4],            [ 9, 12]]
+//                            [5, 6]]
+TEST(SparseMatMulTests, CooInput) {
+  auto allocator = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  auto sparse = onnxruntime::make_unique<SparseTensor>(DataTypeImpl::GetType<float>(),
+                                                       TensorShape({2, 3}), 3, allocator);
+  const std::vector<float> values{1.f, 2.f, 3.f};
+  const std::vector<int64_t> indices{0, 0, 0, 2, 1, 1};
+  std::copy(values.cbegin(), values.cend(), sparse->MutableValues().MutableData<float>());
+  std::copy(indices.cbegin(), indices.cend(), sparse->MutableIndices().MutableData<int64_t>());
+
+  MLValue a_value;
+  a_value.Init(sparse.release(), DataTypeImpl::GetType<SparseTensor>(),
+               DataTypeImpl::GetType<SparseTensor>()->GetDeleteFunc());
+  RunSparseMatMul(a_value, {11.f, 14.f, 9.f, 12.f});
+}
+
+TEST(SparseMatMulTests, CsrInput) {
+  auto allocator = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+  auto sparse = onnxruntime::make_unique<SparseTensor>(DataTypeImpl::GetType<float>(),
+                                                       TensorShape({2, 3}), 3, allocator,
+                                                       SparseFormat::kCsr);
+  const std::vector<float> values{1.f, 2.f, 3.f};
+  const std::vector<int64_t> inner_indices{0, 2, 1};
+  const std::vector<int64_t> outer_indices{0, 2, 3};
+  std::copy(values.cbegin(), values.cend(), sparse->MutableValues().MutableData<float>());
+  std::copy(inner_indices.cbegin(), inner_indices.cend(), sparse->MutableInnerIndices().MutableData<int64_t>());
+  std::copy(outer_indices.cbegin(), outer_indices.cend(), sparse->MutableOuterIndices().MutableData<int64_t>());
+
+  MLValue a_value;
+  a_value.Init(sparse.release(), DataTypeImpl::GetType<SparseTensor>(),
+               DataTypeImpl::GetType<SparseTensor>()->GetDeleteFunc());
+  RunSparseMatMul(a_value, {11.f, 14.f, 9.f, 12.f});
+}
+
+#endif  // !defined(ORT_MINIMAL_BUILD) && !defined(DISABLE_CONTRIB_OPS)
+
 }  // namespace test
 }  // namespace onnxruntime
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/tensor_shape.h"
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+TEST(TensorShapeTest, InlineStorageBasics) {
+  TensorShape shape({2, 3, 4});
+  EXPECT_EQ(shape.NumDimensions(), 3u);
+  EXPECT_EQ(shape[0], 2);
+  EXPECT_EQ(shape[2], 4);
+  EXPECT_EQ(shape.Size(), 24);
+  EXPECT_EQ(shape.ToString(), "{2,3,4}");
+
+  // in-place dimension update before any vector materialization
+  shape[1] = 7;
+  EXPECT_EQ(shape.Size(), 56);
+
+  // GetDims materializes a vector that matches and stays stable
+  const std::vector<int64_t>& dims = shape.GetDims();
+  EXPECT_EQ(dims, (std::vector<int64_t>{2, 7, 4}));
+  EXPECT_EQ(&dims, &shape.GetDims());
+}
+
+TEST(TensorShapeTest, LargeRankUsesVector) {
+  std::vector<int64_t> dims{1, 2, 3, 4, 5, 6, 7};
+  TensorShape shape(dims);
+  EXPECT_EQ(shape.NumDimensions(), 7u);
+  EXPECT_EQ(shape.GetDims(), dims);
+  EXPECT_EQ(shape.Size(), 5040);
+}
+
+TEST(TensorShapeTest, EqualityAcrossRepresentations) {
+  TensorShape inline_shape({8, 16});
+  TensorShape materialized_shape({8, 16});
+  materialized_shape.GetDims();  // force the vector representation
+  EXPECT_TRUE(inline_shape == materialized_shape);
+  EXPECT_TRUE(materialized_shape == inline_shape);
+
+  TensorShape different({8, 17});
+  EXPECT_TRUE(inline_shape != different);
+  EXPECT_TRUE(TensorShape() == TensorShape());
+}
+
+TEST(TensorShapeTest, CopyAndMove) {
+  TensorShape src({3, 5, 7});
+  src.GetDims();  // materialize the source
+
+  TensorShape copy(src);
+  EXPECT_EQ(copy, src);
+
+  TensorShape moved(std::move(src));
+  EXPECT_EQ(moved, copy);
+
+  TensorShape assigned;
+  assigned = moved;
+  EXPECT_EQ(assigned, copy);
+
+  TensorShape move_assigned;
+  move_assigned = std::move(moved);
+  EXPECT_EQ(move_assigned, copy);
+}
+
+TEST(TensorShapeTest, SliceAndScalar) {
+  TensorShape shape({2, 3, 4, 5});
+  EXPECT_EQ(shape.Slice(1, 3), TensorShape({3, 4}));
+  EXPECT_EQ(shape.Slice(2), TensorShape({4, 5}));
+  EXPECT_EQ(shape.SizeToDimension(2), 6);
+  EXPECT_EQ(shape.SizeFromDimension(2), 20);
+
+  EXPECT_TRUE(TensorShape().IsScalar());
+  EXPECT_TRUE(TensorShape({1}).IsScalar());
+  EXPECT_FALSE(TensorShape({2}).IsScalar());
+}
+
+TEST(TensorShapeTest, ReinterpretBaseType) {
+  std::vector<int64_t> dims{4, 2};
+  const TensorShape& shape = TensorShape::ReinterpretBaseType(dims);
+  EXPECT_EQ(shape.GetDims(), dims);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -210,5 +210,31 @@ TEST(TensorTest, SizeOverflow) {
   Tensor t(type, shape1, nullptr, alloc->Info());
   EXPECT_THROW(t.SizeInBytes(), OnnxRuntimeException);
 }
+
+TEST(TensorTest, SetShapeWithinCapacity) {
+  auto type = DataTypeImpl::GetType<float>();
+  auto alloc = TestCPUExecutionProvider()->GetAllocator(0, OrtMemTypeDefault);
+
+  Tensor t(type, TensorShape({4, 3}), alloc);
+  EXPECT_EQ(t.CapacityInBytes(), 12 * sizeof(float));
+  void* data = t.MutableDataRaw();
+
+  // shrink to a smaller shape. the buffer and its capacity are untouched.
+  EXPECT_TRUE(t.SetShapeWithinCapacity(TensorShape({2, 3})).IsOK());
+  EXPECT_EQ(t.Shape(), TensorShape({2, 3}));
+  EXPECT_EQ(t.MutableDataRaw(), data);
+  EXPECT_EQ(t.CapacityInBytes(), 12 * sizeof(float));
+
+  // grow back up to the original capacity
+  EXPECT_TRUE(t.SetShapeWithinCapacity(TensorShape({12})).IsOK());
+  EXPECT_EQ(t.Shape(), TensorShape({12}));
+
+  // growing beyond the capacity is rejected
+  EXPECT_FALSE(t.SetShapeWithinCapacity(TensorShape({13})).IsOK());
+
+  // string tensors are not supported as the number of constructed strings is fixed
+  Tensor s(DataTypeImpl::GetType<std::string>(), TensorShape({2}), alloc);
+  EXPECT_FALSE(s.SetShapeWithinCapacity(TensorShape({1})).IsOK());
+}
 }  // namespace test
 }  // namespace onnxruntime
@@ -1578,6 +1578,26 @@ TEST_F(GraphTest, DuplicateName) {
   EXPECT_TRUE(duplicate_error_found);
 }
 
+TEST_F(GraphTest, InternedStringPool) {
+  Model model("graph_1", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  // interning the same contents twice returns the same pooled copy
+  const std::string& first = model.InternString("some_arg_name");
+  std::string other_copy = "some_arg_name";
+  const std::string& second = model.InternString(other_copy);
+  EXPECT_EQ(&first, &second);
+  EXPECT_NE(&first, &other_copy);
+
+  // node arg lookups work through any string holding the name, not just the pooled/owned copy
+  TypeProto tensor_type;
+  tensor_type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  auto& arg = graph.GetOrCreateNodeArg("X", &tensor_type);
+  std::string lookup_name = "X";
+  EXPECT_EQ(graph.GetNodeArg(lookup_name), &arg);
+  EXPECT_EQ(&graph.GetOrCreateNodeArg(lookup_name, nullptr), &arg);
+}
+
 TEST_F(GraphTest, ReplaceInitializedTensor) {
   Model model{"GraphUpdateTest", false, *logger_};
   auto& graph = model.MainGraph();
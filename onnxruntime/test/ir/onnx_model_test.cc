@@ -3,6 +3,7 @@
 
 #include <google/protobuf/io/zero_copy_stream_impl.h>
 #include <memory>
+#include "core/common/path_string.h"
 #include "core/platform/env.h"
 #include "core/graph/graph_viewer.h"
 #include "core/graph/model.h"
@@ -187,5 +188,54 @@ TEST_F(ONNXModelsTest, TestModelsWithAnOpContainingAFunctionBody) {
   ASSERT_STATUS_OK(model->MainGraph().Resolve());
 }
 
+// LoadMetadata should keep the model's structure (nodes, inputs/outputs, opset imports and
+// initializer metadata) while dropping the initializer payloads.
+TEST_F(ONNXModelsTest, LoadMetadataSkipsInitializerPayload) {
+  Model model("LoadMetadataTest", false, *logger_);
+  auto& graph = model.MainGraph();
+
+  TypeProto float_tensor;
+  float_tensor.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  float_tensor.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+
+  auto& input_arg = graph.GetOrCreateNodeArg("X", &float_tensor);
+  auto& weight_arg = graph.GetOrCreateNodeArg("W", &float_tensor);
+  auto& output_arg = graph.GetOrCreateNodeArg("Y", &float_tensor);
+
+  TensorProto weight;
+  weight.set_name("W");
+  weight.add_dims(2);
+  weight.set_data_type(TensorProto_DataType_FLOAT);
+  const float weight_values[2] = {1.f, 2.f};
+  weight.set_raw_data(weight_values, sizeof(weight_values));
+  graph.AddInitializedTensor(weight);
+
+  graph.AddNode("add", "Add", "", {&input_arg, &weight_arg}, {&output_arg});
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  const std::string model_path = "testdata/load_metadata_test.onnx";
+  ASSERT_STATUS_OK(Model::Save(model, model_path));
+
+  ModelProto metadata_proto;
+  ASSERT_STATUS_OK(Model::LoadMetadata(ToPathString(model_path), metadata_proto));
+
+  ASSERT_EQ(metadata_proto.graph().node_size(), 1);
+  ASSERT_EQ(metadata_proto.graph().initializer_size(), 1);
+  const auto& stripped = metadata_proto.graph().initializer(0);
+  EXPECT_EQ(stripped.name(), "W");
+  ASSERT_EQ(stripped.dims_size(), 1);
+  EXPECT_EQ(stripped.dims(0), 2);
+  EXPECT_EQ(stripped.data_type(), TensorProto_DataType_FLOAT);
+  EXPECT_FALSE(stripped.has_raw_data());
+  EXPECT_EQ(stripped.float_data_size(), 0);
+
+  // The stripped proto still exposes the same signature as a full parse.
+  ModelProto full_proto;
+  ASSERT_STATUS_OK(Model::Load(ToPathString(model_path), full_proto));
+  EXPECT_EQ(metadata_proto.graph().input_size(), full_proto.graph().input_size());
+  EXPECT_EQ(metadata_proto.graph().output_size(), full_proto.graph().output_size());
+  EXPECT_EQ(metadata_proto.opset_import_size(), full_proto.opset_import_size());
+}
+
 }  // namespace test
 }  // namespace onnxruntime
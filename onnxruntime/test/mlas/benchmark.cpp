@@ -0,0 +1,548 @@
+/*++
+
+Copyright (c) Microsoft Corporation. All rights reserved.
+
+Licensed under the MIT License.
+
+Module Name:
+
+    benchmark.cpp
+
+Abstract:
+
+    This module implements micro-benchmarks of the MLAS library using the
+    google benchmark framework.
+
+    Each benchmark sweeps a corpus of production shapes and a set of thread
+    counts. The compute bound kernels report a FLOPS counter and the memory
+    bound kernels report the bytes processed so results can be compared
+    against machine peaks.
+
+--*/
+
+#include <benchmark/benchmark.h>
+
+#include <algorithm>
+#include <map>
+#include <memory>
+#include <random>
+#include <vector>
+
+#include <mlas.h>
+
+#include "core/platform/threadpool.h"
+
+//
+// The thread pools used by the benchmarks, keyed and created on demand by
+// the requested thread count. A thread count of one runs the single threaded
+// code paths directly without a thread pool.
+//
+
+MLAS_THREADPOOL*
+GetThreadPool(
+    int64_t ThreadCount
+    )
+{
+    static std::map<int64_t, std::unique_ptr<onnxruntime::concurrency::ThreadPool>> pools;
+
+    if (ThreadCount <= 1) {
+        return nullptr;
+    }
+
+    auto& pool = pools[ThreadCount];
+
+    if (pool == nullptr) {
+        pool.reset(new onnxruntime::concurrency::ThreadPool(
+            &onnxruntime::Env::Default(), onnxruntime::ThreadOptions(), nullptr,
+            static_cast<int>(ThreadCount), true));
+    }
+
+    return pool.get();
+}
+
+//
+// Returns a buffer of the supplied element count filled with a fixed seed
+// uniform random distribution.
+//
+
+template<typename ElementType>
+std::vector<ElementType>
+RandomBuffer(
+    size_t Elements,
+    float MinimumValue = -1.0f,
+    float MaximumValue = 1.0f
+    )
+{
+    std::vector<ElementType> buffer(Elements);
+
+    std::default_random_engine generator(static_cast<unsigned>(Elements));
+    std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+
+    for (size_t i = 0; i < Elements; i++) {
+        buffer[i] = ElementType(distribution(generator));
+    }
+
+    return buffer;
+}
+
+//
+// The shape corpus shared by the GEMM benchmarks: transformer layers
+// (sequence length 128 and 384 against the BERT base hidden and feed
+// forward dimensions), pointwise convolution shapes and square reference
+// points.
+//
+
+static
+void
+GemmShapes(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"M", "N", "K", "Threads"});
+
+    static const int64_t shapes[][3] = {
+        {128, 768, 768},
+        {128, 3072, 768},
+        {128, 768, 3072},
+        {384, 768, 768},
+        {384, 3072, 768},
+        {384, 768, 3072},
+        {196, 256, 1024},
+        {784, 128, 512},
+        {512, 512, 512},
+        {1024, 1024, 1024},
+    };
+
+    for (int64_t threads : {1, 4, 8}) {
+        for (const auto& shape : shapes) {
+            b->Args({shape[0], shape[1], shape[2], threads});
+        }
+    }
+}
+
+static
+void
+BM_Sgemm(
+    benchmark::State& state
+    )
+{
+    const size_t M = size_t(state.range(0));
+    const size_t N = size_t(state.range(1));
+    const size_t K = size_t(state.range(2));
+
+    MLAS_THREADPOOL* threadpool = GetThreadPool(state.range(3));
+
+    auto A = RandomBuffer<float>(M * K);
+    auto B = RandomBuffer<float>(K * N);
+    std::vector<float> C(M * N);
+
+    for (auto _ : state) {
+        MlasGemm(CblasNoTrans, CblasNoTrans, M, N, K, 1.0f, A.data(), K,
+            B.data(), N, 0.0f, C.data(), N, threadpool);
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(
+        double(state.iterations()) * 2.0 * double(M) * double(N) * double(K),
+        benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_Sgemm)->Apply(GemmShapes)->UseRealTime();
+
+static
+void
+BM_SgemmPackedB(
+    benchmark::State& state
+    )
+{
+    const size_t M = size_t(state.range(0));
+    const size_t N = size_t(state.range(1));
+    const size_t K = size_t(state.range(2));
+
+    MLAS_THREADPOOL* threadpool = GetThreadPool(state.range(3));
+
+    auto A = RandomBuffer<float>(M * K);
+    auto B = RandomBuffer<float>(K * N);
+    std::vector<float> C(M * N);
+
+    std::vector<uint8_t> PackedB(MlasGemmPackBSize(N, K));
+    MlasGemmPackB(CblasNoTrans, N, K, B.data(), N, PackedB.data());
+
+    for (auto _ : state) {
+        MlasGemm(CblasNoTrans, M, N, K, 1.0f, A.data(), K, PackedB.data(),
+            0.0f, C.data(), N, threadpool);
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(
+        double(state.iterations()) * 2.0 * double(M) * double(N) * double(K),
+        benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_SgemmPackedB)->Apply(GemmShapes)->UseRealTime();
+
+static
+void
+BM_Qgemm(
+    benchmark::State& state
+    )
+{
+    const size_t M = size_t(state.range(0));
+    const size_t N = size_t(state.range(1));
+    const size_t K = size_t(state.range(2));
+
+    MLAS_THREADPOOL* threadpool = GetThreadPool(state.range(3));
+
+    auto A = RandomBuffer<uint8_t>(M * K, 0.0f, 255.0f);
+    auto B = RandomBuffer<uint8_t>(K * N, 0.0f, 255.0f);
+    std::vector<int32_t> C(M * N);
+
+    for (auto _ : state) {
+        MlasGemm(M, N, K, A.data(), K, 18, B.data(), N, 24, true,
+            C.data(), N, threadpool);
+    }
+
+    state.counters["OPS"] = benchmark::Counter(
+        double(state.iterations()) * 2.0 * double(M) * double(N) * double(K),
+        benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_Qgemm)->Apply(GemmShapes)->UseRealTime();
+
+//
+// The convolution corpus covers the pointwise, spatial and depthwise
+// separable layers of the common image models at batch size one.
+//
+
+static
+void
+ConvShapes(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"C", "HW", "F", "KHW", "Threads"});
+
+    static const int64_t shapes[][4] = {
+        {64, 56, 64, 1},
+        {64, 56, 64, 3},
+        {128, 28, 128, 3},
+        {256, 14, 256, 3},
+        {256, 14, 1024, 1},
+        {512, 7, 512, 3},
+        {3, 224, 64, 7},
+    };
+
+    for (int64_t threads : {1, 4, 8}) {
+        for (const auto& shape : shapes) {
+            b->Args({shape[0], shape[1], shape[2], shape[3], threads});
+        }
+    }
+}
+
+static
+void
+BM_Conv2d(
+    benchmark::State& state
+    )
+{
+    const size_t InputChannels = size_t(state.range(0));
+    const size_t InputDim = size_t(state.range(1));
+    const size_t FilterCount = size_t(state.range(2));
+    const size_t KernelDim = size_t(state.range(3));
+
+    MLAS_THREADPOOL* threadpool = GetThreadPool(state.range(4));
+
+    const int64_t InputShape[] = {int64_t(InputDim), int64_t(InputDim)};
+    const int64_t KernelShape[] = {int64_t(KernelDim), int64_t(KernelDim)};
+    const int64_t DilationShape[] = {1, 1};
+    const int64_t Padding[] = {int64_t(KernelDim / 2), int64_t(KernelDim / 2),
+        int64_t(KernelDim / 2), int64_t(KernelDim / 2)};
+    const int64_t StrideShape[] = {1, 1};
+    const int64_t OutputShape[] = {int64_t(InputDim), int64_t(InputDim)};
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = MlasIdentityActivation;
+
+    MLAS_CONV_PARAMETERS Parameters;
+    size_t WorkingBufferSize;
+
+    MlasConvPrepare(&Parameters, 2, 1, 1, InputChannels, InputShape,
+        KernelShape, DilationShape, Padding, StrideShape, OutputShape,
+        FilterCount, &Activation, &WorkingBufferSize, threadpool);
+
+    auto Input = RandomBuffer<float>(InputChannels * Parameters.InputSize);
+    auto Filter = RandomBuffer<float>(FilterCount * InputChannels * KernelDim * KernelDim);
+    auto Bias = RandomBuffer<float>(FilterCount);
+    std::vector<float> WorkingBuffer(std::max(WorkingBufferSize, size_t(1)));
+    std::vector<float> Output(FilterCount * Parameters.OutputSize);
+
+    for (auto _ : state) {
+        MlasConv(&Parameters, Input.data(), Filter.data(), Bias.data(),
+            WorkingBuffer.data(), Output.data(), threadpool);
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(
+        double(state.iterations()) * 2.0 * double(FilterCount) *
+            double(Parameters.OutputSize) * double(Parameters.K),
+        benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_Conv2d)->Apply(ConvShapes)->UseRealTime();
+
+static
+void
+BM_NchwcConv2d(
+    benchmark::State& state
+    )
+{
+    const size_t BlockSize = MlasNchwcGetBlockSize();
+
+    if (BlockSize <= 1) {
+        state.SkipWithError("NCHWc not supported on this platform");
+        return;
+    }
+
+    const size_t InputChannels = size_t(state.range(0));
+    const size_t InputDim = size_t(state.range(1));
+    const size_t FilterCount = size_t(state.range(2));
+    const size_t KernelDim = size_t(state.range(3));
+
+    MLAS_THREADPOOL* threadpool = GetThreadPool(state.range(4));
+
+    //
+    // Round the channel counts up to the platform block size as the NCHWc
+    // reorder does.
+    //
+
+    const size_t AlignedInputChannels = (InputChannels + BlockSize - 1) & ~(BlockSize - 1);
+    const size_t AlignedFilterCount = (FilterCount + BlockSize - 1) & ~(BlockSize - 1);
+
+    const int64_t InputShape[] = {1, int64_t(AlignedInputChannels),
+        int64_t(InputDim), int64_t(InputDim)};
+    const int64_t KernelShape[] = {int64_t(KernelDim), int64_t(KernelDim)};
+    const int64_t DilationShape[] = {1, 1};
+    const int64_t Padding[] = {int64_t(KernelDim / 2), int64_t(KernelDim / 2),
+        int64_t(KernelDim / 2), int64_t(KernelDim / 2)};
+    const int64_t StrideShape[] = {1, 1};
+    const int64_t OutputShape[] = {1, int64_t(AlignedFilterCount),
+        int64_t(InputDim), int64_t(InputDim)};
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = MlasIdentityActivation;
+
+    const size_t InputSize = InputDim * InputDim;
+
+    auto Input = RandomBuffer<float>(AlignedInputChannels * InputSize);
+    auto Filter = RandomBuffer<float>(AlignedFilterCount * AlignedInputChannels * KernelDim * KernelDim);
+    auto Bias = RandomBuffer<float>(AlignedFilterCount);
+    std::vector<float> Output(AlignedFilterCount * InputSize);
+
+    for (auto _ : state) {
+        MlasNchwcConv(InputShape, KernelShape, DilationShape, Padding,
+            StrideShape, OutputShape, 1, Input.data(), Filter.data(),
+            Bias.data(), Output.data(), &Activation, true, threadpool);
+    }
+
+    state.counters["FLOPS"] = benchmark::Counter(
+        double(state.iterations()) * 2.0 * double(AlignedFilterCount) * double(InputSize) *
+            double(AlignedInputChannels) * double(KernelDim) * double(KernelDim),
+        benchmark::Counter::kIsRate);
+}
+
+BENCHMARK(BM_NchwcConv2d)->Apply(ConvShapes)->UseRealTime();
+
+static
+void
+PoolShapes(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"Kind", "C", "HW", "KHW", "Threads"});
+
+    for (int64_t threads : {1, 4}) {
+        for (int64_t kind : {int64_t(MlasMaximumPooling), int64_t(MlasAveragePoolingExcludePad)}) {
+            b->Args({kind, 64, 112, 3, threads});
+            b->Args({kind, 256, 28, 2, threads});
+            b->Args({kind, 512, 14, 3, threads});
+        }
+    }
+}
+
+static
+void
+BM_Pool2d(
+    benchmark::State& state
+    )
+{
+    const auto PoolingKind = MLAS_POOLING_KIND(state.range(0));
+    const size_t Channels = size_t(state.range(1));
+    const size_t InputDim = size_t(state.range(2));
+    const size_t KernelDim = size_t(state.range(3));
+
+    MLAS_THREADPOOL* threadpool = GetThreadPool(state.range(4));
+
+    const size_t OutputDim = InputDim - KernelDim + 1;
+
+    const int64_t InputShape[] = {1, int64_t(Channels), int64_t(InputDim), int64_t(InputDim)};
+    const int64_t KernelShape[] = {int64_t(KernelDim), int64_t(KernelDim)};
+    const int64_t Padding[] = {0, 0, 0, 0};
+    const int64_t StrideShape[] = {1, 1};
+    const int64_t OutputShape[] = {1, int64_t(Channels), int64_t(OutputDim), int64_t(OutputDim)};
+
+    auto Input = RandomBuffer<float>(Channels * InputDim * InputDim);
+    std::vector<float> Output(Channels * OutputDim * OutputDim);
+
+    for (auto _ : state) {
+        MlasPool(PoolingKind, 2, InputShape, KernelShape, Padding, StrideShape,
+            OutputShape, Input.data(), Output.data(), threadpool);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) *
+        int64_t(Channels * InputDim * InputDim * sizeof(float)));
+}
+
+BENCHMARK(BM_Pool2d)->Apply(PoolShapes)->UseRealTime();
+
+//
+// The elementwise kernels are memory bound, so sweep buffer sizes from cache
+// resident to memory resident and report the bandwidth.
+//
+
+static
+void
+ElementwiseShapes(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"N"});
+
+    for (int64_t n = 1024; n <= 4 * 1024 * 1024; n *= 16) {
+        b->Args({n});
+    }
+}
+
+template<typename OutputType>
+static
+void
+BM_QuantizeLinear(
+    benchmark::State& state
+    )
+{
+    const size_t N = size_t(state.range(0));
+
+    auto Input = RandomBuffer<float>(N, -16.0f, 16.0f);
+    std::vector<OutputType> Output(N);
+
+    for (auto _ : state) {
+        MlasQuantizeLinear(Input.data(), Output.data(), N, 0.125f, OutputType(7));
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) *
+        int64_t(N * (sizeof(float) + sizeof(OutputType))));
+}
+
+BENCHMARK_TEMPLATE(BM_QuantizeLinear, int8_t)->Apply(ElementwiseShapes);
+BENCHMARK_TEMPLATE(BM_QuantizeLinear, uint8_t)->Apply(ElementwiseShapes);
+
+static
+void
+BM_RequantizeOutput(
+    benchmark::State& state
+    )
+{
+    const size_t N = size_t(state.range(0));
+    const size_t CountN = 256;
+    const size_t CountM = std::max(N / CountN, size_t(1));
+
+    auto Input = RandomBuffer<float>(CountM * CountN, -4096.0f, 4096.0f);
+    std::vector<int32_t> InputInt32(CountM * CountN);
+    std::vector<int32_t> Bias(CountN, 112);
+    std::vector<uint8_t> Output(CountM * CountN);
+
+    for (size_t i = 0; i < InputInt32.size(); i++) {
+        InputInt32[i] = int32_t(Input[i]);
+    }
+
+    const float Scale = 0.125f;
+
+    for (auto _ : state) {
+        MlasRequantizeOutput(InputInt32.data(), Output.data(), Bias.data(),
+            CountM, CountN, &Scale, false, 100);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) *
+        int64_t(CountM * CountN * (sizeof(int32_t) + sizeof(uint8_t))));
+}
+
+BENCHMARK(BM_RequantizeOutput)->Apply(ElementwiseShapes);
+
+static
+void
+ActivationKinds(
+    benchmark::internal::Benchmark* b
+    )
+{
+    b->ArgNames({"Kind", "N"});
+
+    for (int64_t kind : {int64_t(MlasReluActivation), int64_t(MlasLeakyReluActivation),
+        int64_t(MlasTanhActivation), int64_t(MlasLogisticActivation),
+        int64_t(MlasClipActivation)}) {
+        for (int64_t n = 1024; n <= 1024 * 1024; n *= 32) {
+            b->Args({kind, n});
+        }
+    }
+}
+
+static
+void
+BM_Activation(
+    benchmark::State& state
+    )
+{
+    const auto ActivationKind = MLAS_ACTIVATION_KIND(state.range(0));
+    const size_t N = size_t(state.range(1));
+
+    MLAS_ACTIVATION Activation;
+    Activation.ActivationKind = ActivationKind;
+
+    if (ActivationKind == MlasLeakyReluActivation) {
+        Activation.Parameters.LeakyRelu.alpha = 0.125f;
+    } else if (ActivationKind == MlasClipActivation) {
+        Activation.Parameters.Clip.minimum = -4.0f;
+        Activation.Parameters.Clip.maximum = 4.0f;
+    }
+
+    auto Input = RandomBuffer<float>(N, -8.0f, 8.0f);
+    std::vector<float> Buffer(N);
+
+    for (auto _ : state) {
+        std::copy(Input.begin(), Input.end(), Buffer.begin());
+        MlasActivation(&Activation, Buffer.data(), nullptr, 1, N, N);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) *
+        int64_t(N * 2 * sizeof(float)));
+}
+
+BENCHMARK(BM_Activation)->Apply(ActivationKinds);
+
+static
+void
+BM_ComputeExp(
+    benchmark::State& state
+    )
+{
+    const size_t N = size_t(state.range(0));
+
+    auto Input = RandomBuffer<float>(N, -8.0f, 8.0f);
+    std::vector<float> Output(N);
+
+    for (auto _ : state) {
+        MlasComputeExp(Input.data(), Output.data(), N);
+    }
+
+    state.SetBytesProcessed(int64_t(state.iterations()) *
+        int64_t(N * 2 * sizeof(float)));
+}
+
+BENCHMARK(BM_ComputeExp)->Apply(ElementwiseShapes);
+
+BENCHMARK_MAIN();
@@ -17,6 +17,7 @@ Abstract:
 #include <stdio.h>
 #include <memory.h>
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <random>
@@ -536,6 +537,459 @@ public:
     }
 };
 
+class MlasFgemmBatchTest : public MlasTestBase
+{
+private:
+    void
+    Test(
+        CBLAS_TRANSPOSE TransA,
+        CBLAS_TRANSPOSE TransB,
+        size_t M,
+        size_t N,
+        size_t K,
+        size_t BatchSize,
+        bool SharedB,
+        float alpha,
+        float beta
+        )
+    {
+        const size_t StrideA = M * K;
+        const size_t StrideB = SharedB ? 0 : N * K;
+        const size_t StrideC = M * N;
+
+        const float* A = BufferA.GetBuffer(StrideA * BatchSize);
+        const float* B = BufferB.GetBuffer(N * K * (SharedB ? 1 : BatchSize));
+        float* C = BufferC.GetBuffer(StrideC * BatchSize);
+        float* CReference = BufferCReference.GetBuffer(StrideC * BatchSize);
+
+        const size_t lda = (TransA == CblasNoTrans) ? K : M;
+        const size_t ldb = (TransB == CblasNoTrans) ? N : K;
+
+        std::fill_n(C, StrideC * BatchSize, -0.5f);
+        std::fill_n(CReference, StrideC * BatchSize, -0.5f);
+
+        MlasGemmBatch(TransA, TransB, M, N, K, alpha, A, lda, StrideA, B, ldb, StrideB,
+            beta, C, N, StrideC, BatchSize, threadpool);
+
+        //
+        // The batched variant must match per-call MlasGemm on every matrix.
+        //
+
+        for (size_t batch = 0; batch < BatchSize; batch++) {
+            MlasGemm(TransA, TransB, M, N, K, alpha, A + batch * StrideA, lda,
+                B + batch * StrideB, ldb, beta, CReference + batch * StrideC, N, threadpool);
+        }
+
+        for (size_t f = 0; f < StrideC * BatchSize; f++) {
+            // Sensitive to comparing positive/negative zero.
+            if (C[f] != CReference[f]) {
+                printf("mismatch TransA=%d, TransB=%d, M=%zd, N=%zd, K=%zd, BatchSize=%zd, alpha=%f, beta=%f  %f %f!\n", TransA, TransB, M, N, K, BatchSize, alpha, beta, float(C[f]), float(CReference[f]));
+                break;
+            }
+        }
+    }
+
+    void
+    Test(
+        size_t M,
+        size_t N,
+        size_t K,
+        size_t BatchSize
+        )
+    {
+        for (bool SharedB : { false, true }) {
+            Test(CblasNoTrans, CblasNoTrans, M, N, K, BatchSize, SharedB, 1.0f, 0.0f);
+            Test(CblasNoTrans, CblasTrans, M, N, K, BatchSize, SharedB, 1.0f, 1.0f);
+            Test(CblasTrans, CblasNoTrans, M, N, K, BatchSize, SharedB, 0.25f, 0.0f);
+        }
+    }
+
+    MatrixGuardBuffer<float> BufferA;
+    MatrixGuardBuffer<float> BufferB;
+    MatrixGuardBuffer<float> BufferC;
+    MatrixGuardBuffer<float> BufferCReference;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        for (size_t b = 1; b <= 5; b++) {
+            Test(b, b, b, 3);
+        }
+        Test(1, 32, 64, 2);
+        Test(32, 32, 32, 12);
+        Test(128, 128, 64, 24);
+        Test(65, 7, 33, 9);
+    }
+};
+
+class MlasBf16GemmTest : public MlasTestBase
+{
+private:
+    void
+    TestConvert(
+        void
+        )
+    {
+        //
+        // Round to nearest even and NaN preservation.
+        //
+
+        const float FloatValues[] = { 0.0f, -0.0f, 1.0f, -1.0f, 0.4999f, 1.0039062f, 3.1415926f,
+            std::numeric_limits<float>::infinity(), std::numeric_limits<float>::quiet_NaN() };
+        uint16_t Bf16Values[_countof(FloatValues)];
+        float RoundTripValues[_countof(FloatValues)];
+
+        MlasConvertFloatToBFloat16(FloatValues, Bf16Values, _countof(FloatValues));
+        MlasConvertBFloat16ToFloat(Bf16Values, RoundTripValues, _countof(FloatValues));
+
+        for (size_t f = 0; f < _countof(FloatValues); f++) {
+
+            if (FloatValues[f] != FloatValues[f]) {
+                if (RoundTripValues[f] == RoundTripValues[f]) {
+                    printf("bf16 convert failed to preserve NaN!\n");
+                }
+                continue;
+            }
+
+            const float Error = std::fabs(RoundTripValues[f] - FloatValues[f]);
+
+            // bfloat16 has an 8 bit mantissa, so the round trip must be within
+            // half a unit in the last place of the source value.
+            if (Error > std::fabs(FloatValues[f]) * 0.00390625f) {
+                printf("bf16 convert mismatch %f %f!\n", FloatValues[f], RoundTripValues[f]);
+            }
+        }
+    }
+
+    void
+    Test(
+        CBLAS_TRANSPOSE TransA,
+        CBLAS_TRANSPOSE TransB,
+        size_t M,
+        size_t N,
+        size_t K,
+        float alpha,
+        float beta
+        )
+    {
+        const float* A = BufferA.GetBuffer(K * M);
+        const float* B = BufferB.GetBuffer(N * K);
+        uint16_t* ABf16 = BufferABf16.GetBuffer(K * M);
+        uint16_t* BBf16 = BufferBBf16.GetBuffer(N * K);
+        float* C = BufferC.GetBuffer(N * M);
+        float* CReference = BufferCReference.GetBuffer(N * M);
+
+        MlasConvertFloatToBFloat16(A, ABf16, K * M);
+        MlasConvertFloatToBFloat16(B, BBf16, N * K);
+
+        const size_t lda = (TransA == CblasNoTrans) ? K : M;
+        const size_t ldb = (TransB == CblasNoTrans) ? N : K;
+
+        std::fill_n(C, M * N, -0.5f);
+        std::fill_n(CReference, M * N, -0.5f);
+
+        MlasGemm(TransA, TransB, M, N, K, alpha, ABf16, lda, BBf16, ldb, beta, C, N, threadpool);
+
+        //
+        // The test buffers hold small integers that bfloat16 represents
+        // exactly, so the result must match a float GEMM over the converted
+        // values up to the float accumulation order.
+        //
+
+        MlasGemm(TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, CReference, N, threadpool);
+
+        for (size_t f = 0; f < M * N; f++) {
+            const float Error = std::fabs(C[f] - CReference[f]);
+            if (Error > std::fabs(CReference[f]) * 0.0001f + 0.0001f) {
+                printf("bf16 gemm mismatch TransA=%d, TransB=%d, M=%zd, N=%zd, K=%zd, alpha=%f, beta=%f  %f %f!\n", TransA, TransB, M, N, K, alpha, beta, float(C[f]), float(CReference[f]));
+                break;
+            }
+        }
+    }
+
+    void
+    Test(
+        size_t M,
+        size_t N,
+        size_t K,
+        float alpha,
+        float beta
+        )
+    {
+        Test(CblasNoTrans, CblasNoTrans, M, N, K, alpha, beta);
+        Test(CblasNoTrans, CblasTrans, M, N, K, alpha, beta);
+        Test(CblasTrans, CblasNoTrans, M, N, K, alpha, beta);
+        Test(CblasTrans, CblasTrans, M, N, K, alpha, beta);
+    }
+
+    MatrixGuardBuffer<float> BufferA;
+    MatrixGuardBuffer<float> BufferB;
+    MatrixGuardBuffer<uint16_t> BufferABf16;
+    MatrixGuardBuffer<uint16_t> BufferBBf16;
+    MatrixGuardBuffer<float> BufferC;
+    MatrixGuardBuffer<float> BufferCReference;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        TestConvert();
+
+        for (size_t b = 1; b < 16; b++) {
+            Test(b, b, b, 1.0f, 0.0f);
+        }
+        for (size_t b = 16; b <= 256; b <<= 1) {
+            Test(b, b, b, 1.0f, 0.0f);
+        }
+
+        Test(65, 33, 129, 1.0f, 0.0f);
+        Test(128, 500, 177, 0.5f, 1.0f);
+        Test(1, 347, 1309, 1.0f, 0.0f);
+    }
+};
+
+class MlasSparseGemmTest : public MlasTestBase
+{
+private:
+    void
+    Test(
+        CBLAS_TRANSPOSE TransA,
+        CBLAS_TRANSPOSE TransB,
+        size_t M,
+        size_t N,
+        size_t K,
+        size_t KeepBlocks,
+        float alpha,
+        float beta
+        )
+    {
+        const float* A = BufferA.GetBuffer(K * M);
+        float* B = BufferB.GetBuffer(N * K);
+        float* C = BufferC.GetBuffer(N * M);
+        float* CReference = BufferCReference.GetBuffer(N * M);
+
+        const size_t lda = (TransA == CblasNoTrans) ? K : M;
+        const size_t ldb = (TransB == CblasNoTrans) ? N : K;
+
+        //
+        // Prune 4x4 blocks of matrix B to zero, keeping KeepBlocks out of
+        // every 16 blocks alive in a strided pattern.
+        //
+
+        for (size_t kb = 0; kb < K / 4; kb++) {
+            for (size_t nb = 0; nb < N / 4; nb++) {
+                if (((kb * 7 + nb * 3) % 16) < KeepBlocks) {
+                    continue;
+                }
+                for (size_t i = 0; i < 4; i++) {
+                    for (size_t j = 0; j < 4; j++) {
+                        const size_t k = kb * 4 + i;
+                        const size_t n = nb * 4 + j;
+                        B[(TransB == CblasNoTrans) ? (k * ldb + n) : (n * ldb + k)] = 0.0f;
+                    }
+                }
+            }
+        }
+
+        const size_t PackedBSize = MlasSparseGemmPackBSize(TransB, N, K, B, ldb);
+
+        if (PackedBSize == 0) {
+            printf("sparse gemm pack refused M=%zd, N=%zd, K=%zd, KeepBlocks=%zd!\n", M, N, K, KeepBlocks);
+            return;
+        }
+
+        void* PackedB = BufferBPacked.GetBuffer(PackedBSize, true);
+        MlasSparseGemmPackB(TransB, N, K, B, ldb, PackedB);
+
+        std::fill_n(C, M * N, -0.5f);
+        std::fill_n(CReference, M * N, -0.5f);
+
+        MlasSparseGemm(TransA, M, N, K, alpha, A, lda, PackedB, beta, C, N, threadpool);
+
+        //
+        // The test buffers hold small integers, so the sparse result must
+        // exactly match a dense GEMM over the pruned matrix.
+        //
+
+        MlasGemm(TransA, TransB, M, N, K, alpha, A, lda, B, ldb, beta, CReference, N, threadpool);
+
+        for (size_t f = 0; f < M * N; f++) {
+            if (C[f] != CReference[f]) {
+                printf("sparse gemm mismatch TransA=%d, TransB=%d, M=%zd, N=%zd, K=%zd, alpha=%f, beta=%f  %f %f!\n", TransA, TransB, M, N, K, alpha, beta, float(C[f]), float(CReference[f]));
+                break;
+            }
+        }
+    }
+
+    void
+    TestDenseRefused(
+        void
+        )
+    {
+        //
+        // A fully dense matrix must be refused by the size query.
+        //
+
+        const size_t N = 64;
+        const size_t K = 64;
+
+        float* B = BufferB.GetBuffer(N * K);
+
+        for (size_t f = 0; f < N * K; f++) {
+            B[f] = 1.0f;
+        }
+
+        if (MlasSparseGemmPackBSize(CblasNoTrans, N, K, B, N) != 0) {
+            printf("sparse gemm pack accepted a dense matrix!\n");
+        }
+    }
+
+    void
+    Test(
+        size_t M,
+        size_t N,
+        size_t K,
+        size_t KeepBlocks
+        )
+    {
+        Test(CblasNoTrans, CblasNoTrans, M, N, K, KeepBlocks, 1.0f, 0.0f);
+        Test(CblasNoTrans, CblasTrans, M, N, K, KeepBlocks, 1.0f, 1.0f);
+        Test(CblasTrans, CblasNoTrans, M, N, K, KeepBlocks, 0.25f, 0.0f);
+        Test(CblasTrans, CblasTrans, M, N, K, KeepBlocks, 1.0f, 0.5f);
+    }
+
+    MatrixGuardBuffer<float> BufferA;
+    MatrixGuardBuffer<float> BufferB;
+    MatrixGuardBuffer<uint8_t> BufferBPacked;
+    MatrixGuardBuffer<float> BufferC;
+    MatrixGuardBuffer<float> BufferCReference;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        TestDenseRefused();
+
+        for (size_t b = 16; b <= 256; b <<= 1) {
+            Test(b, b, b, 4);
+        }
+
+        Test(1, 64, 512, 4);
+        Test(65, 48, 132, 2);
+        Test(128, 768, 256, 0);
+    }
+};
+
+class MlasSgemmEpilogueTest : public MlasTestBase
+{
+private:
+    void
+    Test(
+        CBLAS_TRANSPOSE TransA,
+        CBLAS_TRANSPOSE TransB,
+        size_t M,
+        size_t N,
+        size_t K,
+        MLAS_ACTIVATION_KIND ActivationKind,
+        bool WithBias,
+        bool WithAddSource
+        )
+    {
+        const float* A = BufferA.GetBuffer(K * M);
+        const float* B = BufferB.GetBuffer(N * K);
+        const float* Bias = WithBias ? BufferBias.GetBuffer(M) : nullptr;
+        const float* AddSource = WithAddSource ? BufferAddSource.GetBuffer(M * N) : nullptr;
+        float* C = BufferC.GetBuffer(M * N);
+        float* CReference = BufferCReference.GetBuffer(M * N);
+
+        const size_t lda = (TransA == CblasNoTrans) ? K : M;
+        const size_t ldb = (TransB == CblasNoTrans) ? N : K;
+
+        MLAS_ACTIVATION Activation;
+        Activation.ActivationKind = ActivationKind;
+
+        if (ActivationKind == MlasLeakyReluActivation) {
+            Activation.Parameters.LeakyRelu.alpha = 0.125f;
+        } else if (ActivationKind == MlasClipActivation) {
+            Activation.Parameters.Clip.minimum = -64.0f;
+            Activation.Parameters.Clip.maximum = 128.0f;
+        }
+
+        MLAS_SGEMM_ACTIVATION_OUTPUT_PROCESSOR Processor(&Activation, Bias, AddSource, N);
+
+        MlasGemm(TransA, TransB, M, N, K, 1.0f, A, lda, B, ldb, 0.0f, C, N,
+            threadpool, &Processor);
+
+        //
+        // The fused epilogue must match a plain GEMM followed by a separate
+        // pass over the output matrix.
+        //
+
+        MlasGemm(TransA, TransB, M, N, K, 1.0f, A, lda, B, ldb, 0.0f, CReference, N,
+            threadpool);
+
+        if (AddSource != nullptr) {
+            for (size_t f = 0; f < M * N; f++) {
+                CReference[f] += AddSource[f];
+            }
+        }
+
+        MlasActivation(&Activation, CReference, Bias, M, N, N);
+
+        for (size_t f = 0; f < M * N; f++) {
+            // Sensitive to comparing positive/negative zero.
+            if (C[f] != CReference[f]) {
+                printf("mismatch TransA=%d, TransB=%d, M=%zd, N=%zd, K=%zd, kind=%d  %f %f!\n", TransA, TransB, M, N, K, int(ActivationKind), float(C[f]), float(CReference[f]));
+                break;
+            }
+        }
+    }
+
+    void
+    Test(
+        size_t M,
+        size_t N,
+        size_t K
+        )
+    {
+        for (MLAS_ACTIVATION_KIND kind : { MlasIdentityActivation, MlasReluActivation,
+            MlasLeakyReluActivation, MlasClipActivation }) {
+            Test(CblasNoTrans, CblasNoTrans, M, N, K, kind, true, false);
+            Test(CblasNoTrans, CblasTrans, M, N, K, kind, false, true);
+            Test(CblasTrans, CblasNoTrans, M, N, K, kind, true, true);
+        }
+    }
+
+    MatrixGuardBuffer<float> BufferA;
+    MatrixGuardBuffer<float> BufferB;
+    MatrixGuardBuffer<float> BufferBias;
+    MatrixGuardBuffer<float> BufferAddSource;
+    MatrixGuardBuffer<float> BufferC;
+    MatrixGuardBuffer<float> BufferCReference;
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        for (size_t b = 1; b <= 24; b += 7) {
+            Test(b, b, b);
+        }
+        Test(1, 96, 256);
+        Test(65, 7, 33);
+        Test(128, 512, 64);
+        Test(291, 130, 27);
+    }
+};
+
 template<bool Packed>
 class MlasQgemmU8X8U8X8TestBase;
 
@@ -1401,7 +1855,7 @@ protected:
         if (DoReorderInput) {
             size_t NchwcInputElements = BatchCount * NchwcInputChannels * InputHeight * InputWidth;
             float* NchwcInput = BufferNchwcInput.GetBuffer(NchwcInputElements);
-            MlasReorderInput(InputShape, Input, NchwcInput);
+            MlasReorderInput(InputShape, Input, NchwcInput, threadpool);
             Input = NchwcInput;
             InputShape[1] = NchwcInputChannels;
         }
@@ -1433,7 +1887,7 @@ protected:
         // Reorder the output buffer.
         //
 
-        MlasReorderOutputNchw(OutputShape, NchwcOutput, Output);
+        MlasReorderOutputNchw(OutputShape, NchwcOutput, Output, threadpool);
     }
 
     const size_t BlockSize = MlasNchwcGetBlockSize();
@@ -1828,7 +2282,7 @@ protected:
         size_t NchwcOutputElements = size_t(NchwcOutputShape[0]) * size_t(NchwcOutputShape[1]) * size_t(NchwcOutputShape[2]) * size_t(NchwcOutputShape[3]);
         float* NchwcOutput = BufferNchwcOutput.GetBuffer(NchwcOutputElements);
 
-        MlasReorderInput(InputShape, Input, NchwcInput);
+        MlasReorderInput(InputShape, Input, NchwcInput, threadpool);
 
         MlasNchwcPool(PoolingKind,
                       NchwcInputShape,
@@ -1841,7 +2295,7 @@ protected:
                       NchwcOutput,
                       nullptr);
 
-        MlasReorderOutputNchw(OutputShape, NchwcOutput, Output);
+        MlasReorderOutputNchw(OutputShape, NchwcOutput, Output, threadpool);
     }
 
     MatrixGuardBuffer<float> BufferNchwcInput;
@@ -2292,6 +2746,26 @@ public:
                     printf("mismatch activation kind=%d i=%d value=%08x expected=%08x\n", (int)kind, (int)i, Buffer[i].u, TestData[i][kind].u);
                 }
             }
+
+            //
+            // Test the element-wise source/destination variant.
+            //
+
+            AliasedValue Input[_countof(TestData)];
+
+            for (unsigned i = 0; i < _countof(TestData); i++) {
+                Input[i].u = TestData[i][0].u;
+                Buffer[i].u = 0;
+            }
+
+            MlasComputeActivation(&Activation, &Input[0].f, &Buffer[0].f, _countof(Buffer));
+
+            for (unsigned i = 0; i < _countof(TestData); i++) {
+                // Sensitive to comparing positive/negative zero and NaNs.
+                if (Buffer[i].u != TestData[i][kind].u && Buffer[i].f != TestData[i][kind].f) {
+                    printf("mismatch elementwise activation kind=%d i=%d value=%08x expected=%08x\n", (int)kind, (int)i, Buffer[i].u, TestData[i][kind].u);
+                }
+            }
         }
     }
 };
@@ -2328,7 +2802,7 @@ private:
         std::fill_n(Output, OutputBufferElements, -0.5f);
         std::fill_n(OutputReference, OutputBufferElements, -0.5f);
 
-        MlasReorderOutputNchw(NchwOutputShape, Input, Output);
+        MlasReorderOutputNchw(NchwOutputShape, Input, Output, threadpool);
         ReferenceReorderOutput(BatchCount, Channels, Height, Width, Input, OutputReference, false);
 
         if (memcmp(Output, OutputReference, OutputBufferElements * sizeof(float)) != 0) {
@@ -2515,6 +2989,147 @@ public:
     }
 };
 
+class MlasLayerNormTest : public MlasTestBase
+{
+private:
+    MatrixGuardBuffer<float> BufferInput;
+    MatrixGuardBuffer<float> BufferScale;
+    MatrixGuardBuffer<float> BufferBias;
+    MatrixGuardBuffer<float> BufferOutput;
+    MatrixGuardBuffer<float> BufferOutputReference;
+    MatrixGuardBuffer<float> BufferMean;
+    MatrixGuardBuffer<float> BufferMeanReference;
+    MatrixGuardBuffer<float> BufferInvStdDev;
+    MatrixGuardBuffer<float> BufferInvStdDevReference;
+
+    void
+    Test(
+        size_t N,
+        size_t D,
+        float MinimumValue,
+        float MaximumValue
+        )
+    {
+        float* Input = BufferInput.GetBuffer(N * D);
+        float* Scale = BufferScale.GetBuffer(D);
+        float* Bias = BufferBias.GetBuffer(D);
+        float* Output = BufferOutput.GetBuffer(N * D);
+        float* OutputReference = BufferOutputReference.GetBuffer(N * D);
+        float* Mean = BufferMean.GetBuffer(N);
+        float* MeanReference = BufferMeanReference.GetBuffer(N);
+        float* InvStdDev = BufferInvStdDev.GetBuffer(N);
+        float* InvStdDevReference = BufferInvStdDevReference.GetBuffer(N);
+
+        std::default_random_engine generator(static_cast<unsigned>(N * D));
+        std::uniform_real_distribution<float> distribution(MinimumValue, MaximumValue);
+
+        for (size_t nd = 0; nd < N * D; nd++) {
+            Input[nd] = distribution(generator);
+        }
+
+        for (size_t d = 0; d < D; d++) {
+            Scale[d] = distribution(generator);
+            Bias[d] = distribution(generator);
+        }
+
+        constexpr float Epsilon = 1e-5f;
+
+        for (bool SimplifiedLayerNorm : { false, true }) {
+
+            const float* bias = SimplifiedLayerNorm ? nullptr : Bias;
+
+            MlasComputeLayerNorm(Input, Scale, bias, Output, Mean, InvStdDev, N, D,
+                Epsilon, SimplifiedLayerNorm, threadpool);
+            ReferenceLayerNorm(Input, Scale, bias, OutputReference, MeanReference,
+                InvStdDevReference, N, D, Epsilon, SimplifiedLayerNorm);
+
+            constexpr float AbsoluteTolerance = 1e-4f;
+            constexpr float RelativeTolerance = 1e-4f;
+
+            for (size_t nd = 0; nd < N * D; nd++) {
+                float diff = std::fabs(Output[nd] - OutputReference[nd]);
+                if (diff > AbsoluteTolerance && diff > std::fabs(OutputReference[nd]) * RelativeTolerance) {
+                    printf("layernorm(%d) difference: %u/%u %.8f %.8f\n", int32_t(SimplifiedLayerNorm), unsigned(N), unsigned(D), Output[nd], OutputReference[nd]);
+                }
+            }
+
+            for (size_t n = 0; n < N; n++) {
+                float diff = std::fabs(InvStdDev[n] - InvStdDevReference[n]);
+                if (diff > AbsoluteTolerance && diff > std::fabs(InvStdDevReference[n]) * RelativeTolerance) {
+                    printf("layernorm(%d) stddev difference: %u/%u %.8f %.8f\n", int32_t(SimplifiedLayerNorm), unsigned(N), unsigned(D), InvStdDev[n], InvStdDevReference[n]);
+                }
+            }
+        }
+    }
+
+    void
+    ReferenceLayerNorm(
+        const float* Input,
+        const float* Scale,
+        const float* Bias,
+        float* Output,
+        float* Mean,
+        float* InvStdDev,
+        size_t N,
+        size_t D,
+        float Epsilon,
+        bool SimplifiedLayerNorm
+        )
+    {
+        for (size_t n = 0; n < N; n++) {
+
+            double Sum = 0.0;
+            double SumSquares = 0.0;
+
+            for (size_t d = 0; d < D; d++) {
+                Sum += Input[d];
+                SumSquares += double(Input[d]) * double(Input[d]);
+            }
+
+            double MeanValue = Sum / double(D);
+            double Variance = SumSquares / double(D);
+
+            if (!SimplifiedLayerNorm) {
+                Variance -= MeanValue * MeanValue;
+            } else {
+                MeanValue = 0.0;
+            }
+
+            double InvStdDevValue = 1.0 / std::sqrt(Variance + double(Epsilon));
+
+            for (size_t d = 0; d < D; d++) {
+                double Value = (double(Input[d]) - MeanValue) * InvStdDevValue * double(Scale[d]);
+                if (Bias != nullptr) {
+                    Value += double(Bias[d]);
+                }
+                Output[d] = float(Value);
+            }
+
+            Mean[n] = float(MeanValue);
+            InvStdDev[n] = float(InvStdDevValue);
+
+            Input += D;
+            Output += D;
+        }
+    }
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        for (size_t d = 1; d < 128; d++) {
+            Test(1, d, -10.f, 10.f);
+        }
+
+        Test(3, 128, 20.f, 30.f);
+        Test(63, 95, -1.f, 1.f);
+        Test(16, 768, -5.f, 5.f);
+        Test(130, 384, -5.f, 5.f);
+    }
+};
+
 class MlasComputeExpTest : public MlasTestBase
 {
 private:
@@ -2947,6 +3562,98 @@ public:
     }
 };
 
+class MlasFp16ConversionTest : public MlasTestBase
+{
+private:
+    MatrixGuardBuffer<unsigned short> BufferHalfInput;
+    MatrixGuardBuffer<float> BufferFloatOutput;
+    MatrixGuardBuffer<unsigned short> BufferHalfOutput;
+
+    void
+    Test(
+        size_t N
+        )
+    {
+        unsigned short* HalfInput = BufferHalfInput.GetBuffer(N);
+        float* FloatOutput = BufferFloatOutput.GetBuffer(N);
+        unsigned short* HalfOutput = BufferHalfOutput.GetBuffer(N);
+
+        std::default_random_engine generator(static_cast<unsigned>(N));
+        std::uniform_int_distribution<unsigned> distribution(0, 0xFFFF);
+
+        for (size_t n = 0; n < N; n++) {
+            unsigned short HalfValue = static_cast<unsigned short>(distribution(generator));
+            if ((HalfValue & 0x7FFF) > 0x7C00) {
+                HalfValue &= 0xFC00;  // replace NaNs: their payloads are not preserved
+            }
+            HalfInput[n] = HalfValue;
+        }
+
+        MlasConvertHalfToFloatBuffer(HalfInput, FloatOutput, N);
+        MlasConvertFloatToHalfBuffer(FloatOutput, HalfOutput, N);
+
+        for (size_t n = 0; n < N; n++) {
+            if (HalfOutput[n] != HalfInput[n]) {
+                printf("round trip difference: %zd/%zd %04x %.8f %04x\n",
+                    n, N, HalfInput[n], FloatOutput[n], HalfOutput[n]);
+            }
+        }
+    }
+
+    void
+    TestKnownValues(
+        void
+        )
+    {
+        const unsigned short HalfInput[] = { 0x3C00, 0x3555, 0x0001, 0x0400, 0x7BFF, 0xFC00 };
+        const float FloatExpected[] = { 1.0f, 0.333251953125f, 5.960464477539063e-8f,
+            6.103515625e-5f, 65504.0f, -std::numeric_limits<float>::infinity() };
+        const size_t N = sizeof(HalfInput) / sizeof(HalfInput[0]);
+
+        float FloatOutput[N];
+        MlasConvertHalfToFloatBuffer(HalfInput, FloatOutput, N);
+
+        for (size_t n = 0; n < N; n++) {
+            if (FloatOutput[n] != FloatExpected[n]) {
+                printf("half to float difference: %04x %.8f %.8f\n",
+                    HalfInput[n], FloatOutput[n], FloatExpected[n]);
+            }
+        }
+
+        // 65520.0f overflows to infinity, 2^-25 rounds to zero (ties to even),
+        // and 1/3 rounds the mantissa upwards.
+        const float FloatInput[] = { 1.0f, -1.0f, 65504.0f, 65520.0f, -0.0f,
+            2.9802322387695312e-8f, 1.0f / 3.0f };
+        const unsigned short HalfExpected[] = { 0x3C00, 0xBC00, 0x7BFF, 0x7C00, 0x8000, 0x0000, 0x3555 };
+        const size_t M = sizeof(FloatInput) / sizeof(FloatInput[0]);
+
+        unsigned short HalfOutput[M];
+        MlasConvertFloatToHalfBuffer(FloatInput, HalfOutput, M);
+
+        for (size_t m = 0; m < M; m++) {
+            if (HalfOutput[m] != HalfExpected[m]) {
+                printf("float to half difference: %.8f %04x %04x\n",
+                    FloatInput[m], HalfOutput[m], HalfExpected[m]);
+            }
+        }
+    }
+
+public:
+    void
+    ExecuteShort(
+        void
+        ) override
+    {
+        TestKnownValues();
+
+        for (size_t n = 1; n < 128; n++) {
+            Test(n);
+        }
+
+        Test(size_t(1) << 16);
+    }
+};
+
 class MlasScaleOutputTest : public MlasTestBase
 {
 private:
@@ -3116,6 +3823,14 @@ RunThreadedTests(
     onnxruntime::make_unique<MlasFgemmTest<float, false>>()->ExecuteShort();
     printf("SGEMM packed tests.\n");
     onnxruntime::make_unique<MlasFgemmTest<float, true>>()->ExecuteShort();
+    printf("SGEMM batch tests.\n");
+    onnxruntime::make_unique<MlasFgemmBatchTest>()->ExecuteShort();
+    printf("BF16 GEMM tests.\n");
+    onnxruntime::make_unique<MlasBf16GemmTest>()->ExecuteShort();
+    printf("Sparse GEMM tests.\n");
+    onnxruntime::make_unique<MlasSparseGemmTest>()->ExecuteShort();
+    printf("SGEMM epilogue tests.\n");
+    onnxruntime::make_unique<MlasSgemmEpilogueTest>()->ExecuteShort();
 #ifdef MLAS_SUPPORTS_GEMM_DOUBLE
     printf("DGEMM tests.\n");
     onnxruntime::make_unique<MlasFgemmTest<double, false>>()->ExecuteShort();
@@ -3162,6 +3877,9 @@ RunThreadedTests(
 
     printf("Softmax tests.\n");
     onnxruntime::make_unique<MlasSoftmaxTest>()->ExecuteShort();
+
+    printf("LayerNorm tests.\n");
+    onnxruntime::make_unique<MlasLayerNormTest>()->ExecuteShort();
 }
 
 int
@@ -3206,6 +3924,9 @@ main(
     printf("MinMaxElements tests.\n");
     onnxruntime::make_unique<MlasFindMinMaxElementsTest>()->ExecuteShort();
 
+    printf("Fp16Conversion tests.\n");
+    onnxruntime::make_unique<MlasFp16ConversionTest>()->ExecuteShort();
+
     printf("ReorderOutput tests.\n");
     if (MlasNchwcGetBlockSize() > 1) {
         onnxruntime::make_unique<MlasReorderOutputTest>()->ExecuteShort();
@@ -0,0 +1,158 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <random>
+#include <cstdio>
+
+// Windows Specific
+#ifdef _WIN32
+#include "getopt.h"
+#include "windows.h"
+#else
+#include <unistd.h>
+#endif
+
+#include <core/platform/path_lib.h>
+#include <core/session/onnxruntime_c_api.h>
+
+#include "model_bench.h"
+
+using namespace onnxruntime;
+const OrtApi* g_ort = NULL;
+
+namespace {
+
+void ShowUsage() {
+  printf(
+      "onnxruntime_model_bench [options...] corpus_file\n"
+      "Runs every model declared in corpus_file (one model path per line, '#' starts a comment),\n"
+      "compares against a persisted baseline, and fails when latency or per-kernel time regresses.\n"
+      "Options:\n"
+      "\t-b [baseline_file]: Baseline to compare against. Created on the first run; combine with -u to re-record.\n"
+      "\t-u: Update the baseline file with this run's results instead of comparing.\n"
+      "\t-p [threshold_pct]: Regression threshold in percent. A model or kernel fails when its time grows past\n"
+      "\t\tbaseline * (1 + threshold/100). Default: 10.\n"
+      "\t-s [min_op_share_pct]: Ignore kernels below this share of the baseline's total kernel time. Default: 1.\n"
+      "\t-r [measured_runs]: Timed iterations per model. Default: 50.\n"
+      "\t-w [warmup_runs]: Untimed warmup iterations per model. Default: 5.\n"
+      "\t-x [intra_op_num_threads]: Intra-op thread count, pinned for comparable runs. Default: 1.\n"
+      "\t-v: Show verbose information.\n"
+      "\t-h: help\n");
+}
+
+bool ParseArguments(modelbench::BenchConfig& config, int argc, ORTCHAR_T* argv[]) {
+  int ch;
+  while ((ch = getopt(argc, argv, ORT_TSTR("b:p:s:r:w:x:uvh"))) != -1) {
+    switch (ch) {
+      case 'b':
+        config.baseline_file = optarg;
+        break;
+      case 'u':
+        config.update_baseline = true;
+        break;
+      case 'p':
+        config.regression_threshold_pct = static_cast<double>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
+        if (config.regression_threshold_pct <= 0) {
+          return false;
+        }
+        break;
+      case 's':
+        config.min_op_share_pct = static_cast<double>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
+        if (config.min_op_share_pct < 0) {
+          return false;
+        }
+        break;
+      case 'r':
+        config.measured_runs = static_cast<size_t>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
+        if (config.measured_runs <= 0) {
+          return false;
+        }
+        break;
+      case 'w':
+        config.warmup_runs = static_cast<size_t>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
+        break;
+      case 'x':
+        config.intra_op_num_threads = static_cast<int>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
+        if (config.intra_op_num_threads <= 0) {
+          return false;
+        }
+        break;
+      case 'v':
+        config.f_verbose = true;
+        break;
+      case '?':
+      case 'h':
+      default:
+        return false;
+    }
+  }
+
+  argc -= optind;
+  argv += optind;
+  if (argc != 1) {
+    return false;
+  }
+  config.corpus_file = argv[0];
+  return true;
+}
+
+}  // namespace
+
+#ifdef _WIN32
+int real_main(int argc, wchar_t* argv[]) {
+#else
+int real_main(int argc, char* argv[]) {
+#endif
+  g_ort = OrtGetApiBase()->GetApi(ORT_API_VERSION);
+  modelbench::BenchConfig config;
+  if (!ParseArguments(config, argc, argv)) {
+    ShowUsage();
+    return -1;
+  }
+
+  Ort::Env env{nullptr};
+  {
+    bool failed = false;
+    ORT_TRY {
+      OrtLoggingLevel logging_level = config.f_verbose ? ORT_LOGGING_LEVEL_VERBOSE : ORT_LOGGING_LEVEL_WARNING;
+      env = Ort::Env(logging_level, "Default");
+    }
+    ORT_CATCH(const Ort::Exception& e) {
+      ORT_HANDLE_EXCEPTION([&]() {
+        fprintf(stderr, "Error creating environment: %s \n", e.what());
+        failed = true;
+      });
+    }
+
+    if (failed)
+      return -1;
+  }
+
+  modelbench::ModelBench bench(env, config);
+  auto status = bench.Run();
+  if (!status.IsOK()) {
+    printf("Run failed:%s\n", status.ErrorMessage().c_str());
+    return -1;
+  }
+
+  return 0;
+}
+
+#ifdef _WIN32
+int wmain(int argc, wchar_t* argv[]) {
+#else
+int main(int argc, char* argv[]) {
+#endif
+  int retval = -1;
+  ORT_TRY {
+    retval = real_main(argc, argv);
+  }
+  ORT_CATCH(const std::exception& ex) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      fprintf(stderr, "%s\n", ex.what());
+      retval = -1;
+    });
+  }
+
+  return retval;
+}
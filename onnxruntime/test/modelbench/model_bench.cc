@@ -0,0 +1,308 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "model_bench.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+#include <core/platform/path_lib.h>
+
+using onnxruntime::Status;
+
+namespace onnxruntime {
+namespace modelbench {
+
+static std::string ModelNameFromPath(const std::basic_string<ORTCHAR_T>& model_path) {
+  std::string name = ToMBString(GetLastComponent(model_path));
+  auto dot = name.find_last_of('.');
+  if (dot != std::string::npos) {
+    name = name.substr(0, dot);
+  }
+  return name;
+}
+
+ModelBench::ModelBench(Ort::Env& env, const BenchConfig& config) : env_(env), config_(config) {}
+
+Status ModelBench::LoadCorpus(std::vector<std::basic_string<ORTCHAR_T>>& model_paths) const {
+  std::ifstream corpus(config_.corpus_file);
+  if (!corpus.good()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "cannot open corpus file '", ToMBString(config_.corpus_file), "'.");
+  }
+  std::string line;
+  while (std::getline(corpus, line)) {
+    if (!line.empty() && line.back() == '\r') {
+      line.pop_back();
+    }
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    model_paths.push_back(ToWideString(line));
+  }
+  if (model_paths.empty()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "corpus file '", ToMBString(config_.corpus_file),
+                           "' declares no models.");
+  }
+  return Status::OK();
+}
+
+Status ModelBench::BenchmarkModel(const std::basic_string<ORTCHAR_T>& model_path, ModelBenchResult& result) {
+  result.model_name = ModelNameFromPath(model_path);
+
+  auto status = Status::OK();
+  ORT_TRY {
+    Ort::SessionOptions session_options;
+    // pin threads so runs are comparable between invocations
+    session_options.SetIntraOpNumThreads(config_.intra_op_num_threads);
+    session_options.SetExecutionMode(ExecutionMode::ORT_SEQUENTIAL);
+    session_options.SetGraphOptimizationLevel(ORT_ENABLE_ALL);
+    std::basic_string<ORTCHAR_T> profile_prefix = model_path + ORT_TSTR(".bench_profile");
+    session_options.EnableProfiling(profile_prefix.c_str());
+
+    Ort::Session session(env_, model_path.c_str(), session_options);
+    Ort::AllocatorWithDefaultOptions allocator;
+
+    // generate inputs the way onnxruntime_perf_test -I does: free dimensions become 1
+    size_t input_count = session.GetInputCount();
+    std::vector<std::string> input_names(input_count);
+    std::vector<const char*> input_name_ptrs(input_count);
+    std::vector<Ort::Value> inputs;
+    for (size_t i = 0; i != input_count; ++i) {
+      char* input_name = session.GetInputName(i, allocator);
+      input_names[i] = input_name;
+      allocator.Free(input_name);
+      input_name_ptrs[i] = input_names[i].c_str();
+
+      Ort::TypeInfo type_info = session.GetInputTypeInfo(i);
+      if (type_info.GetONNXType() != ONNX_TYPE_TENSOR) {
+        return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "model '", result.model_name,
+                               "' has a non-tensor input; cannot generate bench data for it.");
+      }
+      auto tensor_info = type_info.GetTensorTypeAndShapeInfo();
+      std::vector<int64_t> dims = tensor_info.GetShape();
+      for (int64_t& dim : dims) {
+        if (dim == -1) {
+          dim = 1;
+        }
+      }
+      inputs.emplace_back(Ort::Value::CreateTensor(static_cast<OrtAllocator*>(allocator), dims.data(), dims.size(),
+                                                   tensor_info.GetElementType()));
+    }
+
+    size_t output_count = session.GetOutputCount();
+    std::vector<std::string> output_names(output_count);
+    std::vector<const char*> output_name_ptrs(output_count);
+    for (size_t i = 0; i != output_count; ++i) {
+      char* output_name = session.GetOutputName(i, allocator);
+      output_names[i] = output_name;
+      allocator.Free(output_name);
+      output_name_ptrs[i] = output_names[i].c_str();
+    }
+
+    for (size_t i = 0; i != config_.warmup_runs; ++i) {
+      session.Run(Ort::RunOptions{nullptr}, input_name_ptrs.data(), inputs.data(), input_count,
+                  output_name_ptrs.data(), output_count);
+    }
+
+    std::vector<double> times_ms;
+    times_ms.reserve(config_.measured_runs);
+    for (size_t i = 0; i != config_.measured_runs; ++i) {
+      auto start = std::chrono::high_resolution_clock::now();
+      session.Run(Ort::RunOptions{nullptr}, input_name_ptrs.data(), inputs.data(), input_count,
+                  output_name_ptrs.data(), output_count);
+      std::chrono::duration<double, std::milli> duration_ms = std::chrono::high_resolution_clock::now() - start;
+      times_ms.push_back(duration_ms.count());
+      if (config_.f_verbose) {
+        std::cout << result.model_name << " iteration:" << i << ",time_cost:" << duration_ms.count() << " ms"
+                  << std::endl;
+      }
+    }
+    std::sort(times_ms.begin(), times_ms.end());
+    result.p50_ms = times_ms[static_cast<size_t>(times_ms.size() * 0.5)];
+    result.p95_ms = times_ms[static_cast<size_t>(times_ms.size() * 0.95)];
+
+    char* profile_path = session.EndProfiling(allocator);
+    std::string profile_file(profile_path);
+    allocator.Free(profile_path);
+    ORT_RETURN_IF_ERROR(ParseProfile(profile_file, result));
+    std::remove(profile_file.c_str());
+  }
+  ORT_CATCH(const Ort::Exception& ex) {
+    ORT_HANDLE_EXCEPTION([&]() {
+      status = ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "benchmarking model '", result.model_name,
+                               "' failed: ", ex.what());
+    });
+  }
+  return status;
+}
+
+Status ModelBench::ParseProfile(const std::string& profile_path, ModelBenchResult& result) const {
+  std::ifstream profile(profile_path);
+  if (!profile.good()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "cannot open profiler output '", profile_path, "'.");
+  }
+  // the profiler writes one event object per line; kernel time events look like
+  // {"cat" : "Node",...,"dur" :123,...,"name" :"<node>_kernel_time","args" : {...,"op_name" : "Conv"}}
+  std::string line;
+  while (std::getline(profile, line)) {
+    if (line.find("\"cat\" : \"Node\"") == std::string::npos ||
+        line.find("_kernel_time\"") == std::string::npos) {
+      continue;
+    }
+    static const std::string dur_key = "\"dur\" :";
+    auto dur_pos = line.find(dur_key);
+    if (dur_pos == std::string::npos) {
+      continue;
+    }
+    double dur_us = strtod(line.c_str() + dur_pos + dur_key.size(), nullptr);
+
+    std::string op_name = "unknown";
+    static const std::string op_key = "\"op_name\" : \"";
+    auto op_pos = line.find(op_key);
+    if (op_pos != std::string::npos) {
+      auto value_begin = op_pos + op_key.size();
+      auto value_end = line.find('"', value_begin);
+      if (value_end != std::string::npos) {
+        op_name = line.substr(value_begin, value_end - value_begin);
+      }
+    }
+    result.op_time_us[op_name] += dur_us;
+  }
+  return Status::OK();
+}
+
+bool ModelBench::LoadBaseline(std::vector<ModelBenchResult>& baseline) const {
+  std::ifstream infile(config_.baseline_file);
+  if (!infile.good()) {
+    return false;
+  }
+  std::string line;
+  while (std::getline(infile, line)) {
+    if (line.empty() || line[0] == '#') {
+      continue;
+    }
+    std::istringstream fields(line);
+    std::string record_type;
+    if (!std::getline(fields, record_type, ',')) {
+      continue;
+    }
+    if (record_type == "model") {
+      ModelBenchResult entry;
+      std::string p50, p95;
+      if (std::getline(fields, entry.model_name, ',') && std::getline(fields, p50, ',') &&
+          std::getline(fields, p95, ',')) {
+        entry.p50_ms = strtod(p50.c_str(), nullptr);
+        entry.p95_ms = strtod(p95.c_str(), nullptr);
+        baseline.push_back(entry);
+      }
+    } else if (record_type == "op" && !baseline.empty()) {
+      std::string model_name, op_name, total_us;
+      if (std::getline(fields, model_name, ',') && std::getline(fields, op_name, ',') &&
+          std::getline(fields, total_us, ',') && model_name == baseline.back().model_name) {
+        baseline.back().op_time_us[op_name] = strtod(total_us.c_str(), nullptr);
+      }
+    }
+  }
+  return !baseline.empty();
+}
+
+bool ModelBench::WriteBaseline() const {
+  std::ofstream outfile(config_.baseline_file);
+  if (!outfile.good()) {
+    std::cerr << "failed to open baseline file '" << ToMBString(config_.baseline_file) << "' for writing.\n";
+    return false;
+  }
+  outfile << "# model,<name>,<p50_ms>,<p95_ms>\n"
+          << "# op,<model>,<op_name>,<kernel_time_us>\n";
+  for (const auto& result : results_) {
+    outfile << "model," << result.model_name << "," << result.p50_ms << "," << result.p95_ms << "\n";
+    for (const auto& op : result.op_time_us) {
+      outfile << "op," << result.model_name << "," << op.first << "," << op.second << "\n";
+    }
+  }
+  return true;
+}
+
+bool ModelBench::CompareAgainstBaseline(const std::vector<ModelBenchResult>& baseline) const {
+  const double limit = 1.0 + config_.regression_threshold_pct / 100.0;
+  bool passed = true;
+
+  for (const auto& result : results_) {
+    auto base = std::find_if(baseline.begin(), baseline.end(), [&result](const ModelBenchResult& entry) {
+      return entry.model_name == result.model_name;
+    });
+    if (base == baseline.end()) {
+      std::cout << result.model_name << ": no baseline entry; rerun with -u to record one." << std::endl;
+      continue;
+    }
+
+    bool model_regressed = result.p50_ms > base->p50_ms * limit;
+    if (model_regressed) {
+      std::cout << result.model_name << ": REGRESSED P50 " << base->p50_ms << " ms -> " << result.p50_ms << " ms ("
+                << (result.p50_ms / base->p50_ms - 1.0) * 100 << "%)" << std::endl;
+      passed = false;
+    }
+
+    double base_total_us = 0;
+    for (const auto& op : base->op_time_us) {
+      base_total_us += op.second;
+    }
+    for (const auto& op : result.op_time_us) {
+      auto base_op = base->op_time_us.find(op.first);
+      if (base_op == base->op_time_us.end() || base_total_us <= 0) {
+        continue;
+      }
+      double base_share_pct = base_op->second / base_total_us * 100;
+      if (base_share_pct < config_.min_op_share_pct) {
+        continue;
+      }
+      if (op.second > base_op->second * limit) {
+        std::cout << result.model_name << ": REGRESSED kernel " << op.first << " " << base_op->second << " us -> "
+                  << op.second << " us (" << (op.second / base_op->second - 1.0) * 100 << "%, "
+                  << base_share_pct << "% of baseline kernel time)" << std::endl;
+        passed = false;
+      }
+    }
+  }
+  return passed;
+}
+
+Status ModelBench::Run() {
+  std::vector<std::basic_string<ORTCHAR_T>> model_paths;
+  ORT_RETURN_IF_ERROR(LoadCorpus(model_paths));
+
+  for (const auto& model_path : model_paths) {
+    ModelBenchResult result;
+    ORT_RETURN_IF_ERROR(BenchmarkModel(model_path, result));
+    std::cout << result.model_name << ": P50 " << result.p50_ms << " ms, P95 " << result.p95_ms << " ms, "
+              << result.op_time_us.size() << " op types profiled" << std::endl;
+    results_.push_back(std::move(result));
+  }
+
+  if (config_.baseline_file.empty()) {
+    return Status::OK();
+  }
+
+  std::vector<ModelBenchResult> baseline;
+  if (!config_.update_baseline && LoadBaseline(baseline)) {
+    if (!CompareAgainstBaseline(baseline)) {
+      return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "performance regressed past the ",
+                             config_.regression_threshold_pct, "% threshold.");
+    }
+    std::cout << "All models within " << config_.regression_threshold_pct << "% of baseline." << std::endl;
+    return Status::OK();
+  }
+
+  if (!WriteBaseline()) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "failed to record baseline.");
+  }
+  std::cout << "Recorded baseline to '" << ToMBString(config_.baseline_file) << "'." << std::endl;
+  return Status::OK();
+}
+
+}  // namespace modelbench
+}  // namespace onnxruntime
@@ -0,0 +1,68 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+// onnxruntime dependencies
+#include <core/common/common.h>
+#include <core/common/status.h>
+#include <core/session/onnxruntime_cxx_api.h>
+
+namespace onnxruntime {
+namespace modelbench {
+
+struct BenchConfig {
+  std::basic_string<ORTCHAR_T> corpus_file;
+  std::basic_string<ORTCHAR_T> baseline_file;
+  // a model (or kernel) fails when its time grows past baseline * (1 + threshold/100)
+  double regression_threshold_pct{10};
+  // kernels below this share of the baseline's total kernel time are too noisy to gate on
+  double min_op_share_pct{1};
+  size_t warmup_runs{5};
+  size_t measured_runs{50};
+  int intra_op_num_threads{1};
+  bool update_baseline{false};
+  bool f_verbose{false};
+};
+
+struct ModelBenchResult {
+  std::string model_name;
+  double p50_ms{0};
+  double p95_ms{0};
+  // op type -> cumulative kernel time over the measured runs, in microseconds,
+  // taken from the session profiler output
+  std::map<std::string, double> op_time_us;
+};
+
+// Benchmarks a declared corpus of models with pinned threads and a warmup
+// phase, persists per-model latency and per-op kernel-time baselines, and
+// fails when a model or kernel regresses past the configured threshold so
+// regressions are attributed to specific kernels.
+class ModelBench {
+ public:
+  ModelBench(Ort::Env& env, const BenchConfig& config);
+
+  Status Run();
+
+  const std::vector<ModelBenchResult>& GetResults() const { return results_; }
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(ModelBench);
+
+ private:
+  Status LoadCorpus(std::vector<std::basic_string<ORTCHAR_T>>& model_paths) const;
+  Status BenchmarkModel(const std::basic_string<ORTCHAR_T>& model_path, /* out */ ModelBenchResult& result);
+  Status ParseProfile(const std::string& profile_path, /* out */ ModelBenchResult& result) const;
+  bool LoadBaseline(std::vector<ModelBenchResult>& baseline) const;
+  bool WriteBaseline() const;
+  bool CompareAgainstBaseline(const std::vector<ModelBenchResult>& baseline) const;
+
+  Ort::Env& env_;
+  BenchConfig config_;
+  std::vector<ModelBenchResult> results_;
+};
+
+}  // namespace modelbench
+}  // namespace onnxruntime
@@ -441,6 +441,83 @@ static void LoadSequenceTensor(const PATH_STRING_TYPE& pb_file, ONNX_NAMESPACE::
   }
 }
 
+// Loads tensors stored in the length-prefixed raw binary framing used by
+// perf-critical clients: "ORTB" magic, uint32 version (1), then per tensor a
+// uint32 name length and name, int32 dtype (onnx.TensorProto.DataType value),
+// uint32 rank, int64 dims, uint64 payload length, zero padding to the next
+// 64-byte boundary from the start of the stream, and the raw little-endian
+// payload. Parsing is a header walk plus one memcpy per tensor.
+template <typename PATH_STRING_TYPE>
+static void LoadOrtbTensors(const PATH_STRING_TYPE& file_path, onnxruntime::test::HeapBuffer& b,
+                            const std::string& fallback_name,
+                            std::unordered_map<std::string, Ort::Value>& name_data_map) {
+  constexpr size_t kAlignment = 64;
+  std::ifstream input(file_path, std::ios::in | std::ios::binary);
+  if (!input) {
+    ORT_THROW("open file '", ToMBString(file_path), "' failed");
+  }
+  std::string data((std::istreambuf_iterator<char>(input)), std::istreambuf_iterator<char>());
+  size_t pos = 0;
+  auto read = [&data, &pos, &file_path](void* out, size_t count) {
+    if (count > data.size() - pos) {
+      ORT_THROW("parse file '", ToMBString(file_path), "' failed: truncated");
+    }
+    memcpy(out, data.data() + pos, count);
+    pos += count;
+  };
+
+  char magic[4];
+  uint32_t version;
+  read(magic, sizeof(magic));
+  read(&version, sizeof(version));
+  if (memcmp(magic, "ORTB", sizeof(magic)) != 0 || version != 1) {
+    ORT_THROW("parse file '", ToMBString(file_path), "' failed: not an ORTB v1 file");
+  }
+
+  OrtMemoryInfo cpu_memory_info(onnxruntime::CPU, OrtDeviceAllocator, OrtDevice(), 0, OrtMemTypeDefault);
+  while (pos < data.size()) {
+    uint32_t name_len;
+    read(&name_len, sizeof(name_len));
+    std::string name = fallback_name;
+    if (name_len != 0) {
+      if (name_len > data.size() - pos) {
+        ORT_THROW("parse file '", ToMBString(file_path), "' failed: truncated name");
+      }
+      name.assign(data.data() + pos, name_len);
+      pos += name_len;
+    }
+
+    int32_t dtype;
+    uint32_t rank;
+    read(&dtype, sizeof(dtype));
+    read(&rank, sizeof(rank));
+    if (dtype == ONNX_TENSOR_ELEMENT_DATA_TYPE_STRING || dtype == ONNX_TENSOR_ELEMENT_DATA_TYPE_UNDEFINED) {
+      ORT_THROW("parse file '", ToMBString(file_path), "' failed: unsupported dtype ", dtype);
+    }
+    std::vector<int64_t> dims(rank);
+    for (uint32_t i = 0; i < rank; ++i) {
+      read(&dims[i], sizeof(int64_t));
+    }
+
+    uint64_t payload_len;
+    read(&payload_len, sizeof(payload_len));
+    pos += (kAlignment - pos % kAlignment) % kAlignment;
+    if (payload_len > data.size() - pos) {
+      ORT_THROW("parse file '", ToMBString(file_path), "' failed: truncated payload");
+    }
+    void* p = payload_len == 0 ? nullptr : b.AllocMemory(static_cast<size_t>(payload_len));
+    if (p != nullptr) {
+      memcpy(p, data.data() + pos, static_cast<size_t>(payload_len));
+    }
+    pos += static_cast<size_t>(payload_len);
+
+    Ort::Value value = Ort::Value::CreateTensor(&cpu_memory_info, p, static_cast<size_t>(payload_len),
+                                                dims.data(), dims.size(),
+                                                static_cast<ONNXTensorElementDataType>(dtype));
+    name_data_map.emplace(name, std::move(value));
+  }
+}
+
 void OnnxTestCase::LoadTestData(size_t id, onnxruntime::test::HeapBuffer& b,
                                 std::unordered_map<std::string, Ort::Value>& name_data_map,
                                 bool is_input) const {
@@ -484,7 +561,9 @@ void OnnxTestCase::LoadTestData(size_t id, onnxruntime::test::HeapBuffer& b,
             if (filename[0] == '.') return true;
             if (f_type != OrtFileType::TYPE_REG) return true;
             std::basic_string<PATH_CHAR_TYPE> filename_str = filename;
-            if (!HasExtensionOf(filename_str, ORT_TSTR("pb"))) return true;
+            if (!HasExtensionOf(filename_str, ORT_TSTR("pb")) &&
+                !HasExtensionOf(filename_str, ORT_TSTR("ortb")))
+              return true;
             const std::basic_string<PATH_CHAR_TYPE> file_prefix =
                 is_input ? ORT_TSTR("input_") : ORT_TSTR("output_");
             if (!filename_str.compare(0, file_prefix.length(), file_prefix)) {
@@ -497,6 +576,14 @@ void OnnxTestCase::LoadTestData(size_t id, onnxruntime::test::HeapBuffer& b,
   SortFileNames(test_data_pb_files);
 
   for (size_t i = 0; i < test_data_pb_files.size(); ++i) {
+    if (HasExtensionOf(test_data_pb_files[i], ORT_TSTR("ortb"))) {
+      // raw binary framing carries its own dtype and shape; names default to
+      // the model's input/output name at this index
+      LoadOrtbTensors(test_data_pb_files[i], b,
+                      is_input ? model_info_->GetInputName(i) : model_info_->GetOutputName(i),
+                      name_data_map);
+      continue;
+    }
     const ONNX_NAMESPACE::ValueInfoProto* value_info_proto = is_input ? model_info_->GetInputInfoFromModel(i) : model_info_->GetOutputInfoFromModel(i);
     if (!value_info_proto->has_type()) {
       ORT_THROW("Model ", is_input ? "input " : "output ", i, " is missing type info");
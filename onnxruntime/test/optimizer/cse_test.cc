@@ -293,5 +293,83 @@ TEST(CseTests, MergeConstants) {
   ASSERT_EQ(op_count["Add"], 2);
 }
 
+namespace {
+ONNX_NAMESPACE::TypeProto FloatTensorType(const std::vector<int64_t>& dims) {
+  ONNX_NAMESPACE::TypeProto type;
+  type.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  for (int64_t dim : dims) {
+    type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+  }
+  return type;
+}
+
+ONNX_NAMESPACE::TypeProto ScalarType(ONNX_NAMESPACE::TensorProto_DataType elem_type) {
+  ONNX_NAMESPACE::TypeProto type;
+  type.mutable_tensor_type()->set_elem_type(elem_type);
+  type.mutable_tensor_type()->mutable_shape();
+  return type;
+}
+
+// branch computing Add(x, x) on the outer scope value followed by Neg (then) or Abs (else)
+ONNX_NAMESPACE::GraphProto CreateIfBranch(bool then_branch) {
+  Model model(then_branch ? "If_then" : "If_else", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto float_type = FloatTensorType({2});
+  auto& x = graph.GetOrCreateNodeArg("x", &float_type);
+  graph.AddOuterScopeNodeArg("x");
+
+  const std::string prefix = then_branch ? "then" : "else";
+  auto& add_out = graph.GetOrCreateNodeArg(prefix + "_add_out", &float_type);
+  auto& result = graph.GetOrCreateNodeArg(prefix + "_result", &float_type);
+  graph.AddNode(prefix + "_add", "Add", "", {&x, &x}, {&add_out});
+  graph.AddNode(prefix + "_unary", then_branch ? "Neg" : "Abs", "", {&add_out}, {&result});
+
+  EXPECT_TRUE(graph.Resolve().IsOK());
+  return graph.ToGraphProto();
+}
+
+}  // namespace
+
+TEST(CseTests, HoistIfBranchCommonExpression) {
+  Model model("cse_hoist_if", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto bool_scalar = ScalarType(ONNX_NAMESPACE::TensorProto_DataType_BOOL);
+  ONNX_NAMESPACE::TypeProto float_type = FloatTensorType({2});
+
+  auto& b = graph.GetOrCreateNodeArg("b", &bool_scalar);
+  auto& x = graph.GetOrCreateNodeArg("x", &float_type);
+  auto& result = graph.GetOrCreateNodeArg("Result", &float_type);
+
+  auto& if_node = graph.AddNode("if_0", "If", "", {&b}, {&result});
+  if_node.AddAttribute("then_branch", CreateIfBranch(true));
+  if_node.AddAttribute("else_branch", CreateIfBranch(false));
+
+  graph.SetInputs({&b, &x});
+  graph.SetOutputs({&result});
+  ASSERT_TRUE(graph.Resolve().IsOK());
+
+  // the first application hoists the common Add out of both branches, the second merges the
+  // two hoisted copies
+  ApplyCse(model, 2);
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_count.at("Add"), 1);
+  ASSERT_EQ(op_count.at("If"), 1);
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "If") {
+      auto then_count = CountOpsInGraph(*node.GetGraphAttribute("then_branch"));
+      ASSERT_TRUE(then_count.find("Add") == then_count.end());
+      ASSERT_EQ(then_count.at("Neg"), 1);
+
+      auto else_count = CountOpsInGraph(*node.GetGraphAttribute("else_branch"));
+      ASSERT_TRUE(else_count.find("Add") == else_count.end());
+      ASSERT_EQ(else_count.at("Abs"), 1);
+    }
+  }
+}
+
 }  // namespace test
 }  // namespace onnxruntime
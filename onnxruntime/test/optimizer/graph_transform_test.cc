@@ -18,6 +18,7 @@
 #include "core/optimizer/bias_gelu_fusion.h"
 #include "core/optimizer/bias_softmax_fusion.h"
 #include "core/optimizer/computation_reduction.h"
+#include "core/optimizer/cast_chain_elimination.h"
 #include "core/optimizer/cast_elimination.h"
 #include "core/optimizer/concat_slice_elimination.h"
 #include "core/optimizer/constant_folding.h"
@@ -41,6 +42,7 @@
 #include "core/optimizer/layer_norm_fusion.h"
 #include "core/optimizer/matmul_add_fusion.h"
 #include "core/optimizer/matmul_integer_to_float.h"
+#include "core/optimizer/matmul_residual_fusion.h"
 #include "core/optimizer/matmul_scale_fusion.h"
 #include "core/optimizer/matmul_transpose_fusion.h"
 #include "core/optimizer/relu_clip_fusion.h"
@@ -1812,6 +1814,56 @@ TEST_F(GraphTransformationTests, CastElimination) {
   ASSERT_TRUE(op_to_count["Cast"] == 4);
 }
 
+TEST_F(GraphTransformationTests, CastChainElimination) {
+  // Builds Cast(fp16->fp32) -> Transpose -> Cast(fp32->fp16) -> Identity and expects the
+  // two Casts to cancel, with the Transpose relabeled to run on the fp16 tensor directly.
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = 12;
+  Model model("cast_chain", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              domain_to_version, {}, *logger_);
+  Graph& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto fp16_type;
+  fp16_type.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT16);
+  fp16_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(2);
+  fp16_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(3);
+
+  auto& input_def = graph.GetOrCreateNodeArg("input", &fp16_type);
+  auto& cast_up_out = graph.GetOrCreateNodeArg("cast_up_out", nullptr);
+  auto& transpose_out = graph.GetOrCreateNodeArg("transpose_out", nullptr);
+  auto& cast_down_out = graph.GetOrCreateNodeArg("cast_down_out", nullptr);
+  auto& output_def = graph.GetOrCreateNodeArg("output", nullptr);
+
+  auto& cast_up = graph.AddNode("cast_up", "Cast", "", {&input_def}, {&cast_up_out});
+  cast_up.AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT));
+  graph.AddNode("transpose", "Transpose", "", {&cast_up_out}, {&transpose_out});
+  auto& cast_down = graph.AddNode("cast_down", "Cast", "", {&transpose_out}, {&cast_down_out});
+  cast_down.AddAttribute("to", static_cast<int64_t>(ONNX_NAMESPACE::TensorProto_DataType_FLOAT16));
+  graph.AddNode("identity", "Identity", "", {&cast_down_out}, {&output_def});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_to_count["Cast"] == 2);
+
+  auto rule_transformer_L1 = onnxruntime::make_unique<RuleBasedGraphTransformer>("RuleTransformer1");
+  rule_transformer_L1->Register(onnxruntime::make_unique<CastChainElimination>());
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  graph_transformation_mgr.Register(std::move(rule_transformer_L1), TransformerLevel::Level1);
+  ASSERT_TRUE(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level1, *logger_).IsOK());
+
+  op_to_count = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_to_count["Cast"] == 0);
+  ASSERT_TRUE(op_to_count["Transpose"] == 1);
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Transpose") {
+      ASSERT_TRUE(node.OutputDefs()[0]->TypeAsProto()->tensor_type().elem_type() ==
+                  ONNX_NAMESPACE::TensorProto_DataType_FLOAT16);
+    }
+  }
+}
+
 #ifndef DISABLE_CONTRIB_OPS
 
 static void ValidateAttention(Graph& graph) {
@@ -3572,6 +3624,72 @@ TEST_F(GraphTransformationTests, MatMulScaleFusionUnsupportedInputType) {
       },
       {kCpuExecutionProvider});
 }
+
+// Builds MatMul(A, B) -> Add(matmul_out, residual) with the given residual shape
+// and runs MatMulResidualFusion over it.
+static void TestMatMulResidualFusion(const std::vector<int64_t>& residual_shape,
+                                     bool expect_fusion,
+                                     const Logger& logger) {
+  Model model("MatMulResidualFusion", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              {{kOnnxDomain, 13}, {kMSDomain, 1}}, {}, logger);
+  auto& graph = model.MainGraph();
+
+  auto make_float_type = [](const std::vector<int64_t>& shape) {
+    TypeProto type;
+    type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+    for (int64_t dim : shape) {
+      type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+    }
+    return type;
+  };
+
+  TypeProto a_type = make_float_type({2, 4});
+  TypeProto b_type = make_float_type({4, 8});
+  TypeProto y_type = make_float_type({2, 8});
+  TypeProto residual_type = make_float_type(residual_shape);
+
+  auto& input_a = graph.GetOrCreateNodeArg("A", &a_type);
+  auto& input_b = graph.GetOrCreateNodeArg("B", &b_type);
+  auto& residual = graph.GetOrCreateNodeArg("residual", &residual_type);
+  auto& matmul_out = graph.GetOrCreateNodeArg("matmul_out", &y_type);
+  auto& add_out = graph.GetOrCreateNodeArg("add_out", &y_type);
+
+  graph.AddNode("matmul", "MatMul", "matmul", {&input_a, &input_b}, {&matmul_out});
+  graph.AddNode("add", "Add", "residual add", {&matmul_out, &residual}, {&add_out});
+
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  onnxruntime::GraphTransformerManager graph_transformer_manager{5};
+  ASSERT_STATUS_OK(graph_transformer_manager.Register(
+      make_unique<MatMulResidualFusion>(), TransformerLevel::Level2));
+  ASSERT_STATUS_OK(graph_transformer_manager.ApplyTransformers(graph, TransformerLevel::Level2, logger));
+
+  std::map<std::string, int> op_to_count = CountOpsInGraph(graph);
+  if (expect_fusion) {
+    EXPECT_EQ(op_to_count["MatMul"], 0);
+    EXPECT_EQ(op_to_count["Add"], 0);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedMatMul"], 1);
+    for (const auto& node : graph.Nodes()) {
+      if (node.OpType() == "FusedMatMul") {
+        ASSERT_EQ(node.InputDefs().size(), 3u);
+        EXPECT_EQ(node.InputDefs()[2]->Name(), "residual");
+      }
+    }
+  } else {
+    EXPECT_EQ(op_to_count["MatMul"], 1);
+    EXPECT_EQ(op_to_count["Add"], 1);
+    EXPECT_EQ(op_to_count["com.microsoft.FusedMatMul"], 0);
+  }
+}
+
+TEST_F(GraphTransformationTests, MatMulResidualFusionExactShape) {
+  TestMatMulResidualFusion({2, 8}, true, *logger_);
+}
+
+TEST_F(GraphTransformationTests, MatMulResidualFusionBroadcastNotFused) {
+  // a broadcast bias is Gemm/MatMulAddFusion territory, not a residual
+  TestMatMulResidualFusion({8}, false, *logger_);
+}
 #endif
 
 }  // namespace test
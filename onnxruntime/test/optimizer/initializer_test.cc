@@ -105,5 +105,31 @@ TEST(OptimizerInitializerTest, LoadExternalData) {
     EXPECT_THROW(Initializer i(tensor_proto, tensor_data_dir_path), OnnxRuntimeException);
   }
 }
+TEST(OptimizerInitializerTest, CopyOnWriteRawData) {
+  const std::vector<float> values{1.0f, 2.0f, 3.0f, 4.0f};
+  ONNX_NAMESPACE::TensorProto tensor_proto;
+  tensor_proto.set_name("test");
+  tensor_proto.add_dims(values.size());
+  tensor_proto.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  tensor_proto.set_raw_data(values.data(), values.size() * sizeof(float));
+
+  // read-only access references the proto's buffer without copying
+  const Initializer reader(tensor_proto, Path{});
+  EXPECT_EQ(reinterpret_cast<const char*>(reader.data<float>()), tensor_proto.raw_data().data());
+
+  ONNX_NAMESPACE::TensorProto round_tripped;
+  reader.ToProto(round_tripped);
+  EXPECT_EQ(round_tripped.raw_data(), tensor_proto.raw_data());
+
+  // the first mutable access detaches, leaving the source proto untouched
+  Initializer writer(tensor_proto, Path{});
+  writer.add(1.0f);
+  const float* updated = writer.data<float>();
+  EXPECT_NE(reinterpret_cast<const char*>(updated), tensor_proto.raw_data().data());
+  for (size_t i = 0; i < values.size(); ++i) {
+    EXPECT_EQ(updated[i], values[i] + 1.0f);
+    EXPECT_EQ(reader.data<float>()[i], values[i]);
+  }
+}
 }  // namespace test
 }  // namespace onnxruntime
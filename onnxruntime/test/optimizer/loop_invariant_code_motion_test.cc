@@ -0,0 +1,180 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/framework/test_utils.h"
+#include "test/test_environment.h"
+#include "core/graph/model.h"
+#include "core/optimizer/graph_transformer_mgr.h"
+#include "core/optimizer/loop_invariant_code_motion.h"
+
+#include "gtest/gtest.h"
+
+#include <string>
+#include <vector>
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+void ApplyLoopInvariantCodeMotion(Model& model, unsigned num_steps = 1) {
+  GraphTransformerManager graph_transformation_mgr(num_steps);
+  ASSERT_TRUE(
+      graph_transformation_mgr.Register(onnxruntime::make_unique<LoopInvariantCodeMotion>(), TransformerLevel::Level1).IsOK());
+  ASSERT_TRUE(
+      graph_transformation_mgr.ApplyTransformers(model.MainGraph(), TransformerLevel::Level1, DefaultLoggingManager().DefaultLogger()).IsOK());
+}
+
+ONNX_NAMESPACE::TypeProto FloatTensorType(const std::vector<int64_t>& dims) {
+  ONNX_NAMESPACE::TypeProto type;
+  type.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  for (int64_t dim : dims) {
+    type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+  }
+  return type;
+}
+
+ONNX_NAMESPACE::TypeProto ScalarType(ONNX_NAMESPACE::TensorProto_DataType elem_type) {
+  ONNX_NAMESPACE::TypeProto type;
+  type.mutable_tensor_type()->set_elem_type(elem_type);
+  type.mutable_tensor_type()->mutable_shape();
+  return type;
+}
+
+// body computing loop_var_out = Add(loop_var_in, Mul(Neg(x), Neg(x))) with x from the outer
+// scope, so the Neg/Mul chain is invariant across iterations
+ONNX_NAMESPACE::GraphProto CreateLoopBody() {
+  Model model("Loop_body", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto int64_scalar = ScalarType(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+  ONNX_NAMESPACE::TypeProto bool_scalar = ScalarType(ONNX_NAMESPACE::TensorProto_DataType_BOOL);
+  ONNX_NAMESPACE::TypeProto float_type = FloatTensorType({2});
+
+  auto& iter = graph.GetOrCreateNodeArg("iter", &int64_scalar);
+  auto& cond_in = graph.GetOrCreateNodeArg("cond_in", &bool_scalar);
+  auto& loop_var_in = graph.GetOrCreateNodeArg("loop_var_in", &float_type);
+
+  auto& x = graph.GetOrCreateNodeArg("x", &float_type);
+  graph.AddOuterScopeNodeArg("x");
+
+  auto& neg_out = graph.GetOrCreateNodeArg("neg_out", &float_type);
+  auto& invariant = graph.GetOrCreateNodeArg("invariant", &float_type);
+  auto& cond_out = graph.GetOrCreateNodeArg("cond_out", &bool_scalar);
+  auto& loop_var_out = graph.GetOrCreateNodeArg("loop_var_out", &float_type);
+
+  graph.AddNode("loop_neg", "Neg", "", {&x}, {&neg_out});
+  graph.AddNode("loop_mul", "Mul", "", {&neg_out, &neg_out}, {&invariant});
+  graph.AddNode("loop_add", "Add", "", {&loop_var_in, &invariant}, {&loop_var_out});
+  graph.AddNode("cond_identity", "Identity", "", {&cond_in}, {&cond_out});
+
+  graph.SetInputs({&iter, &cond_in, &loop_var_in});
+  graph.SetOutputs({&cond_out, &loop_var_out});
+
+  EXPECT_TRUE(graph.Resolve().IsOK());
+  return graph.ToGraphProto();
+}
+
+}  // namespace
+
+// an invariant chain is hoisted completely out of the Loop body in a single application
+TEST(LoopInvariantCodeMotionTests, HoistInvariantChain) {
+  Model model("licm_loop", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto int64_scalar = ScalarType(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+  ONNX_NAMESPACE::TypeProto bool_scalar = ScalarType(ONNX_NAMESPACE::TensorProto_DataType_BOOL);
+  ONNX_NAMESPACE::TypeProto float_type = FloatTensorType({2});
+
+  auto& max_trip_count = graph.GetOrCreateNodeArg("max_trip_count", &int64_scalar);
+  auto& cond = graph.GetOrCreateNodeArg("cond", &bool_scalar);
+  auto& x = graph.GetOrCreateNodeArg("x", &float_type);
+  auto& loop_out = graph.GetOrCreateNodeArg("loop_out", &float_type);
+
+  auto& loop_node = graph.AddNode("loop_0", "Loop", "", {&max_trip_count, &cond, &x}, {&loop_out});
+  loop_node.AddAttribute("body", CreateLoopBody());
+
+  graph.SetInputs({&max_trip_count, &cond, &x});
+  graph.SetOutputs({&loop_out});
+  ASSERT_TRUE(graph.Resolve().IsOK());
+
+  ApplyLoopInvariantCodeMotion(model);
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_count.at("Neg"), 1);
+  ASSERT_EQ(op_count.at("Mul"), 1);
+  ASSERT_EQ(op_count.at("Loop"), 1);
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Loop") {
+      auto body_count = CountOpsInGraph(*node.GetGraphAttribute("body"));
+      ASSERT_TRUE(body_count.find("Neg") == body_count.end());
+      ASSERT_TRUE(body_count.find("Mul") == body_count.end());
+      ASSERT_EQ(body_count.at("Add"), 1);
+      ASSERT_EQ(body_count.at("Identity"), 1);
+    }
+  }
+}
+
+// values that vary per iteration stay in the body
+TEST(LoopInvariantCodeMotionTests, VariantExpressionNotHoisted) {
+  Model model("licm_variant", false, DefaultLoggingManager().DefaultLogger());
+  auto& graph = model.MainGraph();
+
+  ONNX_NAMESPACE::TypeProto int64_scalar = ScalarType(ONNX_NAMESPACE::TensorProto_DataType_INT64);
+  ONNX_NAMESPACE::TypeProto bool_scalar = ScalarType(ONNX_NAMESPACE::TensorProto_DataType_BOOL);
+  ONNX_NAMESPACE::TypeProto float_type = FloatTensorType({2});
+
+  ONNX_NAMESPACE::GraphProto body_proto;
+  {
+    Model body_model("Loop_body", false, DefaultLoggingManager().DefaultLogger());
+    auto& body = body_model.MainGraph();
+
+    auto& iter = body.GetOrCreateNodeArg("iter", &int64_scalar);
+    auto& cond_in = body.GetOrCreateNodeArg("cond_in", &bool_scalar);
+    auto& loop_var_in = body.GetOrCreateNodeArg("loop_var_in", &float_type);
+
+    auto& variant = body.GetOrCreateNodeArg("variant", &float_type);
+    auto& cond_out = body.GetOrCreateNodeArg("cond_out", &bool_scalar);
+    auto& loop_var_out = body.GetOrCreateNodeArg("loop_var_out", &float_type);
+
+    // both expressions depend on the loop-carried value, so neither can be hoisted
+    body.AddNode("loop_neg", "Neg", "", {&loop_var_in}, {&variant});
+    body.AddNode("loop_add", "Add", "", {&loop_var_in, &variant}, {&loop_var_out});
+    body.AddNode("cond_identity", "Identity", "", {&cond_in}, {&cond_out});
+
+    body.SetInputs({&iter, &cond_in, &loop_var_in});
+    body.SetOutputs({&cond_out, &loop_var_out});
+
+    ASSERT_TRUE(body.Resolve().IsOK());
+    body_proto = body.ToGraphProto();
+  }
+
+  auto& max_trip_count = graph.GetOrCreateNodeArg("max_trip_count", &int64_scalar);
+  auto& cond = graph.GetOrCreateNodeArg("cond", &bool_scalar);
+  auto& x = graph.GetOrCreateNodeArg("x", &float_type);
+  auto& loop_out = graph.GetOrCreateNodeArg("loop_out", &float_type);
+
+  auto& loop_node = graph.AddNode("loop_0", "Loop", "", {&max_trip_count, &cond, &x}, {&loop_out});
+  loop_node.AddAttribute("body", body_proto);
+
+  graph.SetInputs({&max_trip_count, &cond, &x});
+  graph.SetOutputs({&loop_out});
+  ASSERT_TRUE(graph.Resolve().IsOK());
+
+  ApplyLoopInvariantCodeMotion(model);
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_count.find("Neg") == op_count.end());
+
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Loop") {
+      auto body_count = CountOpsInGraph(*node.GetGraphAttribute("body"));
+      ASSERT_EQ(body_count.at("Neg"), 1);
+      ASSERT_EQ(body_count.at("Add"), 1);
+    }
+  }
+}
+
+}  // namespace test
+}  // namespace onnxruntime
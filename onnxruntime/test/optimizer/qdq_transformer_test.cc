@@ -0,0 +1,260 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "core/framework/tensorprotoutils.h"
+#include "core/graph/model.h"
+#include "core/graph/onnx_protobuf.h"
+#include "core/optimizer/graph_transformer_mgr.h"
+#include "core/optimizer/qdq_transformer.h"
+
+#include "asserts.h"
+#include "test/framework/test_utils.h"
+#include "test/optimizer/graph_transform_test_fixture.h"
+#include "test/test_environment.h"
+
+#include "gtest/gtest.h"
+
+namespace onnxruntime {
+namespace test {
+
+struct QDQTestHelper {
+  QDQTestHelper(Graph& graph) : graph_(graph) {
+  }
+
+  template <typename T>
+  NodeArg* MakeInput(const std::vector<int64_t>& shape) {
+    ONNX_NAMESPACE::TypeProto type_proto;
+    type_proto.mutable_tensor_type()->set_elem_type(utils::ToTensorProtoElementType<T>());
+
+    for (auto& dim : shape) {
+      type_proto.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+    }
+
+    std::string name = graph_.GenerateNodeArgName("input");
+    return &graph_.GetOrCreateNodeArg(name, &type_proto);
+  }
+
+  NodeArg* MakeIntermediate() {
+    std::string name = graph_.GenerateNodeArgName("node");
+    return &graph_.GetOrCreateNodeArg(name, nullptr);
+  }
+
+  template <typename T>
+  NodeArg* MakeInitializer(const std::vector<int64_t>& shape, const std::vector<T>& data) {
+    std::string name = graph_.GenerateNodeArgName("constant");
+    ONNX_NAMESPACE::TensorProto tensor_proto;
+    tensor_proto.set_name(name);
+    tensor_proto.set_data_type(utils::ToTensorProtoElementType<T>());
+    tensor_proto.set_raw_data(data.data(), data.size() * sizeof(T));
+
+    for (auto& dim : shape) {
+      tensor_proto.add_dims(dim);
+    }
+
+    graph_.AddInitializedTensor(tensor_proto);
+
+    return &graph_.GetOrCreateNodeArg(name, nullptr);
+  }
+
+  template <typename T>
+  NodeArg* MakeScalarInitializer(T data) {
+    return MakeInitializer({}, std::vector<T>{data});
+  }
+
+  Node& AddNode(const std::string& op_type,
+                const std::vector<NodeArg*>& input_args,
+                const std::vector<NodeArg*>& output_args) {
+    return graph_.AddNode(graph_.GenerateNodeName("node"),
+                          op_type,
+                          "description",
+                          input_args,
+                          output_args);
+  }
+
+  Node& AddDequantizeLinearNode(NodeArg* input_arg,
+                                NodeArg* scale_arg,
+                                NodeArg* zero_point_arg,
+                                NodeArg* output_arg) {
+    std::vector<NodeArg*> input_args{input_arg, scale_arg};
+    if (zero_point_arg != nullptr) {
+      input_args.push_back(zero_point_arg);
+    }
+    return AddNode("DequantizeLinear", input_args, {output_arg});
+  }
+
+  Node& AddQuantizeLinearNode(NodeArg* input_arg,
+                              float scale,
+                              uint8_t zero_point,
+                              NodeArg* output_arg) {
+    return AddNode("QuantizeLinear",
+                   {input_arg, MakeScalarInitializer<float>(scale), MakeScalarInitializer<uint8_t>(zero_point)},
+                   {output_arg});
+  }
+
+  Graph& graph_;
+};
+
+static void QDQTransformerTester(const std::function<void(QDQTestHelper& helper)>& build_test_case,
+                                 const std::function<void(const Graph& graph)>& check_transformed_graph,
+                                 logging::Logger& logger,
+                                 int opset_version = 12) {
+  std::unordered_map<std::string, int> domain_to_version;
+  domain_to_version[kOnnxDomain] = opset_version;
+  Model model("qdq", false, ModelMetaData(), PathString(), IOnnxRuntimeOpSchemaRegistryList(),
+              domain_to_version, {}, DefaultLoggingManager().DefaultLogger());
+
+  Graph& graph = model.MainGraph();
+  QDQTestHelper helper(graph);
+  build_test_case(helper);
+  ASSERT_STATUS_OK(graph.Resolve());
+
+  onnxruntime::GraphTransformerManager graph_transformation_mgr{5};
+  ASSERT_STATUS_OK(graph_transformation_mgr.Register(onnxruntime::make_unique<QDQTransformer>(),
+                                                     TransformerLevel::Level2));
+  ASSERT_STATUS_OK(graph_transformation_mgr.ApplyTransformers(graph, TransformerLevel::Level2, logger));
+
+  check_transformed_graph(graph);
+}
+
+TEST_F(GraphTransformationTests, QDQTransformerConvToQLinearConv) {
+  auto build_test_case = [&](QDQTestHelper& helper) {
+    const float x_scale = 0.05f;
+    const float w_scale = 0.02f;
+
+    auto* input_arg = helper.MakeInput<uint8_t>({1, 4, 8, 8});
+    auto* dq_x_output_arg = helper.MakeIntermediate();
+    auto* dq_w_output_arg = helper.MakeIntermediate();
+    auto* dq_bias_output_arg = helper.MakeIntermediate();
+    auto* conv_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeIntermediate();
+
+    helper.AddDequantizeLinearNode(input_arg,
+                                   helper.MakeScalarInitializer<float>(x_scale),
+                                   helper.MakeScalarInitializer<uint8_t>(128),
+                                   dq_x_output_arg);
+    helper.AddDequantizeLinearNode(helper.MakeInitializer<uint8_t>({16, 4, 3, 3}, std::vector<uint8_t>(16 * 4 * 3 * 3, 1)),
+                                   helper.MakeScalarInitializer<float>(w_scale),
+                                   helper.MakeScalarInitializer<uint8_t>(127),
+                                   dq_w_output_arg);
+    helper.AddDequantizeLinearNode(helper.MakeInitializer<int32_t>({16}, std::vector<int32_t>(16, 100)),
+                                   helper.MakeScalarInitializer<float>(x_scale * w_scale),
+                                   helper.MakeScalarInitializer<int32_t>(0),
+                                   dq_bias_output_arg);
+    helper.AddNode("Conv", {dq_x_output_arg, dq_w_output_arg, dq_bias_output_arg}, {conv_output_arg});
+    helper.AddQuantizeLinearNode(conv_output_arg, 0.37f, 131, output_arg);
+  };
+
+  auto check_transformed_graph = [&](const Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["QLinearConv"], 1);
+    EXPECT_EQ(op_to_count["Conv"], 0);
+    EXPECT_EQ(op_to_count["QuantizeLinear"], 0);
+    EXPECT_EQ(op_to_count["DequantizeLinear"], 0);
+  };
+
+  QDQTransformerTester(build_test_case, check_transformed_graph, *logger_);
+}
+
+TEST_F(GraphTransformationTests, QDQTransformerConvPerChannelWeight) {
+  auto build_test_case = [&](QDQTestHelper& helper) {
+    auto* input_arg = helper.MakeInput<uint8_t>({1, 4, 8, 8});
+    auto* dq_x_output_arg = helper.MakeIntermediate();
+    auto* dq_w_output_arg = helper.MakeIntermediate();
+    auto* conv_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeIntermediate();
+
+    helper.AddDequantizeLinearNode(input_arg,
+                                   helper.MakeScalarInitializer<float>(0.05f),
+                                   helper.MakeScalarInitializer<uint8_t>(128),
+                                   dq_x_output_arg);
+    Node& dq_w_node =
+        helper.AddDequantizeLinearNode(helper.MakeInitializer<int8_t>({16, 4, 3, 3}, std::vector<int8_t>(16 * 4 * 3 * 3, 1)),
+                                       helper.MakeInitializer<float>({16}, std::vector<float>(16, 0.02f)),
+                                       helper.MakeInitializer<int8_t>({16}, std::vector<int8_t>(16, 0)),
+                                       dq_w_output_arg);
+    dq_w_node.AddAttribute("axis", static_cast<int64_t>(0));
+    helper.AddNode("Conv", {dq_x_output_arg, dq_w_output_arg}, {conv_output_arg});
+    helper.AddQuantizeLinearNode(conv_output_arg, 0.37f, 131, output_arg);
+  };
+
+  auto check_transformed_graph = [&](const Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["QLinearConv"], 1);
+    EXPECT_EQ(op_to_count["Conv"], 0);
+    EXPECT_EQ(op_to_count["QuantizeLinear"], 0);
+    EXPECT_EQ(op_to_count["DequantizeLinear"], 0);
+  };
+
+  QDQTransformerTester(build_test_case, check_transformed_graph, *logger_, 13);
+}
+
+TEST_F(GraphTransformationTests, QDQTransformerMatMulToQLinearMatMul) {
+  auto build_test_case = [&](QDQTestHelper& helper) {
+    auto* input_arg = helper.MakeInput<uint8_t>({2, 4});
+    auto* dq_a_output_arg = helper.MakeIntermediate();
+    auto* dq_b_output_arg = helper.MakeIntermediate();
+    auto* matmul_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeIntermediate();
+
+    // Omit the zero point here to verify the transformer synthesizes the zero
+    // point input required by QLinearMatMul.
+    helper.AddDequantizeLinearNode(input_arg,
+                                   helper.MakeScalarInitializer<float>(0.05f),
+                                   nullptr,
+                                   dq_a_output_arg);
+    helper.AddDequantizeLinearNode(helper.MakeInitializer<uint8_t>({4, 3}, std::vector<uint8_t>(4 * 3, 1)),
+                                   helper.MakeScalarInitializer<float>(0.02f),
+                                   helper.MakeScalarInitializer<uint8_t>(127),
+                                   dq_b_output_arg);
+    helper.AddNode("MatMul", {dq_a_output_arg, dq_b_output_arg}, {matmul_output_arg});
+    helper.AddQuantizeLinearNode(matmul_output_arg, 0.37f, 131, output_arg);
+  };
+
+  auto check_transformed_graph = [&](const Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["QLinearMatMul"], 1);
+    EXPECT_EQ(op_to_count["MatMul"], 0);
+    EXPECT_EQ(op_to_count["QuantizeLinear"], 0);
+    EXPECT_EQ(op_to_count["DequantizeLinear"], 0);
+  };
+
+  QDQTransformerTester(build_test_case, check_transformed_graph, *logger_);
+}
+
+TEST_F(GraphTransformationTests, QDQTransformerSharedDequantizeOutputNotFolded) {
+  auto build_test_case = [&](QDQTestHelper& helper) {
+    auto* input_arg = helper.MakeInput<uint8_t>({2, 4});
+    auto* dq_a_output_arg = helper.MakeIntermediate();
+    auto* dq_b_output_arg = helper.MakeIntermediate();
+    auto* matmul_output_arg = helper.MakeIntermediate();
+    auto* relu_output_arg = helper.MakeIntermediate();
+    auto* output_arg = helper.MakeIntermediate();
+
+    helper.AddDequantizeLinearNode(input_arg,
+                                   helper.MakeScalarInitializer<float>(0.05f),
+                                   helper.MakeScalarInitializer<uint8_t>(128),
+                                   dq_a_output_arg);
+    helper.AddDequantizeLinearNode(helper.MakeInitializer<uint8_t>({4, 3}, std::vector<uint8_t>(4 * 3, 1)),
+                                   helper.MakeScalarInitializer<float>(0.02f),
+                                   helper.MakeScalarInitializer<uint8_t>(127),
+                                   dq_b_output_arg);
+    helper.AddNode("MatMul", {dq_a_output_arg, dq_b_output_arg}, {matmul_output_arg});
+    helper.AddQuantizeLinearNode(matmul_output_arg, 0.37f, 131, output_arg);
+
+    // A second consumer of the dequantized activation keeps the pattern alive.
+    helper.AddNode("Relu", {dq_a_output_arg}, {relu_output_arg});
+  };
+
+  auto check_transformed_graph = [&](const Graph& graph) {
+    auto op_to_count = CountOpsInGraph(graph);
+    EXPECT_EQ(op_to_count["QLinearMatMul"], 0);
+    EXPECT_EQ(op_to_count["MatMul"], 1);
+    EXPECT_EQ(op_to_count["QuantizeLinear"], 1);
+    EXPECT_EQ(op_to_count["DequantizeLinear"], 2);
+  };
+
+  QDQTransformerTester(build_test_case, check_transformed_graph, *logger_);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
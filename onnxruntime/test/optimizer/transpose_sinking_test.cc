@@ -0,0 +1,148 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "test/framework/test_utils.h"
+#include "test/test_environment.h"
+#include "core/graph/graph_utils.h"
+#include "core/graph/model.h"
+#include "core/optimizer/graph_transformer_mgr.h"
+#include "core/optimizer/transpose_sinking.h"
+
+#include "gtest/gtest.h"
+
+#include <vector>
+
+using namespace ONNX_NAMESPACE;
+
+namespace onnxruntime {
+namespace test {
+
+namespace {
+
+std::shared_ptr<Model> CreateModel() {
+  return std::make_shared<Model>("TransposeSinkingTest", false, ModelMetaData(), PathString(),
+                                 IOnnxRuntimeOpSchemaRegistryList(), std::unordered_map<std::string, int>{{kOnnxDomain, 12}},
+                                 std::vector<ONNX_NAMESPACE::FunctionProto>{},
+                                 DefaultLoggingManager().DefaultLogger());
+}
+
+TypeProto FloatTensor(const std::vector<int64_t>& dims) {
+  TypeProto type;
+  type.mutable_tensor_type()->set_elem_type(TensorProto_DataType_FLOAT);
+  for (int64_t dim : dims) {
+    type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(dim);
+  }
+  return type;
+}
+
+Node& AddTranspose(Graph& graph, const std::string& name, NodeArg& input, NodeArg& output,
+                   const std::vector<int64_t>& perm) {
+  Node& node = graph.AddNode(name, "Transpose", "", {&input}, {&output});
+  node.AddAttribute("perm", perm);
+  return node;
+}
+
+void ApplyTransposeSinking(Model& model, unsigned num_steps = 5) {
+  GraphTransformerManager graph_transformation_mgr(num_steps);
+  ASSERT_TRUE(
+      graph_transformation_mgr.Register(onnxruntime::make_unique<TransposeSinking>(), TransformerLevel::Level1).IsOK());
+  ASSERT_TRUE(
+      graph_transformation_mgr.ApplyTransformers(model.MainGraph(), TransformerLevel::Level1, DefaultLoggingManager().DefaultLogger()).IsOK());
+}
+
+}  // namespace
+
+// an inverse Transpose pair separated by elementwise ops cancels completely
+TEST(TransposeSinkingTests, InversePairAcrossElementwise) {
+  auto model = CreateModel();
+  Graph& graph = model->MainGraph();
+
+  TypeProto input_type = FloatTensor({2, 3, 4});
+  TypeProto transposed_type = FloatTensor({3, 2, 4});
+
+  auto& x = graph.GetOrCreateNodeArg("x", &input_type);
+  auto& t1_out = graph.GetOrCreateNodeArg("t1_out", &transposed_type);
+  auto& relu_out = graph.GetOrCreateNodeArg("relu_out", &transposed_type);
+  auto& t2_out = graph.GetOrCreateNodeArg("t2_out", &input_type);
+  auto& final_out = graph.GetOrCreateNodeArg("final_out", &input_type);
+
+  AddTranspose(graph, "t1", x, t1_out, {1, 0, 2});
+  graph.AddNode("relu", "Relu", "", {&t1_out}, {&relu_out});
+  AddTranspose(graph, "t2", relu_out, t2_out, {1, 0, 2});
+  graph.AddNode("sigmoid", "Sigmoid", "", {&t2_out}, {&final_out});
+
+  ASSERT_TRUE(graph.Resolve().IsOK());
+  ApplyTransposeSinking(*model);
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_TRUE(op_count.find("Transpose") == op_count.end());
+  ASSERT_EQ(op_count.at("Relu"), 1);
+  ASSERT_EQ(op_count.at("Sigmoid"), 1);
+
+  // the graph output name is preserved
+  ASSERT_EQ(graph.GetOutputs().size(), 1u);
+  ASSERT_EQ(graph.GetOutputs()[0]->Name(), "final_out");
+}
+
+// back-to-back Transposes merge into one with the composed permutation
+TEST(TransposeSinkingTests, ComposeAdjacentPair) {
+  auto model = CreateModel();
+  Graph& graph = model->MainGraph();
+
+  TypeProto input_type = FloatTensor({2, 3, 4});
+  TypeProto t1_type = FloatTensor({3, 2, 4});
+  TypeProto t2_type = FloatTensor({3, 4, 2});
+
+  auto& x = graph.GetOrCreateNodeArg("x", &input_type);
+  auto& t1_out = graph.GetOrCreateNodeArg("t1_out", &t1_type);
+  auto& t2_out = graph.GetOrCreateNodeArg("t2_out", &t2_type);
+  auto& relu_out = graph.GetOrCreateNodeArg("relu_out", &t2_type);
+
+  AddTranspose(graph, "t1", x, t1_out, {1, 0, 2});
+  AddTranspose(graph, "t2", t1_out, t2_out, {0, 2, 1});
+  graph.AddNode("relu", "Relu", "", {&t2_out}, {&relu_out});
+
+  ASSERT_TRUE(graph.Resolve().IsOK());
+  ApplyTransposeSinking(*model);
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_count.at("Transpose"), 1);
+  ASSERT_EQ(op_count.at("Relu"), 1);
+
+  // the surviving Transpose carries the composed permutation and reads the original input
+  for (const auto& node : graph.Nodes()) {
+    if (node.OpType() == "Transpose") {
+      ASSERT_EQ(node.InputDefs()[0]->Name(), "x");
+      std::vector<int64_t> perms;
+      ASSERT_TRUE(graph_utils::GetRepeatedNodeAttributeValues(node, "perm", perms));
+      ASSERT_EQ(perms, (std::vector<int64_t>{1, 2, 0}));
+    }
+  }
+}
+
+// a Transpose feeding a graph output directly is left alone
+TEST(TransposeSinkingTests, GraphOutputNotSunk) {
+  auto model = CreateModel();
+  Graph& graph = model->MainGraph();
+
+  TypeProto input_type = FloatTensor({2, 3});
+  TypeProto transposed_type = FloatTensor({3, 2});
+
+  auto& x = graph.GetOrCreateNodeArg("x", &input_type);
+  auto& t_out = graph.GetOrCreateNodeArg("t_out", &transposed_type);
+  auto& relu_out = graph.GetOrCreateNodeArg("relu_out", &transposed_type);
+
+  AddTranspose(graph, "t", x, t_out, {1, 0});
+  graph.AddNode("relu", "Relu", "", {&t_out}, {&relu_out});
+  graph.SetOutputs({&t_out, &relu_out});
+
+  ASSERT_TRUE(graph.Resolve().IsOK());
+  ApplyTransposeSinking(*model);
+
+  auto op_count = CountOpsInGraph(graph);
+  ASSERT_EQ(op_count.at("Transpose"), 1);
+  ASSERT_EQ(op_count.at("Relu"), 1);
+}
+
+}  // namespace test
+}  // namespace onnxruntime
@@ -31,6 +31,8 @@ namespace perftest {
       "\t\tProvide 'duration' to run the test for a fix duration, and 'times' to repeated for a certain times. \n"
       "\t-M: Disable memory pattern.\n"
       "\t-A: Disable memory arena\n"
+      "\t-B: Use BFCArena for the CPU memory arena. Only meaningful in builds where the mimalloc arena is the "
+      "default; lets one binary A/B the two arena implementations.\n"
       "\t-I: Generate tensor input binding (Free dimensions are treated as 1.)\n"
       "\t-c [parallel runs]: Specifies the (max) number of runs to invoke simultaneously. Default:1.\n"
       "\t-e [cpu|cuda|dnnl|tensorrt|openvino|nuphar|dml|acl]: Specifies the provider 'cpu','cuda','dnnl','tensorrt', "
@@ -58,12 +60,38 @@ namespace perftest {
       "\t    [OpenVINO only] [num_of_threads]: Overrides the accelerator hardware type and precision with these values at runtime.\n"
       "\t [Usage]: -e <provider_name> -i '<key1>|<value1> <key2>|<value2>'\n\n"
       "\t [Example] [For OpenVINO EP] -e openvino -i 'device_type|CPU_FP32 enable_vpu_fast_compile|true num_of_threads|5'\n"
+      "\t-C [sweep_concurrency_list]: Comma-separated concurrent run counts to sweep in one invocation, e.g. '1,2,4,8'. Enables sweep mode.\n"
+      "\t-T [sweep_intra_op_threads_list]: Comma-separated intra_op_num_threads values to sweep. Enables sweep mode; default is the -x value only.\n"
+      "\t-N [sweep_batch_list]: Comma-separated batch sizes to sweep. Each value is substituted for free dimensions of generated inputs, so it requires -I.\n"
+      "\t-L [latency_slo_ms]: Latency SLO in milliseconds. Searches for the highest concurrency whose P99 latency stays under the SLO and reports the QPS it sustains.\n"
+      "\t-w [sweep_result_file]: File to write sweep results to. A '.json' extension selects JSON, anything else CSV.\n"
       "\t-h: help\n");
 }
 
+static bool ParseSizeList(const ORTCHAR_T* arg, std::vector<size_t>& values) {
+  std::basic_string<ORTCHAR_T> list{arg};
+  size_t pos = 0;
+  while (pos <= list.size()) {
+    auto comma = list.find(ORT_TSTR(','), pos);
+    if (comma == std::basic_string<ORTCHAR_T>::npos) {
+      comma = list.size();
+    }
+    if (comma == pos) {
+      return false;
+    }
+    auto value = OrtStrtol<PATH_CHAR_TYPE>(list.substr(pos, comma - pos).c_str(), nullptr);
+    if (value <= 0) {
+      return false;
+    }
+    values.push_back(static_cast<size_t>(value));
+    pos = comma + 1;
+  }
+  return !values.empty();
+}
+
 /*static*/ bool CommandLineParser::ParseArguments(PerformanceTestConfig& test_config, int argc, ORTCHAR_T* argv[]) {
   int ch;
-  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:d:o:u:i:AMPIvhsqz"))) != -1) {
+  while ((ch = getopt(argc, argv, ORT_TSTR("b:m:e:r:t:p:x:y:c:d:o:u:i:C:T:N:L:w:ABMPIvhsqz"))) != -1) {
     switch (ch) {
       case 'm':
         if (!CompareCString(optarg, ORT_TSTR("duration"))) {
@@ -86,6 +114,9 @@ namespace perftest {
       case 'A':
         test_config.run_config.enable_cpu_mem_arena = false;
         break;
+      case 'B':
+        test_config.run_config.use_bfc_arena = true;
+        break;
       case 'e':
         if (!CompareCString(optarg, ORT_TSTR("cpu"))) {
           test_config.machine_config.provider_type_name = onnxruntime::kCpuExecutionProvider;
@@ -199,6 +230,43 @@ namespace perftest {
       case 'i':
         test_config.run_config.ep_runtime_config_string = optarg;
         break;
+      case 'C':
+        if (!ParseSizeList(optarg, test_config.run_config.sweep_concurrency_list)) {
+          return false;
+        }
+        test_config.run_config.f_sweep = true;
+        break;
+      case 'T': {
+        std::vector<size_t> values;
+        if (!ParseSizeList(optarg, values)) {
+          return false;
+        }
+        for (size_t value : values) {
+          test_config.run_config.sweep_intra_threads_list.push_back(static_cast<int>(value));
+        }
+        test_config.run_config.f_sweep = true;
+        break;
+      }
+      case 'N': {
+        std::vector<size_t> values;
+        if (!ParseSizeList(optarg, values)) {
+          return false;
+        }
+        for (size_t value : values) {
+          test_config.run_config.sweep_batch_list.push_back(static_cast<int64_t>(value));
+        }
+        test_config.run_config.f_sweep = true;
+        break;
+      }
+      case 'L':
+        test_config.run_config.latency_slo_ms = static_cast<double>(OrtStrtol<PATH_CHAR_TYPE>(optarg, nullptr));
+        if (test_config.run_config.latency_slo_ms <= 0) {
+          return false;
+        }
+        break;
+      case 'w':
+        test_config.run_config.sweep_output_path = optarg;
+        break;
       case '?':
       case 'h':
       default:
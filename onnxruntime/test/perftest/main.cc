@@ -6,6 +6,7 @@
 #include <random>
 #include "command_args_parser.h"
 #include "performance_runner.h"
+#include "sweep_runner.h"
 #include <google/protobuf/stubs/common.h>
 
 using namespace onnxruntime;
@@ -42,6 +43,15 @@ int real_main(int argc, char* argv[]) {
       return -1;
   }
   std::random_device rd;
+  if (test_config.run_config.f_sweep || test_config.run_config.latency_slo_ms > 0) {
+    perftest::SweepRunner sweep_runner(env, test_config, rd);
+    auto status = sweep_runner.Run();
+    if (!status.IsOK()) {
+      printf("Sweep failed:%s\n", status.ErrorMessage().c_str());
+      return -1;
+    }
+    return 0;
+  }
   perftest::PerformanceRunner perf_runner(env, test_config, rd);
   auto status = perf_runner.Run();
   if (!status.IsOK()) {
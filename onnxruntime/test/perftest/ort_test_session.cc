@@ -28,7 +28,8 @@ std::chrono::duration<double> OnnxRuntimeTestSession::Run() {
 OnnxRuntimeTestSession::OnnxRuntimeTestSession(Ort::Env& env, std::random_device& rd,
                                                const PerformanceTestConfig& performance_test_config,
                                                const TestModelInfo& m)
-    : rand_engine_(rd()), input_names_(m.GetInputCount()), input_length_(m.GetInputCount()) {
+    : rand_engine_(rd()), input_names_(m.GetInputCount()), input_length_(m.GetInputCount()),
+      free_dim_override_(performance_test_config.run_config.free_dim_override) {
   Ort::SessionOptions session_options;
   const std::string& provider_name = performance_test_config.machine_config.provider_type_name;
   if (provider_name == onnxruntime::kDnnlExecutionProvider) {
@@ -176,6 +177,8 @@ OnnxRuntimeTestSession::OnnxRuntimeTestSession(Ort::Env& env, std::random_device
     session_options.EnableCpuMemArena();
   else
     session_options.DisableCpuMemArena();
+  if (performance_test_config.run_config.use_bfc_arena)
+    session_options.AddConfigEntry(kOrtSessionOptionsUseMimallocArena, "0");
   if (performance_test_config.run_config.enable_memory_pattern &&
       performance_test_config.run_config.execution_mode == ExecutionMode::ORT_SEQUENTIAL)
     session_options.EnableMemPattern();
@@ -233,10 +236,10 @@ bool OnnxRuntimeTestSession::PopulateGeneratedInputTestData() {
       auto tensor_info = type_info.GetTensorTypeAndShapeInfo();
       std::vector<int64_t> input_node_dim = tensor_info.GetShape();
 
-      // free dimensions are treated as 1
+      // free dimensions are treated as free_dim_override_ (1 unless a sweep sets a batch size)
       for (int64_t& dim : input_node_dim) {
         if (dim == -1) {
-          dim = 1;
+          dim = free_dim_override_;
         }
       }
       // default allocator doesn't have to be freed by user
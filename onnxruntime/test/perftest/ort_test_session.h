@@ -47,6 +47,7 @@ class OnnxRuntimeTestSession : public TestSession {
   std::vector<const char*> output_names_raw_ptr;
   std::vector<char*> input_names_;
   const int input_length_;
+  const int64_t free_dim_override_;
 };
 
 }  // namespace perftest
@@ -0,0 +1,199 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "sweep_runner.h"
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+
+#include <core/platform/path_lib.h>
+
+#include "performance_runner.h"
+
+using onnxruntime::Status;
+
+namespace onnxruntime {
+namespace perftest {
+
+// A saturation search doubles concurrency until the SLO is missed; this caps
+// the doubling phase when every probed level keeps meeting the SLO.
+static constexpr size_t kMaxSearchConcurrency = 256;
+
+static void Summarize(const PerformanceResult& result, SweepCellResult& cell) {
+  cell.iterations = result.time_costs.size();
+  std::chrono::duration<double> wall = result.end - result.start;
+  cell.wall_seconds = wall.count();
+  if (cell.iterations == 0) {
+    return;
+  }
+  cell.qps = cell.wall_seconds > 0 ? cell.iterations / cell.wall_seconds : 0;
+  cell.avg_ms = result.total_time_cost / cell.iterations * 1000;
+
+  std::vector<double> sorted_time = result.time_costs;
+  std::sort(sorted_time.begin(), sorted_time.end());
+  size_t total = sorted_time.size();
+  cell.p50_ms = sorted_time[static_cast<size_t>(total * 0.5)] * 1000;
+  cell.p90_ms = sorted_time[static_cast<size_t>(total * 0.9)] * 1000;
+  cell.p95_ms = sorted_time[static_cast<size_t>(total * 0.95)] * 1000;
+  cell.p99_ms = sorted_time[static_cast<size_t>(total * 0.99)] * 1000;
+  cell.p999_ms = sorted_time[static_cast<size_t>(total * 0.999)] * 1000;
+}
+
+SweepRunner::SweepRunner(Ort::Env& env, const PerformanceTestConfig& base_config, std::random_device& rd)
+    : env_(env), base_config_(base_config), rd_(rd) {}
+
+Status SweepRunner::RunCell(size_t concurrency, int intra_op_num_threads, int64_t batch_size,
+                            SweepCellResult& cell) {
+  PerformanceTestConfig config = base_config_;
+  config.run_config.concurrent_session_runs = concurrency;
+  config.run_config.intra_op_num_threads = intra_op_num_threads;
+  config.run_config.free_dim_override = batch_size;
+
+  std::cout << "[sweep] concurrency=" << concurrency << " threads=" << intra_op_num_threads
+            << " batch=" << batch_size << std::endl;
+  PerformanceRunner runner(env_, config, rd_);
+  ORT_RETURN_IF_ERROR(runner.Run());
+
+  cell = SweepCellResult{};
+  cell.concurrency = concurrency;
+  cell.intra_op_num_threads = intra_op_num_threads;
+  cell.batch_size = batch_size;
+  Summarize(runner.GetResult(), cell);
+  if (cell.iterations == 0) {
+    return ORT_MAKE_STATUS(ONNXRUNTIME, FAIL, "sweep cell completed no iterations.");
+  }
+
+  std::cout << "[sweep] qps=" << cell.qps << " avg=" << cell.avg_ms << "ms p50=" << cell.p50_ms
+            << "ms p95=" << cell.p95_ms << "ms p99=" << cell.p99_ms << "ms p999=" << cell.p999_ms
+            << "ms" << std::endl;
+  return Status::OK();
+}
+
+Status SweepRunner::Run() {
+  auto concurrency_list = base_config_.run_config.sweep_concurrency_list;
+  if (concurrency_list.empty()) {
+    concurrency_list.push_back(base_config_.run_config.concurrent_session_runs);
+  }
+  auto threads_list = base_config_.run_config.sweep_intra_threads_list;
+  if (threads_list.empty()) {
+    threads_list.push_back(base_config_.run_config.intra_op_num_threads);
+  }
+  auto batch_list = base_config_.run_config.sweep_batch_list;
+  if (batch_list.empty()) {
+    batch_list.push_back(base_config_.run_config.free_dim_override);
+  }
+
+  if (base_config_.run_config.f_sweep) {
+    for (int64_t batch_size : batch_list) {
+      for (int intra_op_num_threads : threads_list) {
+        for (size_t concurrency : concurrency_list) {
+          SweepCellResult cell;
+          ORT_RETURN_IF_ERROR(RunCell(concurrency, intra_op_num_threads, batch_size, cell));
+          results_.push_back(cell);
+        }
+      }
+    }
+  }
+
+  if (base_config_.run_config.latency_slo_ms > 0) {
+    ORT_RETURN_IF_ERROR(SaturationSearch());
+  }
+
+  WriteResults();
+  return Status::OK();
+}
+
+Status SweepRunner::SaturationSearch() {
+  const double slo_ms = base_config_.run_config.latency_slo_ms;
+  const int intra_op_num_threads = base_config_.run_config.intra_op_num_threads;
+  const int64_t batch_size = base_config_.run_config.free_dim_override;
+
+  size_t highest_passing = 0;
+  size_t lowest_failing = 0;
+  SweepCellResult best{};
+
+  // double concurrency until the SLO is missed, then bisect the bracket
+  for (size_t concurrency = 1; lowest_failing == 0 && concurrency <= kMaxSearchConcurrency; concurrency *= 2) {
+    SweepCellResult cell;
+    ORT_RETURN_IF_ERROR(RunCell(concurrency, intra_op_num_threads, batch_size, cell));
+    results_.push_back(cell);
+    if (cell.p99_ms <= slo_ms) {
+      highest_passing = concurrency;
+      if (cell.qps > best.qps) {
+        best = cell;
+      }
+    } else {
+      lowest_failing = concurrency;
+    }
+  }
+
+  while (lowest_failing > highest_passing + 1) {
+    size_t concurrency = highest_passing + (lowest_failing - highest_passing) / 2;
+    SweepCellResult cell;
+    ORT_RETURN_IF_ERROR(RunCell(concurrency, intra_op_num_threads, batch_size, cell));
+    results_.push_back(cell);
+    if (cell.p99_ms <= slo_ms) {
+      highest_passing = concurrency;
+      if (cell.qps > best.qps) {
+        best = cell;
+      }
+    } else {
+      lowest_failing = concurrency;
+    }
+  }
+
+  if (highest_passing == 0) {
+    std::cout << "Saturation search: no concurrency level met the " << slo_ms << " ms P99 SLO" << std::endl;
+  } else {
+    std::cout << "Saturation search: max sustainable QPS " << best.qps << " at concurrency " << best.concurrency
+              << " (P99 " << best.p99_ms << " ms <= SLO " << slo_ms << " ms)" << std::endl;
+  }
+  return Status::OK();
+}
+
+void SweepRunner::WriteResults() const {
+  const auto& path = base_config_.run_config.sweep_output_path;
+  if (path.empty()) {
+    return;
+  }
+
+  std::ofstream outfile(path);
+  if (!outfile.good()) {
+    std::cerr << "failed to open sweep result file '" << ToMBString(path) << "'.\n";
+    return;
+  }
+
+  if (HasExtensionOf(path, ORT_TSTR("json"))) {
+    outfile << "[";
+    for (size_t i = 0; i < results_.size(); ++i) {
+      const auto& cell = results_[i];
+      outfile << (i == 0 ? "" : ",") << "\n"
+              << "  {\"concurrency\": " << cell.concurrency
+              << ", \"intra_op_num_threads\": " << cell.intra_op_num_threads
+              << ", \"batch_size\": " << cell.batch_size
+              << ", \"iterations\": " << cell.iterations
+              << ", \"wall_seconds\": " << cell.wall_seconds
+              << ", \"qps\": " << cell.qps
+              << ", \"avg_ms\": " << cell.avg_ms
+              << ", \"p50_ms\": " << cell.p50_ms
+              << ", \"p90_ms\": " << cell.p90_ms
+              << ", \"p95_ms\": " << cell.p95_ms
+              << ", \"p99_ms\": " << cell.p99_ms
+              << ", \"p999_ms\": " << cell.p999_ms << "}";
+    }
+    outfile << "\n]" << std::endl;
+  } else {
+    outfile << "concurrency,intra_op_num_threads,batch_size,iterations,wall_seconds,qps,"
+               "avg_ms,p50_ms,p90_ms,p95_ms,p99_ms,p999_ms\n";
+    for (const auto& cell : results_) {
+      outfile << cell.concurrency << "," << cell.intra_op_num_threads << "," << cell.batch_size << ","
+              << cell.iterations << "," << cell.wall_seconds << "," << cell.qps << "," << cell.avg_ms << ","
+              << cell.p50_ms << "," << cell.p90_ms << "," << cell.p95_ms << "," << cell.p99_ms << ","
+              << cell.p999_ms << "\n";
+    }
+  }
+}
+
+}  // namespace perftest
+}  // namespace onnxruntime
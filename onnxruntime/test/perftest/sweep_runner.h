@@ -0,0 +1,63 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <random>
+#include <vector>
+// onnxruntime dependencies
+#include <core/common/common.h>
+#include <core/common/status.h>
+#include <core/session/onnxruntime_cxx_api.h>
+#include "test_configuration.h"
+
+namespace onnxruntime {
+namespace perftest {
+
+// One measured combination of concurrency, intra-op threads and batch size.
+// Latency percentiles are computed from the per-request high resolution
+// timings, QPS from the wall time of the measurement phase.
+struct SweepCellResult {
+  size_t concurrency{1};
+  int intra_op_num_threads{0};
+  int64_t batch_size{1};
+  size_t iterations{0};
+  double wall_seconds{0};
+  double qps{0};
+  double avg_ms{0};
+  double p50_ms{0};
+  double p90_ms{0};
+  double p95_ms{0};
+  double p99_ms{0};
+  double p999_ms{0};
+};
+
+// Runs the configured performance test once per cell of the
+// concurrency x intra-op threads x batch size grid. When a latency SLO is set
+// it additionally searches for the highest concurrency whose P99 latency stays
+// under the SLO and reports the QPS that concurrency sustains. Results are
+// written to run_config.sweep_output_path as CSV or JSON.
+class SweepRunner {
+ public:
+  SweepRunner(Ort::Env& env, const PerformanceTestConfig& base_config, std::random_device& rd);
+
+  Status Run();
+
+  const std::vector<SweepCellResult>& GetResults() const { return results_; }
+
+  ORT_DISALLOW_COPY_ASSIGNMENT_AND_MOVE(SweepRunner);
+
+ private:
+  Status RunCell(size_t concurrency, int intra_op_num_threads, int64_t batch_size,
+                 /* out */ SweepCellResult& cell);
+  Status SaturationSearch();
+  void WriteResults() const;
+
+  Ort::Env& env_;
+  PerformanceTestConfig base_config_;
+  std::random_device& rd_;
+  std::vector<SweepCellResult> results_;
+};
+
+}  // namespace perftest
+}  // namespace onnxruntime
@@ -5,6 +5,7 @@
 
 #include <cstdint>
 #include <string>
+#include <vector>
 
 #include "core/graph/constants.h"
 #include "core/framework/session_options.h"
@@ -44,6 +45,7 @@ struct RunConfig {
   bool f_verbose{false};
   bool enable_memory_pattern{true};
   bool enable_cpu_mem_arena{true};
+  bool use_bfc_arena{false};
   bool generate_model_input_binding{false};
   ExecutionMode execution_mode{ExecutionMode::ORT_SEQUENTIAL};
   int intra_op_num_threads{0};
@@ -54,6 +56,20 @@ struct RunConfig {
   bool do_cuda_copy_in_separate_stream{false};
   bool set_denormal_as_zero{false};
   std::basic_string<ORTCHAR_T> ep_runtime_config_string;
+  // Sweep mode (see sweep_runner.h). Empty lists fall back to the single value
+  // configured above, so -C/-T/-N can be combined freely.
+  bool f_sweep{false};
+  std::vector<size_t> sweep_concurrency_list;
+  std::vector<int> sweep_intra_threads_list;
+  std::vector<int64_t> sweep_batch_list;
+  // When > 0, search for the highest concurrency whose P99 latency stays under
+  // this bound and report the QPS it sustains.
+  double latency_slo_ms{0};
+  std::basic_string<ORTCHAR_T> sweep_output_path;
+  // Value substituted for free dimensions of generated inputs (-I). The batch
+  // axis of most models is a free dimension, so this is how a sweep scales the
+  // batch size.
+  int64_t free_dim_override{1};
 };
 
 struct PerformanceTestConfig {
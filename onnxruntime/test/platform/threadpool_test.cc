@@ -211,6 +211,78 @@ TEST(ThreadPoolTest, TestParallelFor_1_Thread_50_Task) {
   TestParallelFor("TestParallelFor_1_Thread_50_Task", 1, 50);
 }
 
+TEST(ThreadPoolTest, TestSpinLoopIterationsBound) {
+  // pools with spinning disabled, bounded or defaulted must all run loops correctly
+  for (int spin : {0, 64, -1}) {
+    onnxruntime::ThreadOptions thread_options;
+    thread_options.spin_loop_iterations = spin;
+    auto tp = onnxruntime::make_unique<ThreadPool>(&onnxruntime::Env::Default(), thread_options, nullptr, 3, true);
+    auto test_data = CreateTestData(100);
+    ThreadPool::TrySimpleParallelFor(tp.get(), 100, [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+    ValidateTestData(*test_data);
+  }
+}
+
+// Runs the same loop repeatedly on a pool with cost calibration enabled, covering the
+// measuring warmup runs and the calibrated runs that follow. Every index must still be
+// visited exactly once per run regardless of which path schedules the loop.
+void TestCalibratedParallelFor(const std::string& name, int num_threads, int num_tasks,
+                               const onnxruntime::TensorOpCost& static_cost) {
+  CreateThreadPoolAndTest(name, num_threads, [&](ThreadPool* tp) {
+    if (tp != nullptr) {
+      tp->EnableCostCalibration();
+    }
+    for (int rep = 0; rep < 6; ++rep) {
+      auto test_data = CreateTestData(num_tasks);
+      ThreadPool::TryParallelFor(tp, num_tasks, static_cost, [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+        for (std::ptrdiff_t i = first; i < last; ++i) {
+          IncrementElement(*test_data, i);
+        }
+      });
+      ValidateTestData(*test_data);
+    }
+  });
+}
+
+TEST(ThreadPoolTest, TestCalibratedParallelFor_2_Thread_CheapLoop) {
+  // tiny real cost: calibration should settle on running these sequentially
+  TestCalibratedParallelFor("TestCalibratedParallelFor_2_Thread_CheapLoop", 2, 50,
+                            onnxruntime::TensorOpCost{0, 0, 1.0e6});
+}
+
+TEST(ThreadPoolTest, TestCalibratedParallelFor_2_Thread_LargeLoop) {
+  TestCalibratedParallelFor("TestCalibratedParallelFor_2_Thread_LargeLoop", 2, 1000000,
+                            onnxruntime::TensorOpCost{8, 8, 10.0});
+}
+
+TEST(ThreadPoolTest, TestPoolStats) {
+  // a null pool reports zeroed stats
+  auto null_stats = ThreadPool::GetStats(nullptr);
+  ASSERT_EQ(null_stats.tasks_executed, 0u);
+  ASSERT_EQ(null_stats.steals, 0u);
+  ASSERT_EQ(null_stats.blocks, 0u);
+
+  CreateThreadPoolAndTest("TestPoolStats", 3, [&](ThreadPool* tp) {
+    const auto before = ThreadPool::GetStats(tp);
+    for (int rep = 0; rep < 10; ++rep) {
+      auto test_data = CreateTestData(1000);
+      ThreadPool::TrySimpleParallelFor(tp, 1000, [&](std::ptrdiff_t i) { IncrementElement(*test_data, i); });
+      ValidateTestData(*test_data);
+    }
+    const auto after = ThreadPool::GetStats(tp);
+    // workers must have picked up shards of the loops; steal and block counts are timing
+    // dependent so just check they did not go backwards
+    ASSERT_GT(after.tasks_executed, before.tasks_executed);
+    ASSERT_GE(after.steals, before.steals);
+    ASSERT_GE(after.blocks, before.blocks);
+  });
+}
+
+TEST(ThreadPoolTest, TestCalibratedParallelFor_0_Thread) {
+  TestCalibratedParallelFor("TestCalibratedParallelFor_0_Thread", 0, 50,
+                            onnxruntime::TensorOpCost{0, 0, 100.0});
+}
+
 TEST(ThreadPoolTest, TestBatchParallelFor_0_Thread_50_Task_10_Batch) {
   TestBatchParallelFor("TestBatchParallelFor_0_Thread_50_Task_10_Batch", 0, 50, 10);
 }
@@ -410,4 +482,77 @@ TEST(ThreadPoolTest, TestStackSize) {
 }
 #endif
 
+#ifndef _OPENMP
+TEST(ThreadPoolTest, TestCancellationCheckpointTerminateFlag) {
+  CreateThreadPoolAndTest("", 2, [](ThreadPool* tp) {
+    // with the terminate flag already raised the loop abandons its blocks, as the flag is
+    // checked before each block runs
+    bool terminate = true;
+    ThreadPool::CancellationCheckpoint checkpoint;
+    checkpoint.terminate = &terminate;
+    auto previous = ThreadPool::SetThreadCancellationCheckpoint(checkpoint);
+
+    constexpr int num_tasks = 10000;
+    std::atomic<int> executed{0};
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t) { executed++; });
+
+    ThreadPool::SetThreadCancellationCheckpoint(previous);
+    ASSERT_LT(executed.load(), num_tasks);
+
+    // with the flag lowered the same loop runs to completion
+    terminate = false;
+    previous = ThreadPool::SetThreadCancellationCheckpoint(checkpoint);
+    executed = 0;
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t) { executed++; });
+    ThreadPool::SetThreadCancellationCheckpoint(previous);
+    ASSERT_EQ(executed.load(), num_tasks);
+  });
+}
+
+TEST(ThreadPoolTest, TestCancellationCheckpointDeadline) {
+  CreateThreadPoolAndTest("", 2, [](ThreadPool* tp) {
+    // an already expired deadline stops the loop once the rate-limited deadline check fires
+    ThreadPool::CancellationCheckpoint checkpoint;
+    checkpoint.deadline = std::chrono::steady_clock::now() - std::chrono::milliseconds(1);
+    auto previous = ThreadPool::SetThreadCancellationCheckpoint(checkpoint);
+
+    constexpr int num_tasks = 100000;
+    std::atomic<int> executed{0};
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t) { executed++; });
+
+    ThreadPool::SetThreadCancellationCheckpoint(previous);
+    ASSERT_LT(executed.load(), num_tasks);
+
+    // a deadline far in the future does not interfere
+    checkpoint.deadline = std::chrono::steady_clock::now() + std::chrono::hours(1);
+    previous = ThreadPool::SetThreadCancellationCheckpoint(checkpoint);
+    executed = 0;
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t) { executed++; });
+    ThreadPool::SetThreadCancellationCheckpoint(previous);
+    ASSERT_EQ(executed.load(), num_tasks);
+  });
+}
+
+TEST(ThreadPoolTest, TestSchedulingPriority) {
+  // the per-thread priority defaults to kNormal, and Set returns the previous value so
+  // nested scopes can restore it
+  ASSERT_EQ(ThreadPool::GetThreadSchedulingPriority(), ThreadPool::SchedulingPriority::kNormal);
+  auto previous = ThreadPool::SetThreadSchedulingPriority(ThreadPool::SchedulingPriority::kHigh);
+  ASSERT_EQ(previous, ThreadPool::SchedulingPriority::kNormal);
+  ASSERT_EQ(ThreadPool::GetThreadSchedulingPriority(), ThreadPool::SchedulingPriority::kHigh);
+
+  // loops run under the high-priority class produce the same results; only the queueing
+  // order relative to normal-priority work differs
+  CreateThreadPoolAndTest("", 4, [](ThreadPool* tp) {
+    constexpr int num_tasks = 10000;
+    std::atomic<int> executed{0};
+    ThreadPool::TrySimpleParallelFor(tp, num_tasks, [&](std::ptrdiff_t) { executed++; });
+    ASSERT_EQ(executed.load(), num_tasks);
+  });
+
+  ThreadPool::SetThreadSchedulingPriority(previous);
+  ASSERT_EQ(ThreadPool::GetThreadSchedulingPriority(), ThreadPool::SchedulingPriority::kNormal);
+}
+#endif  // !_OPENMP
+
 }  // namespace onnxruntime
@@ -3,6 +3,7 @@
 
 #include "activation_op_test.h"
 #include "core/providers/cpu/activation/activations.h"
+#include "core/util/math.h"
 
 namespace onnxruntime {
 namespace test {
@@ -53,6 +54,20 @@ TEST_F(ActivationOpTest, Relu) {
                            [](double x) { return std::max(x, 0.0); });
 }
 
+TEST_F(ActivationOpTest, Relu_float16) {
+  OpTester test("Relu", 13);
+  auto make_fp16 = [](const std::vector<float>& values) {
+    std::vector<MLFloat16> output;
+    for (float value : values) {
+      output.push_back(MLFloat16(math::floatToHalf(value)));
+    }
+    return output;
+  };
+  test.AddInput<MLFloat16>("X", {5}, make_fp16({-1.0f, 0.0f, 1.0f, 100.0f, -100.0f}));
+  test.AddOutput<MLFloat16>("Y", {5}, make_fp16({0.0f, 0.0f, 1.0f, 100.0f, 0.0f}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 TEST_F(ActivationOpTest, Elu) {
   float alpha = 0.1f;
   TestActivationOp<float>("Elu",
@@ -5,11 +5,114 @@
 #include "test/providers/provider_test_utils.h"
 
 #include <algorithm>
+#include <cmath>
 #include <random>
 using namespace ONNX_NAMESPACE;
 namespace onnxruntime {
 namespace test {
 
+namespace {
+
+// Reference implementation of the Philox-4x32-10 stream used by the CPU random
+// kernels, kept independently here so regressions in the kernel's generator are
+// caught.
+void ReferencePhiloxBlock(uint64_t seed, uint64_t counter, uint32_t out[4]) {
+  uint32_t x0 = static_cast<uint32_t>(counter);
+  uint32_t x1 = static_cast<uint32_t>(counter >> 32);
+  uint32_t x2 = 0;
+  uint32_t x3 = 0;
+  uint32_t k0 = static_cast<uint32_t>(seed);
+  uint32_t k1 = static_cast<uint32_t>(seed >> 32);
+  for (int round = 0; round < 10; ++round) {
+    const uint64_t product0 = 0xD2511F53ULL * x0;
+    const uint64_t product1 = 0xCD9E8D57ULL * x2;
+    const uint32_t y0 = static_cast<uint32_t>(product1 >> 32) ^ x1 ^ k0;
+    const uint32_t y1 = static_cast<uint32_t>(product1);
+    const uint32_t y2 = static_cast<uint32_t>(product0 >> 32) ^ x3 ^ k1;
+    const uint32_t y3 = static_cast<uint32_t>(product0);
+    x0 = y0;
+    x1 = y1;
+    x2 = y2;
+    x3 = y3;
+    k0 += 0x9E3779B9;
+    k1 += 0xBB67AE85;
+  }
+  out[0] = x0;
+  out[1] = x1;
+  out[2] = x2;
+  out[3] = x3;
+}
+
+constexpr double kTwoPi = 6.283185307179586476925286766559;
+
+std::vector<float> ReferenceUniformFloat(uint64_t seed, size_t count, float low, float high) {
+  std::vector<float> values(count);
+  uint32_t bits[4];
+  for (size_t block = 0; block * 4 < count; ++block) {
+    ReferencePhiloxBlock(seed, block, bits);
+    for (size_t lane = 0; lane < 4 && block * 4 + lane < count; ++lane) {
+      values[block * 4 + lane] =
+          low + (high - low) * (static_cast<float>(bits[lane] >> 8) * (1.0f / 16777216.0f));
+    }
+  }
+  return values;
+}
+
+std::vector<double> ReferenceUniformDouble(uint64_t seed, size_t count, double low, double high) {
+  std::vector<double> values(count);
+  uint32_t bits[4];
+  for (size_t block = 0; block * 2 < count; ++block) {
+    ReferencePhiloxBlock(seed, block, bits);
+    for (size_t lane = 0; lane < 2 && block * 2 + lane < count; ++lane) {
+      const uint64_t value_bits = (static_cast<uint64_t>(bits[2 * lane]) << 32) | bits[2 * lane + 1];
+      values[block * 2 + lane] =
+          low + (high - low) * (static_cast<double>(value_bits >> 11) * (1.0 / 9007199254740992.0));
+    }
+  }
+  return values;
+}
+
+std::vector<float> ReferenceNormalFloat(uint64_t seed, size_t count, float mean, float scale) {
+  std::vector<float> values(count);
+  uint32_t bits[4];
+  for (size_t block = 0; block * 4 < count; ++block) {
+    ReferencePhiloxBlock(seed, block, bits);
+    const size_t lanes = std::min<size_t>(4, count - block * 4);
+    for (size_t lane = 0; lane < lanes; lane += 2) {
+      const float u1 = (static_cast<float>(bits[lane] >> 8) + 1.0f) * (1.0f / 16777216.0f);
+      const float u2 = static_cast<float>(bits[lane + 1] >> 8) * (1.0f / 16777216.0f);
+      const float radius = std::sqrt(-2.0f * std::log(u1));
+      const float theta = static_cast<float>(kTwoPi) * u2;
+      values[block * 4 + lane] = mean + scale * radius * std::cos(theta);
+      if (lane + 1 < lanes) {
+        values[block * 4 + lane + 1] = mean + scale * radius * std::sin(theta);
+      }
+    }
+  }
+  return values;
+}
+
+std::vector<double> ReferenceNormalDouble(uint64_t seed, size_t count, double mean, double scale) {
+  std::vector<double> values(count);
+  uint32_t bits[4];
+  for (size_t block = 0; block * 2 < count; ++block) {
+    ReferencePhiloxBlock(seed, block, bits);
+    const uint64_t u1_bits = (static_cast<uint64_t>(bits[0]) << 32) | bits[1];
+    const uint64_t u2_bits = (static_cast<uint64_t>(bits[2]) << 32) | bits[3];
+    const double u1 = (static_cast<double>(u1_bits >> 11) + 1.0) * (1.0 / 9007199254740992.0);
+    const double u2 = static_cast<double>(u2_bits >> 11) * (1.0 / 9007199254740992.0);
+    const double radius = std::sqrt(-2.0 * std::log(u1));
+    const double theta = kTwoPi * u2;
+    values[block * 2] = mean + scale * radius * std::cos(theta);
+    if (block * 2 + 1 < count) {
+      values[block * 2 + 1] = mean + scale * radius * std::sin(theta);
+    }
+  }
+  return values;
+}
+
+}  // namespace
+
 TEST(Random, RandomNormal2DDouble) {
   OpTester test("RandomNormal");
 
@@ -25,12 +128,8 @@ TEST(Random, RandomNormal2DDouble) {
   test.AddAttribute<int64_t>("dtype", TensorProto::DOUBLE);
   test.AddAttribute("shape", dims);
 
-  std::default_random_engine generator{gsl::narrow_cast<uint32_t>(seed)};
-  std::normal_distribution<double> distribution{mean, scale};
-
-  std::vector<double> expected_output(TensorShape(dims).Size());
-  std::for_each(expected_output.begin(), expected_output.end(),
-                [&generator, &distribution](double& value) { value = distribution(generator); });
+  std::vector<double> expected_output =
+      ReferenceNormalDouble(gsl::narrow_cast<uint32_t>(seed), TensorShape(dims).Size(), mean, scale);
 
   test.AddOutput<double>("Y", dims, expected_output);
   test.Run();
@@ -59,12 +158,8 @@ void RunRandomNormalLike3DFloat(bool infer_dtype = false) {
                         0.f, 0.f, 0.f,
                         0.f, 0.f, 0.f});
 
-  std::default_random_engine generator{gsl::narrow_cast<uint32_t>(seed)};
-  std::normal_distribution<float> distribution{mean, scale};
-
-  std::vector<float> expected_output(TensorShape(dims).Size());
-  std::for_each(expected_output.begin(), expected_output.end(),
-                [&generator, &distribution](float& value) { value = distribution(generator); });
+  std::vector<float> expected_output =
+      ReferenceNormalFloat(gsl::narrow_cast<uint32_t>(seed), TensorShape(dims).Size(), mean, scale);
 
   test.AddOutput<float>("Y", dims, expected_output);
 
@@ -95,12 +190,8 @@ TEST(Random, RandomUniform1DFloat) {
   test.AddAttribute<int64_t>("dtype", TensorProto::FLOAT);
   test.AddAttribute("shape", dims);
 
-  std::default_random_engine generator{gsl::narrow_cast<uint32_t>(seed)};
-  std::uniform_real_distribution<float> distribution{low, high};
-
-  std::vector<float> expected_output(TensorShape(dims).Size());
-  std::for_each(expected_output.begin(), expected_output.end(),
-                [&generator, &distribution](float& value) { value = distribution(generator); });
+  std::vector<float> expected_output =
+      ReferenceUniformFloat(gsl::narrow_cast<uint32_t>(seed), TensorShape(dims).Size(), low, high);
 
   test.AddOutput<float>("Y", dims, expected_output);
 
@@ -128,12 +219,8 @@ void RunRandomUniformLikeTest(bool infer_dtype = false) {
                         {0., 0., 0., 0., 0., 0.,
                          0., 0., 0., 0., 0., 0.});
 
-  std::default_random_engine generator{gsl::narrow_cast<uint32_t>(seed)};
-  std::uniform_real_distribution<double> distribution{low, high};
-
-  std::vector<double> expected_output(TensorShape(dims).Size());
-  std::for_each(expected_output.begin(), expected_output.end(),
-                [&generator, &distribution](double& value) { value = distribution(generator); });
+  std::vector<double> expected_output =
+      ReferenceUniformDouble(gsl::narrow_cast<uint32_t>(seed), TensorShape(dims).Size(), low, high);
 
   test.AddOutput<double>("Y", dims, expected_output);
 
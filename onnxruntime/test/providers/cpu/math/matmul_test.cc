@@ -3,6 +3,7 @@
 
 #include "gtest/gtest.h"
 #include "test/providers/provider_test_utils.h"
+#include "core/util/math.h"
 
 namespace onnxruntime {
 namespace test {
@@ -129,6 +130,24 @@ TEST(MathOpTest, MatMulDoubleType) {
   RunMatMulTest<double>(7);
 }
 
+TEST(MathOpTest, MatMulFloat16Type) {
+  // Use small integer values so the expected results are exactly
+  // representable in half precision regardless of the accumulation order.
+  auto make_fp16 = [](const std::vector<float>& values) {
+    std::vector<MLFloat16> output;
+    for (float value : values) {
+      output.push_back(MLFloat16(math::floatToHalf(value)));
+    }
+    return output;
+  };
+
+  OpTester test("MatMul", 13);
+  test.AddInput<MLFloat16>("A", {2, 4}, make_fp16({1, 2, 3, 4, 5, 6, 7, 8}));
+  test.AddInput<MLFloat16>("B", {4, 3}, make_fp16({1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12}));
+  test.AddOutput<MLFloat16>("Y", {2, 3}, make_fp16({70, 80, 90, 158, 184, 210}));
+  test.Run(OpTester::ExpectResult::kExpectSuccess, "", {kTensorrtExecutionProvider, kOpenVINOExecutionProvider});
+}
+
 TEST(MathOpTest, MatMulInt32Type) {
   RunMatMulTest<int32_t>(9);
 }
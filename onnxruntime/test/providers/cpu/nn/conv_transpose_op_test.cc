@@ -27,7 +27,8 @@ void TestConvTransposeOp(const ConvTransposeOpAttributes& attributes,
                          const vector<int64_t>& expected_output_shape,
                          OpTester::ExpectResult expect_result = OpTester::ExpectResult::kExpectSuccess,
                          const std::string& err_str = "",
-                         const std::unordered_set<std::string>& excluded_provider_types = {kTensorrtExecutionProvider}) {
+                         const std::unordered_set<std::string>& excluded_provider_types = {kTensorrtExecutionProvider},
+                         bool weight_is_initializer = false) {
   OpTester test("ConvTranspose");
   test.AddAttribute("kernel_shape", attributes.kernel_shape);
   test.AddAttribute("group", attributes.group);
@@ -57,7 +58,7 @@ void TestConvTransposeOp(const ConvTransposeOpAttributes& attributes,
   ORT_ENFORCE(inputs.size() <= 3, "Our name array is only setup to handle 3 inputs");
   const char* szNames[] = {"X", "W", "B"};
   for (size_t i = 0; i < inputs.size(); i++) {
-    test.AddInput<float>(szNames[i], input_shapes[i], inputs[i]);
+    test.AddInput<float>(szNames[i], input_shapes[i], inputs[i], weight_is_initializer && i == 1);
   }
   test.AddOutput<float>("Y", expected_output_shape, expected_output);
 
@@ -113,6 +114,12 @@ TEST(ConvTransposeTest, ConvTranspose_2D) {
                         0.06256775f, -0.17838378f, -0.18863615f, 0.20064656f, 0.133717f, -0.06876295f,
                         -0.06398046f, -0.00864975f, 0.19289537f, -0.01490572f, -0.13673618f, 0.01949645f};
   TestConvTransposeOp(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape);
+
+  // Run the same case with the weight as an initializer to exercise the prepacked
+  // (transposed) filter path.
+  TestConvTransposeOp(attrs, {X, W}, {X_shape, W_shape}, expected_vals, Y_shape,
+                      OpTester::ExpectResult::kExpectSuccess, "",
+                      {kTensorrtExecutionProvider}, true /*weight_is_initializer*/);
 }
 
 TEST(ConvTransposeTest, ConvTranspose_2D_Bias_1) {
@@ -151,5 +151,29 @@ TEST(TensorOpTest, TileUint64Type) {
 TEST(TensorOpTest, TileBoolType) {
   RunTestWrapper<bool>();
 }
+
+TEST(TensorOpTest, TileMemcpyLargeRepeats) {
+  // Repeat count large enough to push the MemCpy optimization path onto the
+  // thread pool with doubling block replication in each shard
+  constexpr int64_t block_size = 64;
+  constexpr int64_t num_repeats = 256;
+
+  std::vector<float> input(block_size);
+  for (int64_t i = 0; i < block_size; ++i) {
+    input[i] = static_cast<float>(i);
+  }
+
+  std::vector<float> output;
+  output.reserve(block_size * num_repeats);
+  for (int64_t i = 0; i < num_repeats; ++i) {
+    output.insert(output.end(), input.begin(), input.end());
+  }
+
+  OpTester test("Tile");
+  test.AddInput<float>("input", {1, block_size}, input);
+  test.AddInput<int64_t>("repeats", {2}, {num_repeats, 1});
+  test.AddOutput<float>("output", {num_repeats, block_size}, output);
+  test.Run();
+}
 }  // namespace test
 }  // namespace onnxruntime
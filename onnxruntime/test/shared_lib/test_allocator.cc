@@ -29,3 +29,38 @@ TEST(CApiTest, DefaultAllocator) {
   Ort::ThrowOnError(Ort::GetApi().CompareMemoryInfo(info1, info2, &result));
   ASSERT_EQ(0, result);
 }
+
+TEST(CApiTest, ValuePoolRecyclesWrappers) {
+  const auto& api = Ort::GetApi();
+  OrtValuePool* pool = nullptr;
+  Ort::ThrowOnError(api.CreateValuePool(&pool));
+
+  OrtMemoryInfo* info = nullptr;
+  Ort::ThrowOnError(api.CreateCpuMemoryInfo(OrtDeviceAllocator, OrtMemTypeDefault, &info));
+
+  float data[4] = {1.f, 2.f, 3.f, 4.f};
+  const int64_t shape[] = {2, 2};
+
+  OrtValue* value = nullptr;
+  Ort::ThrowOnError(api.CreateTensorWithDataAsPooledOrtValue(pool, info, data, sizeof(data), shape, 2,
+                                                             ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &value));
+  void* raw = nullptr;
+  Ort::ThrowOnError(api.GetTensorMutableData(value, &raw));
+  ASSERT_EQ(raw, data);
+
+  OrtValue* first = value;
+  Ort::ThrowOnError(api.ReleaseValueToPool(pool, value));
+
+  float other[2] = {5.f, 6.f};
+  const int64_t other_shape[] = {2};
+  Ort::ThrowOnError(api.CreateTensorWithDataAsPooledOrtValue(pool, info, other, sizeof(other), other_shape, 1,
+                                                             ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT, &value));
+  // the wrapper handed back above must be re-used, not a fresh allocation
+  ASSERT_EQ(value, first);
+  Ort::ThrowOnError(api.GetTensorMutableData(value, &raw));
+  ASSERT_EQ(raw, other);
+
+  api.ReleaseValue(value);
+  api.ReleaseMemoryInfo(info);
+  api.ReleaseValuePool(pool);
+}
@@ -16,26 +16,84 @@ static bool IsNcclAvailable() {
 #endif
 }
 
+// Returns the static byte size of the tensor described by the argdef, or -1 when the
+// shape is not fully known.
+static int64_t GetStaticTensorSizeInBytes(const ArgDef& argdef, int32_t elem_type) {
+  if (argdef.type_proto == nullptr ||
+      !argdef.type_proto->has_tensor_type() ||
+      !argdef.type_proto->tensor_type().has_shape()) {
+    return -1;
+  }
+
+  int64_t num_elements = 1;
+  for (const auto& dim : argdef.type_proto->tensor_type().shape().dim()) {
+    if (!dim.has_dim_value()) {
+      return -1;
+    }
+    num_elements *= dim.dim_value();
+  }
+
+  const int64_t element_size =
+      (elem_type == ONNX_NAMESPACE::TensorProto_DataType_FLOAT16 ||
+       elem_type == ONNX_NAMESPACE::TensorProto_DataType_BFLOAT16)
+          ? 2
+          : 4;
+  return num_elements * element_size;
+}
+
 static Status AddNcclAllReduceForGradients(
     std::vector<ArgDef>& gradient_argdefs,
     std::vector<ArgDef>& input_gradient_argdef,
-    GraphAugmenter::GraphDefs& graph_defs) {
+    GraphAugmenter::GraphDefs& graph_defs,
+    int64_t allreduce_bucket_size) {
+  const int32_t allreduce_elem_type = input_gradient_argdef[0].type_proto->tensor_type().elem_type();
+
   std::vector<ArgDef> allreduce_outputs(gradient_argdefs.size());
   for (size_t i = 0; i < gradient_argdefs.size(); i++) {
     TypeProto* allreduced_gradient_type_proto = graph_defs.CopyTypeProto(gradient_argdefs[i]);
-    allreduced_gradient_type_proto->mutable_tensor_type()->set_elem_type(
-        input_gradient_argdef[0].type_proto->tensor_type().elem_type());
+    allreduced_gradient_type_proto->mutable_tensor_type()->set_elem_type(allreduce_elem_type);
 
     allreduce_outputs[i] = ArgDef(gradient_argdefs[i].name + "_AllReduce_Out", allreduced_gradient_type_proto);
   }
 
-  // Add NCCL Allreduce node.
-  graph_defs.AddNodeDefs({NodeDef(OpDef{"NcclAllReduce", kMSDomain, 1},
-                                  input_gradient_argdef,
-                                  allreduce_outputs,
-                                  {ONNX_NAMESPACE::MakeAttribute("group_type",
-                                                                 static_cast<int64_t>(WorkerGroupType::DataParallel))},
-                                  "NcclAllReduce")});
+  // Partition the gradients into size-capped buckets. Each bucket gets its own
+  // collective whose only inputs are that bucket's gradients, so it becomes runnable
+  // as soon as those gradients are final and its communication overlaps with the
+  // backward computation still producing the remaining buckets. A non-positive
+  // bucket size, or any gradient without a static shape, keeps the single fused
+  // allreduce.
+  std::vector<size_t> bucket_begins{0};
+  if (allreduce_bucket_size > 0) {
+    int64_t bucket_bytes = 0;
+    for (size_t i = 0; i < input_gradient_argdef.size(); i++) {
+      const int64_t tensor_bytes = GetStaticTensorSizeInBytes(input_gradient_argdef[i], allreduce_elem_type);
+      if (tensor_bytes < 0) {
+        bucket_begins.resize(1);
+        break;
+      }
+      if (bucket_bytes >= allreduce_bucket_size && i > 0) {
+        bucket_begins.push_back(i);
+        bucket_bytes = 0;
+      }
+      bucket_bytes += tensor_bytes;
+    }
+  }
+
+  // Add one NCCL Allreduce node per bucket.
+  for (size_t bucket = 0; bucket < bucket_begins.size(); bucket++) {
+    const size_t begin = bucket_begins[bucket];
+    const size_t end = bucket + 1 < bucket_begins.size() ? bucket_begins[bucket + 1] : input_gradient_argdef.size();
+    const std::string node_name =
+        bucket_begins.size() == 1 ? "NcclAllReduce" : "NcclAllReduce_bucket_" + std::to_string(bucket);
+    graph_defs.AddNodeDefs({NodeDef(OpDef{"NcclAllReduce", kMSDomain, 1},
+                                    std::vector<ArgDef>(input_gradient_argdef.begin() + begin,
+                                                        input_gradient_argdef.begin() + end),
+                                    std::vector<ArgDef>(allreduce_outputs.begin() + begin,
+                                                        allreduce_outputs.begin() + end),
+                                    {ONNX_NAMESPACE::MakeAttribute("group_type",
+                                                                   static_cast<int64_t>(WorkerGroupType::DataParallel))},
+                                    node_name)});
+  }
 
   gradient_argdefs = allreduce_outputs;
   return Status::OK();
@@ -83,7 +141,8 @@ Status AllreduceOptimizerGraphBuilder::BuildInternal(
   ORT_RETURN_IF_ERROR(AddGradientScalingNodes(nodearg_name_generator, scale, gradient_argdefs, output_gradient_argdef, graph_defs,
                                               opt_graph_config_.AllReduceDataType()));
 
-  ORT_RETURN_IF_ERROR(AddNcclAllReduceForGradients(gradient_argdefs, output_gradient_argdef, graph_defs));
+  ORT_RETURN_IF_ERROR(AddNcclAllReduceForGradients(gradient_argdefs, output_gradient_argdef, graph_defs,
+                                                   opt_graph_config_.allreduce_bucket_size));
 
   // check if all gradients are finite
   ArgDef global_grad_norm_argdef;
@@ -66,6 +66,11 @@ struct OptimizerGraphConfig {
   MixedPrecisionDataType mixed_precision_type{MixedPrecisionDataType::FP16};
   bool allreduce_in_mixed_precision_type{false};
   bool use_nccl{false};
+  // Byte threshold for splitting the gradient allreduce into buckets. Each bucket
+  // becomes its own collective, so communication for a finished bucket can overlap
+  // with the backward computation of the remaining ones. A non-positive value keeps
+  // the single fused allreduce.
+  int64_t allreduce_bucket_size{0};
   ZeROConfig deepspeed_zero{0};
   int gradient_accumulation_steps{1};
   std::string loss_scale_input_name{};  // empty string means no loss scaling factor is applied
@@ -11,6 +11,7 @@
 #include "core/common/common.h"
 #include "core/framework/tensorprotoutils.h"
 #include "core/graph/graph.h"
+#include "core/graph/graph_utils.h"
 #include "core/graph/model.h"
 #include "orttraining/core/graph/gradient_builder_base.h"
 #include "orttraining/core/graph/graph_augmenter.h"
@@ -66,6 +67,104 @@ ArgDef BuildGradientAccumulationNode(const NodeArgNameGeneratorFn& nodearg_name_
   return gradient_accumulator_output;
 }
 
+// Returns true when both shapes are fully described and dimension-wise identical,
+// comparing symbolic dimensions by parameter name.
+static bool AreShapesIdentical(const TypeProto* lhs, const TypeProto* rhs) {
+  if (lhs == nullptr || rhs == nullptr ||
+      !lhs->has_tensor_type() || !lhs->tensor_type().has_shape() ||
+      !rhs->has_tensor_type() || !rhs->tensor_type().has_shape()) {
+    return false;
+  }
+  const auto& lhs_shape = lhs->tensor_type().shape();
+  const auto& rhs_shape = rhs->tensor_type().shape();
+  if (lhs_shape.dim_size() != rhs_shape.dim_size()) {
+    return false;
+  }
+  for (int i = 0; i < lhs_shape.dim_size(); ++i) {
+    const auto& lhs_dim = lhs_shape.dim(i);
+    const auto& rhs_dim = rhs_shape.dim(i);
+    if (lhs_dim.has_dim_value() && rhs_dim.has_dim_value()) {
+      if (lhs_dim.dim_value() != rhs_dim.dim_value()) return false;
+    } else if (lhs_dim.has_dim_param() && rhs_dim.has_dim_param()) {
+      if (lhs_dim.dim_param() != rhs_dim.dim_param()) return false;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+// When the gradient is produced by a "Sum" node that only combines multiple gradient
+// contributions, the Sum can be folded into the accumulation: every contribution is
+// then added straight into the persistent accumulation buffer and the combined
+// gradient tensor is never materialized. Returns the Sum's inputs when that folding
+// is valid, or an empty vector to fall back to the plain accumulator node.
+static std::vector<ArgDef> GetFusableGradientSumInputs(const Graph& graph, const ArgDef& gradient) {
+  const Node* producer = graph.GetProducerNode(gradient.name);
+  if (producer == nullptr || producer->OpType() != "Sum" || !producer->Domain().empty() ||
+      producer->InputDefs().size() < 2) {
+    return {};
+  }
+
+  // the summed gradient must have no other readers and must not be a graph output
+  if (!graph.GetConsumerNodes(gradient.name).empty() ||
+      !graph.GetNodeOutputsInGraphOutputs(*producer).empty()) {
+    return {};
+  }
+
+  // Sum supports broadcasting but the accumulator does not: every contribution
+  // must carry the full gradient shape
+  std::vector<ArgDef> sum_inputs;
+  for (const NodeArg* input_def : producer->InputDefs()) {
+    if (!AreShapesIdentical(input_def->TypeAsProto(), gradient.type_proto)) {
+      return {};
+    }
+    sum_inputs.emplace_back(input_def->Name(), input_def->TypeAsProto());
+  }
+  return sum_inputs;
+}
+
+// Accumulates each gradient contribution of a folded Sum node into the persistent
+// accumulation buffer with a chain of InPlaceAccumulator nodes. The alias between
+// every accumulator's buffer input and output keeps the whole chain in the one
+// buffer, so each contribution is consumed by an in-place += as it is produced.
+ArgDef BuildInPlaceSumAccumulationNodes(const NodeArgNameGeneratorFn& nodearg_name_generator,
+                                        const ArgDef& gradient,
+                                        const std::vector<ArgDef>& gradient_contributions,
+                                        ArgDef& gradient_accumulation_buffer,
+                                        GraphAugmenter::GraphDefs& graph_defs) {
+  TypeProto* gradient_fp32_type_proto = graph_defs.CopyTypeProto(gradient);
+  gradient_fp32_type_proto->mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+
+  ArgDef gradient_accumulate_buffer(nodearg_name_generator(gradient.name + "_accumulate_buffer"),
+                                    gradient_fp32_type_proto);
+
+  std::vector<int64_t> dims;
+  ORT_ENFORCE(gradient.type_proto &&
+              gradient.type_proto->has_tensor_type() &&
+              gradient.type_proto->tensor_type().has_shape());
+  for (const auto& dim : gradient.type_proto->tensor_type().shape().dim()) {
+    dims.push_back(dim.dim_value());
+  }
+  graph_defs.AddInitializers({CreateTensorProto<float>(gradient_accumulate_buffer.name, 0.f, dims)});
+
+  ArgDef accumulator_input = gradient_accumulate_buffer;
+  ArgDef accumulator_output;
+  for (size_t i = 0; i < gradient_contributions.size(); ++i) {
+    accumulator_output = ArgDef(nodearg_name_generator(gradient.name + "_accumulator_output_" + std::to_string(i)),
+                                gradient_fp32_type_proto);
+    graph_defs.AddNodeDefs({NodeDef(OpDef{"InPlaceAccumulator", kMSDomain, 1},
+                                    {accumulator_input, gradient_contributions[i]},
+                                    {accumulator_output},
+                                    NodeAttributes(),
+                                    accumulator_output.name)});
+    accumulator_input = accumulator_output;
+  }
+
+  gradient_accumulation_buffer = gradient_accumulate_buffer;
+  return accumulator_output;
+}
+
 ArgDef BuildGroupNode(const std::string& group_output_name,
                       const std::vector<ArgDef>& input_argdefs,
                       GraphAugmenter::GraphDefs& graph_defs) {
@@ -192,13 +291,23 @@ Status OptimizerGraphBuilder::AddGradientScalingNodes(
 }
 
 ArgDef AddGradientAccumulationNodes(const NodeArgNameGeneratorFn& nodearg_name_generator,
+                                    Graph& graph,
                                     std::vector<ArgDef>& gradient_argdefs,               // update argdefs in place
                                     std::vector<ArgDef>& gradient_accumulation_buffers,  // output
                                     GraphAugmenter::GraphDefs& graph_defs) {
   gradient_accumulation_buffers.resize(gradient_argdefs.size());
   for (size_t i = 0; i < gradient_argdefs.size(); ++i) {
-    gradient_argdefs[i] = BuildGradientAccumulationNode(
-        nodearg_name_generator, gradient_argdefs[i], gradient_accumulation_buffers[i], graph_defs);
+    const std::vector<ArgDef> sum_inputs = GetFusableGradientSumInputs(graph, gradient_argdefs[i]);
+    if (!sum_inputs.empty()) {
+      Node* sum_node = graph.GetMutableProducerNode(gradient_argdefs[i].name);
+      graph_utils::RemoveNodeOutputEdges(graph, *sum_node);
+      graph.RemoveNode(sum_node->Index());
+      gradient_argdefs[i] = BuildInPlaceSumAccumulationNodes(
+          nodearg_name_generator, gradient_argdefs[i], sum_inputs, gradient_accumulation_buffers[i], graph_defs);
+    } else {
+      gradient_argdefs[i] = BuildGradientAccumulationNode(
+          nodearg_name_generator, gradient_argdefs[i], gradient_accumulation_buffers[i], graph_defs);
+    }
   }
 
   ArgDef group_accumulate_gradient_output = BuildGroupNode(nodearg_name_generator("Group_Accumulated_Gradients"),
@@ -437,7 +546,7 @@ Status OptimizerGraphBuilder::Build(
   std::vector<ArgDef> gradient_accumulation_buffers;
   if (is_gradient_accumulation_enabled) {
     ArgDef group_accumulate_gradient_output =
-        AddGradientAccumulationNodes(nodearg_name_generator, gradient_argdefs, gradient_accumulation_buffers, graph_defs);
+        AddGradientAccumulationNodes(nodearg_name_generator, graph, gradient_argdefs, gradient_accumulation_buffers, graph_defs);
     optimizer_graph_outputs[OptimizerOutputKey::GradientAccumulation] = group_accumulate_gradient_output.name;
   }
 
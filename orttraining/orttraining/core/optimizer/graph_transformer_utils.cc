@@ -102,6 +102,12 @@ std::vector<std::unique_ptr<GraphTransformer>> GeneratePreTrainingTransformers(
       if (config.gelu_recompute) {
         transformers.emplace_back(onnxruntime::make_unique<GeluRecompute>());
       }
+      if (config.layernorm_recompute) {
+        transformers.emplace_back(onnxruntime::make_unique<LayerNormRecompute>());
+      }
+      if (config.attn_softmax_recompute) {
+        transformers.emplace_back(onnxruntime::make_unique<AttentionSoftmaxRecompute>());
+      }
       if (config.attn_dropout_recompute) {
         transformers.emplace_back(onnxruntime::make_unique<AttentionDropoutRecompute>());
       }
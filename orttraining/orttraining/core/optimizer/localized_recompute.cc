@@ -57,6 +57,103 @@ Status GeluRecompute::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*
   return Status::OK();
 }
 
+bool LayerNormRecompute::SatisfyCondition(const Node& node) const {
+  static const std::unordered_set<std::string> target_optypes = {"LayerNormalization", "SimplifiedLayerNormalization"};
+  if (target_optypes.find(node.OpType()) == target_optypes.end()) {
+    return false;
+  }
+
+  const auto next_node = node.OutputNodesBegin();
+  if (next_node != node.OutputNodesEnd() && next_node->OpType() == "MatMul") {
+    return true;
+  }
+  return false;
+}
+
+Status LayerNormRecompute::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*/, const logging::Logger& /*logger*/) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_ids = graph_viewer.GetNodesInTopologicalOrder();
+
+  // Traverse backward from the bottom of the graph, so that the recompute nodes
+  // for lower layers are executed earlier
+  for (int i = static_cast<int>(node_ids.size() - 1); i >= 0; --i) {
+    Node& node = *graph.GetNode(node_ids[i]);
+
+    if (!SatisfyCondition(node)) {
+      continue;
+    }
+
+    // Only the normalized output is recomputed; the saved mean and inverse
+    // standard deviation outputs stay with the original node for the gradient.
+    const auto& output = node.OutputDefs()[0];
+
+    auto& recomputed_output = graph.GetOrCreateNodeArg(graph_utils::RecomputeName(output->Name()),
+                                                       output->TypeAsProto());
+
+    Node& recompute_node = graph.AddNode(node.Name() + "_recompute",
+                                         node.OpType(),
+                                         "Recompute of " + node.Name(),
+                                         node.MutableInputDefs(),
+                                         {&recomputed_output},
+                                         &node.GetAttributes(),
+                                         node.Domain());
+
+    recompute_node.SetPriority(static_cast<int>(ExecutionPriority::LOCAL_LOW));
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
+bool AttentionSoftmaxRecompute::SatisfyCondition(const Node& node) const {
+  if (node.OpType() != "Softmax")
+    return false;
+
+  // The attention probabilities feed the MatMul with the value tensor. When
+  // dropout is enabled the Softmax output goes through Dropout first, which is
+  // handled by AttentionDropoutRecompute instead.
+  const auto next_node = node.OutputNodesBegin();
+  if (next_node != node.OutputNodesEnd() && next_node->OpType() == "MatMul") {
+    return true;
+  }
+  return false;
+}
+
+Status AttentionSoftmaxRecompute::ApplyImpl(Graph& graph, bool& modified, int /*graph_level*/, const logging::Logger& /*logger*/) const {
+  GraphViewer graph_viewer(graph);
+  const auto& node_ids = graph_viewer.GetNodesInTopologicalOrder();
+
+  // Traverse backward from the bottom of the graph, so that the recompute nodes
+  // for lower layers are executed earlier
+  for (int i = static_cast<int>(node_ids.size() - 1); i >= 0; --i) {
+    Node& node = *graph.GetNode(node_ids[i]);
+
+    if (!SatisfyCondition(node)) {
+      continue;
+    }
+
+    const auto& output = node.OutputDefs()[0];
+
+    auto& recomputed_output = graph.GetOrCreateNodeArg(graph_utils::RecomputeName(output->Name()),
+                                                       output->TypeAsProto());
+
+    Node& recompute_node = graph.AddNode(node.Name() + "_recompute",
+                                         node.OpType(),
+                                         "Recompute of " + node.Name(),
+                                         node.MutableInputDefs(),
+                                         {&recomputed_output},
+                                         &node.GetAttributes(),
+                                         node.Domain());
+
+    recompute_node.SetPriority(static_cast<int>(ExecutionPriority::LOCAL_LOW));
+
+    modified = true;
+  }
+
+  return Status::OK();
+}
+
 bool AttentionDropoutRecompute::SatisfyCondition(const Node& node) const {
   if (node.OpType() != "Dropout")
     return false;
@@ -25,6 +25,42 @@ class GeluRecompute : public GraphTransformer {
   bool SatisfyCondition(const Node& node) const;
 };
 
+/**
+@Class LayerNormRecompute
+
+Recompute LayerNormalization/SimplifiedLayerNormalization output
+
+*/
+class LayerNormRecompute : public GraphTransformer {
+ public:
+  LayerNormRecompute() noexcept : GraphTransformer("LayerNormRecompute") {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  bool ShouldOnlyApplyOnce() const override { return true; }
+
+ private:
+  bool SatisfyCondition(const Node& node) const;
+};
+
+/**
+@Class AttentionSoftmaxRecompute
+
+Recompute Softmax in the attention layer when dropout is disabled
+
+*/
+class AttentionSoftmaxRecompute : public GraphTransformer {
+ public:
+  AttentionSoftmaxRecompute() noexcept : GraphTransformer("AttentionSoftmaxRecompute") {}
+
+  Status ApplyImpl(Graph& graph, bool& modified, int graph_level, const logging::Logger& logger) const override;
+
+  bool ShouldOnlyApplyOnce() const override { return true; }
+
+ private:
+  bool SatisfyCondition(const Node& node) const;
+};
+
 /**
 @Class AttentionDropoutRecompute
 
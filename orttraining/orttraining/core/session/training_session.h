@@ -179,6 +179,9 @@ class TrainingSession : public InferenceSession {
       bool do_all_reduce_in_mixed_precision_type{};
       // Whether to use NCCL.
       bool use_nccl{};
+      // Byte threshold for bucketing the gradient allreduce so collectives can
+      // overlap with backward computation. 0 keeps a single fused collective.
+      int64_t allreduce_bucket_size{0};
       // Whether to partition the optimizer state.
       ZeROConfig deepspeed_zero{};
       // Selects the reduction algorithm for Adasum.
@@ -248,6 +251,10 @@ class TrainingSession : public InferenceSession {
       bool attn_dropout_recompute{false};
       // Enable recompute of Gelu activation output to save memory
       bool gelu_recompute{false};
+      // Enable recompute of LayerNormalization output to save memory
+      bool layernorm_recompute{false};
+      // Enable recompute of attention softmax output to save memory
+      bool attn_softmax_recompute{false};
       // Enable recompute of transformer layer ouput to save memory
       bool transformer_layer_recompute{false};
       // Number of layers to apply recompute
@@ -188,6 +188,10 @@ class TrainingRunner {
     bool attn_dropout_recompute = false;
     // Enable checkpointing of Gelu activation output to save memory
     bool gelu_recompute = false;
+    // Enable checkpointing of LayerNormalization output to save memory
+    bool layernorm_recompute = false;
+    // Enable checkpointing of attention softmax output to save memory
+    bool attn_softmax_recompute = false;
     // Enable checkpointing of transformer layer output to save memory
     bool transformer_layer_recompute = false;
     // Number of layers to apply recompute
@@ -60,6 +60,8 @@ struct TrainingParameters {
   // recompute
   bool attn_dropout_recompute = false;
   bool gelu_recompute = false;
+  bool layernorm_recompute = false;
+  bool attn_softmax_recompute = false;
   bool transformer_layer_recompute = false;
   int number_recompute_layers = 0;
   bool enable_adasum = false;
@@ -224,6 +226,8 @@ TrainingConfigurationResult ConfigureSessionForTraining(
 
   config.graph_transformer_config.attn_dropout_recompute = parameters.attn_dropout_recompute;
   config.graph_transformer_config.gelu_recompute = parameters.gelu_recompute;
+  config.graph_transformer_config.layernorm_recompute = parameters.layernorm_recompute;
+  config.graph_transformer_config.attn_softmax_recompute = parameters.attn_softmax_recompute;
   config.graph_transformer_config.transformer_layer_recompute = parameters.transformer_layer_recompute;
   config.graph_transformer_config.number_recompute_layers = parameters.number_recompute_layers;
 
@@ -319,6 +323,8 @@ void addObjectMethodsForTraining(py::module& m) {
       .def_readwrite("use_invertible_layernorm_grad", &TrainingParameters::use_invertible_layernorm_grad)
       .def_readwrite("attn_dropout_recompute", &TrainingParameters::attn_dropout_recompute)
       .def_readwrite("gelu_recompute", &TrainingParameters::gelu_recompute)
+      .def_readwrite("layernorm_recompute", &TrainingParameters::layernorm_recompute)
+      .def_readwrite("attn_softmax_recompute", &TrainingParameters::attn_softmax_recompute)
       .def_readwrite("transformer_layer_recompute", &TrainingParameters::transformer_layer_recompute)
       .def_readwrite("number_recompute_layers", &TrainingParameters::number_recompute_layers)
       .def_readwrite("data_parallel_size", &TrainingParameters::data_parallel_size)
@@ -636,6 +636,8 @@ class ORTTrainer(object):
 
         ort_parameters.attn_dropout_recompute = self.options.graph_transformer.attn_dropout_recompute
         ort_parameters.gelu_recompute = self.options.graph_transformer.gelu_recompute
+        ort_parameters.layernorm_recompute = self.options.graph_transformer.layernorm_recompute
+        ort_parameters.attn_softmax_recompute = self.options.graph_transformer.attn_softmax_recompute
         ort_parameters.transformer_layer_recompute = self.options.graph_transformer.transformer_layer_recompute
         ort_parameters.number_recompute_layers = self.options.graph_transformer.number_recompute_layers
 
@@ -661,6 +663,8 @@ class ORTTrainer(object):
         session_options.use_deterministic_compute = self.options.debug.deterministic_compute
         if (self.options.graph_transformer.attn_dropout_recompute or
             self.options.graph_transformer.gelu_recompute or
+            self.options.graph_transformer.layernorm_recompute or
+            self.options.graph_transformer.attn_softmax_recompute or
             self.options.graph_transformer.transformer_layer_recompute):
             session_options.execution_order = ort.ExecutionOrder.PRIORITY_BASED
         if len(self.options.debug.graph_save_paths.model_with_training_graph_after_optimization_path) > 0:
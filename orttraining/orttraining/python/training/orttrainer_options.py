@@ -180,6 +180,14 @@ class ORTTrainerOptions(object):
                             'type': 'boolean',
                             'default': False
                         },
+                        'layernorm_recompute': {
+                            'type': 'boolean',
+                            'default': False
+                        },
+                        'attn_softmax_recompute': {
+                            'type': 'boolean',
+                            'default': False
+                        },
                         'transformer_layer_recompute': {
                             'type': 'boolean',
                             'default': False
@@ -337,6 +345,10 @@ class ORTTrainerOptions(object):
             enable recomputing attention dropout to save memory
         gelu_recompute (bool, default is False):
             enable recomputing Gelu activation output to save memory
+        layernorm_recompute (bool, default is False):
+            enable recomputing LayerNormalization output to save memory
+        attn_softmax_recompute (bool, default is False):
+            enable recomputing attention softmax output to save memory
         transformer_layer_recompute (bool, default is False):
             enable recomputing transformer layerwise to save memory
         number_recompute_layers (int, default is 0)
@@ -634,6 +646,14 @@ _ORTTRAINER_OPTIONS_SCHEMA = {
                 'type': 'boolean',
                 'default': False
             },
+            'layernorm_recompute': {
+                'type': 'boolean',
+                'default': False
+            },
+            'attn_softmax_recompute': {
+                'type': 'boolean',
+                'default': False
+            },
             'transformer_layer_recompute': {
                 'type': 'boolean',
                 'default': False
@@ -320,6 +320,62 @@ TEST_F(OptimizerGraphBuilderTest, Default_WithGradientAccumulation_WithMixedPrec
   TestDefaultOptimizerGraphBuilder(config, graph_);
 }
 
+TEST_F(OptimizerGraphBuilderTest, Default_WithGradientAccumulation_FusesGradientSum) {
+  // rebuild weight_1's gradient as a Sum of two contributions so the builder can fold
+  // the Sum into a chain of in-place accumulators on the accumulation buffer
+  ONNX_NAMESPACE::TypeProto float_tensor_type{};
+  float_tensor_type.mutable_tensor_type()->set_elem_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+  float_tensor_type.mutable_tensor_type()->mutable_shape()->add_dim()->set_dim_value(1);
+
+  const std::string gradient_name = GradientBuilderBase::GradientName(k_weight_names[0]);
+  graph_.RemoveInitializedTensor(gradient_name);
+
+  std::unordered_set<std::string> names_to_preserve{};
+  for (const auto& weight_name : k_weight_names) {
+    names_to_preserve.emplace(weight_name);
+    names_to_preserve.emplace(GradientBuilderBase::GradientName(weight_name));
+  }
+
+  std::vector<NodeArg*> sum_inputs;
+  for (int i = 0; i < 2; ++i) {
+    const std::string contribution_name = gradient_name + "_" + std::to_string(i);
+    ONNX_NAMESPACE::TensorProto contribution_initializer{};
+    contribution_initializer.set_name(contribution_name);
+    contribution_initializer.add_dims(1);
+    contribution_initializer.set_data_type(ONNX_NAMESPACE::TensorProto_DataType_FLOAT);
+    contribution_initializer.add_float_data(1.0f);
+    graph_.AddInitializedTensor(contribution_initializer);
+    sum_inputs.push_back(&graph_.GetOrCreateNodeArg(contribution_name, &float_tensor_type));
+    names_to_preserve.emplace(contribution_name);
+  }
+  graph_.AddNode("gradient_sum", "Sum", "sum of gradient contributions", sum_inputs,
+                 {&graph_.GetOrCreateNodeArg(gradient_name, &float_tensor_type)});
+
+  Graph::ResolveOptions resolve_options{};
+  resolve_options.initializer_names_to_preserve = &names_to_preserve;
+  ASSERT_STATUS_OK(graph_.Resolve(resolve_options));
+
+  OptimizerGraphConfig config;
+  config.gradient_accumulation_steps = 10;
+
+  std::unordered_map<std::string, std::string> updated_weight_names_map;
+  std::unordered_map<std::string, training::TrainingSession::PartitionInfo> weight_partition_info;
+  OptimizerGraphBuilder optimizer_graph_builder(
+      GetOptimizerBuilderRegistry(), config, GetOptInfoMap(), updated_weight_names_map, weight_partition_info);
+
+  OptimizerOutputKeyMap<std::string> opt_graph_outputs;
+  std::unordered_map<std::string, std::unordered_map<std::string, std::string>> weight_to_opt_mapping;
+  ASSERT_STATUS_OK(optimizer_graph_builder.Build(graph_, weight_to_opt_mapping, opt_graph_outputs));
+
+  auto op_counts = CountOpsInGraph(graph_, false);
+
+  // the Sum is folded away: weight_1 gets one accumulator per contribution while
+  // weight_2 keeps its single accumulator
+  ASSERT_EQ(GetOpCount(op_counts, "Sum"), 0);
+  ASSERT_EQ(GetOpCount(op_counts, k_inplace_accumulator_op_name), 3);
+  ASSERT_EQ(GetOpCount(op_counts, k_zero_gradient_op_name), 2);
+}
+
 #if defined(ORT_USE_NCCL)
 static void TestAllreduceOptimizerGraphBuilder(OptimizerGraphConfig config, Graph& graph) {
   std::unordered_map<std::string, std::string> updated_weight_names_map;
@@ -477,6 +533,29 @@ TEST_F(OptimizerGraphBuilderTest, Allreduce_WithGradientAccumulation_WithMixedPr
   TestAllreduceOptimizerGraphBuilder(config, graph_);
 }
 
+TEST_F(OptimizerGraphBuilderTest, Allreduce_Bucketed) {
+  OptimizerGraphConfig config;
+  config.data_parallel_group_size = 4;
+  config.use_nccl = true;
+  config.gradient_accumulation_steps = 1;
+  config.use_mixed_precision = false;
+  // each gradient is a single float, so a 4 byte bucket yields one collective per weight
+  config.allreduce_bucket_size = 4;
+
+  std::unordered_map<std::string, std::string> updated_weight_names_map;
+  std::unordered_map<std::string, training::TrainingSession::PartitionInfo> weight_partition_info;
+  AllreduceOptimizerGraphBuilder optimizer_graph_builder(
+      GetOptimizerBuilderRegistry(), config, GetOptInfoMap(), updated_weight_names_map, weight_partition_info);
+
+  OptimizerOutputKeyMap<std::string> opt_graph_outputs;
+  std::unordered_map<std::string, std::unordered_map<std::string, std::string>> weight_to_opt_mapping;
+  ASSERT_STATUS_OK(optimizer_graph_builder.Build(graph_, weight_to_opt_mapping, opt_graph_outputs));
+
+  auto op_counts = CountOpsInGraph(graph_, false);
+  ASSERT_EQ(GetOpCount(op_counts, k_all_reduce_op_name), k_weight_names.size());
+  ASSERT_EQ(GetOpCount(op_counts, k_adam_optimizer_op_name), k_weight_names.size());
+}
+
 static void TestZeROOptimizerGraphBuilder(OptimizerGraphConfig config, Graph& graph) {
   std::unordered_map<std::string, std::string> updated_weight_names_map;
   std::unordered_map<std::string, training::TrainingSession::PartitionInfo> weight_partition_info;
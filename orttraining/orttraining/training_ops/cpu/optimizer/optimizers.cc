@@ -4,6 +4,7 @@
 #include "orttraining/training_ops/cpu/optimizer/optimizers.h"
 
 #include "core/framework/op_kernel.h"
+#include "core/platform/threadpool.h"
 #include "core/providers/common.h"
 #include "core/providers/cpu/math/element_wise_ops.h"
 
@@ -61,17 +62,25 @@ Status AdamOptimizer<T>::Compute(OpKernelContext* ctx) const {
   const float eta = *ETA.template Data<float>();
   const int64_t step = *S.template Data<int64_t>();
 
-  // Update exponentially-averaged historical gradient
-  MakeEigenArrayMap<T>(NM1) = alpha_ * MakeEigenArrayMap<T>(M1) + ((1 - alpha_) * MakeEigenArrayMap<T>(G));
-
-  // Update exponentially-averaged historical squared gradient
-  MakeEigenArrayMap<T>(NM2) = beta_ * MakeEigenArrayMap<T>(M2) + ((1 - beta_) * MakeEigenArrayMap<T>(G) * MakeEigenArrayMap<T>(G));
-
   const float alpha_correction = do_bias_correction_ ?
     compute_bias_correction_coefficient(alpha_, step) : 1.f;
   const float beta_correction = do_bias_correction_ ?
     compute_bias_correction_coefficient(beta_, step) : 1.f;
 
+  if (weight_decay_mode_ != 0 && weight_decay_mode_ != 1) {
+    // Shouldn't reach here
+    ORT_THROW("Unsupported Adamw optimizer mode.");
+  }
+
+  const T* w_data = W.template Data<T>();
+  const T* g_data = G.template Data<T>();
+  const T* m1_data = M1.template Data<T>();
+  const T* m2_data = M2.template Data<T>();
+  T* nm1_data = NM1.template MutableData<T>();
+  T* nm2_data = NM2.template MutableData<T>();
+  T* nw_data = NW != nullptr ? NW->template MutableData<T>() : nullptr;
+  T* ng_data = NG != nullptr ? NG->template MutableData<T>() : nullptr;
+
   // Currently two modes of Adamw are supported:
   // Mode 0: Pytorch https://pytorch.org/docs/stable/_modules/torch/optim/adamw.html#AdamW,
   //         bias correction is applied on m and v individually,
@@ -79,44 +88,46 @@ Status AdamOptimizer<T>::Compute(OpKernelContext* ctx) const {
   // Mode 1: Huggingface https://huggingface.co/transformers/_modules/transformers/optimization.html#AdamW.,
   //         bias correction is applied on learning rate,
   //         weight decay is applied after weight is updated.
-  if(weight_decay_mode_ == 0) {
-    // Compute weight update.
-    const auto& denom = (MakeEigenArrayMap<T>(NM2) / beta_correction).sqrt() + epsilon_;
-    const auto& update = ( (MakeEigenArrayMap<T>(NM1) / alpha_correction) / denom) + (lambda_ * MakeEigenArrayMap<T>(W));
-    const auto& delta = -eta * update;
-
-    // Weight, gradient, and step update.
-    if (NG != nullptr) {
-      MakeEigenArrayMap<T>(*NG) = delta;
-    }
-    if (NW != nullptr) {
-      MakeEigenArrayMap<T>(*NW) = MakeEigenArrayMap<T>(W) + delta;
+  //
+  // The moment and weight updates are fused into a single pass over the tensor,
+  // chunked across the threadpool.
+  auto update_chunk = [&](std::ptrdiff_t first, std::ptrdiff_t last) {
+    for (std::ptrdiff_t i = first; i < last; ++i) {
+      // Update exponentially-averaged historical gradient and squared gradient.
+      const T m1o = alpha_ * m1_data[i] + (1 - alpha_) * g_data[i];
+      const T m2o = beta_ * m2_data[i] + (1 - beta_) * g_data[i] * g_data[i];
+
+      T delta;
+      if (weight_decay_mode_ == 0) {
+        const T denom = std::sqrt(m2o / beta_correction) + epsilon_;
+        delta = -eta * ((m1o / alpha_correction) / denom + lambda_ * w_data[i]);
+      } else {
+        const T denom = std::sqrt(m2o) + epsilon_;
+        const T step_size = eta * std::sqrt(beta_correction) / alpha_correction;
+
+        // Huggingface updates weights in the following logic:
+        // param' = param - step_size * m1o / denom
+        // param_out = param' - original_lr * lambda * param'
+        // then param_out = param - step_size * m1o / denom - original_lr * lambda * (param - step_size * m1o / denom)
+        // so delta = -step_size * m1o / denom - original_lr * lambda * (param - step_size * m1o / denom)
+        delta = -step_size * m1o / denom - eta * lambda_ * (w_data[i] - step_size * m1o / denom);
+      }
+
+      nm1_data[i] = m1o;
+      nm2_data[i] = m2o;
+      if (ng_data != nullptr) {
+        ng_data[i] = delta;
+      }
+      if (nw_data != nullptr) {
+        nw_data[i] = w_data[i] + delta;
+      }
     }
-  }
-  else if (weight_decay_mode_ == 1) {
-    const auto& denom = MakeEigenArrayMap<T>(NM2).sqrt() + epsilon_;
-    const auto& step_size = eta * std::sqrt(beta_correction) / alpha_correction;
-
-    // Huggingface updates weights in the following logic:
-    // param' = param - step_size * m1o / denom
-    // param_out = param' - original_lr * lambda * param'
-    // then param_out = param - step_size * m1o / denom - original_lr * lambda * (param - step_size * m1o / denom)
-    // so delta = -step_size * m1o / denom - original_lr * lambda * (param - step_size * m1o / denom)
-    const auto& delta = -step_size * MakeEigenArrayMap<T>(NM1) / denom
-                        - eta * lambda_ * (MakeEigenArrayMap<T>(W) - step_size * MakeEigenArrayMap<T>(NM1) / denom);
-
-    // Weight, gradient, and step update.
-    if (NG != nullptr) {
-      MakeEigenArrayMap<T>(*NG) = delta;
-    }
-    if (NW != nullptr) {
-      MakeEigenArrayMap<T>(*NW) = MakeEigenArrayMap<T>(W) + delta;
-    }
-  }
-  else {
-    // Shouldn't reach here
-    ORT_THROW("Unsupported Adamw optimizer mode.");
-  }
+  };
+
+  concurrency::ThreadPool::TryParallelFor(ctx->GetOperatorThreadPool(),
+                                          static_cast<std::ptrdiff_t>(W.Shape().Size()),
+                                          {sizeof(T) * 4.0, sizeof(T) * 4.0, 16.0},
+                                          update_chunk);
 
   *NS.template MutableData<int64_t>() = step + 1;
   return Status::OK();
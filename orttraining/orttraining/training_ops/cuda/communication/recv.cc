@@ -21,8 +21,7 @@ void Recv::ReceiveData(
     const int num_tensors,
     std::vector<Tensor*> received_tensors,
     const int src,
-    const size_t aggregated_aligned_tensor_bytes,
-    IAllocatorUniquePtr<char>& buffer) const {
+    const size_t aggregated_aligned_tensor_bytes) const {
 #ifdef ENABLE_NVTX_PROFILE
   auto& profile_context = profile::Context::GetInstance();
   const auto tag = profile_context.GetThreadTagOrDefault(std::this_thread::get_id());
@@ -38,12 +37,29 @@ void Recv::ReceiveData(
 #endif
 
 #if defined(ORT_USE_NCCL) && defined(USE_NCCL_P2P)
-  buffer = GetScratchBuffer<char>(aggregated_aligned_tensor_bytes);
+  IAllocatorUniquePtr<char> buffer = GetScratchBuffer<char>(aggregated_aligned_tensor_bytes);
+  char* buffer_data = buffer.get();
 #else
-  buffer = AllocateBufferOnCPUPinned<char>(static_cast<size_t>(aggregated_aligned_tensor_bytes));
+  // Pick the staging buffer not used by the previous call and wait until the
+  // host-to-device copies that read it last time have drained, so the blocking
+  // MPI receive below can overlap with the copies of the previous micro-batch.
+  std::lock_guard<OrtMutex> lock(mutex_);
+  const size_t staging_index = staging_buffer_index_;
+  staging_buffer_index_ ^= 1;
+  if (staging_events_[staging_index] != nullptr) {
+    CUDA_CALL(cudaEventSynchronize(staging_events_[staging_index]));
+  } else {
+    CUDA_CALL(cudaEventCreateWithFlags(&staging_events_[staging_index], cudaEventDisableTiming));
+  }
+  if (staging_buffer_bytes_[staging_index] < aggregated_aligned_tensor_bytes) {
+    staging_buffers_[staging_index] = AllocateBufferOnCPUPinned<char>(
+        static_cast<size_t>(aggregated_aligned_tensor_bytes));
+    staging_buffer_bytes_[staging_index] = aggregated_aligned_tensor_bytes;
+  }
+  char* buffer_data = staging_buffers_[staging_index].get();
 #endif
 
-  CommInfo_t info_data{buffer.get(),
+  CommInfo_t info_data{buffer_data,
                        static_cast<int>(aggregated_aligned_tensor_bytes),
                        src,
                        static_cast<int>(tag_)};
@@ -56,7 +72,7 @@ void Recv::ReceiveData(
 #endif
   auto& nccl_service = cuda::NcclService::GetInstance();
   nccl_service.SubmitRecvAndWait(info_data.buffer, info_data.size, info_data.rank);
-#elif defined(use_mpi)
+#elif defined(USE_MPI)
   MPI_CHECK(MPI_Recv(
       info_data.buffer, info_data.size, MPI_CHAR,
       info_data.rank, info_data.tag, MPI_COMM_WORLD, MPI_STATUS_IGNORE));
@@ -89,10 +105,10 @@ void Recv::ReceiveData(
     assert(tensor_offset_in_bytes + tensor->SizeInBytes() <= aggregated_aligned_tensor_bytes);
     // Copy data out from buffer.
 #if defined(ORT_USE_NCCL) && defined(USE_NCCL_P2P)
-    CUDA_CALL(cudaMemcpyAsync(tensor->MutableDataRaw(), buffer.get() + tensor_offset_in_bytes,
+    CUDA_CALL(cudaMemcpyAsync(tensor->MutableDataRaw(), buffer_data + tensor_offset_in_bytes,
                          tensor->SizeInBytes(), cudaMemcpyDeviceToDevice, Stream()));
 #else
-    CUDA_CALL(cudaMemcpyAsync(tensor->MutableDataRaw(), buffer.get() + tensor_offset_in_bytes,
+    CUDA_CALL(cudaMemcpyAsync(tensor->MutableDataRaw(), buffer_data + tensor_offset_in_bytes,
                          tensor->SizeInBytes(), cudaMemcpyHostToDevice, Stream()));
 #endif
 
@@ -107,7 +123,9 @@ void Recv::ReceiveData(
 
 #if defined(ORT_USE_NCCL) && defined(USE_NCCL_P2P)
 #else
-  AddDeferredReleaseCPUPtr(buffer.release());
+  // Mark when the copies out of this staging buffer complete; the buffer is
+  // reused once this event is reached.
+  CUDA_CALL(cudaEventRecord(staging_events_[staging_index], Stream()));
 #endif
 
 #ifdef ENABLE_NVTX_PROFILE
@@ -247,9 +265,7 @@ Status Recv::ComputeInternal(OpKernelContext* ctx) const {
 
   // At this stage, all shape information (either inferred locally or received from the source process)
   // required to receive tensors are ready.
-  // Create buffer and receive data.
-  IAllocatorUniquePtr<char> buffer;
-  ReceiveData(num_tensors, received_tensors, src, aggregated_aligned_tensor_bytes, buffer);
+  ReceiveData(num_tensors, received_tensors, src, aggregated_aligned_tensor_bytes);
 
 #ifdef ENABLE_NVTX_PROFILE
   profile::NvtxRangeCreator postRange(
@@ -271,6 +287,14 @@ Status Recv::ComputeInternal(OpKernelContext* ctx) const {
   return Status::OK();
 }
 
+Recv::~Recv() {
+  for (auto& event : staging_events_) {
+    if (event != nullptr) {
+      cudaEventDestroy(event);
+    }
+  }
+}
+
 }  // namespace cuda
 }  // namespace onnxruntime
 
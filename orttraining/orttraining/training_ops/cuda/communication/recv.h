@@ -5,6 +5,7 @@
 
 #pragma once
 #include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/cuda/cuda_kernel.h"
 
 namespace onnxruntime {
@@ -19,15 +20,28 @@ public:
 
   Status ComputeInternal(OpKernelContext* context) const override;
 
+  ~Recv();
+
 private:
   void ReceiveData(
     const int num_tensors,
     std::vector<Tensor*> received_tensors,
     const int src,
-    const size_t aggregated_aligned_tensor_bytes,
-    IAllocatorUniquePtr<char>& buffer) const;
+    const size_t aggregated_aligned_tensor_bytes) const;
   int64_t tag_;
   std::vector<int64_t> element_types_;
+
+  // Double-buffered pinned staging for the MPI path. Two buffers alternate so
+  // the blocking MPI receive of one micro-batch can fill one buffer while the
+  // asynchronous host-to-device copies of the previous micro-batch still drain
+  // the other. staging_events_[i] is recorded after the copies out of
+  // staging_buffers_[i] are enqueued, and waited on before that buffer is
+  // refilled. Guarded by mutex_ against concurrent session runs.
+  mutable OrtMutex mutex_;
+  mutable IAllocatorUniquePtr<char> staging_buffers_[2];
+  mutable size_t staging_buffer_bytes_[2] = {0, 0};
+  mutable cudaEvent_t staging_events_[2] = {nullptr, nullptr};
+  mutable size_t staging_buffer_index_ = 0;
 };
 
 }  // namespace cuda
@@ -54,9 +54,17 @@ void Send::SendData(
 
 #if defined(ORT_USE_NCCL) && defined(USE_NCCL_P2P)
   IAllocatorUniquePtr<char> buffer = GetScratchBuffer<char>(aggregated_aligned_tensor_bytes);
+  char* buffer_data = buffer.get();
 #else
-  IAllocatorUniquePtr<char> buffer = AllocateBufferOnCPUPinned<char>(
-      aggregated_aligned_tensor_bytes);
+  // Reuse the pinned staging buffer across calls. It is free again by the end
+  // of this function because the blocking MPI send below completes before
+  // returning.
+  std::lock_guard<OrtMutex> lock(mutex_);
+  if (staging_buffer_bytes_ < aggregated_aligned_tensor_bytes) {
+    staging_buffer_ = AllocateBufferOnCPUPinned<char>(aggregated_aligned_tensor_bytes);
+    staging_buffer_bytes_ = aggregated_aligned_tensor_bytes;
+  }
+  char* buffer_data = staging_buffer_.get();
 #endif
 
   for (int i = 0; i < num_tensors; ++i) {
@@ -66,14 +74,20 @@ void Send::SendData(
 #endif
 
 #if defined(ORT_USE_NCCL) && defined(USE_NCCL_P2P)
-    CUDA_CALL(cudaMemcpyAsync(buffer.get() + tensor_offsets_in_bytes[i], tensor->DataRaw(),
+    CUDA_CALL(cudaMemcpyAsync(buffer_data + tensor_offsets_in_bytes[i], tensor->DataRaw(),
                          tensor_sizes_in_bytes[i], cudaMemcpyDeviceToDevice, Stream()));
 #else
-    CUDA_CALL(cudaMemcpyAsync(buffer.get() + tensor_offsets_in_bytes[i], tensor->DataRaw(),
+    CUDA_CALL(cudaMemcpyAsync(buffer_data + tensor_offsets_in_bytes[i], tensor->DataRaw(),
                          tensor_sizes_in_bytes[i], cudaMemcpyDeviceToHost, Stream()));
 #endif
   }
 
+#if !(defined(ORT_USE_NCCL) && defined(USE_NCCL_P2P))
+  // The device-to-host copies must have landed in the pinned buffer before the
+  // host-side MPI send reads it.
+  CUDA_CALL(cudaStreamSynchronize(Stream()));
+#endif
+
 #ifdef ENABLE_NVTX_PROFILE
   memcpyRange.End();
 #endif
@@ -89,7 +103,7 @@ void Send::SendData(
   sendRange.Begin();
 #endif
 
-  CommInfo_t info_data{buffer.get(),
+  CommInfo_t info_data{buffer_data,
                        static_cast<int>(aggregated_aligned_tensor_bytes),
                        dst,
                        static_cast<int>(tag_)};
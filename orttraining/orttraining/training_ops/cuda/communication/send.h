@@ -5,6 +5,7 @@
 
 #pragma once
 #include "core/common/common.h"
+#include "core/platform/ort_mutex.h"
 #include "core/providers/cuda/cuda_kernel.h"
 
 namespace onnxruntime {
@@ -30,6 +31,14 @@ private:
 
   int64_t tag_;
   std::vector<int64_t> element_types_;
+
+  // Pinned staging buffer for the MPI path, reused across calls. The send path
+  // synchronizes the stream before the blocking MPI send, so the buffer is free
+  // again when SendData returns. Guarded by mutex_ against concurrent session
+  // runs.
+  mutable OrtMutex mutex_;
+  mutable IAllocatorUniquePtr<char> staging_buffer_;
+  mutable size_t staging_buffer_bytes_ = 0;
 };
 
 }  // namespace cuda
@@ -0,0 +1,283 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <algorithm>
+
+#include "onnx-ml.pb.h"
+
+#include "batcher.h"
+#include "executor.h"
+#include "request_id.h"
+
+namespace onnxruntime {
+namespace server {
+
+namespace protobufutil = google::protobuf::util;
+
+RequestBatcher::RequestBatcher(ServerEnvironment* env, Options options) : env_(env), options_(options) {}
+
+RequestBatcher::~RequestBatcher() {
+  std::lock_guard<std::mutex> queues_guard(queues_mutex_);
+  for (auto& entry : queues_) {
+    ModelQueue& queue = *entry.second;
+    {
+      std::lock_guard<std::mutex> guard(queue.mutex);
+      queue.shutting_down = true;
+    }
+    queue.cv.notify_all();
+    queue.worker.join();
+  }
+}
+
+protobufutil::Status RequestBatcher::Predict(const std::string& model_name,
+                                             const std::string& model_version,
+                                             const std::string& request_id,
+                                             const PredictRequest& request,
+                                             PredictResponse& response) {
+  if (options_.max_batch_size <= 1) {
+    Executor executor(env_, request_id);
+    return executor.Predict(model_name, model_version, request, response);
+  }
+
+  ModelQueue& queue = GetOrCreateQueue(model_name, model_version);
+  PendingRequest pending{&request, &response, request_id, {}, std::chrono::steady_clock::now()};
+  auto done = pending.done.get_future();
+  {
+    std::lock_guard<std::mutex> guard(queue.mutex);
+    if (queue.shutting_down) {
+      return protobufutil::Status(protobufutil::error::Code::UNAVAILABLE, "Server is shutting down");
+    }
+    queue.pending.push_back(&pending);
+    ++queue.requests_received;
+    queue.max_queue_depth_seen = std::max(queue.max_queue_depth_seen,
+                                          static_cast<uint64_t>(queue.pending.size()));
+  }
+  queue.cv.notify_one();
+  return done.get();
+}
+
+std::vector<RequestBatcher::ModelStats> RequestBatcher::GetStats() const {
+  std::vector<ModelStats> stats;
+  std::lock_guard<std::mutex> queues_guard(queues_mutex_);
+  stats.reserve(queues_.size());
+  for (const auto& entry : queues_) {
+    ModelQueue& queue = *entry.second;
+    std::lock_guard<std::mutex> guard(queue.mutex);
+    ModelStats model_stats;
+    model_stats.model_name = entry.first.first;
+    model_stats.model_version = entry.first.second;
+    model_stats.requests_received = queue.requests_received;
+    model_stats.batches_run = queue.batches_run;
+    model_stats.batched_requests = queue.batched_requests;
+    model_stats.individual_runs = queue.individual_runs;
+    model_stats.max_batch_size_seen = queue.max_batch_size_seen;
+    model_stats.max_queue_depth_seen = queue.max_queue_depth_seen;
+    model_stats.current_queue_depth = queue.pending.size();
+    model_stats.queue_wait_ms_total = queue.queue_wait_ms_total;
+    stats.push_back(std::move(model_stats));
+  }
+  return stats;
+}
+
+RequestBatcher::ModelQueue& RequestBatcher::GetOrCreateQueue(const std::string& model_name,
+                                                             const std::string& model_version) {
+  std::lock_guard<std::mutex> queues_guard(queues_mutex_);
+  auto key = std::make_pair(model_name, model_version);
+  auto iter = queues_.find(key);
+  if (iter == queues_.end()) {
+    iter = queues_.emplace(key, std::unique_ptr<ModelQueue>(new ModelQueue())).first;
+    ModelQueue& queue = *iter->second;
+    queue.worker = std::thread(&RequestBatcher::WorkerLoop, this, model_name, model_version, std::ref(queue));
+  }
+  return *iter->second;
+}
+
+void RequestBatcher::WorkerLoop(const std::string& model_name, const std::string& model_version,
+                                ModelQueue& queue) {
+  auto logger = env_->GetAppLogger();
+  std::unique_lock<std::mutex> lock(queue.mutex);
+  for (;;) {
+    queue.cv.wait(lock, [&queue] { return queue.shutting_down || !queue.pending.empty(); });
+    if (queue.shutting_down) {
+      break;
+    }
+
+    // Give the batch a chance to fill up, but never hold the first request
+    // past the latency budget.
+    auto deadline = std::chrono::steady_clock::now() + options_.max_wait;
+    while (queue.pending.size() < options_.max_batch_size && !queue.shutting_down) {
+      if (queue.cv.wait_until(lock, deadline) == std::cv_status::timeout) {
+        break;
+      }
+    }
+
+    std::vector<PendingRequest*> batch;
+    while (!queue.pending.empty() && batch.size() < options_.max_batch_size) {
+      batch.push_back(queue.pending.front());
+      queue.pending.pop_front();
+    }
+    queue.max_batch_size_seen = std::max(queue.max_batch_size_seen, static_cast<uint64_t>(batch.size()));
+    auto run_start = std::chrono::steady_clock::now();
+    for (const auto* pending : batch) {
+      queue.queue_wait_ms_total +=
+          std::chrono::duration<double, std::milli>(run_start - pending->enqueue_time).count();
+    }
+    lock.unlock();
+
+    bool merged = false;
+    if (batch.size() > 1) {
+      merged = RunMerged(model_name, model_version, batch);
+      logger->debug("Batcher ran {} request(s) for model {} version {} ({})", batch.size(),
+                    model_name, model_version, merged ? "merged" : "individually");
+    }
+    if (!merged) {
+      RunIndividually(model_name, model_version, batch);
+    }
+
+    lock.lock();
+    if (merged) {
+      ++queue.batches_run;
+      queue.batched_requests += batch.size();
+    } else {
+      queue.individual_runs += batch.size();
+    }
+  }
+
+  // Fail whatever is still queued so no caller blocks forever.
+  for (auto* pending : queue.pending) {
+    pending->done.set_value(
+        protobufutil::Status(protobufutil::error::Code::UNAVAILABLE, "Server is shutting down"));
+  }
+  queue.pending.clear();
+}
+
+bool RequestBatcher::RunMerged(const std::string& model_name, const std::string& model_version,
+                               const std::vector<PendingRequest*>& batch) {
+  const PredictRequest& first = *batch[0]->request;
+  if (first.inputs_size() == 0) {
+    return false;
+  }
+
+  // Every request must ask for the same outputs and carry the same input set.
+  for (size_t i = 1; i < batch.size(); ++i) {
+    const PredictRequest& other = *batch[i]->request;
+    if (other.inputs_size() != first.inputs_size() ||
+        other.output_filter_size() != first.output_filter_size()) {
+      return false;
+    }
+    for (int j = 0; j < first.output_filter_size(); ++j) {
+      if (other.output_filter(j) != first.output_filter(j)) {
+        return false;
+      }
+    }
+  }
+
+  // Rows each request contributes along the batch axis. Every input of a
+  // request must agree on it so the outputs can be scattered back.
+  std::vector<int64_t> rows(batch.size(), -1);
+  for (const auto& entry : first.inputs()) {
+    for (size_t i = 0; i < batch.size(); ++i) {
+      auto iter = batch[i]->request->inputs().find(entry.first);
+      if (iter == batch[i]->request->inputs().end()) {
+        return false;
+      }
+      const onnx::TensorProto& tensor = iter->second;
+      if (!tensor.has_raw_data() ||
+          tensor.data_location() == onnx::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL ||
+          tensor.data_type() != entry.second.data_type() ||
+          tensor.dims_size() != entry.second.dims_size() ||
+          tensor.dims_size() < 1 || tensor.dims(0) < 1) {
+        return false;
+      }
+      for (int d = 1; d < tensor.dims_size(); ++d) {
+        if (tensor.dims(d) != entry.second.dims(d)) {
+          return false;
+        }
+      }
+      if (rows[i] < 0) {
+        rows[i] = tensor.dims(0);
+      } else if (rows[i] != tensor.dims(0)) {
+        return false;
+      }
+    }
+  }
+  int64_t total_rows = 0;
+  for (auto r : rows) {
+    total_rows += r;
+  }
+
+  PredictRequest merged_request;
+  for (const auto& entry : first.inputs()) {
+    onnx::TensorProto& merged_tensor = (*merged_request.mutable_inputs())[entry.first];
+    merged_tensor.set_data_type(entry.second.data_type());
+    merged_tensor.add_dims(total_rows);
+    for (int d = 1; d < entry.second.dims_size(); ++d) {
+      merged_tensor.add_dims(entry.second.dims(d));
+    }
+    std::string* merged_raw = merged_tensor.mutable_raw_data();
+    size_t total_bytes = 0;
+    for (const auto* pending : batch) {
+      total_bytes += pending->request->inputs().at(entry.first).raw_data().size();
+    }
+    merged_raw->reserve(total_bytes);
+    for (const auto* pending : batch) {
+      merged_raw->append(pending->request->inputs().at(entry.first).raw_data());
+    }
+  }
+  for (const auto& name : first.output_filter()) {
+    merged_request.add_output_filter(name);
+  }
+
+  Executor executor(env_, util::InternalRequestId());
+  PredictResponse merged_response;
+  auto status = executor.Predict(model_name, model_version, merged_request, merged_response);
+  if (!status.ok()) {
+    // Rerun individually so each caller gets a status for its own request
+    // rather than one poisoned by a neighbour in the batch.
+    return false;
+  }
+
+  // The outputs can only be scattered when the model batches along dim 0.
+  for (const auto& entry : merged_response.outputs()) {
+    const onnx::TensorProto& tensor = entry.second;
+    if (!tensor.has_raw_data() || tensor.dims_size() < 1 || tensor.dims(0) != total_rows ||
+        tensor.raw_data().size() % static_cast<size_t>(total_rows) != 0) {
+      return false;
+    }
+  }
+
+  for (const auto& entry : merged_response.outputs()) {
+    const onnx::TensorProto& tensor = entry.second;
+    const std::string& raw = tensor.raw_data();
+    size_t bytes_per_row = raw.size() / static_cast<size_t>(total_rows);
+    size_t offset = 0;
+    for (size_t i = 0; i < batch.size(); ++i) {
+      onnx::TensorProto& out = (*batch[i]->response->mutable_outputs())[entry.first];
+      out.set_data_type(tensor.data_type());
+      out.add_dims(rows[i]);
+      for (int d = 1; d < tensor.dims_size(); ++d) {
+        out.add_dims(tensor.dims(d));
+      }
+      size_t byte_count = static_cast<size_t>(rows[i]) * bytes_per_row;
+      out.set_raw_data(raw.data() + offset, byte_count);
+      offset += byte_count;
+    }
+  }
+
+  for (auto* pending : batch) {
+    pending->done.set_value(protobufutil::Status::OK);
+  }
+  return true;
+}
+
+void RequestBatcher::RunIndividually(const std::string& model_name, const std::string& model_version,
+                                     const std::vector<PendingRequest*>& batch) {
+  for (auto* pending : batch) {
+    Executor executor(env_, pending->request_id);
+    auto status = executor.Predict(model_name, model_version, *pending->request, *pending->response);
+    pending->done.set_value(status);
+  }
+}
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,118 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <google/protobuf/stubs/status.h>
+#include <boost/functional/hash.hpp>
+
+#include "environment.h"
+#include "predict.pb.h"
+
+namespace onnxruntime {
+namespace server {
+
+// Coalesces concurrent Predict calls for the same model into a single batched
+// session run along the batch axis (dim 0). The first request in a queue waits
+// up to max_wait for company; the batch is closed as soon as max_batch_size
+// requests are queued. Requests that cannot be merged (mismatched input names,
+// element types, non-batch dims or output filters, or inputs without raw_data)
+// fall back to individual runs.
+class RequestBatcher {
+ public:
+  struct Options {
+    // Largest number of requests merged into one run. Values <= 1 make
+    // Predict() run every request individually.
+    size_t max_batch_size = 8;
+    // How long the first request in a queue waits for others to join its
+    // batch before the batch is closed and run.
+    std::chrono::milliseconds max_wait{2};
+  };
+
+  // Snapshot of the queue depth and batch size counters for one model.
+  struct ModelStats {
+    std::string model_name;
+    std::string model_version;
+    uint64_t requests_received = 0;
+    uint64_t batches_run = 0;       // runs that merged more than one request
+    uint64_t batched_requests = 0;  // requests executed as part of such runs
+    uint64_t individual_runs = 0;   // single-request runs, including merge fallbacks
+    uint64_t max_batch_size_seen = 0;
+    uint64_t max_queue_depth_seen = 0;
+    uint64_t current_queue_depth = 0;
+    double queue_wait_ms_total = 0;  // time requests spent queued before their run started
+  };
+
+  RequestBatcher(ServerEnvironment* env, Options options);
+  ~RequestBatcher();
+  RequestBatcher(const RequestBatcher&) = delete;
+  RequestBatcher& operator=(const RequestBatcher&) = delete;
+
+  // Queues the request and blocks until it has been run, possibly merged with
+  // other concurrent requests for the same model. Mirrors Executor::Predict.
+  google::protobuf::util::Status Predict(const std::string& model_name,
+                                         const std::string& model_version,
+                                         const std::string& request_id,
+                                         const PredictRequest& request,
+                                         /* out */ PredictResponse& response);
+
+  std::vector<ModelStats> GetStats() const;
+
+ private:
+  struct PendingRequest {
+    const PredictRequest* request;
+    PredictResponse* response;
+    std::string request_id;
+    std::promise<google::protobuf::util::Status> done;
+    std::chrono::steady_clock::time_point enqueue_time;
+  };
+
+  struct ModelQueue {
+    std::mutex mutex;
+    std::condition_variable cv;
+    std::deque<PendingRequest*> pending;
+    bool shutting_down = false;
+    std::thread worker;
+    // counters below are guarded by mutex
+    uint64_t requests_received = 0;
+    uint64_t batches_run = 0;
+    uint64_t batched_requests = 0;
+    uint64_t individual_runs = 0;
+    uint64_t max_batch_size_seen = 0;
+    uint64_t max_queue_depth_seen = 0;
+    double queue_wait_ms_total = 0;
+  };
+
+  ModelQueue& GetOrCreateQueue(const std::string& model_name, const std::string& model_version);
+  void WorkerLoop(const std::string& model_name, const std::string& model_version, ModelQueue& queue);
+  // Runs the batch as one merged request and scatters the outputs back.
+  // Returns false without completing any request when the batch cannot be
+  // merged or the batched run did not succeed; the caller falls back to
+  // individual runs.
+  bool RunMerged(const std::string& model_name, const std::string& model_version,
+                 const std::vector<PendingRequest*>& batch);
+  void RunIndividually(const std::string& model_name, const std::string& model_version,
+                       const std::vector<PendingRequest*>& batch);
+
+  ServerEnvironment* env_;
+  const Options options_;
+  mutable std::mutex queues_mutex_;
+  std::unordered_map<std::pair<std::string, std::string>, std::unique_ptr<ModelQueue>,
+                     boost::hash<std::pair<std::string, std::string>>>
+      queues_;
+};
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -4,6 +4,7 @@
 #include <memory>
 #include "environment.h"
 #include "onnxruntime_cxx_api.h"
+#include "onnxruntime_session_options_config_keys.h"
 
 #ifdef USE_DNNL
 
@@ -50,14 +51,32 @@ void ORT_API_CALL Log(void* param, OrtLoggingLevel severity, const char* categor
   return;
 }
 
+// All sessions share one set of global thread pools instead of each paying
+// for its own. Thread counts of 0 let the runtime size both pools to the
+// number of cores.
+static Ort::Env CreateSharedEnvironment(OrtLoggingLevel severity, const char* logid, spdlog::logger* logger) {
+  OrtThreadingOptions* tp_options = nullptr;
+  Ort::ThrowOnError(Ort::GetApi().CreateThreadingOptions(&tp_options));
+  Ort::Env environment(tp_options, Log, logger, severity, logid);
+  Ort::GetApi().ReleaseThreadingOptions(tp_options);
+  return environment;
+}
+
 ServerEnvironment::ServerEnvironment(OrtLoggingLevel severity, spdlog::sinks_init_list sink) : severity_(severity),
                                                                                                logger_id_("ServerApp"),
                                                                                                sink_(sink),
                                                                                                default_logger_(std::make_shared<spdlog::logger>(logger_id_, sink)),
-                                                                                               runtime_environment_(severity, logger_id_.c_str(), Log, default_logger_.get()) {
+                                                                                               runtime_environment_(CreateSharedEnvironment(severity, logger_id_.c_str(), default_logger_.get())) {
   spdlog::set_automatic_registration(false);
   spdlog::set_level(Convert(severity_));
   spdlog::initialize_logger(default_logger_);
+
+  // One CPU arena registered on the environment serves every session rather
+  // than each session growing its own.
+  auto cpu_memory_info = Ort::MemoryInfo::CreateCpu(OrtArenaAllocator, OrtMemTypeDefault);
+  runtime_environment_.CreateAndRegisterAllocator(cpu_memory_info, nullptr);
+  options_.DisablePerSessionThreads();
+  options_.AddConfigEntry(kOrtSessionOptionsConfigUseEnvAllocators, "1");
 }
 
 void ServerEnvironment::RegisterExecutionProviders(){
@@ -129,6 +148,37 @@ std::shared_ptr<spdlog::logger> ServerEnvironment::GetAppLogger() const {
   return default_logger_;
 }
 
+void ServerEnvironment::SetModelConcurrencyLimit(int limit) {
+  model_concurrency_limit_ = limit;
+}
+
+bool ServerEnvironment::TryAcquireRequestSlot(const std::string& model_name, const std::string& model_version) const {
+  if (model_concurrency_limit_ <= 0) {
+    return true;
+  }
+  auto it = sessions_.find(std::make_pair(model_name, model_version));
+  if (it == sessions_.end()) {
+    return true;
+  }
+  int current = it->second.active_requests.load();
+  while (current < model_concurrency_limit_) {
+    if (it->second.active_requests.compare_exchange_weak(current, current + 1)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+void ServerEnvironment::ReleaseRequestSlot(const std::string& model_name, const std::string& model_version) const {
+  if (model_concurrency_limit_ <= 0) {
+    return;
+  }
+  auto it = sessions_.find(std::make_pair(model_name, model_version));
+  if (it != sessions_.end()) {
+    it->second.active_requests.fetch_sub(1);
+  }
+}
+
 void ServerEnvironment::UnloadModel(const std::string& model_name, const std::string& model_version) {
   auto identifier = std::make_pair(model_name, model_version);
   auto it = sessions_.find(identifier);
@@ -3,6 +3,7 @@
 
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <vector>
 
@@ -30,6 +31,15 @@ class ServerEnvironment {
   void UnloadModel(const std::string& model_name, const std::string& model_version);
   void RegisterExecutionProviders();
 
+  // Per-model admission control. A limit of 0 (the default) admits everything.
+  // TryAcquireRequestSlot returns false when the model is already running its
+  // limit of concurrent requests; every successful acquire must be paired with
+  // a ReleaseRequestSlot. Unknown models are admitted so the session lookup
+  // can report the missing model.
+  void SetModelConcurrencyLimit(int limit);
+  bool TryAcquireRequestSlot(const std::string& model_name, const std::string& model_version) const;
+  void ReleaseRequestSlot(const std::string& model_name, const std::string& model_version) const;
+
  private:
   const OrtLoggingLevel severity_;
   const std::string logger_id_;
@@ -38,10 +48,12 @@ class ServerEnvironment {
 
   Ort::Env runtime_environment_;
   Ort::SessionOptions options_;
+  int model_concurrency_limit_ = 0;
 
   struct SessionHolder {
     Ort::Session session;
     std::vector<std::string> output_names;
+    mutable std::atomic<int> active_requests{0};
     explicit SessionHolder(Ort::Env& env, std::string path, const Ort::SessionOptions& options) : session(nullptr) {
       session = Ort::Session(env, path.c_str(), options);
     };
@@ -8,8 +8,11 @@
 #include "onnx-ml.pb.h"
 #include "predict.pb.h"
 
+#include <chrono>
+
 #include "converter.h"
 #include "executor.h"
+#include "metrics.h"
 #include "util.h"
 
 namespace onnxruntime {
@@ -23,6 +26,17 @@ protobufutil::Status Executor::SetMLValue(const onnx::TensorProto& input_tensor,
                                           /* out */ Ort::Value& ml_value) {
   auto logger = env_->GetLogger(request_id_);
 
+  // Alias the request's raw_data buffer directly where possible. The request proto outlives
+  // the Run() call in Predict(), so the borrowed buffer stays valid for the tensor's lifetime.
+  try {
+    if (onnxruntime::server::TensorProtoToMLValueZeroCopy(input_tensor, *cpu_memory_info, ml_value)) {
+      return protobufutil::Status::OK;
+    }
+  } catch (const Ort::Exception& e) {
+    logger->error("TensorProtoToMLValueZeroCopy() failed. Message: {}", e.what());
+    return GenerateProtobufStatus(e.GetOrtErrorCode(), e.what());
+  }
+
   size_t cpu_tensor_length = 0;
   try {
     onnxruntime::server::GetSizeInBytesFromTensorProto<0>(input_tensor, &cpu_tensor_length);
@@ -101,6 +115,25 @@ protobufutil::Status Executor::Predict(const std::string& model_name,
                                        const std::string& model_version,
                                        const onnxruntime::server::PredictRequest& request,
                                        /* out */ onnxruntime::server::PredictResponse& response) {
+  if (!env_->TryAcquireRequestSlot(model_name, model_version)) {
+    auto logger = env_->GetLogger(request_id_);
+    logger->error("Rejecting request: model {} version {} is at its concurrency limit", model_name, model_version);
+    ServerMetrics::Instance().RecordRejected(model_name, model_version);
+    return protobufutil::Status(protobufutil::error::Code::RESOURCE_EXHAUSTED,
+                                "Model is at its concurrency limit, try again later");
+  }
+  auto start_time = std::chrono::steady_clock::now();
+  auto status = PredictImpl(model_name, model_version, request, response);
+  env_->ReleaseRequestSlot(model_name, model_version);
+  auto latency_ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start_time).count();
+  ServerMetrics::Instance().RecordRequest(model_name, model_version, status.ok(), latency_ms);
+  return status;
+}
+
+protobufutil::Status Executor::PredictImpl(const std::string& model_name,
+                                           const std::string& model_version,
+                                           const onnxruntime::server::PredictRequest& request,
+                                           /* out */ onnxruntime::server::PredictResponse& response) {
   auto logger = env_->GetLogger(request_id_);
 
   // Convert PredictRequest to NameMLValMap
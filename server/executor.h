@@ -30,6 +30,11 @@ class Executor {
   const std::string request_id_;
   bool using_raw_data_;
 
+  google::protobuf::util::Status PredictImpl(const std::string& model_name,
+                                             const std::string& model_version,
+                                             const onnxruntime::server::PredictRequest& request,
+                                             /* out */ onnxruntime::server::PredictResponse& response);
+
   google::protobuf::util::Status SetMLValue(const onnx::TensorProto& input_tensor,
                                             MemBufferArray& buffers,
                                             OrtMemoryInfo* cpu_memory_info,
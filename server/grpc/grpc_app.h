@@ -10,7 +10,8 @@ namespace onnxruntime {
 namespace server {
 class GRPCApp {
  public:
-  GRPCApp(const std::shared_ptr<onnxruntime::server::ServerEnvironment>& env, const std::string& host, const unsigned short port);
+  GRPCApp(const std::shared_ptr<onnxruntime::server::ServerEnvironment>& env, const std::string& host, const unsigned short port,
+          std::shared_ptr<onnxruntime::server::RequestBatcher> batcher = nullptr);
   ~GRPCApp() = default;
   GRPCApp(const GRPCApp& other) = delete;
   GRPCApp(GRPCApp&& other) = delete;
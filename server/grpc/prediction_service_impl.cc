@@ -8,13 +8,20 @@ namespace onnxruntime {
 namespace server {
 namespace grpc {
 
-PredictionServiceImpl::PredictionServiceImpl(const std::shared_ptr<onnxruntime::server::ServerEnvironment>& env) : environment_(env) {}
+PredictionServiceImpl::PredictionServiceImpl(const std::shared_ptr<onnxruntime::server::ServerEnvironment>& env,
+                                             std::shared_ptr<onnxruntime::server::RequestBatcher> batcher) : environment_(env), batcher_(std::move(batcher)) {}
 
 ::grpc::Status PredictionServiceImpl::Predict(::grpc::ServerContext* context, const ::onnxruntime::server::PredictRequest* request, ::onnxruntime::server::PredictResponse* response) {
   auto request_id = SetRequestContext(context);
-  onnxruntime::server::Executor executor(environment_.get(), request_id);
   //TODO: (csteegz) Add modelspec for both paths.
-  auto status = executor.Predict("default", "1", *request, *response);  // Currently only support one model so hard coded.
+  // Currently only support one model so hard coded.
+  google::protobuf::util::Status status;
+  if (batcher_ != nullptr) {
+    status = batcher_->Predict("default", "1", request_id, *request, *response);
+  } else {
+    onnxruntime::server::Executor executor(environment_.get(), request_id);
+    status = executor.Predict("default", "1", *request, *response);
+  }
   if (!status.ok()) {
     return ::grpc::Status(::grpc::StatusCode(status.error_code()), status.error_message());
   }
@@ -5,6 +5,7 @@
 #include "prediction_service.grpc.pb.h"
 #include "environment.h"
 #include "executor.h"
+#include "batcher.h"
 #include <grpcpp/grpcpp.h>
 
 namespace onnxruntime {
@@ -12,11 +13,13 @@ namespace server {
 namespace grpc {
 class PredictionServiceImpl final : public onnxruntime::server::PredictionService::Service {
  public:
-  PredictionServiceImpl(const std::shared_ptr<onnxruntime::server::ServerEnvironment>& env);
+  PredictionServiceImpl(const std::shared_ptr<onnxruntime::server::ServerEnvironment>& env,
+                        std::shared_ptr<onnxruntime::server::RequestBatcher> batcher = nullptr);
   ::grpc::Status Predict(::grpc::ServerContext* context, const ::onnxruntime::server::PredictRequest* request, ::onnxruntime::server::PredictResponse* response);
 
  private:
   std::shared_ptr<onnxruntime::server::ServerEnvironment> environment_;
+  std::shared_ptr<onnxruntime::server::RequestBatcher> batcher_;
 
   //Extract customer request ID and set request ID for response.
   std::string SetRequestContext(::grpc::ServerContext* context);
@@ -26,6 +26,7 @@ App::App() {
   http_details.address = boost::asio::ip::make_address_v4("0.0.0.0");
   http_details.port = 8001;
   http_details.threads = std::thread::hardware_concurrency();
+  http_details.body_limit = 25 * 1024 * 1024;
 }
 
 App& App::Bind(net::ip::address address, unsigned short port) {
@@ -39,6 +40,11 @@ App& App::NumThreads(int threads) {
   return *this;
 }
 
+App& App::BodyLimit(std::size_t body_limit) {
+  http_details.body_limit = body_limit;
+  return *this;
+}
+
 App& App::RegisterStartup(const StartFn& on_start) {
   on_start_ = on_start;
   return *this;
@@ -49,6 +55,11 @@ App& App::RegisterPost(const std::string& route, const HandlerFn& fn) {
   return *this;
 }
 
+App& App::RegisterGet(const std::string& route, const HandlerFn& fn) {
+  routes_.RegisterController(http::verb::get, route, fn);
+  return *this;
+}
+
 App& App::RegisterError(const ErrorFn& fn) {
   routes_.RegisterErrorCallback(fn);
   return *this;
@@ -57,7 +68,7 @@ App& App::RegisterError(const ErrorFn& fn) {
 App& App::Run() {
   net::io_context ioc{http_details.threads};
   // Create and launch a listening port
-  auto listener = std::make_shared<Listener>(routes_, ioc, tcp::endpoint{http_details.address, http_details.port});
+  auto listener = std::make_shared<Listener>(routes_, ioc, tcp::endpoint{http_details.address, http_details.port}, http_details.body_limit);
 
   auto initialized = listener->Init();
   if (!initialized) {
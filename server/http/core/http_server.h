@@ -27,6 +27,7 @@ struct Details {
   net::ip::address address;
   unsigned short port;
   int threads;
+  std::size_t body_limit;
 };
 
 using StartFn = std::function<void(Details&)>;
@@ -39,8 +40,10 @@ class App {
 
   App& Bind(net::ip::address address, unsigned short port);
   App& NumThreads(int threads);
+  App& BodyLimit(std::size_t body_limit);
   App& RegisterStartup(const StartFn& fn);
   App& RegisterPost(const std::string& route, const HandlerFn& fn);
+  App& RegisterGet(const std::string& route, const HandlerFn& fn);
   App& RegisterError(const ErrorFn& fn);
   App& Run();
 
@@ -11,8 +11,8 @@ namespace server {
 namespace net = boost::asio;       // from <boost/asio.hpp>
 using tcp = boost::asio::ip::tcp;  // from <boost/asio/ip/tcp.hpp>
 
-Listener::Listener(const Routes& routes, net::io_context& ioc, const tcp::endpoint& endpoint)
-    : routes_(routes), acceptor_(ioc), socket_(ioc), endpoint_(endpoint) {
+Listener::Listener(const Routes& routes, net::io_context& ioc, const tcp::endpoint& endpoint, std::size_t body_limit)
+    : routes_(routes), acceptor_(ioc), socket_(ioc), endpoint_(endpoint), body_limit_(body_limit) {
 }
 
 bool Listener::Init() {
@@ -72,7 +72,7 @@ void Listener::OnAccept(beast::error_code ec) {
   if (ec) {
     ErrorHandling(ec, "accept");
   } else {
-    std::make_shared<HttpSession>(routes_, std::move(socket_))->Run();
+    std::make_shared<HttpSession>(routes_, std::move(socket_), body_limit_)->Run();
   }
 
   // Accept another connection
@@ -22,9 +22,10 @@ class Listener : public std::enable_shared_from_this<Listener> {
   tcp::acceptor acceptor_;
   tcp::socket socket_;
   const tcp::endpoint endpoint_;
+  const std::size_t body_limit_;
 
  public:
-  Listener(const Routes& routes, net::io_context& ioc, const tcp::endpoint& endpoint);
+  Listener(const Routes& routes, net::io_context& ioc, const tcp::endpoint& endpoint, std::size_t body_limit);
 
   // Initialize the HTTP server
   bool Init();
@@ -10,15 +10,14 @@ namespace net = boost::asio;       // from <boost/asio.hpp>
 namespace beast = boost::beast;    // from <boost/beast.hpp>
 using tcp = boost::asio::ip::tcp;  // from <boost/asio/ip/tcp.hpp>
 
-HttpSession::HttpSession(const Routes& routes, tcp::socket socket)
-    : routes_(routes), socket_(std::move(socket)), strand_(socket_.get_executor()) {
+HttpSession::HttpSession(const Routes& routes, tcp::socket socket, std::size_t body_limit)
+    : routes_(routes), socket_(std::move(socket)), body_limit_(body_limit), strand_(socket_.get_executor()) {
 }
 
 void HttpSession::DoRead() {
   req_.emplace();
 
-  // TODO: make the max request size configable.
-  req_->body_limit(25 * 1024 * 1024);  // Max request size: 25 MiB
+  req_->body_limit(body_limit_);
 
   http::async_read(socket_, buffer_, *req_,
                    net::bind_executor(
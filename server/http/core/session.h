@@ -26,7 +26,7 @@ namespace http = beast::http;
 // Used by a listener to hand off the work and async write back to a socket
 class HttpSession : public std::enable_shared_from_this<HttpSession> {
  public:
-  HttpSession(const Routes& routes, tcp::socket socket);
+  HttpSession(const Routes& routes, tcp::socket socket, std::size_t body_limit);
 
   // Start the asynchronous operation
   // The entrypoint for the class
@@ -37,6 +37,7 @@ class HttpSession : public std::enable_shared_from_this<HttpSession> {
  private:
   const Routes routes_;
   tcp::socket socket_;
+  const std::size_t body_limit_;
   net::strand<net::io_context::executor_type> strand_;
   beast::flat_buffer buffer_;
   boost::optional<http::request_parser<http::string_body>> req_;
@@ -7,6 +7,8 @@
 #include "http_server.h"
 #include "json_handling.h"
 #include "executor.h"
+#include "batcher.h"
+#include "serializing/binary_tensor_format.h"
 #include "util.h"
 
 namespace onnxruntime {
@@ -35,7 +37,8 @@ void Predict(const std::string& name,
              const std::string& version,
              const std::string& action,
              /* in, out */ HttpContext& context,
-             const std::shared_ptr<ServerEnvironment>& env) {
+             const std::shared_ptr<ServerEnvironment>& env,
+             const std::shared_ptr<RequestBatcher>& batcher) {
   auto logger = env->GetLogger(context.request_id);
   logger->info("Model Name: {}, Version: {}, Action: {}", name, version, action);
 
@@ -65,9 +68,14 @@ void Predict(const std::string& name,
   }
 
   // Run Prediction
-  Executor executor(env.get(), context.request_id);
   PredictResponse predict_response{};
-  auto status = executor.Predict(effective_name, effective_version, predict_request, predict_response);
+  protobufutil::Status status;
+  if (batcher != nullptr) {
+    status = batcher->Predict(effective_name, effective_version, context.request_id, predict_request, predict_response);
+  } else {
+    Executor executor(env.get(), context.request_id);
+    status = executor.Predict(effective_name, effective_version, predict_request, predict_response);
+  }
   if (!status.ok()) {
     GenerateErrorResponse(logger, GetHttpStatusCode((status)), status.error_message(), context);
     return;
@@ -82,6 +90,13 @@ void Predict(const std::string& name,
       return;
     }
     context.response.set(http::field::content_type, "application/json");
+  } else if (response_type == SupportedContentType::RawTensors) {
+    if (!SerializeBinaryTensors(predict_response, response_body)) {
+      GenerateErrorResponse(logger, http::status::internal_server_error,
+                            "Output tensors cannot be framed as raw binary tensors", context);
+      return;
+    }
+    context.response.set(http::field::content_type, kBinaryTensorContentType);
   } else {
     response_body = predict_response.SerializeAsString();
     if (context.request.find("Accept") != context.request.end() && context.request["Accept"] != "*/*") {
@@ -96,7 +111,7 @@ void Predict(const std::string& name,
   if (!context.client_request_id.empty()) {
     context.response.insert(util::MS_CLIENT_REQUEST_ID_HEADER, context.client_request_id);
   }
-  context.response.body() = response_body;
+  context.response.body() = std::move(response_body);
   context.response.result(http::status::ok);
 };
 
@@ -122,6 +137,15 @@ static bool ParseRequestPayload(const HttpContext& context, SupportedContentType
       }
       break;
     }
+    case SupportedContentType::RawTensors: {
+      bool parse_succeeded = ParseBinaryTensors(body, predictRequest);
+      if (!parse_succeeded) {
+        error_code = http::status::bad_request;
+        error_message = "Invalid binary tensor payload.";
+        return false;
+      }
+      break;
+    }
     default: {
       error_code = http::status::bad_request;
       error_message = "Missing or unknown 'Content-Type' header field in the request";
@@ -10,6 +10,8 @@ namespace server {
 namespace beast = boost::beast;
 namespace http = beast::http;
 
+class RequestBatcher;
+
 void BadRequest(HttpContext& context, const std::string& error_message);
 
 // TODO: decide whether this should be a class
@@ -17,7 +19,8 @@ void Predict(const std::string& name,
              const std::string& version,
              const std::string& action,
              /* in, out */ HttpContext& context,
-             const std::shared_ptr<ServerEnvironment>& env);
+             const std::shared_ptr<ServerEnvironment>& env,
+             const std::shared_ptr<RequestBatcher>& batcher = nullptr);
 
 }  // namespace server
 }  // namespace onnxruntime
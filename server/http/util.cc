@@ -7,6 +7,7 @@
 #include <google/protobuf/stubs/status.h>
 
 #include "context.h"
+#include "serializing/binary_tensor_format.h"
 #include "util.h"
 
 namespace protobufutil = google::protobuf::util;
@@ -58,6 +59,8 @@ SupportedContentType GetRequestContentType(const HttpContext& context) {
   if (context.request.find("Content-Type") != context.request.end()) {
     if (context.request["Content-Type"] == "application/json") {
       return SupportedContentType::Json;
+    } else if (context.request["Content-Type"] == kBinaryTensorContentType) {
+      return SupportedContentType::RawTensors;
     } else if (protobuf_mime_types.find(context.request["Content-Type"].to_string()) != protobuf_mime_types.end()) {
       return SupportedContentType::PbByteArray;
     }
@@ -70,6 +73,8 @@ SupportedContentType GetResponseContentType(const HttpContext& context) {
   if (context.request.find("Accept") != context.request.end()) {
     if (context.request["Accept"] == "application/json") {
       return SupportedContentType::Json;
+    } else if (context.request["Accept"] == kBinaryTensorContentType) {
+      return SupportedContentType::RawTensors;
     } else if (context.request["Accept"] == "*/*" || protobuf_mime_types.find(context.request["Accept"].to_string()) != protobuf_mime_types.end()) {
       return SupportedContentType::PbByteArray;
     }
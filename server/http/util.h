@@ -17,7 +17,8 @@ namespace beast = boost::beast;  // from <boost/beast.hpp>
 enum class SupportedContentType : int {
   Unknown,
   Json,
-  PbByteArray
+  PbByteArray,
+  RawTensors
 };
 
 // Mapping protobuf status to http status
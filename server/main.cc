@@ -1,7 +1,9 @@
 // Copyright (c) Microsoft Corporation. All rights reserved.
 // Licensed under the MIT License.
 
+#include "batcher.h"
 #include "environment.h"
+#include "metrics.h"
 #include "http_server.h"
 #include "predict_request_handler.h"
 #include "server_configuration.h"
@@ -66,17 +68,35 @@ int main(int argc, char* argv[]) {
 
   try {
     env->InitializeModel(config.model_path, config.model_name, config.model_version);
+    for (const auto& model : config.model_entries) {
+      env->InitializeModel(model.path, model.name, model.version);
+      logger->info("Model name: {}, version: {}, path: {}", model.name, model.version, model.path);
+    }
     logger->debug("Initialize Model Successfully!");
   } catch (const Ort::Exception& ex) {
     logger->critical("Initialize Model Failed: {} ---- Error: [{}]", ex.GetOrtErrorCode(), ex.what());
     exit(EXIT_FAILURE);
   }
 
+  if (config.max_concurrent_requests > 0) {
+    env->SetModelConcurrencyLimit(config.max_concurrent_requests);
+    logger->info("Per-model concurrency limit: {}", config.max_concurrent_requests);
+  }
+
+  std::shared_ptr<server::RequestBatcher> batcher{};
+  if (config.max_batch_size > 1) {
+    server::RequestBatcher::Options batch_options{};
+    batch_options.max_batch_size = static_cast<size_t>(config.max_batch_size);
+    batch_options.max_wait = std::chrono::milliseconds{config.batch_max_wait_ms};
+    batcher = std::make_shared<server::RequestBatcher>(env.get(), batch_options);
+    logger->info("Request batching enabled: max batch size {}, max wait {}ms", config.max_batch_size, config.batch_max_wait_ms);
+  }
+
   //Setup GRPC Server
   auto const grpc_address = config.address;
   auto const grpc_port = config.grpc_port;
 
-  server::GRPCApp grpc_app{env, grpc_address, grpc_port};
+  server::GRPCApp grpc_app{env, grpc_address, grpc_port, batcher};
 
   logger->info("GRPC Listening at: {}:{}", grpc_address, grpc_port);
 
@@ -107,19 +127,28 @@ int main(int argc, char* argv[]) {
 
   app.RegisterPost(
       R"(/(?:v1/models/([^/:]+)(?:/versions/(\d+))?:(classify|regress|predict))|(?:score()()()))",
-      [&env](const auto& name, const auto& version, const auto& action, auto& context) -> void {
-        server::Predict(name, version, action, context, env);
+      [&env, &batcher](const auto& name, const auto& version, const auto& action, auto& context) -> void {
+        server::Predict(name, version, action, context, env, batcher);
       });
 
   app.RegisterPost(
     R"(/score()()())",
-     [&env](const auto& name, const auto& version, const auto& action, auto& context) -> void {
-        server::Predict(name, version, action, context, env);
+     [&env, &batcher](const auto& name, const auto& version, const auto& action, auto& context) -> void {
+        server::Predict(name, version, action, context, env, batcher);
       }
   );
 
+  app.RegisterGet(
+      R"(/metrics()()())",
+      [&batcher](const auto& name, const auto& version, const auto& action, auto& context) -> void {
+        context.response.body() = server::ServerMetrics::Instance().Render(batcher.get());
+        context.response.set(http::field::content_type, "text/plain; version=0.0.4");
+        context.response.result(http::status::ok);
+      });
+
   app.Bind(boost_address, config.http_port)
       .NumThreads(config.num_http_threads)
+      .BodyLimit(static_cast<std::size_t>(config.http_body_limit_mb) * 1024 * 1024)
       .Run();
 
   grpc_app.Run();
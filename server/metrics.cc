@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <sstream>
+
+#include "batcher.h"
+#include "metrics.h"
+
+namespace onnxruntime {
+namespace server {
+
+// Upper bounds of the latency histogram buckets, in milliseconds. A final
+// implicit +Inf bucket catches everything beyond the last bound.
+static const double kLatencyBucketBoundsMs[] = {1, 2, 5, 10, 20, 50, 100, 200, 500, 1000, 2000, 5000};
+static const size_t kLatencyBucketCount = sizeof(kLatencyBucketBoundsMs) / sizeof(kLatencyBucketBoundsMs[0]) + 1;
+
+ServerMetrics::ServerMetrics() = default;
+
+ServerMetrics& ServerMetrics::Instance() {
+  static ServerMetrics instance;
+  return instance;
+}
+
+ServerMetrics::ModelMetrics& ServerMetrics::GetModelMetrics(const std::string& model_name,
+                                                            const std::string& model_version) {
+  auto& metrics = models_[std::make_pair(model_name, model_version)];
+  if (metrics.latency_buckets.empty()) {
+    metrics.latency_buckets.resize(kLatencyBucketCount, 0);
+  }
+  return metrics;
+}
+
+void ServerMetrics::RecordRequest(const std::string& model_name, const std::string& model_version,
+                                  bool success, double latency_ms) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  auto& metrics = GetModelMetrics(model_name, model_version);
+  if (success) {
+    ++metrics.success_total;
+  } else {
+    ++metrics.failure_total;
+  }
+  size_t bucket = 0;
+  while (bucket < kLatencyBucketCount - 1 && latency_ms > kLatencyBucketBoundsMs[bucket]) {
+    ++bucket;
+  }
+  ++metrics.latency_buckets[bucket];
+  metrics.latency_sum_ms += latency_ms;
+  ++metrics.latency_count;
+}
+
+void ServerMetrics::RecordRejected(const std::string& model_name, const std::string& model_version) {
+  std::lock_guard<std::mutex> guard(mutex_);
+  ++GetModelMetrics(model_name, model_version).rejected_total;
+}
+
+static std::string Labels(const std::pair<std::string, std::string>& key) {
+  return "model_name=\"" + key.first + "\",model_version=\"" + key.second + "\"";
+}
+
+std::string ServerMetrics::Render(const RequestBatcher* batcher) const {
+  std::ostringstream out;
+
+  {
+    std::lock_guard<std::mutex> guard(mutex_);
+    out << "# HELP onnxruntime_server_requests_total Predict requests handled, by outcome.\n";
+    out << "# TYPE onnxruntime_server_requests_total counter\n";
+    for (const auto& entry : models_) {
+      out << "onnxruntime_server_requests_total{" << Labels(entry.first)
+          << ",outcome=\"success\"} " << entry.second.success_total << "\n";
+      out << "onnxruntime_server_requests_total{" << Labels(entry.first)
+          << ",outcome=\"failure\"} " << entry.second.failure_total << "\n";
+      out << "onnxruntime_server_requests_total{" << Labels(entry.first)
+          << ",outcome=\"rejected\"} " << entry.second.rejected_total << "\n";
+    }
+
+    out << "# HELP onnxruntime_server_request_duration_milliseconds Predict latency.\n";
+    out << "# TYPE onnxruntime_server_request_duration_milliseconds histogram\n";
+    for (const auto& entry : models_) {
+      uint64_t cumulative = 0;
+      for (size_t i = 0; i < kLatencyBucketCount; ++i) {
+        cumulative += entry.second.latency_buckets.empty() ? 0 : entry.second.latency_buckets[i];
+        out << "onnxruntime_server_request_duration_milliseconds_bucket{" << Labels(entry.first) << ",le=\"";
+        if (i < kLatencyBucketCount - 1) {
+          out << kLatencyBucketBoundsMs[i];
+        } else {
+          out << "+Inf";
+        }
+        out << "\"} " << cumulative << "\n";
+      }
+      out << "onnxruntime_server_request_duration_milliseconds_sum{" << Labels(entry.first) << "} "
+          << entry.second.latency_sum_ms << "\n";
+      out << "onnxruntime_server_request_duration_milliseconds_count{" << Labels(entry.first) << "} "
+          << entry.second.latency_count << "\n";
+    }
+  }
+
+  if (batcher != nullptr) {
+    out << "# HELP onnxruntime_server_batch_queue_depth Requests currently queued for batching.\n";
+    out << "# TYPE onnxruntime_server_batch_queue_depth gauge\n";
+    auto batch_stats = batcher->GetStats();
+    for (const auto& stats : batch_stats) {
+      auto labels = Labels(std::make_pair(stats.model_name, stats.model_version));
+      out << "onnxruntime_server_batch_queue_depth{" << labels << "} " << stats.current_queue_depth << "\n";
+    }
+    out << "# HELP onnxruntime_server_batches_total Merged batch runs executed.\n";
+    out << "# TYPE onnxruntime_server_batches_total counter\n";
+    for (const auto& stats : batch_stats) {
+      auto labels = Labels(std::make_pair(stats.model_name, stats.model_version));
+      out << "onnxruntime_server_batches_total{" << labels << "} " << stats.batches_run << "\n";
+      out << "onnxruntime_server_batched_requests_total{" << labels << "} " << stats.batched_requests << "\n";
+      out << "onnxruntime_server_individual_runs_total{" << labels << "} " << stats.individual_runs << "\n";
+    }
+    out << "# HELP onnxruntime_server_batch_queue_wait_milliseconds_total Time requests spent queued before running.\n";
+    out << "# TYPE onnxruntime_server_batch_queue_wait_milliseconds_total counter\n";
+    for (const auto& stats : batch_stats) {
+      auto labels = Labels(std::make_pair(stats.model_name, stats.model_version));
+      out << "onnxruntime_server_batch_queue_wait_milliseconds_total{" << labels << "} "
+          << stats.queue_wait_ms_total << "\n";
+      out << "onnxruntime_server_max_batch_size{" << labels << "} " << stats.max_batch_size_seen << "\n";
+      out << "onnxruntime_server_max_batch_queue_depth{" << labels << "} " << stats.max_queue_depth_seen << "\n";
+    }
+  }
+
+  return out.str();
+}
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,53 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <cstdint>
+#include <map>
+#include <mutex>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace onnxruntime {
+namespace server {
+
+class RequestBatcher;
+
+// Low-overhead request counters and latency histograms, rendered in the
+// Prometheus text exposition format for a /metrics endpoint. Histograms use
+// cumulative buckets so percentile math happens at scrape time, not here.
+class ServerMetrics {
+ public:
+  ServerMetrics();
+
+  // The process-wide registry the executor records into.
+  static ServerMetrics& Instance();
+
+  void RecordRequest(const std::string& model_name, const std::string& model_version,
+                     bool success, double latency_ms);
+  void RecordRejected(const std::string& model_name, const std::string& model_version);
+
+  // Renders every recorded series, plus the batcher's queue and batch-size
+  // counters when a batcher is in use.
+  std::string Render(const RequestBatcher* batcher) const;
+
+ private:
+  struct ModelMetrics {
+    uint64_t success_total = 0;
+    uint64_t failure_total = 0;
+    uint64_t rejected_total = 0;
+    std::vector<uint64_t> latency_buckets;  // one count per bound, plus +Inf
+    double latency_sum_ms = 0;
+    uint64_t latency_count = 0;
+  };
+
+  ModelMetrics& GetModelMetrics(const std::string& model_name, const std::string& model_version);
+
+  mutable std::mutex mutex_;
+  std::map<std::pair<std::string, std::string>, ModelMetrics> models_;
+};
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,139 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cstring>
+
+#include "onnx-ml.pb.h"
+
+#include "binary_tensor_format.h"
+
+namespace onnxruntime {
+namespace server {
+
+const char* const kBinaryTensorContentType = "application/x-ort-binary-tensors";
+
+static const char kMagic[4] = {'O', 'R', 'T', 'B'};
+// Sanity caps so a malformed length prefix cannot drive huge allocations.
+static const uint32_t kMaxNameLen = 1 << 20;
+static const uint32_t kMaxRank = 128;
+
+namespace {
+// Bounds-checked little-endian reader over the request body.
+class Cursor {
+ public:
+  Cursor(const char* data, size_t size) : data_(data), size_(size), pos_(0) {}
+
+  bool Read(void* out, size_t count) {
+    if (count > size_ - pos_) {
+      return false;
+    }
+    std::memcpy(out, data_ + pos_, count);
+    pos_ += count;
+    return true;
+  }
+
+  bool SkipPadding() {
+    size_t pad = (kBinaryTensorAlignment - pos_ % kBinaryTensorAlignment) % kBinaryTensorAlignment;
+    if (pad > size_ - pos_) {
+      return false;
+    }
+    pos_ += pad;
+    return true;
+  }
+
+  const char* Current() const { return data_ + pos_; }
+  bool AtEnd() const { return pos_ == size_; }
+  size_t Remaining() const { return size_ - pos_; }
+  void Advance(size_t count) { pos_ += count; }
+
+ private:
+  const char* data_;
+  size_t size_;
+  size_t pos_;
+};
+}  // namespace
+
+bool ParseBinaryTensors(const std::string& body, PredictRequest& request) {
+  Cursor cursor(body.data(), body.size());
+  char magic[4];
+  uint32_t version;
+  if (!cursor.Read(magic, sizeof(magic)) || std::memcmp(magic, kMagic, sizeof(kMagic)) != 0 ||
+      !cursor.Read(&version, sizeof(version)) || version != kBinaryTensorVersion) {
+    return false;
+  }
+
+  while (!cursor.AtEnd()) {
+    uint32_t name_len;
+    if (!cursor.Read(&name_len, sizeof(name_len)) || name_len == 0 || name_len > kMaxNameLen ||
+        name_len > cursor.Remaining()) {
+      return false;
+    }
+    std::string name(cursor.Current(), name_len);
+    cursor.Advance(name_len);
+
+    int32_t dtype;
+    uint32_t rank;
+    if (!cursor.Read(&dtype, sizeof(dtype)) || dtype == onnx::TensorProto_DataType_STRING ||
+        dtype == onnx::TensorProto_DataType_UNDEFINED ||
+        !cursor.Read(&rank, sizeof(rank)) || rank > kMaxRank) {
+      return false;
+    }
+
+    if (request.inputs().count(name) != 0) {
+      return false;
+    }
+    onnx::TensorProto& tensor = (*request.mutable_inputs())[name];
+    tensor.set_data_type(dtype);
+    for (uint32_t i = 0; i < rank; ++i) {
+      int64_t dim;
+      if (!cursor.Read(&dim, sizeof(dim)) || dim < 0) {
+        return false;
+      }
+      tensor.add_dims(dim);
+    }
+
+    uint64_t payload_len;
+    if (!cursor.Read(&payload_len, sizeof(payload_len)) || !cursor.SkipPadding() ||
+        payload_len > cursor.Remaining()) {
+      return false;
+    }
+    tensor.mutable_raw_data()->assign(cursor.Current(), static_cast<size_t>(payload_len));
+    cursor.Advance(static_cast<size_t>(payload_len));
+  }
+
+  return request.inputs_size() > 0;
+}
+
+template <typename T>
+static void Append(std::string& out, const T& value) {
+  out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+bool SerializeBinaryTensors(const PredictResponse& response, std::string& body) {
+  body.clear();
+  body.append(kMagic, sizeof(kMagic));
+  Append(body, kBinaryTensorVersion);
+
+  for (const auto& entry : response.outputs()) {
+    const onnx::TensorProto& tensor = entry.second;
+    if (!tensor.has_raw_data() || tensor.data_type() == onnx::TensorProto_DataType_STRING ||
+        tensor.data_type() == onnx::TensorProto_DataType_UNDEFINED) {
+      return false;
+    }
+    Append(body, static_cast<uint32_t>(entry.first.size()));
+    body.append(entry.first);
+    Append(body, static_cast<int32_t>(tensor.data_type()));
+    Append(body, static_cast<uint32_t>(tensor.dims_size()));
+    for (int i = 0; i < tensor.dims_size(); ++i) {
+      Append(body, static_cast<int64_t>(tensor.dims(i)));
+    }
+    Append(body, static_cast<uint64_t>(tensor.raw_data().size()));
+    body.append((kBinaryTensorAlignment - body.size() % kBinaryTensorAlignment) % kBinaryTensorAlignment, '\0');
+    body.append(tensor.raw_data());
+  }
+
+  return true;
+}
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -0,0 +1,41 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#pragma once
+
+#include <string>
+
+#include "predict.pb.h"
+
+namespace onnxruntime {
+namespace server {
+
+/**
+ * Length-prefixed raw binary tensor framing for perf-critical clients, cheaper
+ * to produce and consume than TensorProto for large dense tensors. Layout, all
+ * integers little-endian:
+ *   "ORTB" magic, uint32 version (1)
+ *   then per tensor:
+ *     uint32 name_len, name bytes
+ *     int32 dtype (the onnx.TensorProto.DataType value, numerically identical
+ *                  to ONNXTensorElementDataType)
+ *     uint32 rank, int64 dims[rank]
+ *     uint64 payload_len
+ *     zero padding up to the next 64-byte boundary from the start of the stream
+ *     payload bytes (raw little-endian element data)
+ * String tensors cannot be framed this way.
+ */
+extern const char* const kBinaryTensorContentType;
+constexpr uint32_t kBinaryTensorVersion = 1;
+constexpr size_t kBinaryTensorAlignment = 64;
+
+// Parses a framed payload into the request's input map. Returns false on a
+// malformed payload, leaving the request in an unspecified state.
+bool ParseBinaryTensors(const std::string& body, /* out */ PredictRequest& request);
+
+// Frames every response output. Returns false when an output cannot be framed
+// (no raw_data or a string tensor).
+bool SerializeBinaryTensors(const PredictResponse& response, /* out */ std::string& body);
+
+}  // namespace server
+}  // namespace onnxruntime
@@ -378,6 +378,71 @@ void TensorProtoToMLValue(const onnx::TensorProto& tensor_proto, const MemBuffer
   value = Ort::Value::CreateTensor(&allocator, tensor_data, m.GetLen(), tensor_shape_vec.data(), tensor_shape_vec.size(), (ONNXTensorElementDataType)tensor_proto.data_type());
   return;
 }
+// Size in bytes of one element, or 0 for types that cannot be aliased from raw_data.
+static size_t GetElementSize(ONNXTensorElementDataType ele_type) noexcept {
+  switch (ele_type) {
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_BOOL:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT8:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT8:
+      return 1;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT16:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_BFLOAT16:
+      return 2;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_FLOAT:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT32:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT32:
+      return 4;
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_DOUBLE:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_INT64:
+    case ONNX_TENSOR_ELEMENT_DATA_TYPE_UINT64:
+      return 8;
+    default:
+      // string, complex and undefined types always need the deserializing path
+      return 0;
+  }
+}
+
+bool TensorProtoToMLValueZeroCopy(const onnx::TensorProto& tensor_proto, const OrtMemoryInfo& info,
+                                  Ort::Value& value) {
+  if (!IsLittleEndianOrder()) {
+    // raw_data is little-endian on the wire; a big-endian host must byte-swap, i.e. copy
+    return false;
+  }
+  if (!tensor_proto.has_raw_data() ||
+      tensor_proto.data_location() == onnx::TensorProto_DataLocation::TensorProto_DataLocation_EXTERNAL) {
+    return false;
+  }
+  ONNXTensorElementDataType ele_type = CApiElementTypeFromProtoType(tensor_proto.data_type());
+  size_t ele_size = GetElementSize(ele_type);
+  if (ele_size == 0) {
+    return false;
+  }
+  size_t tensor_size = 1;
+  for (auto i : tensor_proto.dims()) {
+    if (i < 0) throw Ort::Exception("Tensor can't contain negative dims", OrtErrorCode::ORT_FAIL);
+    if (!CalcMemSizeForArray(tensor_size, static_cast<size_t>(i), &tensor_size)) {
+      throw Ort::Exception("Size overflow", OrtErrorCode::ORT_INVALID_ARGUMENT);
+    }
+  }
+  size_t expected_bytes;
+  if (!CalcMemSizeForArray(tensor_size, ele_size, &expected_bytes)) {
+    throw Ort::Exception("Size overflow", OrtErrorCode::ORT_INVALID_ARGUMENT);
+  }
+  const std::string& raw = tensor_proto.raw_data();
+  if (raw.size() != expected_bytes) {
+    return false;
+  }
+  if (reinterpret_cast<uintptr_t>(raw.data()) % ele_size != 0) {
+    return false;
+  }
+  std::vector<int64_t> tensor_shape_vec = GetTensorShapeFromTensorProto(tensor_proto);
+  value = Ort::Value::CreateTensor(&info, const_cast<char*>(raw.data()), raw.size(),
+                                   tensor_shape_vec.data(), tensor_shape_vec.size(), ele_type);
+  return true;
+}
+
 template void GetSizeInBytesFromTensorProto<256>(const onnx::TensorProto& tensor_proto,
                                                  size_t* out);
 template void GetSizeInBytesFromTensorProto<0>(const onnx::TensorProto& tensor_proto, size_t* out);
@@ -27,6 +27,16 @@ void GetSizeInBytesFromTensorProto(const onnx::TensorProto& tensor_proto, size_t
  */
 void TensorProtoToMLValue(const onnx::TensorProto& input, const server::MemBuffer& m, /* out */ Ort::Value& value);
 
+/**
+ * Try to create a tensor value that aliases the proto's raw_data buffer in place instead of
+ * deserializing into a copy. Returns false (leaving value untouched) when aliasing is not
+ * possible: no raw_data, a string/complex/undefined element type, a big-endian host, a size
+ * mismatch, or a buffer address that is not aligned for the element type.
+ * The proto must outlive the returned value.
+ */
+bool TensorProtoToMLValueZeroCopy(const onnx::TensorProto& input, const OrtMemoryInfo& info,
+                                  /* out */ Ort::Value& value);
+
 template <typename T>
 void UnpackTensor(const onnx::TensorProto& tensor, const void* raw_data, size_t raw_data_len,
                   /*out*/ T* p_data, int64_t expected_size);
@@ -6,6 +6,7 @@
 #include <thread>
 #include <fstream>
 #include <unordered_map>
+#include <vector>
 
 #include "boost/program_options.hpp"
 #include "onnxruntime_cxx_api.h"
@@ -41,10 +42,21 @@ class ServerConfiguration {
   std::string model_path;
   std::string model_name = "default";
   std::string model_version = "1";
+  struct ModelEntry {
+    std::string name;
+    std::string version;
+    std::string path;
+  };
+  // Additional models parsed from repeated --model name:version:path options.
+  std::vector<ModelEntry> model_entries;
+  int max_concurrent_requests = 0;
   std::string address = "0.0.0.0";
   unsigned short http_port = 8001;
   unsigned short grpc_port = 50051;
   int num_http_threads = std::thread::hardware_concurrency();
+  int http_body_limit_mb = 25;
+  int max_batch_size = 1;
+  int batch_max_wait_ms = 2;
   OrtLoggingLevel logging_level{};
 
   ServerConfiguration() {
@@ -56,7 +68,12 @@ class ServerConfiguration {
     desc.add_options()("address", po::value(&address)->default_value(address), "The base HTTP address");
     desc.add_options()("http_port", po::value(&http_port)->default_value(http_port), "HTTP port to listen to requests");
     desc.add_options()("num_http_threads", po::value(&num_http_threads)->default_value(num_http_threads), "Number of http threads");
+    desc.add_options()("http_body_limit_mb", po::value(&http_body_limit_mb)->default_value(http_body_limit_mb), "Largest HTTP request body accepted, in MiB");
     desc.add_options()("grpc_port", po::value(&grpc_port)->default_value(grpc_port), "GRPC port to listen to requests");
+    desc.add_options()("max_batch_size", po::value(&max_batch_size)->default_value(max_batch_size), "Coalesce concurrent requests for a model into batches of up to this many requests along the batch axis. 1 disables batching");
+    desc.add_options()("batch_max_wait_ms", po::value(&batch_max_wait_ms)->default_value(batch_max_wait_ms), "Milliseconds a request may wait for others to join its batch. Only used when max_batch_size is greater than 1");
+    desc.add_options()("model", po::value(&models_)->composing(), "Additional model to host, as name:version:path. May be given multiple times");
+    desc.add_options()("max_concurrent_requests", po::value(&max_concurrent_requests)->default_value(max_concurrent_requests), "Largest number of requests a single model may run concurrently; requests beyond it are rejected. 0 disables the limit");
   }
 
   // Parses argc and argv and sets the values for the class
@@ -93,6 +110,7 @@ class ServerConfiguration {
   po::options_description desc{"Allowed options"};
   po::variables_map vm{};
   std::string log_level_str = "info";
+  std::vector<std::string> models_{};
 
   // Print help and return if there is a bad value
   Result ValidateOptions() {
@@ -103,12 +121,47 @@ class ServerConfiguration {
     } else if (num_http_threads <= 0) {
       PrintHelp(std::cerr, "num_http_threads must be greater than 0");
       return Result::ExitFailure;
+    } else if (http_body_limit_mb <= 0) {
+      PrintHelp(std::cerr, "http_body_limit_mb must be greater than 0");
+      return Result::ExitFailure;
+    } else if (max_batch_size <= 0) {
+      PrintHelp(std::cerr, "max_batch_size must be greater than 0");
+      return Result::ExitFailure;
+    } else if (batch_max_wait_ms < 0) {
+      PrintHelp(std::cerr, "batch_max_wait_ms must not be negative");
+      return Result::ExitFailure;
+    } else if (max_concurrent_requests < 0) {
+      PrintHelp(std::cerr, "max_concurrent_requests must not be negative");
+      return Result::ExitFailure;
     } else if (!file_exists(model_path)) {
       PrintHelp(std::cerr, "model_path must be the location of a valid file");
       return Result::ExitFailure;
     } else {
-      return Result::ContinueSuccess;
+      return ParseModelEntries();
+    }
+  }
+
+  // Parses each --model option of the form name:version:path
+  Result ParseModelEntries() {
+    for (const auto& entry : models_) {
+      auto first = entry.find(':');
+      auto second = first == std::string::npos ? first : entry.find(':', first + 1);
+      if (first == std::string::npos || second == std::string::npos) {
+        PrintHelp(std::cerr, "model must be of the form name:version:path");
+        return Result::ExitFailure;
+      }
+      ModelEntry model{entry.substr(0, first), entry.substr(first + 1, second - first - 1), entry.substr(second + 1)};
+      if (model.name.empty() || model.version.empty() || model.path.empty()) {
+        PrintHelp(std::cerr, "model must be of the form name:version:path");
+        return Result::ExitFailure;
+      }
+      if (!file_exists(model.path)) {
+        PrintHelp(std::cerr, "model path must be the location of a valid file");
+        return Result::ExitFailure;
+      }
+      model_entries.push_back(std::move(model));
     }
+    return Result::ContinueSuccess;
   }
 
   // Checks if program options contains help
@@ -0,0 +1,113 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <thread>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "batcher.h"
+#include "onnx-ml.pb.h"
+#include "test_server_environment.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+class BatcherTest : public ::testing::Test {
+ protected:
+  void SetUp() override {
+    const static auto model_file = "testdata/mul_1.onnx";
+
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    env->InitializeModel(model_file, "Name", "version");
+  }
+
+  void TearDown() override {
+    onnxruntime::server::ServerEnvironment* env = ServerEnv();
+    env->UnloadModel("Name", "version");
+  }
+
+  static PredictRequest MakeMulRequest(float scale) {
+    PredictRequest request{};
+    onnx::TensorProto& input = (*request.mutable_inputs())["X"];
+    input.set_data_type(onnx::TensorProto_DataType_FLOAT);
+    input.add_dims(3);
+    input.add_dims(2);
+    const float input_data[] = {1 * scale, 2 * scale, 3 * scale, 4 * scale, 5 * scale, 6 * scale};
+    input.set_raw_data(input_data, sizeof(input_data));
+    request.add_output_filter("Y");
+    return request;
+  }
+
+  static void CheckMulResponse(const PredictResponse& response, float scale) {
+    const auto& output = response.outputs().at("Y");
+    ASSERT_TRUE(output.has_raw_data());
+    ASSERT_EQ(output.raw_data().size(), 6 * sizeof(float));
+    ASSERT_EQ(output.dims_size(), 2);
+    EXPECT_EQ(output.dims(0), 3);
+    EXPECT_EQ(output.dims(1), 2);
+    const auto* output_data = reinterpret_cast<const float*>(output.raw_data().data());
+    const float expected[] = {1, 4, 9, 16, 25, 36};
+    for (size_t i = 0; i < 6; ++i) {
+      EXPECT_FLOAT_EQ(expected[i] * scale, output_data[i]);
+    }
+  }
+};
+
+TEST_F(BatcherTest, ConcurrentRequestsGetTheirOwnResults) {
+  RequestBatcher::Options options{};
+  options.max_batch_size = 4;
+  options.max_wait = std::chrono::milliseconds{20};
+  RequestBatcher batcher(ServerEnv(), options);
+
+  constexpr size_t request_count = 4;
+  std::vector<PredictRequest> requests;
+  std::vector<PredictResponse> responses{request_count};
+  std::vector<google::protobuf::util::Status> statuses{request_count};
+  for (size_t i = 0; i < request_count; ++i) {
+    requests.push_back(MakeMulRequest(static_cast<float>(i + 1)));
+  }
+
+  std::vector<std::thread> threads;
+  for (size_t i = 0; i < request_count; ++i) {
+    threads.emplace_back([&, i] {
+      statuses[i] = batcher.Predict("Name", "version", "RequestId", requests[i], responses[i]);
+    });
+  }
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (size_t i = 0; i < request_count; ++i) {
+    EXPECT_TRUE(statuses[i].ok());
+    CheckMulResponse(responses[i], static_cast<float>(i + 1));
+  }
+
+  auto stats = batcher.GetStats();
+  ASSERT_EQ(stats.size(), 1u);
+  EXPECT_EQ(stats[0].model_name, "Name");
+  EXPECT_EQ(stats[0].model_version, "version");
+  EXPECT_EQ(stats[0].requests_received, request_count);
+  EXPECT_EQ(stats[0].batched_requests + stats[0].individual_runs, request_count);
+  EXPECT_EQ(stats[0].current_queue_depth, 0u);
+}
+
+TEST_F(BatcherTest, BatchingDisabledRunsInline) {
+  RequestBatcher::Options options{};
+  options.max_batch_size = 1;
+  RequestBatcher batcher(ServerEnv(), options);
+
+  auto request = MakeMulRequest(1);
+  PredictResponse response{};
+  auto status = batcher.Predict("Name", "version", "RequestId", request, response);
+  EXPECT_TRUE(status.ok());
+  CheckMulResponse(response, 1);
+
+  // No queue is created when batching is disabled.
+  EXPECT_TRUE(batcher.GetStats().empty());
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
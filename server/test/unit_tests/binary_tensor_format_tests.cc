@@ -0,0 +1,101 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include <cstring>
+#include <vector>
+
+#include "gtest/gtest.h"
+
+#include "onnx-ml.pb.h"
+#include "serializing/binary_tensor_format.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+template <typename T>
+static void Append(std::string& out, const T& value) {
+  out.append(reinterpret_cast<const char*>(&value), sizeof(value));
+}
+
+static std::string FrameFloatTensor(const std::string& name, const std::vector<int64_t>& dims,
+                                    const std::vector<float>& payload) {
+  std::string body;
+  body.append("ORTB", 4);
+  Append(body, kBinaryTensorVersion);
+  Append(body, static_cast<uint32_t>(name.size()));
+  body.append(name);
+  Append(body, static_cast<int32_t>(onnx::TensorProto_DataType_FLOAT));
+  Append(body, static_cast<uint32_t>(dims.size()));
+  for (auto dim : dims) {
+    Append(body, dim);
+  }
+  Append(body, static_cast<uint64_t>(payload.size() * sizeof(float)));
+  body.append((kBinaryTensorAlignment - body.size() % kBinaryTensorAlignment) % kBinaryTensorAlignment, '\0');
+  body.append(reinterpret_cast<const char*>(payload.data()), payload.size() * sizeof(float));
+  return body;
+}
+
+TEST(BinaryTensorFormatTests, ParseSingleTensor) {
+  auto body = FrameFloatTensor("X", {3, 2}, {1, 2, 3, 4, 5, 6});
+
+  PredictRequest request{};
+  ASSERT_TRUE(ParseBinaryTensors(body, request));
+  ASSERT_EQ(request.inputs_size(), 1);
+  const auto& tensor = request.inputs().at("X");
+  EXPECT_EQ(tensor.data_type(), onnx::TensorProto_DataType_FLOAT);
+  ASSERT_EQ(tensor.dims_size(), 2);
+  EXPECT_EQ(tensor.dims(0), 3);
+  EXPECT_EQ(tensor.dims(1), 2);
+  ASSERT_EQ(tensor.raw_data().size(), 6 * sizeof(float));
+  const auto* values = reinterpret_cast<const float*>(tensor.raw_data().data());
+  EXPECT_EQ(values[0], 1);
+  EXPECT_EQ(values[5], 6);
+}
+
+TEST(BinaryTensorFormatTests, RejectsMalformedPayloads) {
+  PredictRequest request{};
+  EXPECT_FALSE(ParseBinaryTensors("", request));
+  EXPECT_FALSE(ParseBinaryTensors("not a frame", request));
+
+  // truncated payload: header promises more bytes than the body holds
+  auto body = FrameFloatTensor("X", {3, 2}, {1, 2, 3, 4, 5, 6});
+  body.resize(body.size() - 8);
+  PredictRequest truncated{};
+  EXPECT_FALSE(ParseBinaryTensors(body, truncated));
+}
+
+TEST(BinaryTensorFormatTests, SerializeRoundTrip) {
+  PredictResponse response{};
+  onnx::TensorProto& output = (*response.mutable_outputs())["Y"];
+  output.set_data_type(onnx::TensorProto_DataType_FLOAT);
+  output.add_dims(2);
+  const float payload[] = {1.5f, -2.5f};
+  output.set_raw_data(payload, sizeof(payload));
+
+  std::string body;
+  ASSERT_TRUE(SerializeBinaryTensors(response, body));
+
+  PredictRequest round_trip{};
+  ASSERT_TRUE(ParseBinaryTensors(body, round_trip));
+  const auto& tensor = round_trip.inputs().at("Y");
+  ASSERT_EQ(tensor.raw_data().size(), sizeof(payload));
+  EXPECT_EQ(0, std::memcmp(tensor.raw_data().data(), payload, sizeof(payload)));
+  // payload starts on a 64-byte boundary so receivers can alias it directly
+  EXPECT_EQ((body.size() - sizeof(payload)) % kBinaryTensorAlignment, 0u);
+}
+
+TEST(BinaryTensorFormatTests, SerializeRejectsNonRawOutputs) {
+  PredictResponse response{};
+  onnx::TensorProto& output = (*response.mutable_outputs())["Y"];
+  output.set_data_type(onnx::TensorProto_DataType_FLOAT);
+  output.add_dims(1);
+  output.add_float_data(1.0f);
+
+  std::string body;
+  EXPECT_FALSE(SerializeBinaryTensors(response, body));
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
@@ -6,6 +6,7 @@
 #include "gtest/gtest.h"
 
 #include "executor.h"
+#include "onnx-ml.pb.h"
 #include "http/json_handling.h"
 #include <spdlog/spdlog.h>
 #include <spdlog/sinks/sink.h>
@@ -52,6 +53,35 @@ TEST_F(ExecutorTest, TestMul_1) {
   EXPECT_EQ(expected, body);
 }
 
+TEST_F(ExecutorTest, TestMul_1_RawData) {
+  // raw_data inputs take the zero-copy aliasing path in SetMLValue
+  onnxruntime::server::ServerEnvironment* env = ServerEnv();
+
+  onnxruntime::server::Executor executor(env, "RequestId");
+  onnxruntime::server::PredictRequest request{};
+  onnxruntime::server::PredictResponse response{};
+
+  onnx::TensorProto& input = (*request.mutable_inputs())["X"];
+  input.set_data_type(onnx::TensorProto_DataType_FLOAT);
+  input.add_dims(3);
+  input.add_dims(2);
+  const float input_data[] = {1, 2, 3, 4, 5, 6};
+  input.set_raw_data(input_data, sizeof(input_data));
+  request.add_output_filter("Y");
+
+  auto prediction_res = executor.Predict("Name", "version", request, response);
+  EXPECT_TRUE(prediction_res.ok());
+
+  const auto& output = response.outputs().at("Y");
+  ASSERT_TRUE(output.has_raw_data());
+  ASSERT_EQ(output.raw_data().size(), sizeof(input_data));
+  const auto* output_data = reinterpret_cast<const float*>(output.raw_data().data());
+  const float expected[] = {1, 4, 9, 16, 25, 36};
+  for (size_t i = 0; i < 6; ++i) {
+    EXPECT_EQ(expected[i], output_data[i]);
+  }
+}
+
 }  // namespace test
 }  // namespace server
 }  // namespace onnxruntime
@@ -0,0 +1,47 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License.
+
+#include "gtest/gtest.h"
+#include "gmock/gmock.h"
+
+#include "metrics.h"
+
+namespace onnxruntime {
+namespace server {
+namespace test {
+
+TEST(MetricsTests, RendersCountersAndHistogram) {
+  ServerMetrics metrics{};
+  metrics.RecordRequest("mul", "1", /* success */ true, 3.5);
+  metrics.RecordRequest("mul", "1", /* success */ true, 150);
+  metrics.RecordRequest("mul", "1", /* success */ false, 0.5);
+  metrics.RecordRejected("mul", "1");
+
+  auto body = metrics.Render(nullptr);
+  EXPECT_THAT(body, testing::HasSubstr(
+                        "onnxruntime_server_requests_total{model_name=\"mul\",model_version=\"1\",outcome=\"success\"} 2"));
+  EXPECT_THAT(body, testing::HasSubstr(
+                        "onnxruntime_server_requests_total{model_name=\"mul\",model_version=\"1\",outcome=\"failure\"} 1"));
+  EXPECT_THAT(body, testing::HasSubstr(
+                        "onnxruntime_server_requests_total{model_name=\"mul\",model_version=\"1\",outcome=\"rejected\"} 1"));
+  // 0.5ms and 3.5ms fall at or below the 5ms bound, 150ms only shows up from the 200ms bound on
+  EXPECT_THAT(body, testing::HasSubstr(
+                        "onnxruntime_server_request_duration_milliseconds_bucket{model_name=\"mul\",model_version=\"1\",le=\"5\"} 2"));
+  EXPECT_THAT(body, testing::HasSubstr(
+                        "onnxruntime_server_request_duration_milliseconds_bucket{model_name=\"mul\",model_version=\"1\",le=\"200\"} 3"));
+  EXPECT_THAT(body, testing::HasSubstr(
+                        "onnxruntime_server_request_duration_milliseconds_bucket{model_name=\"mul\",model_version=\"1\",le=\"+Inf\"} 3"));
+  EXPECT_THAT(body, testing::HasSubstr(
+                        "onnxruntime_server_request_duration_milliseconds_count{model_name=\"mul\",model_version=\"1\"} 3"));
+}
+
+TEST(MetricsTests, EmptyRegistryRendersHeadersOnly) {
+  ServerMetrics metrics{};
+  auto body = metrics.Render(nullptr);
+  EXPECT_THAT(body, testing::HasSubstr("# TYPE onnxruntime_server_requests_total counter"));
+  EXPECT_THAT(body, testing::Not(testing::HasSubstr("model_name=")));
+}
+
+}  // namespace test
+}  // namespace server
+}  // namespace onnxruntime
@@ -84,6 +84,37 @@ TEST(ConfigParsingTests, ModelNotFound) {
   EXPECT_EQ(res, Result::ExitFailure);
 }
 
+TEST(ConfigParsingTests, AdditionalModels) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx"),
+      const_cast<char*>("--num_http_threads"), const_cast<char*>("3"),
+      const_cast<char*>("--model"), const_cast<char*>("mul:2:testdata/mul_1.onnx"),
+      const_cast<char*>("--model"), const_cast<char*>("mul:3:testdata/mul_1.onnx"),
+      const_cast<char*>("--max_concurrent_requests"), const_cast<char*>("16")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(11, test_argv);
+  EXPECT_EQ(res, Result::ContinueSuccess);
+  ASSERT_EQ(config.model_entries.size(), 2u);
+  EXPECT_EQ(config.model_entries[0].name, "mul");
+  EXPECT_EQ(config.model_entries[0].version, "2");
+  EXPECT_EQ(config.model_entries[0].path, "testdata/mul_1.onnx");
+  EXPECT_EQ(config.model_entries[1].version, "3");
+  EXPECT_EQ(config.max_concurrent_requests, 16);
+}
+
+TEST(ConfigParsingTests, MalformedAdditionalModel) {
+  char* test_argv[] = {
+      const_cast<char*>("/path/to/binary"),
+      const_cast<char*>("--model_path"), const_cast<char*>("testdata/mul_1.onnx"),
+      const_cast<char*>("--model"), const_cast<char*>("missing_a_version:testdata/mul_1.onnx")};
+
+  onnxruntime::server::ServerConfiguration config{};
+  Result res = config.ParseInput(5, test_argv);
+  EXPECT_EQ(res, Result::ExitFailure);
+}
+
 TEST(ConfigParsingTests, WrongLoggingLevel) {
   char* test_argv[] = {
       const_cast<char*>("/path/to/binary"),
@@ -454,6 +454,12 @@ def parse_arguments():
     parser.add_argument("--include_ops_by_config", type=str,
                         help="Include ops from config file. "
                              "See /docs/Reduced_Operator_Kernel_build.md for more information.")
+    parser.add_argument("--include_ops_by_model", type=str,
+                        help="Include only the ops and types required by the ORT format model/s in the given path. "
+                             "A configuration file with the required operators and types is generated in the build "
+                             "directory and applied as if it was provided via --include_ops_by_config with "
+                             "--enable_reduced_operator_type_support. "
+                             "See /docs/Reduced_Operator_Kernel_build.md for more information.")
     parser.add_argument("--enable_reduced_operator_type_support", action='store_true',
                         help='If --include_ops_by_config is specified, and the configuration file has type reduction '
                              'information, limit the types individual operators support where possible to further '
@@ -483,7 +489,7 @@ def parse_arguments():
 
 
 def is_reduced_ops_build(args):
-    return args.include_ops_by_config is not None
+    return args.include_ops_by_config is not None or args.include_ops_by_model is not None
 
 
 def resolve_executable_path(command_or_path):
@@ -1750,10 +1756,27 @@ def main():
         args.test = False
 
     if is_reduced_ops_build(args) and args.update:
+        if args.include_ops_by_model and args.include_ops_by_config:
+            raise BuildError(
+                'Only one of --include_ops_by_model and --include_ops_by_config may be specified.')
+
+        config_path = args.include_ops_by_config
+        enable_type_reduction = args.enable_reduced_operator_type_support
+
+        if args.include_ops_by_model:
+            # Generate the configuration with the required operators and types from the ORT format
+            # model/s, and apply it like a hand-written configuration file. Type reduction is always
+            # enabled as the type information comes directly from the models.
+            from util.ort_format_model import create_config_from_models
+            config_path = os.path.join(args.build_dir, 'required_operators_and_types.config')
+            os.makedirs(args.build_dir, exist_ok=True)
+            create_config_from_models(args.include_ops_by_model, config_path, enable_type_reduction=True)
+            enable_type_reduction = True
+
         from reduce_op_kernels import reduce_ops
         reduce_ops(
-            config_path=args.include_ops_by_config,
-            enable_type_reduction=args.enable_reduced_operator_type_support,
+            config_path=config_path,
+            enable_type_reduction=enable_type_reduction,
             use_cuda=args.use_cuda)
 
     if args.use_tensorrt: